@@ -0,0 +1,273 @@
+/*
+** bench.c
+**
+** The benchmark harness. See bench.h.
+*/
+#include "bench.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+
+#if defined(WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#include <sys/time.h>
+#endif
+
+#define MAX_BASELINES 1024
+#define MAX_REPETITIONS 101
+
+struct baseline {
+    char name[128];
+    double median_ns;
+};
+
+static const char *s_suite = "";
+static const char *s_filter = NULL;
+static FILE *s_output = NULL;
+static int s_repetitions = 5;
+static double s_min_time = 0.05;
+static double s_threshold = 10.0;
+static struct baseline s_baselines[MAX_BASELINES];
+static int s_num_baselines = 0;
+static int s_num_regressions = 0;
+static int s_num_compared = 0;
+static double s_sink = 0.0;
+
+static double
+now()
+{
+#if defined(WIN32)
+    LARGE_INTEGER count;
+    LARGE_INTEGER frequency;
+
+    QueryPerformanceCounter(&count);
+    QueryPerformanceFrequency(&frequency);
+    return (double)count.QuadPart / (double)frequency.QuadPart;
+#elif defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+#else
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec * 1e-6;
+#endif
+}
+
+static void
+output(const char *format, ...)
+{
+    va_list ap;
+
+    va_start(ap, format);
+    vprintf(format, ap);
+    va_end(ap);
+
+    if (s_output)
+    {
+        va_start(ap, format);
+        vfprintf(s_output, format, ap);
+        va_end(ap);
+    }
+}
+
+static void
+load_baselines(const char *filename)
+{
+    FILE *fh = fopen(filename, "r");
+    char line[512];
+
+    if (!fh)
+    {
+        fprintf(stderr, "can't open baseline %s\n", filename);
+        exit(2);
+    }
+
+    while (fgets(line, sizeof(line), fh) && s_num_baselines < MAX_BASELINES)
+    {
+        char suite[128];
+        struct baseline *b = &s_baselines[s_num_baselines];
+
+        if (line[0] == '#')
+            continue;
+        if (sscanf(line, "%127[^\t]\t%127[^\t]\t%lf", suite, b->name, &b->median_ns) != 3)
+            continue;
+        if (strcmp(suite, s_suite))
+            continue;
+        s_num_baselines++;
+    }
+
+    fclose(fh);
+}
+
+static const struct baseline *
+find_baseline(const char *name)
+{
+    int i;
+
+    for (i = 0; i < s_num_baselines; i++)
+        if (!strcmp(s_baselines[i].name, name))
+            return &s_baselines[i];
+
+    return NULL;
+}
+
+static int
+compare_doubles(const void *a, const void *b)
+{
+    double da = *(const double *)a;
+    double db = *(const double *)b;
+
+    return da < db ? -1 : (da > db ? 1 : 0);
+}
+
+void
+bench_init(int argc, char **argv, const char *suite)
+{
+    const char *baseline = NULL;
+    int i;
+
+    s_suite = suite;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (argv[i][0] != '-' || !argv[i][1] || argv[i][2] || i + 1 == argc)
+        {
+            fprintf(stderr, "usage: %s [-b baseline] [-o output] [-f filter] [-r repetitions] [-t seconds] [-x percent]\n", argv[0]);
+            exit(2);
+        }
+
+        switch (argv[i][1])
+        {
+            case 'b':
+                baseline = argv[++i];
+                break;
+
+            case 'o':
+                s_output = fopen(argv[++i], "a");
+                break;
+
+            case 'f':
+                s_filter = argv[++i];
+                break;
+
+            case 'r':
+                s_repetitions = atoi(argv[++i]);
+                if (s_repetitions < 1)
+                    s_repetitions = 1;
+                if (s_repetitions > MAX_REPETITIONS)
+                    s_repetitions = MAX_REPETITIONS;
+                break;
+
+            case 't':
+                s_min_time = atof(argv[++i]);
+                break;
+
+            case 'x':
+                s_threshold = atof(argv[++i]);
+                break;
+
+            default:
+                fprintf(stderr, "unknown option %s\n", argv[i]);
+                exit(2);
+        }
+    }
+
+    if (baseline)
+        load_baselines(baseline);
+
+    output("# suite\tname\tmedian_ns\tmin_ns\titerations%s\n", s_num_baselines ? "\tbaseline_ns\tratio" : "");
+}
+
+void
+bench_run(const char *name, double (*func)(void *data), void *data)
+{
+    double times[MAX_REPETITIONS];
+    unsigned long iterations = 1;
+    const struct baseline *b;
+    double elapsed;
+    double start;
+    unsigned long i;
+    int rep;
+
+    if (s_filter && !strstr(name, s_filter))
+        return;
+
+    /* double the iterations until one repetition takes long enough
+       to time reliably */
+    for (;;)
+    {
+        start = now();
+        for (i = 0; i < iterations; i++)
+            s_sink += (*func)(data);
+        elapsed = now() - start;
+
+        if (elapsed >= s_min_time || iterations >= 0x40000000)
+            break;
+        iterations *= 2;
+    }
+
+    times[0] = elapsed;
+    for (rep = 1; rep < s_repetitions; rep++)
+    {
+        start = now();
+        for (i = 0; i < iterations; i++)
+            s_sink += (*func)(data);
+        times[rep] = now() - start;
+    }
+
+    qsort(times, s_repetitions, sizeof(double), compare_doubles);
+    for (rep = 0; rep < s_repetitions; rep++)
+        times[rep] *= 1e9 / iterations;
+
+    output("%s\t%s\t%.2f\t%.2f\t%lu", s_suite, name, times[s_repetitions / 2], times[0], iterations);
+
+    b = find_baseline(name);
+    if (b && b->median_ns > 0.0)
+    {
+        double ratio = times[s_repetitions / 2] / b->median_ns;
+
+        output("\t%.2f\t%.3f%s", b->median_ns, ratio, ratio > 1.0 + s_threshold / 100.0 ? "\tREGRESSION" : "");
+        s_num_compared++;
+        if (ratio > 1.0 + s_threshold / 100.0)
+            s_num_regressions++;
+    }
+
+    output("\n");
+    fflush(stdout);
+}
+
+void
+bench_note(const char *format, ...)
+{
+    char buf[512];
+    va_list ap;
+
+    va_start(ap, format);
+    vsprintf(buf, format, ap);
+    va_end(ap);
+
+    output("# %s\n", buf);
+}
+
+int
+bench_finish()
+{
+    if (s_num_baselines)
+        output("# %s: %d compared with the baseline, %d regressed by more than %.0f%%\n",
+               s_suite, s_num_compared, s_num_regressions, s_threshold);
+
+    /* keep the timed work from being optimized away */
+    if (s_sink == 42.0)
+        printf("#\n");
+
+    if (s_output)
+        fclose(s_output);
+
+    return s_num_regressions ? 1 : 0;
+}
@@ -0,0 +1,45 @@
+/*
+** bench.h
+**
+** A small harness shared by the benchmarks. Each benchmark is timed
+** over several repetitions and written as one tab separated line:
+**
+**   suite  name  median_ns  min_ns  iterations  [baseline_ns  ratio]
+**
+** Lines starting with '#' are comments. The output of one run can
+** be given back with -b as the baseline for the next, which adds the
+** baseline time and the ratio of the new median to it.
+**
+** Every benchmark program takes the options:
+**
+**   -b file     compare against the results in file
+**   -o file     append the results to file as well as stdout
+**   -f text     only run benchmarks whose name contains text
+**   -r n        repetitions of each benchmark (default 5)
+**   -t seconds  minimum time for each repetition (default 0.05)
+**   -x percent  ratio above which a benchmark counts as a
+**               regression (default 10)
+*/
+#ifndef bench_h
+#define bench_h
+
+/** Parse the command line and print the header. */
+void bench_init(int argc, char **argv, const char *suite);
+
+/** Time func, which does one operation per call, and print the
+ * result. The values it returns are summed so the work can't be
+ * optimized away.
+ */
+void bench_run(const char *name, double (*func)(void *data), void *data);
+
+/** Print a comment line, for results that aren't timings. */
+void bench_note(const char *format, ...);
+
+/** Print the summary against the baseline.
+ *
+ * @return 1 if any benchmark regressed against the baseline,
+ * otherwise 0
+ */
+int bench_finish();
+
+#endif
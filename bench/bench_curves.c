@@ -0,0 +1,333 @@
+/*
+** bench_curves.c
+**
+** Times each bootstrap method on a realistic set of market rates,
+** and the ways pricing reads discount factors and forward rates
+** back off a yield curve.
+**
+** usage: bench_curves [options], see bench.h
+*/
+#include <rq.h>
+#include "rq_bootstrap_yield_curve_day_count.h"
+#include "rq_bootstrap_yield_curve_cubic_spline.h"
+#include "bench.h"
+#include <stdlib.h>
+#include <stdio.h>
+
+#define NUM_DEPOSITS 6
+#define NUM_SWAPS 14
+#define NUM_FORWARDS 12
+#define NUM_VOL_TENORS 8
+#define NUM_VOL_DELTAS 5
+#define NUM_LOOKUPS 4096
+
+static const short deposit_months[NUM_DEPOSITS] = { 1, 2, 3, 6, 9, 12 };
+static const double deposit_rates[NUM_DEPOSITS] = { 0.0410, 0.0415, 0.0421, 0.0433, 0.0441, 0.0448 };
+static const short swap_years[NUM_SWAPS] = { 2, 3, 4, 5, 6, 7, 8, 9, 10, 12, 15, 20, 25, 30 };
+static const double swap_rates[NUM_SWAPS] = { 0.0462, 0.0475, 0.0486, 0.0495, 0.0503, 0.0510, 0.0516, 0.0521, 0.0525, 0.0532, 0.0539, 0.0545, 0.0547, 0.0548 };
+static const short vol_months[NUM_VOL_TENORS] = { 1, 2, 3, 6, 9, 12, 24, 60 };
+static const double vol_deltas[NUM_VOL_DELTAS] = { 0.10, 0.25, 0.50, 0.75, 0.90 };
+
+struct curve_data {
+    rq_system_t system;
+    rq_market_t market;
+    rq_date market_date;
+    rq_bootstrap_config_t forward_config;
+    rq_bootstrap_config_t spread_config;
+    rq_bootstrap_config_t future_config;
+    rq_bootstrap_config_t vol_config;
+    rq_yield_curve_t yield_curve;
+    rq_date dates[NUM_LOOKUPS];
+    unsigned int next;
+};
+
+static rq_bootstrap_config_t
+add_config(struct curve_data *cd, const char *curve_id, enum rq_termstruct_type termstruct_type)
+{
+    rq_bootstrap_config_t config = rq_bootstrap_config_build(
+        curve_id, "AUD", termstruct_type,
+        RQ_INTERPOLATION_LOG_LINEAR_DISCOUNT_FACTOR,
+        RQ_EXTRAPOLATION_LAST_ZERO, RQ_EXTRAPOLATION_LAST_ZERO,
+        RQ_ZERO_CONTINUOUS_COMPOUNDING, 1, RQ_DAY_COUNT_ACTUAL_365
+        );
+
+    rq_bootstrap_config_mgr_add(rq_system_get_bootstrap_config_mgr(cd->system), config);
+    return config;
+}
+
+static void
+add_rate(struct curve_data *cd, rq_bootstrap_config_t config, const char *rate_class_id, const char *asset_id, enum rq_rate_type rate_type, rq_date value_date, double value)
+{
+    rq_rate_mgr_add(
+        rq_market_get_rate_mgr(cd->market),
+        rq_rate_build(rate_class_id, asset_id, rate_type, cd->market_date, value_date, value)
+        );
+    rq_bootstrap_config_add_rate_class_id(config, rate_class_id);
+}
+
+/* An AUD deposit and swap curve, with an AUD/USD forward curve,
+   futures curve, credit spread curve and FX vol surface alongside. */
+static void
+build_market(struct curve_data *cd)
+{
+    rq_asset_mgr_t asset_mgr;
+    rq_bootstrap_config_t yc_config;
+    struct rq_term zero_term;
+    struct rq_term term;
+    struct rq_term frequency;
+    char asset_id[64];
+    char rate_class_id[96];
+    int i;
+    int j;
+
+    cd->market_date = rq_date_from_dmy(15, 6, 2010);
+    cd->system = rq_system_alloc();
+    cd->market = rq_market_alloc(cd->market_date);
+    asset_mgr = rq_system_get_asset_mgr(cd->system);
+
+    rq_term_init(&zero_term);
+    rq_term_init(&frequency);
+    frequency.months = 6;
+
+    rq_asset_mgr_add(asset_mgr, rq_asset_ccy_build("AUD", "AUD", 365, 2));
+    rq_asset_mgr_add(asset_mgr, rq_asset_ccy_build("USD", "USD", 360, 2));
+
+    yc_config = add_config(cd, "AUD.YC", RQ_TERMSTRUCT_TYPE_YIELD_CURVE);
+
+    for (i = 0; i < NUM_DEPOSITS; i++)
+    {
+        rq_term_init(&term);
+        term.months = deposit_months[i];
+        sprintf(asset_id, "AUD.DEP.%dM", deposit_months[i]);
+        rq_asset_mgr_add(
+            asset_mgr,
+            rq_asset_irdiscount_build(
+                asset_id, "AUD", &zero_term, RQ_DAY_TYPE_BUSINESS, &term, 0,
+                RQ_DAY_COUNT_ACTUAL_365, RQ_DATE_ROLL_MOD_FOLLOWING, RQ_ZERO_SIMPLE, 0
+                )
+            );
+        add_rate(cd, yc_config, asset_id, asset_id, RQ_RATE_TYPE_SIMPLE,
+                 rq_date_add_term(cd->market_date, &term), deposit_rates[i]);
+    }
+
+    for (i = 0; i < NUM_SWAPS; i++)
+    {
+        rq_term_init(&term);
+        term.years = swap_years[i];
+        sprintf(asset_id, "AUD.SWAP.%dY", swap_years[i]);
+        rq_asset_mgr_add(
+            asset_mgr,
+            rq_asset_irswap_build(
+                asset_id, "AUD", NULL, &zero_term, RQ_DAY_TYPE_BUSINESS, &term, &frequency,
+                RQ_DAY_COUNT_ACTUAL_365, RQ_DATE_ROLL_MOD_FOLLOWING
+                )
+            );
+        add_rate(cd, yc_config, asset_id, asset_id, RQ_RATE_TYPE_PAR,
+                 rq_date_add_term(cd->market_date, &term), swap_rates[i]);
+    }
+
+    /* the methods that just lay rates out by value date */
+    cd->forward_config = add_config(cd, "AUDUSD.FWD", RQ_TERMSTRUCT_TYPE_FORWARD_CURVE);
+    cd->spread_config = add_config(cd, "AUD.SPREAD", RQ_TERMSTRUCT_TYPE_SPREAD_CURVE);
+    cd->future_config = add_config(cd, "AUD.FUT", RQ_TERMSTRUCT_TYPE_FUTURE_CURVE);
+    for (i = 0; i < NUM_FORWARDS; i++)
+    {
+        rq_date value_date = rq_date_add_months(cd->market_date, (short)(i + 1), 0);
+
+        sprintf(rate_class_id, "AUDUSD.FWD.%dM", i + 1);
+        add_rate(cd, cd->forward_config, rate_class_id, "AUDUSD", RQ_RATE_TYPE_EXCHANGE, value_date, 0.85 - 0.001 * i);
+        sprintf(rate_class_id, "AUD.SPREAD.%dM", i + 1);
+        add_rate(cd, cd->spread_config, rate_class_id, "AUD.CREDIT", RQ_RATE_TYPE_SIMPLE, value_date, 0.01 + 0.0002 * i);
+        sprintf(rate_class_id, "AUD.FUT.%dM", i + 1);
+        add_rate(cd, cd->future_config, rate_class_id, "AUD.FUT", RQ_RATE_TYPE_PRICE, value_date, 95.5 - 0.02 * i);
+    }
+
+    cd->vol_config = add_config(cd, "AUDUSD.VOL", RQ_TERMSTRUCT_TYPE_VOL_SURFACE);
+    for (j = 0; j < NUM_VOL_DELTAS; j++)
+    {
+        sprintf(asset_id, "AUDUSD.VOL.%02.0fD", vol_deltas[j] * 100.0);
+        rq_asset_mgr_add(asset_mgr, rq_asset_fxvol_build(asset_id, "AUD", "USD", vol_deltas[j], 0));
+
+        for (i = 0; i < NUM_VOL_TENORS; i++)
+        {
+            sprintf(rate_class_id, "%s.%dM", asset_id, vol_months[i]);
+            add_rate(cd, cd->vol_config, rate_class_id, asset_id, RQ_RATE_TYPE_VOLATILITY,
+                     rq_date_add_months(cd->market_date, vol_months[i], 0),
+                     0.12 + 0.02 * (vol_deltas[j] - 0.5) * (vol_deltas[j] - 0.5) + 0.001 * i);
+        }
+    }
+}
+
+/* -- bootstrapping ----------------------------------------------- */
+
+static double
+bootstrap_yield_curve_simple(void *data)
+{
+    struct curve_data *cd = (struct curve_data *)data;
+    rq_yield_curve_t yc = rq_bootstrap_yield_curve_simple("AUD.YC", cd->system, cd->market, NULL, 0);
+    double size = rq_yield_curve_size(yc);
+
+    rq_yield_curve_free(yc);
+    return size;
+}
+
+static double
+bootstrap_yield_curve_day_count(void *data)
+{
+    struct curve_data *cd = (struct curve_data *)data;
+    rq_yield_curve_t yc = rq_bootstrap_yield_curve_day_count("AUD.YC", cd->system, cd->market, NULL, 0, 0, NULL);
+    double size = rq_yield_curve_size(yc);
+
+    rq_yield_curve_free(yc);
+    return size;
+}
+
+static double
+bootstrap_yield_curve_cubic_spline(void *data)
+{
+    struct curve_data *cd = (struct curve_data *)data;
+    rq_yield_curve_t yc = rq_bootstrap_yield_curve_cubic_spline("AUD.YC", cd->system, cd->market, NULL, 0);
+    double size = rq_yield_curve_size(yc);
+
+    rq_yield_curve_free(yc);
+    return size;
+}
+
+static double
+bootstrap_forward_curve_simple(void *data)
+{
+    struct curve_data *cd = (struct curve_data *)data;
+    rq_forward_curve_t fc = rq_bootstrap_forward_curve_simple(
+        cd->market_date, rq_market_get_rate_mgr(cd->market), cd->forward_config,
+        rq_system_get_asset_mgr(cd->system), NULL, 0
+        );
+    double size = rq_forward_curve_size(fc);
+
+    rq_forward_curve_free(fc);
+    return size;
+}
+
+static double
+bootstrap_spread_curve_simple(void *data)
+{
+    struct curve_data *cd = (struct curve_data *)data;
+    rq_spread_curve_t sc = rq_bootstrap_spread_curve_simple(
+        cd->market_date, rq_market_get_rate_mgr(cd->market), cd->spread_config,
+        rq_system_get_asset_mgr(cd->system), NULL, 0
+        );
+    double size = rq_spread_curve_size(sc);
+
+    rq_spread_curve_free(sc);
+    return size;
+}
+
+static double
+bootstrap_future_curve_simple(void *data)
+{
+    struct curve_data *cd = (struct curve_data *)data;
+    rq_future_curve_t fc = rq_bootstrap_future_curve_simple(
+        cd->market_date, rq_market_get_rate_mgr(cd->market), cd->future_config,
+        rq_system_get_asset_mgr(cd->system), NULL, 0
+        );
+    double size = rq_future_curve_size(fc);
+
+    rq_future_curve_free(fc);
+    return size;
+}
+
+static double
+bootstrap_vol_surface_simple(void *data)
+{
+    struct curve_data *cd = (struct curve_data *)data;
+    rq_vol_surface_t vs = rq_bootstrap_vol_surface_simple(
+        cd->market_date, rq_market_get_rate_mgr(cd->market), cd->vol_config,
+        rq_system_get_asset_mgr(cd->system), NULL, 0
+        );
+
+    rq_vol_surface_free(vs);
+    return 1.0;
+}
+
+/* -- reading the yield curve ------------------------------------- */
+
+static double
+discount_factor(void *data)
+{
+    struct curve_data *cd = (struct curve_data *)data;
+    rq_date date = cd->dates[cd->next++ % NUM_LOOKUPS];
+
+    return rq_yield_curve_get_discount_factor(cd->yield_curve, date);
+}
+
+static double
+forward_simple_rate(void *data)
+{
+    struct curve_data *cd = (struct curve_data *)data;
+    unsigned int i = cd->next++ % (NUM_LOOKUPS - 1);
+
+    return rq_yield_curve_get_forward_simple_rate(cd->yield_curve, cd->dates[i], cd->dates[i + 1], RQ_DAY_COUNT_ACTUAL_365);
+}
+
+static void
+run_access_patterns(struct curve_data *cd, const char *prefix)
+{
+    char name[128];
+    unsigned int i;
+
+    /* every day for the first 11 years, as a daily revaluation would */
+    for (i = 0; i < NUM_LOOKUPS; i++)
+        cd->dates[i] = cd->market_date + i;
+    cd->next = 0;
+    sprintf(name, "%s/discount_factor/sequential", prefix);
+    bench_run(name, discount_factor, cd);
+
+    /* anywhere on the curve */
+    srand(42);
+    for (i = 0; i < NUM_LOOKUPS; i++)
+        cd->dates[i] = cd->market_date + rand() % (30 * 365);
+    cd->next = 0;
+    sprintf(name, "%s/discount_factor/random", prefix);
+    bench_run(name, discount_factor, cd);
+
+    /* the quarterly payment dates of a book of swaps, over and over */
+    for (i = 0; i < NUM_LOOKUPS; i++)
+        cd->dates[i] = rq_date_add_months(cd->market_date, (short)(3 * (i % 40 + 1)), 0);
+    cd->next = 0;
+    sprintf(name, "%s/discount_factor/repeated", prefix);
+    bench_run(name, discount_factor, cd);
+
+    cd->next = 0;
+    sprintf(name, "%s/forward_simple_rate/repeated", prefix);
+    bench_run(name, forward_simple_rate, cd);
+}
+
+int
+main(int argc, char **argv)
+{
+    struct curve_data cd;
+
+    bench_init(argc, argv, "curves");
+    build_market(&cd);
+
+    bench_run("bootstrap/yield_curve_simple", bootstrap_yield_curve_simple, &cd);
+    bench_run("bootstrap/yield_curve_day_count", bootstrap_yield_curve_day_count, &cd);
+    bench_run("bootstrap/yield_curve_cubic_spline", bootstrap_yield_curve_cubic_spline, &cd);
+    bench_run("bootstrap/forward_curve_simple", bootstrap_forward_curve_simple, &cd);
+    bench_run("bootstrap/spread_curve_simple", bootstrap_spread_curve_simple, &cd);
+    bench_run("bootstrap/future_curve_simple", bootstrap_future_curve_simple, &cd);
+    bench_run("bootstrap/vol_surface_simple", bootstrap_vol_surface_simple, &cd);
+
+    cd.yield_curve = rq_bootstrap_yield_curve_simple("AUD.YC", cd.system, cd.market, NULL, 0);
+    bench_note("AUD.YC has %u points", rq_yield_curve_size(cd.yield_curve));
+    run_access_patterns(&cd, "yield_curve");
+
+    /* as the bootstrap adapters leave it, with forward rates memoised */
+    rq_yield_curve_cache_enable(cd.yield_curve);
+    run_access_patterns(&cd, "yield_curve_cached");
+
+    rq_yield_curve_free(cd.yield_curve);
+    rq_market_free(cd.market);
+    rq_system_free(cd.system);
+
+    return bench_finish();
+}
@@ -0,0 +1,183 @@
+/*
+** bench_dates.c
+**
+** Times the date arithmetic, calendar lookups, date rolling and
+** schedule generation that every trade valuation leans on.
+**
+** usage: bench_dates [options], see bench.h
+*/
+#include <rq.h>
+#include "bench.h"
+#include <stdlib.h>
+
+#define NUM_DATES 4096
+#define MAX_SCHEDULE_DATES 256
+
+struct date_data {
+    rq_date dates[NUM_DATES];
+    unsigned int next;
+    rq_calendar_t cals[2];
+    unsigned short num_cals;
+    struct rq_term term;
+};
+
+/* A calendar with weekends and the fixed date public holidays, over
+   the years trades are booked for. */
+static rq_calendar_t
+build_calendar(const char *id, short extra_month, short extra_day)
+{
+    rq_calendar_t cal = rq_calendar_alloc(id);
+    short year;
+
+    for (year = 2000; year <= 2060; year++)
+    {
+        rq_calendar_add_event(cal, rq_date_from_dmy(1, 1, year), RQ_DATE_EVENT_GEN_HOLIDAY);
+        rq_calendar_add_event(cal, rq_date_from_dmy(25, 12, year), RQ_DATE_EVENT_GEN_HOLIDAY);
+        rq_calendar_add_event(cal, rq_date_from_dmy(26, 12, year), RQ_DATE_EVENT_GEN_HOLIDAY);
+        rq_calendar_add_event(cal, rq_date_from_dmy(extra_day, extra_month, year), RQ_DATE_EVENT_GEN_HOLIDAY);
+    }
+
+    return cal;
+}
+
+static double
+date_from_dmy(void *data)
+{
+    struct date_data *dd = (struct date_data *)data;
+    rq_date date = dd->dates[dd->next++ % NUM_DATES];
+
+    return rq_date_from_dmy((short)(date % 28 + 1), (short)(date % 12 + 1), (short)(2000 + date % 50));
+}
+
+static double
+date_to_dmy(void *data)
+{
+    struct date_data *dd = (struct date_data *)data;
+    short day, month, year;
+
+    rq_date_to_dmy(dd->dates[dd->next++ % NUM_DATES], &day, &month, &year);
+    return day + month + year;
+}
+
+static double
+date_add_term(void *data)
+{
+    struct date_data *dd = (struct date_data *)data;
+    return rq_date_add_term(dd->dates[dd->next++ % NUM_DATES], &dd->term);
+}
+
+static double
+year_fraction_actual_actual(void *data)
+{
+    struct date_data *dd = (struct date_data *)data;
+    rq_date date = dd->dates[dd->next++ % NUM_DATES];
+
+    return rq_day_count_get_year_fraction(RQ_DAY_COUNT_ACTUAL_ACTUAL, date, date + 91);
+}
+
+static double
+calendar_is_good_date(void *data)
+{
+    struct date_data *dd = (struct date_data *)data;
+    return rq_calendar_is_good_date(dd->cals[0], dd->dates[dd->next++ % NUM_DATES]);
+}
+
+static double
+calendar_businessday_count(void *data)
+{
+    struct date_data *dd = (struct date_data *)data;
+    rq_date date = dd->dates[dd->next++ % NUM_DATES];
+
+    return rq_calendar_businessday_count(dd->cals[0], date, date + 365);
+}
+
+static double
+date_roll_adjust_date(void *data)
+{
+    struct date_data *dd = (struct date_data *)data;
+    return rq_date_roll_adjust_date(dd->dates[dd->next++ % NUM_DATES], RQ_DATE_ROLL_MOD_FOLLOWING, dd->cals, dd->num_cals);
+}
+
+static double
+date_roll_get_date(void *data)
+{
+    struct date_data *dd = (struct date_data *)data;
+    return rq_date_roll_get_date(dd->dates[dd->next++ % NUM_DATES], &dd->term, RQ_ROLL_CONVENTION_NONE, RQ_DATE_ROLL_MOD_FOLLOWING, dd->cals, dd->num_cals);
+}
+
+static double
+date_roll_generate_dates(void *data)
+{
+    struct date_data *dd = (struct date_data *)data;
+    rq_date schedule[MAX_SCHEDULE_DATES];
+    rq_date start = dd->dates[dd->next++ % NUM_DATES];
+    int stub_index;
+
+    /* a ten year quarterly swap leg */
+    return rq_date_roll_generate_dates(
+        schedule, MAX_SCHEDULE_DATES, start, start + 3652, &dd->term,
+        RQ_ROLL_CONVENTION_NONE, RQ_DATE_ROLL_MOD_FOLLOWING, dd->cals, dd->num_cals,
+        RQ_DATE_ROLL_STUB_POSITION_START, 0, &stub_index
+        );
+}
+
+static void
+run_calendar_benchmarks(struct date_data *dd, const char *prefix)
+{
+    char name[128];
+
+    sprintf(name, "%s/is_good_date", prefix);
+    bench_run(name, calendar_is_good_date, dd);
+    sprintf(name, "%s/businessday_count/1y", prefix);
+    bench_run(name, calendar_businessday_count, dd);
+
+    dd->num_cals = 1;
+    sprintf(name, "%s/date_roll/adjust_date", prefix);
+    bench_run(name, date_roll_adjust_date, dd);
+    sprintf(name, "%s/date_roll/get_date/3m", prefix);
+    bench_run(name, date_roll_get_date, dd);
+    sprintf(name, "%s/date_roll/generate_dates/10y_quarterly", prefix);
+    bench_run(name, date_roll_generate_dates, dd);
+
+    dd->num_cals = 2;
+    sprintf(name, "%s/date_roll/adjust_date/2_calendars", prefix);
+    bench_run(name, date_roll_adjust_date, dd);
+    sprintf(name, "%s/date_roll/generate_dates/10y_quarterly/2_calendars", prefix);
+    bench_run(name, date_roll_generate_dates, dd);
+}
+
+int
+main(int argc, char **argv)
+{
+    struct date_data dd;
+    rq_date start = rq_date_from_dmy(1, 1, 2010);
+    unsigned int i;
+
+    bench_init(argc, argv, "dates");
+
+    srand(42);
+    for (i = 0; i < NUM_DATES; i++)
+        dd.dates[i] = start + rand() % (20 * 365);
+    dd.next = 0;
+    rq_term_init(&dd.term);
+    dd.term.months = 3;
+    dd.cals[0] = build_calendar("SYD", 1, 26);
+    dd.cals[1] = build_calendar("NYC", 7, 4);
+    dd.num_cals = 1;
+
+    bench_run("date/from_dmy", date_from_dmy, &dd);
+    bench_run("date/to_dmy", date_to_dmy, &dd);
+    bench_run("date/add_term/3m", date_add_term, &dd);
+    bench_run("day_count/actual_actual", year_fraction_actual_actual, &dd);
+
+    run_calendar_benchmarks(&dd, "calendar");
+
+    rq_calendar_compile(dd.cals[0], rq_date_from_dmy(1, 1, 2000), rq_date_from_dmy(31, 12, 2060));
+    rq_calendar_compile(dd.cals[1], rq_date_from_dmy(1, 1, 2000), rq_date_from_dmy(31, 12, 2060));
+    run_calendar_benchmarks(&dd, "calendar_compiled");
+
+    rq_calendar_free(dd.cals[0]);
+    rq_calendar_free(dd.cals[1]);
+
+    return bench_finish();
+}
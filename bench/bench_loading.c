@@ -0,0 +1,550 @@
+/*
+** bench_loading.c
+**
+** Times parsing and writing XML documents, loading rate files,
+** writing results and loading and saving a system through the file
+** system data store. The working files are written under the
+** current directory and removed at the end.
+**
+** usage: bench_loading [options], see bench.h
+*/
+#include <rq.h>
+#include <rq_data_store_fs.h>
+#include "bench.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define NUM_RATES 2000
+#define NUM_CALENDARS 20
+
+#define NUM_RATE_LINES 100000
+
+#define NUM_TRADES 20000
+
+#define XML_FILE "bench_loading.xml"
+#define RATE_LINES_FILE "bench_loading_rates.txt"
+#define TRADE_FILE "bench_loading_trades.xml"
+#define CALENDAR_FILE "bench_loading_calendar.xml"
+#define STORE_DIR "bench_loading.store"
+
+static const char *store_subdirs[] = {
+    "calendars",
+    "assets",
+    "bootstrapconfigs",
+    "markets",
+    NULL
+};
+
+/* A calendar with weekends and the fixed date public holidays, as
+   in bench_dates. */
+static rq_calendar_t
+build_calendar(const char *id, short extra_month, short extra_day)
+{
+    rq_calendar_t cal = rq_calendar_alloc(id);
+    short year;
+
+    for (year = 2000; year <= 2060; year++)
+    {
+        rq_calendar_add_event(cal, rq_date_from_dmy(1, 1, year), RQ_DATE_EVENT_GEN_HOLIDAY);
+        rq_calendar_add_event(cal, rq_date_from_dmy(25, 12, year), RQ_DATE_EVENT_GEN_HOLIDAY);
+        rq_calendar_add_event(cal, rq_date_from_dmy(26, 12, year), RQ_DATE_EVENT_GEN_HOLIDAY);
+        rq_calendar_add_event(cal, rq_date_from_dmy(extra_day, extra_month, year), RQ_DATE_EVENT_GEN_HOLIDAY);
+    }
+
+    return cal;
+}
+
+/* A rate set document of the size a day's market snapshot runs to. */
+static int
+write_rates_file(const char *filename)
+{
+    FILE *fh = fopen(filename, "w");
+    unsigned int i;
+
+    if (!fh)
+        return -1;
+
+    fprintf(fh, "<?xml version=\"1.0\"?>\n<rates date=\"2009-01-01\">\n");
+    for (i = 0; i < NUM_RATES; i++)
+        fprintf(fh, "  <rate id=\"AUD.RATE.%u\" type=\"irswap\" observed=\"2009-01-01\">\n"
+                "    <value>%.8f</value>\n"
+                "    <term>%uM</term>\n"
+                "  </rate>\n",
+                i, 0.03 + i * 1e-6, i % 360 + 1);
+    fprintf(fh, "</rates>\n");
+
+    fclose(fh);
+
+    return 0;
+}
+
+static double
+xml_dom_parse(void *data)
+{
+    rq_stream_t stream = rq_stream_file_open((const char *)data, "r");
+    struct rq_xml_node *root = rq_dom_parser_parse_stream(stream);
+    double ret = (root != NULL);
+
+    rq_xml_node_free(root);
+    rq_stream_free(stream);
+
+    return ret;
+}
+
+static double
+xml_dom_parse_mmap(void *data)
+{
+    rq_stream_t stream = rq_stream_mmap_open((const char *)data);
+    struct rq_xml_node *root = rq_dom_parser_parse_stream(stream);
+    double ret = (root != NULL);
+
+    rq_xml_node_free(root);
+    rq_stream_free(stream);
+
+    return ret;
+}
+
+/* A pipe-delimited rate file, 100 days of 1000 rates. */
+static int
+write_rate_lines_file(const char *filename)
+{
+    FILE *fh = fopen(filename, "w");
+    rq_date from_date = rq_date_from_dmy(1, 1, 2009);
+    unsigned int i;
+
+    if (!fh)
+        return -1;
+
+    for (i = 0; i < NUM_RATE_LINES; i++)
+    {
+        char obs[16];
+
+        rq_date_to_string(obs, "yyyy-mm-dd", from_date + i / 1000);
+        fprintf(fh, "IntRate|AUD.RATE.%u|SIMPLE|%s|2010-01-01|%.8f\n",
+                i % 1000, obs, 0.03 + i * 1e-8);
+    }
+
+    fclose(fh);
+
+    return 0;
+}
+
+/* A trade file in the form the Trade object schema reads. */
+static int
+write_trade_file(const char *filename)
+{
+    FILE *fh = fopen(filename, "w");
+    unsigned int i;
+
+    if (!fh)
+        return -1;
+
+    fprintf(fh, "<?xml version=\"1.0\"?>\n<trades>\n");
+    for (i = 1; i <= NUM_TRADES; i++)
+        fprintf(fh, "  <trade id=\"%u\" key=\"T%u\">\n"
+                "    <type>SWAP</type>\n"
+                "    <buySell>%s</buySell>\n"
+                "    <counterparty>CPTY%u</counterparty>\n"
+                "    <book>RATES</book>\n"
+                "    <data>notional=%u;rate=0.0425</data>\n"
+                "  </trade>\n",
+                i, i, (i % 2 ? "B" : "S"), i % 50, i * 1000);
+    fprintf(fh, "</trades>\n");
+
+    fclose(fh);
+
+    return 0;
+}
+
+static double
+trade_import(void *data)
+{
+    rq_stream_t stream = rq_stream_file_open((const char *)data, "r");
+    rq_trade_mgr_t trade_mgr = rq_trade_mgr_alloc();
+    unsigned long num_trades;
+
+    rq_trade_import_to_mgr(stream, "trades/trade", trade_mgr, &num_trades);
+
+    rq_trade_mgr_free(trade_mgr);
+    rq_stream_free(stream);
+
+    return (double)num_trades;
+}
+
+/* Reading a line at a time and splitting it, as the loading scripts
+   do. */
+static double
+rate_lines_read_line(void *data)
+{
+    rq_stream_t stream = rq_stream_file_open((const char *)data, "r");
+    rq_rate_mgr_t rate_mgr = rq_rate_mgr_alloc();
+    char line[256];
+    double ret = 0;
+
+    while (rq_stream_read_line(stream, line, sizeof(line)) > 0)
+    {
+        char tok[64];
+        char flds[6][64];
+        const char *p = line;
+        int i;
+
+        for (i = 0; i < 6 && rq_tokenizer_get_token(&p, tok, sizeof(tok), "|", "\r\n", ""); i++)
+            strcpy(flds[i], tok);
+        if (i < 6)
+            continue;
+
+        rq_rate_mgr_add(rate_mgr,
+                        rq_rate_build(flds[1], flds[1], rq_rate_type_from_string(flds[2]),
+                                      rq_date_parse(flds[3], RQ_DATE_FORMAT_YMD),
+                                      rq_date_parse(flds[4], RQ_DATE_FORMAT_YMD),
+                                      atof(flds[5])));
+        ret++;
+    }
+
+    rq_rate_mgr_free(rate_mgr);
+    rq_stream_free(stream);
+
+    return ret;
+}
+
+static double
+rate_lines_load(void *data)
+{
+    rq_stream_t stream = rq_stream_file_open((const char *)data, "r");
+    rq_rate_mgr_t rate_mgr = rq_rate_mgr_alloc();
+    unsigned long num_rates;
+
+    rq_rate_loader_load(stream, rate_mgr, &num_rates);
+
+    rq_rate_mgr_free(rate_mgr);
+    rq_stream_free(stream);
+
+    return (double)num_rates;
+}
+
+static double
+rate_lines_load_mmap_markets(void *data)
+{
+    rq_stream_t stream = rq_stream_mmap_open((const char *)data);
+    rq_market_mgr_t market_mgr = rq_market_mgr_alloc();
+    unsigned long num_rates;
+
+    rq_rate_loader_load_markets(stream, market_mgr, &num_rates);
+
+    rq_market_mgr_free(market_mgr);
+    rq_stream_free(stream);
+
+    return (double)num_rates;
+}
+
+static double
+calendar_write(void *data)
+{
+    rq_stream_t stream = rq_stream_file_open(CALENDAR_FILE, "w+");
+    double ret = rq_calendar_write_to_stream((rq_calendar_t)data, stream);
+
+    rq_stream_free(stream);
+
+    return ret;
+}
+
+static double
+calendar_write_buffered(void *data)
+{
+    rq_stream_t stream = rq_stream_buffered_alloc(rq_stream_file_open(CALENDAR_FILE, "w+"), 0);
+    double ret = rq_calendar_write_to_stream((rq_calendar_t)data, stream);
+
+    rq_stream_free(stream);
+
+    return ret;
+}
+
+/* A results file of numbers, as the pricing jobs write. */
+static double
+results_write(rq_stream_t stream)
+{
+    unsigned int i;
+
+    for (i = 0; i < 10000; i++)
+    {
+        rq_stream_write_integer_as_string(stream, (int)i);
+        rq_stream_write_string(stream, ",");
+        rq_stream_write_double_as_string(stream, 100.0 + i * 0.0125, 6);
+        rq_stream_write_string(stream, "\n");
+    }
+    rq_stream_free(stream);
+
+    return i;
+}
+
+static double
+results_write_file(void *data)
+{
+    return results_write(rq_stream_file_open(CALENDAR_FILE, "w"));
+}
+
+static double
+results_write_buffered(void *data)
+{
+    return results_write(rq_stream_buffered_alloc(rq_stream_file_open(CALENDAR_FILE, "w"), 0));
+}
+
+/* The same results as rows of the columnar results format. */
+static double
+results_write_columns(void *data)
+{
+    rq_stream_t stream = rq_stream_file_open(CALENDAR_FILE, "wb");
+    rq_results_columns_t cols = rq_results_columns_alloc(stream, 0);
+    unsigned int i;
+
+    for (i = 0; i < 10000; i++)
+        rq_results_columns_append(cols, i, 0, RQ_RESULTS_MEASURE_VALUE, 0, 100.0 + i * 0.0125);
+    rq_results_columns_free(cols);
+    rq_stream_free(stream);
+
+    return i;
+}
+
+static void
+add_results_batch(void *data, const struct rq_results_batch *batch)
+{
+    double *total = (double *)data;
+    unsigned int i;
+
+    for (i = 0; i < batch->num_rows; i++)
+        *total += batch->values[i];
+}
+
+static double
+results_read_columns_mmap(void *data)
+{
+    rq_stream_t stream = rq_stream_mmap_open(CALENDAR_FILE);
+    double total = 0.0;
+
+    rq_results_columns_read(stream, add_results_batch, &total);
+    rq_stream_free(stream);
+
+    return total;
+}
+
+/* Calendars in the form the Calendar object schema reads. */
+static rq_stream_t
+calendars_document(void)
+{
+    rq_stream_t stream = rq_stream_string_alloc();
+    char date[16];
+    unsigned int i;
+    short year;
+
+    rq_stream_open(stream);
+    rq_stream_write_string(stream, "<?xml version=\"1.0\"?>\n<calendars>\n");
+    for (i = 0; i < NUM_CALENDARS; i++)
+    {
+        rq_stream_printf(stream, "  <calendar id=\"CAL%02u\">\n", i);
+        for (year = 2000; year <= 2060; year++)
+        {
+            rq_date_to_string(date, "yyyy-mm-dd", rq_date_from_dmy(25, 12, year));
+            rq_stream_printf(stream, "    <dateEvent type=\"HOLIDAY\">%s</dateEvent>\n", date);
+        }
+        rq_stream_write_string(stream, "  </calendar>\n");
+    }
+    rq_stream_write_string(stream, "</calendars>\n");
+
+    return stream;
+}
+
+static void
+free_built_calendar(void *data, void *object)
+{
+    rq_calendar_free((rq_calendar_t)object);
+}
+
+static double
+object_builder_build_all(void *data)
+{
+    rq_stream_t stream = calendars_document();
+    rq_object_schema_mgr_t schema_mgr = rq_object_schema_mgr_alloc();
+    rq_object_builder_t builder = rq_object_builder_xml_alloc();
+    unsigned long num_built = 0;
+
+    rq_object_schema_mgr_init_object_schemas(schema_mgr);
+    rq_stream_rewind(stream);
+    rq_object_builder_build_all(builder, stream, schema_mgr, "calendars/calendar", "Calendar", free_built_calendar, NULL, &num_built);
+
+    rq_object_builder_free(builder);
+    rq_object_schema_mgr_free(schema_mgr);
+    rq_stream_free(stream);
+
+    return (double)num_built;
+}
+
+static double
+calendar_read(void *data)
+{
+    rq_stream_t stream = rq_stream_file_open((const char *)data, "r");
+    rq_calendar_t cal = rq_calendar_alloc(NULL);
+    double ret = rq_calendar_read_from_stream(cal, stream);
+
+    rq_calendar_free(cal);
+    rq_stream_close(stream);
+
+    return ret;
+}
+
+static double
+data_store_system_save(void *data)
+{
+    rq_system_t system = (rq_system_t)data;
+    rq_data_store_t store = rq_data_store_fs_alloc();
+    double ret;
+
+    rq_data_store_open(store, STORE_DIR);
+    ret = rq_data_store_system_save(store, system);
+    rq_data_store_close(store);
+    rq_data_store_free(store);
+
+    return ret;
+}
+
+static double
+system_load(enum rq_data_store_fs_load_mode load_mode)
+{
+    rq_system_t system = rq_system_alloc();
+    rq_data_store_t store = rq_data_store_fs_alloc();
+    double ret;
+
+    rq_data_store_fs_set_load_mode(store, load_mode, 0);
+    rq_data_store_open(store, STORE_DIR);
+    ret = rq_data_store_system_load(store, system);
+    rq_data_store_close(store);
+    rq_data_store_free(store);
+
+    /* a job that only needs one of the calendars */
+    ret += (rq_calendar_mgr_get(rq_system_get_calendar_mgr(system), "CAL05") != NULL);
+    rq_system_free(system);
+
+    return ret;
+}
+
+static double
+data_store_system_load(void *data)
+{
+    return system_load(RQ_DATA_STORE_FS_LOAD_EAGER);
+}
+
+static double
+data_store_system_load_lazy(void *data)
+{
+    return system_load(RQ_DATA_STORE_FS_LOAD_LAZY);
+}
+
+static double
+data_store_system_load_parallel(void *data)
+{
+    return system_load(RQ_DATA_STORE_FS_LOAD_PARALLEL);
+}
+
+/* Saving an empty system empties the store's directories, which
+   leaves just the directories themselves to remove. */
+static void
+remove_store(void)
+{
+    rq_system_t system = rq_system_alloc();
+    char path[256];
+    int i;
+
+    data_store_system_save(system);
+    rq_system_free(system);
+
+    for (i = 0; store_subdirs[i]; i++)
+    {
+        sprintf(path, "%s/%s", STORE_DIR, store_subdirs[i]);
+        rmdir(path);
+    }
+    sprintf(path, "%s/rq.xml", STORE_DIR);
+    remove(path);
+    rmdir(STORE_DIR);
+}
+
+int
+main(int argc, char **argv)
+{
+    rq_system_t system;
+    rq_data_store_t store;
+    rq_stream_t stream;
+    rq_calendar_t cal;
+    char id[16];
+    unsigned int i;
+
+    bench_init(argc, argv, "loading");
+
+    if (write_rates_file(XML_FILE) != 0)
+    {
+        bench_note("can't write %s", XML_FILE);
+        return bench_finish();
+    }
+    bench_run("xml/dom_parse/2000_rates", xml_dom_parse, (void *)XML_FILE);
+    bench_run("xml/dom_parse_mmap/2000_rates", xml_dom_parse_mmap, (void *)XML_FILE);
+    remove(XML_FILE);
+
+    if (write_rate_lines_file(RATE_LINES_FILE) == 0)
+    {
+        bench_run("rates/read_line/100000_rates", rate_lines_read_line, (void *)RATE_LINES_FILE);
+        bench_run("rates/loader/100000_rates", rate_lines_load, (void *)RATE_LINES_FILE);
+        bench_run("rates/loader_mmap_markets/100000_rates", rate_lines_load_mmap_markets, (void *)RATE_LINES_FILE);
+        remove(RATE_LINES_FILE);
+    }
+    else
+        bench_note("can't write %s", RATE_LINES_FILE);
+
+    if (write_trade_file(TRADE_FILE) == 0)
+    {
+        bench_run("trades/dom_parse/20000_trades", xml_dom_parse, (void *)TRADE_FILE);
+        bench_run("trades/import/20000_trades", trade_import, (void *)TRADE_FILE);
+        remove(TRADE_FILE);
+    }
+    else
+        bench_note("can't write %s", TRADE_FILE);
+
+    cal = build_calendar("SYD", 1, 26);
+    bench_run("xml/calendar_write", calendar_write, cal);
+    bench_run("xml/calendar_write_buffered", calendar_write_buffered, cal);
+    rq_calendar_free(cal);
+    bench_run("xml/calendar_read", calendar_read, (void *)CALENDAR_FILE);
+    bench_run("xml/object_builder_build_all/20_calendars", object_builder_build_all, NULL);
+    bench_run("stream/results_write/10000_lines", results_write_file, NULL);
+    bench_run("stream/results_write_buffered/10000_lines", results_write_buffered, NULL);
+    bench_run("stream/results_write_columns/10000_rows", results_write_columns, NULL);
+    bench_run("stream/results_read_columns_mmap/10000_rows", results_read_columns_mmap, NULL);
+    remove(CALENDAR_FILE);
+
+    system = rq_system_alloc();
+    for (i = 0; i < NUM_CALENDARS; i++)
+    {
+        sprintf(id, "CAL%02u", i);
+        rq_calendar_mgr_add(rq_system_get_calendar_mgr(system),
+                            build_calendar(id, (short)(i % 12 + 1), (short)(i % 28 + 1)));
+    }
+
+    store = rq_data_store_fs_alloc();
+    if (rq_data_store_create(store, STORE_DIR) == RQ_OK)
+    {
+        rq_data_store_close(store);
+
+        bench_run("data_store/system_save/20_calendars", data_store_system_save, system);
+        bench_run("data_store/system_load/20_calendars", data_store_system_load, NULL);
+        bench_run("data_store/system_load_lazy/20_calendars", data_store_system_load_lazy, NULL);
+        bench_run("data_store/system_load_parallel/20_calendars", data_store_system_load_parallel, NULL);
+
+        remove_store();
+    }
+    else
+        bench_note("can't create the data store in %s", STORE_DIR);
+    rq_data_store_free(store);
+
+    rq_system_free(system);
+
+    return bench_finish();
+}
@@ -0,0 +1,117 @@
+/*
+** bench_normdist.c
+**
+** Compares the speed and accuracy of the normal distribution
+** functions against the implementations they replaced.
+**
+** usage: bench_normdist [options], see bench.h
+*/
+#include <rq.h>
+#include "bench.h"
+#include <stdlib.h>
+#include <math.h>
+
+#define NUM_VALUES 4096
+
+struct normdist_data {
+    double a[NUM_VALUES];
+    double b[NUM_VALUES];
+    double rho[NUM_VALUES];
+    double out[NUM_VALUES];
+    unsigned int next;
+};
+
+static double
+cumul_norm_dist_hart(void *data)
+{
+    struct normdist_data *nd = (struct normdist_data *)data;
+    return rq_pricing_cumul_norm_dist_hart(nd->a[nd->next++ % NUM_VALUES]);
+}
+
+static double
+cumul_norm_dist_cody(void *data)
+{
+    struct normdist_data *nd = (struct normdist_data *)data;
+    return rq_pricing_cumul_norm_dist(nd->a[nd->next++ % NUM_VALUES]);
+}
+
+static double
+cumul_norm_dist_array(void *data)
+{
+    struct normdist_data *nd = (struct normdist_data *)data;
+
+    rq_pricing_cumul_norm_dist_array(nd->a, nd->out, NUM_VALUES);
+    return nd->out[0];
+}
+
+static double
+cumul_bivar_norm_dist_drezner(void *data)
+{
+    struct normdist_data *nd = (struct normdist_data *)data;
+    unsigned int i = nd->next++ % NUM_VALUES;
+
+    return rq_pricing_cumul_bivar_norm_dist_drezner(nd->a[i], nd->b[i], nd->rho[i]);
+}
+
+static double
+cumul_bivar_norm_dist_genz_array(void *data)
+{
+    struct normdist_data *nd = (struct normdist_data *)data;
+
+    rq_pricing_cumul_bivar_norm_dist_array(nd->a, nd->b, nd->rho, nd->out, NUM_VALUES);
+    return nd->out[0];
+}
+
+int
+main(int argc, char **argv)
+{
+    struct normdist_data *nd = (struct normdist_data *)malloc(sizeof(struct normdist_data));
+    double max_err_old = 0.0;
+    double max_err_new = 0.0;
+    unsigned int i;
+
+    bench_init(argc, argv, "normdist");
+
+    srand(42);
+    for (i = 0; i < NUM_VALUES; i++)
+    {
+        nd->a[i] = 10.0 * rand() / RAND_MAX - 5.0;
+        nd->b[i] = 10.0 * rand() / RAND_MAX - 5.0;
+        nd->rho[i] = 1.98 * rand() / RAND_MAX - 0.99;
+    }
+    nd->next = 0;
+
+    bench_run("cumul_norm_dist/hart", cumul_norm_dist_hart, nd);
+    bench_run("cumul_norm_dist/cody", cumul_norm_dist_cody, nd);
+    bench_run("cumul_norm_dist/array/4096", cumul_norm_dist_array, nd);
+    bench_run("cumul_bivar_norm_dist/drezner", cumul_bivar_norm_dist_drezner, nd);
+    bench_run("cumul_bivar_norm_dist/genz_array/4096", cumul_bivar_norm_dist_genz_array, nd);
+
+    rq_pricing_cumul_norm_dist_array(nd->a, nd->out, NUM_VALUES);
+    for (i = 0; i < NUM_VALUES; i++)
+    {
+        double ref = 0.5 * erfc(-nd->a[i] / sqrt(2.0));
+        double err_old = fabs(rq_pricing_cumul_norm_dist_hart(nd->a[i]) - ref) / ref;
+        double err_new = fabs(nd->out[i] - ref) / ref;
+
+        if (err_old > max_err_old)
+            max_err_old = err_old;
+        if (err_new > max_err_new)
+            max_err_new = err_new;
+    }
+    bench_note("max relative error: Hart %g, Cody %g", max_err_old, max_err_new);
+
+    rq_pricing_cumul_bivar_norm_dist_array(nd->a, nd->b, nd->rho, nd->out, NUM_VALUES);
+    max_err_old = 0.0;
+    for (i = 0; i < NUM_VALUES; i++)
+    {
+        double err = fabs(rq_pricing_cumul_bivar_norm_dist_drezner(nd->a[i], nd->b[i], nd->rho[i]) - nd->out[i]);
+        if (err > max_err_old)
+            max_err_old = err;
+    }
+    bench_note("max absolute difference Drezner vs Genz: %g", max_err_old);
+
+    free(nd);
+
+    return bench_finish();
+}
@@ -0,0 +1,508 @@
+/*
+** bench_pricing.c
+**
+** Times the closed form pricing models and the binomial, finite
+** difference and Monte Carlo engines at their usual accuracies, and
+** Monte Carlo with a scripted payoff.
+**
+** usage: bench_pricing [options], see bench.h
+*/
+#include <rq.h>
+#include "bench.h"
+#include <stdlib.h>
+#include <math.h>
+
+/* a one year at the money option on an asset at 100 */
+static const double S = 100.0;
+static const double X = 100.0;
+static const double R = 0.05;
+static const double RF = 0.02;
+static const double B = 0.03; /* R - RF */
+static const double V = 0.25;
+static const double T = 1.0;
+
+/* -- closed form models ------------------------------------------ */
+
+static double
+blackscholes(void *data)
+{
+    return rq_pricing_blackscholes(1, S, X, R, RF, V, T, T);
+}
+
+static double
+blackscholes_gen_greeks(void *data)
+{
+    double delta, gamma, vega, rho, theta;
+    return rq_pricing_blackscholes_gen_greeks(1, S, X, T, R, B, V, &delta, &gamma, &vega, &rho, &theta);
+}
+
+static double
+garmankhol(void *data)
+{
+    return rq_pricing_garmankhol(1, S, X, exp(-R * T), exp(-RF * T), V, T, T);
+}
+
+static double
+blackscholes_french(void *data)
+{
+    return rq_pricing_blackscholes_french(1, S, X, T, T * 252.0 / 365.0, R, B, V);
+}
+
+static double
+barone_adesi_whaley(void *data)
+{
+    return rq_pricing_barone_adesi_whaley(0, S, X, R, RF, V, T);
+}
+
+static double
+bjerksund_stensland(void *data)
+{
+    return rq_pricing_bjerksund_stensland(0, S, X, R, RF, V, T);
+}
+
+static double
+roll_geske_whaley(void *data)
+{
+    return rq_pricing_roll_geske_whaley(S, X, 0.25, T, R, 4.0, V);
+}
+
+static double
+futureopt(void *data)
+{
+    return rq_pricing_futureopt(1, S, X, R, V, T, T);
+}
+
+static double
+average_rate_geometric(void *data)
+{
+    return rq_pricing_average_rate_geometric(1, S, S, X, R, RF, V, T, T);
+}
+
+static double
+average_rate_turnbullwakeman(void *data)
+{
+    return rq_pricing_average_rate_turnbullwakeman(1, S, S, X, R, RF, V, T, T, 0.0);
+}
+
+static double
+average_rate_levy(void *data)
+{
+    return rq_pricing_average_rate_levy(1, S, S, X, R, B, V, T, T);
+}
+
+static double
+chooser_simple(void *data)
+{
+    return rq_pricing_chooser_simple(S, X, 0.5, T, R, B, V);
+}
+
+static double
+chooser_complex(void *data)
+{
+    return rq_pricing_chooser_complex(S, 105.0, 95.0, R, RF, V, 0.5, T, 1.25);
+}
+
+static double
+compound(void *data)
+{
+    return rq_pricing_compound(1, 1, S, 5.0, X, 0.5, T, R, RF, V);
+}
+
+static double
+digital(void *data)
+{
+    return rq_pricing_digital(1, 1, S, X, R, RF, V, T, T);
+}
+
+static double
+digital_barrier(void *data)
+{
+    return rq_pricing_digital_barrier(1, 0, 0, S, X, 80.0, R, RF, V, T, T);
+}
+
+static double
+single_barrier(void *data)
+{
+    return rq_pricing_single_barrier(0, 1, S, X, 80.0, R, RF, V, T, T);
+}
+
+static double
+double_barrier(void *data)
+{
+    return rq_pricing_double_barrier(0, 1, S, X, 80.0, 120.0, R, RF, V, T, T);
+}
+
+static double
+double_digital_knockout(void *data)
+{
+    return rq_pricing_double_digital_knockout(1, 1, S, X, 80.0, 120.0, R, RF, V, T, T);
+}
+
+static double
+partial_barrier_early_end(void *data)
+{
+    return rq_pricing_partial_barrier_early_end(0, 1, S, X, 80.0, R, RF, V, 0.5, T);
+}
+
+static double
+partial_barrier_delayed_start(void *data)
+{
+    return rq_pricing_partial_barrier_delayed_start(0, 1, S, X, 80.0, R, B, V, 0.5, T);
+}
+
+static double
+partial_double_barrier_early_end(void *data)
+{
+    return rq_pricing_partial_double_barrier_early_end(0, 1, S, X, 80.0, 120.0, R, RF, V, T, T, 0.5);
+}
+
+static double
+extendible_maturity_writer(void *data)
+{
+    return rq_pricing_extendible_maturity_writer(1, S, X, 105.0, 0.5, T, R, B, V);
+}
+
+static double
+extreme_spread(void *data)
+{
+    return rq_pricing_extreme_spread(1, 1, S, 90.0, 110.0, 0.5, T, R, RF, V);
+}
+
+static double
+forward_start(void *data)
+{
+    return rq_pricing_forward_start(1, S, 1.0, 0.25, T, R, B, V);
+}
+
+static double
+jennergren_naslund(void *data)
+{
+    return rq_pricing_jennergren_naslund(1, S, X, T, R, B, V, 0.1);
+}
+
+static double
+jump_diffusion(void *data)
+{
+    return rq_pricing_jump_diffusion(1, S, X, T, R, V, 1.0, 0.25);
+}
+
+static double
+lookback_floating_strike(void *data)
+{
+    return rq_pricing_lookback_floating_strike(1, S, 90.0, 110.0, T, R, B, V);
+}
+
+static double
+lookback_fixed_strike(void *data)
+{
+    return rq_pricing_lookback_fixed_strike(1, S, 90.0, 110.0, X, T, R, B, V);
+}
+
+static double
+lookback_partial_time_fixed_strike(void *data)
+{
+    return rq_pricing_lookback_partial_time_fixed_strike(1, S, X, 0.5, T, R, B, V);
+}
+
+static double
+miltersen_schwartz(void *data)
+{
+    return rq_pricing_miltersen_swartz(1, 0.95, 100.0, X, 0.5, T, 0.25, 0.1, 0.01, 0.5, 0.1, 0.1, 1.0, 0.2);
+}
+
+static double
+spread(void *data)
+{
+    return rq_pricing_spread(1, 100.0, 95.0, 5.0, T, R, 0.25, 0.3, 0.5);
+}
+
+static double
+swaption(void *data)
+{
+    return rq_pricing_swaption(1, T, 2.0, 0.05, 0.05, 5.0, R, 0.2);
+}
+
+static double
+time_switch(void *data)
+{
+    return rq_pricing_time_switch(1, S, X, 5.0, T, 0, 1.0 / 365.0, R, B, V);
+}
+
+static double
+bond_opt(void *data)
+{
+    double coupon_times[4] = { 0.5, 1.0, 1.5, 2.0 };
+    double coupon_amounts[4] = { 3.0, 3.0, 3.0, 103.0 };
+    double coupon_r[4] = { 0.05, 0.05, 0.05, 0.05 };
+
+    return rq_pricing_bond_opt(1, 100.0, 100.0, R, 0.05, T, T, 4, coupon_times, coupon_amounts, coupon_r);
+}
+
+static double
+fra_arrears(void *data)
+{
+    return rq_pricing_fra_arrears(0.05, 0.051, 0.25, 0.05, T);
+}
+
+/* -- engines ----------------------------------------------------- */
+
+struct lattice_data {
+    enum rq_binomial_tree_type tree_type;
+    unsigned int flags;
+    int num_iters;
+    double *work;
+};
+
+static double
+binomial_lattice(void *data)
+{
+    struct lattice_data *ld = (struct lattice_data *)data;
+    return rq_pricing_binomial_lattice(0, ld->flags, ld->tree_type, S, X, R, RF, V, T, T, ld->num_iters, ld->work);
+}
+
+static double
+binomial_extrapolated(void *data)
+{
+    struct lattice_data *ld = (struct lattice_data *)data;
+    return rq_pricing_binomial_extrapolated(0, ld->flags, ld->tree_type, S, X, R, RF, V, T, T, ld->num_iters, ld->work);
+}
+
+struct fd_data {
+    unsigned int num_timesteps;
+    unsigned int num_values;
+    double *work;
+};
+
+static double
+finite_differences_american(void *data)
+{
+    struct fd_data *fd = (struct fd_data *)data;
+    unsigned int n = fd->num_values + 1;
+    int err;
+
+    return rq_pricing_finite_differences_equity_american(
+        0, S, X, R, RF, V, T, T, fd->num_timesteps, fd->num_values,
+        fd->work, fd->work + n, fd->work + 2 * n, fd->work + 3 * n,
+        fd->work + 4 * n, fd->work + 5 * n, fd->work + 6 * n, fd->work + 7 * n,
+        &err
+        );
+}
+
+struct mc_data {
+    int num_paths;
+    double *terminal_distribution;
+};
+
+static double
+calc_terminal(void *user_defined, double log_S, double prev_value)
+{
+    double payoff = exp(log_S) - X;
+    return payoff > 0.0 ? payoff : 0.0;
+}
+
+static double
+monte_carlo(void *data)
+{
+    struct mc_data *mc = (struct mc_data *)data;
+    return rq_pricing_monte_carlo(S, R, RF, V, T, mc->num_paths, mc->terminal_distribution, 1, NULL, NULL, NULL, NULL, calc_terminal, NULL, NULL);
+}
+
+/* -- scripted payoffs ------------------------------------------- */
+
+struct script_data {
+    struct mc_data *mc;
+    rq_interpreter_t interp;
+    rq_object_t form;
+    rq_object_t spot; /**< The symbol the tree walk reads */
+    rq_interpreter_program_t program;
+};
+
+static double
+calc_terminal_eval(void *user_defined, double log_S, double prev_value)
+{
+    struct script_data *sd = (struct script_data *)user_defined;
+
+    rq_object_set_double(sd->spot, exp(log_S));
+    return rq_interpreter_eval(sd->interp, sd->form)->value.d;
+}
+
+static double
+calc_terminal_program(void *user_defined, double log_S, double prev_value)
+{
+    struct script_data *sd = (struct script_data *)user_defined;
+    double spot = exp(log_S);
+
+    return rq_interpreter_program_eval(sd->program, &spot);
+}
+
+static double
+monte_carlo_script_eval(void *data)
+{
+    struct script_data *sd = (struct script_data *)data;
+    double ret = rq_pricing_monte_carlo(S, R, RF, V, T, sd->mc->num_paths, sd->mc->terminal_distribution, 1, NULL, sd, NULL, NULL, calc_terminal_eval, NULL, NULL);
+
+    rq_interpreter_garbage_collect(sd->interp);
+
+    return ret;
+}
+
+static double
+monte_carlo_script_program(void *data)
+{
+    struct script_data *sd = (struct script_data *)data;
+    return rq_pricing_monte_carlo(S, R, RF, V, T, sd->mc->num_paths, sd->mc->terminal_distribution, 1, NULL, sd, NULL, NULL, calc_terminal_program, NULL, NULL);
+}
+
+static void
+script_data_init(struct script_data *sd, struct mc_data *mc)
+{
+    rq_stream_t stream = rq_stream_string_alloc();
+    rq_object_mgr_t object_mgr;
+    const char *spot_id = "spot";
+
+    sd->mc = mc;
+    sd->interp = rq_interpreter_alloc();
+    object_mgr = rq_interpreter_get_object_mgr(sd->interp);
+    rq_interpreter_builtin_core_register(sd->interp);
+    rq_interpreter_builtin_math_register(sd->interp);
+
+    rq_stream_open(stream);
+    rq_stream_write_string(stream, "(max 0.0 (- spot strike))");
+    rq_stream_rewind(stream);
+    sd->form = rq_object_get_cons_car(rq_interpreter_parse(sd->interp, stream));
+    rq_stream_free(stream);
+
+    /* kept in the symbol table so garbage collection leaves them */
+    rq_object_mgr_symbol_add(object_mgr, "payoff", sd->form);
+    rq_interpreter_symbol_set(sd->interp, "strike", rq_object_alloc_double(object_mgr, X));
+    rq_interpreter_symbol_set(sd->interp, "spot", rq_object_alloc_double(object_mgr, S));
+    sd->spot = rq_interpreter_symbol_find(sd->interp, "spot");
+
+    sd->program = rq_interpreter_program_compile(sd->interp, sd->form, &spot_id, 1);
+}
+
+static void
+script_data_free(struct script_data *sd)
+{
+    rq_interpreter_program_free(sd->program);
+    rq_interpreter_free(sd->interp);
+}
+
+int
+main(int argc, char **argv)
+{
+    static const struct {
+        const char *name;
+        double (*func)(void *);
+    } models[] = {
+        { "blackscholes", blackscholes },
+        { "blackscholes_gen_greeks", blackscholes_gen_greeks },
+        { "garmankhol", garmankhol },
+        { "blackscholes_french", blackscholes_french },
+        { "barone_adesi_whaley", barone_adesi_whaley },
+        { "bjerksund_stensland", bjerksund_stensland },
+        { "roll_geske_whaley", roll_geske_whaley },
+        { "futureopt", futureopt },
+        { "average_rate_geometric", average_rate_geometric },
+        { "average_rate_turnbullwakeman", average_rate_turnbullwakeman },
+        { "average_rate_levy", average_rate_levy },
+        { "chooser_simple", chooser_simple },
+        { "chooser_complex", chooser_complex },
+        { "compound", compound },
+        { "digital", digital },
+        { "digital_barrier", digital_barrier },
+        { "single_barrier", single_barrier },
+        { "double_barrier", double_barrier },
+        { "double_digital_knockout", double_digital_knockout },
+        { "partial_barrier_early_end", partial_barrier_early_end },
+        { "partial_barrier_delayed_start", partial_barrier_delayed_start },
+        { "partial_double_barrier_early_end", partial_double_barrier_early_end },
+        { "extendible_maturity_writer", extendible_maturity_writer },
+        { "extreme_spread", extreme_spread },
+        { "forward_start", forward_start },
+        { "jennergren_naslund", jennergren_naslund },
+        { "jump_diffusion", jump_diffusion },
+        { "lookback_floating_strike", lookback_floating_strike },
+        { "lookback_fixed_strike", lookback_fixed_strike },
+        { "lookback_partial_time_fixed_strike", lookback_partial_time_fixed_strike },
+        { "miltersen_schwartz", miltersen_schwartz },
+        { "spread", spread },
+        { "swaption", swaption },
+        { "time_switch", time_switch },
+        { "bond_opt", bond_opt },
+        { "fra_arrears", fra_arrears }
+    };
+    static const int lattice_steps[] = { 101, 501 };
+    static const unsigned int fd_sizes[] = { 100, 400 };
+    static const int mc_paths[] = { 10000, 100000 };
+    struct lattice_data ld;
+    struct fd_data fd;
+    struct mc_data mc;
+    struct script_data sd;
+    char name[128];
+    unsigned int i;
+
+    bench_init(argc, argv, "pricing");
+
+    for (i = 0; i < sizeof(models) / sizeof(models[0]); i++)
+    {
+        sprintf(name, "closed_form/%s", models[i].name);
+        bench_run(name, models[i].func, NULL);
+    }
+
+    for (i = 0; i < sizeof(lattice_steps) / sizeof(lattice_steps[0]); i++)
+    {
+        ld.num_iters = lattice_steps[i];
+        ld.work = (double *)malloc(sizeof(double) * RQ_PRICING_BINOMIAL_WORK_SIZE(ld.num_iters));
+
+        ld.tree_type = RQ_BINOMIAL_TREE_CRR;
+        ld.flags = RQ_BINOMIAL_FLAG_AMERICAN;
+        sprintf(name, "binomial/crr_american/%d", ld.num_iters);
+        bench_run(name, binomial_lattice, &ld);
+
+        ld.tree_type = RQ_BINOMIAL_TREE_LEISEN_REIMER;
+        sprintf(name, "binomial/leisen_reimer_american/%d", ld.num_iters);
+        bench_run(name, binomial_lattice, &ld);
+
+        ld.tree_type = RQ_BINOMIAL_TREE_CRR;
+        ld.flags = RQ_BINOMIAL_FLAG_AMERICAN | RQ_BINOMIAL_FLAG_SMOOTH;
+        sprintf(name, "binomial/crr_american_extrapolated/%d", ld.num_iters);
+        bench_run(name, binomial_extrapolated, &ld);
+
+        free(ld.work);
+    }
+
+    for (i = 0; i < sizeof(fd_sizes) / sizeof(fd_sizes[0]); i++)
+    {
+        fd.num_timesteps = fd_sizes[i];
+        fd.num_values = fd_sizes[i];
+        fd.work = (double *)malloc(sizeof(double) * 8 * (fd_sizes[i] + 1));
+        sprintf(name, "finite_differences/american/%ux%u", fd.num_timesteps, fd.num_values);
+        bench_run(name, finite_differences_american, &fd);
+        free(fd.work);
+    }
+
+    for (i = 0; i < sizeof(mc_paths) / sizeof(mc_paths[0]); i++)
+    {
+        mc.num_paths = mc_paths[i];
+        mc.terminal_distribution = (double *)malloc(sizeof(double) * mc.num_paths);
+        srand(42);
+        sprintf(name, "monte_carlo/european/%d", mc.num_paths);
+        bench_run(name, monte_carlo, &mc);
+        free(mc.terminal_distribution);
+    }
+
+    mc.num_paths = 10000;
+    mc.terminal_distribution = (double *)malloc(sizeof(double) * mc.num_paths);
+    script_data_init(&sd, &mc);
+    srand(42);
+    sprintf(name, "monte_carlo/european_script_eval/%d", mc.num_paths);
+    bench_run(name, monte_carlo_script_eval, &sd);
+    srand(42);
+    sprintf(name, "monte_carlo/european_script_program/%d", mc.num_paths);
+    bench_run(name, monte_carlo_script_program, &sd);
+    script_data_free(&sd);
+    free(mc.terminal_distribution);
+
+    return bench_finish();
+}
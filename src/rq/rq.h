@@ -35,6 +35,8 @@
 
 #include "rq_address.h"
 #include "rq_adjustable_date.h"
+#include "rq_alloc.h"
+#include "rq_arena.h"
 #include "rq_array.h"
 #include "rq_array_double.h"
 #include "rq_array_partitioned.h"
@@ -124,9 +126,11 @@
 #include "rq_exchange_rate_mgr.h"
 #include "rq_external_termstruct_mgr.h"
 #include "rq_floating_flow.h"
+#include "rq_floating_flow_columns.h"
 #include "rq_floating_flow_list.h"
 #include "rq_forward_curve.h"
 #include "rq_forward_curve_mgr.h"
+#include "rq_forward_rate_cache.h"
 #include "rq_future_curve.h"
 #include "rq_future_curve_mgr.h"
 #include "rq_forward_rate.h"
@@ -139,16 +143,20 @@
 #include "rq_hashtable.h"
 #include "rq_information_source.h"
 #include "rq_init.h"
+#include "rq_instrument.h"
 #include "rq_intermediary_information.h"
 #include "rq_interpolate.h"
 #include "rq_interpreter.h"
 #include "rq_interpreter_builtin_core.h"
+#include "rq_interpreter_builtin_date.h"
 #include "rq_interpreter_builtin_math.h"
 #include "rq_interpreter_builtin_string.h"
 #include "rq_interpreter_error.h"
+#include "rq_interpreter_program.h"
 #include "rq_ir_vol_surface.h"
 #include "rq_ir_vol_surface_mgr.h"
 #include "rq_iterator.h"
+#include "rq_linalg.h"
 #include "rq_linked_list.h"
 #include "rq_market.h"
 #include "rq_market_mgr.h"
@@ -157,6 +165,7 @@
 #include "rq_matrix.h"
 #include "rq_memdbg.h"
 #include "rq_money.h"
+#include "rq_mutex.h"
 #include "rq_named_variant_mgr.h"
 #include "rq_object.h"
 #include "rq_object_builder.h"
@@ -219,16 +228,21 @@
 #include "rq_rate_class.h"
 #include "rq_rate_class_mgr.h"
 #include "rq_rate_conversions.h"
+#include "rq_rate_loader.h"
 #include "rq_rate_mgr.h"
+#include "rq_results_columns.h"
 #include "rq_routing.h"
 #include "rq_routing_explicit_details.h"
 #include "rq_routing_ids.h"
+#include "rq_schedule.h"
+#include "rq_schedule_cache.h"
 #include "rq_set_rb.h"
 #include "rq_settlement_information.h"
 #include "rq_settlement_instruction.h"
 #include "rq_side_rate.h"
 #include "rq_side_rates.h"
 #include "rq_simulation_results.h"
+#include "rq_snapshot.h"
 #include "rq_split_settlement.h"
 #include "rq_spot_price.h"
 #include "rq_spot_price_mgr.h"
@@ -236,13 +250,16 @@
 #include "rq_spread_curve_mgr.h"
 #include "rq_statistics.h"
 #include "rq_stream.h"
+#include "rq_stream_buffered.h"
 #include "rq_stream_file.h"
+#include "rq_stream_mmap.h"
 #include "rq_stream_string.h"
 #include "rq_street_address.h"
 #include "rq_string_list.h"
 #include "rq_string_set.h"
 #include "rq_symbol_table.h"
 #include "rq_system.h"
+#include "rq_tdigest.h"
 #include "rq_term.h"
 #include "rq_termstruct.h"
 #include "rq_termstruct_cache.h"
@@ -251,6 +268,7 @@
 #include "rq_time.h"
 #include "rq_tokenizer.h"
 #include "rq_trade.h"
+#include "rq_trade_import.h"
 #include "rq_trade_list.h"
 #include "rq_trade_mgr.h"
 #include "rq_trade_status.h"
@@ -0,0 +1,409 @@
+/*
+** rq_alloc.c
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#include "rq_alloc.h"
+#include "rq_arena.h"
+#include <stdlib.h>
+#include <string.h>
+#ifdef RQ_THREADS
+#include <pthread.h>
+#endif
+
+RQ_EXPORT void
+rq_free_func(void *p)
+{
+    RQ_FREE(p);
+}
+
+#ifdef RQ_CUSTOM_ALLOCATOR
+
+/* Every block handed out is preceded by a header saying where it
+   came from. The header is padded so the block stays 16 byte
+   aligned. */
+#define SOURCE_BACKEND 0
+#define SOURCE_POOL 1
+#define SOURCE_ARENA 2
+
+struct rq_alloc_header {
+    size_t capacity; /**< usable bytes after the header */
+    unsigned int source;
+    unsigned int size_class;
+};
+
+#define HEADER_SIZE 16
+#define HEADER(p) ((struct rq_alloc_header *)((char *)(p) - HEADER_SIZE))
+#define DATA(h) ((void *)((char *)(h) + HEADER_SIZE))
+#define NUM_SIZE_CLASSES (RQ_ALLOC_POOL_MAX_SIZE / RQ_ALLOC_POOL_CLASS_SIZE)
+
+struct rq_alloc_thread_cache {
+    struct rq_arena *arenas[RQ_ALLOC_MAX_ARENA_DEPTH];
+    int num_arenas;
+    struct rq_alloc_header *free_lists[NUM_SIZE_CLASSES]; /* linked through the first word of the data */
+    int registered; /* whether the free lists are flushed when the thread exits */
+};
+
+static struct rq_alloc_backend s_backend = { malloc, realloc, free };
+static int s_pooling = 1;
+static RQ_THREAD_LOCAL struct rq_alloc_thread_cache s_cache;
+
+#ifdef RQ_THREADS
+/* The free lists of threads that have exited, taken a whole list at
+   a time by refill(). This uses pthreads directly, as rq_mutex
+   allocates through RQ_MALLOC. */
+static struct rq_alloc_header *s_depot[NUM_SIZE_CLASSES];
+static pthread_mutex_t s_depot_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_key_t s_exit_key;
+static pthread_once_t s_exit_key_once = PTHREAD_ONCE_INIT;
+
+/* Move an exiting thread's free lists to the depot. */
+static void
+flush_thread_cache(void *data)
+{
+    struct rq_alloc_thread_cache *cache = (struct rq_alloc_thread_cache *)data;
+    struct rq_alloc_header *tails[NUM_SIZE_CLASSES];
+    unsigned int i;
+
+    for (i = 0; i < NUM_SIZE_CLASSES; i++)
+    {
+        tails[i] = cache->free_lists[i];
+        if (tails[i])
+            while (*(struct rq_alloc_header **)DATA(tails[i]))
+                tails[i] = *(struct rq_alloc_header **)DATA(tails[i]);
+    }
+
+    pthread_mutex_lock(&s_depot_mutex);
+    for (i = 0; i < NUM_SIZE_CLASSES; i++)
+        if (tails[i])
+        {
+            *(struct rq_alloc_header **)DATA(tails[i]) = s_depot[i];
+            s_depot[i] = cache->free_lists[i];
+            cache->free_lists[i] = NULL;
+        }
+    pthread_mutex_unlock(&s_depot_mutex);
+
+    /* anything freed by a later destructor registers the thread again */
+    cache->registered = 0;
+}
+
+static void
+create_exit_key()
+{
+    pthread_key_create(&s_exit_key, flush_thread_cache);
+}
+
+/* Have the calling thread's free lists flushed when it exits. */
+static void
+register_thread()
+{
+    pthread_once(&s_exit_key_once, create_exit_key);
+    pthread_setspecific(s_exit_key, &s_cache);
+    s_cache.registered = 1;
+}
+#endif
+
+RQ_EXPORT void
+rq_alloc_set_backend(const struct rq_alloc_backend *backend)
+{
+    if (backend)
+        s_backend = *backend;
+    else
+    {
+        s_backend.malloc_func = malloc;
+        s_backend.realloc_func = realloc;
+        s_backend.free_func = free;
+    }
+}
+
+RQ_EXPORT void
+rq_alloc_set_pooling(int pooling)
+{
+    s_pooling = pooling;
+}
+
+RQ_EXPORT void
+rq_alloc_push_arena(struct rq_arena *arena)
+{
+    if (s_cache.num_arenas < RQ_ALLOC_MAX_ARENA_DEPTH)
+        s_cache.arenas[s_cache.num_arenas++] = arena;
+}
+
+RQ_EXPORT void
+rq_alloc_pop_arena()
+{
+    if (s_cache.num_arenas > 0)
+        s_cache.num_arenas--;
+}
+
+RQ_EXPORT void *
+rq_alloc_backend_malloc(size_t size)
+{
+    return s_backend.malloc_func(size);
+}
+
+RQ_EXPORT void
+rq_alloc_backend_free(void *p)
+{
+    s_backend.free_func(p);
+}
+
+/* Take the blocks of one size class left by threads that have
+   exited, or else carve a fresh chunk into them. */
+static void
+refill(unsigned int size_class)
+{
+    size_t block_size = HEADER_SIZE + (size_class + 1) * RQ_ALLOC_POOL_CLASS_SIZE;
+    unsigned long num_blocks = RQ_ALLOC_POOL_CHUNK_SIZE / block_size;
+    char *chunk;
+    unsigned long i;
+
+#ifdef RQ_THREADS
+    if (!s_cache.registered)
+        register_thread();
+
+    pthread_mutex_lock(&s_depot_mutex);
+    s_cache.free_lists[size_class] = s_depot[size_class];
+    s_depot[size_class] = NULL;
+    pthread_mutex_unlock(&s_depot_mutex);
+
+    if (s_cache.free_lists[size_class])
+        return;
+#endif
+
+    chunk = (char *)s_backend.malloc_func(num_blocks * block_size);
+    if (!chunk)
+        return;
+
+    for (i = 0; i < num_blocks; i++)
+    {
+        struct rq_alloc_header *h = (struct rq_alloc_header *)(chunk + i * block_size);
+        h->capacity = (size_class + 1) * RQ_ALLOC_POOL_CLASS_SIZE;
+        h->source = SOURCE_POOL;
+        h->size_class = size_class;
+        *(struct rq_alloc_header **)DATA(h) = s_cache.free_lists[size_class];
+        s_cache.free_lists[size_class] = h;
+    }
+}
+
+RQ_EXPORT void *
+rq_alloc_malloc(size_t size)
+{
+    struct rq_alloc_header *h;
+
+    if (s_cache.num_arenas > 0)
+    {
+        h = (struct rq_alloc_header *)rq_arena_malloc(s_cache.arenas[s_cache.num_arenas - 1], HEADER_SIZE + size);
+        h->capacity = size;
+        h->source = SOURCE_ARENA;
+        h->size_class = 0;
+    }
+    else if (s_pooling && size <= RQ_ALLOC_POOL_MAX_SIZE)
+    {
+        unsigned int size_class = (size ? (unsigned int)((size - 1) / RQ_ALLOC_POOL_CLASS_SIZE) : 0);
+
+        if (!s_cache.free_lists[size_class])
+            refill(size_class);
+        h = s_cache.free_lists[size_class];
+        if (!h)
+            return NULL;
+        s_cache.free_lists[size_class] = *(struct rq_alloc_header **)DATA(h);
+    }
+    else
+    {
+        h = (struct rq_alloc_header *)s_backend.malloc_func(HEADER_SIZE + size);
+        if (!h)
+            return NULL;
+        h->capacity = size;
+        h->source = SOURCE_BACKEND;
+        h->size_class = 0;
+    }
+
+    return DATA(h);
+}
+
+RQ_EXPORT void *
+rq_alloc_calloc(size_t n, size_t size)
+{
+    void *p;
+
+    /* n * size would wrap around to a smaller block */
+    if (size && n > (size_t)-1 / size)
+        return NULL;
+
+    p = rq_alloc_malloc(n * size);
+
+    if (p)
+        memset(p, 0, n * size);
+    return p;
+}
+
+RQ_EXPORT void
+rq_alloc_free(void *p)
+{
+    struct rq_alloc_header *h;
+
+    if (!p)
+        return;
+
+    h = HEADER(p);
+    if (h->source == SOURCE_POOL)
+    {
+        /* blocks go back on the freeing thread's list, whichever
+           thread allocated them. */
+#ifdef RQ_THREADS
+        if (!s_cache.registered)
+            register_thread();
+#endif
+        *(struct rq_alloc_header **)p = s_cache.free_lists[h->size_class];
+        s_cache.free_lists[h->size_class] = h;
+    }
+    else if (h->source == SOURCE_BACKEND)
+        s_backend.free_func(h);
+}
+
+RQ_EXPORT void *
+rq_alloc_realloc(void *p, size_t size)
+{
+    struct rq_alloc_header *h;
+    void *np;
+
+    if (!p)
+        return rq_alloc_malloc(size);
+
+    h = HEADER(p);
+    if (h->source == SOURCE_BACKEND)
+    {
+        h = (struct rq_alloc_header *)s_backend.realloc_func(h, HEADER_SIZE + size);
+        if (!h)
+            return NULL;
+        h->capacity = size;
+        return DATA(h);
+    }
+
+    if (size <= h->capacity)
+        return p;
+
+    np = rq_alloc_malloc(size);
+    if (np)
+    {
+        memcpy(np, p, h->capacity);
+        rq_alloc_free(p);
+    }
+    return np;
+}
+
+RQ_EXPORT char *
+rq_alloc_strdup(const char *s)
+{
+    size_t len = strlen(s) + 1;
+    char *p = (char *)rq_alloc_malloc(len);
+
+    if (p)
+        memcpy(p, s, len);
+    return p;
+}
+
+#else
+
+RQ_EXPORT void
+rq_alloc_set_backend(const struct rq_alloc_backend *backend)
+{
+}
+
+RQ_EXPORT void
+rq_alloc_set_pooling(int pooling)
+{
+}
+
+RQ_EXPORT void
+rq_alloc_push_arena(struct rq_arena *arena)
+{
+}
+
+RQ_EXPORT void
+rq_alloc_pop_arena()
+{
+}
+
+RQ_EXPORT void *
+rq_alloc_backend_malloc(size_t size)
+{
+    return malloc(size);
+}
+
+RQ_EXPORT void
+rq_alloc_backend_free(void *p)
+{
+    free(p);
+}
+
+/* RQ_MALLOC and friends call these, so they hand out memory the way
+   the rest of the library does: counted by rq_memdbg if it is built
+   with RQ_INSTRUMENT, otherwise straight from libc. */
+#if defined(DEBUG_MEMORY) || defined(RQ_INSTRUMENT)
+#define PLAIN_MALLOC(x) RQ_MALLOC(x)
+#define PLAIN_CALLOC(n, s) RQ_CALLOC(n, s)
+#define PLAIN_REALLOC(p, s) RQ_REALLOC(p, s)
+#define PLAIN_FREE(p) RQ_FREE(p)
+#else
+#define PLAIN_MALLOC(x) malloc(x)
+#define PLAIN_CALLOC(n, s) calloc(n, s)
+#define PLAIN_REALLOC(p, s) realloc(p, s)
+#define PLAIN_FREE(p) free(p)
+#endif
+
+RQ_EXPORT void *
+rq_alloc_malloc(size_t size)
+{
+    return PLAIN_MALLOC(size);
+}
+
+RQ_EXPORT void *
+rq_alloc_calloc(size_t n, size_t size)
+{
+    if (size && n > (size_t)-1 / size)
+        return NULL;
+    return PLAIN_CALLOC(n, size);
+}
+
+RQ_EXPORT void *
+rq_alloc_realloc(void *p, size_t size)
+{
+    return PLAIN_REALLOC(p, size);
+}
+
+RQ_EXPORT char *
+rq_alloc_strdup(const char *s)
+{
+    size_t len = strlen(s) + 1;
+    char *p = (char *)PLAIN_MALLOC(len);
+
+    if (p)
+        memcpy(p, s, len);
+    return p;
+}
+
+RQ_EXPORT void
+rq_alloc_free(void *p)
+{
+    PLAIN_FREE(p);
+}
+
+#endif
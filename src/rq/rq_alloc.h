@@ -0,0 +1,127 @@
+/**
+ * @file
+ *
+ * The allocator behind RQ_MALLOC and friends: size-class pools, scoped arenas and a pluggable backend.
+ */
+/*
+** rq_alloc.h
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#ifndef rq_alloc_h
+#define rq_alloc_h
+
+#include "rq_config.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#if 0
+} // purely to not screw up my indenting...
+#endif
+#endif
+
+/*
+   RQ_MALLOC, RQ_CALLOC, RQ_REALLOC, RQ_STRDUP and RQ_FREE call the
+   functions below. When the library is built with RQ_CUSTOM_ALLOCATOR
+   (configure --enable-custom-allocator) they work as follows.
+
+   - Requests of up to RQ_ALLOC_POOL_MAX_SIZE bytes are served from
+     free lists for each RQ_ALLOC_POOL_CLASS_SIZE size class. Each
+     thread has its own free lists, so the small objects the library
+     allocates most (tree nodes, rates, curve elements, strings) don't
+     contend on the heap lock. Pooled memory is kept for reuse rather
+     than returned to the backend. With RQ_THREADS, a thread's free
+     lists are handed to a shared depot when it exits, and other
+     threads take from the depot before getting more memory.
+   - An arena pushed with rq_alloc_push_arena() serves every request
+     made by that thread until it is popped. RQ_FREE of arena memory
+     does nothing; it is all released by rq_arena_clear() or
+     rq_arena_free(), for example at the end of a valuation run.
+   - Everything else goes to the backend, libc unless replaced with
+     rq_alloc_set_backend().
+
+   Memory from RQ_MALLOC must be released with RQ_FREE and vice
+   versa. Without RQ_CUSTOM_ALLOCATOR the arena and pool functions do
+   nothing and the rest call libc. Code using the library doesn't need
+   the define, as the macros are the same either way.
+*/
+
+#define RQ_ALLOC_POOL_CLASS_SIZE 16
+#define RQ_ALLOC_POOL_MAX_SIZE 256
+#define RQ_ALLOC_POOL_CHUNK_SIZE 65536
+
+struct rq_arena;
+
+/** The functions the allocator gets memory from the system with. */
+struct rq_alloc_backend {
+    void *(*malloc_func)(size_t size);
+    void *(*realloc_func)(void *p, size_t size);
+    void (*free_func)(void *p);
+};
+
+/** Replace the backend allocator. This must be done before anything
+ * is allocated through RQ_MALLOC. Passing NULL restores libc.
+ */
+RQ_EXPORT void rq_alloc_set_backend(const struct rq_alloc_backend *backend);
+
+/** Turn the size-class pools on or off (they are on by default).
+ * This must be done before anything is allocated through RQ_MALLOC.
+ */
+RQ_EXPORT void rq_alloc_set_pooling(int pooling);
+
+/** Serve the calling thread's allocations from an arena until the
+ * matching rq_alloc_pop_arena(). Arenas can be nested up to
+ * RQ_ALLOC_MAX_ARENA_DEPTH deep. Nothing allocated while the arena
+ * is pushed may be used after the arena is cleared or freed.
+ */
+RQ_EXPORT void rq_alloc_push_arena(struct rq_arena *arena);
+
+/** Stop serving the calling thread's allocations from the most
+ * recently pushed arena.
+ */
+RQ_EXPORT void rq_alloc_pop_arena();
+
+#define RQ_ALLOC_MAX_ARENA_DEPTH 8
+
+RQ_EXPORT void *rq_alloc_malloc(size_t size);
+RQ_EXPORT void *rq_alloc_calloc(size_t n, size_t size);
+RQ_EXPORT void *rq_alloc_realloc(void *p, size_t size);
+RQ_EXPORT char *rq_alloc_strdup(const char *s);
+RQ_EXPORT void rq_alloc_free(void *p);
+
+/** Get and release memory from the backend directly, bypassing the
+ * pools and arenas.
+ */
+RQ_EXPORT void *rq_alloc_backend_malloc(size_t size);
+RQ_EXPORT void rq_alloc_backend_free(void *p);
+
+/** RQ_FREE as a function, for passing as a free function to the
+ * containers.
+ */
+RQ_EXPORT void rq_free_func(void *p);
+
+#ifdef __cplusplus
+#if 0
+{ // purely to not screw up my indenting...
+#endif
+};
+#endif
+
+#endif
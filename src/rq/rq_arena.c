@@ -0,0 +1,158 @@
+/*
+** rq_arena.c
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#include "rq_arena.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define ALIGN_UP(n) (((n) + RQ_ARENA_ALIGNMENT - 1) & ~((size_t)RQ_ARENA_ALIGNMENT - 1))
+#define BLOCK_HEADER_SIZE ALIGN_UP(sizeof(struct rq_arena_block))
+#define BLOCK_DATA(b) ((char *)(b) + BLOCK_HEADER_SIZE)
+
+/* An arena can be pushed as the allocator behind RQ_MALLOC, so with
+   the custom allocator its own memory has to come from the backend. */
+#ifdef RQ_CUSTOM_ALLOCATOR
+#define ARENA_MALLOC(n) rq_alloc_backend_malloc(n)
+#define ARENA_FREE(p) rq_alloc_backend_free(p)
+#else
+#define ARENA_MALLOC(n) RQ_MALLOC(n)
+#define ARENA_FREE(p) RQ_FREE(p)
+#endif
+
+static struct rq_arena_block *
+block_alloc(size_t size)
+{
+    struct rq_arena_block *b = (struct rq_arena_block *)ARENA_MALLOC(BLOCK_HEADER_SIZE + size);
+
+    b->next = NULL;
+    b->size = size;
+    b->used = 0;
+    return b;
+}
+
+RQ_EXPORT rq_arena_t
+rq_arena_alloc(size_t block_size)
+{
+    rq_arena_t arena = (rq_arena_t)ARENA_MALLOC(sizeof(struct rq_arena));
+
+    arena->blocks = NULL;
+    arena->block_size = (block_size ? ALIGN_UP(block_size) : RQ_ARENA_DEFAULT_BLOCK_SIZE);
+    arena->bytes_allocated = 0;
+    return arena;
+}
+
+RQ_EXPORT void
+rq_arena_free(rq_arena_t arena)
+{
+    struct rq_arena_block *b = arena->blocks;
+
+    while (b)
+    {
+        struct rq_arena_block *next = b->next;
+        ARENA_FREE(b);
+        b = next;
+    }
+    ARENA_FREE(arena);
+}
+
+RQ_EXPORT void
+rq_arena_clear(rq_arena_t arena)
+{
+    struct rq_arena_block *keep = NULL;
+    struct rq_arena_block *b = arena->blocks;
+
+    while (b)
+    {
+        struct rq_arena_block *next = b->next;
+        if (!keep && b->size == arena->block_size)
+        {
+            keep = b;
+            keep->next = NULL;
+            keep->used = 0;
+        }
+        else
+            ARENA_FREE(b);
+        b = next;
+    }
+    arena->blocks = keep;
+    arena->bytes_allocated = 0;
+}
+
+RQ_EXPORT void *
+rq_arena_malloc(rq_arena_t arena, size_t size)
+{
+    struct rq_arena_block *b = arena->blocks;
+    size_t aligned = ALIGN_UP(size ? size : 1);
+    void *p;
+
+    if (!b || b->size - b->used < aligned)
+    {
+        if (aligned > arena->block_size / 4)
+        {
+            /* big allocations get their own block, behind the
+               current one so its free space isn't wasted. */
+            struct rq_arena_block *big = block_alloc(aligned);
+            big->used = aligned;
+            if (b)
+            {
+                big->next = b->next;
+                b->next = big;
+            }
+            else
+                arena->blocks = big;
+            arena->bytes_allocated += size;
+            return BLOCK_DATA(big);
+        }
+
+        b = block_alloc(arena->block_size);
+        b->next = arena->blocks;
+        arena->blocks = b;
+    }
+
+    p = BLOCK_DATA(b) + b->used;
+    b->used += aligned;
+    arena->bytes_allocated += size;
+    return p;
+}
+
+RQ_EXPORT void *
+rq_arena_calloc(rq_arena_t arena, size_t n, size_t size)
+{
+    void *p = rq_arena_malloc(arena, n * size);
+
+    memset(p, 0, n * size);
+    return p;
+}
+
+RQ_EXPORT char *
+rq_arena_strdup(rq_arena_t arena, const char *s)
+{
+    size_t len;
+    char *p;
+
+    if (!s)
+        return NULL;
+
+    len = strlen(s) + 1;
+    p = (char *)rq_arena_malloc(arena, len);
+    memcpy(p, s, len);
+    return p;
+}
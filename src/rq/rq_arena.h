@@ -0,0 +1,97 @@
+/**
+ * @file
+ *
+ * A region allocator: many small allocations released together.
+ */
+/*
+** rq_arena.h
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#ifndef rq_arena_h
+#define rq_arena_h
+
+#include "rq_config.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#if 0
+} // purely to not screw up my indenting...
+#endif
+#endif
+
+/** The default size of each block the arena carves allocations from. */
+#define RQ_ARENA_DEFAULT_BLOCK_SIZE 65536
+
+/** Every allocation from an arena is aligned to this many bytes. */
+#define RQ_ARENA_ALIGNMENT 16
+
+struct rq_arena_block {
+    struct rq_arena_block *next;
+    size_t size; /**< bytes available after the header */
+    size_t used;
+};
+
+/** An arena hands out memory from large blocks. Allocations are
+ * never freed individually; the whole arena is cleared or freed at
+ * once.
+ */
+typedef struct rq_arena {
+    struct rq_arena_block *blocks; /**< the block being allocated from is first */
+    size_t block_size;
+    size_t bytes_allocated; /**< the total of the sizes asked for */
+} *rq_arena_t;
+
+/** Allocate an empty arena.
+ *
+ * @param block_size the size of the blocks to allocate, or 0 for
+ * RQ_ARENA_DEFAULT_BLOCK_SIZE
+ */
+RQ_EXPORT rq_arena_t rq_arena_alloc(size_t block_size);
+
+/** Free the arena and everything allocated from it.
+ */
+RQ_EXPORT void rq_arena_free(rq_arena_t arena);
+
+/** Release everything allocated from the arena, keeping one block
+ * for reuse.
+ */
+RQ_EXPORT void rq_arena_clear(rq_arena_t arena);
+
+/** Allocate size bytes from the arena.
+ */
+RQ_EXPORT void *rq_arena_malloc(rq_arena_t arena, size_t size);
+
+/** Allocate zeroed memory for n objects of size bytes from the arena.
+ */
+RQ_EXPORT void *rq_arena_calloc(rq_arena_t arena, size_t n, size_t size);
+
+/** Copy a string into the arena. Returns NULL if s is NULL.
+ */
+RQ_EXPORT char *rq_arena_strdup(rq_arena_t arena, const char *s);
+
+#ifdef __cplusplus
+#if 0
+{ // purely to not screw up my indenting...
+#endif
+};
+#endif
+
+#endif
@@ -91,7 +91,7 @@ grow_if_necessary(struct rq_array_double *v)
 {
     if (v->size == v->max - 1)
     {
-        v->array = realloc(
+        v->array = RQ_REALLOC(
             v->array, 
             (v->max + v->grow_size) * sizeof(double)
             );
@@ -123,7 +123,7 @@ rq_array_double_set_at(rq_array_double_t v, unsigned long offset, double num)
                 new_max += (v->grow_size * (num + 1));
             }
 
-            v->array = realloc(
+            v->array = RQ_REALLOC(
                 v->array, 
                 new_max * sizeof(double)
                 );
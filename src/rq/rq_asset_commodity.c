@@ -32,16 +32,16 @@ void
 rq_asset_commodity_freefunc(void *d)
 {
     struct rq_asset_commodity *c = (struct rq_asset_commodity *)d;
-	if (c->long_name) free((char *)c->long_name);
-    if (c->type) free((char *)c->type);
-    if (c->grade) free((char *)c->grade);
-    if (c->location) free((char *)c->location);
-    if (c->location_center) free((char *)c->location_center);
+	if (c->long_name) RQ_FREE((char *)c->long_name);
+    if (c->type) RQ_FREE((char *)c->type);
+    if (c->grade) RQ_FREE((char *)c->grade);
+    if (c->location) RQ_FREE((char *)c->location);
+    if (c->location_center) RQ_FREE((char *)c->location_center);
 	
-    if (c->currency) free((char *)c->currency);
-    if (c->unit) free((char *)c->unit);
+    if (c->currency) RQ_FREE((char *)c->currency);
+    if (c->unit) RQ_FREE((char *)c->unit);
 
-    free(c);
+    RQ_FREE(c);
 }
 
 RQ_EXPORT rq_asset_t
@@ -57,7 +57,7 @@ rq_asset_commodity_build(
     double unit_multiplier
     )
 {
-    struct rq_asset_commodity *c = (struct rq_asset_commodity *)calloc(
+    struct rq_asset_commodity *c = (struct rq_asset_commodity *)RQ_CALLOC(
         1, 
         sizeof(struct rq_asset_commodity)
         );
@@ -68,13 +68,13 @@ rq_asset_commodity_build(
         rq_asset_commodity_freefunc
         );
 
-    if (long_name) c->long_name = strdup(long_name);
-    if (type) c->type = strdup(type);
-    if (grade) c->grade = strdup(grade);
-    if (location) c->location = strdup(location);
-    if (location_center) c->location_center = strdup(location_center);
-    if (currency) c->currency = strdup(currency);
-    if (unit) c->unit = strdup(unit);
+    if (long_name) c->long_name = RQ_STRDUP(long_name);
+    if (type) c->type = RQ_STRDUP(type);
+    if (grade) c->grade = RQ_STRDUP(grade);
+    if (location) c->location = RQ_STRDUP(location);
+    if (location_center) c->location_center = RQ_STRDUP(location_center);
+    if (currency) c->currency = RQ_STRDUP(currency);
+    if (unit) c->unit = RQ_STRDUP(unit);
     c->unit_multiplier = unit_multiplier;
 
     return asset;
@@ -28,14 +28,38 @@
 #include <stdlib.h>
 #include <string.h>
 
+/* The Higham algorithm parameters used when repairing a matrix */
+#define RQ_CORRELATION_REPAIR_TOLERANCE 1e-10
+#define RQ_CORRELATION_REPAIR_MAX_ITERATIONS 200
 
 /* -- code -------------------------------------------------------- */
+static void
+correlation_matrix_free(rq_asset_correlation_matrix_t cm)
+{
+    RQ_FREE(cm->key);
+    rq_matrix_free(cm->correlation);
+    rq_matrix_free(cm->cholesky);
+    rq_matrix_free(cm->eigenvectors);
+    RQ_FREE(cm->eigenvalues);
+    RQ_FREE(cm);
+}
+
+static rq_tree_rb_t
+matrix_cache_alloc()
+{
+    return rq_tree_rb_alloc(
+        (void (*)(void *))correlation_matrix_free, 
+        (int (*)(const void *, const void *))strcmp
+        );
+}
 
 RQ_EXPORT rq_asset_correlation_mgr_t 
 rq_asset_correlation_mgr_clone(rq_asset_correlation_mgr_t m)
 {
     struct rq_asset_correlation_mgr* cm = (struct rq_asset_correlation_mgr *)RQ_MALLOC(sizeof(struct rq_asset_correlation_mgr));
     cm->tree = rq_tree_rb_clone(m->tree, (const void *(*)(const void *))rq_asset_correlation_get_key, (void *(*)(const void *))rq_asset_correlation_clone);
+    cm->matrix_cache = matrix_cache_alloc();
+    cm->matrix_cache_mutex = rq_mutex_alloc();
 
     return cm;
 }
@@ -48,12 +72,16 @@ rq_asset_correlation_mgr_alloc()
         (void (*)(void *))rq_asset_correlation_free, 
         (int (*)(const void *, const void *))strcmp
         );
+    mgr->matrix_cache = matrix_cache_alloc();
+    mgr->matrix_cache_mutex = rq_mutex_alloc();
     return mgr;
 }
 
 RQ_EXPORT void 
 rq_asset_correlation_mgr_free(rq_asset_correlation_mgr_t m)
 {
+    rq_tree_rb_free(m->matrix_cache);
+    rq_mutex_free(m->matrix_cache_mutex);
     rq_tree_rb_free(m->tree);
     RQ_FREE(m);
 }
@@ -61,9 +89,18 @@ rq_asset_correlation_mgr_free(rq_asset_correlation_mgr_t m)
 RQ_EXPORT void 
 rq_asset_correlation_mgr_clear(rq_asset_correlation_mgr_t m)
 {
+    rq_asset_correlation_mgr_invalidate(m);
     rq_tree_rb_clear(m->tree);
 }
 
+RQ_EXPORT void
+rq_asset_correlation_mgr_invalidate(rq_asset_correlation_mgr_t m)
+{
+    rq_mutex_lock(m->matrix_cache_mutex);
+    rq_tree_rb_clear(m->matrix_cache);
+    rq_mutex_unlock(m->matrix_cache_mutex);
+}
+
 RQ_EXPORT int 
 rq_asset_correlation_mgr_get_correlation(
     rq_asset_correlation_mgr_t m, 
@@ -108,6 +145,142 @@ rq_asset_correlation_mgr_add(
 {
     rq_asset_correlation_t er = rq_asset_correlation_build(asset1, asset2, correlation);
     rq_tree_rb_add(m->tree, (void *)rq_asset_correlation_get_key(er), er);
+
+    /* any cached matrices could include this pair */
+    rq_asset_correlation_mgr_invalidate(m);
+}
+
+RQ_EXPORT unsigned int
+rq_asset_correlation_mgr_build_matrix(
+    rq_asset_correlation_mgr_t m,
+    const char **asset_ids,
+    unsigned int num_assets,
+    rq_matrix_t out
+    )
+{
+    unsigned int num_missing = 0;
+    unsigned int i;
+
+    for (i = 0; i < num_assets; i++)
+    {
+        unsigned int j;
+
+        RQ_MATRIX_SET(out, i, i, 1.0);
+
+        for (j = i + 1; j < num_assets; j++)
+        {
+            double correlation;
+
+            if (rq_asset_correlation_mgr_get_correlation(m, asset_ids[i], asset_ids[j], &correlation))
+                num_missing++;
+
+            RQ_MATRIX_SET(out, i, j, correlation);
+            RQ_MATRIX_SET(out, j, i, correlation);
+        }
+    }
+
+    return num_missing;
+}
+
+static char *
+build_asset_set_key(const char **asset_ids, unsigned int num_assets)
+{
+    size_t len = 1;
+    char *key;
+    unsigned int i;
+
+    for (i = 0; i < num_assets; i++)
+        len += strlen(asset_ids[i]) + 1;
+
+    key = (char *)RQ_MALLOC(len);
+    key[0] = '\0';
+
+    for (i = 0; i < num_assets; i++)
+    {
+        if (i > 0)
+            strcat(key, "/");
+        strcat(key, asset_ids[i]);
+    }
+
+    return key;
+}
+
+static struct rq_asset_correlation_matrix *
+correlation_matrix_build(
+    rq_asset_correlation_mgr_t m,
+    char *key,
+    const char **asset_ids,
+    unsigned int num_assets
+    )
+{
+    struct rq_asset_correlation_matrix *cm = 
+        (struct rq_asset_correlation_matrix *)RQ_CALLOC(1, sizeof(struct rq_asset_correlation_matrix));
+
+    cm->key = key;
+    cm->num_assets = num_assets;
+    cm->correlation = rq_matrix_build(num_assets, num_assets);
+    cm->cholesky = rq_matrix_build(num_assets, num_assets);
+    cm->eigenvectors = rq_matrix_build(num_assets, num_assets);
+    cm->eigenvalues = (double *)RQ_CALLOC(num_assets + 1, sizeof(double));
+
+    /* the missing pairs are taken as uncorrelated, and counted for
+       the caller to decide about */
+    cm->num_missing = rq_asset_correlation_mgr_build_matrix(m, asset_ids, num_assets, cm->correlation);
+
+    if (rq_matrix_cholesky(cm->correlation, cm->cholesky) != 0)
+    {
+        /* market sourced pairwise correlations often aren't
+           consistent. Use the nearest valid correlation matrix. */
+        cm->repaired = 1;
+        rq_matrix_nearest_correlation(
+            cm->correlation, cm->correlation, 
+            RQ_CORRELATION_REPAIR_TOLERANCE, 
+            RQ_CORRELATION_REPAIR_MAX_ITERATIONS
+            );
+
+        if (rq_matrix_cholesky(cm->correlation, cm->cholesky) != 0)
+        {
+            correlation_matrix_free(cm);
+            return NULL;
+        }
+    }
+
+    memcpy(cm->eigenvectors->vals, cm->correlation->vals, sizeof(double) * num_assets * num_assets);
+    if (rq_matrix_eigen_symmetric(cm->eigenvectors, cm->eigenvalues) != 0)
+    {
+        correlation_matrix_free(cm);
+        return NULL;
+    }
+
+    return cm;
+}
+
+RQ_EXPORT rq_asset_correlation_matrix_t
+rq_asset_correlation_mgr_get_matrix(
+    rq_asset_correlation_mgr_t m,
+    const char **asset_ids,
+    unsigned int num_assets
+    )
+{
+    char *key = build_asset_set_key(asset_ids, num_assets);
+    struct rq_asset_correlation_matrix *cm;
+
+    rq_mutex_lock(m->matrix_cache_mutex);
+
+    cm = (struct rq_asset_correlation_matrix *)rq_tree_rb_find(m->matrix_cache, key);
+    if (cm)
+        RQ_FREE(key);
+    else
+    {
+        /* the key belongs to the matrix from here */
+        cm = correlation_matrix_build(m, key, asset_ids, num_assets);
+        if (cm)
+            rq_tree_rb_add(m->matrix_cache, cm->key, cm);
+    }
+
+    rq_mutex_unlock(m->matrix_cache_mutex);
+
+    return cm;
 }
 
 RQ_EXPORT int 
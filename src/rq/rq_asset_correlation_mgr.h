@@ -32,7 +32,9 @@
 #define rq_asset_correlation_mgr_h
 
 #include "rq_asset_correlation.h"
+#include "rq_matrix.h"
 #include "rq_tree_rb.h"
+#include "rq_mutex.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -41,8 +43,28 @@ extern "C" {
 #endif
 #endif
 
+/** The correlation matrix for an ordered set of assets, together
+ * with its factorizations. These are built on demand and cached by
+ * the asset correlation manager, so they must not be modified or
+ * freed by the caller. A matrix is freed when the cache is dropped,
+ * by rq_asset_correlation_mgr_add(), _clear(), _invalidate() or
+ * _free(), so it mustn't be used past any of those.
+ */
+typedef struct rq_asset_correlation_matrix {
+    char *key; /**< The asset ids, separated by '/' */
+    unsigned int num_assets;
+    unsigned int num_missing; /**< The pairs without a correlation, which were taken as 0.0 */
+    short repaired; /**< Non-zero if the pairwise correlations weren't positive definite and had to be adjusted */
+    rq_matrix_t correlation; /**< The (possibly repaired) correlation matrix */
+    rq_matrix_t cholesky; /**< The lower triangular cholesky factor */
+    rq_matrix_t eigenvectors; /**< The eigenvectors, stored in columns */
+    double *eigenvalues; /**< The eigenvalues, in ascending order */
+} * rq_asset_correlation_matrix_t;
+
 typedef struct rq_asset_correlation_mgr {
     rq_tree_rb_t tree;
+    rq_tree_rb_t matrix_cache; /**< rq_asset_correlation_matrix_t's keyed by asset set */
+    rq_mutex_t matrix_cache_mutex; /**< lets pricing threads share the matrix cache */
 } * rq_asset_correlation_mgr_t;
 
 typedef struct rq_asset_correlation_mgr_iterator {
@@ -68,7 +90,8 @@ RQ_EXPORT rq_asset_correlation_mgr_t rq_asset_correlation_mgr_clone(rq_asset_cor
 RQ_EXPORT void rq_asset_correlation_mgr_free(rq_asset_correlation_mgr_t asset_correlation_mgr);
 
 /**
- * Free the asset correlation managed by the asset correlation manager.
+ * Free the asset correlation managed by the asset correlation manager,
+ * and drop the cached correlation matrices.
  */
 RQ_EXPORT void rq_asset_correlation_mgr_clear(rq_asset_correlation_mgr_t asset_correlation_mgr);
 
@@ -86,7 +109,8 @@ rq_asset_correlation_mgr_get_correlation(
     );
 
 /**
- * Add an asset correlation to the manager
+ * Add an asset correlation to the manager, dropping the cached
+ * correlation matrices.
  */
 RQ_EXPORT void
 rq_asset_correlation_mgr_add(
@@ -96,6 +120,51 @@ rq_asset_correlation_mgr_add(
     double correlation
     );
 
+/**
+ * Fill out 'out' (which must be num_assets x num_assets) with the
+ * pairwise correlations between the assets. The diagonal is set to
+ * 1.0 and pairs without a correlation are set to 0.0.
+ *
+ * Returns the number of pairs that didn't have a correlation.
+ */
+RQ_EXPORT unsigned int
+rq_asset_correlation_mgr_build_matrix(
+    rq_asset_correlation_mgr_t m,
+    const char **asset_ids,
+    unsigned int num_assets,
+    rq_matrix_t out
+    );
+
+/**
+ * Get the correlation matrix and its factorizations for a set of
+ * assets.
+ *
+ * The first call for a given (ordered) set of assets builds the
+ * matrix from the pairwise correlations, repairs it to the nearest
+ * positive definite correlation matrix if the cholesky decomposition
+ * fails, and factorizes it. The result is cached, so that trades on
+ * the same basket share it, until the correlations in the manager
+ * change. The cache is locked, so this may be called from many
+ * threads at once, but the correlations mustn't be changed while
+ * any thread is still using a matrix it got.
+ *
+ * Pairs without a correlation are taken as uncorrelated rather than
+ * failing; num_missing in the result counts them.
+ *
+ * Returns NULL if the matrix couldn't be factorized.
+ */
+RQ_EXPORT rq_asset_correlation_matrix_t
+rq_asset_correlation_mgr_get_matrix(
+    rq_asset_correlation_mgr_t m,
+    const char **asset_ids,
+    unsigned int num_assets
+    );
+
+/**
+ * Drop all the cached correlation matrices.
+ */
+RQ_EXPORT void rq_asset_correlation_mgr_invalidate(rq_asset_correlation_mgr_t m);
+
 /**
  * Allocate an iterator that can iterator over the list of asset correlation
  */
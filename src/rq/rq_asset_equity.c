@@ -22,6 +22,7 @@
 ** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 */
 #include "rq_asset_equity.h"
+#include "rq_alloc.h"
 #include "rq_asset_mgr.h"
 #include "rq_date.h"
 #include "rq_array.h"
@@ -36,7 +37,7 @@ rq_asset_equity_alloc()
     struct rq_asset_equity *asset = 
         (struct rq_asset_equity *)RQ_CALLOC(1, sizeof(struct rq_asset_equity));
 
-    asset->known_dividends = rq_array_alloc(free);
+    asset->known_dividends = rq_array_alloc(rq_free_func);
 
     return asset;
 }
@@ -35,11 +35,11 @@ rq_asset_swaption_freefunc(void *d)
     if (c->option_tenor) rq_term_free(c->option_tenor);
     if (c->swap_tenor) rq_term_free(c->swap_tenor);
     if (c->frequency) rq_term_free(c->frequency);
-    if (c->calendar) free((char *)c->calendar);
-	if (c->benchmark) free((char *)c->benchmark);
-	if (c->currency) free((char *)c->currency);
+    if (c->calendar) RQ_FREE((char *)c->calendar);
+	if (c->benchmark) RQ_FREE((char *)c->benchmark);
+	if (c->currency) RQ_FREE((char *)c->currency);
 
-    free(c);
+    RQ_FREE(c);
 }
 
 RQ_EXPORT rq_asset_t
@@ -60,7 +60,7 @@ rq_asset_swaption_build(
 	double spread
     )
 {
-    struct rq_asset_swaption *c = (struct rq_asset_swaption *)calloc(
+    struct rq_asset_swaption *c = (struct rq_asset_swaption *)RQ_CALLOC(
         1, 
         sizeof(struct rq_asset_swaption)
         );
@@ -74,9 +74,9 @@ rq_asset_swaption_build(
     if (option_tenor) c->option_tenor = rq_term_clone(option_tenor);
     if (swap_tenor) c->swap_tenor = rq_term_clone(swap_tenor);
     if (frequency) c->frequency = rq_term_clone(frequency);
-    if (calendar) c->calendar = strdup(calendar);
-	if (benchmark) c->benchmark = strdup(benchmark);
-	if (currency) c->currency = strdup(currency);
+    if (calendar) c->calendar = RQ_STRDUP(calendar);
+	if (benchmark) c->benchmark = RQ_STRDUP(benchmark);
+	if (currency) c->currency = RQ_STRDUP(currency);
    
 	c->day_count = day_count;
     c->date_roll_convention = date_roll_convention;
@@ -22,6 +22,7 @@
 ** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 */
 #include "rq_bootstrap_adapter.h"
+#include "rq_instrument.h"
 #include <stdlib.h>
 #include <string.h>
 
@@ -77,7 +78,9 @@ rq_bootstrap_adapter_build(
     )
 {
     void *term_struct;
+    double begin = rq_instrument_timer_begin();
     term_struct = (*a->bootstrap_func)(a, curve_id, system, market);
+    rq_instrument_timer_end(RQ_INSTRUMENT_TIMER_BOOTSTRAP, begin);
     if (!RQ_IS_NULL(term_struct) && rq_bootstrap_adapter_get_termstruct_type(a) == RQ_TERMSTRUCT_TYPE_EXTERNAL)
     {
         /* external adapter cannot add itself to the manager, so needs
@@ -258,12 +258,12 @@ double** allocateDoubleMatrix(long RowStartIndex, long RowEndIndex, long ColStar
 	double **Matrix;
 
 	/* allocate pointers to rows */
-	Matrix = (double**)malloc((NumRows + 1) * sizeof(double*));
+	Matrix = (double**)RQ_MALLOC((NumRows + 1) * sizeof(double*));
 	Matrix += 1;
 	Matrix -= RowStartIndex;
 
 	/* allocate rows and set pointers to them */
-	Matrix[RowStartIndex] = (double*)malloc((NumRows * NumCols + 1) * sizeof(double));
+	Matrix[RowStartIndex] = (double*)RQ_MALLOC((NumRows * NumCols + 1) * sizeof(double));
 	Matrix[RowStartIndex] += 1;
 	Matrix[RowStartIndex] -= ColStartIndex;
 	for (i = RowStartIndex + 1; i <= RowEndIndex; i++)
@@ -275,8 +275,8 @@ double** allocateDoubleMatrix(long RowStartIndex, long RowEndIndex, long ColStar
 
 void deallocateDoubleMatrix(double **Matrix, long RowStartIndex, long RowEndIndex, long ColStartIndex, long ColEndIndex) 
 {
-	free(Matrix[RowStartIndex] + ColStartIndex - 1);
-	free(Matrix + RowStartIndex - 1);
+	RQ_FREE(Matrix[RowStartIndex] + ColStartIndex - 1);
+	RQ_FREE(Matrix + RowStartIndex - 1);
 }
 
 double
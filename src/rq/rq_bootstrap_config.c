@@ -25,7 +25,7 @@
 #include <stdlib.h>
 #include <string.h>
 
-static unsigned int s_max_rate_class_ids = 60;
+static const unsigned int s_max_rate_class_ids = 60;
 
 
 struct rq_bootstrap_config *
@@ -155,10 +155,10 @@ rq_bootstrap_config_add_rate_class_id(rq_bootstrap_config_t config, const char *
     if (config->num_rate_class_ids == config->max_rate_class_ids)
     {
         unsigned int new_max_rate_class_ids = config->max_rate_class_ids * 2;
-        config->rate_class_ids = realloc((char *)config->rate_class_ids, new_max_rate_class_ids * sizeof(const char *));
-        config->rate_class_offsets = realloc(config->rate_class_offsets, new_max_rate_class_ids * sizeof(long));
-        config->basis_points_to_add = realloc(config->basis_points_to_add, new_max_rate_class_ids * sizeof(double));
-        config->percentages_to_add = realloc(config->percentages_to_add, new_max_rate_class_ids * sizeof(double));
+        config->rate_class_ids = RQ_REALLOC((char *)config->rate_class_ids, new_max_rate_class_ids * sizeof(const char *));
+        config->rate_class_offsets = RQ_REALLOC(config->rate_class_offsets, new_max_rate_class_ids * sizeof(long));
+        config->basis_points_to_add = RQ_REALLOC(config->basis_points_to_add, new_max_rate_class_ids * sizeof(double));
+        config->percentages_to_add = RQ_REALLOC(config->percentages_to_add, new_max_rate_class_ids * sizeof(double));
         config->max_rate_class_ids = new_max_rate_class_ids;
     }
 
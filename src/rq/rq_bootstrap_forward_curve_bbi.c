@@ -48,7 +48,6 @@ rq_bootstrap_forward_curve_bbi(
 
 #ifdef DEBUG_BBI
     FILE* fh = NULL;
-    static int firstTime = 1;
 #endif
     unsigned int i = 0;
     int j = 0;
@@ -123,15 +122,13 @@ rq_bootstrap_forward_curve_bbi(
     }
 
 #ifdef DEBUG_BBI
-    if (firstTime != 0)
+    /* appended to, rather than truncated on the first call, so that
+       there is no state shared between bootstraps */
+    fh = fopen("..\\log\\Bootstrap_BBI.log", "a");
+    if (fh != NULL)
     {
-        fh = fopen("..\\log\\Bootstrap_BBI.log", "w");
-        if (fh != NULL)
-        {
-            rq_date_to_string(buf, "yyyy-mm-dd", date);
-            fprintf(fh, "The base date used is %s. Day Count Convention used is ACT/%d.\nThe %d cash rates:\n", buf, DAYS_PER_YEAR, MAX_CASH_RATE);
-            firstTime = 0;
-        }
+        rq_date_to_string(buf, "yyyy-mm-dd", date);
+        fprintf(fh, "The base date used is %s. Day Count Convention used is ACT/%d.\nThe %d cash rates:\n", buf, DAYS_PER_YEAR, MAX_CASH_RATE);
     }
 
     for (i=0; i<MAX_CASH_RATE && fh!= NULL; i++)
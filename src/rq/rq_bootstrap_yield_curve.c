@@ -237,7 +237,7 @@ bootstrapAssetIRDiscount(const rq_asset_t asset, const rq_rate_t rate, rq_date*
                                                    cals,
 	                                               numCals);
 
-    dayCountFrac = rq_day_count_get_year_fraction(rq_asset_irdiscount_get_day_count_convention(asset),
+    dayCountFrac = rq_yield_curve_get_year_fraction(ts, rq_asset_irdiscount_get_day_count_convention(asset),
                                                   startDate,
                                                   maturityDate);
 
@@ -331,7 +331,8 @@ bootstrapAssetIRFutureStrip(const rq_asset_t asset, const rq_rate_t rate, rq_dat
         enum rq_ir_future_quote_convention lastFutureQuoteConv = rq_asset_irfuture_get_quote_convention(lastAsset);
         lastFutureMaturityDate = rq_asset_irfuture_get_settlement_date(lastAsset);
 
-        tau = rq_day_count_get_year_fraction(
+        tau = rq_yield_curve_get_year_fraction(
+            ts,
             rq_asset_irfuture_get_day_count_convention(lastAsset),
             lastFutureMaturityDate,
             futureMaturityDate);
@@ -389,7 +390,8 @@ bootstrapAssetIRFutureTenor(const rq_asset_t asset, const rq_rate_t rate, rq_dat
             break;
 		}
     // 		=dfa/(1+0.01*(100-Fa)*(xb-xa))
-		tau = rq_day_count_get_year_fraction(
+		tau = rq_yield_curve_get_year_fraction(
+			ts,
 			rq_asset_irfuture_get_day_count_convention(asset),
         startDate,
         maturityDate);
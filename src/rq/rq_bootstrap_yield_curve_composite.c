@@ -81,6 +81,7 @@ rq_bootstrap_yield_curve_composite(
 				rq_bootstrap_config_get_default_day_count_convention(config),
                 rq_market_get_market_date(market)
                 );
+            rq_yield_curve_set_day_count_calendar(yc, rq_yield_curve_get_day_count_calendar(base_curve));
 
             underlying_asset_id = rq_bootstrap_config_get_asset_id(config);
             if (underlying_asset_id)
@@ -322,6 +322,7 @@ rq_bootstrap_yield_curve_cubic_spline(
 		rq_bootstrap_config_get_default_day_count_convention(config),
         date
         );
+    rq_yield_curve_set_day_count_calendar(ts, cal);
 
     underlying_asset_id = rq_bootstrap_config_get_asset_id(config);
     if (underlying_asset_id)
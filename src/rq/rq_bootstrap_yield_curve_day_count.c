@@ -35,6 +35,7 @@
 #include "rq_defs.h"
 #include "rq_interpolate.h"
 #include "rq_day_count.h"
+#include "rq_schedule_cache.h"
 #include "rq_vector.h"
 #include <stdlib.h>
 #include <string.h>
@@ -51,7 +52,7 @@
 static void
 _rq_yc_day_count_mgr_free_func(void *p)
 {
-    free(p);
+    RQ_FREE(p);
 }
 
 static int
@@ -151,7 +152,7 @@ bootstrapParDCF(const rq_asset_t asset,
         fromDate = rq_rate_get_value_date(lastRate);
     }
 
-    day_count_frac = rq_day_count_get_year_fraction(rq_asset_irdiscount_get_day_count_convention(asset),
+    day_count_frac = rq_yield_curve_get_year_fraction(ts, rq_asset_irdiscount_get_day_count_convention(asset),
                                                     fromDate,
                                                     maturityDate);
 
@@ -197,8 +198,8 @@ static int rq_generate_swap_splines(enum rq_swapParInterpolation_method parInter
             splineX[j+1] = dates[j+1];
             if(!simple_daycount)
             {
-                year_count_frac = rq_day_count_get_year_fraction(day_count, dates[j], dates[j+1]);
-                splineX[j+1] = rq_day_count_get_year_fraction(day_count, start_date, (rq_date)splineX[j+1]);
+                year_count_frac = rq_yield_curve_get_year_fraction(ts, day_count, dates[j], dates[j+1]);
+                splineX[j+1] = rq_yield_curve_get_year_fraction(ts, day_count, start_date, (rq_date)splineX[j+1]);
             }
             sum_dfs += df * year_count_frac;
             splineY[j+1] = (1.0 - df / dfStart) / (sum_dfs / dfStart); // Par rate
@@ -233,7 +234,7 @@ static int rq_generate_swap_splines(enum rq_swapParInterpolation_method parInter
                 cals,
                 num_cals);
             if(!simple_daycount)
-                splineX[j+1] = rq_day_count_get_year_fraction(day_count, start_date, (rq_date)splineX[j+1]);
+                splineX[j+1] = rq_yield_curve_get_year_fraction(ts, day_count, start_date, (rq_date)splineX[j+1]);
             splineY[j+1] = rq_rate_get_value(splineSwapRates[swap_i]);
             swap_i++;
 			passed_last_date = 1;
@@ -350,20 +351,43 @@ processSwapsDCF(const rq_asset_t asset,
         num_cals
         );
 
-    num_dates = rq_date_roll_generate_dates(
-        dates,
-        RQ_YIELD_CURVE_MAX_FACTORS,
-        start_date,
-        lastDateStrapped,
-        rq_asset_irswap_get_frequency(asset),
-        RQ_ROLL_CONVENTION_NONE,
-        rq_asset_irswap_get_date_roll_convention(asset),
-        cals,
-        num_cals,
-        RQ_DATE_ROLL_STUB_POSITION_NONE,
-        15, /* allow 15 days error on date creation */
-		NULL
-        );
+    if (calendar_mgr && rq_asset_irswap_get_frequency(asset))
+    {
+        /* swaps on the same curve usually share their roll dates, so
+           take them from the schedule cache */
+        struct rq_schedule_params params;
+        rq_schedule_t schedule;
+
+        rq_schedule_params_init(&params);
+        params.start_date = start_date;
+        params.end_date = lastDateStrapped;
+        rq_term_copy(&params.term, rq_asset_irswap_get_frequency(asset));
+        params.date_roll_convention = rq_asset_irswap_get_date_roll_convention(asset);
+        params.day_count_convention = day_count;
+        rq_schedule_params_set_calendars(&params, cals, (unsigned short)num_cals);
+
+        schedule = rq_schedule_cache_get(rq_calendar_mgr_get_schedule_cache(calendar_mgr), &params);
+        num_dates = rq_schedule_get_num_dates(schedule);
+        if (num_dates > RQ_YIELD_CURVE_MAX_FACTORS - 1)
+            num_dates = RQ_YIELD_CURVE_MAX_FACTORS - 1;
+        memcpy(dates, rq_schedule_get_dates(schedule), num_dates * sizeof(rq_date));
+        rq_schedule_free(schedule);
+    }
+    else
+        num_dates = rq_date_roll_generate_dates(
+            dates,
+            RQ_YIELD_CURVE_MAX_FACTORS,
+            start_date,
+            lastDateStrapped,
+            rq_asset_irswap_get_frequency(asset),
+            RQ_ROLL_CONVENTION_NONE,
+            rq_asset_irswap_get_date_roll_convention(asset),
+            cals,
+            num_cals,
+            RQ_DATE_ROLL_STUB_POSITION_NONE,
+            15, /* allow 15 days error on date creation */
+            NULL
+            );
 
     /* ignore the first date */
     num_discount_factors = (unsigned short)(num_dates - 2);
@@ -375,7 +399,11 @@ processSwapsDCF(const rq_asset_t asset,
 		char buf[64];
 		time_t ltime;
 		time( &ltime );
+#ifdef WIN32
 		ctime_s(buf, 64, &ltime);
+#else
+		ctime_r(&ltime, buf);
+#endif
 		fprintf(debug_fp, "%s : START bootstrapSwapAsset() ", buf);
 		fprintf(debug_fp, "curve_id: %s asset_id: %s date: %s\n", rq_yield_curve_get_curve_id(ts), 
 			rq_asset_get_asset_id(asset), rq_date_to_string(buf, "yyyymmdd", lastDateStrapped));
@@ -418,7 +446,7 @@ processSwapsDCF(const rq_asset_t asset,
 				{
 					// First roll point is at ts->from_date so no par rate can be computed. Use first df point to calculate.
 					df = ts->discount_factors[0].discount_factor;
-					par_rate_prev = (1.0 - df) / (df * rq_day_count_get_year_fraction(day_count, ts->from_date, ts->discount_factors[0].date));
+					par_rate_prev = (1.0 - df) / (df * rq_yield_curve_get_year_fraction(ts, day_count, ts->from_date, ts->discount_factors[0].date));
 				}
 				else
 					par_rate_prev = (1.0 - last_df / dfStart) / (sum_dfs / dfStart);
@@ -445,11 +473,11 @@ processSwapsDCF(const rq_asset_t asset,
                 /* This is inconsistent with the sum_df and will be raised a separate issue. For now no change to the functionality. Forge reference is: 178664 Enhanced bootstrap algorithm for swap. */
                 /* Also in the forge case the example spreadsheet and spec differ, Spreadsheet uses start_date difference, spec uses relative dcf. */
 
-                x2 = rq_day_count_get_year_fraction(day_count, start_date, lastDateStrapped);
-                x1 = rq_day_count_get_year_fraction(day_count, start_date, date_prev);
-                x = rq_day_count_get_year_fraction(day_count, start_date, dates[j+1]);
-                year_count_frac = rq_day_count_get_year_fraction(day_count, start_date, dates[j+1])
-                                - rq_day_count_get_year_fraction(day_count, start_date, dates[j]);
+                x2 = rq_yield_curve_get_year_fraction(ts, day_count, start_date, lastDateStrapped);
+                x1 = rq_yield_curve_get_year_fraction(ts, day_count, start_date, date_prev);
+                x = rq_yield_curve_get_year_fraction(ts, day_count, start_date, dates[j+1]);
+                year_count_frac = rq_yield_curve_get_year_fraction(ts, day_count, start_date, dates[j+1])
+                                - rq_yield_curve_get_year_fraction(ts, day_count, start_date, dates[j]);
             }
 
 			// ts->num_factors == 0 special case only swap points in curve so interpolation is not possible.
@@ -460,7 +488,7 @@ processSwapsDCF(const rq_asset_t asset,
 				// We also need to define dfStart or this will always be 1.
 				if(start_date > ts->from_date)
 				{
-					dfStart = 1.0 / (1 + r * rq_day_count_get_year_fraction(day_count, ts->from_date, start_date));
+					dfStart = 1.0 / (1 + r * rq_yield_curve_get_year_fraction(ts, day_count, ts->from_date, start_date));
 					// And also add it into the curve.
 					setDiscountFactor(ts, start_date, dfStart);
 				}
@@ -485,13 +513,13 @@ processSwapsDCF(const rq_asset_t asset,
         if(simple_daycount)
             sum_dfs += df * swap_period;
         else
-            sum_dfs += df * rq_day_count_get_year_fraction(day_count, dates[j], dates[j+1]);
+            sum_dfs += df * rq_yield_curve_get_year_fraction(ts, day_count, dates[j], dates[j+1]);
         last_df = df;
     }
 
     if(!simple_daycount)
-        year_count_frac = rq_day_count_get_year_fraction(day_count, start_date, dates[num_discount_factors+1])
-                        - rq_day_count_get_year_fraction(day_count, start_date, dates[num_discount_factors]);
+        year_count_frac = rq_yield_curve_get_year_fraction(ts, day_count, start_date, dates[num_discount_factors+1])
+                        - rq_yield_curve_get_year_fraction(ts, day_count, start_date, dates[num_discount_factors]);
     df = (dfStart - sum_dfs * r) / (1 + r * year_count_frac);
 
     setDiscountFactor(ts, lastDateStrapped, df);
@@ -505,7 +533,11 @@ processSwapsDCF(const rq_asset_t asset,
 		char buf[64];
 		time_t ltime;
 		time( &ltime );
+#ifdef WIN32
 		ctime_s(buf, 64, &ltime);
+#else
+		ctime_r(&ltime, buf);
+#endif
 		fprintf(debug_fp, "%s : END bootstrapSwapAsset() ", buf);
 		fprintf(debug_fp, "curve_id: %s asset_id: %s\n\n",
 			rq_yield_curve_get_curve_id(ts), rq_asset_get_asset_id(asset));
@@ -594,6 +626,7 @@ rq_bootstrap_yield_curve_day_count(
 		rq_bootstrap_config_get_default_day_count_convention(config),
         date
         );
+    rq_yield_curve_set_day_count_calendar(ts, cal);
 	rq_yield_curve_set_debug_filename(ts, debug_filename);
 
     underlying_asset_id = rq_bootstrap_config_get_asset_id(config);
@@ -219,6 +219,7 @@ rq_bootstrap_yield_curve_spread(
 		rq_bootstrap_config_get_default_day_count_convention(config),
         date
         );
+    rq_yield_curve_set_day_count_calendar(ts, cal);
     underlying_asset_id = rq_bootstrap_config_get_asset_id(config);
     if (underlying_asset_id)
         rq_yield_curve_set_underlying_asset_id(ts, underlying_asset_id);
@@ -22,12 +22,13 @@
 ** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 */
 #include "rq_business_centers.h"
+#include "rq_alloc.h"
 #include <stdlib.h>
 
 RQ_EXPORT void
 rq_business_centers_init(struct rq_business_centers *p)
 {
-    p->business_center_list = rq_array_alloc(free);
+    p->business_center_list = rq_array_alloc(rq_free_func);
 }
 
 RQ_EXPORT void
@@ -29,8 +29,32 @@
 #include "rq_object_schema_node.h"
 #include "rq_error.h"
 #include "rq_dom_parser.h"
+#include "rq_alloc.h"
 
-static unsigned short s_growth_factor = 40;
+static const unsigned short s_growth_factor = 40;
+
+/* The number of 32 bit words in the compiled bitmap, including a
+   trailing zero word so that a rank can be taken one past the end of
+   the horizon. */
+static unsigned long
+num_bitmap_words(const struct rq_calendar *cal)
+{
+    return (unsigned long)(cal->horizon_end - cal->horizon_start + 1) / 32 + 1;
+}
+
+static void
+discard_compiled(struct rq_calendar *cal)
+{
+    if (cal->good_days)
+    {
+        RQ_FREE(cal->good_days);
+        RQ_FREE(cal->prefix_counts);
+        cal->good_days = NULL;
+        cal->prefix_counts = NULL;
+    }
+    cal->horizon_start = 0;
+    cal->horizon_end = -1;
+}
 
 RQ_EXPORT rq_calendar_t 
 rq_calendar_alloc(const char *id)
@@ -48,6 +72,11 @@ rq_calendar_alloc(const char *id)
     cal->calendar_type = RQ_CALENDAR_TYPE_BASE;
     cal->num_composites = 0;
     memset(cal->base_calendars, '\0', sizeof(struct rq_calendar *) * MAX_COMPOSITE_CALENDAR_SIZE);
+
+    cal->horizon_start = 0;
+    cal->horizon_end = -1;
+    cal->good_days = NULL;
+    cal->prefix_counts = NULL;
     
     return cal;
 }
@@ -59,6 +88,10 @@ rq_calendar_free(rq_calendar_t cal)
         RQ_FREE((char *)cal->id);
 
     RQ_FREE(cal->date_events);
+    if (cal->good_days)
+        RQ_FREE(cal->good_days);
+    if (cal->prefix_counts)
+        RQ_FREE(cal->prefix_counts);
     RQ_FREE(cal);
 }
 
@@ -74,6 +107,25 @@ rq_calendar_clone(rq_calendar_t cal)
     clone->date_events = RQ_MALLOC(clone->max_date_events * sizeof(struct rq_date_event));
     memcpy(clone->date_events, cal->date_events, cal->num_date_events * sizeof(struct rq_date_event));
 
+    clone->weekend_mask = cal->weekend_mask;
+    clone->calendar_type = cal->calendar_type;
+    clone->num_composites = cal->num_composites;
+    memcpy(clone->base_calendars, cal->base_calendars, sizeof(struct rq_calendar *) * MAX_COMPOSITE_CALENDAR_SIZE);
+
+    clone->horizon_start = cal->horizon_start;
+    clone->horizon_end = cal->horizon_end;
+    clone->good_days = NULL;
+    clone->prefix_counts = NULL;
+    if (cal->good_days)
+    {
+        unsigned long num_words = num_bitmap_words(cal);
+
+        clone->good_days = (unsigned int *)RQ_MALLOC(num_words * sizeof(unsigned int));
+        memcpy(clone->good_days, cal->good_days, num_words * sizeof(unsigned int));
+        clone->prefix_counts = (unsigned long *)RQ_MALLOC(num_words * sizeof(unsigned long));
+        memcpy(clone->prefix_counts, cal->prefix_counts, num_words * sizeof(unsigned long));
+    }
+
     return clone;
 }
 
@@ -101,6 +153,8 @@ rq_calendar_find_date_event(const struct rq_calendar *cal, rq_date date, int *lb
 RQ_EXPORT void 
 rq_calendar_add_event(rq_calendar_t cal, rq_date date, long event_mask)
 {
+    discard_compiled(cal);
+
     if (cal->num_date_events == 0)
     {
         cal->date_events[0].date = date;
@@ -218,7 +272,7 @@ rq_calendar_is_null(rq_calendar_t obj)
 /* -- object schema support -- */
 struct _date_event {
     rq_date date;
-    short eventtype;
+    long eventtype;
 };
 
 static void *
@@ -315,7 +369,7 @@ rq_calendar_init_object_schemas(rq_object_schema_mgr_t schema_mgr)
     rq_object_schema_t dateevent_schema = rq_object_schema_alloc(
         "DateEvent",
         rq_dateevent_constructor,
-        free,
+        rq_free_func,
         rq_dateevent_cloner,
         dateevent_set_value_string,
         NULL,
@@ -360,17 +414,87 @@ rq_calendar_is_weekend(const rq_calendar_t cal, rq_date date)
     return is_weekend;
 }
 
+/* Evaluate a date by searching the date events, as opposed to using
+   the compiled bitmap. */
+static short
+is_good_date_uncompiled(const rq_calendar_t cal, rq_date date)
+{
+    if (cal->calendar_type == RQ_CALENDAR_TYPE_COMPOSITE)
+    {
+        unsigned int i;
+
+        for (i = 0; i < cal->num_composites; i++)
+            if (!rq_calendar_is_good_date(cal->base_calendars[i], date))
+                return 0;
+        return 1;
+    }
+
+    return !rq_calendar_is_weekend(cal, date) && !rq_calendar_is_holiday(cal, date);
+}
+
+#define IN_HORIZON(cal, date) ((cal)->good_days && (date) >= (cal)->horizon_start && (date) <= (cal)->horizon_end)
+
+static unsigned int
+popcount32(unsigned int v)
+{
+    v = v - ((v >> 1) & 0x55555555U);
+    v = (v & 0x33333333U) + ((v >> 2) & 0x33333333U);
+    return (((v + (v >> 4)) & 0x0F0F0F0FU) * 0x01010101U) >> 24;
+}
+
+static const unsigned char debruijn_bit_pos[32] = {
+    0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8, 
+    31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9
+};
+
+/* The position of the lowest set bit in a non-zero word. */
+static unsigned int
+lowest_bit32(unsigned int v)
+{
+    return debruijn_bit_pos[((v & (0U - v)) * 0x077CB531U) >> 27];
+}
+
+/* The position of the highest set bit in a non-zero word. */
+static unsigned int
+highest_bit32(unsigned int v)
+{
+    v |= v >> 1;
+    v |= v >> 2;
+    v |= v >> 4;
+    v |= v >> 8;
+    v |= v >> 16;
+    return lowest_bit32(v ^ (v >> 1));
+}
+
+/* The number of good dates in the horizon before bit offset i. */
+static unsigned long
+compiled_rank(const struct rq_calendar *cal, unsigned long i)
+{
+    unsigned long w = i >> 5;
+    unsigned int bit = (unsigned int)(i & 31);
+    unsigned int mask = (bit ? (0xFFFFFFFFU >> (32 - bit)) : 0U);
+
+    return cal->prefix_counts[w] + popcount32(cal->good_days[w] & mask);
+}
+
 RQ_EXPORT short
 rq_calendar_is_good_date(const rq_calendar_t cal, rq_date date)
 {
     if (!rq_calendar_is_null(cal))
-        return !rq_calendar_is_weekend(cal, date) && !rq_calendar_is_holiday(cal, date);
+    {
+        if (IN_HORIZON(cal, date))
+        {
+            unsigned long i = (unsigned long)(date - cal->horizon_start);
+            return (cal->good_days[i >> 5] >> (i & 31)) & 1;
+        }
+        return is_good_date_uncompiled(cal, date);
+    }
     else
         return !rq_date_is_weekend(date);
 }
 
-RQ_EXPORT long 
-rq_calendar_businessday_count(const rq_calendar_t cal, rq_date from_date, rq_date to_date)
+static long
+businessday_count_uncompiled(const rq_calendar_t cal, rq_date from_date, rq_date to_date)
 {
 	long count = 0;
 
@@ -382,6 +506,227 @@ rq_calendar_businessday_count(const rq_calendar_t cal, rq_date from_date, rq_dat
 	return count;
 }
 
+RQ_EXPORT long 
+rq_calendar_businessday_count(const rq_calendar_t cal, rq_date from_date, rq_date to_date)
+{
+    long count = 0;
+
+    if (from_date > to_date)
+        return 0;
+
+    if (rq_calendar_is_null(cal) || !cal->good_days ||
+        to_date < cal->horizon_start || from_date > cal->horizon_end)
+        return businessday_count_uncompiled(cal, from_date, to_date);
+
+    /* the parts of the range that hang outside the horizon */
+    if (from_date < cal->horizon_start)
+    {
+        count += businessday_count_uncompiled(cal, from_date, cal->horizon_start - 1);
+        from_date = cal->horizon_start;
+    }
+    if (to_date > cal->horizon_end)
+    {
+        count += businessday_count_uncompiled(cal, cal->horizon_end + 1, to_date);
+        to_date = cal->horizon_end;
+    }
+
+    count += (long)(compiled_rank(cal, (unsigned long)(to_date - cal->horizon_start + 1)) -
+                    compiled_rank(cal, (unsigned long)(from_date - cal->horizon_start)));
+
+    return count;
+}
+
+RQ_EXPORT rq_date
+rq_calendar_next_good_date(const rq_calendar_t cal, rq_date date)
+{
+    date++;
+
+    if (!rq_calendar_is_null(cal) && IN_HORIZON(cal, date))
+    {
+        unsigned long i = (unsigned long)(date - cal->horizon_start);
+        unsigned long w = i >> 5;
+        unsigned long num_words = num_bitmap_words(cal);
+        unsigned int word = cal->good_days[w] & (0xFFFFFFFFU << (i & 31));
+
+        while (!word && ++w < num_words)
+            word = cal->good_days[w];
+
+        if (word)
+            return cal->horizon_start + (rq_date)(w * 32 + lowest_bit32(word));
+
+        /* no good dates left in the horizon */
+        date = cal->horizon_end + 1;
+    }
+
+    while (!rq_calendar_is_good_date(cal, date))
+        date++;
+
+    return date;
+}
+
+RQ_EXPORT rq_date
+rq_calendar_prev_good_date(const rq_calendar_t cal, rq_date date)
+{
+    date--;
+
+    if (!rq_calendar_is_null(cal) && IN_HORIZON(cal, date))
+    {
+        unsigned long i = (unsigned long)(date - cal->horizon_start);
+        unsigned long w = i >> 5;
+        unsigned int word = cal->good_days[w] & (0xFFFFFFFFU >> (31 - (i & 31)));
+
+        while (!word && w > 0)
+            word = cal->good_days[--w];
+
+        if (word)
+            return cal->horizon_start + (rq_date)(w * 32 + highest_bit32(word));
+
+        date = cal->horizon_start - 1;
+    }
+
+    while (!rq_calendar_is_good_date(cal, date))
+        date--;
+
+    return date;
+}
+
+RQ_EXPORT short
+rq_calendar_compile(rq_calendar_t cal, rq_date horizon_start, rq_date horizon_end)
+{
+    unsigned long num_words;
+    unsigned long w;
+    unsigned long count;
+    rq_date d;
+
+    if (horizon_end < horizon_start)
+        return 1;
+
+    discard_compiled(cal);
+
+    /* evaluate the good dates before the horizon is set, so that
+       is_good_date goes the slow way */
+    num_words = (unsigned long)(horizon_end - horizon_start + 1) / 32 + 1;
+    cal->good_days = (unsigned int *)RQ_CALLOC(num_words, sizeof(unsigned int));
+    cal->prefix_counts = (unsigned long *)RQ_MALLOC(num_words * sizeof(unsigned long));
+
+    if (cal->calendar_type == RQ_CALENDAR_TYPE_COMPOSITE && cal->num_composites > 0)
+    {
+        unsigned int c;
+
+        /* AND together the base calendars, going via their own
+           bitmaps where they are compiled over this horizon */
+        for (w = 0; w < num_words; w++)
+            cal->good_days[w] = 0xFFFFFFFFU;
+
+        for (c = 0; c < cal->num_composites; c++)
+        {
+            const rq_calendar_t base = cal->base_calendars[c];
+
+            if (base->good_days && 
+                base->horizon_start == horizon_start && 
+                base->horizon_end == horizon_end)
+            {
+                for (w = 0; w < num_words; w++)
+                    cal->good_days[w] &= base->good_days[w];
+            }
+            else
+            {
+                for (d = horizon_start; d <= horizon_end; d++)
+                {
+                    unsigned long i = (unsigned long)(d - horizon_start);
+                    if (!rq_calendar_is_good_date(base, d))
+                        cal->good_days[i >> 5] &= ~(1U << (i & 31));
+                }
+            }
+        }
+
+        /* clear the bits past the end of the horizon */
+        w = (unsigned long)(horizon_end - horizon_start + 1);
+        cal->good_days[w >> 5] &= ((w & 31) ? (0xFFFFFFFFU >> (32 - (w & 31))) : 0U);
+        for (w = (w >> 5) + 1; w < num_words; w++)
+            cal->good_days[w] = 0;
+    }
+    else
+    {
+        for (d = horizon_start; d <= horizon_end; d++)
+        {
+            unsigned long i = (unsigned long)(d - horizon_start);
+            if (is_good_date_uncompiled(cal, d))
+                cal->good_days[i >> 5] |= (1U << (i & 31));
+        }
+    }
+
+    count = 0;
+    for (w = 0; w < num_words; w++)
+    {
+        cal->prefix_counts[w] = count;
+        count += popcount32(cal->good_days[w]);
+    }
+
+    cal->horizon_start = horizon_start;
+    cal->horizon_end = horizon_end;
+
+    return 0;
+}
+
+RQ_EXPORT short
+rq_calendar_is_compiled(const rq_calendar_t cal)
+{
+    return cal->good_days != NULL;
+}
+
+RQ_EXPORT rq_calendar_t
+rq_calendar_alloc_joint(
+    const char *id, 
+    const rq_calendar_t *cals,
+    unsigned short num_cals,
+    rq_date horizon_start,
+    rq_date horizon_end
+    )
+{
+    rq_calendar_t cal;
+    unsigned short i;
+
+    if (num_cals > MAX_COMPOSITE_CALENDAR_SIZE)
+        return NULL;
+
+    cal = rq_calendar_alloc(id);
+    cal->calendar_type = RQ_CALENDAR_TYPE_COMPOSITE;
+    cal->num_composites = num_cals;
+    for (i = 0; i < num_cals; i++)
+        cal->base_calendars[i] = cals[i];
+
+    rq_calendar_compile(cal, horizon_start, horizon_end);
+
+    return cal;
+}
+
+/* As rq_date_to_string(buf, "yyyy-mm-dd", date), without the
+   sprintf()s. */
+static const char *
+format_iso_date(char *buf, rq_date date)
+{
+    short day, month, year;
+
+    rq_date_to_dmy(date, &day, &month, &year);
+    if (year < 1000 || year > 9999)
+        return rq_date_to_string(buf, "yyyy-mm-dd", date);
+
+    buf[0] = (char)('0' + year / 1000);
+    buf[1] = (char)('0' + year / 100 % 10);
+    buf[2] = (char)('0' + year / 10 % 10);
+    buf[3] = (char)('0' + year % 10);
+    buf[4] = '-';
+    buf[5] = (char)('0' + month / 10);
+    buf[6] = (char)('0' + month % 10);
+    buf[7] = '-';
+    buf[8] = (char)('0' + day / 10);
+    buf[9] = (char)('0' + day % 10);
+    buf[10] = '\0';
+
+    return buf;
+}
+
 RQ_EXPORT rq_error_code
 rq_calendar_write_to_stream(const rq_calendar_t cal, rq_stream_t stream)
 {
@@ -397,10 +742,13 @@ rq_calendar_write_to_stream(const rq_calendar_t cal, rq_stream_t stream)
         {
             char datebuf[50];
 
-            rq_stream_printf(stream, "  <dateEvent>\n");
-            rq_stream_printf(stream, "   <date>%s</date>\n", rq_date_to_string(datebuf, "yyyy-mm-dd", cal->date_events[i].date));
-            rq_stream_printf(stream, "   <eventMask>%ld</eventMask>\n", cal->date_events[i].event_mask);
-            rq_stream_printf(stream, "  </dateEvent>\n");
+            /* a calendar has hundreds of these, so they are written
+               in pieces rather than formatted */
+            rq_stream_write_string(stream, "  <dateEvent>\n   <date>");
+            rq_stream_write_string(stream, format_iso_date(datebuf, cal->date_events[i].date));
+            rq_stream_write_string(stream, "</date>\n   <eventMask>");
+            rq_stream_write_long_as_string(stream, cal->date_events[i].event_mask);
+            rq_stream_write_string(stream, "</eventMask>\n  </dateEvent>\n");
         }
         rq_stream_printf(stream, " </dateEvents>\n");
     }
@@ -410,7 +758,7 @@ rq_calendar_write_to_stream(const rq_calendar_t cal, rq_stream_t stream)
 
         rq_stream_printf(stream, " <baseCalendars>\n");
         for (i = 0; i < cal->num_composites; i++)
-            rq_stream_printf(stream, "  <baseCalendar>%s</baseCalendar>\n", cal->base_calendars[i]);
+            rq_stream_printf(stream, "  <baseCalendar>%s</baseCalendar>\n", rq_calendar_get_id(cal->base_calendars[i]));
         rq_stream_printf(stream, " </baseCalendars>\n");
     }
     
@@ -432,11 +780,44 @@ rq_calendar_read_from_stream(rq_calendar_t cal, rq_stream_t stream)
         if (node_cal)
         {
             char cal_id[512];
+            char buf[64];
 
             if (rq_xml_node_find_text(node_cal, "@id", cal_id, 512) > 0)
             {
                 rq_calendar_set_id(cal, cal_id);
             }
+
+            /* a composite names its base calendars, which a stream
+               on its own can't supply */
+            rq_xml_node_find_text(node_cal, "@type", buf, 64);
+            if (cal->id && strcmp(buf, "composite"))
+            {
+                struct rq_xml_node *node_events = rq_xml_node_find(node_cal, "calendar/dateEvents");
+                struct rq_xml_node *node_event = NULL;
+
+                if (node_events && node_events->node.el.first_child)
+                    node_event = rq_xml_node_find_element(node_events->node.el.first_child, "dateEvent", 0);
+
+                errcode = RQ_OK;
+
+                for ( ; node_event; node_event = rq_xml_node_find_element(node_event->next, "dateEvent", 0))
+                {
+                    rq_date date;
+                    char mask_buf[32];
+
+                    rq_xml_node_find_text(node_event->node.el.first_child, "date", buf, 64);
+                    rq_xml_node_find_text(node_event->node.el.first_child, "eventMask", mask_buf, 32);
+
+                    date = rq_date_parse(buf, RQ_DATE_FORMAT_YMD);
+                    if (date == 0)
+                    {
+                        errcode = RQ_FAILED;
+                        break;
+                    }
+
+                    rq_calendar_add_event(cal, date, (long)strtoul(mask_buf, NULL, 10));
+                }
+            }
         }
 
         rq_xml_node_free(node_top);
@@ -70,8 +70,22 @@ typedef struct rq_calendar {
     enum rq_calendar_type calendar_type;
     unsigned int num_composites;
     struct rq_calendar *base_calendars[MAX_COMPOSITE_CALENDAR_SIZE];
+
+    /* The compiled form of the calendar. Bit i of good_days is set if
+       horizon_start + i is a good date. prefix_counts[w] holds the
+       number of good dates in the words before word w. */
+    rq_date horizon_start;
+    rq_date horizon_end;
+    unsigned int *good_days;
+    unsigned long *prefix_counts;
 } *rq_calendar_t;
 
+/** The default horizon used when compiling calendars, 1950-01-01 to
+ * 2100-12-31.
+ */
+#define RQ_CALENDAR_DEFAULT_HORIZON_START 2433283L
+#define RQ_CALENDAR_DEFAULT_HORIZON_END 2488434L
+
 
 /** Test whether the rq_calendar is NULL */
 RQ_EXPORT int rq_calendar_is_null(rq_calendar_t obj);
@@ -132,6 +146,46 @@ RQ_EXPORT short rq_calendar_is_good_date(const rq_calendar_t cal, rq_date date);
  */
 RQ_EXPORT long rq_calendar_businessday_count(const rq_calendar_t cal, rq_date from_date, rq_date to_date);
 
+/** Get the first good date strictly after a particular date.
+ */
+RQ_EXPORT rq_date rq_calendar_next_good_date(const rq_calendar_t cal, rq_date date);
+
+/** Get the last good date strictly before a particular date.
+ */
+RQ_EXPORT rq_date rq_calendar_prev_good_date(const rq_calendar_t cal, rq_date date);
+
+/** Compile the calendar into a business day bitmap covering the
+ * inclusive dates from horizon_start to horizon_end. 
+ *
+ * Once compiled, rq_calendar_is_good_date() and
+ * rq_calendar_businessday_count() are constant time for dates inside
+ * the horizon, and fall back to searching the date events outside
+ * it. Adding an event discards the compiled form, so the calendar
+ * should be compiled once it is fully loaded.
+ *
+ * @return 0 on success.
+ */
+RQ_EXPORT short rq_calendar_compile(rq_calendar_t cal, rq_date horizon_start, rq_date horizon_end);
+
+/** Test whether the calendar has been compiled. */
+RQ_EXPORT short rq_calendar_is_compiled(const rq_calendar_t cal);
+
+/** Allocate a composite calendar whose good dates are the dates that
+ * are good in all the calendars passed. The composite references the
+ * calendars, so they must outlive it. The result is compiled over
+ * the horizon passed by combining the compiled calendars.
+ *
+ * At most MAX_COMPOSITE_CALENDAR_SIZE calendars may be combined.
+ * Returns NULL if there are too many.
+ */
+RQ_EXPORT rq_calendar_t rq_calendar_alloc_joint(
+    const char *id, 
+    const rq_calendar_t *cals,
+    unsigned short num_cals,
+    rq_date horizon_start,
+    rq_date horizon_end
+    );
+
 /** Initialize the object schema for the Calendar and DateEvent types.
  */
 RQ_EXPORT void rq_calendar_init_object_schemas(rq_object_schema_mgr_t schema_mgr);
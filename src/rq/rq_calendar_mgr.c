@@ -22,22 +22,135 @@
 ** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 */
 #include "rq_calendar_mgr.h"
+#include "rq_alloc.h"
 #include "rq_tree_rb.h"
 #include <stdlib.h>
 #include <string.h>
 
+/* Makes the stores before it visible to other threads before the
+   stores after it. */
+#if defined(WIN32)
+#include <windows.h>
+#define MEMORY_BARRIER() MemoryBarrier()
+#elif defined(__GNUC__)
+#define MEMORY_BARRIER() __sync_synchronize()
+#else
+#define MEMORY_BARRIER()
+#endif
+
+/* The calendars rq_calendar_mgr_get() can return without taking the
+   lock, in an open addressed hash table. Slots are only ever filled
+   in, after the calendar is ready, so a reader sees either an empty
+   slot or a finished calendar. A table that gets half full is
+   replaced by one twice the size, and the old tables are kept until
+   the loader is replaced, as other threads may still be reading
+   them. */
+struct rq_calendar_mgr_table {
+    struct rq_calendar_mgr_table *previous;
+    unsigned long size; /* a power of two */
+    unsigned long count;
+    rq_calendar_t slots[1];
+};
+
+#define TABLE_INITIAL_SIZE 16
+
 static void
 rq_calendar_mgr_cal_free(void *c)
 {
     rq_calendar_free((rq_calendar_t)c);
 }
 
+static unsigned long
+hash_id(const char *id)
+{
+    unsigned long h = 5381;
+
+    while (*id)
+        h = h * 33 + (unsigned char)*id++;
+    return h;
+}
+
+/* Find the slot holding the calendar with this ID, or the empty slot
+   it would go in. */
+static rq_calendar_t *
+table_slot(struct rq_calendar_mgr_table *t, const char *id)
+{
+    unsigned long i = hash_id(id) & (t->size - 1);
+
+    while (t->slots[i] && strcmp(rq_calendar_get_id(t->slots[i]), id))
+        i = (i + 1) & (t->size - 1);
+    return &t->slots[i];
+}
+
+static rq_calendar_t
+table_find(struct rq_calendar_mgr_table *t, const char *id)
+{
+    return (t ? *table_slot(t, id) : NULL);
+}
+
+/* Put a calendar in the table, replacing one with the same ID. Only
+   called with the lock held. */
+static void
+table_put(rq_calendar_mgr_t m, rq_calendar_t cal)
+{
+    struct rq_calendar_mgr_table *t = m->loaded;
+    rq_calendar_t *slot;
+
+    if (!t || (t->count + 1) * 2 > t->size)
+    {
+        unsigned long size = (t ? t->size * 2 : TABLE_INITIAL_SIZE);
+        struct rq_calendar_mgr_table *nt = (struct rq_calendar_mgr_table *)RQ_CALLOC(
+            1, sizeof(struct rq_calendar_mgr_table) + (size - 1) * sizeof(rq_calendar_t));
+        unsigned long i;
+
+        nt->size = size;
+        nt->previous = t;
+        if (t)
+        {
+            for (i = 0; i < t->size; i++)
+                if (t->slots[i])
+                    *table_slot(nt, rq_calendar_get_id(t->slots[i])) = t->slots[i];
+            nt->count = t->count;
+        }
+
+        MEMORY_BARRIER();
+        m->loaded = t = nt;
+    }
+
+    slot = table_slot(t, rq_calendar_get_id(cal));
+    if (!*slot)
+        t->count++;
+    MEMORY_BARRIER();
+    *slot = cal;
+}
+
+static void
+table_free(rq_calendar_mgr_t m)
+{
+    while (m->loaded)
+    {
+        struct rq_calendar_mgr_table *t = m->loaded;
+        m->loaded = t->previous;
+        RQ_FREE(t);
+    }
+}
+
 RQ_EXPORT rq_calendar_mgr_t
 rq_calendar_mgr_alloc()
 {
     struct rq_calendar_mgr *calendar_mgr = 
         (struct rq_calendar_mgr *)RQ_MALLOC(sizeof(struct rq_calendar_mgr));
     calendar_mgr->calendars = rq_tree_rb_alloc(rq_calendar_mgr_cal_free, (int (*)(const void *, const void *))strcmp);
+    calendar_mgr->horizon_start = RQ_CALENDAR_DEFAULT_HORIZON_START;
+    calendar_mgr->horizon_end = RQ_CALENDAR_DEFAULT_HORIZON_END;
+    calendar_mgr->schedule_cache = rq_schedule_cache_alloc(RQ_SCHEDULE_CACHE_DEFAULT_MAX_SIZE);
+    calendar_mgr->loader = NULL;
+    calendar_mgr->loader_data_free = NULL;
+    calendar_mgr->loader_data = NULL;
+    calendar_mgr->mutex = NULL;
+    calendar_mgr->pending_ids = rq_tree_rb_alloc(rq_free_func, (int (*)(const void *, const void *))strcmp);
+    calendar_mgr->failed_ids = rq_tree_rb_alloc(rq_free_func, (int (*)(const void *, const void *))strcmp);
+    calendar_mgr->loaded = NULL;
 
     return calendar_mgr;
 }
@@ -45,19 +158,154 @@ rq_calendar_mgr_alloc()
 RQ_EXPORT void 
 rq_calendar_mgr_free(rq_calendar_mgr_t calendar_mgr)
 {
+    rq_calendar_mgr_set_loader(calendar_mgr, NULL, NULL, NULL);
+    if (calendar_mgr->mutex)
+        rq_mutex_free(calendar_mgr->mutex);
+    rq_tree_rb_free(calendar_mgr->pending_ids);
+    rq_tree_rb_free(calendar_mgr->failed_ids);
+    rq_schedule_cache_free(calendar_mgr->schedule_cache);
     rq_tree_rb_free(calendar_mgr->calendars);
+    RQ_FREE(calendar_mgr);
 }
 
 RQ_EXPORT void 
 rq_calendar_mgr_add(rq_calendar_mgr_t calendar_mgr, rq_calendar_t cal)
 {
+    /* the calendar may be replacing one the schedules were built with */
+    rq_schedule_cache_clear(calendar_mgr->schedule_cache);
+
+    /* calendars loaded in parallel are compiled as they're loaded */
+    if (!cal->good_days ||
+        cal->horizon_start != calendar_mgr->horizon_start ||
+        cal->horizon_end != calendar_mgr->horizon_end)
+        rq_calendar_compile(cal, calendar_mgr->horizon_start, calendar_mgr->horizon_end);
+
+    /* the calendar it replaces is about to be freed */
+    if (calendar_mgr->loaded)
+        table_put(calendar_mgr, cal);
+
     rq_tree_rb_add(calendar_mgr->calendars, rq_calendar_get_id(cal), cal);
 }
 
+RQ_EXPORT void
+rq_calendar_mgr_set_horizon(rq_calendar_mgr_t m, rq_date horizon_start, rq_date horizon_end)
+{
+    rq_tree_rb_iterator_t it = rq_tree_rb_iterator_alloc();
+
+    m->horizon_start = horizon_start;
+    m->horizon_end = horizon_end;
+
+    for (rq_tree_rb_begin(m->calendars, it); !rq_tree_rb_at_end(it); rq_tree_rb_next(it))
+    {
+        rq_calendar_t cal = (rq_calendar_t)rq_tree_rb_iterator_deref(it);
+        rq_calendar_compile(cal, horizon_start, horizon_end);
+    }
+
+    rq_tree_rb_iterator_free(it);
+}
+
+/* Look a calendar up in the tree, loading it if it isn't there, and
+   make it visible to lookups that don't lock. Only called with the
+   lock held. */
+static rq_calendar_t
+get_locked(rq_calendar_mgr_t calendar_mgr, const char *id)
+{
+    rq_calendar_t cal = (rq_calendar_t)rq_tree_rb_find(calendar_mgr->calendars, id);
+
+    if (!cal && !rq_tree_rb_find(calendar_mgr->failed_ids, id))
+    {
+        cal = (*calendar_mgr->loader)(calendar_mgr->loader_data, id);
+        if (cal)
+        {
+            /* a new ID, so no schedule can have been built with it */
+            rq_calendar_compile(cal, calendar_mgr->horizon_start, calendar_mgr->horizon_end);
+            rq_tree_rb_add(calendar_mgr->calendars, rq_calendar_get_id(cal), cal);
+        }
+        else
+        {
+            char *failed_id = RQ_STRDUP(id);
+            rq_tree_rb_add(calendar_mgr->failed_ids, failed_id, failed_id);
+        }
+    }
+
+    if (cal)
+        table_put(calendar_mgr, cal);
+
+    return cal;
+}
+
 RQ_EXPORT rq_calendar_t
 rq_calendar_mgr_get(const rq_calendar_mgr_t calendar_mgr, const char *id)
 {
-    return (rq_calendar_t)rq_tree_rb_find(calendar_mgr->calendars, id);
+    rq_calendar_t cal;
+
+    if (!calendar_mgr->loader)
+        return (rq_calendar_t)rq_tree_rb_find(calendar_mgr->calendars, id);
+
+    cal = table_find(calendar_mgr->loaded, id);
+    if (cal)
+        return cal;
+
+    /* a lookup may add to the tree, so other lookups have to wait */
+    rq_mutex_lock(calendar_mgr->mutex);
+    cal = get_locked(calendar_mgr, id);
+    rq_mutex_unlock(calendar_mgr->mutex);
+
+    return cal;
+}
+
+RQ_EXPORT void
+rq_calendar_mgr_add_pending(rq_calendar_mgr_t m, const char *id)
+{
+    if (!rq_tree_rb_find(m->pending_ids, id))
+    {
+        char *pending_id = RQ_STRDUP(id);
+        rq_tree_rb_add(m->pending_ids, pending_id, pending_id);
+    }
+}
+
+RQ_EXPORT void
+rq_calendar_mgr_load_pending(rq_calendar_mgr_t m)
+{
+    rq_tree_rb_iterator_t it;
+
+    if (!m->loader)
+        return;
+
+    it = rq_tree_rb_iterator_alloc();
+    rq_mutex_lock(m->mutex);
+
+    for (rq_tree_rb_begin(m->pending_ids, it); !rq_tree_rb_at_end(it); rq_tree_rb_next(it))
+        get_locked(m, (const char *)rq_tree_rb_iterator_deref(it));
+    rq_tree_rb_clear(m->pending_ids);
+
+    rq_mutex_unlock(m->mutex);
+    rq_tree_rb_iterator_free(it);
+}
+
+RQ_EXPORT void
+rq_calendar_mgr_set_loader(
+    rq_calendar_mgr_t calendar_mgr,
+    rq_calendar_t (*loader)(void *loader_data, const char *id),
+    void *loader_data,
+    void (*loader_data_free)(void *loader_data)
+    )
+{
+    if (calendar_mgr->loader_data && calendar_mgr->loader_data_free)
+        (*calendar_mgr->loader_data_free)(calendar_mgr->loader_data);
+
+    calendar_mgr->loader = loader;
+    calendar_mgr->loader_data = loader_data;
+    calendar_mgr->loader_data_free = loader_data_free;
+
+    /* the new loader may know IDs the old one didn't, and lists its
+       own */
+    rq_tree_rb_clear(calendar_mgr->pending_ids);
+    rq_tree_rb_clear(calendar_mgr->failed_ids);
+    table_free(calendar_mgr);
+
+    if (loader && !calendar_mgr->mutex)
+        calendar_mgr->mutex = rq_mutex_alloc();
 }
 
 RQ_EXPORT int
@@ -69,12 +317,21 @@ rq_calendar_mgr_is_null(rq_calendar_mgr_t obj)
 RQ_EXPORT void 
 rq_calendar_mgr_clear(rq_calendar_mgr_t calendar_mgr)
 {
+    rq_calendar_mgr_set_loader(calendar_mgr, NULL, NULL, NULL);
+    rq_schedule_cache_clear(calendar_mgr->schedule_cache);
     rq_tree_rb_clear(calendar_mgr->calendars);
 }
 
+RQ_EXPORT rq_schedule_cache_t
+rq_calendar_mgr_get_schedule_cache(rq_calendar_mgr_t m)
+{
+    return m->schedule_cache;
+}
+
 RQ_EXPORT rq_iterator_t 
 rq_calendar_mgr_get_iterator(rq_calendar_mgr_t m)
 {
+    rq_calendar_mgr_load_pending(m);
     return rq_tree_rb_get_iterator(m->calendars);
 }
 
@@ -34,7 +34,9 @@
 #include "rq_config.h"
 #include "rq_defs.h"
 #include "rq_calendar.h"
+#include "rq_schedule_cache.h"
 #include "rq_tree_rb.h"
+#include "rq_mutex.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -43,8 +45,24 @@ extern "C" {
 #endif
 #endif
 
+struct rq_calendar_mgr_table;
+
 typedef struct rq_calendar_mgr {
     rq_tree_rb_t calendars;
+    rq_date horizon_start;
+    rq_date horizon_end;
+    rq_schedule_cache_t schedule_cache;
+
+    /* Loads calendars the first time they are asked for, see
+       rq_calendar_mgr_set_loader(). The mutex is only used while
+       there's a loader. */
+    rq_calendar_t (*loader)(void *loader_data, const char *id);
+    void (*loader_data_free)(void *loader_data);
+    void *loader_data;
+    rq_mutex_t mutex;
+    rq_tree_rb_t pending_ids; /**< IDs the loader has that may not be loaded yet */
+    rq_tree_rb_t failed_ids; /**< IDs the loader couldn't load */
+    struct rq_calendar_mgr_table *loaded; /**< the calendars looked up so far, found without the lock */
 } *rq_calendar_mgr_t;
 
 
@@ -62,19 +80,78 @@ RQ_EXPORT rq_calendar_mgr_t rq_calendar_mgr_alloc();
 RQ_EXPORT void rq_calendar_mgr_free(rq_calendar_mgr_t calendar_mgr);
 
 /**
- * Add a calendar to the calendar manager
+ * Add a calendar to the calendar manager. The calendar is compiled
+ * over the manager's horizon, unless it already has been, so it
+ * should be fully loaded first.
  */
 RQ_EXPORT void rq_calendar_mgr_add(rq_calendar_mgr_t calendar_mgr, rq_calendar_t cal);
 
 /**
- * Get a calendar from the calendar manager
+ * Get a calendar from the calendar manager. If the calendar isn't
+ * there and the manager has a loader, the loader is asked for it,
+ * unless it has already failed to load it.
  */
 RQ_EXPORT rq_calendar_t rq_calendar_mgr_get(const rq_calendar_mgr_t calendar_mgr, const char *id);
 
-/** Clear the calendars from the calendar manager */
+/**
+ * Load calendars when they are first asked for, rather than all at
+ * once. rq_calendar_mgr_get() calls the loader for an ID that isn't
+ * in the manager, and adds the calendar it returns. The loader
+ * returns NULL for an ID it doesn't know.
+ *
+ * Calendars that haven't been asked for aren't in the manager. A
+ * loader that knows the IDs it has should list them with
+ * rq_calendar_mgr_add_pending(), so that they can be loaded before
+ * the manager is iterated over. An ID the loader couldn't load isn't
+ * asked for again until the loader is replaced.
+ *
+ * A system can still be shared between threads. Calendars that have
+ * been looked up before are found without locking; the first lookup
+ * of an ID takes a lock, and the loader is called with the lock held,
+ * so it mustn't look calendars up in the manager itself.
+ *
+ * @param loader the function to load a calendar, or NULL to stop
+ * loading calendars
+ * @param loader_data passed to the loader
+ * @param loader_data_free called to free the loader data when the
+ * loader is replaced or the manager is cleared or freed, or NULL
+ */
+RQ_EXPORT void
+rq_calendar_mgr_set_loader(
+    rq_calendar_mgr_t calendar_mgr,
+    rq_calendar_t (*loader)(void *loader_data, const char *id),
+    void *loader_data,
+    void (*loader_data_free)(void *loader_data)
+    );
+
+/** Tell the manager that its loader has a calendar with this ID.
+ * Call this after rq_calendar_mgr_set_loader(), which forgets the
+ * IDs listed for the previous loader.
+ */
+RQ_EXPORT void rq_calendar_mgr_add_pending(rq_calendar_mgr_t m, const char *id);
+
+/** Load the calendars listed with rq_calendar_mgr_add_pending() that
+ * haven't been loaded yet. Use this before walking the calendars
+ * directly, as rq_calendar_mgr_get_iterator() does.
+ */
+RQ_EXPORT void rq_calendar_mgr_load_pending(rq_calendar_mgr_t m);
+
+/** Set the horizon that calendars are compiled over when they are
+ * added. The calendars already in the manager are recompiled.
+ */
+RQ_EXPORT void rq_calendar_mgr_set_horizon(rq_calendar_mgr_t m, rq_date horizon_start, rq_date horizon_end);
+
+/** Get the cache of schedules generated with the calendars in this
+ * manager. It is cleared whenever the calendars change.
+ */
+RQ_EXPORT rq_schedule_cache_t rq_calendar_mgr_get_schedule_cache(rq_calendar_mgr_t m);
+
+/** Clear the calendars from the calendar manager, and any loader */
 RQ_EXPORT void rq_calendar_mgr_clear(rq_calendar_mgr_t m);
 
-/** Get an iterator for the calendar. */
+/** Get an iterator for the calendars, after loading any that are
+ * pending.
+ */
 RQ_EXPORT rq_iterator_t rq_calendar_mgr_get_iterator(rq_calendar_mgr_t m);
 
 #ifdef __cplusplus
@@ -29,7 +29,7 @@
 #include <string.h>
 #include <math.h>
 
-static unsigned int s_max_spreads = RQ_CDS_CURVE_MAX_SPREADS;
+static const unsigned int s_max_spreads = RQ_CDS_CURVE_MAX_SPREADS;
 
 
 static struct rq_cds_curve *
@@ -171,7 +171,7 @@ rq_cds_curve_set_survival_rate(rq_cds_curve_t ts, double term, double spread)
     {
         unsigned int new_max_spreads = ts->max_elements * 2;
         ts->spreads = 
-            (struct rq_cds_curve_elem *) realloc(
+            (struct rq_cds_curve_elem *) RQ_REALLOC(
             ts->spreads, 
             new_max_spreads * sizeof(struct rq_cds_curve_elem)
             );
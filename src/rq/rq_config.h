@@ -58,6 +58,7 @@
 
 #ifdef WIN32
 # define snprintf _snprintf
+# define vsnprintf _vsnprintf
 # define isnan _isnan
 
 # ifdef RQSO_EXPORTS
@@ -77,11 +78,35 @@
 # define stricmp strcasecmp
 #endif
 
+/* Tells the compiler that pointers don't alias, so that the inner
+   loops of the numerical kernels can be vectorized. */
+#if defined(__GNUC__)
+# define RQ_RESTRICT __restrict__
+#elif defined(_MSC_VER)
+# define RQ_RESTRICT __restrict
+#else
+# define RQ_RESTRICT
+#endif
+
+/* Storage local to each thread. */
+#if defined(_MSC_VER)
+# define RQ_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__)
+# define RQ_THREAD_LOCAL __thread
+#else
+# define RQ_THREAD_LOCAL
+#endif
+
 /* -- memory allocation ------------------------------------------- */
 /* Define this in order to try and find memory leaks. */
 #undef DEBUG_MEMORY
 
-#ifdef DEBUG_MEMORY
+/* RQ_INSTRUMENT (configure --enable-instrumentation) routes
+   allocations through rq_memdbg too, but only to count them for
+   rq_instrument. It takes precedence over RQ_CUSTOM_ALLOCATOR, and
+   like DEBUG_MEMORY must be defined for everything that includes this
+   header. */
+#if defined(DEBUG_MEMORY) || defined(RQ_INSTRUMENT)
 #  define RQ_MALLOC(x) malloc_dbg(__FILE__, __LINE__, x)
 #  define RQ_CALLOC(n, s) calloc_dbg(__FILE__, __LINE__, n, s)
 #  define RQ_REALLOC(p, s) realloc_dbg(__FILE__, __LINE__, p, s)
@@ -91,18 +116,17 @@
 #  include "rq_memdbg.h"
 
 #else
-
-# define RQ_MALLOC malloc
-# define RQ_CALLOC calloc
-# define RQ_REALLOC realloc
-
-#ifdef MSVC
-# define RQ_STRDUP _strdup
-#else
-# define RQ_STRDUP strdup
-#endif
-
-# define RQ_FREE free
+/* Everything else goes through rq_alloc, which was built with or
+   without RQ_CUSTOM_ALLOCATOR (configure --enable-custom-allocator)
+   along with the library. Code including this header doesn't need to
+   know which. */
+#  define RQ_MALLOC(x) rq_alloc_malloc(x)
+#  define RQ_CALLOC(n, s) rq_alloc_calloc(n, s)
+#  define RQ_REALLOC(p, s) rq_alloc_realloc(p, s)
+#  define RQ_STRDUP(s) rq_alloc_strdup(s)
+#  define RQ_FREE(p) rq_alloc_free(p)
+
+#  include "rq_alloc.h"
 
 # endif
 
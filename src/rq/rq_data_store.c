@@ -36,6 +36,7 @@ _rq_data_store_alloc(
     rq_error_code (*save_system)(void *, rq_system_t),
     rq_error_code (*load_market)(void *, rq_market_t),
     rq_error_code (*save_market)(void *, rq_market_t),
+    rq_error_code (*save_rates)(void *, rq_date, const rq_rate_t *, unsigned int),
     void *store_data
     )
 {
@@ -48,6 +49,7 @@ _rq_data_store_alloc(
     store->save_system = save_system;
     store->load_market = load_market;
     store->save_market = save_market;
+    store->save_rates = save_rates;
 
     store->store_data = store_data;
 
@@ -124,3 +126,12 @@ rq_data_store_market_save(rq_data_store_t store, rq_market_t market)
 
     return RQ_ERROR_CAPABILITY_NOT_AVAILABLE;
 }
+
+RQ_EXPORT rq_error_code
+rq_data_store_market_save_rates(rq_data_store_t store, rq_date market_date, const rq_rate_t *rates, unsigned int num_rates)
+{
+    if (store->save_rates)
+        return (*store->save_rates)(store->store_data, market_date, rates, num_rates);
+
+    return RQ_ERROR_CAPABILITY_NOT_AVAILABLE;
+}
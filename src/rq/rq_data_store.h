@@ -54,6 +54,7 @@ typedef struct rq_data_store {
     rq_error_code (*save_system)(void *, rq_system_t);
     rq_error_code (*load_market)(void *, rq_market_t);
     rq_error_code (*save_market)(void *, rq_market_t);
+    rq_error_code (*save_rates)(void *, rq_date, const rq_rate_t *, unsigned int);
 
     void *store_data;
 } *rq_data_store_t;
@@ -71,6 +72,7 @@ _rq_data_store_alloc(
     rq_error_code (*save_system)(void *store_data, rq_system_t system),
     rq_error_code (*load_market)(void *store_data, rq_market_t market),
     rq_error_code (*save_market)(void *store_data, rq_market_t market),
+    rq_error_code (*save_rates)(void *store_data, rq_date market_date, const rq_rate_t *rates, unsigned int num_rates),
     void *store_data
     );
 
@@ -89,6 +91,18 @@ RQ_EXPORT rq_error_code rq_data_store_system_save(rq_data_store_t, rq_system_t);
 RQ_EXPORT rq_error_code rq_data_store_market_load(rq_data_store_t, rq_market_t);
 RQ_EXPORT rq_error_code rq_data_store_market_save(rq_data_store_t, rq_market_t);
 
+/**
+ * Save changes to some of the rates of a market already in the
+ * store, without saving the rest of the market again. A later
+ * rq_data_store_market_load() for the market date sees the new
+ * rates; the curves saved with the market are left as they were.
+ *
+ * @param market_date the date of the market the rates belong to
+ * @param rates the new or changed rates
+ * @param num_rates the number of rates
+ */
+RQ_EXPORT rq_error_code rq_data_store_market_save_rates(rq_data_store_t store, rq_date market_date, const rq_rate_t *rates, unsigned int num_rates);
+
 #ifdef __cplusplus
 #if 0
 { // purely to not screw up my indenting...
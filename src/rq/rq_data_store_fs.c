@@ -29,22 +29,52 @@
 #include <sys/stat.h>
 #include <dirent.h>
 #include <errno.h>
+#ifdef RQ_THREADS
+#include <pthread.h>
+#endif
 
 #include "rq_data_store_fs.h"
 #include "rq_error.h"
 #include "rq_stream_file.h"
+#include "rq_stream_buffered.h"
+#include "rq_stream_mmap.h"
+#include "rq_alloc.h"
 #include "rq_calendar_mgr.h"
 #include "rq_iterator.h"
+#include "rq_snapshot.h"
+#include "rq_mutex.h"
 
 /*
 ** dir/rq.xml
 ** dir/calendars
 ** dir/assets
 ** dir/bootstrapconfigs
+** dir/markets/index           the saved market dates, sorted
+** dir/markets/YYYYMMDD.rqs    a market snapshot (see rq_snapshot.h),
+**                             followed by any rate updates appended
+**                             since it was saved
 */
 /* -- structs ----------------------------------------------------- */
 struct rq_data_store_fs {
     char *base_dir;
+    enum rq_data_store_fs_load_mode load_mode;
+    unsigned int num_threads;
+};
+
+/* A calendar file found when the system was loaded lazily. */
+struct rq_data_store_fs_calendar_file {
+    char *id;
+    char *path;
+};
+
+/* The calendars still to be read in a parallel load. */
+struct rq_data_store_fs_calendar_load {
+    rq_array_t files;
+    rq_calendar_t *calendars;
+    unsigned int next_file;
+    rq_mutex_t mutex;
+    rq_date horizon_start;
+    rq_date horizon_end;
 };
 
 /* -- statics ----------------------------------------------------- */
@@ -56,6 +86,9 @@ static const char *system_subdirs[] = {
     "bootstrapconfigs",
     NULL
 };
+
+static const char *markets_subdir = "markets";
+static const char *market_index_file_name = "index";
     
 /* -- code -------------------------------------------------------- */
 static char *
@@ -184,13 +217,15 @@ rq_data_store_fs_create(void *store_data, const char *dirname)
     for (i = 0; system_subdirs[i]; i++)
         if ((err = rq_data_store_create_subdirectory(dirname, system_subdirs[i])) != RQ_OK)
             return err;
+    if ((err = rq_data_store_create_subdirectory(dirname, markets_subdir)) != RQ_OK)
+        return err;
 
     if ((fh = rq_data_store_open_file(dirname, index_file_name)) == NULL)
         return (rq_error_code)errno;
 
     fclose(fh);
 
-    d->base_dir = strdup(dirname);
+    d->base_dir = RQ_STRDUP(dirname);
 
     return RQ_OK;
 }
@@ -212,7 +247,7 @@ rq_data_store_fs_open(void *store_data, const char *dirname)
 
     fclose(fh);
 
-    d->base_dir = strdup(dirname);
+    d->base_dir = RQ_STRDUP(dirname);
 
     return RQ_OK;
 }
@@ -220,7 +255,7 @@ rq_data_store_fs_open(void *store_data, const char *dirname)
 rq_array_t 
 rq_data_store_fs_list_files_in_subdir(const char *base_dir, const char *subdir)
 {
-    rq_array_t ar = rq_array_alloc(RQ_FREE);
+    rq_array_t ar = rq_array_alloc(rq_free_func);
     char *dirpath = rq_data_store_fs_get_full_path(base_dir, subdir);
 
     DIR *dir = opendir(dirpath);
@@ -259,6 +294,190 @@ rq_data_store_fs_close(void *store_data)
     return RQ_OK;
 }
 
+static rq_calendar_t
+rq_data_store_fs_read_calendar(const char *cal_file)
+{
+    rq_stream_t stream = rq_stream_mmap_open(cal_file);
+    rq_calendar_t cal = NULL;
+
+    if (stream)
+    {
+        cal = rq_calendar_alloc(NULL);
+
+        if (rq_calendar_read_from_stream(cal, stream) != RQ_OK)
+        {
+            rq_calendar_free(cal);
+            cal = NULL;
+        }
+
+        rq_stream_close(stream);
+        rq_stream_free(stream);
+    }
+
+    return cal;
+}
+
+static void
+rq_data_store_fs_calendar_file_free(void *p)
+{
+    struct rq_data_store_fs_calendar_file *f = (struct rq_data_store_fs_calendar_file *)p;
+
+    RQ_FREE(f->id);
+    RQ_FREE(f->path);
+    RQ_FREE(f);
+}
+
+static void
+rq_data_store_fs_calendar_index_free(void *index)
+{
+    rq_tree_rb_free((rq_tree_rb_t)index);
+}
+
+/* The calendar manager's loader in a lazy load. */
+static rq_calendar_t
+rq_data_store_fs_load_calendar(void *index, const char *id)
+{
+    struct rq_data_store_fs_calendar_file *f = (struct rq_data_store_fs_calendar_file *)
+        rq_tree_rb_find((rq_tree_rb_t)index, id);
+    rq_calendar_t cal = NULL;
+
+    if (f && (cal = rq_data_store_fs_read_calendar(f->path)) != NULL &&
+        strcmp(rq_calendar_get_id(cal), id))
+    {
+        /* the file has been renamed from what the store wrote */
+        rq_calendar_free(cal);
+        cal = NULL;
+    }
+
+    return cal;
+}
+
+/* Index the calendar files by the IDs in their names, for reading
+   on demand. */
+static void
+rq_data_store_fs_calendar_load_lazy(rq_array_t files, rq_calendar_mgr_t calmgr)
+{
+    rq_tree_rb_t index = rq_tree_rb_alloc(
+        rq_data_store_fs_calendar_file_free,
+        (int (*)(const void *, const void *))strcmp
+        );
+    unsigned int i;
+
+    rq_calendar_mgr_set_loader(calmgr, rq_data_store_fs_load_calendar, index, rq_data_store_fs_calendar_index_free);
+
+    for (i = 0; i < rq_array_size(files); i++)
+    {
+        const char *cal_file = (const char *)rq_array_get_at(files, i);
+        const char *name = strrchr(cal_file, '/');
+        unsigned int len;
+        struct rq_data_store_fs_calendar_file *f;
+
+        name = (name ? name + 1 : cal_file);
+        len = strlen(name);
+        if (len <= 4 || strcmp(name + len - 4, ".xml"))
+            continue;
+
+        f = (struct rq_data_store_fs_calendar_file *)RQ_MALLOC(sizeof(struct rq_data_store_fs_calendar_file));
+        f->id = (char *)RQ_MALLOC(len - 3);
+        memcpy(f->id, name, len - 4);
+        f->id[len - 4] = '\0';
+        f->path = RQ_STRDUP(cal_file);
+
+        rq_tree_rb_add(index, f->id, f);
+        rq_calendar_mgr_add_pending(calmgr, f->id);
+    }
+}
+
+/* Take calendar files from the list until there are none left. */
+static void
+rq_data_store_fs_calendar_load_worker(struct rq_data_store_fs_calendar_load *load)
+{
+    while (1)
+    {
+        unsigned int i;
+        rq_calendar_t cal;
+
+        rq_mutex_lock(load->mutex);
+        i = load->next_file++;
+        rq_mutex_unlock(load->mutex);
+
+        if (i >= rq_array_size(load->files))
+            break;
+
+        cal = rq_data_store_fs_read_calendar((const char *)rq_array_get_at(load->files, i));
+        if (cal)
+            rq_calendar_compile(cal, load->horizon_start, load->horizon_end);
+        load->calendars[i] = cal;
+    }
+}
+
+#ifdef RQ_THREADS
+static void *
+rq_data_store_fs_calendar_load_thread(void *load)
+{
+    rq_data_store_fs_calendar_load_worker((struct rq_data_store_fs_calendar_load *)load);
+    return NULL;
+}
+#endif
+
+/* Read and compile the calendars on a pool of threads, then add
+   them in directory order, which is the only part that touches the
+   calendar manager. */
+static void
+rq_data_store_fs_calendar_load_parallel(rq_array_t files, rq_calendar_mgr_t calmgr, unsigned int num_threads)
+{
+    struct rq_data_store_fs_calendar_load load;
+    unsigned int i;
+
+    load.files = files;
+    load.calendars = (rq_calendar_t *)RQ_CALLOC(rq_array_size(files) + 1, sizeof(rq_calendar_t));
+    load.next_file = 0;
+    load.mutex = rq_mutex_alloc();
+    load.horizon_start = calmgr->horizon_start;
+    load.horizon_end = calmgr->horizon_end;
+
+#ifdef RQ_THREADS
+    {
+        pthread_t *threads;
+        unsigned int num_started = 0;
+
+        if (num_threads == 0)
+        {
+#ifdef _SC_NPROCESSORS_ONLN
+            long n = sysconf(_SC_NPROCESSORS_ONLN);
+            num_threads = (n > 0 ? (unsigned int)n : 1);
+#else
+            num_threads = 1;
+#endif
+        }
+        if (num_threads > rq_array_size(files))
+            num_threads = rq_array_size(files);
+
+        /* this thread is one of the pool */
+        threads = (pthread_t *)RQ_MALLOC((num_threads + 1) * sizeof(pthread_t));
+        for (i = 1; i < num_threads; i++)
+            if (pthread_create(&threads[num_started], NULL, rq_data_store_fs_calendar_load_thread, &load) == 0)
+                num_started++;
+
+        rq_data_store_fs_calendar_load_worker(&load);
+
+        for (i = 0; i < num_started; i++)
+            pthread_join(threads[i], NULL);
+
+        RQ_FREE(threads);
+    }
+#else
+    rq_data_store_fs_calendar_load_worker(&load);
+#endif
+
+    for (i = 0; i < rq_array_size(files); i++)
+        if (load.calendars[i])
+            rq_calendar_mgr_add(calmgr, load.calendars[i]);
+
+    rq_mutex_free(load.mutex);
+    RQ_FREE(load.calendars);
+}
+
 static rq_error_code
 rq_data_store_fs_system_load(void *store_data, rq_system_t system)
 {
@@ -272,22 +491,24 @@ rq_data_store_fs_system_load(void *store_data, rq_system_t system)
         rq_calendar_mgr_t calmgr = rq_system_get_calendar_mgr(system);
         rq_calendar_mgr_clear(calmgr);
 
-        for (i = 0; i < rq_array_size(ar); i++)
+        switch (d->load_mode)
         {
-            const char *cal_file = (const char *)rq_array_get_at(ar, i);
-            rq_stream_t stream = rq_stream_file_open(cal_file, "r");
-
-            if (stream)
-            {
-                rq_calendar_t cal = rq_calendar_alloc(NULL);
-                
-                if (rq_calendar_read_from_stream(cal, stream) == RQ_OK)
-                    rq_calendar_mgr_add(calmgr, cal);
-                else
-                    rq_calendar_free(cal);
-
-                rq_stream_close(stream);
-            }
+            case RQ_DATA_STORE_FS_LOAD_LAZY:
+                rq_data_store_fs_calendar_load_lazy(ar, calmgr);
+                break;
+
+            case RQ_DATA_STORE_FS_LOAD_PARALLEL:
+                rq_data_store_fs_calendar_load_parallel(ar, calmgr, d->num_threads);
+                break;
+
+            default:
+                for (i = 0; i < rq_array_size(ar); i++)
+                {
+                    rq_calendar_t cal = rq_data_store_fs_read_calendar((const char *)rq_array_get_at(ar, i));
+                    if (cal)
+                        rq_calendar_mgr_add(calmgr, cal);
+                }
+                break;
         }
 
         rq_array_free(ar);
@@ -311,13 +532,17 @@ rq_data_store_fs_system_save(void *store_data, rq_system_t system)
 
         char *calpath = rq_data_store_fs_get_full_path(d->base_dir, "calendars");
 
+        calmgr = rq_system_get_calendar_mgr(system);
+
+        /* a lazily loaded system saves every calendar, not just the
+           ones used so far, as the files are about to go */
+        rq_calendar_mgr_load_pending(calmgr);
+
         /* remove all files from directory. */
 
         for (i = 0; system_subdirs[i]; i++)
             rq_data_store_subdirectory_unlink_files(d->base_dir, system_subdirs[i]);
 
-        calmgr = rq_system_get_calendar_mgr(system);
-
         for (iter = rq_calendar_mgr_get_iterator(calmgr); !rq_iterator_at_end(iter); rq_iterator_incr(iter))
         {
             struct rq_variant var = rq_iterator_get_value(iter);
@@ -330,15 +555,20 @@ rq_data_store_fs_system_save(void *store_data, rq_system_t system)
 
             calfile = rq_data_store_fs_get_full_path(calpath, calfilename);
 
-            rq_stream_t calstream = rq_stream_file_open(calfile, "w+");
+            rq_stream_t calstream = rq_stream_buffered_alloc(rq_stream_file_open(calfile, "w+"), 0);
 
-            rq_calendar_write_to_stream(cal, calstream);
+            if (calstream)
+            {
+                rq_calendar_write_to_stream(cal, calstream);
 
-            rq_stream_close(calstream);
+                rq_stream_close(calstream);
+                rq_stream_free(calstream);
+            }
 
             RQ_FREE(calfile);
             
         }
+        rq_iterator_free(iter);
         
         RQ_FREE(calpath);
 
@@ -348,12 +578,243 @@ rq_data_store_fs_system_save(void *store_data, rq_system_t system)
     return RQ_FAILED;
 }
 
+static char *
+rq_data_store_fs_get_market_path(const char *base_dir, rq_date market_date)
+{
+    char *dirpath = rq_data_store_fs_get_full_path(base_dir, markets_subdir);
+    char *filepath;
+    char filename[32];
+
+    snprintf(filename, 32, "%04d%02d%02d.rqs",
+             rq_date_get_year(market_date),
+             rq_date_get_month(market_date),
+             rq_date_get_day(market_date));
+    filepath = rq_data_store_fs_get_full_path(dirpath, filename);
+
+    RQ_FREE(dirpath);
+
+    return filepath;
+}
+
+/* Read the market index, returning the dates saved in date order
+   or NULL if there aren't any. */
+static int *
+rq_data_store_fs_read_market_index(const char *base_dir, unsigned int *num_dates)
+{
+    char *dirpath = rq_data_store_fs_get_full_path(base_dir, markets_subdir);
+    char *indexpath = rq_data_store_fs_get_full_path(dirpath, market_index_file_name);
+    FILE *fh = fopen(indexpath, "rb");
+    int *dates = NULL;
+    long len;
+
+    *num_dates = 0;
+
+    if (fh)
+    {
+        fseek(fh, 0, SEEK_END);
+        len = ftell(fh);
+        fseek(fh, 0, SEEK_SET);
+
+        if (len >= (long)sizeof(int))
+        {
+            dates = (int *)RQ_MALLOC(len);
+            *num_dates = fread(dates, sizeof(int), len / sizeof(int), fh);
+        }
+
+        fclose(fh);
+    }
+
+    RQ_FREE(indexpath);
+    RQ_FREE(dirpath);
+
+    return dates;
+}
+
+/* Find the first of the dates on or after the date. */
+static unsigned int
+rq_data_store_fs_market_index_search(const int *dates, unsigned int num_dates, rq_date date)
+{
+    unsigned int lo = 0;
+    unsigned int hi = num_dates;
+
+    while (lo < hi)
+    {
+        unsigned int mid = lo + (hi - lo) / 2;
+
+        if (dates[mid] < date)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return lo;
+}
+
+static rq_error_code
+rq_data_store_fs_add_to_market_index(const char *base_dir, rq_date market_date)
+{
+    char *dirpath = rq_data_store_fs_get_full_path(base_dir, markets_subdir);
+    char *indexpath = rq_data_store_fs_get_full_path(dirpath, market_index_file_name);
+    unsigned int num_dates;
+    int *dates = rq_data_store_fs_read_market_index(base_dir, &num_dates);
+    unsigned int pos = rq_data_store_fs_market_index_search(dates, num_dates, market_date);
+    int date = (int)market_date;
+    rq_error_code err = RQ_OK;
+    FILE *fh;
+
+    if (pos < num_dates && dates[pos] == date)
+        ; /* already there */
+    else if (pos == num_dates)
+    {
+        /* markets are usually saved in date order, so this is just
+           an append */
+        if ((fh = fopen(indexpath, "ab")) == NULL)
+            err = (rq_error_code)errno;
+        else
+        {
+            if (fwrite(&date, sizeof(int), 1, fh) != 1)
+                err = RQ_FAILED;
+            if (fclose(fh) != 0)
+                err = RQ_FAILED;
+        }
+    }
+    else
+    {
+        char *tmppath = (char *)RQ_MALLOC(strlen(indexpath) + 5);
+
+        strcpy(tmppath, indexpath);
+        strcat(tmppath, ".tmp");
+
+        if ((fh = fopen(tmppath, "wb")) == NULL)
+            err = (rq_error_code)errno;
+        else
+        {
+            if (fwrite(dates, sizeof(int), pos, fh) != pos ||
+                fwrite(&date, sizeof(int), 1, fh) != 1 ||
+                fwrite(dates + pos, sizeof(int), num_dates - pos, fh) != num_dates - pos)
+                err = RQ_FAILED;
+            if (fclose(fh) != 0)
+                err = RQ_FAILED;
+
+            if (err == RQ_OK && rename(tmppath, indexpath) != 0)
+                err = (rq_error_code)errno;
+            if (err != RQ_OK)
+                remove(tmppath);
+        }
+
+        RQ_FREE(tmppath);
+    }
+
+    if (dates)
+        RQ_FREE(dates);
+    RQ_FREE(indexpath);
+    RQ_FREE(dirpath);
+
+    return err;
+}
+
+/* Apply the rate updates appended after a market's snapshot. An
+   update that was only partly written, because the writer died
+   part way through, ends the list. */
+static void
+rq_data_store_fs_apply_rate_updates(rq_rate_mgr_t rate_mgr, const char *buffer, unsigned long len)
+{
+    while (len >= sizeof(struct rq_data_store_fs_rate_update))
+    {
+        const struct rq_data_store_fs_rate_update *u = (const struct rq_data_store_fs_rate_update *)buffer;
+
+        if (u->marker != RQ_DATA_STORE_FS_RATE_UPDATE_MARKER ||
+            u->length <= sizeof(*u) || u->length > len || u->length % 8 ||
+            u->asset_id_offset <= sizeof(*u) || u->asset_id_offset >= u->length ||
+            buffer[u->length - 1] != '\0')
+            break;
+
+        rq_rate_mgr_add(
+            rate_mgr,
+            rq_rate_build(
+                buffer + sizeof(*u),
+                buffer + u->asset_id_offset,
+                (enum rq_rate_type)u->rate_type,
+                u->observation_date,
+                u->value_date,
+                u->value
+                )
+            );
+
+        buffer += u->length;
+        len -= u->length;
+    }
+}
+
 static rq_error_code
 rq_data_store_fs_market_load(void *store_data, rq_market_t market)
 {
     struct rq_data_store_fs *d = (struct rq_data_store_fs *)store_data;
 
-    return RQ_OK;
+    if (d->base_dir)
+    {
+        char *marketpath = rq_data_store_fs_get_market_path(d->base_dir, rq_market_get_market_date(market));
+        rq_stream_t stream = rq_stream_mmap_open(marketpath);
+        rq_error_code err = RQ_ENOENT;
+
+        RQ_FREE(marketpath);
+
+        if (stream)
+        {
+            unsigned long len;
+            const char *buffer = rq_stream_mmap_get_buffer(stream, &len);
+
+            /* the snapshot and the updates after it come from the
+               one read of the file */
+            err = rq_snapshot_read_buffer(buffer, len, NULL, market);
+            if (err == RQ_OK)
+            {
+                unsigned int file_size = ((const struct rq_snapshot_header *)buffer)->file_size;
+                rq_data_store_fs_apply_rate_updates(rq_market_get_rate_mgr(market), buffer + file_size, len - file_size);
+            }
+
+            rq_stream_close(stream);
+            rq_stream_free(stream);
+        }
+
+        return err;
+    }
+
+    return RQ_FAILED;
+}
+
+/* Write the market's snapshot next to the market file and move it
+   over the top, so that a reader never sees half a market. This
+   also drops the rate updates appended to the old file, which the
+   market being saved should already have. */
+static rq_error_code
+rq_data_store_fs_write_market(const char *marketpath, rq_market_t market)
+{
+    char *tmppath = (char *)RQ_MALLOC(strlen(marketpath) + 5);
+    rq_stream_t stream;
+    rq_error_code err;
+
+    strcpy(tmppath, marketpath);
+    strcat(tmppath, ".tmp");
+
+    /* binary, so that no newline in the snapshot is translated */
+    stream = rq_stream_file_open(tmppath, "wb");
+    if (stream)
+    {
+        err = rq_snapshot_write(stream, NULL, market);
+        rq_stream_free(stream);
+    }
+    else
+        err = RQ_FAILED;
+
+    if (err == RQ_OK && rename(tmppath, marketpath) != 0)
+        err = (rq_error_code)errno;
+    if (err != RQ_OK)
+        remove(tmppath);
+
+    RQ_FREE(tmppath);
+
+    return err;
 }
 
 static rq_error_code 
@@ -361,9 +822,150 @@ rq_data_store_fs_market_save(void *store_data, rq_market_t market)
 {
     struct rq_data_store_fs *d = (struct rq_data_store_fs *)store_data;
 
-    return RQ_OK;
+    if (d->base_dir)
+    {
+        rq_date market_date = rq_market_get_market_date(market);
+        char *marketpath;
+        rq_error_code err;
+
+        /* stores created before markets were kept don't have the
+           directory */
+        if ((err = rq_data_store_create_subdirectory(d->base_dir, markets_subdir)) != RQ_OK)
+            return err;
+
+        marketpath = rq_data_store_fs_get_market_path(d->base_dir, market_date);
+
+        err = rq_data_store_fs_write_market(marketpath, market);
+        if (err == RQ_OK)
+            err = rq_data_store_fs_add_to_market_index(d->base_dir, market_date);
+
+        RQ_FREE(marketpath);
+
+        return err;
+    }
+
+    return RQ_FAILED;
 }
 
+static rq_error_code
+rq_data_store_fs_market_save_rates(void *store_data, rq_date market_date, const rq_rate_t *rates, unsigned int num_rates)
+{
+    struct rq_data_store_fs *d = (struct rq_data_store_fs *)store_data;
+
+    if (d->base_dir)
+    {
+        char *marketpath = rq_data_store_fs_get_market_path(d->base_dir, market_date);
+        char *buffer = NULL;
+        unsigned int len = 0;
+        unsigned int max_len = 0;
+        unsigned int i;
+        rq_error_code err = RQ_OK;
+        FILE *fh;
+
+        if ((fh = fopen(marketpath, "rb")) != NULL)
+            fclose(fh);
+        else
+        {
+            /* there's no market saved for the date yet, so start
+               with an empty one */
+            rq_market_t market = rq_market_alloc(market_date);
+            err = rq_data_store_fs_market_save(store_data, market);
+            rq_market_free(market);
+        }
+
+        for (i = 0; i < num_rates && err == RQ_OK; i++)
+        {
+            const char *rate_class_id = rq_rate_get_rate_class_id(rates[i]);
+            const char *asset_id = (rq_rate_get_asset_id(rates[i]) ? rq_rate_get_asset_id(rates[i]) : "");
+            unsigned int rate_class_id_len = strlen(rate_class_id) + 1;
+            unsigned int asset_id_len = strlen(asset_id) + 1;
+            unsigned int update_len = (sizeof(struct rq_data_store_fs_rate_update) + rate_class_id_len + asset_id_len + 7) & ~7;
+            struct rq_data_store_fs_rate_update *u;
+
+            if (len + update_len > max_len)
+            {
+                max_len = (max_len ? max_len * 2 : 1024);
+                if (max_len < len + update_len)
+                    max_len = len + update_len;
+                buffer = (char *)RQ_REALLOC(buffer, max_len);
+            }
+
+            u = (struct rq_data_store_fs_rate_update *)(buffer + len);
+            memset(u, 0, update_len);
+            u->marker = RQ_DATA_STORE_FS_RATE_UPDATE_MARKER;
+            u->length = update_len;
+            u->rate_type = rq_rate_get_rate_type(rates[i]);
+            u->observation_date = (int)rq_rate_get_observation_date(rates[i]);
+            u->value_date = (int)rq_rate_get_value_date(rates[i]);
+            u->value = rq_rate_get_unperturbed_value(rates[i]);
+            u->asset_id_offset = sizeof(*u) + rate_class_id_len;
+            memcpy(u + 1, rate_class_id, rate_class_id_len);
+            memcpy((char *)u + u->asset_id_offset, asset_id, asset_id_len);
+
+            len += update_len;
+        }
+
+        /* the updates go on the end in a single write */
+        if (err == RQ_OK && len)
+        {
+            if ((fh = fopen(marketpath, "ab")) == NULL)
+                err = (rq_error_code)errno;
+            else
+            {
+                if (fwrite(buffer, len, 1, fh) != 1)
+                    err = RQ_FAILED;
+                if (fclose(fh) != 0)
+                    err = RQ_FAILED;
+            }
+        }
+
+        if (buffer)
+            RQ_FREE(buffer);
+        RQ_FREE(marketpath);
+
+        return err;
+    }
+
+    return RQ_FAILED;
+}
+
+RQ_EXPORT void
+rq_data_store_fs_set_load_mode(
+    rq_data_store_t store,
+    enum rq_data_store_fs_load_mode load_mode,
+    unsigned int num_threads
+    )
+{
+    struct rq_data_store_fs *d = (struct rq_data_store_fs *)store->store_data;
+
+    if (store->free_func == rq_data_store_fs_free)
+    {
+        d->load_mode = load_mode;
+        d->num_threads = num_threads;
+    }
+}
+
+RQ_EXPORT rq_date
+rq_data_store_fs_find_market_date(rq_data_store_t store, rq_date date)
+{
+    struct rq_data_store_fs *d = (struct rq_data_store_fs *)store->store_data;
+    rq_date market_date = 0;
+
+    if (store->free_func == rq_data_store_fs_free && d->base_dir)
+    {
+        unsigned int num_dates;
+        int *dates = rq_data_store_fs_read_market_index(d->base_dir, &num_dates);
+        unsigned int pos = rq_data_store_fs_market_index_search(dates, num_dates, date + 1);
+
+        if (pos > 0)
+            market_date = dates[pos - 1];
+
+        if (dates)
+            RQ_FREE(dates);
+    }
+
+    return market_date;
+}
 
 RQ_EXPORT rq_data_store_t 
 rq_data_store_fs_alloc()
@@ -382,6 +984,7 @@ rq_data_store_fs_alloc()
         rq_data_store_fs_system_save,
         rq_data_store_fs_market_load,
         rq_data_store_fs_market_save,
+        rq_data_store_fs_market_save_rates,
         store_data
     );
 
@@ -46,15 +46,81 @@ extern "C" {
 /* Change the store version number, if the store format changes. */
 #define RQ_DATA_STORE_FS_VERSION_NUM 1
 
+/* Marks the start of each rate update appended to a market file. */
+#define RQ_DATA_STORE_FS_RATE_UPDATE_MARKER 0x52515255
+
+/* -- enums ------------------------------------------------------- */
+/** How rq_data_store_system_load() loads the calendars. */
+enum rq_data_store_fs_load_mode {
+    RQ_DATA_STORE_FS_LOAD_EAGER, /**< read every calendar, one after another */
+    RQ_DATA_STORE_FS_LOAD_LAZY, /**< read a calendar when it's first asked for */
+    RQ_DATA_STORE_FS_LOAD_PARALLEL /**< read every calendar across several threads */
+};
+
 /* -- structs ----------------------------------------------------- */
 struct rq_data_store_fs_data {
     
 };
 
+/**
+ * A rate saved by rq_data_store_market_save_rates(), appended to
+ * the market file after the snapshot. The rate class ID follows
+ * the record as a NUL terminated string, then the asset ID, and
+ * the whole update is padded with NULs to a multiple of 8 bytes.
+ */
+struct rq_data_store_fs_rate_update {
+    unsigned int marker; /**< RQ_DATA_STORE_FS_RATE_UPDATE_MARKER */
+    unsigned int length; /**< of the update including the IDs and padding */
+    int rate_type;
+    int observation_date;
+    int value_date;
+    unsigned int asset_id_offset; /**< from the start of the update */
+    double value;
+};
+
 
 /* -- prototypes -------------------------------------------------- */
 RQ_EXPORT rq_data_store_t rq_data_store_fs_alloc();
 
+/**
+ * Set how the system's calendars are loaded. The default is
+ * RQ_DATA_STORE_FS_LOAD_EAGER.
+ *
+ * With RQ_DATA_STORE_FS_LOAD_LAZY, loading the system only lists
+ * the calendars directory, and a calendar is read the first time
+ * it is asked for from the calendar manager (see
+ * rq_calendar_mgr_set_loader()), or when the calendars are iterated
+ * over. Calendars are found by their file name, which is the
+ * calendar ID followed by ".xml" as rq_data_store_system_save()
+ * writes them. The directory should stay as it is while the system
+ * is in use.
+ *
+ * With RQ_DATA_STORE_FS_LOAD_PARALLEL the calendars are read and
+ * compiled on a pool of threads, then added to the calendar
+ * manager in the order of the directory, so the result is the same
+ * as an eager load. Without thread support (RQ_THREADS) this is the
+ * same as an eager load.
+ *
+ * @param num_threads the number of threads for a parallel load, or
+ * 0 for one per processor
+ */
+RQ_EXPORT void
+rq_data_store_fs_set_load_mode(
+    rq_data_store_t store,
+    enum rq_data_store_fs_load_mode load_mode,
+    unsigned int num_threads
+    );
+
+/**
+ * Find the latest market saved in a file system data store on or
+ * before a date, for loading the market a backtest would have seen
+ * on that date.
+ *
+ * @return the market date, or 0 if there isn't a market saved on
+ * or before the date
+ */
+RQ_EXPORT rq_date rq_data_store_fs_find_market_date(rq_data_store_t store, rq_date date);
+
 #ifdef __cplusplus
 #if 0
 { // purely to not screw up my indenting...
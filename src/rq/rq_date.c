@@ -32,9 +32,9 @@
 #include <string.h>
 #include <ctype.h>
 
-static long rq_date_excel_date_offset = 2415019L;
+static const long rq_date_excel_date_offset = 2415019L;
 
-static unsigned char rq_date_days_in_month[12] = {
+static const unsigned char rq_date_days_in_month[12] = {
     31,	/* Jan */
     28,	/* Feb */
     31,	/* Mar */
@@ -100,26 +100,28 @@ static const char * rq_date_long_months[12] = {
     "December"
 };
 
+/* The date conversions use the proleptic Gregorian algorithms from
+   Howard Hinnant's "chrono-Compatible Low-Level Date Algorithms".
+   Years are counted from March so that the leap day falls at the end
+   of the year, which leaves nothing but integer arithmetic and no
+   tables. RQ_DATE_MARCH_1_YEAR_0 is the julian day number of
+   0000-03-01.
+*/
+#define RQ_DATE_MARCH_1_YEAR_0 1721120L
+
 RQ_EXPORT rq_date
 rq_date_from_dmy(short day, short month, short year)
 {
-	rq_date julian = 367 * year - 7 * (year + (month + 9) / 12) / 4 + 275 * month / 9 + day + 1721014;
-	if (100 * year + month <= 190002) julian += 1;
-	return julian;
+    long y = year - (month <= 2);
+    long era = (y >= 0 ? y : y - 399) / 400;
+    long yoe = y - era * 400;                                   /* [0, 399] */
+    long mp = month + (month > 2 ? -3 : 9);                     /* [0, 11], March = 0 */
+    long doy = (153 * mp + 2) / 5 + day - 1;                    /* [0, 365] */
+    long doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;           /* [0, 146096] */
+
+    return era * 146097 + doe + RQ_DATE_MARCH_1_YEAR_0;
 }
 
-#ifdef RQ_USE_DATE_CACHE
-struct rq_JulianDMY {
-    short year;
-    char month;
-    char day;
-};
-
-static struct rq_JulianDMY rq_dmy_cache[RQ_DMY_CACHE_SIZE] = {
-#include "rq_date_cache_initialisation.h"
-};
-#endif
-
 RQ_EXPORT short
 rq_date_to_dmy(
     rq_date julian, 
@@ -128,36 +130,28 @@ rq_date_to_dmy(
     short *year
     )
 {
-#ifdef RQ_USE_DATE_CACHE
-    int cache_pos = julian - RQ_DMY_CACHE_START;
-    if(cache_pos >= 0 && cache_pos < RQ_DMY_CACHE_SIZE)
-    {
-        *year = rq_dmy_cache[cache_pos].year;
-        *mon = rq_dmy_cache[cache_pos].month;
-        *day = rq_dmy_cache[cache_pos].day;
-        return 0;
-    }
-#endif
-
-    /* Cache lookup failed, continue with slower code. */
-    /* ... Normal rq_date_to_dmy() code ... */
+    long z;
+    long era;
+    long doe;
+    long yoe;
+    long doy;
+    long mp;
+    long m;
 
     if (!julian)
         return 1;
 
-    {
-        int l = julian + 68569;
-        int n = 4 * l / 146097;
-        int it;
-        l = l - (146097 * n + 3) / 4;
-        it = 4000 * (l + 1) / 1461001;
-        l = l - 1461 * it / 4 + 31;
-        *mon = 80 * l / 2447;
-        *day = l - 2447 * (*mon) / 80;
-        l = (*mon) / 11;
-        *mon = (*mon) + 2 - 12 * l;
-        *year = 100 * (n - 49) + it + l;
-    }
+    z = julian - RQ_DATE_MARCH_1_YEAR_0;
+    era = (z >= 0 ? z : z - 146096) / 146097;
+    doe = z - era * 146097;                                     /* [0, 146096] */
+    yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365; /* [0, 399] */
+    doy = doe - (365 * yoe + yoe / 4 - yoe / 100);              /* [0, 365] */
+    mp = (5 * doy + 2) / 153;                                   /* [0, 11] */
+    m = mp + 3 - 12 * (mp / 10);                                /* [1, 12] */
+
+    *day = (short)(doy - (153 * mp + 2) / 5 + 1);
+    *mon = (short)m;
+    *year = (short)(yoe + era * 400 + (m <= 2));
 
     return 0;
 }
@@ -627,38 +621,13 @@ rq_date_weekday_diff(rq_date d1, rq_date d2)
 RQ_EXPORT int 
 rq_date_month_diff(rq_date d1, rq_date d2)
 {
-    rq_date tmp;
     short day1, month1, year1;
     short day2, month2, year2;
-    int num_months;
-    int num_years;
-    short swapped = 0;
-
-    if (d2 < d1)
-    {
-        tmp = d1;
-        d1 = d2;
-        d2 = tmp;
-        swapped = 1;
-    }
 
     rq_date_to_dmy(d1, &day1, &month1, &year1);
     rq_date_to_dmy(d2, &day2, &month2, &year2);
-    
-    num_years = year2 - year1;
-    if (month2 < month1)
-    {
-        /* m1 = 5, m2 = 3 (12-5)+3 */
-        num_years--;
-        num_months = (12 - month1) + month2;
-    }
-    else
-        num_months = month2 - month1;
-
-    if (num_years > 0)
-        num_months += (12 * num_years);
 
-    return (swapped ? -num_months : num_months);
+    return (year2 - year1) * 12 + (month2 - month1);
 }
 
 RQ_EXPORT enum rq_periods_per_year 
@@ -55,10 +55,6 @@ typedef long rq_date;
 #define RQ_DATE_INVALID  0L
 #endif
 
-/* If RQ_DMY_CACHE_SIZE or RQ_DMY_CACHE_START is changed then rq_dmy_cache will need to be regenerated.  */
-#define RQ_DMY_CACHE_SIZE 36525 /* 36525 = 100 years. */
-#define RQ_DMY_CACHE_START 2451545 /* START is 1/1/2000 = Julian 2451545 */
-
 /* -- prototypes -------------------------------------------------- */
 
 /** Construct a julian date from the day, month and year parameters.
@@ -1,1144 +0,0 @@
-/* This is initialisation for rq_dmy_cache, generated by rq_date_cache_generator.c */
-{2000,1,1}, {2000,1,2}, {2000,1,3}, {2000,1,4}, {2000,1,5}, {2000,1,6}, {2000,1,7}, 
-{2000,1,8}, {2000,1,9}, {2000,1,10}, {2000,1,11}, {2000,1,12}, {2000,1,13}, {2000,1,14}, {2000,1,15}, {2000,1,16}, {2000,1,17}, {2000,1,18}, {2000,1,19}, {2000,1,20}, {2000,1,21}, {2000,1,22}, {2000,1,23}, {2000,1,24}, {2000,1,25}, {2000,1,26}, {2000,1,27}, {2000,1,28}, {2000,1,29}, {2000,1,30}, {2000,1,31}, {2000,2,1}, {2000,2,2}, {2000,2,3}, {2000,2,4}, {2000,2,5}, {2000,2,6}, {2000,2,7}, {2000,2,8}, 
-{2000,2,9}, {2000,2,10}, {2000,2,11}, {2000,2,12}, {2000,2,13}, {2000,2,14}, {2000,2,15}, {2000,2,16}, {2000,2,17}, {2000,2,18}, {2000,2,19}, {2000,2,20}, {2000,2,21}, {2000,2,22}, {2000,2,23}, {2000,2,24}, {2000,2,25}, {2000,2,26}, {2000,2,27}, {2000,2,28}, {2000,2,29}, {2000,3,1}, {2000,3,2}, {2000,3,3}, {2000,3,4}, {2000,3,5}, {2000,3,6}, {2000,3,7}, {2000,3,8}, {2000,3,9}, {2000,3,10}, {2000,3,11}, 
-{2000,3,12}, {2000,3,13}, {2000,3,14}, {2000,3,15}, {2000,3,16}, {2000,3,17}, {2000,3,18}, {2000,3,19}, {2000,3,20}, {2000,3,21}, {2000,3,22}, {2000,3,23}, {2000,3,24}, {2000,3,25}, {2000,3,26}, {2000,3,27}, {2000,3,28}, {2000,3,29}, {2000,3,30}, {2000,3,31}, {2000,4,1}, {2000,4,2}, {2000,4,3}, {2000,4,4}, {2000,4,5}, {2000,4,6}, {2000,4,7}, {2000,4,8}, {2000,4,9}, {2000,4,10}, {2000,4,11}, {2000,4,12}, 
-{2000,4,13}, {2000,4,14}, {2000,4,15}, {2000,4,16}, {2000,4,17}, {2000,4,18}, {2000,4,19}, {2000,4,20}, {2000,4,21}, {2000,4,22}, {2000,4,23}, {2000,4,24}, {2000,4,25}, {2000,4,26}, {2000,4,27}, {2000,4,28}, {2000,4,29}, {2000,4,30}, {2000,5,1}, {2000,5,2}, {2000,5,3}, {2000,5,4}, {2000,5,5}, {2000,5,6}, {2000,5,7}, {2000,5,8}, {2000,5,9}, {2000,5,10}, {2000,5,11}, {2000,5,12}, {2000,5,13}, {2000,5,14}, 
-{2000,5,15}, {2000,5,16}, {2000,5,17}, {2000,5,18}, {2000,5,19}, {2000,5,20}, {2000,5,21}, {2000,5,22}, {2000,5,23}, {2000,5,24}, {2000,5,25}, {2000,5,26}, {2000,5,27}, {2000,5,28}, {2000,5,29}, {2000,5,30}, {2000,5,31}, {2000,6,1}, {2000,6,2}, {2000,6,3}, {2000,6,4}, {2000,6,5}, {2000,6,6}, {2000,6,7}, {2000,6,8}, {2000,6,9}, {2000,6,10}, {2000,6,11}, {2000,6,12}, {2000,6,13}, {2000,6,14}, {2000,6,15}, 
-{2000,6,16}, {2000,6,17}, {2000,6,18}, {2000,6,19}, {2000,6,20}, {2000,6,21}, {2000,6,22}, {2000,6,23}, {2000,6,24}, {2000,6,25}, {2000,6,26}, {2000,6,27}, {2000,6,28}, {2000,6,29}, {2000,6,30}, {2000,7,1}, {2000,7,2}, {2000,7,3}, {2000,7,4}, {2000,7,5}, {2000,7,6}, {2000,7,7}, {2000,7,8}, {2000,7,9}, {2000,7,10}, {2000,7,11}, {2000,7,12}, {2000,7,13}, {2000,7,14}, {2000,7,15}, {2000,7,16}, {2000,7,17}, 
-{2000,7,18}, {2000,7,19}, {2000,7,20}, {2000,7,21}, {2000,7,22}, {2000,7,23}, {2000,7,24}, {2000,7,25}, {2000,7,26}, {2000,7,27}, {2000,7,28}, {2000,7,29}, {2000,7,30}, {2000,7,31}, {2000,8,1}, {2000,8,2}, {2000,8,3}, {2000,8,4}, {2000,8,5}, {2000,8,6}, {2000,8,7}, {2000,8,8}, {2000,8,9}, {2000,8,10}, {2000,8,11}, {2000,8,12}, {2000,8,13}, {2000,8,14}, {2000,8,15}, {2000,8,16}, {2000,8,17}, {2000,8,18}, 
-{2000,8,19}, {2000,8,20}, {2000,8,21}, {2000,8,22}, {2000,8,23}, {2000,8,24}, {2000,8,25}, {2000,8,26}, {2000,8,27}, {2000,8,28}, {2000,8,29}, {2000,8,30}, {2000,8,31}, {2000,9,1}, {2000,9,2}, {2000,9,3}, {2000,9,4}, {2000,9,5}, {2000,9,6}, {2000,9,7}, {2000,9,8}, {2000,9,9}, {2000,9,10}, {2000,9,11}, {2000,9,12}, {2000,9,13}, {2000,9,14}, {2000,9,15}, {2000,9,16}, {2000,9,17}, {2000,9,18}, {2000,9,19}, 
-{2000,9,20}, {2000,9,21}, {2000,9,22}, {2000,9,23}, {2000,9,24}, {2000,9,25}, {2000,9,26}, {2000,9,27}, {2000,9,28}, {2000,9,29}, {2000,9,30}, {2000,10,1}, {2000,10,2}, {2000,10,3}, {2000,10,4}, {2000,10,5}, {2000,10,6}, {2000,10,7}, {2000,10,8}, {2000,10,9}, {2000,10,10}, {2000,10,11}, {2000,10,12}, {2000,10,13}, {2000,10,14}, {2000,10,15}, {2000,10,16}, {2000,10,17}, {2000,10,18}, {2000,10,19}, {2000,10,20}, {2000,10,21}, 
-{2000,10,22}, {2000,10,23}, {2000,10,24}, {2000,10,25}, {2000,10,26}, {2000,10,27}, {2000,10,28}, {2000,10,29}, {2000,10,30}, {2000,10,31}, {2000,11,1}, {2000,11,2}, {2000,11,3}, {2000,11,4}, {2000,11,5}, {2000,11,6}, {2000,11,7}, {2000,11,8}, {2000,11,9}, {2000,11,10}, {2000,11,11}, {2000,11,12}, {2000,11,13}, {2000,11,14}, {2000,11,15}, {2000,11,16}, {2000,11,17}, {2000,11,18}, {2000,11,19}, {2000,11,20}, {2000,11,21}, {2000,11,22}, 
-{2000,11,23}, {2000,11,24}, {2000,11,25}, {2000,11,26}, {2000,11,27}, {2000,11,28}, {2000,11,29}, {2000,11,30}, {2000,12,1}, {2000,12,2}, {2000,12,3}, {2000,12,4}, {2000,12,5}, {2000,12,6}, {2000,12,7}, {2000,12,8}, {2000,12,9}, {2000,12,10}, {2000,12,11}, {2000,12,12}, {2000,12,13}, {2000,12,14}, {2000,12,15}, {2000,12,16}, {2000,12,17}, {2000,12,18}, {2000,12,19}, {2000,12,20}, {2000,12,21}, {2000,12,22}, {2000,12,23}, {2000,12,24}, 
-{2000,12,25}, {2000,12,26}, {2000,12,27}, {2000,12,28}, {2000,12,29}, {2000,12,30}, {2000,12,31}, {2001,1,1}, {2001,1,2}, {2001,1,3}, {2001,1,4}, {2001,1,5}, {2001,1,6}, {2001,1,7}, {2001,1,8}, {2001,1,9}, {2001,1,10}, {2001,1,11}, {2001,1,12}, {2001,1,13}, {2001,1,14}, {2001,1,15}, {2001,1,16}, {2001,1,17}, {2001,1,18}, {2001,1,19}, {2001,1,20}, {2001,1,21}, {2001,1,22}, {2001,1,23}, {2001,1,24}, {2001,1,25}, 
-{2001,1,26}, {2001,1,27}, {2001,1,28}, {2001,1,29}, {2001,1,30}, {2001,1,31}, {2001,2,1}, {2001,2,2}, {2001,2,3}, {2001,2,4}, {2001,2,5}, {2001,2,6}, {2001,2,7}, {2001,2,8}, {2001,2,9}, {2001,2,10}, {2001,2,11}, {2001,2,12}, {2001,2,13}, {2001,2,14}, {2001,2,15}, {2001,2,16}, {2001,2,17}, {2001,2,18}, {2001,2,19}, {2001,2,20}, {2001,2,21}, {2001,2,22}, {2001,2,23}, {2001,2,24}, {2001,2,25}, {2001,2,26}, 
-{2001,2,27}, {2001,2,28}, {2001,3,1}, {2001,3,2}, {2001,3,3}, {2001,3,4}, {2001,3,5}, {2001,3,6}, {2001,3,7}, {2001,3,8}, {2001,3,9}, {2001,3,10}, {2001,3,11}, {2001,3,12}, {2001,3,13}, {2001,3,14}, {2001,3,15}, {2001,3,16}, {2001,3,17}, {2001,3,18}, {2001,3,19}, {2001,3,20}, {2001,3,21}, {2001,3,22}, {2001,3,23}, {2001,3,24}, {2001,3,25}, {2001,3,26}, {2001,3,27}, {2001,3,28}, {2001,3,29}, {2001,3,30}, 
-{2001,3,31}, {2001,4,1}, {2001,4,2}, {2001,4,3}, {2001,4,4}, {2001,4,5}, {2001,4,6}, {2001,4,7}, {2001,4,8}, {2001,4,9}, {2001,4,10}, {2001,4,11}, {2001,4,12}, {2001,4,13}, {2001,4,14}, {2001,4,15}, {2001,4,16}, {2001,4,17}, {2001,4,18}, {2001,4,19}, {2001,4,20}, {2001,4,21}, {2001,4,22}, {2001,4,23}, {2001,4,24}, {2001,4,25}, {2001,4,26}, {2001,4,27}, {2001,4,28}, {2001,4,29}, {2001,4,30}, {2001,5,1}, 
-{2001,5,2}, {2001,5,3}, {2001,5,4}, {2001,5,5}, {2001,5,6}, {2001,5,7}, {2001,5,8}, {2001,5,9}, {2001,5,10}, {2001,5,11}, {2001,5,12}, {2001,5,13}, {2001,5,14}, {2001,5,15}, {2001,5,16}, {2001,5,17}, {2001,5,18}, {2001,5,19}, {2001,5,20}, {2001,5,21}, {2001,5,22}, {2001,5,23}, {2001,5,24}, {2001,5,25}, {2001,5,26}, {2001,5,27}, {2001,5,28}, {2001,5,29}, {2001,5,30}, {2001,5,31}, {2001,6,1}, {2001,6,2}, 
-{2001,6,3}, {2001,6,4}, {2001,6,5}, {2001,6,6}, {2001,6,7}, {2001,6,8}, {2001,6,9}, {2001,6,10}, {2001,6,11}, {2001,6,12}, {2001,6,13}, {2001,6,14}, {2001,6,15}, {2001,6,16}, {2001,6,17}, {2001,6,18}, {2001,6,19}, {2001,6,20}, {2001,6,21}, {2001,6,22}, {2001,6,23}, {2001,6,24}, {2001,6,25}, {2001,6,26}, {2001,6,27}, {2001,6,28}, {2001,6,29}, {2001,6,30}, {2001,7,1}, {2001,7,2}, {2001,7,3}, {2001,7,4}, 
-{2001,7,5}, {2001,7,6}, {2001,7,7}, {2001,7,8}, {2001,7,9}, {2001,7,10}, {2001,7,11}, {2001,7,12}, {2001,7,13}, {2001,7,14}, {2001,7,15}, {2001,7,16}, {2001,7,17}, {2001,7,18}, {2001,7,19}, {2001,7,20}, {2001,7,21}, {2001,7,22}, {2001,7,23}, {2001,7,24}, {2001,7,25}, {2001,7,26}, {2001,7,27}, {2001,7,28}, {2001,7,29}, {2001,7,30}, {2001,7,31}, {2001,8,1}, {2001,8,2}, {2001,8,3}, {2001,8,4}, {2001,8,5}, 
-{2001,8,6}, {2001,8,7}, {2001,8,8}, {2001,8,9}, {2001,8,10}, {2001,8,11}, {2001,8,12}, {2001,8,13}, {2001,8,14}, {2001,8,15}, {2001,8,16}, {2001,8,17}, {2001,8,18}, {2001,8,19}, {2001,8,20}, {2001,8,21}, {2001,8,22}, {2001,8,23}, {2001,8,24}, {2001,8,25}, {2001,8,26}, {2001,8,27}, {2001,8,28}, {2001,8,29}, {2001,8,30}, {2001,8,31}, {2001,9,1}, {2001,9,2}, {2001,9,3}, {2001,9,4}, {2001,9,5}, {2001,9,6}, 
-{2001,9,7}, {2001,9,8}, {2001,9,9}, {2001,9,10}, {2001,9,11}, {2001,9,12}, {2001,9,13}, {2001,9,14}, {2001,9,15}, {2001,9,16}, {2001,9,17}, {2001,9,18}, {2001,9,19}, {2001,9,20}, {2001,9,21}, {2001,9,22}, {2001,9,23}, {2001,9,24}, {2001,9,25}, {2001,9,26}, {2001,9,27}, {2001,9,28}, {2001,9,29}, {2001,9,30}, {2001,10,1}, {2001,10,2}, {2001,10,3}, {2001,10,4}, {2001,10,5}, {2001,10,6}, {2001,10,7}, {2001,10,8}, 
-{2001,10,9}, {2001,10,10}, {2001,10,11}, {2001,10,12}, {2001,10,13}, {2001,10,14}, {2001,10,15}, {2001,10,16}, {2001,10,17}, {2001,10,18}, {2001,10,19}, {2001,10,20}, {2001,10,21}, {2001,10,22}, {2001,10,23}, {2001,10,24}, {2001,10,25}, {2001,10,26}, {2001,10,27}, {2001,10,28}, {2001,10,29}, {2001,10,30}, {2001,10,31}, {2001,11,1}, {2001,11,2}, {2001,11,3}, {2001,11,4}, {2001,11,5}, {2001,11,6}, {2001,11,7}, {2001,11,8}, {2001,11,9}, 
-{2001,11,10}, {2001,11,11}, {2001,11,12}, {2001,11,13}, {2001,11,14}, {2001,11,15}, {2001,11,16}, {2001,11,17}, {2001,11,18}, {2001,11,19}, {2001,11,20}, {2001,11,21}, {2001,11,22}, {2001,11,23}, {2001,11,24}, {2001,11,25}, {2001,11,26}, {2001,11,27}, {2001,11,28}, {2001,11,29}, {2001,11,30}, {2001,12,1}, {2001,12,2}, {2001,12,3}, {2001,12,4}, {2001,12,5}, {2001,12,6}, {2001,12,7}, {2001,12,8}, {2001,12,9}, {2001,12,10}, {2001,12,11}, 
-{2001,12,12}, {2001,12,13}, {2001,12,14}, {2001,12,15}, {2001,12,16}, {2001,12,17}, {2001,12,18}, {2001,12,19}, {2001,12,20}, {2001,12,21}, {2001,12,22}, {2001,12,23}, {2001,12,24}, {2001,12,25}, {2001,12,26}, {2001,12,27}, {2001,12,28}, {2001,12,29}, {2001,12,30}, {2001,12,31}, {2002,1,1}, {2002,1,2}, {2002,1,3}, {2002,1,4}, {2002,1,5}, {2002,1,6}, {2002,1,7}, {2002,1,8}, {2002,1,9}, {2002,1,10}, {2002,1,11}, {2002,1,12}, 
-{2002,1,13}, {2002,1,14}, {2002,1,15}, {2002,1,16}, {2002,1,17}, {2002,1,18}, {2002,1,19}, {2002,1,20}, {2002,1,21}, {2002,1,22}, {2002,1,23}, {2002,1,24}, {2002,1,25}, {2002,1,26}, {2002,1,27}, {2002,1,28}, {2002,1,29}, {2002,1,30}, {2002,1,31}, {2002,2,1}, {2002,2,2}, {2002,2,3}, {2002,2,4}, {2002,2,5}, {2002,2,6}, {2002,2,7}, {2002,2,8}, {2002,2,9}, {2002,2,10}, {2002,2,11}, {2002,2,12}, {2002,2,13}, 
-{2002,2,14}, {2002,2,15}, {2002,2,16}, {2002,2,17}, {2002,2,18}, {2002,2,19}, {2002,2,20}, {2002,2,21}, {2002,2,22}, {2002,2,23}, {2002,2,24}, {2002,2,25}, {2002,2,26}, {2002,2,27}, {2002,2,28}, {2002,3,1}, {2002,3,2}, {2002,3,3}, {2002,3,4}, {2002,3,5}, {2002,3,6}, {2002,3,7}, {2002,3,8}, {2002,3,9}, {2002,3,10}, {2002,3,11}, {2002,3,12}, {2002,3,13}, {2002,3,14}, {2002,3,15}, {2002,3,16}, {2002,3,17}, 
-{2002,3,18}, {2002,3,19}, {2002,3,20}, {2002,3,21}, {2002,3,22}, {2002,3,23}, {2002,3,24}, {2002,3,25}, {2002,3,26}, {2002,3,27}, {2002,3,28}, {2002,3,29}, {2002,3,30}, {2002,3,31}, {2002,4,1}, {2002,4,2}, {2002,4,3}, {2002,4,4}, {2002,4,5}, {2002,4,6}, {2002,4,7}, {2002,4,8}, {2002,4,9}, {2002,4,10}, {2002,4,11}, {2002,4,12}, {2002,4,13}, {2002,4,14}, {2002,4,15}, {2002,4,16}, {2002,4,17}, {2002,4,18}, 
-{2002,4,19}, {2002,4,20}, {2002,4,21}, {2002,4,22}, {2002,4,23}, {2002,4,24}, {2002,4,25}, {2002,4,26}, {2002,4,27}, {2002,4,28}, {2002,4,29}, {2002,4,30}, {2002,5,1}, {2002,5,2}, {2002,5,3}, {2002,5,4}, {2002,5,5}, {2002,5,6}, {2002,5,7}, {2002,5,8}, {2002,5,9}, {2002,5,10}, {2002,5,11}, {2002,5,12}, {2002,5,13}, {2002,5,14}, {2002,5,15}, {2002,5,16}, {2002,5,17}, {2002,5,18}, {2002,5,19}, {2002,5,20}, 
-{2002,5,21}, {2002,5,22}, {2002,5,23}, {2002,5,24}, {2002,5,25}, {2002,5,26}, {2002,5,27}, {2002,5,28}, {2002,5,29}, {2002,5,30}, {2002,5,31}, {2002,6,1}, {2002,6,2}, {2002,6,3}, {2002,6,4}, {2002,6,5}, {2002,6,6}, {2002,6,7}, {2002,6,8}, {2002,6,9}, {2002,6,10}, {2002,6,11}, {2002,6,12}, {2002,6,13}, {2002,6,14}, {2002,6,15}, {2002,6,16}, {2002,6,17}, {2002,6,18}, {2002,6,19}, {2002,6,20}, {2002,6,21}, 
-{2002,6,22}, {2002,6,23}, {2002,6,24}, {2002,6,25}, {2002,6,26}, {2002,6,27}, {2002,6,28}, {2002,6,29}, {2002,6,30}, {2002,7,1}, {2002,7,2}, {2002,7,3}, {2002,7,4}, {2002,7,5}, {2002,7,6}, {2002,7,7}, {2002,7,8}, {2002,7,9}, {2002,7,10}, {2002,7,11}, {2002,7,12}, {2002,7,13}, {2002,7,14}, {2002,7,15}, {2002,7,16}, {2002,7,17}, {2002,7,18}, {2002,7,19}, {2002,7,20}, {2002,7,21}, {2002,7,22}, {2002,7,23}, 
-{2002,7,24}, {2002,7,25}, {2002,7,26}, {2002,7,27}, {2002,7,28}, {2002,7,29}, {2002,7,30}, {2002,7,31}, {2002,8,1}, {2002,8,2}, {2002,8,3}, {2002,8,4}, {2002,8,5}, {2002,8,6}, {2002,8,7}, {2002,8,8}, {2002,8,9}, {2002,8,10}, {2002,8,11}, {2002,8,12}, {2002,8,13}, {2002,8,14}, {2002,8,15}, {2002,8,16}, {2002,8,17}, {2002,8,18}, {2002,8,19}, {2002,8,20}, {2002,8,21}, {2002,8,22}, {2002,8,23}, {2002,8,24}, 
-{2002,8,25}, {2002,8,26}, {2002,8,27}, {2002,8,28}, {2002,8,29}, {2002,8,30}, {2002,8,31}, {2002,9,1}, {2002,9,2}, {2002,9,3}, {2002,9,4}, {2002,9,5}, {2002,9,6}, {2002,9,7}, {2002,9,8}, {2002,9,9}, {2002,9,10}, {2002,9,11}, {2002,9,12}, {2002,9,13}, {2002,9,14}, {2002,9,15}, {2002,9,16}, {2002,9,17}, {2002,9,18}, {2002,9,19}, {2002,9,20}, {2002,9,21}, {2002,9,22}, {2002,9,23}, {2002,9,24}, {2002,9,25}, 
-{2002,9,26}, {2002,9,27}, {2002,9,28}, {2002,9,29}, {2002,9,30}, {2002,10,1}, {2002,10,2}, {2002,10,3}, {2002,10,4}, {2002,10,5}, {2002,10,6}, {2002,10,7}, {2002,10,8}, {2002,10,9}, {2002,10,10}, {2002,10,11}, {2002,10,12}, {2002,10,13}, {2002,10,14}, {2002,10,15}, {2002,10,16}, {2002,10,17}, {2002,10,18}, {2002,10,19}, {2002,10,20}, {2002,10,21}, {2002,10,22}, {2002,10,23}, {2002,10,24}, {2002,10,25}, {2002,10,26}, {2002,10,27}, 
-{2002,10,28}, {2002,10,29}, {2002,10,30}, {2002,10,31}, {2002,11,1}, {2002,11,2}, {2002,11,3}, {2002,11,4}, {2002,11,5}, {2002,11,6}, {2002,11,7}, {2002,11,8}, {2002,11,9}, {2002,11,10}, {2002,11,11}, {2002,11,12}, {2002,11,13}, {2002,11,14}, {2002,11,15}, {2002,11,16}, {2002,11,17}, {2002,11,18}, {2002,11,19}, {2002,11,20}, {2002,11,21}, {2002,11,22}, {2002,11,23}, {2002,11,24}, {2002,11,25}, {2002,11,26}, {2002,11,27}, {2002,11,28}, 
-{2002,11,29}, {2002,11,30}, {2002,12,1}, {2002,12,2}, {2002,12,3}, {2002,12,4}, {2002,12,5}, {2002,12,6}, {2002,12,7}, {2002,12,8}, {2002,12,9}, {2002,12,10}, {2002,12,11}, {2002,12,12}, {2002,12,13}, {2002,12,14}, {2002,12,15}, {2002,12,16}, {2002,12,17}, {2002,12,18}, {2002,12,19}, {2002,12,20}, {2002,12,21}, {2002,12,22}, {2002,12,23}, {2002,12,24}, {2002,12,25}, {2002,12,26}, {2002,12,27}, {2002,12,28}, {2002,12,29}, {2002,12,30}, 
-{2002,12,31}, {2003,1,1}, {2003,1,2}, {2003,1,3}, {2003,1,4}, {2003,1,5}, {2003,1,6}, {2003,1,7}, {2003,1,8}, {2003,1,9}, {2003,1,10}, {2003,1,11}, {2003,1,12}, {2003,1,13}, {2003,1,14}, {2003,1,15}, {2003,1,16}, {2003,1,17}, {2003,1,18}, {2003,1,19}, {2003,1,20}, {2003,1,21}, {2003,1,22}, {2003,1,23}, {2003,1,24}, {2003,1,25}, {2003,1,26}, {2003,1,27}, {2003,1,28}, {2003,1,29}, {2003,1,30}, {2003,1,31}, 
-{2003,2,1}, {2003,2,2}, {2003,2,3}, {2003,2,4}, {2003,2,5}, {2003,2,6}, {2003,2,7}, {2003,2,8}, {2003,2,9}, {2003,2,10}, {2003,2,11}, {2003,2,12}, {2003,2,13}, {2003,2,14}, {2003,2,15}, {2003,2,16}, {2003,2,17}, {2003,2,18}, {2003,2,19}, {2003,2,20}, {2003,2,21}, {2003,2,22}, {2003,2,23}, {2003,2,24}, {2003,2,25}, {2003,2,26}, {2003,2,27}, {2003,2,28}, {2003,3,1}, {2003,3,2}, {2003,3,3}, {2003,3,4}, 
-{2003,3,5}, {2003,3,6}, {2003,3,7}, {2003,3,8}, {2003,3,9}, {2003,3,10}, {2003,3,11}, {2003,3,12}, {2003,3,13}, {2003,3,14}, {2003,3,15}, {2003,3,16}, {2003,3,17}, {2003,3,18}, {2003,3,19}, {2003,3,20}, {2003,3,21}, {2003,3,22}, {2003,3,23}, {2003,3,24}, {2003,3,25}, {2003,3,26}, {2003,3,27}, {2003,3,28}, {2003,3,29}, {2003,3,30}, {2003,3,31}, {2003,4,1}, {2003,4,2}, {2003,4,3}, {2003,4,4}, {2003,4,5}, 
-{2003,4,6}, {2003,4,7}, {2003,4,8}, {2003,4,9}, {2003,4,10}, {2003,4,11}, {2003,4,12}, {2003,4,13}, {2003,4,14}, {2003,4,15}, {2003,4,16}, {2003,4,17}, {2003,4,18}, {2003,4,19}, {2003,4,20}, {2003,4,21}, {2003,4,22}, {2003,4,23}, {2003,4,24}, {2003,4,25}, {2003,4,26}, {2003,4,27}, {2003,4,28}, {2003,4,29}, {2003,4,30}, {2003,5,1}, {2003,5,2}, {2003,5,3}, {2003,5,4}, {2003,5,5}, {2003,5,6}, {2003,5,7}, 
-{2003,5,8}, {2003,5,9}, {2003,5,10}, {2003,5,11}, {2003,5,12}, {2003,5,13}, {2003,5,14}, {2003,5,15}, {2003,5,16}, {2003,5,17}, {2003,5,18}, {2003,5,19}, {2003,5,20}, {2003,5,21}, {2003,5,22}, {2003,5,23}, {2003,5,24}, {2003,5,25}, {2003,5,26}, {2003,5,27}, {2003,5,28}, {2003,5,29}, {2003,5,30}, {2003,5,31}, {2003,6,1}, {2003,6,2}, {2003,6,3}, {2003,6,4}, {2003,6,5}, {2003,6,6}, {2003,6,7}, {2003,6,8}, 
-{2003,6,9}, {2003,6,10}, {2003,6,11}, {2003,6,12}, {2003,6,13}, {2003,6,14}, {2003,6,15}, {2003,6,16}, {2003,6,17}, {2003,6,18}, {2003,6,19}, {2003,6,20}, {2003,6,21}, {2003,6,22}, {2003,6,23}, {2003,6,24}, {2003,6,25}, {2003,6,26}, {2003,6,27}, {2003,6,28}, {2003,6,29}, {2003,6,30}, {2003,7,1}, {2003,7,2}, {2003,7,3}, {2003,7,4}, {2003,7,5}, {2003,7,6}, {2003,7,7}, {2003,7,8}, {2003,7,9}, {2003,7,10}, 
-{2003,7,11}, {2003,7,12}, {2003,7,13}, {2003,7,14}, {2003,7,15}, {2003,7,16}, {2003,7,17}, {2003,7,18}, {2003,7,19}, {2003,7,20}, {2003,7,21}, {2003,7,22}, {2003,7,23}, {2003,7,24}, {2003,7,25}, {2003,7,26}, {2003,7,27}, {2003,7,28}, {2003,7,29}, {2003,7,30}, {2003,7,31}, {2003,8,1}, {2003,8,2}, {2003,8,3}, {2003,8,4}, {2003,8,5}, {2003,8,6}, {2003,8,7}, {2003,8,8}, {2003,8,9}, {2003,8,10}, {2003,8,11}, 
-{2003,8,12}, {2003,8,13}, {2003,8,14}, {2003,8,15}, {2003,8,16}, {2003,8,17}, {2003,8,18}, {2003,8,19}, {2003,8,20}, {2003,8,21}, {2003,8,22}, {2003,8,23}, {2003,8,24}, {2003,8,25}, {2003,8,26}, {2003,8,27}, {2003,8,28}, {2003,8,29}, {2003,8,30}, {2003,8,31}, {2003,9,1}, {2003,9,2}, {2003,9,3}, {2003,9,4}, {2003,9,5}, {2003,9,6}, {2003,9,7}, {2003,9,8}, {2003,9,9}, {2003,9,10}, {2003,9,11}, {2003,9,12}, 
-{2003,9,13}, {2003,9,14}, {2003,9,15}, {2003,9,16}, {2003,9,17}, {2003,9,18}, {2003,9,19}, {2003,9,20}, {2003,9,21}, {2003,9,22}, {2003,9,23}, {2003,9,24}, {2003,9,25}, {2003,9,26}, {2003,9,27}, {2003,9,28}, {2003,9,29}, {2003,9,30}, {2003,10,1}, {2003,10,2}, {2003,10,3}, {2003,10,4}, {2003,10,5}, {2003,10,6}, {2003,10,7}, {2003,10,8}, {2003,10,9}, {2003,10,10}, {2003,10,11}, {2003,10,12}, {2003,10,13}, {2003,10,14}, 
-{2003,10,15}, {2003,10,16}, {2003,10,17}, {2003,10,18}, {2003,10,19}, {2003,10,20}, {2003,10,21}, {2003,10,22}, {2003,10,23}, {2003,10,24}, {2003,10,25}, {2003,10,26}, {2003,10,27}, {2003,10,28}, {2003,10,29}, {2003,10,30}, {2003,10,31}, {2003,11,1}, {2003,11,2}, {2003,11,3}, {2003,11,4}, {2003,11,5}, {2003,11,6}, {2003,11,7}, {2003,11,8}, {2003,11,9}, {2003,11,10}, {2003,11,11}, {2003,11,12}, {2003,11,13}, {2003,11,14}, {2003,11,15}, 
-{2003,11,16}, {2003,11,17}, {2003,11,18}, {2003,11,19}, {2003,11,20}, {2003,11,21}, {2003,11,22}, {2003,11,23}, {2003,11,24}, {2003,11,25}, {2003,11,26}, {2003,11,27}, {2003,11,28}, {2003,11,29}, {2003,11,30}, {2003,12,1}, {2003,12,2}, {2003,12,3}, {2003,12,4}, {2003,12,5}, {2003,12,6}, {2003,12,7}, {2003,12,8}, {2003,12,9}, {2003,12,10}, {2003,12,11}, {2003,12,12}, {2003,12,13}, {2003,12,14}, {2003,12,15}, {2003,12,16}, {2003,12,17}, 
-{2003,12,18}, {2003,12,19}, {2003,12,20}, {2003,12,21}, {2003,12,22}, {2003,12,23}, {2003,12,24}, {2003,12,25}, {2003,12,26}, {2003,12,27}, {2003,12,28}, {2003,12,29}, {2003,12,30}, {2003,12,31}, {2004,1,1}, {2004,1,2}, {2004,1,3}, {2004,1,4}, {2004,1,5}, {2004,1,6}, {2004,1,7}, {2004,1,8}, {2004,1,9}, {2004,1,10}, {2004,1,11}, {2004,1,12}, {2004,1,13}, {2004,1,14}, {2004,1,15}, {2004,1,16}, {2004,1,17}, {2004,1,18}, 
-{2004,1,19}, {2004,1,20}, {2004,1,21}, {2004,1,22}, {2004,1,23}, {2004,1,24}, {2004,1,25}, {2004,1,26}, {2004,1,27}, {2004,1,28}, {2004,1,29}, {2004,1,30}, {2004,1,31}, {2004,2,1}, {2004,2,2}, {2004,2,3}, {2004,2,4}, {2004,2,5}, {2004,2,6}, {2004,2,7}, {2004,2,8}, {2004,2,9}, {2004,2,10}, {2004,2,11}, {2004,2,12}, {2004,2,13}, {2004,2,14}, {2004,2,15}, {2004,2,16}, {2004,2,17}, {2004,2,18}, {2004,2,19}, 
-{2004,2,20}, {2004,2,21}, {2004,2,22}, {2004,2,23}, {2004,2,24}, {2004,2,25}, {2004,2,26}, {2004,2,27}, {2004,2,28}, {2004,2,29}, {2004,3,1}, {2004,3,2}, {2004,3,3}, {2004,3,4}, {2004,3,5}, {2004,3,6}, {2004,3,7}, {2004,3,8}, {2004,3,9}, {2004,3,10}, {2004,3,11}, {2004,3,12}, {2004,3,13}, {2004,3,14}, {2004,3,15}, {2004,3,16}, {2004,3,17}, {2004,3,18}, {2004,3,19}, {2004,3,20}, {2004,3,21}, {2004,3,22}, 
-{2004,3,23}, {2004,3,24}, {2004,3,25}, {2004,3,26}, {2004,3,27}, {2004,3,28}, {2004,3,29}, {2004,3,30}, {2004,3,31}, {2004,4,1}, {2004,4,2}, {2004,4,3}, {2004,4,4}, {2004,4,5}, {2004,4,6}, {2004,4,7}, {2004,4,8}, {2004,4,9}, {2004,4,10}, {2004,4,11}, {2004,4,12}, {2004,4,13}, {2004,4,14}, {2004,4,15}, {2004,4,16}, {2004,4,17}, {2004,4,18}, {2004,4,19}, {2004,4,20}, {2004,4,21}, {2004,4,22}, {2004,4,23}, 
-{2004,4,24}, {2004,4,25}, {2004,4,26}, {2004,4,27}, {2004,4,28}, {2004,4,29}, {2004,4,30}, {2004,5,1}, {2004,5,2}, {2004,5,3}, {2004,5,4}, {2004,5,5}, {2004,5,6}, {2004,5,7}, {2004,5,8}, {2004,5,9}, {2004,5,10}, {2004,5,11}, {2004,5,12}, {2004,5,13}, {2004,5,14}, {2004,5,15}, {2004,5,16}, {2004,5,17}, {2004,5,18}, {2004,5,19}, {2004,5,20}, {2004,5,21}, {2004,5,22}, {2004,5,23}, {2004,5,24}, {2004,5,25}, 
-{2004,5,26}, {2004,5,27}, {2004,5,28}, {2004,5,29}, {2004,5,30}, {2004,5,31}, {2004,6,1}, {2004,6,2}, {2004,6,3}, {2004,6,4}, {2004,6,5}, {2004,6,6}, {2004,6,7}, {2004,6,8}, {2004,6,9}, {2004,6,10}, {2004,6,11}, {2004,6,12}, {2004,6,13}, {2004,6,14}, {2004,6,15}, {2004,6,16}, {2004,6,17}, {2004,6,18}, {2004,6,19}, {2004,6,20}, {2004,6,21}, {2004,6,22}, {2004,6,23}, {2004,6,24}, {2004,6,25}, {2004,6,26}, 
-{2004,6,27}, {2004,6,28}, {2004,6,29}, {2004,6,30}, {2004,7,1}, {2004,7,2}, {2004,7,3}, {2004,7,4}, {2004,7,5}, {2004,7,6}, {2004,7,7}, {2004,7,8}, {2004,7,9}, {2004,7,10}, {2004,7,11}, {2004,7,12}, {2004,7,13}, {2004,7,14}, {2004,7,15}, {2004,7,16}, {2004,7,17}, {2004,7,18}, {2004,7,19}, {2004,7,20}, {2004,7,21}, {2004,7,22}, {2004,7,23}, {2004,7,24}, {2004,7,25}, {2004,7,26}, {2004,7,27}, {2004,7,28}, 
-{2004,7,29}, {2004,7,30}, {2004,7,31}, {2004,8,1}, {2004,8,2}, {2004,8,3}, {2004,8,4}, {2004,8,5}, {2004,8,6}, {2004,8,7}, {2004,8,8}, {2004,8,9}, {2004,8,10}, {2004,8,11}, {2004,8,12}, {2004,8,13}, {2004,8,14}, {2004,8,15}, {2004,8,16}, {2004,8,17}, {2004,8,18}, {2004,8,19}, {2004,8,20}, {2004,8,21}, {2004,8,22}, {2004,8,23}, {2004,8,24}, {2004,8,25}, {2004,8,26}, {2004,8,27}, {2004,8,28}, {2004,8,29}, 
-{2004,8,30}, {2004,8,31}, {2004,9,1}, {2004,9,2}, {2004,9,3}, {2004,9,4}, {2004,9,5}, {2004,9,6}, {2004,9,7}, {2004,9,8}, {2004,9,9}, {2004,9,10}, {2004,9,11}, {2004,9,12}, {2004,9,13}, {2004,9,14}, {2004,9,15}, {2004,9,16}, {2004,9,17}, {2004,9,18}, {2004,9,19}, {2004,9,20}, {2004,9,21}, {2004,9,22}, {2004,9,23}, {2004,9,24}, {2004,9,25}, {2004,9,26}, {2004,9,27}, {2004,9,28}, {2004,9,29}, {2004,9,30}, 
-{2004,10,1}, {2004,10,2}, {2004,10,3}, {2004,10,4}, {2004,10,5}, {2004,10,6}, {2004,10,7}, {2004,10,8}, {2004,10,9}, {2004,10,10}, {2004,10,11}, {2004,10,12}, {2004,10,13}, {2004,10,14}, {2004,10,15}, {2004,10,16}, {2004,10,17}, {2004,10,18}, {2004,10,19}, {2004,10,20}, {2004,10,21}, {2004,10,22}, {2004,10,23}, {2004,10,24}, {2004,10,25}, {2004,10,26}, {2004,10,27}, {2004,10,28}, {2004,10,29}, {2004,10,30}, {2004,10,31}, {2004,11,1}, 
-{2004,11,2}, {2004,11,3}, {2004,11,4}, {2004,11,5}, {2004,11,6}, {2004,11,7}, {2004,11,8}, {2004,11,9}, {2004,11,10}, {2004,11,11}, {2004,11,12}, {2004,11,13}, {2004,11,14}, {2004,11,15}, {2004,11,16}, {2004,11,17}, {2004,11,18}, {2004,11,19}, {2004,11,20}, {2004,11,21}, {2004,11,22}, {2004,11,23}, {2004,11,24}, {2004,11,25}, {2004,11,26}, {2004,11,27}, {2004,11,28}, {2004,11,29}, {2004,11,30}, {2004,12,1}, {2004,12,2}, {2004,12,3}, 
-{2004,12,4}, {2004,12,5}, {2004,12,6}, {2004,12,7}, {2004,12,8}, {2004,12,9}, {2004,12,10}, {2004,12,11}, {2004,12,12}, {2004,12,13}, {2004,12,14}, {2004,12,15}, {2004,12,16}, {2004,12,17}, {2004,12,18}, {2004,12,19}, {2004,12,20}, {2004,12,21}, {2004,12,22}, {2004,12,23}, {2004,12,24}, {2004,12,25}, {2004,12,26}, {2004,12,27}, {2004,12,28}, {2004,12,29}, {2004,12,30}, {2004,12,31}, {2005,1,1}, {2005,1,2}, {2005,1,3}, {2005,1,4}, 
-{2005,1,5}, {2005,1,6}, {2005,1,7}, {2005,1,8}, {2005,1,9}, {2005,1,10}, {2005,1,11}, {2005,1,12}, {2005,1,13}, {2005,1,14}, {2005,1,15}, {2005,1,16}, {2005,1,17}, {2005,1,18}, {2005,1,19}, {2005,1,20}, {2005,1,21}, {2005,1,22}, {2005,1,23}, {2005,1,24}, {2005,1,25}, {2005,1,26}, {2005,1,27}, {2005,1,28}, {2005,1,29}, {2005,1,30}, {2005,1,31}, {2005,2,1}, {2005,2,2}, {2005,2,3}, {2005,2,4}, {2005,2,5}, 
-{2005,2,6}, {2005,2,7}, {2005,2,8}, {2005,2,9}, {2005,2,10}, {2005,2,11}, {2005,2,12}, {2005,2,13}, {2005,2,14}, {2005,2,15}, {2005,2,16}, {2005,2,17}, {2005,2,18}, {2005,2,19}, {2005,2,20}, {2005,2,21}, {2005,2,22}, {2005,2,23}, {2005,2,24}, {2005,2,25}, {2005,2,26}, {2005,2,27}, {2005,2,28}, {2005,3,1}, {2005,3,2}, {2005,3,3}, {2005,3,4}, {2005,3,5}, {2005,3,6}, {2005,3,7}, {2005,3,8}, {2005,3,9}, 
-{2005,3,10}, {2005,3,11}, {2005,3,12}, {2005,3,13}, {2005,3,14}, {2005,3,15}, {2005,3,16}, {2005,3,17}, {2005,3,18}, {2005,3,19}, {2005,3,20}, {2005,3,21}, {2005,3,22}, {2005,3,23}, {2005,3,24}, {2005,3,25}, {2005,3,26}, {2005,3,27}, {2005,3,28}, {2005,3,29}, {2005,3,30}, {2005,3,31}, {2005,4,1}, {2005,4,2}, {2005,4,3}, {2005,4,4}, {2005,4,5}, {2005,4,6}, {2005,4,7}, {2005,4,8}, {2005,4,9}, {2005,4,10}, 
-{2005,4,11}, {2005,4,12}, {2005,4,13}, {2005,4,14}, {2005,4,15}, {2005,4,16}, {2005,4,17}, {2005,4,18}, {2005,4,19}, {2005,4,20}, {2005,4,21}, {2005,4,22}, {2005,4,23}, {2005,4,24}, {2005,4,25}, {2005,4,26}, {2005,4,27}, {2005,4,28}, {2005,4,29}, {2005,4,30}, {2005,5,1}, {2005,5,2}, {2005,5,3}, {2005,5,4}, {2005,5,5}, {2005,5,6}, {2005,5,7}, {2005,5,8}, {2005,5,9}, {2005,5,10}, {2005,5,11}, {2005,5,12}, 
-{2005,5,13}, {2005,5,14}, {2005,5,15}, {2005,5,16}, {2005,5,17}, {2005,5,18}, {2005,5,19}, {2005,5,20}, {2005,5,21}, {2005,5,22}, {2005,5,23}, {2005,5,24}, {2005,5,25}, {2005,5,26}, {2005,5,27}, {2005,5,28}, {2005,5,29}, {2005,5,30}, {2005,5,31}, {2005,6,1}, {2005,6,2}, {2005,6,3}, {2005,6,4}, {2005,6,5}, {2005,6,6}, {2005,6,7}, {2005,6,8}, {2005,6,9}, {2005,6,10}, {2005,6,11}, {2005,6,12}, {2005,6,13}, 
-{2005,6,14}, {2005,6,15}, {2005,6,16}, {2005,6,17}, {2005,6,18}, {2005,6,19}, {2005,6,20}, {2005,6,21}, {2005,6,22}, {2005,6,23}, {2005,6,24}, {2005,6,25}, {2005,6,26}, {2005,6,27}, {2005,6,28}, {2005,6,29}, {2005,6,30}, {2005,7,1}, {2005,7,2}, {2005,7,3}, {2005,7,4}, {2005,7,5}, {2005,7,6}, {2005,7,7}, {2005,7,8}, {2005,7,9}, {2005,7,10}, {2005,7,11}, {2005,7,12}, {2005,7,13}, {2005,7,14}, {2005,7,15}, 
-{2005,7,16}, {2005,7,17}, {2005,7,18}, {2005,7,19}, {2005,7,20}, {2005,7,21}, {2005,7,22}, {2005,7,23}, {2005,7,24}, {2005,7,25}, {2005,7,26}, {2005,7,27}, {2005,7,28}, {2005,7,29}, {2005,7,30}, {2005,7,31}, {2005,8,1}, {2005,8,2}, {2005,8,3}, {2005,8,4}, {2005,8,5}, {2005,8,6}, {2005,8,7}, {2005,8,8}, {2005,8,9}, {2005,8,10}, {2005,8,11}, {2005,8,12}, {2005,8,13}, {2005,8,14}, {2005,8,15}, {2005,8,16}, 
-{2005,8,17}, {2005,8,18}, {2005,8,19}, {2005,8,20}, {2005,8,21}, {2005,8,22}, {2005,8,23}, {2005,8,24}, {2005,8,25}, {2005,8,26}, {2005,8,27}, {2005,8,28}, {2005,8,29}, {2005,8,30}, {2005,8,31}, {2005,9,1}, {2005,9,2}, {2005,9,3}, {2005,9,4}, {2005,9,5}, {2005,9,6}, {2005,9,7}, {2005,9,8}, {2005,9,9}, {2005,9,10}, {2005,9,11}, {2005,9,12}, {2005,9,13}, {2005,9,14}, {2005,9,15}, {2005,9,16}, {2005,9,17}, 
-{2005,9,18}, {2005,9,19}, {2005,9,20}, {2005,9,21}, {2005,9,22}, {2005,9,23}, {2005,9,24}, {2005,9,25}, {2005,9,26}, {2005,9,27}, {2005,9,28}, {2005,9,29}, {2005,9,30}, {2005,10,1}, {2005,10,2}, {2005,10,3}, {2005,10,4}, {2005,10,5}, {2005,10,6}, {2005,10,7}, {2005,10,8}, {2005,10,9}, {2005,10,10}, {2005,10,11}, {2005,10,12}, {2005,10,13}, {2005,10,14}, {2005,10,15}, {2005,10,16}, {2005,10,17}, {2005,10,18}, {2005,10,19}, 
-{2005,10,20}, {2005,10,21}, {2005,10,22}, {2005,10,23}, {2005,10,24}, {2005,10,25}, {2005,10,26}, {2005,10,27}, {2005,10,28}, {2005,10,29}, {2005,10,30}, {2005,10,31}, {2005,11,1}, {2005,11,2}, {2005,11,3}, {2005,11,4}, {2005,11,5}, {2005,11,6}, {2005,11,7}, {2005,11,8}, {2005,11,9}, {2005,11,10}, {2005,11,11}, {2005,11,12}, {2005,11,13}, {2005,11,14}, {2005,11,15}, {2005,11,16}, {2005,11,17}, {2005,11,18}, {2005,11,19}, {2005,11,20}, 
-{2005,11,21}, {2005,11,22}, {2005,11,23}, {2005,11,24}, {2005,11,25}, {2005,11,26}, {2005,11,27}, {2005,11,28}, {2005,11,29}, {2005,11,30}, {2005,12,1}, {2005,12,2}, {2005,12,3}, {2005,12,4}, {2005,12,5}, {2005,12,6}, {2005,12,7}, {2005,12,8}, {2005,12,9}, {2005,12,10}, {2005,12,11}, {2005,12,12}, {2005,12,13}, {2005,12,14}, {2005,12,15}, {2005,12,16}, {2005,12,17}, {2005,12,18}, {2005,12,19}, {2005,12,20}, {2005,12,21}, {2005,12,22}, 
-{2005,12,23}, {2005,12,24}, {2005,12,25}, {2005,12,26}, {2005,12,27}, {2005,12,28}, {2005,12,29}, {2005,12,30}, {2005,12,31}, {2006,1,1}, {2006,1,2}, {2006,1,3}, {2006,1,4}, {2006,1,5}, {2006,1,6}, {2006,1,7}, {2006,1,8}, {2006,1,9}, {2006,1,10}, {2006,1,11}, {2006,1,12}, {2006,1,13}, {2006,1,14}, {2006,1,15}, {2006,1,16}, {2006,1,17}, {2006,1,18}, {2006,1,19}, {2006,1,20}, {2006,1,21}, {2006,1,22}, {2006,1,23}, 
-{2006,1,24}, {2006,1,25}, {2006,1,26}, {2006,1,27}, {2006,1,28}, {2006,1,29}, {2006,1,30}, {2006,1,31}, {2006,2,1}, {2006,2,2}, {2006,2,3}, {2006,2,4}, {2006,2,5}, {2006,2,6}, {2006,2,7}, {2006,2,8}, {2006,2,9}, {2006,2,10}, {2006,2,11}, {2006,2,12}, {2006,2,13}, {2006,2,14}, {2006,2,15}, {2006,2,16}, {2006,2,17}, {2006,2,18}, {2006,2,19}, {2006,2,20}, {2006,2,21}, {2006,2,22}, {2006,2,23}, {2006,2,24}, 
-{2006,2,25}, {2006,2,26}, {2006,2,27}, {2006,2,28}, {2006,3,1}, {2006,3,2}, {2006,3,3}, {2006,3,4}, {2006,3,5}, {2006,3,6}, {2006,3,7}, {2006,3,8}, {2006,3,9}, {2006,3,10}, {2006,3,11}, {2006,3,12}, {2006,3,13}, {2006,3,14}, {2006,3,15}, {2006,3,16}, {2006,3,17}, {2006,3,18}, {2006,3,19}, {2006,3,20}, {2006,3,21}, {2006,3,22}, {2006,3,23}, {2006,3,24}, {2006,3,25}, {2006,3,26}, {2006,3,27}, {2006,3,28}, 
-{2006,3,29}, {2006,3,30}, {2006,3,31}, {2006,4,1}, {2006,4,2}, {2006,4,3}, {2006,4,4}, {2006,4,5}, {2006,4,6}, {2006,4,7}, {2006,4,8}, {2006,4,9}, {2006,4,10}, {2006,4,11}, {2006,4,12}, {2006,4,13}, {2006,4,14}, {2006,4,15}, {2006,4,16}, {2006,4,17}, {2006,4,18}, {2006,4,19}, {2006,4,20}, {2006,4,21}, {2006,4,22}, {2006,4,23}, {2006,4,24}, {2006,4,25}, {2006,4,26}, {2006,4,27}, {2006,4,28}, {2006,4,29}, 
-{2006,4,30}, {2006,5,1}, {2006,5,2}, {2006,5,3}, {2006,5,4}, {2006,5,5}, {2006,5,6}, {2006,5,7}, {2006,5,8}, {2006,5,9}, {2006,5,10}, {2006,5,11}, {2006,5,12}, {2006,5,13}, {2006,5,14}, {2006,5,15}, {2006,5,16}, {2006,5,17}, {2006,5,18}, {2006,5,19}, {2006,5,20}, {2006,5,21}, {2006,5,22}, {2006,5,23}, {2006,5,24}, {2006,5,25}, {2006,5,26}, {2006,5,27}, {2006,5,28}, {2006,5,29}, {2006,5,30}, {2006,5,31}, 
-{2006,6,1}, {2006,6,2}, {2006,6,3}, {2006,6,4}, {2006,6,5}, {2006,6,6}, {2006,6,7}, {2006,6,8}, {2006,6,9}, {2006,6,10}, {2006,6,11}, {2006,6,12}, {2006,6,13}, {2006,6,14}, {2006,6,15}, {2006,6,16}, {2006,6,17}, {2006,6,18}, {2006,6,19}, {2006,6,20}, {2006,6,21}, {2006,6,22}, {2006,6,23}, {2006,6,24}, {2006,6,25}, {2006,6,26}, {2006,6,27}, {2006,6,28}, {2006,6,29}, {2006,6,30}, {2006,7,1}, {2006,7,2}, 
-{2006,7,3}, {2006,7,4}, {2006,7,5}, {2006,7,6}, {2006,7,7}, {2006,7,8}, {2006,7,9}, {2006,7,10}, {2006,7,11}, {2006,7,12}, {2006,7,13}, {2006,7,14}, {2006,7,15}, {2006,7,16}, {2006,7,17}, {2006,7,18}, {2006,7,19}, {2006,7,20}, {2006,7,21}, {2006,7,22}, {2006,7,23}, {2006,7,24}, {2006,7,25}, {2006,7,26}, {2006,7,27}, {2006,7,28}, {2006,7,29}, {2006,7,30}, {2006,7,31}, {2006,8,1}, {2006,8,2}, {2006,8,3}, 
-{2006,8,4}, {2006,8,5}, {2006,8,6}, {2006,8,7}, {2006,8,8}, {2006,8,9}, {2006,8,10}, {2006,8,11}, {2006,8,12}, {2006,8,13}, {2006,8,14}, {2006,8,15}, {2006,8,16}, {2006,8,17}, {2006,8,18}, {2006,8,19}, {2006,8,20}, {2006,8,21}, {2006,8,22}, {2006,8,23}, {2006,8,24}, {2006,8,25}, {2006,8,26}, {2006,8,27}, {2006,8,28}, {2006,8,29}, {2006,8,30}, {2006,8,31}, {2006,9,1}, {2006,9,2}, {2006,9,3}, {2006,9,4}, 
-{2006,9,5}, {2006,9,6}, {2006,9,7}, {2006,9,8}, {2006,9,9}, {2006,9,10}, {2006,9,11}, {2006,9,12}, {2006,9,13}, {2006,9,14}, {2006,9,15}, {2006,9,16}, {2006,9,17}, {2006,9,18}, {2006,9,19}, {2006,9,20}, {2006,9,21}, {2006,9,22}, {2006,9,23}, {2006,9,24}, {2006,9,25}, {2006,9,26}, {2006,9,27}, {2006,9,28}, {2006,9,29}, {2006,9,30}, {2006,10,1}, {2006,10,2}, {2006,10,3}, {2006,10,4}, {2006,10,5}, {2006,10,6}, 
-{2006,10,7}, {2006,10,8}, {2006,10,9}, {2006,10,10}, {2006,10,11}, {2006,10,12}, {2006,10,13}, {2006,10,14}, {2006,10,15}, {2006,10,16}, {2006,10,17}, {2006,10,18}, {2006,10,19}, {2006,10,20}, {2006,10,21}, {2006,10,22}, {2006,10,23}, {2006,10,24}, {2006,10,25}, {2006,10,26}, {2006,10,27}, {2006,10,28}, {2006,10,29}, {2006,10,30}, {2006,10,31}, {2006,11,1}, {2006,11,2}, {2006,11,3}, {2006,11,4}, {2006,11,5}, {2006,11,6}, {2006,11,7}, 
-{2006,11,8}, {2006,11,9}, {2006,11,10}, {2006,11,11}, {2006,11,12}, {2006,11,13}, {2006,11,14}, {2006,11,15}, {2006,11,16}, {2006,11,17}, {2006,11,18}, {2006,11,19}, {2006,11,20}, {2006,11,21}, {2006,11,22}, {2006,11,23}, {2006,11,24}, {2006,11,25}, {2006,11,26}, {2006,11,27}, {2006,11,28}, {2006,11,29}, {2006,11,30}, {2006,12,1}, {2006,12,2}, {2006,12,3}, {2006,12,4}, {2006,12,5}, {2006,12,6}, {2006,12,7}, {2006,12,8}, {2006,12,9}, 
-{2006,12,10}, {2006,12,11}, {2006,12,12}, {2006,12,13}, {2006,12,14}, {2006,12,15}, {2006,12,16}, {2006,12,17}, {2006,12,18}, {2006,12,19}, {2006,12,20}, {2006,12,21}, {2006,12,22}, {2006,12,23}, {2006,12,24}, {2006,12,25}, {2006,12,26}, {2006,12,27}, {2006,12,28}, {2006,12,29}, {2006,12,30}, {2006,12,31}, {2007,1,1}, {2007,1,2}, {2007,1,3}, {2007,1,4}, {2007,1,5}, {2007,1,6}, {2007,1,7}, {2007,1,8}, {2007,1,9}, {2007,1,10}, 
-{2007,1,11}, {2007,1,12}, {2007,1,13}, {2007,1,14}, {2007,1,15}, {2007,1,16}, {2007,1,17}, {2007,1,18}, {2007,1,19}, {2007,1,20}, {2007,1,21}, {2007,1,22}, {2007,1,23}, {2007,1,24}, {2007,1,25}, {2007,1,26}, {2007,1,27}, {2007,1,28}, {2007,1,29}, {2007,1,30}, {2007,1,31}, {2007,2,1}, {2007,2,2}, {2007,2,3}, {2007,2,4}, {2007,2,5}, {2007,2,6}, {2007,2,7}, {2007,2,8}, {2007,2,9}, {2007,2,10}, {2007,2,11}, 
-{2007,2,12}, {2007,2,13}, {2007,2,14}, {2007,2,15}, {2007,2,16}, {2007,2,17}, {2007,2,18}, {2007,2,19}, {2007,2,20}, {2007,2,21}, {2007,2,22}, {2007,2,23}, {2007,2,24}, {2007,2,25}, {2007,2,26}, {2007,2,27}, {2007,2,28}, {2007,3,1}, {2007,3,2}, {2007,3,3}, {2007,3,4}, {2007,3,5}, {2007,3,6}, {2007,3,7}, {2007,3,8}, {2007,3,9}, {2007,3,10}, {2007,3,11}, {2007,3,12}, {2007,3,13}, {2007,3,14}, {2007,3,15}, 
-{2007,3,16}, {2007,3,17}, {2007,3,18}, {2007,3,19}, {2007,3,20}, {2007,3,21}, {2007,3,22}, {2007,3,23}, {2007,3,24}, {2007,3,25}, {2007,3,26}, {2007,3,27}, {2007,3,28}, {2007,3,29}, {2007,3,30}, {2007,3,31}, {2007,4,1}, {2007,4,2}, {2007,4,3}, {2007,4,4}, {2007,4,5}, {2007,4,6}, {2007,4,7}, {2007,4,8}, {2007,4,9}, {2007,4,10}, {2007,4,11}, {2007,4,12}, {2007,4,13}, {2007,4,14}, {2007,4,15}, {2007,4,16}, 
-{2007,4,17}, {2007,4,18}, {2007,4,19}, {2007,4,20}, {2007,4,21}, {2007,4,22}, {2007,4,23}, {2007,4,24}, {2007,4,25}, {2007,4,26}, {2007,4,27}, {2007,4,28}, {2007,4,29}, {2007,4,30}, {2007,5,1}, {2007,5,2}, {2007,5,3}, {2007,5,4}, {2007,5,5}, {2007,5,6}, {2007,5,7}, {2007,5,8}, {2007,5,9}, {2007,5,10}, {2007,5,11}, {2007,5,12}, {2007,5,13}, {2007,5,14}, {2007,5,15}, {2007,5,16}, {2007,5,17}, {2007,5,18}, 
-{2007,5,19}, {2007,5,20}, {2007,5,21}, {2007,5,22}, {2007,5,23}, {2007,5,24}, {2007,5,25}, {2007,5,26}, {2007,5,27}, {2007,5,28}, {2007,5,29}, {2007,5,30}, {2007,5,31}, {2007,6,1}, {2007,6,2}, {2007,6,3}, {2007,6,4}, {2007,6,5}, {2007,6,6}, {2007,6,7}, {2007,6,8}, {2007,6,9}, {2007,6,10}, {2007,6,11}, {2007,6,12}, {2007,6,13}, {2007,6,14}, {2007,6,15}, {2007,6,16}, {2007,6,17}, {2007,6,18}, {2007,6,19}, 
-{2007,6,20}, {2007,6,21}, {2007,6,22}, {2007,6,23}, {2007,6,24}, {2007,6,25}, {2007,6,26}, {2007,6,27}, {2007,6,28}, {2007,6,29}, {2007,6,30}, {2007,7,1}, {2007,7,2}, {2007,7,3}, {2007,7,4}, {2007,7,5}, {2007,7,6}, {2007,7,7}, {2007,7,8}, {2007,7,9}, {2007,7,10}, {2007,7,11}, {2007,7,12}, {2007,7,13}, {2007,7,14}, {2007,7,15}, {2007,7,16}, {2007,7,17}, {2007,7,18}, {2007,7,19}, {2007,7,20}, {2007,7,21}, 
-{2007,7,22}, {2007,7,23}, {2007,7,24}, {2007,7,25}, {2007,7,26}, {2007,7,27}, {2007,7,28}, {2007,7,29}, {2007,7,30}, {2007,7,31}, {2007,8,1}, {2007,8,2}, {2007,8,3}, {2007,8,4}, {2007,8,5}, {2007,8,6}, {2007,8,7}, {2007,8,8}, {2007,8,9}, {2007,8,10}, {2007,8,11}, {2007,8,12}, {2007,8,13}, {2007,8,14}, {2007,8,15}, {2007,8,16}, {2007,8,17}, {2007,8,18}, {2007,8,19}, {2007,8,20}, {2007,8,21}, {2007,8,22}, 
-{2007,8,23}, {2007,8,24}, {2007,8,25}, {2007,8,26}, {2007,8,27}, {2007,8,28}, {2007,8,29}, {2007,8,30}, {2007,8,31}, {2007,9,1}, {2007,9,2}, {2007,9,3}, {2007,9,4}, {2007,9,5}, {2007,9,6}, {2007,9,7}, {2007,9,8}, {2007,9,9}, {2007,9,10}, {2007,9,11}, {2007,9,12}, {2007,9,13}, {2007,9,14}, {2007,9,15}, {2007,9,16}, {2007,9,17}, {2007,9,18}, {2007,9,19}, {2007,9,20}, {2007,9,21}, {2007,9,22}, {2007,9,23}, 
-{2007,9,24}, {2007,9,25}, {2007,9,26}, {2007,9,27}, {2007,9,28}, {2007,9,29}, {2007,9,30}, {2007,10,1}, {2007,10,2}, {2007,10,3}, {2007,10,4}, {2007,10,5}, {2007,10,6}, {2007,10,7}, {2007,10,8}, {2007,10,9}, {2007,10,10}, {2007,10,11}, {2007,10,12}, {2007,10,13}, {2007,10,14}, {2007,10,15}, {2007,10,16}, {2007,10,17}, {2007,10,18}, {2007,10,19}, {2007,10,20}, {2007,10,21}, {2007,10,22}, {2007,10,23}, {2007,10,24}, {2007,10,25}, 
-{2007,10,26}, {2007,10,27}, {2007,10,28}, {2007,10,29}, {2007,10,30}, {2007,10,31}, {2007,11,1}, {2007,11,2}, {2007,11,3}, {2007,11,4}, {2007,11,5}, {2007,11,6}, {2007,11,7}, {2007,11,8}, {2007,11,9}, {2007,11,10}, {2007,11,11}, {2007,11,12}, {2007,11,13}, {2007,11,14}, {2007,11,15}, {2007,11,16}, {2007,11,17}, {2007,11,18}, {2007,11,19}, {2007,11,20}, {2007,11,21}, {2007,11,22}, {2007,11,23}, {2007,11,24}, {2007,11,25}, {2007,11,26}, 
-{2007,11,27}, {2007,11,28}, {2007,11,29}, {2007,11,30}, {2007,12,1}, {2007,12,2}, {2007,12,3}, {2007,12,4}, {2007,12,5}, {2007,12,6}, {2007,12,7}, {2007,12,8}, {2007,12,9}, {2007,12,10}, {2007,12,11}, {2007,12,12}, {2007,12,13}, {2007,12,14}, {2007,12,15}, {2007,12,16}, {2007,12,17}, {2007,12,18}, {2007,12,19}, {2007,12,20}, {2007,12,21}, {2007,12,22}, {2007,12,23}, {2007,12,24}, {2007,12,25}, {2007,12,26}, {2007,12,27}, {2007,12,28}, 
-{2007,12,29}, {2007,12,30}, {2007,12,31}, {2008,1,1}, {2008,1,2}, {2008,1,3}, {2008,1,4}, {2008,1,5}, {2008,1,6}, {2008,1,7}, {2008,1,8}, {2008,1,9}, {2008,1,10}, {2008,1,11}, {2008,1,12}, {2008,1,13}, {2008,1,14}, {2008,1,15}, {2008,1,16}, {2008,1,17}, {2008,1,18}, {2008,1,19}, {2008,1,20}, {2008,1,21}, {2008,1,22}, {2008,1,23}, {2008,1,24}, {2008,1,25}, {2008,1,26}, {2008,1,27}, {2008,1,28}, {2008,1,29}, 
-{2008,1,30}, {2008,1,31}, {2008,2,1}, {2008,2,2}, {2008,2,3}, {2008,2,4}, {2008,2,5}, {2008,2,6}, {2008,2,7}, {2008,2,8}, {2008,2,9}, {2008,2,10}, {2008,2,11}, {2008,2,12}, {2008,2,13}, {2008,2,14}, {2008,2,15}, {2008,2,16}, {2008,2,17}, {2008,2,18}, {2008,2,19}, {2008,2,20}, {2008,2,21}, {2008,2,22}, {2008,2,23}, {2008,2,24}, {2008,2,25}, {2008,2,26}, {2008,2,27}, {2008,2,28}, {2008,2,29}, {2008,3,1}, 
-{2008,3,2}, {2008,3,3}, {2008,3,4}, {2008,3,5}, {2008,3,6}, {2008,3,7}, {2008,3,8}, {2008,3,9}, {2008,3,10}, {2008,3,11}, {2008,3,12}, {2008,3,13}, {2008,3,14}, {2008,3,15}, {2008,3,16}, {2008,3,17}, {2008,3,18}, {2008,3,19}, {2008,3,20}, {2008,3,21}, {2008,3,22}, {2008,3,23}, {2008,3,24}, {2008,3,25}, {2008,3,26}, {2008,3,27}, {2008,3,28}, {2008,3,29}, {2008,3,30}, {2008,3,31}, {2008,4,1}, {2008,4,2}, 
-{2008,4,3}, {2008,4,4}, {2008,4,5}, {2008,4,6}, {2008,4,7}, {2008,4,8}, {2008,4,9}, {2008,4,10}, {2008,4,11}, {2008,4,12}, {2008,4,13}, {2008,4,14}, {2008,4,15}, {2008,4,16}, {2008,4,17}, {2008,4,18}, {2008,4,19}, {2008,4,20}, {2008,4,21}, {2008,4,22}, {2008,4,23}, {2008,4,24}, {2008,4,25}, {2008,4,26}, {2008,4,27}, {2008,4,28}, {2008,4,29}, {2008,4,30}, {2008,5,1}, {2008,5,2}, {2008,5,3}, {2008,5,4}, 
-{2008,5,5}, {2008,5,6}, {2008,5,7}, {2008,5,8}, {2008,5,9}, {2008,5,10}, {2008,5,11}, {2008,5,12}, {2008,5,13}, {2008,5,14}, {2008,5,15}, {2008,5,16}, {2008,5,17}, {2008,5,18}, {2008,5,19}, {2008,5,20}, {2008,5,21}, {2008,5,22}, {2008,5,23}, {2008,5,24}, {2008,5,25}, {2008,5,26}, {2008,5,27}, {2008,5,28}, {2008,5,29}, {2008,5,30}, {2008,5,31}, {2008,6,1}, {2008,6,2}, {2008,6,3}, {2008,6,4}, {2008,6,5}, 
-{2008,6,6}, {2008,6,7}, {2008,6,8}, {2008,6,9}, {2008,6,10}, {2008,6,11}, {2008,6,12}, {2008,6,13}, {2008,6,14}, {2008,6,15}, {2008,6,16}, {2008,6,17}, {2008,6,18}, {2008,6,19}, {2008,6,20}, {2008,6,21}, {2008,6,22}, {2008,6,23}, {2008,6,24}, {2008,6,25}, {2008,6,26}, {2008,6,27}, {2008,6,28}, {2008,6,29}, {2008,6,30}, {2008,7,1}, {2008,7,2}, {2008,7,3}, {2008,7,4}, {2008,7,5}, {2008,7,6}, {2008,7,7}, 
-{2008,7,8}, {2008,7,9}, {2008,7,10}, {2008,7,11}, {2008,7,12}, {2008,7,13}, {2008,7,14}, {2008,7,15}, {2008,7,16}, {2008,7,17}, {2008,7,18}, {2008,7,19}, {2008,7,20}, {2008,7,21}, {2008,7,22}, {2008,7,23}, {2008,7,24}, {2008,7,25}, {2008,7,26}, {2008,7,27}, {2008,7,28}, {2008,7,29}, {2008,7,30}, {2008,7,31}, {2008,8,1}, {2008,8,2}, {2008,8,3}, {2008,8,4}, {2008,8,5}, {2008,8,6}, {2008,8,7}, {2008,8,8}, 
-{2008,8,9}, {2008,8,10}, {2008,8,11}, {2008,8,12}, {2008,8,13}, {2008,8,14}, {2008,8,15}, {2008,8,16}, {2008,8,17}, {2008,8,18}, {2008,8,19}, {2008,8,20}, {2008,8,21}, {2008,8,22}, {2008,8,23}, {2008,8,24}, {2008,8,25}, {2008,8,26}, {2008,8,27}, {2008,8,28}, {2008,8,29}, {2008,8,30}, {2008,8,31}, {2008,9,1}, {2008,9,2}, {2008,9,3}, {2008,9,4}, {2008,9,5}, {2008,9,6}, {2008,9,7}, {2008,9,8}, {2008,9,9}, 
-{2008,9,10}, {2008,9,11}, {2008,9,12}, {2008,9,13}, {2008,9,14}, {2008,9,15}, {2008,9,16}, {2008,9,17}, {2008,9,18}, {2008,9,19}, {2008,9,20}, {2008,9,21}, {2008,9,22}, {2008,9,23}, {2008,9,24}, {2008,9,25}, {2008,9,26}, {2008,9,27}, {2008,9,28}, {2008,9,29}, {2008,9,30}, {2008,10,1}, {2008,10,2}, {2008,10,3}, {2008,10,4}, {2008,10,5}, {2008,10,6}, {2008,10,7}, {2008,10,8}, {2008,10,9}, {2008,10,10}, {2008,10,11}, 
-{2008,10,12}, {2008,10,13}, {2008,10,14}, {2008,10,15}, {2008,10,16}, {2008,10,17}, {2008,10,18}, {2008,10,19}, {2008,10,20}, {2008,10,21}, {2008,10,22}, {2008,10,23}, {2008,10,24}, {2008,10,25}, {2008,10,26}, {2008,10,27}, {2008,10,28}, {2008,10,29}, {2008,10,30}, {2008,10,31}, {2008,11,1}, {2008,11,2}, {2008,11,3}, {2008,11,4}, {2008,11,5}, {2008,11,6}, {2008,11,7}, {2008,11,8}, {2008,11,9}, {2008,11,10}, {2008,11,11}, {2008,11,12}, 
-{2008,11,13}, {2008,11,14}, {2008,11,15}, {2008,11,16}, {2008,11,17}, {2008,11,18}, {2008,11,19}, {2008,11,20}, {2008,11,21}, {2008,11,22}, {2008,11,23}, {2008,11,24}, {2008,11,25}, {2008,11,26}, {2008,11,27}, {2008,11,28}, {2008,11,29}, {2008,11,30}, {2008,12,1}, {2008,12,2}, {2008,12,3}, {2008,12,4}, {2008,12,5}, {2008,12,6}, {2008,12,7}, {2008,12,8}, {2008,12,9}, {2008,12,10}, {2008,12,11}, {2008,12,12}, {2008,12,13}, {2008,12,14}, 
-{2008,12,15}, {2008,12,16}, {2008,12,17}, {2008,12,18}, {2008,12,19}, {2008,12,20}, {2008,12,21}, {2008,12,22}, {2008,12,23}, {2008,12,24}, {2008,12,25}, {2008,12,26}, {2008,12,27}, {2008,12,28}, {2008,12,29}, {2008,12,30}, {2008,12,31}, {2009,1,1}, {2009,1,2}, {2009,1,3}, {2009,1,4}, {2009,1,5}, {2009,1,6}, {2009,1,7}, {2009,1,8}, {2009,1,9}, {2009,1,10}, {2009,1,11}, {2009,1,12}, {2009,1,13}, {2009,1,14}, {2009,1,15}, 
-{2009,1,16}, {2009,1,17}, {2009,1,18}, {2009,1,19}, {2009,1,20}, {2009,1,21}, {2009,1,22}, {2009,1,23}, {2009,1,24}, {2009,1,25}, {2009,1,26}, {2009,1,27}, {2009,1,28}, {2009,1,29}, {2009,1,30}, {2009,1,31}, {2009,2,1}, {2009,2,2}, {2009,2,3}, {2009,2,4}, {2009,2,5}, {2009,2,6}, {2009,2,7}, {2009,2,8}, {2009,2,9}, {2009,2,10}, {2009,2,11}, {2009,2,12}, {2009,2,13}, {2009,2,14}, {2009,2,15}, {2009,2,16}, 
-{2009,2,17}, {2009,2,18}, {2009,2,19}, {2009,2,20}, {2009,2,21}, {2009,2,22}, {2009,2,23}, {2009,2,24}, {2009,2,25}, {2009,2,26}, {2009,2,27}, {2009,2,28}, {2009,3,1}, {2009,3,2}, {2009,3,3}, {2009,3,4}, {2009,3,5}, {2009,3,6}, {2009,3,7}, {2009,3,8}, {2009,3,9}, {2009,3,10}, {2009,3,11}, {2009,3,12}, {2009,3,13}, {2009,3,14}, {2009,3,15}, {2009,3,16}, {2009,3,17}, {2009,3,18}, {2009,3,19}, {2009,3,20}, 
-{2009,3,21}, {2009,3,22}, {2009,3,23}, {2009,3,24}, {2009,3,25}, {2009,3,26}, {2009,3,27}, {2009,3,28}, {2009,3,29}, {2009,3,30}, {2009,3,31}, {2009,4,1}, {2009,4,2}, {2009,4,3}, {2009,4,4}, {2009,4,5}, {2009,4,6}, {2009,4,7}, {2009,4,8}, {2009,4,9}, {2009,4,10}, {2009,4,11}, {2009,4,12}, {2009,4,13}, {2009,4,14}, {2009,4,15}, {2009,4,16}, {2009,4,17}, {2009,4,18}, {2009,4,19}, {2009,4,20}, {2009,4,21}, 
-{2009,4,22}, {2009,4,23}, {2009,4,24}, {2009,4,25}, {2009,4,26}, {2009,4,27}, {2009,4,28}, {2009,4,29}, {2009,4,30}, {2009,5,1}, {2009,5,2}, {2009,5,3}, {2009,5,4}, {2009,5,5}, {2009,5,6}, {2009,5,7}, {2009,5,8}, {2009,5,9}, {2009,5,10}, {2009,5,11}, {2009,5,12}, {2009,5,13}, {2009,5,14}, {2009,5,15}, {2009,5,16}, {2009,5,17}, {2009,5,18}, {2009,5,19}, {2009,5,20}, {2009,5,21}, {2009,5,22}, {2009,5,23}, 
-{2009,5,24}, {2009,5,25}, {2009,5,26}, {2009,5,27}, {2009,5,28}, {2009,5,29}, {2009,5,30}, {2009,5,31}, {2009,6,1}, {2009,6,2}, {2009,6,3}, {2009,6,4}, {2009,6,5}, {2009,6,6}, {2009,6,7}, {2009,6,8}, {2009,6,9}, {2009,6,10}, {2009,6,11}, {2009,6,12}, {2009,6,13}, {2009,6,14}, {2009,6,15}, {2009,6,16}, {2009,6,17}, {2009,6,18}, {2009,6,19}, {2009,6,20}, {2009,6,21}, {2009,6,22}, {2009,6,23}, {2009,6,24}, 
-{2009,6,25}, {2009,6,26}, {2009,6,27}, {2009,6,28}, {2009,6,29}, {2009,6,30}, {2009,7,1}, {2009,7,2}, {2009,7,3}, {2009,7,4}, {2009,7,5}, {2009,7,6}, {2009,7,7}, {2009,7,8}, {2009,7,9}, {2009,7,10}, {2009,7,11}, {2009,7,12}, {2009,7,13}, {2009,7,14}, {2009,7,15}, {2009,7,16}, {2009,7,17}, {2009,7,18}, {2009,7,19}, {2009,7,20}, {2009,7,21}, {2009,7,22}, {2009,7,23}, {2009,7,24}, {2009,7,25}, {2009,7,26}, 
-{2009,7,27}, {2009,7,28}, {2009,7,29}, {2009,7,30}, {2009,7,31}, {2009,8,1}, {2009,8,2}, {2009,8,3}, {2009,8,4}, {2009,8,5}, {2009,8,6}, {2009,8,7}, {2009,8,8}, {2009,8,9}, {2009,8,10}, {2009,8,11}, {2009,8,12}, {2009,8,13}, {2009,8,14}, {2009,8,15}, {2009,8,16}, {2009,8,17}, {2009,8,18}, {2009,8,19}, {2009,8,20}, {2009,8,21}, {2009,8,22}, {2009,8,23}, {2009,8,24}, {2009,8,25}, {2009,8,26}, {2009,8,27}, 
-{2009,8,28}, {2009,8,29}, {2009,8,30}, {2009,8,31}, {2009,9,1}, {2009,9,2}, {2009,9,3}, {2009,9,4}, {2009,9,5}, {2009,9,6}, {2009,9,7}, {2009,9,8}, {2009,9,9}, {2009,9,10}, {2009,9,11}, {2009,9,12}, {2009,9,13}, {2009,9,14}, {2009,9,15}, {2009,9,16}, {2009,9,17}, {2009,9,18}, {2009,9,19}, {2009,9,20}, {2009,9,21}, {2009,9,22}, {2009,9,23}, {2009,9,24}, {2009,9,25}, {2009,9,26}, {2009,9,27}, {2009,9,28}, 
-{2009,9,29}, {2009,9,30}, {2009,10,1}, {2009,10,2}, {2009,10,3}, {2009,10,4}, {2009,10,5}, {2009,10,6}, {2009,10,7}, {2009,10,8}, {2009,10,9}, {2009,10,10}, {2009,10,11}, {2009,10,12}, {2009,10,13}, {2009,10,14}, {2009,10,15}, {2009,10,16}, {2009,10,17}, {2009,10,18}, {2009,10,19}, {2009,10,20}, {2009,10,21}, {2009,10,22}, {2009,10,23}, {2009,10,24}, {2009,10,25}, {2009,10,26}, {2009,10,27}, {2009,10,28}, {2009,10,29}, {2009,10,30}, 
-{2009,10,31}, {2009,11,1}, {2009,11,2}, {2009,11,3}, {2009,11,4}, {2009,11,5}, {2009,11,6}, {2009,11,7}, {2009,11,8}, {2009,11,9}, {2009,11,10}, {2009,11,11}, {2009,11,12}, {2009,11,13}, {2009,11,14}, {2009,11,15}, {2009,11,16}, {2009,11,17}, {2009,11,18}, {2009,11,19}, {2009,11,20}, {2009,11,21}, {2009,11,22}, {2009,11,23}, {2009,11,24}, {2009,11,25}, {2009,11,26}, {2009,11,27}, {2009,11,28}, {2009,11,29}, {2009,11,30}, {2009,12,1}, 
-{2009,12,2}, {2009,12,3}, {2009,12,4}, {2009,12,5}, {2009,12,6}, {2009,12,7}, {2009,12,8}, {2009,12,9}, {2009,12,10}, {2009,12,11}, {2009,12,12}, {2009,12,13}, {2009,12,14}, {2009,12,15}, {2009,12,16}, {2009,12,17}, {2009,12,18}, {2009,12,19}, {2009,12,20}, {2009,12,21}, {2009,12,22}, {2009,12,23}, {2009,12,24}, {2009,12,25}, {2009,12,26}, {2009,12,27}, {2009,12,28}, {2009,12,29}, {2009,12,30}, {2009,12,31}, {2010,1,1}, {2010,1,2}, 
-{2010,1,3}, {2010,1,4}, {2010,1,5}, {2010,1,6}, {2010,1,7}, {2010,1,8}, {2010,1,9}, {2010,1,10}, {2010,1,11}, {2010,1,12}, {2010,1,13}, {2010,1,14}, {2010,1,15}, {2010,1,16}, {2010,1,17}, {2010,1,18}, {2010,1,19}, {2010,1,20}, {2010,1,21}, {2010,1,22}, {2010,1,23}, {2010,1,24}, {2010,1,25}, {2010,1,26}, {2010,1,27}, {2010,1,28}, {2010,1,29}, {2010,1,30}, {2010,1,31}, {2010,2,1}, {2010,2,2}, {2010,2,3}, 
-{2010,2,4}, {2010,2,5}, {2010,2,6}, {2010,2,7}, {2010,2,8}, {2010,2,9}, {2010,2,10}, {2010,2,11}, {2010,2,12}, {2010,2,13}, {2010,2,14}, {2010,2,15}, {2010,2,16}, {2010,2,17}, {2010,2,18}, {2010,2,19}, {2010,2,20}, {2010,2,21}, {2010,2,22}, {2010,2,23}, {2010,2,24}, {2010,2,25}, {2010,2,26}, {2010,2,27}, {2010,2,28}, {2010,3,1}, {2010,3,2}, {2010,3,3}, {2010,3,4}, {2010,3,5}, {2010,3,6}, {2010,3,7}, 
-{2010,3,8}, {2010,3,9}, {2010,3,10}, {2010,3,11}, {2010,3,12}, {2010,3,13}, {2010,3,14}, {2010,3,15}, {2010,3,16}, {2010,3,17}, {2010,3,18}, {2010,3,19}, {2010,3,20}, {2010,3,21}, {2010,3,22}, {2010,3,23}, {2010,3,24}, {2010,3,25}, {2010,3,26}, {2010,3,27}, {2010,3,28}, {2010,3,29}, {2010,3,30}, {2010,3,31}, {2010,4,1}, {2010,4,2}, {2010,4,3}, {2010,4,4}, {2010,4,5}, {2010,4,6}, {2010,4,7}, {2010,4,8}, 
-{2010,4,9}, {2010,4,10}, {2010,4,11}, {2010,4,12}, {2010,4,13}, {2010,4,14}, {2010,4,15}, {2010,4,16}, {2010,4,17}, {2010,4,18}, {2010,4,19}, {2010,4,20}, {2010,4,21}, {2010,4,22}, {2010,4,23}, {2010,4,24}, {2010,4,25}, {2010,4,26}, {2010,4,27}, {2010,4,28}, {2010,4,29}, {2010,4,30}, {2010,5,1}, {2010,5,2}, {2010,5,3}, {2010,5,4}, {2010,5,5}, {2010,5,6}, {2010,5,7}, {2010,5,8}, {2010,5,9}, {2010,5,10}, 
-{2010,5,11}, {2010,5,12}, {2010,5,13}, {2010,5,14}, {2010,5,15}, {2010,5,16}, {2010,5,17}, {2010,5,18}, {2010,5,19}, {2010,5,20}, {2010,5,21}, {2010,5,22}, {2010,5,23}, {2010,5,24}, {2010,5,25}, {2010,5,26}, {2010,5,27}, {2010,5,28}, {2010,5,29}, {2010,5,30}, {2010,5,31}, {2010,6,1}, {2010,6,2}, {2010,6,3}, {2010,6,4}, {2010,6,5}, {2010,6,6}, {2010,6,7}, {2010,6,8}, {2010,6,9}, {2010,6,10}, {2010,6,11}, 
-{2010,6,12}, {2010,6,13}, {2010,6,14}, {2010,6,15}, {2010,6,16}, {2010,6,17}, {2010,6,18}, {2010,6,19}, {2010,6,20}, {2010,6,21}, {2010,6,22}, {2010,6,23}, {2010,6,24}, {2010,6,25}, {2010,6,26}, {2010,6,27}, {2010,6,28}, {2010,6,29}, {2010,6,30}, {2010,7,1}, {2010,7,2}, {2010,7,3}, {2010,7,4}, {2010,7,5}, {2010,7,6}, {2010,7,7}, {2010,7,8}, {2010,7,9}, {2010,7,10}, {2010,7,11}, {2010,7,12}, {2010,7,13}, 
-{2010,7,14}, {2010,7,15}, {2010,7,16}, {2010,7,17}, {2010,7,18}, {2010,7,19}, {2010,7,20}, {2010,7,21}, {2010,7,22}, {2010,7,23}, {2010,7,24}, {2010,7,25}, {2010,7,26}, {2010,7,27}, {2010,7,28}, {2010,7,29}, {2010,7,30}, {2010,7,31}, {2010,8,1}, {2010,8,2}, {2010,8,3}, {2010,8,4}, {2010,8,5}, {2010,8,6}, {2010,8,7}, {2010,8,8}, {2010,8,9}, {2010,8,10}, {2010,8,11}, {2010,8,12}, {2010,8,13}, {2010,8,14}, 
-{2010,8,15}, {2010,8,16}, {2010,8,17}, {2010,8,18}, {2010,8,19}, {2010,8,20}, {2010,8,21}, {2010,8,22}, {2010,8,23}, {2010,8,24}, {2010,8,25}, {2010,8,26}, {2010,8,27}, {2010,8,28}, {2010,8,29}, {2010,8,30}, {2010,8,31}, {2010,9,1}, {2010,9,2}, {2010,9,3}, {2010,9,4}, {2010,9,5}, {2010,9,6}, {2010,9,7}, {2010,9,8}, {2010,9,9}, {2010,9,10}, {2010,9,11}, {2010,9,12}, {2010,9,13}, {2010,9,14}, {2010,9,15}, 
-{2010,9,16}, {2010,9,17}, {2010,9,18}, {2010,9,19}, {2010,9,20}, {2010,9,21}, {2010,9,22}, {2010,9,23}, {2010,9,24}, {2010,9,25}, {2010,9,26}, {2010,9,27}, {2010,9,28}, {2010,9,29}, {2010,9,30}, {2010,10,1}, {2010,10,2}, {2010,10,3}, {2010,10,4}, {2010,10,5}, {2010,10,6}, {2010,10,7}, {2010,10,8}, {2010,10,9}, {2010,10,10}, {2010,10,11}, {2010,10,12}, {2010,10,13}, {2010,10,14}, {2010,10,15}, {2010,10,16}, {2010,10,17}, 
-{2010,10,18}, {2010,10,19}, {2010,10,20}, {2010,10,21}, {2010,10,22}, {2010,10,23}, {2010,10,24}, {2010,10,25}, {2010,10,26}, {2010,10,27}, {2010,10,28}, {2010,10,29}, {2010,10,30}, {2010,10,31}, {2010,11,1}, {2010,11,2}, {2010,11,3}, {2010,11,4}, {2010,11,5}, {2010,11,6}, {2010,11,7}, {2010,11,8}, {2010,11,9}, {2010,11,10}, {2010,11,11}, {2010,11,12}, {2010,11,13}, {2010,11,14}, {2010,11,15}, {2010,11,16}, {2010,11,17}, {2010,11,18}, 
-{2010,11,19}, {2010,11,20}, {2010,11,21}, {2010,11,22}, {2010,11,23}, {2010,11,24}, {2010,11,25}, {2010,11,26}, {2010,11,27}, {2010,11,28}, {2010,11,29}, {2010,11,30}, {2010,12,1}, {2010,12,2}, {2010,12,3}, {2010,12,4}, {2010,12,5}, {2010,12,6}, {2010,12,7}, {2010,12,8}, {2010,12,9}, {2010,12,10}, {2010,12,11}, {2010,12,12}, {2010,12,13}, {2010,12,14}, {2010,12,15}, {2010,12,16}, {2010,12,17}, {2010,12,18}, {2010,12,19}, {2010,12,20}, 
-{2010,12,21}, {2010,12,22}, {2010,12,23}, {2010,12,24}, {2010,12,25}, {2010,12,26}, {2010,12,27}, {2010,12,28}, {2010,12,29}, {2010,12,30}, {2010,12,31}, {2011,1,1}, {2011,1,2}, {2011,1,3}, {2011,1,4}, {2011,1,5}, {2011,1,6}, {2011,1,7}, {2011,1,8}, {2011,1,9}, {2011,1,10}, {2011,1,11}, {2011,1,12}, {2011,1,13}, {2011,1,14}, {2011,1,15}, {2011,1,16}, {2011,1,17}, {2011,1,18}, {2011,1,19}, {2011,1,20}, {2011,1,21}, 
-{2011,1,22}, {2011,1,23}, {2011,1,24}, {2011,1,25}, {2011,1,26}, {2011,1,27}, {2011,1,28}, {2011,1,29}, {2011,1,30}, {2011,1,31}, {2011,2,1}, {2011,2,2}, {2011,2,3}, {2011,2,4}, {2011,2,5}, {2011,2,6}, {2011,2,7}, {2011,2,8}, {2011,2,9}, {2011,2,10}, {2011,2,11}, {2011,2,12}, {2011,2,13}, {2011,2,14}, {2011,2,15}, {2011,2,16}, {2011,2,17}, {2011,2,18}, {2011,2,19}, {2011,2,20}, {2011,2,21}, {2011,2,22}, 
-{2011,2,23}, {2011,2,24}, {2011,2,25}, {2011,2,26}, {2011,2,27}, {2011,2,28}, {2011,3,1}, {2011,3,2}, {2011,3,3}, {2011,3,4}, {2011,3,5}, {2011,3,6}, {2011,3,7}, {2011,3,8}, {2011,3,9}, {2011,3,10}, {2011,3,11}, {2011,3,12}, {2011,3,13}, {2011,3,14}, {2011,3,15}, {2011,3,16}, {2011,3,17}, {2011,3,18}, {2011,3,19}, {2011,3,20}, {2011,3,21}, {2011,3,22}, {2011,3,23}, {2011,3,24}, {2011,3,25}, {2011,3,26}, 
-{2011,3,27}, {2011,3,28}, {2011,3,29}, {2011,3,30}, {2011,3,31}, {2011,4,1}, {2011,4,2}, {2011,4,3}, {2011,4,4}, {2011,4,5}, {2011,4,6}, {2011,4,7}, {2011,4,8}, {2011,4,9}, {2011,4,10}, {2011,4,11}, {2011,4,12}, {2011,4,13}, {2011,4,14}, {2011,4,15}, {2011,4,16}, {2011,4,17}, {2011,4,18}, {2011,4,19}, {2011,4,20}, {2011,4,21}, {2011,4,22}, {2011,4,23}, {2011,4,24}, {2011,4,25}, {2011,4,26}, {2011,4,27}, 
-{2011,4,28}, {2011,4,29}, {2011,4,30}, {2011,5,1}, {2011,5,2}, {2011,5,3}, {2011,5,4}, {2011,5,5}, {2011,5,6}, {2011,5,7}, {2011,5,8}, {2011,5,9}, {2011,5,10}, {2011,5,11}, {2011,5,12}, {2011,5,13}, {2011,5,14}, {2011,5,15}, {2011,5,16}, {2011,5,17}, {2011,5,18}, {2011,5,19}, {2011,5,20}, {2011,5,21}, {2011,5,22}, {2011,5,23}, {2011,5,24}, {2011,5,25}, {2011,5,26}, {2011,5,27}, {2011,5,28}, {2011,5,29}, 
-{2011,5,30}, {2011,5,31}, {2011,6,1}, {2011,6,2}, {2011,6,3}, {2011,6,4}, {2011,6,5}, {2011,6,6}, {2011,6,7}, {2011,6,8}, {2011,6,9}, {2011,6,10}, {2011,6,11}, {2011,6,12}, {2011,6,13}, {2011,6,14}, {2011,6,15}, {2011,6,16}, {2011,6,17}, {2011,6,18}, {2011,6,19}, {2011,6,20}, {2011,6,21}, {2011,6,22}, {2011,6,23}, {2011,6,24}, {2011,6,25}, {2011,6,26}, {2011,6,27}, {2011,6,28}, {2011,6,29}, {2011,6,30}, 
-{2011,7,1}, {2011,7,2}, {2011,7,3}, {2011,7,4}, {2011,7,5}, {2011,7,6}, {2011,7,7}, {2011,7,8}, {2011,7,9}, {2011,7,10}, {2011,7,11}, {2011,7,12}, {2011,7,13}, {2011,7,14}, {2011,7,15}, {2011,7,16}, {2011,7,17}, {2011,7,18}, {2011,7,19}, {2011,7,20}, {2011,7,21}, {2011,7,22}, {2011,7,23}, {2011,7,24}, {2011,7,25}, {2011,7,26}, {2011,7,27}, {2011,7,28}, {2011,7,29}, {2011,7,30}, {2011,7,31}, {2011,8,1}, 
-{2011,8,2}, {2011,8,3}, {2011,8,4}, {2011,8,5}, {2011,8,6}, {2011,8,7}, {2011,8,8}, {2011,8,9}, {2011,8,10}, {2011,8,11}, {2011,8,12}, {2011,8,13}, {2011,8,14}, {2011,8,15}, {2011,8,16}, {2011,8,17}, {2011,8,18}, {2011,8,19}, {2011,8,20}, {2011,8,21}, {2011,8,22}, {2011,8,23}, {2011,8,24}, {2011,8,25}, {2011,8,26}, {2011,8,27}, {2011,8,28}, {2011,8,29}, {2011,8,30}, {2011,8,31}, {2011,9,1}, {2011,9,2}, 
-{2011,9,3}, {2011,9,4}, {2011,9,5}, {2011,9,6}, {2011,9,7}, {2011,9,8}, {2011,9,9}, {2011,9,10}, {2011,9,11}, {2011,9,12}, {2011,9,13}, {2011,9,14}, {2011,9,15}, {2011,9,16}, {2011,9,17}, {2011,9,18}, {2011,9,19}, {2011,9,20}, {2011,9,21}, {2011,9,22}, {2011,9,23}, {2011,9,24}, {2011,9,25}, {2011,9,26}, {2011,9,27}, {2011,9,28}, {2011,9,29}, {2011,9,30}, {2011,10,1}, {2011,10,2}, {2011,10,3}, {2011,10,4}, 
-{2011,10,5}, {2011,10,6}, {2011,10,7}, {2011,10,8}, {2011,10,9}, {2011,10,10}, {2011,10,11}, {2011,10,12}, {2011,10,13}, {2011,10,14}, {2011,10,15}, {2011,10,16}, {2011,10,17}, {2011,10,18}, {2011,10,19}, {2011,10,20}, {2011,10,21}, {2011,10,22}, {2011,10,23}, {2011,10,24}, {2011,10,25}, {2011,10,26}, {2011,10,27}, {2011,10,28}, {2011,10,29}, {2011,10,30}, {2011,10,31}, {2011,11,1}, {2011,11,2}, {2011,11,3}, {2011,11,4}, {2011,11,5}, 
-{2011,11,6}, {2011,11,7}, {2011,11,8}, {2011,11,9}, {2011,11,10}, {2011,11,11}, {2011,11,12}, {2011,11,13}, {2011,11,14}, {2011,11,15}, {2011,11,16}, {2011,11,17}, {2011,11,18}, {2011,11,19}, {2011,11,20}, {2011,11,21}, {2011,11,22}, {2011,11,23}, {2011,11,24}, {2011,11,25}, {2011,11,26}, {2011,11,27}, {2011,11,28}, {2011,11,29}, {2011,11,30}, {2011,12,1}, {2011,12,2}, {2011,12,3}, {2011,12,4}, {2011,12,5}, {2011,12,6}, {2011,12,7}, 
-{2011,12,8}, {2011,12,9}, {2011,12,10}, {2011,12,11}, {2011,12,12}, {2011,12,13}, {2011,12,14}, {2011,12,15}, {2011,12,16}, {2011,12,17}, {2011,12,18}, {2011,12,19}, {2011,12,20}, {2011,12,21}, {2011,12,22}, {2011,12,23}, {2011,12,24}, {2011,12,25}, {2011,12,26}, {2011,12,27}, {2011,12,28}, {2011,12,29}, {2011,12,30}, {2011,12,31}, {2012,1,1}, {2012,1,2}, {2012,1,3}, {2012,1,4}, {2012,1,5}, {2012,1,6}, {2012,1,7}, {2012,1,8}, 
-{2012,1,9}, {2012,1,10}, {2012,1,11}, {2012,1,12}, {2012,1,13}, {2012,1,14}, {2012,1,15}, {2012,1,16}, {2012,1,17}, {2012,1,18}, {2012,1,19}, {2012,1,20}, {2012,1,21}, {2012,1,22}, {2012,1,23}, {2012,1,24}, {2012,1,25}, {2012,1,26}, {2012,1,27}, {2012,1,28}, {2012,1,29}, {2012,1,30}, {2012,1,31}, {2012,2,1}, {2012,2,2}, {2012,2,3}, {2012,2,4}, {2012,2,5}, {2012,2,6}, {2012,2,7}, {2012,2,8}, {2012,2,9}, 
-{2012,2,10}, {2012,2,11}, {2012,2,12}, {2012,2,13}, {2012,2,14}, {2012,2,15}, {2012,2,16}, {2012,2,17}, {2012,2,18}, {2012,2,19}, {2012,2,20}, {2012,2,21}, {2012,2,22}, {2012,2,23}, {2012,2,24}, {2012,2,25}, {2012,2,26}, {2012,2,27}, {2012,2,28}, {2012,2,29}, {2012,3,1}, {2012,3,2}, {2012,3,3}, {2012,3,4}, {2012,3,5}, {2012,3,6}, {2012,3,7}, {2012,3,8}, {2012,3,9}, {2012,3,10}, {2012,3,11}, {2012,3,12}, 
-{2012,3,13}, {2012,3,14}, {2012,3,15}, {2012,3,16}, {2012,3,17}, {2012,3,18}, {2012,3,19}, {2012,3,20}, {2012,3,21}, {2012,3,22}, {2012,3,23}, {2012,3,24}, {2012,3,25}, {2012,3,26}, {2012,3,27}, {2012,3,28}, {2012,3,29}, {2012,3,30}, {2012,3,31}, {2012,4,1}, {2012,4,2}, {2012,4,3}, {2012,4,4}, {2012,4,5}, {2012,4,6}, {2012,4,7}, {2012,4,8}, {2012,4,9}, {2012,4,10}, {2012,4,11}, {2012,4,12}, {2012,4,13}, 
-{2012,4,14}, {2012,4,15}, {2012,4,16}, {2012,4,17}, {2012,4,18}, {2012,4,19}, {2012,4,20}, {2012,4,21}, {2012,4,22}, {2012,4,23}, {2012,4,24}, {2012,4,25}, {2012,4,26}, {2012,4,27}, {2012,4,28}, {2012,4,29}, {2012,4,30}, {2012,5,1}, {2012,5,2}, {2012,5,3}, {2012,5,4}, {2012,5,5}, {2012,5,6}, {2012,5,7}, {2012,5,8}, {2012,5,9}, {2012,5,10}, {2012,5,11}, {2012,5,12}, {2012,5,13}, {2012,5,14}, {2012,5,15}, 
-{2012,5,16}, {2012,5,17}, {2012,5,18}, {2012,5,19}, {2012,5,20}, {2012,5,21}, {2012,5,22}, {2012,5,23}, {2012,5,24}, {2012,5,25}, {2012,5,26}, {2012,5,27}, {2012,5,28}, {2012,5,29}, {2012,5,30}, {2012,5,31}, {2012,6,1}, {2012,6,2}, {2012,6,3}, {2012,6,4}, {2012,6,5}, {2012,6,6}, {2012,6,7}, {2012,6,8}, {2012,6,9}, {2012,6,10}, {2012,6,11}, {2012,6,12}, {2012,6,13}, {2012,6,14}, {2012,6,15}, {2012,6,16}, 
-{2012,6,17}, {2012,6,18}, {2012,6,19}, {2012,6,20}, {2012,6,21}, {2012,6,22}, {2012,6,23}, {2012,6,24}, {2012,6,25}, {2012,6,26}, {2012,6,27}, {2012,6,28}, {2012,6,29}, {2012,6,30}, {2012,7,1}, {2012,7,2}, {2012,7,3}, {2012,7,4}, {2012,7,5}, {2012,7,6}, {2012,7,7}, {2012,7,8}, {2012,7,9}, {2012,7,10}, {2012,7,11}, {2012,7,12}, {2012,7,13}, {2012,7,14}, {2012,7,15}, {2012,7,16}, {2012,7,17}, {2012,7,18}, 
-{2012,7,19}, {2012,7,20}, {2012,7,21}, {2012,7,22}, {2012,7,23}, {2012,7,24}, {2012,7,25}, {2012,7,26}, {2012,7,27}, {2012,7,28}, {2012,7,29}, {2012,7,30}, {2012,7,31}, {2012,8,1}, {2012,8,2}, {2012,8,3}, {2012,8,4}, {2012,8,5}, {2012,8,6}, {2012,8,7}, {2012,8,8}, {2012,8,9}, {2012,8,10}, {2012,8,11}, {2012,8,12}, {2012,8,13}, {2012,8,14}, {2012,8,15}, {2012,8,16}, {2012,8,17}, {2012,8,18}, {2012,8,19}, 
-{2012,8,20}, {2012,8,21}, {2012,8,22}, {2012,8,23}, {2012,8,24}, {2012,8,25}, {2012,8,26}, {2012,8,27}, {2012,8,28}, {2012,8,29}, {2012,8,30}, {2012,8,31}, {2012,9,1}, {2012,9,2}, {2012,9,3}, {2012,9,4}, {2012,9,5}, {2012,9,6}, {2012,9,7}, {2012,9,8}, {2012,9,9}, {2012,9,10}, {2012,9,11}, {2012,9,12}, {2012,9,13}, {2012,9,14}, {2012,9,15}, {2012,9,16}, {2012,9,17}, {2012,9,18}, {2012,9,19}, {2012,9,20}, 
-{2012,9,21}, {2012,9,22}, {2012,9,23}, {2012,9,24}, {2012,9,25}, {2012,9,26}, {2012,9,27}, {2012,9,28}, {2012,9,29}, {2012,9,30}, {2012,10,1}, {2012,10,2}, {2012,10,3}, {2012,10,4}, {2012,10,5}, {2012,10,6}, {2012,10,7}, {2012,10,8}, {2012,10,9}, {2012,10,10}, {2012,10,11}, {2012,10,12}, {2012,10,13}, {2012,10,14}, {2012,10,15}, {2012,10,16}, {2012,10,17}, {2012,10,18}, {2012,10,19}, {2012,10,20}, {2012,10,21}, {2012,10,22}, 
-{2012,10,23}, {2012,10,24}, {2012,10,25}, {2012,10,26}, {2012,10,27}, {2012,10,28}, {2012,10,29}, {2012,10,30}, {2012,10,31}, {2012,11,1}, {2012,11,2}, {2012,11,3}, {2012,11,4}, {2012,11,5}, {2012,11,6}, {2012,11,7}, {2012,11,8}, {2012,11,9}, {2012,11,10}, {2012,11,11}, {2012,11,12}, {2012,11,13}, {2012,11,14}, {2012,11,15}, {2012,11,16}, {2012,11,17}, {2012,11,18}, {2012,11,19}, {2012,11,20}, {2012,11,21}, {2012,11,22}, {2012,11,23}, 
-{2012,11,24}, {2012,11,25}, {2012,11,26}, {2012,11,27}, {2012,11,28}, {2012,11,29}, {2012,11,30}, {2012,12,1}, {2012,12,2}, {2012,12,3}, {2012,12,4}, {2012,12,5}, {2012,12,6}, {2012,12,7}, {2012,12,8}, {2012,12,9}, {2012,12,10}, {2012,12,11}, {2012,12,12}, {2012,12,13}, {2012,12,14}, {2012,12,15}, {2012,12,16}, {2012,12,17}, {2012,12,18}, {2012,12,19}, {2012,12,20}, {2012,12,21}, {2012,12,22}, {2012,12,23}, {2012,12,24}, {2012,12,25}, 
-{2012,12,26}, {2012,12,27}, {2012,12,28}, {2012,12,29}, {2012,12,30}, {2012,12,31}, {2013,1,1}, {2013,1,2}, {2013,1,3}, {2013,1,4}, {2013,1,5}, {2013,1,6}, {2013,1,7}, {2013,1,8}, {2013,1,9}, {2013,1,10}, {2013,1,11}, {2013,1,12}, {2013,1,13}, {2013,1,14}, {2013,1,15}, {2013,1,16}, {2013,1,17}, {2013,1,18}, {2013,1,19}, {2013,1,20}, {2013,1,21}, {2013,1,22}, {2013,1,23}, {2013,1,24}, {2013,1,25}, {2013,1,26}, 
-{2013,1,27}, {2013,1,28}, {2013,1,29}, {2013,1,30}, {2013,1,31}, {2013,2,1}, {2013,2,2}, {2013,2,3}, {2013,2,4}, {2013,2,5}, {2013,2,6}, {2013,2,7}, {2013,2,8}, {2013,2,9}, {2013,2,10}, {2013,2,11}, {2013,2,12}, {2013,2,13}, {2013,2,14}, {2013,2,15}, {2013,2,16}, {2013,2,17}, {2013,2,18}, {2013,2,19}, {2013,2,20}, {2013,2,21}, {2013,2,22}, {2013,2,23}, {2013,2,24}, {2013,2,25}, {2013,2,26}, {2013,2,27}, 
-{2013,2,28}, {2013,3,1}, {2013,3,2}, {2013,3,3}, {2013,3,4}, {2013,3,5}, {2013,3,6}, {2013,3,7}, {2013,3,8}, {2013,3,9}, {2013,3,10}, {2013,3,11}, {2013,3,12}, {2013,3,13}, {2013,3,14}, {2013,3,15}, {2013,3,16}, {2013,3,17}, {2013,3,18}, {2013,3,19}, {2013,3,20}, {2013,3,21}, {2013,3,22}, {2013,3,23}, {2013,3,24}, {2013,3,25}, {2013,3,26}, {2013,3,27}, {2013,3,28}, {2013,3,29}, {2013,3,30}, {2013,3,31}, 
-{2013,4,1}, {2013,4,2}, {2013,4,3}, {2013,4,4}, {2013,4,5}, {2013,4,6}, {2013,4,7}, {2013,4,8}, {2013,4,9}, {2013,4,10}, {2013,4,11}, {2013,4,12}, {2013,4,13}, {2013,4,14}, {2013,4,15}, {2013,4,16}, {2013,4,17}, {2013,4,18}, {2013,4,19}, {2013,4,20}, {2013,4,21}, {2013,4,22}, {2013,4,23}, {2013,4,24}, {2013,4,25}, {2013,4,26}, {2013,4,27}, {2013,4,28}, {2013,4,29}, {2013,4,30}, {2013,5,1}, {2013,5,2}, 
-{2013,5,3}, {2013,5,4}, {2013,5,5}, {2013,5,6}, {2013,5,7}, {2013,5,8}, {2013,5,9}, {2013,5,10}, {2013,5,11}, {2013,5,12}, {2013,5,13}, {2013,5,14}, {2013,5,15}, {2013,5,16}, {2013,5,17}, {2013,5,18}, {2013,5,19}, {2013,5,20}, {2013,5,21}, {2013,5,22}, {2013,5,23}, {2013,5,24}, {2013,5,25}, {2013,5,26}, {2013,5,27}, {2013,5,28}, {2013,5,29}, {2013,5,30}, {2013,5,31}, {2013,6,1}, {2013,6,2}, {2013,6,3}, 
-{2013,6,4}, {2013,6,5}, {2013,6,6}, {2013,6,7}, {2013,6,8}, {2013,6,9}, {2013,6,10}, {2013,6,11}, {2013,6,12}, {2013,6,13}, {2013,6,14}, {2013,6,15}, {2013,6,16}, {2013,6,17}, {2013,6,18}, {2013,6,19}, {2013,6,20}, {2013,6,21}, {2013,6,22}, {2013,6,23}, {2013,6,24}, {2013,6,25}, {2013,6,26}, {2013,6,27}, {2013,6,28}, {2013,6,29}, {2013,6,30}, {2013,7,1}, {2013,7,2}, {2013,7,3}, {2013,7,4}, {2013,7,5}, 
-{2013,7,6}, {2013,7,7}, {2013,7,8}, {2013,7,9}, {2013,7,10}, {2013,7,11}, {2013,7,12}, {2013,7,13}, {2013,7,14}, {2013,7,15}, {2013,7,16}, {2013,7,17}, {2013,7,18}, {2013,7,19}, {2013,7,20}, {2013,7,21}, {2013,7,22}, {2013,7,23}, {2013,7,24}, {2013,7,25}, {2013,7,26}, {2013,7,27}, {2013,7,28}, {2013,7,29}, {2013,7,30}, {2013,7,31}, {2013,8,1}, {2013,8,2}, {2013,8,3}, {2013,8,4}, {2013,8,5}, {2013,8,6}, 
-{2013,8,7}, {2013,8,8}, {2013,8,9}, {2013,8,10}, {2013,8,11}, {2013,8,12}, {2013,8,13}, {2013,8,14}, {2013,8,15}, {2013,8,16}, {2013,8,17}, {2013,8,18}, {2013,8,19}, {2013,8,20}, {2013,8,21}, {2013,8,22}, {2013,8,23}, {2013,8,24}, {2013,8,25}, {2013,8,26}, {2013,8,27}, {2013,8,28}, {2013,8,29}, {2013,8,30}, {2013,8,31}, {2013,9,1}, {2013,9,2}, {2013,9,3}, {2013,9,4}, {2013,9,5}, {2013,9,6}, {2013,9,7}, 
-{2013,9,8}, {2013,9,9}, {2013,9,10}, {2013,9,11}, {2013,9,12}, {2013,9,13}, {2013,9,14}, {2013,9,15}, {2013,9,16}, {2013,9,17}, {2013,9,18}, {2013,9,19}, {2013,9,20}, {2013,9,21}, {2013,9,22}, {2013,9,23}, {2013,9,24}, {2013,9,25}, {2013,9,26}, {2013,9,27}, {2013,9,28}, {2013,9,29}, {2013,9,30}, {2013,10,1}, {2013,10,2}, {2013,10,3}, {2013,10,4}, {2013,10,5}, {2013,10,6}, {2013,10,7}, {2013,10,8}, {2013,10,9}, 
-{2013,10,10}, {2013,10,11}, {2013,10,12}, {2013,10,13}, {2013,10,14}, {2013,10,15}, {2013,10,16}, {2013,10,17}, {2013,10,18}, {2013,10,19}, {2013,10,20}, {2013,10,21}, {2013,10,22}, {2013,10,23}, {2013,10,24}, {2013,10,25}, {2013,10,26}, {2013,10,27}, {2013,10,28}, {2013,10,29}, {2013,10,30}, {2013,10,31}, {2013,11,1}, {2013,11,2}, {2013,11,3}, {2013,11,4}, {2013,11,5}, {2013,11,6}, {2013,11,7}, {2013,11,8}, {2013,11,9}, {2013,11,10}, 
-{2013,11,11}, {2013,11,12}, {2013,11,13}, {2013,11,14}, {2013,11,15}, {2013,11,16}, {2013,11,17}, {2013,11,18}, {2013,11,19}, {2013,11,20}, {2013,11,21}, {2013,11,22}, {2013,11,23}, {2013,11,24}, {2013,11,25}, {2013,11,26}, {2013,11,27}, {2013,11,28}, {2013,11,29}, {2013,11,30}, {2013,12,1}, {2013,12,2}, {2013,12,3}, {2013,12,4}, {2013,12,5}, {2013,12,6}, {2013,12,7}, {2013,12,8}, {2013,12,9}, {2013,12,10}, {2013,12,11}, {2013,12,12}, 
-{2013,12,13}, {2013,12,14}, {2013,12,15}, {2013,12,16}, {2013,12,17}, {2013,12,18}, {2013,12,19}, {2013,12,20}, {2013,12,21}, {2013,12,22}, {2013,12,23}, {2013,12,24}, {2013,12,25}, {2013,12,26}, {2013,12,27}, {2013,12,28}, {2013,12,29}, {2013,12,30}, {2013,12,31}, {2014,1,1}, {2014,1,2}, {2014,1,3}, {2014,1,4}, {2014,1,5}, {2014,1,6}, {2014,1,7}, {2014,1,8}, {2014,1,9}, {2014,1,10}, {2014,1,11}, {2014,1,12}, {2014,1,13}, 
-{2014,1,14}, {2014,1,15}, {2014,1,16}, {2014,1,17}, {2014,1,18}, {2014,1,19}, {2014,1,20}, {2014,1,21}, {2014,1,22}, {2014,1,23}, {2014,1,24}, {2014,1,25}, {2014,1,26}, {2014,1,27}, {2014,1,28}, {2014,1,29}, {2014,1,30}, {2014,1,31}, {2014,2,1}, {2014,2,2}, {2014,2,3}, {2014,2,4}, {2014,2,5}, {2014,2,6}, {2014,2,7}, {2014,2,8}, {2014,2,9}, {2014,2,10}, {2014,2,11}, {2014,2,12}, {2014,2,13}, {2014,2,14}, 
-{2014,2,15}, {2014,2,16}, {2014,2,17}, {2014,2,18}, {2014,2,19}, {2014,2,20}, {2014,2,21}, {2014,2,22}, {2014,2,23}, {2014,2,24}, {2014,2,25}, {2014,2,26}, {2014,2,27}, {2014,2,28}, {2014,3,1}, {2014,3,2}, {2014,3,3}, {2014,3,4}, {2014,3,5}, {2014,3,6}, {2014,3,7}, {2014,3,8}, {2014,3,9}, {2014,3,10}, {2014,3,11}, {2014,3,12}, {2014,3,13}, {2014,3,14}, {2014,3,15}, {2014,3,16}, {2014,3,17}, {2014,3,18}, 
-{2014,3,19}, {2014,3,20}, {2014,3,21}, {2014,3,22}, {2014,3,23}, {2014,3,24}, {2014,3,25}, {2014,3,26}, {2014,3,27}, {2014,3,28}, {2014,3,29}, {2014,3,30}, {2014,3,31}, {2014,4,1}, {2014,4,2}, {2014,4,3}, {2014,4,4}, {2014,4,5}, {2014,4,6}, {2014,4,7}, {2014,4,8}, {2014,4,9}, {2014,4,10}, {2014,4,11}, {2014,4,12}, {2014,4,13}, {2014,4,14}, {2014,4,15}, {2014,4,16}, {2014,4,17}, {2014,4,18}, {2014,4,19}, 
-{2014,4,20}, {2014,4,21}, {2014,4,22}, {2014,4,23}, {2014,4,24}, {2014,4,25}, {2014,4,26}, {2014,4,27}, {2014,4,28}, {2014,4,29}, {2014,4,30}, {2014,5,1}, {2014,5,2}, {2014,5,3}, {2014,5,4}, {2014,5,5}, {2014,5,6}, {2014,5,7}, {2014,5,8}, {2014,5,9}, {2014,5,10}, {2014,5,11}, {2014,5,12}, {2014,5,13}, {2014,5,14}, {2014,5,15}, {2014,5,16}, {2014,5,17}, {2014,5,18}, {2014,5,19}, {2014,5,20}, {2014,5,21}, 
-{2014,5,22}, {2014,5,23}, {2014,5,24}, {2014,5,25}, {2014,5,26}, {2014,5,27}, {2014,5,28}, {2014,5,29}, {2014,5,30}, {2014,5,31}, {2014,6,1}, {2014,6,2}, {2014,6,3}, {2014,6,4}, {2014,6,5}, {2014,6,6}, {2014,6,7}, {2014,6,8}, {2014,6,9}, {2014,6,10}, {2014,6,11}, {2014,6,12}, {2014,6,13}, {2014,6,14}, {2014,6,15}, {2014,6,16}, {2014,6,17}, {2014,6,18}, {2014,6,19}, {2014,6,20}, {2014,6,21}, {2014,6,22}, 
-{2014,6,23}, {2014,6,24}, {2014,6,25}, {2014,6,26}, {2014,6,27}, {2014,6,28}, {2014,6,29}, {2014,6,30}, {2014,7,1}, {2014,7,2}, {2014,7,3}, {2014,7,4}, {2014,7,5}, {2014,7,6}, {2014,7,7}, {2014,7,8}, {2014,7,9}, {2014,7,10}, {2014,7,11}, {2014,7,12}, {2014,7,13}, {2014,7,14}, {2014,7,15}, {2014,7,16}, {2014,7,17}, {2014,7,18}, {2014,7,19}, {2014,7,20}, {2014,7,21}, {2014,7,22}, {2014,7,23}, {2014,7,24}, 
-{2014,7,25}, {2014,7,26}, {2014,7,27}, {2014,7,28}, {2014,7,29}, {2014,7,30}, {2014,7,31}, {2014,8,1}, {2014,8,2}, {2014,8,3}, {2014,8,4}, {2014,8,5}, {2014,8,6}, {2014,8,7}, {2014,8,8}, {2014,8,9}, {2014,8,10}, {2014,8,11}, {2014,8,12}, {2014,8,13}, {2014,8,14}, {2014,8,15}, {2014,8,16}, {2014,8,17}, {2014,8,18}, {2014,8,19}, {2014,8,20}, {2014,8,21}, {2014,8,22}, {2014,8,23}, {2014,8,24}, {2014,8,25}, 
-{2014,8,26}, {2014,8,27}, {2014,8,28}, {2014,8,29}, {2014,8,30}, {2014,8,31}, {2014,9,1}, {2014,9,2}, {2014,9,3}, {2014,9,4}, {2014,9,5}, {2014,9,6}, {2014,9,7}, {2014,9,8}, {2014,9,9}, {2014,9,10}, {2014,9,11}, {2014,9,12}, {2014,9,13}, {2014,9,14}, {2014,9,15}, {2014,9,16}, {2014,9,17}, {2014,9,18}, {2014,9,19}, {2014,9,20}, {2014,9,21}, {2014,9,22}, {2014,9,23}, {2014,9,24}, {2014,9,25}, {2014,9,26}, 
-{2014,9,27}, {2014,9,28}, {2014,9,29}, {2014,9,30}, {2014,10,1}, {2014,10,2}, {2014,10,3}, {2014,10,4}, {2014,10,5}, {2014,10,6}, {2014,10,7}, {2014,10,8}, {2014,10,9}, {2014,10,10}, {2014,10,11}, {2014,10,12}, {2014,10,13}, {2014,10,14}, {2014,10,15}, {2014,10,16}, {2014,10,17}, {2014,10,18}, {2014,10,19}, {2014,10,20}, {2014,10,21}, {2014,10,22}, {2014,10,23}, {2014,10,24}, {2014,10,25}, {2014,10,26}, {2014,10,27}, {2014,10,28}, 
-{2014,10,29}, {2014,10,30}, {2014,10,31}, {2014,11,1}, {2014,11,2}, {2014,11,3}, {2014,11,4}, {2014,11,5}, {2014,11,6}, {2014,11,7}, {2014,11,8}, {2014,11,9}, {2014,11,10}, {2014,11,11}, {2014,11,12}, {2014,11,13}, {2014,11,14}, {2014,11,15}, {2014,11,16}, {2014,11,17}, {2014,11,18}, {2014,11,19}, {2014,11,20}, {2014,11,21}, {2014,11,22}, {2014,11,23}, {2014,11,24}, {2014,11,25}, {2014,11,26}, {2014,11,27}, {2014,11,28}, {2014,11,29}, 
-{2014,11,30}, {2014,12,1}, {2014,12,2}, {2014,12,3}, {2014,12,4}, {2014,12,5}, {2014,12,6}, {2014,12,7}, {2014,12,8}, {2014,12,9}, {2014,12,10}, {2014,12,11}, {2014,12,12}, {2014,12,13}, {2014,12,14}, {2014,12,15}, {2014,12,16}, {2014,12,17}, {2014,12,18}, {2014,12,19}, {2014,12,20}, {2014,12,21}, {2014,12,22}, {2014,12,23}, {2014,12,24}, {2014,12,25}, {2014,12,26}, {2014,12,27}, {2014,12,28}, {2014,12,29}, {2014,12,30}, {2014,12,31}, 
-{2015,1,1}, {2015,1,2}, {2015,1,3}, {2015,1,4}, {2015,1,5}, {2015,1,6}, {2015,1,7}, {2015,1,8}, {2015,1,9}, {2015,1,10}, {2015,1,11}, {2015,1,12}, {2015,1,13}, {2015,1,14}, {2015,1,15}, {2015,1,16}, {2015,1,17}, {2015,1,18}, {2015,1,19}, {2015,1,20}, {2015,1,21}, {2015,1,22}, {2015,1,23}, {2015,1,24}, {2015,1,25}, {2015,1,26}, {2015,1,27}, {2015,1,28}, {2015,1,29}, {2015,1,30}, {2015,1,31}, {2015,2,1}, 
-{2015,2,2}, {2015,2,3}, {2015,2,4}, {2015,2,5}, {2015,2,6}, {2015,2,7}, {2015,2,8}, {2015,2,9}, {2015,2,10}, {2015,2,11}, {2015,2,12}, {2015,2,13}, {2015,2,14}, {2015,2,15}, {2015,2,16}, {2015,2,17}, {2015,2,18}, {2015,2,19}, {2015,2,20}, {2015,2,21}, {2015,2,22}, {2015,2,23}, {2015,2,24}, {2015,2,25}, {2015,2,26}, {2015,2,27}, {2015,2,28}, {2015,3,1}, {2015,3,2}, {2015,3,3}, {2015,3,4}, {2015,3,5}, 
-{2015,3,6}, {2015,3,7}, {2015,3,8}, {2015,3,9}, {2015,3,10}, {2015,3,11}, {2015,3,12}, {2015,3,13}, {2015,3,14}, {2015,3,15}, {2015,3,16}, {2015,3,17}, {2015,3,18}, {2015,3,19}, {2015,3,20}, {2015,3,21}, {2015,3,22}, {2015,3,23}, {2015,3,24}, {2015,3,25}, {2015,3,26}, {2015,3,27}, {2015,3,28}, {2015,3,29}, {2015,3,30}, {2015,3,31}, {2015,4,1}, {2015,4,2}, {2015,4,3}, {2015,4,4}, {2015,4,5}, {2015,4,6}, 
-{2015,4,7}, {2015,4,8}, {2015,4,9}, {2015,4,10}, {2015,4,11}, {2015,4,12}, {2015,4,13}, {2015,4,14}, {2015,4,15}, {2015,4,16}, {2015,4,17}, {2015,4,18}, {2015,4,19}, {2015,4,20}, {2015,4,21}, {2015,4,22}, {2015,4,23}, {2015,4,24}, {2015,4,25}, {2015,4,26}, {2015,4,27}, {2015,4,28}, {2015,4,29}, {2015,4,30}, {2015,5,1}, {2015,5,2}, {2015,5,3}, {2015,5,4}, {2015,5,5}, {2015,5,6}, {2015,5,7}, {2015,5,8}, 
-{2015,5,9}, {2015,5,10}, {2015,5,11}, {2015,5,12}, {2015,5,13}, {2015,5,14}, {2015,5,15}, {2015,5,16}, {2015,5,17}, {2015,5,18}, {2015,5,19}, {2015,5,20}, {2015,5,21}, {2015,5,22}, {2015,5,23}, {2015,5,24}, {2015,5,25}, {2015,5,26}, {2015,5,27}, {2015,5,28}, {2015,5,29}, {2015,5,30}, {2015,5,31}, {2015,6,1}, {2015,6,2}, {2015,6,3}, {2015,6,4}, {2015,6,5}, {2015,6,6}, {2015,6,7}, {2015,6,8}, {2015,6,9}, 
-{2015,6,10}, {2015,6,11}, {2015,6,12}, {2015,6,13}, {2015,6,14}, {2015,6,15}, {2015,6,16}, {2015,6,17}, {2015,6,18}, {2015,6,19}, {2015,6,20}, {2015,6,21}, {2015,6,22}, {2015,6,23}, {2015,6,24}, {2015,6,25}, {2015,6,26}, {2015,6,27}, {2015,6,28}, {2015,6,29}, {2015,6,30}, {2015,7,1}, {2015,7,2}, {2015,7,3}, {2015,7,4}, {2015,7,5}, {2015,7,6}, {2015,7,7}, {2015,7,8}, {2015,7,9}, {2015,7,10}, {2015,7,11}, 
-{2015,7,12}, {2015,7,13}, {2015,7,14}, {2015,7,15}, {2015,7,16}, {2015,7,17}, {2015,7,18}, {2015,7,19}, {2015,7,20}, {2015,7,21}, {2015,7,22}, {2015,7,23}, {2015,7,24}, {2015,7,25}, {2015,7,26}, {2015,7,27}, {2015,7,28}, {2015,7,29}, {2015,7,30}, {2015,7,31}, {2015,8,1}, {2015,8,2}, {2015,8,3}, {2015,8,4}, {2015,8,5}, {2015,8,6}, {2015,8,7}, {2015,8,8}, {2015,8,9}, {2015,8,10}, {2015,8,11}, {2015,8,12}, 
-{2015,8,13}, {2015,8,14}, {2015,8,15}, {2015,8,16}, {2015,8,17}, {2015,8,18}, {2015,8,19}, {2015,8,20}, {2015,8,21}, {2015,8,22}, {2015,8,23}, {2015,8,24}, {2015,8,25}, {2015,8,26}, {2015,8,27}, {2015,8,28}, {2015,8,29}, {2015,8,30}, {2015,8,31}, {2015,9,1}, {2015,9,2}, {2015,9,3}, {2015,9,4}, {2015,9,5}, {2015,9,6}, {2015,9,7}, {2015,9,8}, {2015,9,9}, {2015,9,10}, {2015,9,11}, {2015,9,12}, {2015,9,13}, 
-{2015,9,14}, {2015,9,15}, {2015,9,16}, {2015,9,17}, {2015,9,18}, {2015,9,19}, {2015,9,20}, {2015,9,21}, {2015,9,22}, {2015,9,23}, {2015,9,24}, {2015,9,25}, {2015,9,26}, {2015,9,27}, {2015,9,28}, {2015,9,29}, {2015,9,30}, {2015,10,1}, {2015,10,2}, {2015,10,3}, {2015,10,4}, {2015,10,5}, {2015,10,6}, {2015,10,7}, {2015,10,8}, {2015,10,9}, {2015,10,10}, {2015,10,11}, {2015,10,12}, {2015,10,13}, {2015,10,14}, {2015,10,15}, 
-{2015,10,16}, {2015,10,17}, {2015,10,18}, {2015,10,19}, {2015,10,20}, {2015,10,21}, {2015,10,22}, {2015,10,23}, {2015,10,24}, {2015,10,25}, {2015,10,26}, {2015,10,27}, {2015,10,28}, {2015,10,29}, {2015,10,30}, {2015,10,31}, {2015,11,1}, {2015,11,2}, {2015,11,3}, {2015,11,4}, {2015,11,5}, {2015,11,6}, {2015,11,7}, {2015,11,8}, {2015,11,9}, {2015,11,10}, {2015,11,11}, {2015,11,12}, {2015,11,13}, {2015,11,14}, {2015,11,15}, {2015,11,16}, 
-{2015,11,17}, {2015,11,18}, {2015,11,19}, {2015,11,20}, {2015,11,21}, {2015,11,22}, {2015,11,23}, {2015,11,24}, {2015,11,25}, {2015,11,26}, {2015,11,27}, {2015,11,28}, {2015,11,29}, {2015,11,30}, {2015,12,1}, {2015,12,2}, {2015,12,3}, {2015,12,4}, {2015,12,5}, {2015,12,6}, {2015,12,7}, {2015,12,8}, {2015,12,9}, {2015,12,10}, {2015,12,11}, {2015,12,12}, {2015,12,13}, {2015,12,14}, {2015,12,15}, {2015,12,16}, {2015,12,17}, {2015,12,18}, 
-{2015,12,19}, {2015,12,20}, {2015,12,21}, {2015,12,22}, {2015,12,23}, {2015,12,24}, {2015,12,25}, {2015,12,26}, {2015,12,27}, {2015,12,28}, {2015,12,29}, {2015,12,30}, {2015,12,31}, {2016,1,1}, {2016,1,2}, {2016,1,3}, {2016,1,4}, {2016,1,5}, {2016,1,6}, {2016,1,7}, {2016,1,8}, {2016,1,9}, {2016,1,10}, {2016,1,11}, {2016,1,12}, {2016,1,13}, {2016,1,14}, {2016,1,15}, {2016,1,16}, {2016,1,17}, {2016,1,18}, {2016,1,19}, 
-{2016,1,20}, {2016,1,21}, {2016,1,22}, {2016,1,23}, {2016,1,24}, {2016,1,25}, {2016,1,26}, {2016,1,27}, {2016,1,28}, {2016,1,29}, {2016,1,30}, {2016,1,31}, {2016,2,1}, {2016,2,2}, {2016,2,3}, {2016,2,4}, {2016,2,5}, {2016,2,6}, {2016,2,7}, {2016,2,8}, {2016,2,9}, {2016,2,10}, {2016,2,11}, {2016,2,12}, {2016,2,13}, {2016,2,14}, {2016,2,15}, {2016,2,16}, {2016,2,17}, {2016,2,18}, {2016,2,19}, {2016,2,20}, 
-{2016,2,21}, {2016,2,22}, {2016,2,23}, {2016,2,24}, {2016,2,25}, {2016,2,26}, {2016,2,27}, {2016,2,28}, {2016,2,29}, {2016,3,1}, {2016,3,2}, {2016,3,3}, {2016,3,4}, {2016,3,5}, {2016,3,6}, {2016,3,7}, {2016,3,8}, {2016,3,9}, {2016,3,10}, {2016,3,11}, {2016,3,12}, {2016,3,13}, {2016,3,14}, {2016,3,15}, {2016,3,16}, {2016,3,17}, {2016,3,18}, {2016,3,19}, {2016,3,20}, {2016,3,21}, {2016,3,22}, {2016,3,23}, 
-{2016,3,24}, {2016,3,25}, {2016,3,26}, {2016,3,27}, {2016,3,28}, {2016,3,29}, {2016,3,30}, {2016,3,31}, {2016,4,1}, {2016,4,2}, {2016,4,3}, {2016,4,4}, {2016,4,5}, {2016,4,6}, {2016,4,7}, {2016,4,8}, {2016,4,9}, {2016,4,10}, {2016,4,11}, {2016,4,12}, {2016,4,13}, {2016,4,14}, {2016,4,15}, {2016,4,16}, {2016,4,17}, {2016,4,18}, {2016,4,19}, {2016,4,20}, {2016,4,21}, {2016,4,22}, {2016,4,23}, {2016,4,24}, 
-{2016,4,25}, {2016,4,26}, {2016,4,27}, {2016,4,28}, {2016,4,29}, {2016,4,30}, {2016,5,1}, {2016,5,2}, {2016,5,3}, {2016,5,4}, {2016,5,5}, {2016,5,6}, {2016,5,7}, {2016,5,8}, {2016,5,9}, {2016,5,10}, {2016,5,11}, {2016,5,12}, {2016,5,13}, {2016,5,14}, {2016,5,15}, {2016,5,16}, {2016,5,17}, {2016,5,18}, {2016,5,19}, {2016,5,20}, {2016,5,21}, {2016,5,22}, {2016,5,23}, {2016,5,24}, {2016,5,25}, {2016,5,26}, 
-{2016,5,27}, {2016,5,28}, {2016,5,29}, {2016,5,30}, {2016,5,31}, {2016,6,1}, {2016,6,2}, {2016,6,3}, {2016,6,4}, {2016,6,5}, {2016,6,6}, {2016,6,7}, {2016,6,8}, {2016,6,9}, {2016,6,10}, {2016,6,11}, {2016,6,12}, {2016,6,13}, {2016,6,14}, {2016,6,15}, {2016,6,16}, {2016,6,17}, {2016,6,18}, {2016,6,19}, {2016,6,20}, {2016,6,21}, {2016,6,22}, {2016,6,23}, {2016,6,24}, {2016,6,25}, {2016,6,26}, {2016,6,27}, 
-{2016,6,28}, {2016,6,29}, {2016,6,30}, {2016,7,1}, {2016,7,2}, {2016,7,3}, {2016,7,4}, {2016,7,5}, {2016,7,6}, {2016,7,7}, {2016,7,8}, {2016,7,9}, {2016,7,10}, {2016,7,11}, {2016,7,12}, {2016,7,13}, {2016,7,14}, {2016,7,15}, {2016,7,16}, {2016,7,17}, {2016,7,18}, {2016,7,19}, {2016,7,20}, {2016,7,21}, {2016,7,22}, {2016,7,23}, {2016,7,24}, {2016,7,25}, {2016,7,26}, {2016,7,27}, {2016,7,28}, {2016,7,29}, 
-{2016,7,30}, {2016,7,31}, {2016,8,1}, {2016,8,2}, {2016,8,3}, {2016,8,4}, {2016,8,5}, {2016,8,6}, {2016,8,7}, {2016,8,8}, {2016,8,9}, {2016,8,10}, {2016,8,11}, {2016,8,12}, {2016,8,13}, {2016,8,14}, {2016,8,15}, {2016,8,16}, {2016,8,17}, {2016,8,18}, {2016,8,19}, {2016,8,20}, {2016,8,21}, {2016,8,22}, {2016,8,23}, {2016,8,24}, {2016,8,25}, {2016,8,26}, {2016,8,27}, {2016,8,28}, {2016,8,29}, {2016,8,30}, 
-{2016,8,31}, {2016,9,1}, {2016,9,2}, {2016,9,3}, {2016,9,4}, {2016,9,5}, {2016,9,6}, {2016,9,7}, {2016,9,8}, {2016,9,9}, {2016,9,10}, {2016,9,11}, {2016,9,12}, {2016,9,13}, {2016,9,14}, {2016,9,15}, {2016,9,16}, {2016,9,17}, {2016,9,18}, {2016,9,19}, {2016,9,20}, {2016,9,21}, {2016,9,22}, {2016,9,23}, {2016,9,24}, {2016,9,25}, {2016,9,26}, {2016,9,27}, {2016,9,28}, {2016,9,29}, {2016,9,30}, {2016,10,1}, 
-{2016,10,2}, {2016,10,3}, {2016,10,4}, {2016,10,5}, {2016,10,6}, {2016,10,7}, {2016,10,8}, {2016,10,9}, {2016,10,10}, {2016,10,11}, {2016,10,12}, {2016,10,13}, {2016,10,14}, {2016,10,15}, {2016,10,16}, {2016,10,17}, {2016,10,18}, {2016,10,19}, {2016,10,20}, {2016,10,21}, {2016,10,22}, {2016,10,23}, {2016,10,24}, {2016,10,25}, {2016,10,26}, {2016,10,27}, {2016,10,28}, {2016,10,29}, {2016,10,30}, {2016,10,31}, {2016,11,1}, {2016,11,2}, 
-{2016,11,3}, {2016,11,4}, {2016,11,5}, {2016,11,6}, {2016,11,7}, {2016,11,8}, {2016,11,9}, {2016,11,10}, {2016,11,11}, {2016,11,12}, {2016,11,13}, {2016,11,14}, {2016,11,15}, {2016,11,16}, {2016,11,17}, {2016,11,18}, {2016,11,19}, {2016,11,20}, {2016,11,21}, {2016,11,22}, {2016,11,23}, {2016,11,24}, {2016,11,25}, {2016,11,26}, {2016,11,27}, {2016,11,28}, {2016,11,29}, {2016,11,30}, {2016,12,1}, {2016,12,2}, {2016,12,3}, {2016,12,4}, 
-{2016,12,5}, {2016,12,6}, {2016,12,7}, {2016,12,8}, {2016,12,9}, {2016,12,10}, {2016,12,11}, {2016,12,12}, {2016,12,13}, {2016,12,14}, {2016,12,15}, {2016,12,16}, {2016,12,17}, {2016,12,18}, {2016,12,19}, {2016,12,20}, {2016,12,21}, {2016,12,22}, {2016,12,23}, {2016,12,24}, {2016,12,25}, {2016,12,26}, {2016,12,27}, {2016,12,28}, {2016,12,29}, {2016,12,30}, {2016,12,31}, {2017,1,1}, {2017,1,2}, {2017,1,3}, {2017,1,4}, {2017,1,5}, 
-{2017,1,6}, {2017,1,7}, {2017,1,8}, {2017,1,9}, {2017,1,10}, {2017,1,11}, {2017,1,12}, {2017,1,13}, {2017,1,14}, {2017,1,15}, {2017,1,16}, {2017,1,17}, {2017,1,18}, {2017,1,19}, {2017,1,20}, {2017,1,21}, {2017,1,22}, {2017,1,23}, {2017,1,24}, {2017,1,25}, {2017,1,26}, {2017,1,27}, {2017,1,28}, {2017,1,29}, {2017,1,30}, {2017,1,31}, {2017,2,1}, {2017,2,2}, {2017,2,3}, {2017,2,4}, {2017,2,5}, {2017,2,6}, 
-{2017,2,7}, {2017,2,8}, {2017,2,9}, {2017,2,10}, {2017,2,11}, {2017,2,12}, {2017,2,13}, {2017,2,14}, {2017,2,15}, {2017,2,16}, {2017,2,17}, {2017,2,18}, {2017,2,19}, {2017,2,20}, {2017,2,21}, {2017,2,22}, {2017,2,23}, {2017,2,24}, {2017,2,25}, {2017,2,26}, {2017,2,27}, {2017,2,28}, {2017,3,1}, {2017,3,2}, {2017,3,3}, {2017,3,4}, {2017,3,5}, {2017,3,6}, {2017,3,7}, {2017,3,8}, {2017,3,9}, {2017,3,10}, 
-{2017,3,11}, {2017,3,12}, {2017,3,13}, {2017,3,14}, {2017,3,15}, {2017,3,16}, {2017,3,17}, {2017,3,18}, {2017,3,19}, {2017,3,20}, {2017,3,21}, {2017,3,22}, {2017,3,23}, {2017,3,24}, {2017,3,25}, {2017,3,26}, {2017,3,27}, {2017,3,28}, {2017,3,29}, {2017,3,30}, {2017,3,31}, {2017,4,1}, {2017,4,2}, {2017,4,3}, {2017,4,4}, {2017,4,5}, {2017,4,6}, {2017,4,7}, {2017,4,8}, {2017,4,9}, {2017,4,10}, {2017,4,11}, 
-{2017,4,12}, {2017,4,13}, {2017,4,14}, {2017,4,15}, {2017,4,16}, {2017,4,17}, {2017,4,18}, {2017,4,19}, {2017,4,20}, {2017,4,21}, {2017,4,22}, {2017,4,23}, {2017,4,24}, {2017,4,25}, {2017,4,26}, {2017,4,27}, {2017,4,28}, {2017,4,29}, {2017,4,30}, {2017,5,1}, {2017,5,2}, {2017,5,3}, {2017,5,4}, {2017,5,5}, {2017,5,6}, {2017,5,7}, {2017,5,8}, {2017,5,9}, {2017,5,10}, {2017,5,11}, {2017,5,12}, {2017,5,13}, 
-{2017,5,14}, {2017,5,15}, {2017,5,16}, {2017,5,17}, {2017,5,18}, {2017,5,19}, {2017,5,20}, {2017,5,21}, {2017,5,22}, {2017,5,23}, {2017,5,24}, {2017,5,25}, {2017,5,26}, {2017,5,27}, {2017,5,28}, {2017,5,29}, {2017,5,30}, {2017,5,31}, {2017,6,1}, {2017,6,2}, {2017,6,3}, {2017,6,4}, {2017,6,5}, {2017,6,6}, {2017,6,7}, {2017,6,8}, {2017,6,9}, {2017,6,10}, {2017,6,11}, {2017,6,12}, {2017,6,13}, {2017,6,14}, 
-{2017,6,15}, {2017,6,16}, {2017,6,17}, {2017,6,18}, {2017,6,19}, {2017,6,20}, {2017,6,21}, {2017,6,22}, {2017,6,23}, {2017,6,24}, {2017,6,25}, {2017,6,26}, {2017,6,27}, {2017,6,28}, {2017,6,29}, {2017,6,30}, {2017,7,1}, {2017,7,2}, {2017,7,3}, {2017,7,4}, {2017,7,5}, {2017,7,6}, {2017,7,7}, {2017,7,8}, {2017,7,9}, {2017,7,10}, {2017,7,11}, {2017,7,12}, {2017,7,13}, {2017,7,14}, {2017,7,15}, {2017,7,16}, 
-{2017,7,17}, {2017,7,18}, {2017,7,19}, {2017,7,20}, {2017,7,21}, {2017,7,22}, {2017,7,23}, {2017,7,24}, {2017,7,25}, {2017,7,26}, {2017,7,27}, {2017,7,28}, {2017,7,29}, {2017,7,30}, {2017,7,31}, {2017,8,1}, {2017,8,2}, {2017,8,3}, {2017,8,4}, {2017,8,5}, {2017,8,6}, {2017,8,7}, {2017,8,8}, {2017,8,9}, {2017,8,10}, {2017,8,11}, {2017,8,12}, {2017,8,13}, {2017,8,14}, {2017,8,15}, {2017,8,16}, {2017,8,17}, 
-{2017,8,18}, {2017,8,19}, {2017,8,20}, {2017,8,21}, {2017,8,22}, {2017,8,23}, {2017,8,24}, {2017,8,25}, {2017,8,26}, {2017,8,27}, {2017,8,28}, {2017,8,29}, {2017,8,30}, {2017,8,31}, {2017,9,1}, {2017,9,2}, {2017,9,3}, {2017,9,4}, {2017,9,5}, {2017,9,6}, {2017,9,7}, {2017,9,8}, {2017,9,9}, {2017,9,10}, {2017,9,11}, {2017,9,12}, {2017,9,13}, {2017,9,14}, {2017,9,15}, {2017,9,16}, {2017,9,17}, {2017,9,18}, 
-{2017,9,19}, {2017,9,20}, {2017,9,21}, {2017,9,22}, {2017,9,23}, {2017,9,24}, {2017,9,25}, {2017,9,26}, {2017,9,27}, {2017,9,28}, {2017,9,29}, {2017,9,30}, {2017,10,1}, {2017,10,2}, {2017,10,3}, {2017,10,4}, {2017,10,5}, {2017,10,6}, {2017,10,7}, {2017,10,8}, {2017,10,9}, {2017,10,10}, {2017,10,11}, {2017,10,12}, {2017,10,13}, {2017,10,14}, {2017,10,15}, {2017,10,16}, {2017,10,17}, {2017,10,18}, {2017,10,19}, {2017,10,20}, 
-{2017,10,21}, {2017,10,22}, {2017,10,23}, {2017,10,24}, {2017,10,25}, {2017,10,26}, {2017,10,27}, {2017,10,28}, {2017,10,29}, {2017,10,30}, {2017,10,31}, {2017,11,1}, {2017,11,2}, {2017,11,3}, {2017,11,4}, {2017,11,5}, {2017,11,6}, {2017,11,7}, {2017,11,8}, {2017,11,9}, {2017,11,10}, {2017,11,11}, {2017,11,12}, {2017,11,13}, {2017,11,14}, {2017,11,15}, {2017,11,16}, {2017,11,17}, {2017,11,18}, {2017,11,19}, {2017,11,20}, {2017,11,21}, 
-{2017,11,22}, {2017,11,23}, {2017,11,24}, {2017,11,25}, {2017,11,26}, {2017,11,27}, {2017,11,28}, {2017,11,29}, {2017,11,30}, {2017,12,1}, {2017,12,2}, {2017,12,3}, {2017,12,4}, {2017,12,5}, {2017,12,6}, {2017,12,7}, {2017,12,8}, {2017,12,9}, {2017,12,10}, {2017,12,11}, {2017,12,12}, {2017,12,13}, {2017,12,14}, {2017,12,15}, {2017,12,16}, {2017,12,17}, {2017,12,18}, {2017,12,19}, {2017,12,20}, {2017,12,21}, {2017,12,22}, {2017,12,23}, 
-{2017,12,24}, {2017,12,25}, {2017,12,26}, {2017,12,27}, {2017,12,28}, {2017,12,29}, {2017,12,30}, {2017,12,31}, {2018,1,1}, {2018,1,2}, {2018,1,3}, {2018,1,4}, {2018,1,5}, {2018,1,6}, {2018,1,7}, {2018,1,8}, {2018,1,9}, {2018,1,10}, {2018,1,11}, {2018,1,12}, {2018,1,13}, {2018,1,14}, {2018,1,15}, {2018,1,16}, {2018,1,17}, {2018,1,18}, {2018,1,19}, {2018,1,20}, {2018,1,21}, {2018,1,22}, {2018,1,23}, {2018,1,24}, 
-{2018,1,25}, {2018,1,26}, {2018,1,27}, {2018,1,28}, {2018,1,29}, {2018,1,30}, {2018,1,31}, {2018,2,1}, {2018,2,2}, {2018,2,3}, {2018,2,4}, {2018,2,5}, {2018,2,6}, {2018,2,7}, {2018,2,8}, {2018,2,9}, {2018,2,10}, {2018,2,11}, {2018,2,12}, {2018,2,13}, {2018,2,14}, {2018,2,15}, {2018,2,16}, {2018,2,17}, {2018,2,18}, {2018,2,19}, {2018,2,20}, {2018,2,21}, {2018,2,22}, {2018,2,23}, {2018,2,24}, {2018,2,25}, 
-{2018,2,26}, {2018,2,27}, {2018,2,28}, {2018,3,1}, {2018,3,2}, {2018,3,3}, {2018,3,4}, {2018,3,5}, {2018,3,6}, {2018,3,7}, {2018,3,8}, {2018,3,9}, {2018,3,10}, {2018,3,11}, {2018,3,12}, {2018,3,13}, {2018,3,14}, {2018,3,15}, {2018,3,16}, {2018,3,17}, {2018,3,18}, {2018,3,19}, {2018,3,20}, {2018,3,21}, {2018,3,22}, {2018,3,23}, {2018,3,24}, {2018,3,25}, {2018,3,26}, {2018,3,27}, {2018,3,28}, {2018,3,29}, 
-{2018,3,30}, {2018,3,31}, {2018,4,1}, {2018,4,2}, {2018,4,3}, {2018,4,4}, {2018,4,5}, {2018,4,6}, {2018,4,7}, {2018,4,8}, {2018,4,9}, {2018,4,10}, {2018,4,11}, {2018,4,12}, {2018,4,13}, {2018,4,14}, {2018,4,15}, {2018,4,16}, {2018,4,17}, {2018,4,18}, {2018,4,19}, {2018,4,20}, {2018,4,21}, {2018,4,22}, {2018,4,23}, {2018,4,24}, {2018,4,25}, {2018,4,26}, {2018,4,27}, {2018,4,28}, {2018,4,29}, {2018,4,30}, 
-{2018,5,1}, {2018,5,2}, {2018,5,3}, {2018,5,4}, {2018,5,5}, {2018,5,6}, {2018,5,7}, {2018,5,8}, {2018,5,9}, {2018,5,10}, {2018,5,11}, {2018,5,12}, {2018,5,13}, {2018,5,14}, {2018,5,15}, {2018,5,16}, {2018,5,17}, {2018,5,18}, {2018,5,19}, {2018,5,20}, {2018,5,21}, {2018,5,22}, {2018,5,23}, {2018,5,24}, {2018,5,25}, {2018,5,26}, {2018,5,27}, {2018,5,28}, {2018,5,29}, {2018,5,30}, {2018,5,31}, {2018,6,1}, 
-{2018,6,2}, {2018,6,3}, {2018,6,4}, {2018,6,5}, {2018,6,6}, {2018,6,7}, {2018,6,8}, {2018,6,9}, {2018,6,10}, {2018,6,11}, {2018,6,12}, {2018,6,13}, {2018,6,14}, {2018,6,15}, {2018,6,16}, {2018,6,17}, {2018,6,18}, {2018,6,19}, {2018,6,20}, {2018,6,21}, {2018,6,22}, {2018,6,23}, {2018,6,24}, {2018,6,25}, {2018,6,26}, {2018,6,27}, {2018,6,28}, {2018,6,29}, {2018,6,30}, {2018,7,1}, {2018,7,2}, {2018,7,3}, 
-{2018,7,4}, {2018,7,5}, {2018,7,6}, {2018,7,7}, {2018,7,8}, {2018,7,9}, {2018,7,10}, {2018,7,11}, {2018,7,12}, {2018,7,13}, {2018,7,14}, {2018,7,15}, {2018,7,16}, {2018,7,17}, {2018,7,18}, {2018,7,19}, {2018,7,20}, {2018,7,21}, {2018,7,22}, {2018,7,23}, {2018,7,24}, {2018,7,25}, {2018,7,26}, {2018,7,27}, {2018,7,28}, {2018,7,29}, {2018,7,30}, {2018,7,31}, {2018,8,1}, {2018,8,2}, {2018,8,3}, {2018,8,4}, 
-{2018,8,5}, {2018,8,6}, {2018,8,7}, {2018,8,8}, {2018,8,9}, {2018,8,10}, {2018,8,11}, {2018,8,12}, {2018,8,13}, {2018,8,14}, {2018,8,15}, {2018,8,16}, {2018,8,17}, {2018,8,18}, {2018,8,19}, {2018,8,20}, {2018,8,21}, {2018,8,22}, {2018,8,23}, {2018,8,24}, {2018,8,25}, {2018,8,26}, {2018,8,27}, {2018,8,28}, {2018,8,29}, {2018,8,30}, {2018,8,31}, {2018,9,1}, {2018,9,2}, {2018,9,3}, {2018,9,4}, {2018,9,5}, 
-{2018,9,6}, {2018,9,7}, {2018,9,8}, {2018,9,9}, {2018,9,10}, {2018,9,11}, {2018,9,12}, {2018,9,13}, {2018,9,14}, {2018,9,15}, {2018,9,16}, {2018,9,17}, {2018,9,18}, {2018,9,19}, {2018,9,20}, {2018,9,21}, {2018,9,22}, {2018,9,23}, {2018,9,24}, {2018,9,25}, {2018,9,26}, {2018,9,27}, {2018,9,28}, {2018,9,29}, {2018,9,30}, {2018,10,1}, {2018,10,2}, {2018,10,3}, {2018,10,4}, {2018,10,5}, {2018,10,6}, {2018,10,7}, 
-{2018,10,8}, {2018,10,9}, {2018,10,10}, {2018,10,11}, {2018,10,12}, {2018,10,13}, {2018,10,14}, {2018,10,15}, {2018,10,16}, {2018,10,17}, {2018,10,18}, {2018,10,19}, {2018,10,20}, {2018,10,21}, {2018,10,22}, {2018,10,23}, {2018,10,24}, {2018,10,25}, {2018,10,26}, {2018,10,27}, {2018,10,28}, {2018,10,29}, {2018,10,30}, {2018,10,31}, {2018,11,1}, {2018,11,2}, {2018,11,3}, {2018,11,4}, {2018,11,5}, {2018,11,6}, {2018,11,7}, {2018,11,8}, 
-{2018,11,9}, {2018,11,10}, {2018,11,11}, {2018,11,12}, {2018,11,13}, {2018,11,14}, {2018,11,15}, {2018,11,16}, {2018,11,17}, {2018,11,18}, {2018,11,19}, {2018,11,20}, {2018,11,21}, {2018,11,22}, {2018,11,23}, {2018,11,24}, {2018,11,25}, {2018,11,26}, {2018,11,27}, {2018,11,28}, {2018,11,29}, {2018,11,30}, {2018,12,1}, {2018,12,2}, {2018,12,3}, {2018,12,4}, {2018,12,5}, {2018,12,6}, {2018,12,7}, {2018,12,8}, {2018,12,9}, {2018,12,10}, 
-{2018,12,11}, {2018,12,12}, {2018,12,13}, {2018,12,14}, {2018,12,15}, {2018,12,16}, {2018,12,17}, {2018,12,18}, {2018,12,19}, {2018,12,20}, {2018,12,21}, {2018,12,22}, {2018,12,23}, {2018,12,24}, {2018,12,25}, {2018,12,26}, {2018,12,27}, {2018,12,28}, {2018,12,29}, {2018,12,30}, {2018,12,31}, {2019,1,1}, {2019,1,2}, {2019,1,3}, {2019,1,4}, {2019,1,5}, {2019,1,6}, {2019,1,7}, {2019,1,8}, {2019,1,9}, {2019,1,10}, {2019,1,11}, 
-{2019,1,12}, {2019,1,13}, {2019,1,14}, {2019,1,15}, {2019,1,16}, {2019,1,17}, {2019,1,18}, {2019,1,19}, {2019,1,20}, {2019,1,21}, {2019,1,22}, {2019,1,23}, {2019,1,24}, {2019,1,25}, {2019,1,26}, {2019,1,27}, {2019,1,28}, {2019,1,29}, {2019,1,30}, {2019,1,31}, {2019,2,1}, {2019,2,2}, {2019,2,3}, {2019,2,4}, {2019,2,5}, {2019,2,6}, {2019,2,7}, {2019,2,8}, {2019,2,9}, {2019,2,10}, {2019,2,11}, {2019,2,12}, 
-{2019,2,13}, {2019,2,14}, {2019,2,15}, {2019,2,16}, {2019,2,17}, {2019,2,18}, {2019,2,19}, {2019,2,20}, {2019,2,21}, {2019,2,22}, {2019,2,23}, {2019,2,24}, {2019,2,25}, {2019,2,26}, {2019,2,27}, {2019,2,28}, {2019,3,1}, {2019,3,2}, {2019,3,3}, {2019,3,4}, {2019,3,5}, {2019,3,6}, {2019,3,7}, {2019,3,8}, {2019,3,9}, {2019,3,10}, {2019,3,11}, {2019,3,12}, {2019,3,13}, {2019,3,14}, {2019,3,15}, {2019,3,16}, 
-{2019,3,17}, {2019,3,18}, {2019,3,19}, {2019,3,20}, {2019,3,21}, {2019,3,22}, {2019,3,23}, {2019,3,24}, {2019,3,25}, {2019,3,26}, {2019,3,27}, {2019,3,28}, {2019,3,29}, {2019,3,30}, {2019,3,31}, {2019,4,1}, {2019,4,2}, {2019,4,3}, {2019,4,4}, {2019,4,5}, {2019,4,6}, {2019,4,7}, {2019,4,8}, {2019,4,9}, {2019,4,10}, {2019,4,11}, {2019,4,12}, {2019,4,13}, {2019,4,14}, {2019,4,15}, {2019,4,16}, {2019,4,17}, 
-{2019,4,18}, {2019,4,19}, {2019,4,20}, {2019,4,21}, {2019,4,22}, {2019,4,23}, {2019,4,24}, {2019,4,25}, {2019,4,26}, {2019,4,27}, {2019,4,28}, {2019,4,29}, {2019,4,30}, {2019,5,1}, {2019,5,2}, {2019,5,3}, {2019,5,4}, {2019,5,5}, {2019,5,6}, {2019,5,7}, {2019,5,8}, {2019,5,9}, {2019,5,10}, {2019,5,11}, {2019,5,12}, {2019,5,13}, {2019,5,14}, {2019,5,15}, {2019,5,16}, {2019,5,17}, {2019,5,18}, {2019,5,19}, 
-{2019,5,20}, {2019,5,21}, {2019,5,22}, {2019,5,23}, {2019,5,24}, {2019,5,25}, {2019,5,26}, {2019,5,27}, {2019,5,28}, {2019,5,29}, {2019,5,30}, {2019,5,31}, {2019,6,1}, {2019,6,2}, {2019,6,3}, {2019,6,4}, {2019,6,5}, {2019,6,6}, {2019,6,7}, {2019,6,8}, {2019,6,9}, {2019,6,10}, {2019,6,11}, {2019,6,12}, {2019,6,13}, {2019,6,14}, {2019,6,15}, {2019,6,16}, {2019,6,17}, {2019,6,18}, {2019,6,19}, {2019,6,20}, 
-{2019,6,21}, {2019,6,22}, {2019,6,23}, {2019,6,24}, {2019,6,25}, {2019,6,26}, {2019,6,27}, {2019,6,28}, {2019,6,29}, {2019,6,30}, {2019,7,1}, {2019,7,2}, {2019,7,3}, {2019,7,4}, {2019,7,5}, {2019,7,6}, {2019,7,7}, {2019,7,8}, {2019,7,9}, {2019,7,10}, {2019,7,11}, {2019,7,12}, {2019,7,13}, {2019,7,14}, {2019,7,15}, {2019,7,16}, {2019,7,17}, {2019,7,18}, {2019,7,19}, {2019,7,20}, {2019,7,21}, {2019,7,22}, 
-{2019,7,23}, {2019,7,24}, {2019,7,25}, {2019,7,26}, {2019,7,27}, {2019,7,28}, {2019,7,29}, {2019,7,30}, {2019,7,31}, {2019,8,1}, {2019,8,2}, {2019,8,3}, {2019,8,4}, {2019,8,5}, {2019,8,6}, {2019,8,7}, {2019,8,8}, {2019,8,9}, {2019,8,10}, {2019,8,11}, {2019,8,12}, {2019,8,13}, {2019,8,14}, {2019,8,15}, {2019,8,16}, {2019,8,17}, {2019,8,18}, {2019,8,19}, {2019,8,20}, {2019,8,21}, {2019,8,22}, {2019,8,23}, 
-{2019,8,24}, {2019,8,25}, {2019,8,26}, {2019,8,27}, {2019,8,28}, {2019,8,29}, {2019,8,30}, {2019,8,31}, {2019,9,1}, {2019,9,2}, {2019,9,3}, {2019,9,4}, {2019,9,5}, {2019,9,6}, {2019,9,7}, {2019,9,8}, {2019,9,9}, {2019,9,10}, {2019,9,11}, {2019,9,12}, {2019,9,13}, {2019,9,14}, {2019,9,15}, {2019,9,16}, {2019,9,17}, {2019,9,18}, {2019,9,19}, {2019,9,20}, {2019,9,21}, {2019,9,22}, {2019,9,23}, {2019,9,24}, 
-{2019,9,25}, {2019,9,26}, {2019,9,27}, {2019,9,28}, {2019,9,29}, {2019,9,30}, {2019,10,1}, {2019,10,2}, {2019,10,3}, {2019,10,4}, {2019,10,5}, {2019,10,6}, {2019,10,7}, {2019,10,8}, {2019,10,9}, {2019,10,10}, {2019,10,11}, {2019,10,12}, {2019,10,13}, {2019,10,14}, {2019,10,15}, {2019,10,16}, {2019,10,17}, {2019,10,18}, {2019,10,19}, {2019,10,20}, {2019,10,21}, {2019,10,22}, {2019,10,23}, {2019,10,24}, {2019,10,25}, {2019,10,26}, 
-{2019,10,27}, {2019,10,28}, {2019,10,29}, {2019,10,30}, {2019,10,31}, {2019,11,1}, {2019,11,2}, {2019,11,3}, {2019,11,4}, {2019,11,5}, {2019,11,6}, {2019,11,7}, {2019,11,8}, {2019,11,9}, {2019,11,10}, {2019,11,11}, {2019,11,12}, {2019,11,13}, {2019,11,14}, {2019,11,15}, {2019,11,16}, {2019,11,17}, {2019,11,18}, {2019,11,19}, {2019,11,20}, {2019,11,21}, {2019,11,22}, {2019,11,23}, {2019,11,24}, {2019,11,25}, {2019,11,26}, {2019,11,27}, 
-{2019,11,28}, {2019,11,29}, {2019,11,30}, {2019,12,1}, {2019,12,2}, {2019,12,3}, {2019,12,4}, {2019,12,5}, {2019,12,6}, {2019,12,7}, {2019,12,8}, {2019,12,9}, {2019,12,10}, {2019,12,11}, {2019,12,12}, {2019,12,13}, {2019,12,14}, {2019,12,15}, {2019,12,16}, {2019,12,17}, {2019,12,18}, {2019,12,19}, {2019,12,20}, {2019,12,21}, {2019,12,22}, {2019,12,23}, {2019,12,24}, {2019,12,25}, {2019,12,26}, {2019,12,27}, {2019,12,28}, {2019,12,29}, 
-{2019,12,30}, {2019,12,31}, {2020,1,1}, {2020,1,2}, {2020,1,3}, {2020,1,4}, {2020,1,5}, {2020,1,6}, {2020,1,7}, {2020,1,8}, {2020,1,9}, {2020,1,10}, {2020,1,11}, {2020,1,12}, {2020,1,13}, {2020,1,14}, {2020,1,15}, {2020,1,16}, {2020,1,17}, {2020,1,18}, {2020,1,19}, {2020,1,20}, {2020,1,21}, {2020,1,22}, {2020,1,23}, {2020,1,24}, {2020,1,25}, {2020,1,26}, {2020,1,27}, {2020,1,28}, {2020,1,29}, {2020,1,30}, 
-{2020,1,31}, {2020,2,1}, {2020,2,2}, {2020,2,3}, {2020,2,4}, {2020,2,5}, {2020,2,6}, {2020,2,7}, {2020,2,8}, {2020,2,9}, {2020,2,10}, {2020,2,11}, {2020,2,12}, {2020,2,13}, {2020,2,14}, {2020,2,15}, {2020,2,16}, {2020,2,17}, {2020,2,18}, {2020,2,19}, {2020,2,20}, {2020,2,21}, {2020,2,22}, {2020,2,23}, {2020,2,24}, {2020,2,25}, {2020,2,26}, {2020,2,27}, {2020,2,28}, {2020,2,29}, {2020,3,1}, {2020,3,2}, 
-{2020,3,3}, {2020,3,4}, {2020,3,5}, {2020,3,6}, {2020,3,7}, {2020,3,8}, {2020,3,9}, {2020,3,10}, {2020,3,11}, {2020,3,12}, {2020,3,13}, {2020,3,14}, {2020,3,15}, {2020,3,16}, {2020,3,17}, {2020,3,18}, {2020,3,19}, {2020,3,20}, {2020,3,21}, {2020,3,22}, {2020,3,23}, {2020,3,24}, {2020,3,25}, {2020,3,26}, {2020,3,27}, {2020,3,28}, {2020,3,29}, {2020,3,30}, {2020,3,31}, {2020,4,1}, {2020,4,2}, {2020,4,3}, 
-{2020,4,4}, {2020,4,5}, {2020,4,6}, {2020,4,7}, {2020,4,8}, {2020,4,9}, {2020,4,10}, {2020,4,11}, {2020,4,12}, {2020,4,13}, {2020,4,14}, {2020,4,15}, {2020,4,16}, {2020,4,17}, {2020,4,18}, {2020,4,19}, {2020,4,20}, {2020,4,21}, {2020,4,22}, {2020,4,23}, {2020,4,24}, {2020,4,25}, {2020,4,26}, {2020,4,27}, {2020,4,28}, {2020,4,29}, {2020,4,30}, {2020,5,1}, {2020,5,2}, {2020,5,3}, {2020,5,4}, {2020,5,5}, 
-{2020,5,6}, {2020,5,7}, {2020,5,8}, {2020,5,9}, {2020,5,10}, {2020,5,11}, {2020,5,12}, {2020,5,13}, {2020,5,14}, {2020,5,15}, {2020,5,16}, {2020,5,17}, {2020,5,18}, {2020,5,19}, {2020,5,20}, {2020,5,21}, {2020,5,22}, {2020,5,23}, {2020,5,24}, {2020,5,25}, {2020,5,26}, {2020,5,27}, {2020,5,28}, {2020,5,29}, {2020,5,30}, {2020,5,31}, {2020,6,1}, {2020,6,2}, {2020,6,3}, {2020,6,4}, {2020,6,5}, {2020,6,6}, 
-{2020,6,7}, {2020,6,8}, {2020,6,9}, {2020,6,10}, {2020,6,11}, {2020,6,12}, {2020,6,13}, {2020,6,14}, {2020,6,15}, {2020,6,16}, {2020,6,17}, {2020,6,18}, {2020,6,19}, {2020,6,20}, {2020,6,21}, {2020,6,22}, {2020,6,23}, {2020,6,24}, {2020,6,25}, {2020,6,26}, {2020,6,27}, {2020,6,28}, {2020,6,29}, {2020,6,30}, {2020,7,1}, {2020,7,2}, {2020,7,3}, {2020,7,4}, {2020,7,5}, {2020,7,6}, {2020,7,7}, {2020,7,8}, 
-{2020,7,9}, {2020,7,10}, {2020,7,11}, {2020,7,12}, {2020,7,13}, {2020,7,14}, {2020,7,15}, {2020,7,16}, {2020,7,17}, {2020,7,18}, {2020,7,19}, {2020,7,20}, {2020,7,21}, {2020,7,22}, {2020,7,23}, {2020,7,24}, {2020,7,25}, {2020,7,26}, {2020,7,27}, {2020,7,28}, {2020,7,29}, {2020,7,30}, {2020,7,31}, {2020,8,1}, {2020,8,2}, {2020,8,3}, {2020,8,4}, {2020,8,5}, {2020,8,6}, {2020,8,7}, {2020,8,8}, {2020,8,9}, 
-{2020,8,10}, {2020,8,11}, {2020,8,12}, {2020,8,13}, {2020,8,14}, {2020,8,15}, {2020,8,16}, {2020,8,17}, {2020,8,18}, {2020,8,19}, {2020,8,20}, {2020,8,21}, {2020,8,22}, {2020,8,23}, {2020,8,24}, {2020,8,25}, {2020,8,26}, {2020,8,27}, {2020,8,28}, {2020,8,29}, {2020,8,30}, {2020,8,31}, {2020,9,1}, {2020,9,2}, {2020,9,3}, {2020,9,4}, {2020,9,5}, {2020,9,6}, {2020,9,7}, {2020,9,8}, {2020,9,9}, {2020,9,10}, 
-{2020,9,11}, {2020,9,12}, {2020,9,13}, {2020,9,14}, {2020,9,15}, {2020,9,16}, {2020,9,17}, {2020,9,18}, {2020,9,19}, {2020,9,20}, {2020,9,21}, {2020,9,22}, {2020,9,23}, {2020,9,24}, {2020,9,25}, {2020,9,26}, {2020,9,27}, {2020,9,28}, {2020,9,29}, {2020,9,30}, {2020,10,1}, {2020,10,2}, {2020,10,3}, {2020,10,4}, {2020,10,5}, {2020,10,6}, {2020,10,7}, {2020,10,8}, {2020,10,9}, {2020,10,10}, {2020,10,11}, {2020,10,12}, 
-{2020,10,13}, {2020,10,14}, {2020,10,15}, {2020,10,16}, {2020,10,17}, {2020,10,18}, {2020,10,19}, {2020,10,20}, {2020,10,21}, {2020,10,22}, {2020,10,23}, {2020,10,24}, {2020,10,25}, {2020,10,26}, {2020,10,27}, {2020,10,28}, {2020,10,29}, {2020,10,30}, {2020,10,31}, {2020,11,1}, {2020,11,2}, {2020,11,3}, {2020,11,4}, {2020,11,5}, {2020,11,6}, {2020,11,7}, {2020,11,8}, {2020,11,9}, {2020,11,10}, {2020,11,11}, {2020,11,12}, {2020,11,13}, 
-{2020,11,14}, {2020,11,15}, {2020,11,16}, {2020,11,17}, {2020,11,18}, {2020,11,19}, {2020,11,20}, {2020,11,21}, {2020,11,22}, {2020,11,23}, {2020,11,24}, {2020,11,25}, {2020,11,26}, {2020,11,27}, {2020,11,28}, {2020,11,29}, {2020,11,30}, {2020,12,1}, {2020,12,2}, {2020,12,3}, {2020,12,4}, {2020,12,5}, {2020,12,6}, {2020,12,7}, {2020,12,8}, {2020,12,9}, {2020,12,10}, {2020,12,11}, {2020,12,12}, {2020,12,13}, {2020,12,14}, {2020,12,15}, 
-{2020,12,16}, {2020,12,17}, {2020,12,18}, {2020,12,19}, {2020,12,20}, {2020,12,21}, {2020,12,22}, {2020,12,23}, {2020,12,24}, {2020,12,25}, {2020,12,26}, {2020,12,27}, {2020,12,28}, {2020,12,29}, {2020,12,30}, {2020,12,31}, {2021,1,1}, {2021,1,2}, {2021,1,3}, {2021,1,4}, {2021,1,5}, {2021,1,6}, {2021,1,7}, {2021,1,8}, {2021,1,9}, {2021,1,10}, {2021,1,11}, {2021,1,12}, {2021,1,13}, {2021,1,14}, {2021,1,15}, {2021,1,16}, 
-{2021,1,17}, {2021,1,18}, {2021,1,19}, {2021,1,20}, {2021,1,21}, {2021,1,22}, {2021,1,23}, {2021,1,24}, {2021,1,25}, {2021,1,26}, {2021,1,27}, {2021,1,28}, {2021,1,29}, {2021,1,30}, {2021,1,31}, {2021,2,1}, {2021,2,2}, {2021,2,3}, {2021,2,4}, {2021,2,5}, {2021,2,6}, {2021,2,7}, {2021,2,8}, {2021,2,9}, {2021,2,10}, {2021,2,11}, {2021,2,12}, {2021,2,13}, {2021,2,14}, {2021,2,15}, {2021,2,16}, {2021,2,17}, 
-{2021,2,18}, {2021,2,19}, {2021,2,20}, {2021,2,21}, {2021,2,22}, {2021,2,23}, {2021,2,24}, {2021,2,25}, {2021,2,26}, {2021,2,27}, {2021,2,28}, {2021,3,1}, {2021,3,2}, {2021,3,3}, {2021,3,4}, {2021,3,5}, {2021,3,6}, {2021,3,7}, {2021,3,8}, {2021,3,9}, {2021,3,10}, {2021,3,11}, {2021,3,12}, {2021,3,13}, {2021,3,14}, {2021,3,15}, {2021,3,16}, {2021,3,17}, {2021,3,18}, {2021,3,19}, {2021,3,20}, {2021,3,21}, 
-{2021,3,22}, {2021,3,23}, {2021,3,24}, {2021,3,25}, {2021,3,26}, {2021,3,27}, {2021,3,28}, {2021,3,29}, {2021,3,30}, {2021,3,31}, {2021,4,1}, {2021,4,2}, {2021,4,3}, {2021,4,4}, {2021,4,5}, {2021,4,6}, {2021,4,7}, {2021,4,8}, {2021,4,9}, {2021,4,10}, {2021,4,11}, {2021,4,12}, {2021,4,13}, {2021,4,14}, {2021,4,15}, {2021,4,16}, {2021,4,17}, {2021,4,18}, {2021,4,19}, {2021,4,20}, {2021,4,21}, {2021,4,22}, 
-{2021,4,23}, {2021,4,24}, {2021,4,25}, {2021,4,26}, {2021,4,27}, {2021,4,28}, {2021,4,29}, {2021,4,30}, {2021,5,1}, {2021,5,2}, {2021,5,3}, {2021,5,4}, {2021,5,5}, {2021,5,6}, {2021,5,7}, {2021,5,8}, {2021,5,9}, {2021,5,10}, {2021,5,11}, {2021,5,12}, {2021,5,13}, {2021,5,14}, {2021,5,15}, {2021,5,16}, {2021,5,17}, {2021,5,18}, {2021,5,19}, {2021,5,20}, {2021,5,21}, {2021,5,22}, {2021,5,23}, {2021,5,24}, 
-{2021,5,25}, {2021,5,26}, {2021,5,27}, {2021,5,28}, {2021,5,29}, {2021,5,30}, {2021,5,31}, {2021,6,1}, {2021,6,2}, {2021,6,3}, {2021,6,4}, {2021,6,5}, {2021,6,6}, {2021,6,7}, {2021,6,8}, {2021,6,9}, {2021,6,10}, {2021,6,11}, {2021,6,12}, {2021,6,13}, {2021,6,14}, {2021,6,15}, {2021,6,16}, {2021,6,17}, {2021,6,18}, {2021,6,19}, {2021,6,20}, {2021,6,21}, {2021,6,22}, {2021,6,23}, {2021,6,24}, {2021,6,25}, 
-{2021,6,26}, {2021,6,27}, {2021,6,28}, {2021,6,29}, {2021,6,30}, {2021,7,1}, {2021,7,2}, {2021,7,3}, {2021,7,4}, {2021,7,5}, {2021,7,6}, {2021,7,7}, {2021,7,8}, {2021,7,9}, {2021,7,10}, {2021,7,11}, {2021,7,12}, {2021,7,13}, {2021,7,14}, {2021,7,15}, {2021,7,16}, {2021,7,17}, {2021,7,18}, {2021,7,19}, {2021,7,20}, {2021,7,21}, {2021,7,22}, {2021,7,23}, {2021,7,24}, {2021,7,25}, {2021,7,26}, {2021,7,27}, 
-{2021,7,28}, {2021,7,29}, {2021,7,30}, {2021,7,31}, {2021,8,1}, {2021,8,2}, {2021,8,3}, {2021,8,4}, {2021,8,5}, {2021,8,6}, {2021,8,7}, {2021,8,8}, {2021,8,9}, {2021,8,10}, {2021,8,11}, {2021,8,12}, {2021,8,13}, {2021,8,14}, {2021,8,15}, {2021,8,16}, {2021,8,17}, {2021,8,18}, {2021,8,19}, {2021,8,20}, {2021,8,21}, {2021,8,22}, {2021,8,23}, {2021,8,24}, {2021,8,25}, {2021,8,26}, {2021,8,27}, {2021,8,28}, 
-{2021,8,29}, {2021,8,30}, {2021,8,31}, {2021,9,1}, {2021,9,2}, {2021,9,3}, {2021,9,4}, {2021,9,5}, {2021,9,6}, {2021,9,7}, {2021,9,8}, {2021,9,9}, {2021,9,10}, {2021,9,11}, {2021,9,12}, {2021,9,13}, {2021,9,14}, {2021,9,15}, {2021,9,16}, {2021,9,17}, {2021,9,18}, {2021,9,19}, {2021,9,20}, {2021,9,21}, {2021,9,22}, {2021,9,23}, {2021,9,24}, {2021,9,25}, {2021,9,26}, {2021,9,27}, {2021,9,28}, {2021,9,29}, 
-{2021,9,30}, {2021,10,1}, {2021,10,2}, {2021,10,3}, {2021,10,4}, {2021,10,5}, {2021,10,6}, {2021,10,7}, {2021,10,8}, {2021,10,9}, {2021,10,10}, {2021,10,11}, {2021,10,12}, {2021,10,13}, {2021,10,14}, {2021,10,15}, {2021,10,16}, {2021,10,17}, {2021,10,18}, {2021,10,19}, {2021,10,20}, {2021,10,21}, {2021,10,22}, {2021,10,23}, {2021,10,24}, {2021,10,25}, {2021,10,26}, {2021,10,27}, {2021,10,28}, {2021,10,29}, {2021,10,30}, {2021,10,31}, 
-{2021,11,1}, {2021,11,2}, {2021,11,3}, {2021,11,4}, {2021,11,5}, {2021,11,6}, {2021,11,7}, {2021,11,8}, {2021,11,9}, {2021,11,10}, {2021,11,11}, {2021,11,12}, {2021,11,13}, {2021,11,14}, {2021,11,15}, {2021,11,16}, {2021,11,17}, {2021,11,18}, {2021,11,19}, {2021,11,20}, {2021,11,21}, {2021,11,22}, {2021,11,23}, {2021,11,24}, {2021,11,25}, {2021,11,26}, {2021,11,27}, {2021,11,28}, {2021,11,29}, {2021,11,30}, {2021,12,1}, {2021,12,2}, 
-{2021,12,3}, {2021,12,4}, {2021,12,5}, {2021,12,6}, {2021,12,7}, {2021,12,8}, {2021,12,9}, {2021,12,10}, {2021,12,11}, {2021,12,12}, {2021,12,13}, {2021,12,14}, {2021,12,15}, {2021,12,16}, {2021,12,17}, {2021,12,18}, {2021,12,19}, {2021,12,20}, {2021,12,21}, {2021,12,22}, {2021,12,23}, {2021,12,24}, {2021,12,25}, {2021,12,26}, {2021,12,27}, {2021,12,28}, {2021,12,29}, {2021,12,30}, {2021,12,31}, {2022,1,1}, {2022,1,2}, {2022,1,3}, 
-{2022,1,4}, {2022,1,5}, {2022,1,6}, {2022,1,7}, {2022,1,8}, {2022,1,9}, {2022,1,10}, {2022,1,11}, {2022,1,12}, {2022,1,13}, {2022,1,14}, {2022,1,15}, {2022,1,16}, {2022,1,17}, {2022,1,18}, {2022,1,19}, {2022,1,20}, {2022,1,21}, {2022,1,22}, {2022,1,23}, {2022,1,24}, {2022,1,25}, {2022,1,26}, {2022,1,27}, {2022,1,28}, {2022,1,29}, {2022,1,30}, {2022,1,31}, {2022,2,1}, {2022,2,2}, {2022,2,3}, {2022,2,4}, 
-{2022,2,5}, {2022,2,6}, {2022,2,7}, {2022,2,8}, {2022,2,9}, {2022,2,10}, {2022,2,11}, {2022,2,12}, {2022,2,13}, {2022,2,14}, {2022,2,15}, {2022,2,16}, {2022,2,17}, {2022,2,18}, {2022,2,19}, {2022,2,20}, {2022,2,21}, {2022,2,22}, {2022,2,23}, {2022,2,24}, {2022,2,25}, {2022,2,26}, {2022,2,27}, {2022,2,28}, {2022,3,1}, {2022,3,2}, {2022,3,3}, {2022,3,4}, {2022,3,5}, {2022,3,6}, {2022,3,7}, {2022,3,8}, 
-{2022,3,9}, {2022,3,10}, {2022,3,11}, {2022,3,12}, {2022,3,13}, {2022,3,14}, {2022,3,15}, {2022,3,16}, {2022,3,17}, {2022,3,18}, {2022,3,19}, {2022,3,20}, {2022,3,21}, {2022,3,22}, {2022,3,23}, {2022,3,24}, {2022,3,25}, {2022,3,26}, {2022,3,27}, {2022,3,28}, {2022,3,29}, {2022,3,30}, {2022,3,31}, {2022,4,1}, {2022,4,2}, {2022,4,3}, {2022,4,4}, {2022,4,5}, {2022,4,6}, {2022,4,7}, {2022,4,8}, {2022,4,9}, 
-{2022,4,10}, {2022,4,11}, {2022,4,12}, {2022,4,13}, {2022,4,14}, {2022,4,15}, {2022,4,16}, {2022,4,17}, {2022,4,18}, {2022,4,19}, {2022,4,20}, {2022,4,21}, {2022,4,22}, {2022,4,23}, {2022,4,24}, {2022,4,25}, {2022,4,26}, {2022,4,27}, {2022,4,28}, {2022,4,29}, {2022,4,30}, {2022,5,1}, {2022,5,2}, {2022,5,3}, {2022,5,4}, {2022,5,5}, {2022,5,6}, {2022,5,7}, {2022,5,8}, {2022,5,9}, {2022,5,10}, {2022,5,11}, 
-{2022,5,12}, {2022,5,13}, {2022,5,14}, {2022,5,15}, {2022,5,16}, {2022,5,17}, {2022,5,18}, {2022,5,19}, {2022,5,20}, {2022,5,21}, {2022,5,22}, {2022,5,23}, {2022,5,24}, {2022,5,25}, {2022,5,26}, {2022,5,27}, {2022,5,28}, {2022,5,29}, {2022,5,30}, {2022,5,31}, {2022,6,1}, {2022,6,2}, {2022,6,3}, {2022,6,4}, {2022,6,5}, {2022,6,6}, {2022,6,7}, {2022,6,8}, {2022,6,9}, {2022,6,10}, {2022,6,11}, {2022,6,12}, 
-{2022,6,13}, {2022,6,14}, {2022,6,15}, {2022,6,16}, {2022,6,17}, {2022,6,18}, {2022,6,19}, {2022,6,20}, {2022,6,21}, {2022,6,22}, {2022,6,23}, {2022,6,24}, {2022,6,25}, {2022,6,26}, {2022,6,27}, {2022,6,28}, {2022,6,29}, {2022,6,30}, {2022,7,1}, {2022,7,2}, {2022,7,3}, {2022,7,4}, {2022,7,5}, {2022,7,6}, {2022,7,7}, {2022,7,8}, {2022,7,9}, {2022,7,10}, {2022,7,11}, {2022,7,12}, {2022,7,13}, {2022,7,14}, 
-{2022,7,15}, {2022,7,16}, {2022,7,17}, {2022,7,18}, {2022,7,19}, {2022,7,20}, {2022,7,21}, {2022,7,22}, {2022,7,23}, {2022,7,24}, {2022,7,25}, {2022,7,26}, {2022,7,27}, {2022,7,28}, {2022,7,29}, {2022,7,30}, {2022,7,31}, {2022,8,1}, {2022,8,2}, {2022,8,3}, {2022,8,4}, {2022,8,5}, {2022,8,6}, {2022,8,7}, {2022,8,8}, {2022,8,9}, {2022,8,10}, {2022,8,11}, {2022,8,12}, {2022,8,13}, {2022,8,14}, {2022,8,15}, 
-{2022,8,16}, {2022,8,17}, {2022,8,18}, {2022,8,19}, {2022,8,20}, {2022,8,21}, {2022,8,22}, {2022,8,23}, {2022,8,24}, {2022,8,25}, {2022,8,26}, {2022,8,27}, {2022,8,28}, {2022,8,29}, {2022,8,30}, {2022,8,31}, {2022,9,1}, {2022,9,2}, {2022,9,3}, {2022,9,4}, {2022,9,5}, {2022,9,6}, {2022,9,7}, {2022,9,8}, {2022,9,9}, {2022,9,10}, {2022,9,11}, {2022,9,12}, {2022,9,13}, {2022,9,14}, {2022,9,15}, {2022,9,16}, 
-{2022,9,17}, {2022,9,18}, {2022,9,19}, {2022,9,20}, {2022,9,21}, {2022,9,22}, {2022,9,23}, {2022,9,24}, {2022,9,25}, {2022,9,26}, {2022,9,27}, {2022,9,28}, {2022,9,29}, {2022,9,30}, {2022,10,1}, {2022,10,2}, {2022,10,3}, {2022,10,4}, {2022,10,5}, {2022,10,6}, {2022,10,7}, {2022,10,8}, {2022,10,9}, {2022,10,10}, {2022,10,11}, {2022,10,12}, {2022,10,13}, {2022,10,14}, {2022,10,15}, {2022,10,16}, {2022,10,17}, {2022,10,18}, 
-{2022,10,19}, {2022,10,20}, {2022,10,21}, {2022,10,22}, {2022,10,23}, {2022,10,24}, {2022,10,25}, {2022,10,26}, {2022,10,27}, {2022,10,28}, {2022,10,29}, {2022,10,30}, {2022,10,31}, {2022,11,1}, {2022,11,2}, {2022,11,3}, {2022,11,4}, {2022,11,5}, {2022,11,6}, {2022,11,7}, {2022,11,8}, {2022,11,9}, {2022,11,10}, {2022,11,11}, {2022,11,12}, {2022,11,13}, {2022,11,14}, {2022,11,15}, {2022,11,16}, {2022,11,17}, {2022,11,18}, {2022,11,19}, 
-{2022,11,20}, {2022,11,21}, {2022,11,22}, {2022,11,23}, {2022,11,24}, {2022,11,25}, {2022,11,26}, {2022,11,27}, {2022,11,28}, {2022,11,29}, {2022,11,30}, {2022,12,1}, {2022,12,2}, {2022,12,3}, {2022,12,4}, {2022,12,5}, {2022,12,6}, {2022,12,7}, {2022,12,8}, {2022,12,9}, {2022,12,10}, {2022,12,11}, {2022,12,12}, {2022,12,13}, {2022,12,14}, {2022,12,15}, {2022,12,16}, {2022,12,17}, {2022,12,18}, {2022,12,19}, {2022,12,20}, {2022,12,21}, 
-{2022,12,22}, {2022,12,23}, {2022,12,24}, {2022,12,25}, {2022,12,26}, {2022,12,27}, {2022,12,28}, {2022,12,29}, {2022,12,30}, {2022,12,31}, {2023,1,1}, {2023,1,2}, {2023,1,3}, {2023,1,4}, {2023,1,5}, {2023,1,6}, {2023,1,7}, {2023,1,8}, {2023,1,9}, {2023,1,10}, {2023,1,11}, {2023,1,12}, {2023,1,13}, {2023,1,14}, {2023,1,15}, {2023,1,16}, {2023,1,17}, {2023,1,18}, {2023,1,19}, {2023,1,20}, {2023,1,21}, {2023,1,22}, 
-{2023,1,23}, {2023,1,24}, {2023,1,25}, {2023,1,26}, {2023,1,27}, {2023,1,28}, {2023,1,29}, {2023,1,30}, {2023,1,31}, {2023,2,1}, {2023,2,2}, {2023,2,3}, {2023,2,4}, {2023,2,5}, {2023,2,6}, {2023,2,7}, {2023,2,8}, {2023,2,9}, {2023,2,10}, {2023,2,11}, {2023,2,12}, {2023,2,13}, {2023,2,14}, {2023,2,15}, {2023,2,16}, {2023,2,17}, {2023,2,18}, {2023,2,19}, {2023,2,20}, {2023,2,21}, {2023,2,22}, {2023,2,23}, 
-{2023,2,24}, {2023,2,25}, {2023,2,26}, {2023,2,27}, {2023,2,28}, {2023,3,1}, {2023,3,2}, {2023,3,3}, {2023,3,4}, {2023,3,5}, {2023,3,6}, {2023,3,7}, {2023,3,8}, {2023,3,9}, {2023,3,10}, {2023,3,11}, {2023,3,12}, {2023,3,13}, {2023,3,14}, {2023,3,15}, {2023,3,16}, {2023,3,17}, {2023,3,18}, {2023,3,19}, {2023,3,20}, {2023,3,21}, {2023,3,22}, {2023,3,23}, {2023,3,24}, {2023,3,25}, {2023,3,26}, {2023,3,27}, 
-{2023,3,28}, {2023,3,29}, {2023,3,30}, {2023,3,31}, {2023,4,1}, {2023,4,2}, {2023,4,3}, {2023,4,4}, {2023,4,5}, {2023,4,6}, {2023,4,7}, {2023,4,8}, {2023,4,9}, {2023,4,10}, {2023,4,11}, {2023,4,12}, {2023,4,13}, {2023,4,14}, {2023,4,15}, {2023,4,16}, {2023,4,17}, {2023,4,18}, {2023,4,19}, {2023,4,20}, {2023,4,21}, {2023,4,22}, {2023,4,23}, {2023,4,24}, {2023,4,25}, {2023,4,26}, {2023,4,27}, {2023,4,28}, 
-{2023,4,29}, {2023,4,30}, {2023,5,1}, {2023,5,2}, {2023,5,3}, {2023,5,4}, {2023,5,5}, {2023,5,6}, {2023,5,7}, {2023,5,8}, {2023,5,9}, {2023,5,10}, {2023,5,11}, {2023,5,12}, {2023,5,13}, {2023,5,14}, {2023,5,15}, {2023,5,16}, {2023,5,17}, {2023,5,18}, {2023,5,19}, {2023,5,20}, {2023,5,21}, {2023,5,22}, {2023,5,23}, {2023,5,24}, {2023,5,25}, {2023,5,26}, {2023,5,27}, {2023,5,28}, {2023,5,29}, {2023,5,30}, 
-{2023,5,31}, {2023,6,1}, {2023,6,2}, {2023,6,3}, {2023,6,4}, {2023,6,5}, {2023,6,6}, {2023,6,7}, {2023,6,8}, {2023,6,9}, {2023,6,10}, {2023,6,11}, {2023,6,12}, {2023,6,13}, {2023,6,14}, {2023,6,15}, {2023,6,16}, {2023,6,17}, {2023,6,18}, {2023,6,19}, {2023,6,20}, {2023,6,21}, {2023,6,22}, {2023,6,23}, {2023,6,24}, {2023,6,25}, {2023,6,26}, {2023,6,27}, {2023,6,28}, {2023,6,29}, {2023,6,30}, {2023,7,1}, 
-{2023,7,2}, {2023,7,3}, {2023,7,4}, {2023,7,5}, {2023,7,6}, {2023,7,7}, {2023,7,8}, {2023,7,9}, {2023,7,10}, {2023,7,11}, {2023,7,12}, {2023,7,13}, {2023,7,14}, {2023,7,15}, {2023,7,16}, {2023,7,17}, {2023,7,18}, {2023,7,19}, {2023,7,20}, {2023,7,21}, {2023,7,22}, {2023,7,23}, {2023,7,24}, {2023,7,25}, {2023,7,26}, {2023,7,27}, {2023,7,28}, {2023,7,29}, {2023,7,30}, {2023,7,31}, {2023,8,1}, {2023,8,2}, 
-{2023,8,3}, {2023,8,4}, {2023,8,5}, {2023,8,6}, {2023,8,7}, {2023,8,8}, {2023,8,9}, {2023,8,10}, {2023,8,11}, {2023,8,12}, {2023,8,13}, {2023,8,14}, {2023,8,15}, {2023,8,16}, {2023,8,17}, {2023,8,18}, {2023,8,19}, {2023,8,20}, {2023,8,21}, {2023,8,22}, {2023,8,23}, {2023,8,24}, {2023,8,25}, {2023,8,26}, {2023,8,27}, {2023,8,28}, {2023,8,29}, {2023,8,30}, {2023,8,31}, {2023,9,1}, {2023,9,2}, {2023,9,3}, 
-{2023,9,4}, {2023,9,5}, {2023,9,6}, {2023,9,7}, {2023,9,8}, {2023,9,9}, {2023,9,10}, {2023,9,11}, {2023,9,12}, {2023,9,13}, {2023,9,14}, {2023,9,15}, {2023,9,16}, {2023,9,17}, {2023,9,18}, {2023,9,19}, {2023,9,20}, {2023,9,21}, {2023,9,22}, {2023,9,23}, {2023,9,24}, {2023,9,25}, {2023,9,26}, {2023,9,27}, {2023,9,28}, {2023,9,29}, {2023,9,30}, {2023,10,1}, {2023,10,2}, {2023,10,3}, {2023,10,4}, {2023,10,5}, 
-{2023,10,6}, {2023,10,7}, {2023,10,8}, {2023,10,9}, {2023,10,10}, {2023,10,11}, {2023,10,12}, {2023,10,13}, {2023,10,14}, {2023,10,15}, {2023,10,16}, {2023,10,17}, {2023,10,18}, {2023,10,19}, {2023,10,20}, {2023,10,21}, {2023,10,22}, {2023,10,23}, {2023,10,24}, {2023,10,25}, {2023,10,26}, {2023,10,27}, {2023,10,28}, {2023,10,29}, {2023,10,30}, {2023,10,31}, {2023,11,1}, {2023,11,2}, {2023,11,3}, {2023,11,4}, {2023,11,5}, {2023,11,6}, 
-{2023,11,7}, {2023,11,8}, {2023,11,9}, {2023,11,10}, {2023,11,11}, {2023,11,12}, {2023,11,13}, {2023,11,14}, {2023,11,15}, {2023,11,16}, {2023,11,17}, {2023,11,18}, {2023,11,19}, {2023,11,20}, {2023,11,21}, {2023,11,22}, {2023,11,23}, {2023,11,24}, {2023,11,25}, {2023,11,26}, {2023,11,27}, {2023,11,28}, {2023,11,29}, {2023,11,30}, {2023,12,1}, {2023,12,2}, {2023,12,3}, {2023,12,4}, {2023,12,5}, {2023,12,6}, {2023,12,7}, {2023,12,8}, 
-{2023,12,9}, {2023,12,10}, {2023,12,11}, {2023,12,12}, {2023,12,13}, {2023,12,14}, {2023,12,15}, {2023,12,16}, {2023,12,17}, {2023,12,18}, {2023,12,19}, {2023,12,20}, {2023,12,21}, {2023,12,22}, {2023,12,23}, {2023,12,24}, {2023,12,25}, {2023,12,26}, {2023,12,27}, {2023,12,28}, {2023,12,29}, {2023,12,30}, {2023,12,31}, {2024,1,1}, {2024,1,2}, {2024,1,3}, {2024,1,4}, {2024,1,5}, {2024,1,6}, {2024,1,7}, {2024,1,8}, {2024,1,9}, 
-{2024,1,10}, {2024,1,11}, {2024,1,12}, {2024,1,13}, {2024,1,14}, {2024,1,15}, {2024,1,16}, {2024,1,17}, {2024,1,18}, {2024,1,19}, {2024,1,20}, {2024,1,21}, {2024,1,22}, {2024,1,23}, {2024,1,24}, {2024,1,25}, {2024,1,26}, {2024,1,27}, {2024,1,28}, {2024,1,29}, {2024,1,30}, {2024,1,31}, {2024,2,1}, {2024,2,2}, {2024,2,3}, {2024,2,4}, {2024,2,5}, {2024,2,6}, {2024,2,7}, {2024,2,8}, {2024,2,9}, {2024,2,10}, 
-{2024,2,11}, {2024,2,12}, {2024,2,13}, {2024,2,14}, {2024,2,15}, {2024,2,16}, {2024,2,17}, {2024,2,18}, {2024,2,19}, {2024,2,20}, {2024,2,21}, {2024,2,22}, {2024,2,23}, {2024,2,24}, {2024,2,25}, {2024,2,26}, {2024,2,27}, {2024,2,28}, {2024,2,29}, {2024,3,1}, {2024,3,2}, {2024,3,3}, {2024,3,4}, {2024,3,5}, {2024,3,6}, {2024,3,7}, {2024,3,8}, {2024,3,9}, {2024,3,10}, {2024,3,11}, {2024,3,12}, {2024,3,13}, 
-{2024,3,14}, {2024,3,15}, {2024,3,16}, {2024,3,17}, {2024,3,18}, {2024,3,19}, {2024,3,20}, {2024,3,21}, {2024,3,22}, {2024,3,23}, {2024,3,24}, {2024,3,25}, {2024,3,26}, {2024,3,27}, {2024,3,28}, {2024,3,29}, {2024,3,30}, {2024,3,31}, {2024,4,1}, {2024,4,2}, {2024,4,3}, {2024,4,4}, {2024,4,5}, {2024,4,6}, {2024,4,7}, {2024,4,8}, {2024,4,9}, {2024,4,10}, {2024,4,11}, {2024,4,12}, {2024,4,13}, {2024,4,14}, 
-{2024,4,15}, {2024,4,16}, {2024,4,17}, {2024,4,18}, {2024,4,19}, {2024,4,20}, {2024,4,21}, {2024,4,22}, {2024,4,23}, {2024,4,24}, {2024,4,25}, {2024,4,26}, {2024,4,27}, {2024,4,28}, {2024,4,29}, {2024,4,30}, {2024,5,1}, {2024,5,2}, {2024,5,3}, {2024,5,4}, {2024,5,5}, {2024,5,6}, {2024,5,7}, {2024,5,8}, {2024,5,9}, {2024,5,10}, {2024,5,11}, {2024,5,12}, {2024,5,13}, {2024,5,14}, {2024,5,15}, {2024,5,16}, 
-{2024,5,17}, {2024,5,18}, {2024,5,19}, {2024,5,20}, {2024,5,21}, {2024,5,22}, {2024,5,23}, {2024,5,24}, {2024,5,25}, {2024,5,26}, {2024,5,27}, {2024,5,28}, {2024,5,29}, {2024,5,30}, {2024,5,31}, {2024,6,1}, {2024,6,2}, {2024,6,3}, {2024,6,4}, {2024,6,5}, {2024,6,6}, {2024,6,7}, {2024,6,8}, {2024,6,9}, {2024,6,10}, {2024,6,11}, {2024,6,12}, {2024,6,13}, {2024,6,14}, {2024,6,15}, {2024,6,16}, {2024,6,17}, 
-{2024,6,18}, {2024,6,19}, {2024,6,20}, {2024,6,21}, {2024,6,22}, {2024,6,23}, {2024,6,24}, {2024,6,25}, {2024,6,26}, {2024,6,27}, {2024,6,28}, {2024,6,29}, {2024,6,30}, {2024,7,1}, {2024,7,2}, {2024,7,3}, {2024,7,4}, {2024,7,5}, {2024,7,6}, {2024,7,7}, {2024,7,8}, {2024,7,9}, {2024,7,10}, {2024,7,11}, {2024,7,12}, {2024,7,13}, {2024,7,14}, {2024,7,15}, {2024,7,16}, {2024,7,17}, {2024,7,18}, {2024,7,19}, 
-{2024,7,20}, {2024,7,21}, {2024,7,22}, {2024,7,23}, {2024,7,24}, {2024,7,25}, {2024,7,26}, {2024,7,27}, {2024,7,28}, {2024,7,29}, {2024,7,30}, {2024,7,31}, {2024,8,1}, {2024,8,2}, {2024,8,3}, {2024,8,4}, {2024,8,5}, {2024,8,6}, {2024,8,7}, {2024,8,8}, {2024,8,9}, {2024,8,10}, {2024,8,11}, {2024,8,12}, {2024,8,13}, {2024,8,14}, {2024,8,15}, {2024,8,16}, {2024,8,17}, {2024,8,18}, {2024,8,19}, {2024,8,20}, 
-{2024,8,21}, {2024,8,22}, {2024,8,23}, {2024,8,24}, {2024,8,25}, {2024,8,26}, {2024,8,27}, {2024,8,28}, {2024,8,29}, {2024,8,30}, {2024,8,31}, {2024,9,1}, {2024,9,2}, {2024,9,3}, {2024,9,4}, {2024,9,5}, {2024,9,6}, {2024,9,7}, {2024,9,8}, {2024,9,9}, {2024,9,10}, {2024,9,11}, {2024,9,12}, {2024,9,13}, {2024,9,14}, {2024,9,15}, {2024,9,16}, {2024,9,17}, {2024,9,18}, {2024,9,19}, {2024,9,20}, {2024,9,21}, 
-{2024,9,22}, {2024,9,23}, {2024,9,24}, {2024,9,25}, {2024,9,26}, {2024,9,27}, {2024,9,28}, {2024,9,29}, {2024,9,30}, {2024,10,1}, {2024,10,2}, {2024,10,3}, {2024,10,4}, {2024,10,5}, {2024,10,6}, {2024,10,7}, {2024,10,8}, {2024,10,9}, {2024,10,10}, {2024,10,11}, {2024,10,12}, {2024,10,13}, {2024,10,14}, {2024,10,15}, {2024,10,16}, {2024,10,17}, {2024,10,18}, {2024,10,19}, {2024,10,20}, {2024,10,21}, {2024,10,22}, {2024,10,23}, 
-{2024,10,24}, {2024,10,25}, {2024,10,26}, {2024,10,27}, {2024,10,28}, {2024,10,29}, {2024,10,30}, {2024,10,31}, {2024,11,1}, {2024,11,2}, {2024,11,3}, {2024,11,4}, {2024,11,5}, {2024,11,6}, {2024,11,7}, {2024,11,8}, {2024,11,9}, {2024,11,10}, {2024,11,11}, {2024,11,12}, {2024,11,13}, {2024,11,14}, {2024,11,15}, {2024,11,16}, {2024,11,17}, {2024,11,18}, {2024,11,19}, {2024,11,20}, {2024,11,21}, {2024,11,22}, {2024,11,23}, {2024,11,24}, 
-{2024,11,25}, {2024,11,26}, {2024,11,27}, {2024,11,28}, {2024,11,29}, {2024,11,30}, {2024,12,1}, {2024,12,2}, {2024,12,3}, {2024,12,4}, {2024,12,5}, {2024,12,6}, {2024,12,7}, {2024,12,8}, {2024,12,9}, {2024,12,10}, {2024,12,11}, {2024,12,12}, {2024,12,13}, {2024,12,14}, {2024,12,15}, {2024,12,16}, {2024,12,17}, {2024,12,18}, {2024,12,19}, {2024,12,20}, {2024,12,21}, {2024,12,22}, {2024,12,23}, {2024,12,24}, {2024,12,25}, {2024,12,26}, 
-{2024,12,27}, {2024,12,28}, {2024,12,29}, {2024,12,30}, {2024,12,31}, {2025,1,1}, {2025,1,2}, {2025,1,3}, {2025,1,4}, {2025,1,5}, {2025,1,6}, {2025,1,7}, {2025,1,8}, {2025,1,9}, {2025,1,10}, {2025,1,11}, {2025,1,12}, {2025,1,13}, {2025,1,14}, {2025,1,15}, {2025,1,16}, {2025,1,17}, {2025,1,18}, {2025,1,19}, {2025,1,20}, {2025,1,21}, {2025,1,22}, {2025,1,23}, {2025,1,24}, {2025,1,25}, {2025,1,26}, {2025,1,27}, 
-{2025,1,28}, {2025,1,29}, {2025,1,30}, {2025,1,31}, {2025,2,1}, {2025,2,2}, {2025,2,3}, {2025,2,4}, {2025,2,5}, {2025,2,6}, {2025,2,7}, {2025,2,8}, {2025,2,9}, {2025,2,10}, {2025,2,11}, {2025,2,12}, {2025,2,13}, {2025,2,14}, {2025,2,15}, {2025,2,16}, {2025,2,17}, {2025,2,18}, {2025,2,19}, {2025,2,20}, {2025,2,21}, {2025,2,22}, {2025,2,23}, {2025,2,24}, {2025,2,25}, {2025,2,26}, {2025,2,27}, {2025,2,28}, 
-{2025,3,1}, {2025,3,2}, {2025,3,3}, {2025,3,4}, {2025,3,5}, {2025,3,6}, {2025,3,7}, {2025,3,8}, {2025,3,9}, {2025,3,10}, {2025,3,11}, {2025,3,12}, {2025,3,13}, {2025,3,14}, {2025,3,15}, {2025,3,16}, {2025,3,17}, {2025,3,18}, {2025,3,19}, {2025,3,20}, {2025,3,21}, {2025,3,22}, {2025,3,23}, {2025,3,24}, {2025,3,25}, {2025,3,26}, {2025,3,27}, {2025,3,28}, {2025,3,29}, {2025,3,30}, {2025,3,31}, {2025,4,1}, 
-{2025,4,2}, {2025,4,3}, {2025,4,4}, {2025,4,5}, {2025,4,6}, {2025,4,7}, {2025,4,8}, {2025,4,9}, {2025,4,10}, {2025,4,11}, {2025,4,12}, {2025,4,13}, {2025,4,14}, {2025,4,15}, {2025,4,16}, {2025,4,17}, {2025,4,18}, {2025,4,19}, {2025,4,20}, {2025,4,21}, {2025,4,22}, {2025,4,23}, {2025,4,24}, {2025,4,25}, {2025,4,26}, {2025,4,27}, {2025,4,28}, {2025,4,29}, {2025,4,30}, {2025,5,1}, {2025,5,2}, {2025,5,3}, 
-{2025,5,4}, {2025,5,5}, {2025,5,6}, {2025,5,7}, {2025,5,8}, {2025,5,9}, {2025,5,10}, {2025,5,11}, {2025,5,12}, {2025,5,13}, {2025,5,14}, {2025,5,15}, {2025,5,16}, {2025,5,17}, {2025,5,18}, {2025,5,19}, {2025,5,20}, {2025,5,21}, {2025,5,22}, {2025,5,23}, {2025,5,24}, {2025,5,25}, {2025,5,26}, {2025,5,27}, {2025,5,28}, {2025,5,29}, {2025,5,30}, {2025,5,31}, {2025,6,1}, {2025,6,2}, {2025,6,3}, {2025,6,4}, 
-{2025,6,5}, {2025,6,6}, {2025,6,7}, {2025,6,8}, {2025,6,9}, {2025,6,10}, {2025,6,11}, {2025,6,12}, {2025,6,13}, {2025,6,14}, {2025,6,15}, {2025,6,16}, {2025,6,17}, {2025,6,18}, {2025,6,19}, {2025,6,20}, {2025,6,21}, {2025,6,22}, {2025,6,23}, {2025,6,24}, {2025,6,25}, {2025,6,26}, {2025,6,27}, {2025,6,28}, {2025,6,29}, {2025,6,30}, {2025,7,1}, {2025,7,2}, {2025,7,3}, {2025,7,4}, {2025,7,5}, {2025,7,6}, 
-{2025,7,7}, {2025,7,8}, {2025,7,9}, {2025,7,10}, {2025,7,11}, {2025,7,12}, {2025,7,13}, {2025,7,14}, {2025,7,15}, {2025,7,16}, {2025,7,17}, {2025,7,18}, {2025,7,19}, {2025,7,20}, {2025,7,21}, {2025,7,22}, {2025,7,23}, {2025,7,24}, {2025,7,25}, {2025,7,26}, {2025,7,27}, {2025,7,28}, {2025,7,29}, {2025,7,30}, {2025,7,31}, {2025,8,1}, {2025,8,2}, {2025,8,3}, {2025,8,4}, {2025,8,5}, {2025,8,6}, {2025,8,7}, 
-{2025,8,8}, {2025,8,9}, {2025,8,10}, {2025,8,11}, {2025,8,12}, {2025,8,13}, {2025,8,14}, {2025,8,15}, {2025,8,16}, {2025,8,17}, {2025,8,18}, {2025,8,19}, {2025,8,20}, {2025,8,21}, {2025,8,22}, {2025,8,23}, {2025,8,24}, {2025,8,25}, {2025,8,26}, {2025,8,27}, {2025,8,28}, {2025,8,29}, {2025,8,30}, {2025,8,31}, {2025,9,1}, {2025,9,2}, {2025,9,3}, {2025,9,4}, {2025,9,5}, {2025,9,6}, {2025,9,7}, {2025,9,8}, 
-{2025,9,9}, {2025,9,10}, {2025,9,11}, {2025,9,12}, {2025,9,13}, {2025,9,14}, {2025,9,15}, {2025,9,16}, {2025,9,17}, {2025,9,18}, {2025,9,19}, {2025,9,20}, {2025,9,21}, {2025,9,22}, {2025,9,23}, {2025,9,24}, {2025,9,25}, {2025,9,26}, {2025,9,27}, {2025,9,28}, {2025,9,29}, {2025,9,30}, {2025,10,1}, {2025,10,2}, {2025,10,3}, {2025,10,4}, {2025,10,5}, {2025,10,6}, {2025,10,7}, {2025,10,8}, {2025,10,9}, {2025,10,10}, 
-{2025,10,11}, {2025,10,12}, {2025,10,13}, {2025,10,14}, {2025,10,15}, {2025,10,16}, {2025,10,17}, {2025,10,18}, {2025,10,19}, {2025,10,20}, {2025,10,21}, {2025,10,22}, {2025,10,23}, {2025,10,24}, {2025,10,25}, {2025,10,26}, {2025,10,27}, {2025,10,28}, {2025,10,29}, {2025,10,30}, {2025,10,31}, {2025,11,1}, {2025,11,2}, {2025,11,3}, {2025,11,4}, {2025,11,5}, {2025,11,6}, {2025,11,7}, {2025,11,8}, {2025,11,9}, {2025,11,10}, {2025,11,11}, 
-{2025,11,12}, {2025,11,13}, {2025,11,14}, {2025,11,15}, {2025,11,16}, {2025,11,17}, {2025,11,18}, {2025,11,19}, {2025,11,20}, {2025,11,21}, {2025,11,22}, {2025,11,23}, {2025,11,24}, {2025,11,25}, {2025,11,26}, {2025,11,27}, {2025,11,28}, {2025,11,29}, {2025,11,30}, {2025,12,1}, {2025,12,2}, {2025,12,3}, {2025,12,4}, {2025,12,5}, {2025,12,6}, {2025,12,7}, {2025,12,8}, {2025,12,9}, {2025,12,10}, {2025,12,11}, {2025,12,12}, {2025,12,13}, 
-{2025,12,14}, {2025,12,15}, {2025,12,16}, {2025,12,17}, {2025,12,18}, {2025,12,19}, {2025,12,20}, {2025,12,21}, {2025,12,22}, {2025,12,23}, {2025,12,24}, {2025,12,25}, {2025,12,26}, {2025,12,27}, {2025,12,28}, {2025,12,29}, {2025,12,30}, {2025,12,31}, {2026,1,1}, {2026,1,2}, {2026,1,3}, {2026,1,4}, {2026,1,5}, {2026,1,6}, {2026,1,7}, {2026,1,8}, {2026,1,9}, {2026,1,10}, {2026,1,11}, {2026,1,12}, {2026,1,13}, {2026,1,14}, 
-{2026,1,15}, {2026,1,16}, {2026,1,17}, {2026,1,18}, {2026,1,19}, {2026,1,20}, {2026,1,21}, {2026,1,22}, {2026,1,23}, {2026,1,24}, {2026,1,25}, {2026,1,26}, {2026,1,27}, {2026,1,28}, {2026,1,29}, {2026,1,30}, {2026,1,31}, {2026,2,1}, {2026,2,2}, {2026,2,3}, {2026,2,4}, {2026,2,5}, {2026,2,6}, {2026,2,7}, {2026,2,8}, {2026,2,9}, {2026,2,10}, {2026,2,11}, {2026,2,12}, {2026,2,13}, {2026,2,14}, {2026,2,15}, 
-{2026,2,16}, {2026,2,17}, {2026,2,18}, {2026,2,19}, {2026,2,20}, {2026,2,21}, {2026,2,22}, {2026,2,23}, {2026,2,24}, {2026,2,25}, {2026,2,26}, {2026,2,27}, {2026,2,28}, {2026,3,1}, {2026,3,2}, {2026,3,3}, {2026,3,4}, {2026,3,5}, {2026,3,6}, {2026,3,7}, {2026,3,8}, {2026,3,9}, {2026,3,10}, {2026,3,11}, {2026,3,12}, {2026,3,13}, {2026,3,14}, {2026,3,15}, {2026,3,16}, {2026,3,17}, {2026,3,18}, {2026,3,19}, 
-{2026,3,20}, {2026,3,21}, {2026,3,22}, {2026,3,23}, {2026,3,24}, {2026,3,25}, {2026,3,26}, {2026,3,27}, {2026,3,28}, {2026,3,29}, {2026,3,30}, {2026,3,31}, {2026,4,1}, {2026,4,2}, {2026,4,3}, {2026,4,4}, {2026,4,5}, {2026,4,6}, {2026,4,7}, {2026,4,8}, {2026,4,9}, {2026,4,10}, {2026,4,11}, {2026,4,12}, {2026,4,13}, {2026,4,14}, {2026,4,15}, {2026,4,16}, {2026,4,17}, {2026,4,18}, {2026,4,19}, {2026,4,20}, 
-{2026,4,21}, {2026,4,22}, {2026,4,23}, {2026,4,24}, {2026,4,25}, {2026,4,26}, {2026,4,27}, {2026,4,28}, {2026,4,29}, {2026,4,30}, {2026,5,1}, {2026,5,2}, {2026,5,3}, {2026,5,4}, {2026,5,5}, {2026,5,6}, {2026,5,7}, {2026,5,8}, {2026,5,9}, {2026,5,10}, {2026,5,11}, {2026,5,12}, {2026,5,13}, {2026,5,14}, {2026,5,15}, {2026,5,16}, {2026,5,17}, {2026,5,18}, {2026,5,19}, {2026,5,20}, {2026,5,21}, {2026,5,22}, 
-{2026,5,23}, {2026,5,24}, {2026,5,25}, {2026,5,26}, {2026,5,27}, {2026,5,28}, {2026,5,29}, {2026,5,30}, {2026,5,31}, {2026,6,1}, {2026,6,2}, {2026,6,3}, {2026,6,4}, {2026,6,5}, {2026,6,6}, {2026,6,7}, {2026,6,8}, {2026,6,9}, {2026,6,10}, {2026,6,11}, {2026,6,12}, {2026,6,13}, {2026,6,14}, {2026,6,15}, {2026,6,16}, {2026,6,17}, {2026,6,18}, {2026,6,19}, {2026,6,20}, {2026,6,21}, {2026,6,22}, {2026,6,23}, 
-{2026,6,24}, {2026,6,25}, {2026,6,26}, {2026,6,27}, {2026,6,28}, {2026,6,29}, {2026,6,30}, {2026,7,1}, {2026,7,2}, {2026,7,3}, {2026,7,4}, {2026,7,5}, {2026,7,6}, {2026,7,7}, {2026,7,8}, {2026,7,9}, {2026,7,10}, {2026,7,11}, {2026,7,12}, {2026,7,13}, {2026,7,14}, {2026,7,15}, {2026,7,16}, {2026,7,17}, {2026,7,18}, {2026,7,19}, {2026,7,20}, {2026,7,21}, {2026,7,22}, {2026,7,23}, {2026,7,24}, {2026,7,25}, 
-{2026,7,26}, {2026,7,27}, {2026,7,28}, {2026,7,29}, {2026,7,30}, {2026,7,31}, {2026,8,1}, {2026,8,2}, {2026,8,3}, {2026,8,4}, {2026,8,5}, {2026,8,6}, {2026,8,7}, {2026,8,8}, {2026,8,9}, {2026,8,10}, {2026,8,11}, {2026,8,12}, {2026,8,13}, {2026,8,14}, {2026,8,15}, {2026,8,16}, {2026,8,17}, {2026,8,18}, {2026,8,19}, {2026,8,20}, {2026,8,21}, {2026,8,22}, {2026,8,23}, {2026,8,24}, {2026,8,25}, {2026,8,26}, 
-{2026,8,27}, {2026,8,28}, {2026,8,29}, {2026,8,30}, {2026,8,31}, {2026,9,1}, {2026,9,2}, {2026,9,3}, {2026,9,4}, {2026,9,5}, {2026,9,6}, {2026,9,7}, {2026,9,8}, {2026,9,9}, {2026,9,10}, {2026,9,11}, {2026,9,12}, {2026,9,13}, {2026,9,14}, {2026,9,15}, {2026,9,16}, {2026,9,17}, {2026,9,18}, {2026,9,19}, {2026,9,20}, {2026,9,21}, {2026,9,22}, {2026,9,23}, {2026,9,24}, {2026,9,25}, {2026,9,26}, {2026,9,27}, 
-{2026,9,28}, {2026,9,29}, {2026,9,30}, {2026,10,1}, {2026,10,2}, {2026,10,3}, {2026,10,4}, {2026,10,5}, {2026,10,6}, {2026,10,7}, {2026,10,8}, {2026,10,9}, {2026,10,10}, {2026,10,11}, {2026,10,12}, {2026,10,13}, {2026,10,14}, {2026,10,15}, {2026,10,16}, {2026,10,17}, {2026,10,18}, {2026,10,19}, {2026,10,20}, {2026,10,21}, {2026,10,22}, {2026,10,23}, {2026,10,24}, {2026,10,25}, {2026,10,26}, {2026,10,27}, {2026,10,28}, {2026,10,29}, 
-{2026,10,30}, {2026,10,31}, {2026,11,1}, {2026,11,2}, {2026,11,3}, {2026,11,4}, {2026,11,5}, {2026,11,6}, {2026,11,7}, {2026,11,8}, {2026,11,9}, {2026,11,10}, {2026,11,11}, {2026,11,12}, {2026,11,13}, {2026,11,14}, {2026,11,15}, {2026,11,16}, {2026,11,17}, {2026,11,18}, {2026,11,19}, {2026,11,20}, {2026,11,21}, {2026,11,22}, {2026,11,23}, {2026,11,24}, {2026,11,25}, {2026,11,26}, {2026,11,27}, {2026,11,28}, {2026,11,29}, {2026,11,30}, 
-{2026,12,1}, {2026,12,2}, {2026,12,3}, {2026,12,4}, {2026,12,5}, {2026,12,6}, {2026,12,7}, {2026,12,8}, {2026,12,9}, {2026,12,10}, {2026,12,11}, {2026,12,12}, {2026,12,13}, {2026,12,14}, {2026,12,15}, {2026,12,16}, {2026,12,17}, {2026,12,18}, {2026,12,19}, {2026,12,20}, {2026,12,21}, {2026,12,22}, {2026,12,23}, {2026,12,24}, {2026,12,25}, {2026,12,26}, {2026,12,27}, {2026,12,28}, {2026,12,29}, {2026,12,30}, {2026,12,31}, {2027,1,1}, 
-{2027,1,2}, {2027,1,3}, {2027,1,4}, {2027,1,5}, {2027,1,6}, {2027,1,7}, {2027,1,8}, {2027,1,9}, {2027,1,10}, {2027,1,11}, {2027,1,12}, {2027,1,13}, {2027,1,14}, {2027,1,15}, {2027,1,16}, {2027,1,17}, {2027,1,18}, {2027,1,19}, {2027,1,20}, {2027,1,21}, {2027,1,22}, {2027,1,23}, {2027,1,24}, {2027,1,25}, {2027,1,26}, {2027,1,27}, {2027,1,28}, {2027,1,29}, {2027,1,30}, {2027,1,31}, {2027,2,1}, {2027,2,2}, 
-{2027,2,3}, {2027,2,4}, {2027,2,5}, {2027,2,6}, {2027,2,7}, {2027,2,8}, {2027,2,9}, {2027,2,10}, {2027,2,11}, {2027,2,12}, {2027,2,13}, {2027,2,14}, {2027,2,15}, {2027,2,16}, {2027,2,17}, {2027,2,18}, {2027,2,19}, {2027,2,20}, {2027,2,21}, {2027,2,22}, {2027,2,23}, {2027,2,24}, {2027,2,25}, {2027,2,26}, {2027,2,27}, {2027,2,28}, {2027,3,1}, {2027,3,2}, {2027,3,3}, {2027,3,4}, {2027,3,5}, {2027,3,6}, 
-{2027,3,7}, {2027,3,8}, {2027,3,9}, {2027,3,10}, {2027,3,11}, {2027,3,12}, {2027,3,13}, {2027,3,14}, {2027,3,15}, {2027,3,16}, {2027,3,17}, {2027,3,18}, {2027,3,19}, {2027,3,20}, {2027,3,21}, {2027,3,22}, {2027,3,23}, {2027,3,24}, {2027,3,25}, {2027,3,26}, {2027,3,27}, {2027,3,28}, {2027,3,29}, {2027,3,30}, {2027,3,31}, {2027,4,1}, {2027,4,2}, {2027,4,3}, {2027,4,4}, {2027,4,5}, {2027,4,6}, {2027,4,7}, 
-{2027,4,8}, {2027,4,9}, {2027,4,10}, {2027,4,11}, {2027,4,12}, {2027,4,13}, {2027,4,14}, {2027,4,15}, {2027,4,16}, {2027,4,17}, {2027,4,18}, {2027,4,19}, {2027,4,20}, {2027,4,21}, {2027,4,22}, {2027,4,23}, {2027,4,24}, {2027,4,25}, {2027,4,26}, {2027,4,27}, {2027,4,28}, {2027,4,29}, {2027,4,30}, {2027,5,1}, {2027,5,2}, {2027,5,3}, {2027,5,4}, {2027,5,5}, {2027,5,6}, {2027,5,7}, {2027,5,8}, {2027,5,9}, 
-{2027,5,10}, {2027,5,11}, {2027,5,12}, {2027,5,13}, {2027,5,14}, {2027,5,15}, {2027,5,16}, {2027,5,17}, {2027,5,18}, {2027,5,19}, {2027,5,20}, {2027,5,21}, {2027,5,22}, {2027,5,23}, {2027,5,24}, {2027,5,25}, {2027,5,26}, {2027,5,27}, {2027,5,28}, {2027,5,29}, {2027,5,30}, {2027,5,31}, {2027,6,1}, {2027,6,2}, {2027,6,3}, {2027,6,4}, {2027,6,5}, {2027,6,6}, {2027,6,7}, {2027,6,8}, {2027,6,9}, {2027,6,10}, 
-{2027,6,11}, {2027,6,12}, {2027,6,13}, {2027,6,14}, {2027,6,15}, {2027,6,16}, {2027,6,17}, {2027,6,18}, {2027,6,19}, {2027,6,20}, {2027,6,21}, {2027,6,22}, {2027,6,23}, {2027,6,24}, {2027,6,25}, {2027,6,26}, {2027,6,27}, {2027,6,28}, {2027,6,29}, {2027,6,30}, {2027,7,1}, {2027,7,2}, {2027,7,3}, {2027,7,4}, {2027,7,5}, {2027,7,6}, {2027,7,7}, {2027,7,8}, {2027,7,9}, {2027,7,10}, {2027,7,11}, {2027,7,12}, 
-{2027,7,13}, {2027,7,14}, {2027,7,15}, {2027,7,16}, {2027,7,17}, {2027,7,18}, {2027,7,19}, {2027,7,20}, {2027,7,21}, {2027,7,22}, {2027,7,23}, {2027,7,24}, {2027,7,25}, {2027,7,26}, {2027,7,27}, {2027,7,28}, {2027,7,29}, {2027,7,30}, {2027,7,31}, {2027,8,1}, {2027,8,2}, {2027,8,3}, {2027,8,4}, {2027,8,5}, {2027,8,6}, {2027,8,7}, {2027,8,8}, {2027,8,9}, {2027,8,10}, {2027,8,11}, {2027,8,12}, {2027,8,13}, 
-{2027,8,14}, {2027,8,15}, {2027,8,16}, {2027,8,17}, {2027,8,18}, {2027,8,19}, {2027,8,20}, {2027,8,21}, {2027,8,22}, {2027,8,23}, {2027,8,24}, {2027,8,25}, {2027,8,26}, {2027,8,27}, {2027,8,28}, {2027,8,29}, {2027,8,30}, {2027,8,31}, {2027,9,1}, {2027,9,2}, {2027,9,3}, {2027,9,4}, {2027,9,5}, {2027,9,6}, {2027,9,7}, {2027,9,8}, {2027,9,9}, {2027,9,10}, {2027,9,11}, {2027,9,12}, {2027,9,13}, {2027,9,14}, 
-{2027,9,15}, {2027,9,16}, {2027,9,17}, {2027,9,18}, {2027,9,19}, {2027,9,20}, {2027,9,21}, {2027,9,22}, {2027,9,23}, {2027,9,24}, {2027,9,25}, {2027,9,26}, {2027,9,27}, {2027,9,28}, {2027,9,29}, {2027,9,30}, {2027,10,1}, {2027,10,2}, {2027,10,3}, {2027,10,4}, {2027,10,5}, {2027,10,6}, {2027,10,7}, {2027,10,8}, {2027,10,9}, {2027,10,10}, {2027,10,11}, {2027,10,12}, {2027,10,13}, {2027,10,14}, {2027,10,15}, {2027,10,16}, 
-{2027,10,17}, {2027,10,18}, {2027,10,19}, {2027,10,20}, {2027,10,21}, {2027,10,22}, {2027,10,23}, {2027,10,24}, {2027,10,25}, {2027,10,26}, {2027,10,27}, {2027,10,28}, {2027,10,29}, {2027,10,30}, {2027,10,31}, {2027,11,1}, {2027,11,2}, {2027,11,3}, {2027,11,4}, {2027,11,5}, {2027,11,6}, {2027,11,7}, {2027,11,8}, {2027,11,9}, {2027,11,10}, {2027,11,11}, {2027,11,12}, {2027,11,13}, {2027,11,14}, {2027,11,15}, {2027,11,16}, {2027,11,17}, 
-{2027,11,18}, {2027,11,19}, {2027,11,20}, {2027,11,21}, {2027,11,22}, {2027,11,23}, {2027,11,24}, {2027,11,25}, {2027,11,26}, {2027,11,27}, {2027,11,28}, {2027,11,29}, {2027,11,30}, {2027,12,1}, {2027,12,2}, {2027,12,3}, {2027,12,4}, {2027,12,5}, {2027,12,6}, {2027,12,7}, {2027,12,8}, {2027,12,9}, {2027,12,10}, {2027,12,11}, {2027,12,12}, {2027,12,13}, {2027,12,14}, {2027,12,15}, {2027,12,16}, {2027,12,17}, {2027,12,18}, {2027,12,19}, 
-{2027,12,20}, {2027,12,21}, {2027,12,22}, {2027,12,23}, {2027,12,24}, {2027,12,25}, {2027,12,26}, {2027,12,27}, {2027,12,28}, {2027,12,29}, {2027,12,30}, {2027,12,31}, {2028,1,1}, {2028,1,2}, {2028,1,3}, {2028,1,4}, {2028,1,5}, {2028,1,6}, {2028,1,7}, {2028,1,8}, {2028,1,9}, {2028,1,10}, {2028,1,11}, {2028,1,12}, {2028,1,13}, {2028,1,14}, {2028,1,15}, {2028,1,16}, {2028,1,17}, {2028,1,18}, {2028,1,19}, {2028,1,20}, 
-{2028,1,21}, {2028,1,22}, {2028,1,23}, {2028,1,24}, {2028,1,25}, {2028,1,26}, {2028,1,27}, {2028,1,28}, {2028,1,29}, {2028,1,30}, {2028,1,31}, {2028,2,1}, {2028,2,2}, {2028,2,3}, {2028,2,4}, {2028,2,5}, {2028,2,6}, {2028,2,7}, {2028,2,8}, {2028,2,9}, {2028,2,10}, {2028,2,11}, {2028,2,12}, {2028,2,13}, {2028,2,14}, {2028,2,15}, {2028,2,16}, {2028,2,17}, {2028,2,18}, {2028,2,19}, {2028,2,20}, {2028,2,21}, 
-{2028,2,22}, {2028,2,23}, {2028,2,24}, {2028,2,25}, {2028,2,26}, {2028,2,27}, {2028,2,28}, {2028,2,29}, {2028,3,1}, {2028,3,2}, {2028,3,3}, {2028,3,4}, {2028,3,5}, {2028,3,6}, {2028,3,7}, {2028,3,8}, {2028,3,9}, {2028,3,10}, {2028,3,11}, {2028,3,12}, {2028,3,13}, {2028,3,14}, {2028,3,15}, {2028,3,16}, {2028,3,17}, {2028,3,18}, {2028,3,19}, {2028,3,20}, {2028,3,21}, {2028,3,22}, {2028,3,23}, {2028,3,24}, 
-{2028,3,25}, {2028,3,26}, {2028,3,27}, {2028,3,28}, {2028,3,29}, {2028,3,30}, {2028,3,31}, {2028,4,1}, {2028,4,2}, {2028,4,3}, {2028,4,4}, {2028,4,5}, {2028,4,6}, {2028,4,7}, {2028,4,8}, {2028,4,9}, {2028,4,10}, {2028,4,11}, {2028,4,12}, {2028,4,13}, {2028,4,14}, {2028,4,15}, {2028,4,16}, {2028,4,17}, {2028,4,18}, {2028,4,19}, {2028,4,20}, {2028,4,21}, {2028,4,22}, {2028,4,23}, {2028,4,24}, {2028,4,25}, 
-{2028,4,26}, {2028,4,27}, {2028,4,28}, {2028,4,29}, {2028,4,30}, {2028,5,1}, {2028,5,2}, {2028,5,3}, {2028,5,4}, {2028,5,5}, {2028,5,6}, {2028,5,7}, {2028,5,8}, {2028,5,9}, {2028,5,10}, {2028,5,11}, {2028,5,12}, {2028,5,13}, {2028,5,14}, {2028,5,15}, {2028,5,16}, {2028,5,17}, {2028,5,18}, {2028,5,19}, {2028,5,20}, {2028,5,21}, {2028,5,22}, {2028,5,23}, {2028,5,24}, {2028,5,25}, {2028,5,26}, {2028,5,27}, 
-{2028,5,28}, {2028,5,29}, {2028,5,30}, {2028,5,31}, {2028,6,1}, {2028,6,2}, {2028,6,3}, {2028,6,4}, {2028,6,5}, {2028,6,6}, {2028,6,7}, {2028,6,8}, {2028,6,9}, {2028,6,10}, {2028,6,11}, {2028,6,12}, {2028,6,13}, {2028,6,14}, {2028,6,15}, {2028,6,16}, {2028,6,17}, {2028,6,18}, {2028,6,19}, {2028,6,20}, {2028,6,21}, {2028,6,22}, {2028,6,23}, {2028,6,24}, {2028,6,25}, {2028,6,26}, {2028,6,27}, {2028,6,28}, 
-{2028,6,29}, {2028,6,30}, {2028,7,1}, {2028,7,2}, {2028,7,3}, {2028,7,4}, {2028,7,5}, {2028,7,6}, {2028,7,7}, {2028,7,8}, {2028,7,9}, {2028,7,10}, {2028,7,11}, {2028,7,12}, {2028,7,13}, {2028,7,14}, {2028,7,15}, {2028,7,16}, {2028,7,17}, {2028,7,18}, {2028,7,19}, {2028,7,20}, {2028,7,21}, {2028,7,22}, {2028,7,23}, {2028,7,24}, {2028,7,25}, {2028,7,26}, {2028,7,27}, {2028,7,28}, {2028,7,29}, {2028,7,30}, 
-{2028,7,31}, {2028,8,1}, {2028,8,2}, {2028,8,3}, {2028,8,4}, {2028,8,5}, {2028,8,6}, {2028,8,7}, {2028,8,8}, {2028,8,9}, {2028,8,10}, {2028,8,11}, {2028,8,12}, {2028,8,13}, {2028,8,14}, {2028,8,15}, {2028,8,16}, {2028,8,17}, {2028,8,18}, {2028,8,19}, {2028,8,20}, {2028,8,21}, {2028,8,22}, {2028,8,23}, {2028,8,24}, {2028,8,25}, {2028,8,26}, {2028,8,27}, {2028,8,28}, {2028,8,29}, {2028,8,30}, {2028,8,31}, 
-{2028,9,1}, {2028,9,2}, {2028,9,3}, {2028,9,4}, {2028,9,5}, {2028,9,6}, {2028,9,7}, {2028,9,8}, {2028,9,9}, {2028,9,10}, {2028,9,11}, {2028,9,12}, {2028,9,13}, {2028,9,14}, {2028,9,15}, {2028,9,16}, {2028,9,17}, {2028,9,18}, {2028,9,19}, {2028,9,20}, {2028,9,21}, {2028,9,22}, {2028,9,23}, {2028,9,24}, {2028,9,25}, {2028,9,26}, {2028,9,27}, {2028,9,28}, {2028,9,29}, {2028,9,30}, {2028,10,1}, {2028,10,2}, 
-{2028,10,3}, {2028,10,4}, {2028,10,5}, {2028,10,6}, {2028,10,7}, {2028,10,8}, {2028,10,9}, {2028,10,10}, {2028,10,11}, {2028,10,12}, {2028,10,13}, {2028,10,14}, {2028,10,15}, {2028,10,16}, {2028,10,17}, {2028,10,18}, {2028,10,19}, {2028,10,20}, {2028,10,21}, {2028,10,22}, {2028,10,23}, {2028,10,24}, {2028,10,25}, {2028,10,26}, {2028,10,27}, {2028,10,28}, {2028,10,29}, {2028,10,30}, {2028,10,31}, {2028,11,1}, {2028,11,2}, {2028,11,3}, 
-{2028,11,4}, {2028,11,5}, {2028,11,6}, {2028,11,7}, {2028,11,8}, {2028,11,9}, {2028,11,10}, {2028,11,11}, {2028,11,12}, {2028,11,13}, {2028,11,14}, {2028,11,15}, {2028,11,16}, {2028,11,17}, {2028,11,18}, {2028,11,19}, {2028,11,20}, {2028,11,21}, {2028,11,22}, {2028,11,23}, {2028,11,24}, {2028,11,25}, {2028,11,26}, {2028,11,27}, {2028,11,28}, {2028,11,29}, {2028,11,30}, {2028,12,1}, {2028,12,2}, {2028,12,3}, {2028,12,4}, {2028,12,5}, 
-{2028,12,6}, {2028,12,7}, {2028,12,8}, {2028,12,9}, {2028,12,10}, {2028,12,11}, {2028,12,12}, {2028,12,13}, {2028,12,14}, {2028,12,15}, {2028,12,16}, {2028,12,17}, {2028,12,18}, {2028,12,19}, {2028,12,20}, {2028,12,21}, {2028,12,22}, {2028,12,23}, {2028,12,24}, {2028,12,25}, {2028,12,26}, {2028,12,27}, {2028,12,28}, {2028,12,29}, {2028,12,30}, {2028,12,31}, {2029,1,1}, {2029,1,2}, {2029,1,3}, {2029,1,4}, {2029,1,5}, {2029,1,6}, 
-{2029,1,7}, {2029,1,8}, {2029,1,9}, {2029,1,10}, {2029,1,11}, {2029,1,12}, {2029,1,13}, {2029,1,14}, {2029,1,15}, {2029,1,16}, {2029,1,17}, {2029,1,18}, {2029,1,19}, {2029,1,20}, {2029,1,21}, {2029,1,22}, {2029,1,23}, {2029,1,24}, {2029,1,25}, {2029,1,26}, {2029,1,27}, {2029,1,28}, {2029,1,29}, {2029,1,30}, {2029,1,31}, {2029,2,1}, {2029,2,2}, {2029,2,3}, {2029,2,4}, {2029,2,5}, {2029,2,6}, {2029,2,7}, 
-{2029,2,8}, {2029,2,9}, {2029,2,10}, {2029,2,11}, {2029,2,12}, {2029,2,13}, {2029,2,14}, {2029,2,15}, {2029,2,16}, {2029,2,17}, {2029,2,18}, {2029,2,19}, {2029,2,20}, {2029,2,21}, {2029,2,22}, {2029,2,23}, {2029,2,24}, {2029,2,25}, {2029,2,26}, {2029,2,27}, {2029,2,28}, {2029,3,1}, {2029,3,2}, {2029,3,3}, {2029,3,4}, {2029,3,5}, {2029,3,6}, {2029,3,7}, {2029,3,8}, {2029,3,9}, {2029,3,10}, {2029,3,11}, 
-{2029,3,12}, {2029,3,13}, {2029,3,14}, {2029,3,15}, {2029,3,16}, {2029,3,17}, {2029,3,18}, {2029,3,19}, {2029,3,20}, {2029,3,21}, {2029,3,22}, {2029,3,23}, {2029,3,24}, {2029,3,25}, {2029,3,26}, {2029,3,27}, {2029,3,28}, {2029,3,29}, {2029,3,30}, {2029,3,31}, {2029,4,1}, {2029,4,2}, {2029,4,3}, {2029,4,4}, {2029,4,5}, {2029,4,6}, {2029,4,7}, {2029,4,8}, {2029,4,9}, {2029,4,10}, {2029,4,11}, {2029,4,12}, 
-{2029,4,13}, {2029,4,14}, {2029,4,15}, {2029,4,16}, {2029,4,17}, {2029,4,18}, {2029,4,19}, {2029,4,20}, {2029,4,21}, {2029,4,22}, {2029,4,23}, {2029,4,24}, {2029,4,25}, {2029,4,26}, {2029,4,27}, {2029,4,28}, {2029,4,29}, {2029,4,30}, {2029,5,1}, {2029,5,2}, {2029,5,3}, {2029,5,4}, {2029,5,5}, {2029,5,6}, {2029,5,7}, {2029,5,8}, {2029,5,9}, {2029,5,10}, {2029,5,11}, {2029,5,12}, {2029,5,13}, {2029,5,14}, 
-{2029,5,15}, {2029,5,16}, {2029,5,17}, {2029,5,18}, {2029,5,19}, {2029,5,20}, {2029,5,21}, {2029,5,22}, {2029,5,23}, {2029,5,24}, {2029,5,25}, {2029,5,26}, {2029,5,27}, {2029,5,28}, {2029,5,29}, {2029,5,30}, {2029,5,31}, {2029,6,1}, {2029,6,2}, {2029,6,3}, {2029,6,4}, {2029,6,5}, {2029,6,6}, {2029,6,7}, {2029,6,8}, {2029,6,9}, {2029,6,10}, {2029,6,11}, {2029,6,12}, {2029,6,13}, {2029,6,14}, {2029,6,15}, 
-{2029,6,16}, {2029,6,17}, {2029,6,18}, {2029,6,19}, {2029,6,20}, {2029,6,21}, {2029,6,22}, {2029,6,23}, {2029,6,24}, {2029,6,25}, {2029,6,26}, {2029,6,27}, {2029,6,28}, {2029,6,29}, {2029,6,30}, {2029,7,1}, {2029,7,2}, {2029,7,3}, {2029,7,4}, {2029,7,5}, {2029,7,6}, {2029,7,7}, {2029,7,8}, {2029,7,9}, {2029,7,10}, {2029,7,11}, {2029,7,12}, {2029,7,13}, {2029,7,14}, {2029,7,15}, {2029,7,16}, {2029,7,17}, 
-{2029,7,18}, {2029,7,19}, {2029,7,20}, {2029,7,21}, {2029,7,22}, {2029,7,23}, {2029,7,24}, {2029,7,25}, {2029,7,26}, {2029,7,27}, {2029,7,28}, {2029,7,29}, {2029,7,30}, {2029,7,31}, {2029,8,1}, {2029,8,2}, {2029,8,3}, {2029,8,4}, {2029,8,5}, {2029,8,6}, {2029,8,7}, {2029,8,8}, {2029,8,9}, {2029,8,10}, {2029,8,11}, {2029,8,12}, {2029,8,13}, {2029,8,14}, {2029,8,15}, {2029,8,16}, {2029,8,17}, {2029,8,18}, 
-{2029,8,19}, {2029,8,20}, {2029,8,21}, {2029,8,22}, {2029,8,23}, {2029,8,24}, {2029,8,25}, {2029,8,26}, {2029,8,27}, {2029,8,28}, {2029,8,29}, {2029,8,30}, {2029,8,31}, {2029,9,1}, {2029,9,2}, {2029,9,3}, {2029,9,4}, {2029,9,5}, {2029,9,6}, {2029,9,7}, {2029,9,8}, {2029,9,9}, {2029,9,10}, {2029,9,11}, {2029,9,12}, {2029,9,13}, {2029,9,14}, {2029,9,15}, {2029,9,16}, {2029,9,17}, {2029,9,18}, {2029,9,19}, 
-{2029,9,20}, {2029,9,21}, {2029,9,22}, {2029,9,23}, {2029,9,24}, {2029,9,25}, {2029,9,26}, {2029,9,27}, {2029,9,28}, {2029,9,29}, {2029,9,30}, {2029,10,1}, {2029,10,2}, {2029,10,3}, {2029,10,4}, {2029,10,5}, {2029,10,6}, {2029,10,7}, {2029,10,8}, {2029,10,9}, {2029,10,10}, {2029,10,11}, {2029,10,12}, {2029,10,13}, {2029,10,14}, {2029,10,15}, {2029,10,16}, {2029,10,17}, {2029,10,18}, {2029,10,19}, {2029,10,20}, {2029,10,21}, 
-{2029,10,22}, {2029,10,23}, {2029,10,24}, {2029,10,25}, {2029,10,26}, {2029,10,27}, {2029,10,28}, {2029,10,29}, {2029,10,30}, {2029,10,31}, {2029,11,1}, {2029,11,2}, {2029,11,3}, {2029,11,4}, {2029,11,5}, {2029,11,6}, {2029,11,7}, {2029,11,8}, {2029,11,9}, {2029,11,10}, {2029,11,11}, {2029,11,12}, {2029,11,13}, {2029,11,14}, {2029,11,15}, {2029,11,16}, {2029,11,17}, {2029,11,18}, {2029,11,19}, {2029,11,20}, {2029,11,21}, {2029,11,22}, 
-{2029,11,23}, {2029,11,24}, {2029,11,25}, {2029,11,26}, {2029,11,27}, {2029,11,28}, {2029,11,29}, {2029,11,30}, {2029,12,1}, {2029,12,2}, {2029,12,3}, {2029,12,4}, {2029,12,5}, {2029,12,6}, {2029,12,7}, {2029,12,8}, {2029,12,9}, {2029,12,10}, {2029,12,11}, {2029,12,12}, {2029,12,13}, {2029,12,14}, {2029,12,15}, {2029,12,16}, {2029,12,17}, {2029,12,18}, {2029,12,19}, {2029,12,20}, {2029,12,21}, {2029,12,22}, {2029,12,23}, {2029,12,24}, 
-{2029,12,25}, {2029,12,26}, {2029,12,27}, {2029,12,28}, {2029,12,29}, {2029,12,30}, {2029,12,31}, {2030,1,1}, {2030,1,2}, {2030,1,3}, {2030,1,4}, {2030,1,5}, {2030,1,6}, {2030,1,7}, {2030,1,8}, {2030,1,9}, {2030,1,10}, {2030,1,11}, {2030,1,12}, {2030,1,13}, {2030,1,14}, {2030,1,15}, {2030,1,16}, {2030,1,17}, {2030,1,18}, {2030,1,19}, {2030,1,20}, {2030,1,21}, {2030,1,22}, {2030,1,23}, {2030,1,24}, {2030,1,25}, 
-{2030,1,26}, {2030,1,27}, {2030,1,28}, {2030,1,29}, {2030,1,30}, {2030,1,31}, {2030,2,1}, {2030,2,2}, {2030,2,3}, {2030,2,4}, {2030,2,5}, {2030,2,6}, {2030,2,7}, {2030,2,8}, {2030,2,9}, {2030,2,10}, {2030,2,11}, {2030,2,12}, {2030,2,13}, {2030,2,14}, {2030,2,15}, {2030,2,16}, {2030,2,17}, {2030,2,18}, {2030,2,19}, {2030,2,20}, {2030,2,21}, {2030,2,22}, {2030,2,23}, {2030,2,24}, {2030,2,25}, {2030,2,26}, 
-{2030,2,27}, {2030,2,28}, {2030,3,1}, {2030,3,2}, {2030,3,3}, {2030,3,4}, {2030,3,5}, {2030,3,6}, {2030,3,7}, {2030,3,8}, {2030,3,9}, {2030,3,10}, {2030,3,11}, {2030,3,12}, {2030,3,13}, {2030,3,14}, {2030,3,15}, {2030,3,16}, {2030,3,17}, {2030,3,18}, {2030,3,19}, {2030,3,20}, {2030,3,21}, {2030,3,22}, {2030,3,23}, {2030,3,24}, {2030,3,25}, {2030,3,26}, {2030,3,27}, {2030,3,28}, {2030,3,29}, {2030,3,30}, 
-{2030,3,31}, {2030,4,1}, {2030,4,2}, {2030,4,3}, {2030,4,4}, {2030,4,5}, {2030,4,6}, {2030,4,7}, {2030,4,8}, {2030,4,9}, {2030,4,10}, {2030,4,11}, {2030,4,12}, {2030,4,13}, {2030,4,14}, {2030,4,15}, {2030,4,16}, {2030,4,17}, {2030,4,18}, {2030,4,19}, {2030,4,20}, {2030,4,21}, {2030,4,22}, {2030,4,23}, {2030,4,24}, {2030,4,25}, {2030,4,26}, {2030,4,27}, {2030,4,28}, {2030,4,29}, {2030,4,30}, {2030,5,1}, 
-{2030,5,2}, {2030,5,3}, {2030,5,4}, {2030,5,5}, {2030,5,6}, {2030,5,7}, {2030,5,8}, {2030,5,9}, {2030,5,10}, {2030,5,11}, {2030,5,12}, {2030,5,13}, {2030,5,14}, {2030,5,15}, {2030,5,16}, {2030,5,17}, {2030,5,18}, {2030,5,19}, {2030,5,20}, {2030,5,21}, {2030,5,22}, {2030,5,23}, {2030,5,24}, {2030,5,25}, {2030,5,26}, {2030,5,27}, {2030,5,28}, {2030,5,29}, {2030,5,30}, {2030,5,31}, {2030,6,1}, {2030,6,2}, 
-{2030,6,3}, {2030,6,4}, {2030,6,5}, {2030,6,6}, {2030,6,7}, {2030,6,8}, {2030,6,9}, {2030,6,10}, {2030,6,11}, {2030,6,12}, {2030,6,13}, {2030,6,14}, {2030,6,15}, {2030,6,16}, {2030,6,17}, {2030,6,18}, {2030,6,19}, {2030,6,20}, {2030,6,21}, {2030,6,22}, {2030,6,23}, {2030,6,24}, {2030,6,25}, {2030,6,26}, {2030,6,27}, {2030,6,28}, {2030,6,29}, {2030,6,30}, {2030,7,1}, {2030,7,2}, {2030,7,3}, {2030,7,4}, 
-{2030,7,5}, {2030,7,6}, {2030,7,7}, {2030,7,8}, {2030,7,9}, {2030,7,10}, {2030,7,11}, {2030,7,12}, {2030,7,13}, {2030,7,14}, {2030,7,15}, {2030,7,16}, {2030,7,17}, {2030,7,18}, {2030,7,19}, {2030,7,20}, {2030,7,21}, {2030,7,22}, {2030,7,23}, {2030,7,24}, {2030,7,25}, {2030,7,26}, {2030,7,27}, {2030,7,28}, {2030,7,29}, {2030,7,30}, {2030,7,31}, {2030,8,1}, {2030,8,2}, {2030,8,3}, {2030,8,4}, {2030,8,5}, 
-{2030,8,6}, {2030,8,7}, {2030,8,8}, {2030,8,9}, {2030,8,10}, {2030,8,11}, {2030,8,12}, {2030,8,13}, {2030,8,14}, {2030,8,15}, {2030,8,16}, {2030,8,17}, {2030,8,18}, {2030,8,19}, {2030,8,20}, {2030,8,21}, {2030,8,22}, {2030,8,23}, {2030,8,24}, {2030,8,25}, {2030,8,26}, {2030,8,27}, {2030,8,28}, {2030,8,29}, {2030,8,30}, {2030,8,31}, {2030,9,1}, {2030,9,2}, {2030,9,3}, {2030,9,4}, {2030,9,5}, {2030,9,6}, 
-{2030,9,7}, {2030,9,8}, {2030,9,9}, {2030,9,10}, {2030,9,11}, {2030,9,12}, {2030,9,13}, {2030,9,14}, {2030,9,15}, {2030,9,16}, {2030,9,17}, {2030,9,18}, {2030,9,19}, {2030,9,20}, {2030,9,21}, {2030,9,22}, {2030,9,23}, {2030,9,24}, {2030,9,25}, {2030,9,26}, {2030,9,27}, {2030,9,28}, {2030,9,29}, {2030,9,30}, {2030,10,1}, {2030,10,2}, {2030,10,3}, {2030,10,4}, {2030,10,5}, {2030,10,6}, {2030,10,7}, {2030,10,8}, 
-{2030,10,9}, {2030,10,10}, {2030,10,11}, {2030,10,12}, {2030,10,13}, {2030,10,14}, {2030,10,15}, {2030,10,16}, {2030,10,17}, {2030,10,18}, {2030,10,19}, {2030,10,20}, {2030,10,21}, {2030,10,22}, {2030,10,23}, {2030,10,24}, {2030,10,25}, {2030,10,26}, {2030,10,27}, {2030,10,28}, {2030,10,29}, {2030,10,30}, {2030,10,31}, {2030,11,1}, {2030,11,2}, {2030,11,3}, {2030,11,4}, {2030,11,5}, {2030,11,6}, {2030,11,7}, {2030,11,8}, {2030,11,9}, 
-{2030,11,10}, {2030,11,11}, {2030,11,12}, {2030,11,13}, {2030,11,14}, {2030,11,15}, {2030,11,16}, {2030,11,17}, {2030,11,18}, {2030,11,19}, {2030,11,20}, {2030,11,21}, {2030,11,22}, {2030,11,23}, {2030,11,24}, {2030,11,25}, {2030,11,26}, {2030,11,27}, {2030,11,28}, {2030,11,29}, {2030,11,30}, {2030,12,1}, {2030,12,2}, {2030,12,3}, {2030,12,4}, {2030,12,5}, {2030,12,6}, {2030,12,7}, {2030,12,8}, {2030,12,9}, {2030,12,10}, {2030,12,11}, 
-{2030,12,12}, {2030,12,13}, {2030,12,14}, {2030,12,15}, {2030,12,16}, {2030,12,17}, {2030,12,18}, {2030,12,19}, {2030,12,20}, {2030,12,21}, {2030,12,22}, {2030,12,23}, {2030,12,24}, {2030,12,25}, {2030,12,26}, {2030,12,27}, {2030,12,28}, {2030,12,29}, {2030,12,30}, {2030,12,31}, {2031,1,1}, {2031,1,2}, {2031,1,3}, {2031,1,4}, {2031,1,5}, {2031,1,6}, {2031,1,7}, {2031,1,8}, {2031,1,9}, {2031,1,10}, {2031,1,11}, {2031,1,12}, 
-{2031,1,13}, {2031,1,14}, {2031,1,15}, {2031,1,16}, {2031,1,17}, {2031,1,18}, {2031,1,19}, {2031,1,20}, {2031,1,21}, {2031,1,22}, {2031,1,23}, {2031,1,24}, {2031,1,25}, {2031,1,26}, {2031,1,27}, {2031,1,28}, {2031,1,29}, {2031,1,30}, {2031,1,31}, {2031,2,1}, {2031,2,2}, {2031,2,3}, {2031,2,4}, {2031,2,5}, {2031,2,6}, {2031,2,7}, {2031,2,8}, {2031,2,9}, {2031,2,10}, {2031,2,11}, {2031,2,12}, {2031,2,13}, 
-{2031,2,14}, {2031,2,15}, {2031,2,16}, {2031,2,17}, {2031,2,18}, {2031,2,19}, {2031,2,20}, {2031,2,21}, {2031,2,22}, {2031,2,23}, {2031,2,24}, {2031,2,25}, {2031,2,26}, {2031,2,27}, {2031,2,28}, {2031,3,1}, {2031,3,2}, {2031,3,3}, {2031,3,4}, {2031,3,5}, {2031,3,6}, {2031,3,7}, {2031,3,8}, {2031,3,9}, {2031,3,10}, {2031,3,11}, {2031,3,12}, {2031,3,13}, {2031,3,14}, {2031,3,15}, {2031,3,16}, {2031,3,17}, 
-{2031,3,18}, {2031,3,19}, {2031,3,20}, {2031,3,21}, {2031,3,22}, {2031,3,23}, {2031,3,24}, {2031,3,25}, {2031,3,26}, {2031,3,27}, {2031,3,28}, {2031,3,29}, {2031,3,30}, {2031,3,31}, {2031,4,1}, {2031,4,2}, {2031,4,3}, {2031,4,4}, {2031,4,5}, {2031,4,6}, {2031,4,7}, {2031,4,8}, {2031,4,9}, {2031,4,10}, {2031,4,11}, {2031,4,12}, {2031,4,13}, {2031,4,14}, {2031,4,15}, {2031,4,16}, {2031,4,17}, {2031,4,18}, 
-{2031,4,19}, {2031,4,20}, {2031,4,21}, {2031,4,22}, {2031,4,23}, {2031,4,24}, {2031,4,25}, {2031,4,26}, {2031,4,27}, {2031,4,28}, {2031,4,29}, {2031,4,30}, {2031,5,1}, {2031,5,2}, {2031,5,3}, {2031,5,4}, {2031,5,5}, {2031,5,6}, {2031,5,7}, {2031,5,8}, {2031,5,9}, {2031,5,10}, {2031,5,11}, {2031,5,12}, {2031,5,13}, {2031,5,14}, {2031,5,15}, {2031,5,16}, {2031,5,17}, {2031,5,18}, {2031,5,19}, {2031,5,20}, 
-{2031,5,21}, {2031,5,22}, {2031,5,23}, {2031,5,24}, {2031,5,25}, {2031,5,26}, {2031,5,27}, {2031,5,28}, {2031,5,29}, {2031,5,30}, {2031,5,31}, {2031,6,1}, {2031,6,2}, {2031,6,3}, {2031,6,4}, {2031,6,5}, {2031,6,6}, {2031,6,7}, {2031,6,8}, {2031,6,9}, {2031,6,10}, {2031,6,11}, {2031,6,12}, {2031,6,13}, {2031,6,14}, {2031,6,15}, {2031,6,16}, {2031,6,17}, {2031,6,18}, {2031,6,19}, {2031,6,20}, {2031,6,21}, 
-{2031,6,22}, {2031,6,23}, {2031,6,24}, {2031,6,25}, {2031,6,26}, {2031,6,27}, {2031,6,28}, {2031,6,29}, {2031,6,30}, {2031,7,1}, {2031,7,2}, {2031,7,3}, {2031,7,4}, {2031,7,5}, {2031,7,6}, {2031,7,7}, {2031,7,8}, {2031,7,9}, {2031,7,10}, {2031,7,11}, {2031,7,12}, {2031,7,13}, {2031,7,14}, {2031,7,15}, {2031,7,16}, {2031,7,17}, {2031,7,18}, {2031,7,19}, {2031,7,20}, {2031,7,21}, {2031,7,22}, {2031,7,23}, 
-{2031,7,24}, {2031,7,25}, {2031,7,26}, {2031,7,27}, {2031,7,28}, {2031,7,29}, {2031,7,30}, {2031,7,31}, {2031,8,1}, {2031,8,2}, {2031,8,3}, {2031,8,4}, {2031,8,5}, {2031,8,6}, {2031,8,7}, {2031,8,8}, {2031,8,9}, {2031,8,10}, {2031,8,11}, {2031,8,12}, {2031,8,13}, {2031,8,14}, {2031,8,15}, {2031,8,16}, {2031,8,17}, {2031,8,18}, {2031,8,19}, {2031,8,20}, {2031,8,21}, {2031,8,22}, {2031,8,23}, {2031,8,24}, 
-{2031,8,25}, {2031,8,26}, {2031,8,27}, {2031,8,28}, {2031,8,29}, {2031,8,30}, {2031,8,31}, {2031,9,1}, {2031,9,2}, {2031,9,3}, {2031,9,4}, {2031,9,5}, {2031,9,6}, {2031,9,7}, {2031,9,8}, {2031,9,9}, {2031,9,10}, {2031,9,11}, {2031,9,12}, {2031,9,13}, {2031,9,14}, {2031,9,15}, {2031,9,16}, {2031,9,17}, {2031,9,18}, {2031,9,19}, {2031,9,20}, {2031,9,21}, {2031,9,22}, {2031,9,23}, {2031,9,24}, {2031,9,25}, 
-{2031,9,26}, {2031,9,27}, {2031,9,28}, {2031,9,29}, {2031,9,30}, {2031,10,1}, {2031,10,2}, {2031,10,3}, {2031,10,4}, {2031,10,5}, {2031,10,6}, {2031,10,7}, {2031,10,8}, {2031,10,9}, {2031,10,10}, {2031,10,11}, {2031,10,12}, {2031,10,13}, {2031,10,14}, {2031,10,15}, {2031,10,16}, {2031,10,17}, {2031,10,18}, {2031,10,19}, {2031,10,20}, {2031,10,21}, {2031,10,22}, {2031,10,23}, {2031,10,24}, {2031,10,25}, {2031,10,26}, {2031,10,27}, 
-{2031,10,28}, {2031,10,29}, {2031,10,30}, {2031,10,31}, {2031,11,1}, {2031,11,2}, {2031,11,3}, {2031,11,4}, {2031,11,5}, {2031,11,6}, {2031,11,7}, {2031,11,8}, {2031,11,9}, {2031,11,10}, {2031,11,11}, {2031,11,12}, {2031,11,13}, {2031,11,14}, {2031,11,15}, {2031,11,16}, {2031,11,17}, {2031,11,18}, {2031,11,19}, {2031,11,20}, {2031,11,21}, {2031,11,22}, {2031,11,23}, {2031,11,24}, {2031,11,25}, {2031,11,26}, {2031,11,27}, {2031,11,28}, 
-{2031,11,29}, {2031,11,30}, {2031,12,1}, {2031,12,2}, {2031,12,3}, {2031,12,4}, {2031,12,5}, {2031,12,6}, {2031,12,7}, {2031,12,8}, {2031,12,9}, {2031,12,10}, {2031,12,11}, {2031,12,12}, {2031,12,13}, {2031,12,14}, {2031,12,15}, {2031,12,16}, {2031,12,17}, {2031,12,18}, {2031,12,19}, {2031,12,20}, {2031,12,21}, {2031,12,22}, {2031,12,23}, {2031,12,24}, {2031,12,25}, {2031,12,26}, {2031,12,27}, {2031,12,28}, {2031,12,29}, {2031,12,30}, 
-{2031,12,31}, {2032,1,1}, {2032,1,2}, {2032,1,3}, {2032,1,4}, {2032,1,5}, {2032,1,6}, {2032,1,7}, {2032,1,8}, {2032,1,9}, {2032,1,10}, {2032,1,11}, {2032,1,12}, {2032,1,13}, {2032,1,14}, {2032,1,15}, {2032,1,16}, {2032,1,17}, {2032,1,18}, {2032,1,19}, {2032,1,20}, {2032,1,21}, {2032,1,22}, {2032,1,23}, {2032,1,24}, {2032,1,25}, {2032,1,26}, {2032,1,27}, {2032,1,28}, {2032,1,29}, {2032,1,30}, {2032,1,31}, 
-{2032,2,1}, {2032,2,2}, {2032,2,3}, {2032,2,4}, {2032,2,5}, {2032,2,6}, {2032,2,7}, {2032,2,8}, {2032,2,9}, {2032,2,10}, {2032,2,11}, {2032,2,12}, {2032,2,13}, {2032,2,14}, {2032,2,15}, {2032,2,16}, {2032,2,17}, {2032,2,18}, {2032,2,19}, {2032,2,20}, {2032,2,21}, {2032,2,22}, {2032,2,23}, {2032,2,24}, {2032,2,25}, {2032,2,26}, {2032,2,27}, {2032,2,28}, {2032,2,29}, {2032,3,1}, {2032,3,2}, {2032,3,3}, 
-{2032,3,4}, {2032,3,5}, {2032,3,6}, {2032,3,7}, {2032,3,8}, {2032,3,9}, {2032,3,10}, {2032,3,11}, {2032,3,12}, {2032,3,13}, {2032,3,14}, {2032,3,15}, {2032,3,16}, {2032,3,17}, {2032,3,18}, {2032,3,19}, {2032,3,20}, {2032,3,21}, {2032,3,22}, {2032,3,23}, {2032,3,24}, {2032,3,25}, {2032,3,26}, {2032,3,27}, {2032,3,28}, {2032,3,29}, {2032,3,30}, {2032,3,31}, {2032,4,1}, {2032,4,2}, {2032,4,3}, {2032,4,4}, 
-{2032,4,5}, {2032,4,6}, {2032,4,7}, {2032,4,8}, {2032,4,9}, {2032,4,10}, {2032,4,11}, {2032,4,12}, {2032,4,13}, {2032,4,14}, {2032,4,15}, {2032,4,16}, {2032,4,17}, {2032,4,18}, {2032,4,19}, {2032,4,20}, {2032,4,21}, {2032,4,22}, {2032,4,23}, {2032,4,24}, {2032,4,25}, {2032,4,26}, {2032,4,27}, {2032,4,28}, {2032,4,29}, {2032,4,30}, {2032,5,1}, {2032,5,2}, {2032,5,3}, {2032,5,4}, {2032,5,5}, {2032,5,6}, 
-{2032,5,7}, {2032,5,8}, {2032,5,9}, {2032,5,10}, {2032,5,11}, {2032,5,12}, {2032,5,13}, {2032,5,14}, {2032,5,15}, {2032,5,16}, {2032,5,17}, {2032,5,18}, {2032,5,19}, {2032,5,20}, {2032,5,21}, {2032,5,22}, {2032,5,23}, {2032,5,24}, {2032,5,25}, {2032,5,26}, {2032,5,27}, {2032,5,28}, {2032,5,29}, {2032,5,30}, {2032,5,31}, {2032,6,1}, {2032,6,2}, {2032,6,3}, {2032,6,4}, {2032,6,5}, {2032,6,6}, {2032,6,7}, 
-{2032,6,8}, {2032,6,9}, {2032,6,10}, {2032,6,11}, {2032,6,12}, {2032,6,13}, {2032,6,14}, {2032,6,15}, {2032,6,16}, {2032,6,17}, {2032,6,18}, {2032,6,19}, {2032,6,20}, {2032,6,21}, {2032,6,22}, {2032,6,23}, {2032,6,24}, {2032,6,25}, {2032,6,26}, {2032,6,27}, {2032,6,28}, {2032,6,29}, {2032,6,30}, {2032,7,1}, {2032,7,2}, {2032,7,3}, {2032,7,4}, {2032,7,5}, {2032,7,6}, {2032,7,7}, {2032,7,8}, {2032,7,9}, 
-{2032,7,10}, {2032,7,11}, {2032,7,12}, {2032,7,13}, {2032,7,14}, {2032,7,15}, {2032,7,16}, {2032,7,17}, {2032,7,18}, {2032,7,19}, {2032,7,20}, {2032,7,21}, {2032,7,22}, {2032,7,23}, {2032,7,24}, {2032,7,25}, {2032,7,26}, {2032,7,27}, {2032,7,28}, {2032,7,29}, {2032,7,30}, {2032,7,31}, {2032,8,1}, {2032,8,2}, {2032,8,3}, {2032,8,4}, {2032,8,5}, {2032,8,6}, {2032,8,7}, {2032,8,8}, {2032,8,9}, {2032,8,10}, 
-{2032,8,11}, {2032,8,12}, {2032,8,13}, {2032,8,14}, {2032,8,15}, {2032,8,16}, {2032,8,17}, {2032,8,18}, {2032,8,19}, {2032,8,20}, {2032,8,21}, {2032,8,22}, {2032,8,23}, {2032,8,24}, {2032,8,25}, {2032,8,26}, {2032,8,27}, {2032,8,28}, {2032,8,29}, {2032,8,30}, {2032,8,31}, {2032,9,1}, {2032,9,2}, {2032,9,3}, {2032,9,4}, {2032,9,5}, {2032,9,6}, {2032,9,7}, {2032,9,8}, {2032,9,9}, {2032,9,10}, {2032,9,11}, 
-{2032,9,12}, {2032,9,13}, {2032,9,14}, {2032,9,15}, {2032,9,16}, {2032,9,17}, {2032,9,18}, {2032,9,19}, {2032,9,20}, {2032,9,21}, {2032,9,22}, {2032,9,23}, {2032,9,24}, {2032,9,25}, {2032,9,26}, {2032,9,27}, {2032,9,28}, {2032,9,29}, {2032,9,30}, {2032,10,1}, {2032,10,2}, {2032,10,3}, {2032,10,4}, {2032,10,5}, {2032,10,6}, {2032,10,7}, {2032,10,8}, {2032,10,9}, {2032,10,10}, {2032,10,11}, {2032,10,12}, {2032,10,13}, 
-{2032,10,14}, {2032,10,15}, {2032,10,16}, {2032,10,17}, {2032,10,18}, {2032,10,19}, {2032,10,20}, {2032,10,21}, {2032,10,22}, {2032,10,23}, {2032,10,24}, {2032,10,25}, {2032,10,26}, {2032,10,27}, {2032,10,28}, {2032,10,29}, {2032,10,30}, {2032,10,31}, {2032,11,1}, {2032,11,2}, {2032,11,3}, {2032,11,4}, {2032,11,5}, {2032,11,6}, {2032,11,7}, {2032,11,8}, {2032,11,9}, {2032,11,10}, {2032,11,11}, {2032,11,12}, {2032,11,13}, {2032,11,14}, 
-{2032,11,15}, {2032,11,16}, {2032,11,17}, {2032,11,18}, {2032,11,19}, {2032,11,20}, {2032,11,21}, {2032,11,22}, {2032,11,23}, {2032,11,24}, {2032,11,25}, {2032,11,26}, {2032,11,27}, {2032,11,28}, {2032,11,29}, {2032,11,30}, {2032,12,1}, {2032,12,2}, {2032,12,3}, {2032,12,4}, {2032,12,5}, {2032,12,6}, {2032,12,7}, {2032,12,8}, {2032,12,9}, {2032,12,10}, {2032,12,11}, {2032,12,12}, {2032,12,13}, {2032,12,14}, {2032,12,15}, {2032,12,16}, 
-{2032,12,17}, {2032,12,18}, {2032,12,19}, {2032,12,20}, {2032,12,21}, {2032,12,22}, {2032,12,23}, {2032,12,24}, {2032,12,25}, {2032,12,26}, {2032,12,27}, {2032,12,28}, {2032,12,29}, {2032,12,30}, {2032,12,31}, {2033,1,1}, {2033,1,2}, {2033,1,3}, {2033,1,4}, {2033,1,5}, {2033,1,6}, {2033,1,7}, {2033,1,8}, {2033,1,9}, {2033,1,10}, {2033,1,11}, {2033,1,12}, {2033,1,13}, {2033,1,14}, {2033,1,15}, {2033,1,16}, {2033,1,17}, 
-{2033,1,18}, {2033,1,19}, {2033,1,20}, {2033,1,21}, {2033,1,22}, {2033,1,23}, {2033,1,24}, {2033,1,25}, {2033,1,26}, {2033,1,27}, {2033,1,28}, {2033,1,29}, {2033,1,30}, {2033,1,31}, {2033,2,1}, {2033,2,2}, {2033,2,3}, {2033,2,4}, {2033,2,5}, {2033,2,6}, {2033,2,7}, {2033,2,8}, {2033,2,9}, {2033,2,10}, {2033,2,11}, {2033,2,12}, {2033,2,13}, {2033,2,14}, {2033,2,15}, {2033,2,16}, {2033,2,17}, {2033,2,18}, 
-{2033,2,19}, {2033,2,20}, {2033,2,21}, {2033,2,22}, {2033,2,23}, {2033,2,24}, {2033,2,25}, {2033,2,26}, {2033,2,27}, {2033,2,28}, {2033,3,1}, {2033,3,2}, {2033,3,3}, {2033,3,4}, {2033,3,5}, {2033,3,6}, {2033,3,7}, {2033,3,8}, {2033,3,9}, {2033,3,10}, {2033,3,11}, {2033,3,12}, {2033,3,13}, {2033,3,14}, {2033,3,15}, {2033,3,16}, {2033,3,17}, {2033,3,18}, {2033,3,19}, {2033,3,20}, {2033,3,21}, {2033,3,22}, 
-{2033,3,23}, {2033,3,24}, {2033,3,25}, {2033,3,26}, {2033,3,27}, {2033,3,28}, {2033,3,29}, {2033,3,30}, {2033,3,31}, {2033,4,1}, {2033,4,2}, {2033,4,3}, {2033,4,4}, {2033,4,5}, {2033,4,6}, {2033,4,7}, {2033,4,8}, {2033,4,9}, {2033,4,10}, {2033,4,11}, {2033,4,12}, {2033,4,13}, {2033,4,14}, {2033,4,15}, {2033,4,16}, {2033,4,17}, {2033,4,18}, {2033,4,19}, {2033,4,20}, {2033,4,21}, {2033,4,22}, {2033,4,23}, 
-{2033,4,24}, {2033,4,25}, {2033,4,26}, {2033,4,27}, {2033,4,28}, {2033,4,29}, {2033,4,30}, {2033,5,1}, {2033,5,2}, {2033,5,3}, {2033,5,4}, {2033,5,5}, {2033,5,6}, {2033,5,7}, {2033,5,8}, {2033,5,9}, {2033,5,10}, {2033,5,11}, {2033,5,12}, {2033,5,13}, {2033,5,14}, {2033,5,15}, {2033,5,16}, {2033,5,17}, {2033,5,18}, {2033,5,19}, {2033,5,20}, {2033,5,21}, {2033,5,22}, {2033,5,23}, {2033,5,24}, {2033,5,25}, 
-{2033,5,26}, {2033,5,27}, {2033,5,28}, {2033,5,29}, {2033,5,30}, {2033,5,31}, {2033,6,1}, {2033,6,2}, {2033,6,3}, {2033,6,4}, {2033,6,5}, {2033,6,6}, {2033,6,7}, {2033,6,8}, {2033,6,9}, {2033,6,10}, {2033,6,11}, {2033,6,12}, {2033,6,13}, {2033,6,14}, {2033,6,15}, {2033,6,16}, {2033,6,17}, {2033,6,18}, {2033,6,19}, {2033,6,20}, {2033,6,21}, {2033,6,22}, {2033,6,23}, {2033,6,24}, {2033,6,25}, {2033,6,26}, 
-{2033,6,27}, {2033,6,28}, {2033,6,29}, {2033,6,30}, {2033,7,1}, {2033,7,2}, {2033,7,3}, {2033,7,4}, {2033,7,5}, {2033,7,6}, {2033,7,7}, {2033,7,8}, {2033,7,9}, {2033,7,10}, {2033,7,11}, {2033,7,12}, {2033,7,13}, {2033,7,14}, {2033,7,15}, {2033,7,16}, {2033,7,17}, {2033,7,18}, {2033,7,19}, {2033,7,20}, {2033,7,21}, {2033,7,22}, {2033,7,23}, {2033,7,24}, {2033,7,25}, {2033,7,26}, {2033,7,27}, {2033,7,28}, 
-{2033,7,29}, {2033,7,30}, {2033,7,31}, {2033,8,1}, {2033,8,2}, {2033,8,3}, {2033,8,4}, {2033,8,5}, {2033,8,6}, {2033,8,7}, {2033,8,8}, {2033,8,9}, {2033,8,10}, {2033,8,11}, {2033,8,12}, {2033,8,13}, {2033,8,14}, {2033,8,15}, {2033,8,16}, {2033,8,17}, {2033,8,18}, {2033,8,19}, {2033,8,20}, {2033,8,21}, {2033,8,22}, {2033,8,23}, {2033,8,24}, {2033,8,25}, {2033,8,26}, {2033,8,27}, {2033,8,28}, {2033,8,29}, 
-{2033,8,30}, {2033,8,31}, {2033,9,1}, {2033,9,2}, {2033,9,3}, {2033,9,4}, {2033,9,5}, {2033,9,6}, {2033,9,7}, {2033,9,8}, {2033,9,9}, {2033,9,10}, {2033,9,11}, {2033,9,12}, {2033,9,13}, {2033,9,14}, {2033,9,15}, {2033,9,16}, {2033,9,17}, {2033,9,18}, {2033,9,19}, {2033,9,20}, {2033,9,21}, {2033,9,22}, {2033,9,23}, {2033,9,24}, {2033,9,25}, {2033,9,26}, {2033,9,27}, {2033,9,28}, {2033,9,29}, {2033,9,30}, 
-{2033,10,1}, {2033,10,2}, {2033,10,3}, {2033,10,4}, {2033,10,5}, {2033,10,6}, {2033,10,7}, {2033,10,8}, {2033,10,9}, {2033,10,10}, {2033,10,11}, {2033,10,12}, {2033,10,13}, {2033,10,14}, {2033,10,15}, {2033,10,16}, {2033,10,17}, {2033,10,18}, {2033,10,19}, {2033,10,20}, {2033,10,21}, {2033,10,22}, {2033,10,23}, {2033,10,24}, {2033,10,25}, {2033,10,26}, {2033,10,27}, {2033,10,28}, {2033,10,29}, {2033,10,30}, {2033,10,31}, {2033,11,1}, 
-{2033,11,2}, {2033,11,3}, {2033,11,4}, {2033,11,5}, {2033,11,6}, {2033,11,7}, {2033,11,8}, {2033,11,9}, {2033,11,10}, {2033,11,11}, {2033,11,12}, {2033,11,13}, {2033,11,14}, {2033,11,15}, {2033,11,16}, {2033,11,17}, {2033,11,18}, {2033,11,19}, {2033,11,20}, {2033,11,21}, {2033,11,22}, {2033,11,23}, {2033,11,24}, {2033,11,25}, {2033,11,26}, {2033,11,27}, {2033,11,28}, {2033,11,29}, {2033,11,30}, {2033,12,1}, {2033,12,2}, {2033,12,3}, 
-{2033,12,4}, {2033,12,5}, {2033,12,6}, {2033,12,7}, {2033,12,8}, {2033,12,9}, {2033,12,10}, {2033,12,11}, {2033,12,12}, {2033,12,13}, {2033,12,14}, {2033,12,15}, {2033,12,16}, {2033,12,17}, {2033,12,18}, {2033,12,19}, {2033,12,20}, {2033,12,21}, {2033,12,22}, {2033,12,23}, {2033,12,24}, {2033,12,25}, {2033,12,26}, {2033,12,27}, {2033,12,28}, {2033,12,29}, {2033,12,30}, {2033,12,31}, {2034,1,1}, {2034,1,2}, {2034,1,3}, {2034,1,4}, 
-{2034,1,5}, {2034,1,6}, {2034,1,7}, {2034,1,8}, {2034,1,9}, {2034,1,10}, {2034,1,11}, {2034,1,12}, {2034,1,13}, {2034,1,14}, {2034,1,15}, {2034,1,16}, {2034,1,17}, {2034,1,18}, {2034,1,19}, {2034,1,20}, {2034,1,21}, {2034,1,22}, {2034,1,23}, {2034,1,24}, {2034,1,25}, {2034,1,26}, {2034,1,27}, {2034,1,28}, {2034,1,29}, {2034,1,30}, {2034,1,31}, {2034,2,1}, {2034,2,2}, {2034,2,3}, {2034,2,4}, {2034,2,5}, 
-{2034,2,6}, {2034,2,7}, {2034,2,8}, {2034,2,9}, {2034,2,10}, {2034,2,11}, {2034,2,12}, {2034,2,13}, {2034,2,14}, {2034,2,15}, {2034,2,16}, {2034,2,17}, {2034,2,18}, {2034,2,19}, {2034,2,20}, {2034,2,21}, {2034,2,22}, {2034,2,23}, {2034,2,24}, {2034,2,25}, {2034,2,26}, {2034,2,27}, {2034,2,28}, {2034,3,1}, {2034,3,2}, {2034,3,3}, {2034,3,4}, {2034,3,5}, {2034,3,6}, {2034,3,7}, {2034,3,8}, {2034,3,9}, 
-{2034,3,10}, {2034,3,11}, {2034,3,12}, {2034,3,13}, {2034,3,14}, {2034,3,15}, {2034,3,16}, {2034,3,17}, {2034,3,18}, {2034,3,19}, {2034,3,20}, {2034,3,21}, {2034,3,22}, {2034,3,23}, {2034,3,24}, {2034,3,25}, {2034,3,26}, {2034,3,27}, {2034,3,28}, {2034,3,29}, {2034,3,30}, {2034,3,31}, {2034,4,1}, {2034,4,2}, {2034,4,3}, {2034,4,4}, {2034,4,5}, {2034,4,6}, {2034,4,7}, {2034,4,8}, {2034,4,9}, {2034,4,10}, 
-{2034,4,11}, {2034,4,12}, {2034,4,13}, {2034,4,14}, {2034,4,15}, {2034,4,16}, {2034,4,17}, {2034,4,18}, {2034,4,19}, {2034,4,20}, {2034,4,21}, {2034,4,22}, {2034,4,23}, {2034,4,24}, {2034,4,25}, {2034,4,26}, {2034,4,27}, {2034,4,28}, {2034,4,29}, {2034,4,30}, {2034,5,1}, {2034,5,2}, {2034,5,3}, {2034,5,4}, {2034,5,5}, {2034,5,6}, {2034,5,7}, {2034,5,8}, {2034,5,9}, {2034,5,10}, {2034,5,11}, {2034,5,12}, 
-{2034,5,13}, {2034,5,14}, {2034,5,15}, {2034,5,16}, {2034,5,17}, {2034,5,18}, {2034,5,19}, {2034,5,20}, {2034,5,21}, {2034,5,22}, {2034,5,23}, {2034,5,24}, {2034,5,25}, {2034,5,26}, {2034,5,27}, {2034,5,28}, {2034,5,29}, {2034,5,30}, {2034,5,31}, {2034,6,1}, {2034,6,2}, {2034,6,3}, {2034,6,4}, {2034,6,5}, {2034,6,6}, {2034,6,7}, {2034,6,8}, {2034,6,9}, {2034,6,10}, {2034,6,11}, {2034,6,12}, {2034,6,13}, 
-{2034,6,14}, {2034,6,15}, {2034,6,16}, {2034,6,17}, {2034,6,18}, {2034,6,19}, {2034,6,20}, {2034,6,21}, {2034,6,22}, {2034,6,23}, {2034,6,24}, {2034,6,25}, {2034,6,26}, {2034,6,27}, {2034,6,28}, {2034,6,29}, {2034,6,30}, {2034,7,1}, {2034,7,2}, {2034,7,3}, {2034,7,4}, {2034,7,5}, {2034,7,6}, {2034,7,7}, {2034,7,8}, {2034,7,9}, {2034,7,10}, {2034,7,11}, {2034,7,12}, {2034,7,13}, {2034,7,14}, {2034,7,15}, 
-{2034,7,16}, {2034,7,17}, {2034,7,18}, {2034,7,19}, {2034,7,20}, {2034,7,21}, {2034,7,22}, {2034,7,23}, {2034,7,24}, {2034,7,25}, {2034,7,26}, {2034,7,27}, {2034,7,28}, {2034,7,29}, {2034,7,30}, {2034,7,31}, {2034,8,1}, {2034,8,2}, {2034,8,3}, {2034,8,4}, {2034,8,5}, {2034,8,6}, {2034,8,7}, {2034,8,8}, {2034,8,9}, {2034,8,10}, {2034,8,11}, {2034,8,12}, {2034,8,13}, {2034,8,14}, {2034,8,15}, {2034,8,16}, 
-{2034,8,17}, {2034,8,18}, {2034,8,19}, {2034,8,20}, {2034,8,21}, {2034,8,22}, {2034,8,23}, {2034,8,24}, {2034,8,25}, {2034,8,26}, {2034,8,27}, {2034,8,28}, {2034,8,29}, {2034,8,30}, {2034,8,31}, {2034,9,1}, {2034,9,2}, {2034,9,3}, {2034,9,4}, {2034,9,5}, {2034,9,6}, {2034,9,7}, {2034,9,8}, {2034,9,9}, {2034,9,10}, {2034,9,11}, {2034,9,12}, {2034,9,13}, {2034,9,14}, {2034,9,15}, {2034,9,16}, {2034,9,17}, 
-{2034,9,18}, {2034,9,19}, {2034,9,20}, {2034,9,21}, {2034,9,22}, {2034,9,23}, {2034,9,24}, {2034,9,25}, {2034,9,26}, {2034,9,27}, {2034,9,28}, {2034,9,29}, {2034,9,30}, {2034,10,1}, {2034,10,2}, {2034,10,3}, {2034,10,4}, {2034,10,5}, {2034,10,6}, {2034,10,7}, {2034,10,8}, {2034,10,9}, {2034,10,10}, {2034,10,11}, {2034,10,12}, {2034,10,13}, {2034,10,14}, {2034,10,15}, {2034,10,16}, {2034,10,17}, {2034,10,18}, {2034,10,19}, 
-{2034,10,20}, {2034,10,21}, {2034,10,22}, {2034,10,23}, {2034,10,24}, {2034,10,25}, {2034,10,26}, {2034,10,27}, {2034,10,28}, {2034,10,29}, {2034,10,30}, {2034,10,31}, {2034,11,1}, {2034,11,2}, {2034,11,3}, {2034,11,4}, {2034,11,5}, {2034,11,6}, {2034,11,7}, {2034,11,8}, {2034,11,9}, {2034,11,10}, {2034,11,11}, {2034,11,12}, {2034,11,13}, {2034,11,14}, {2034,11,15}, {2034,11,16}, {2034,11,17}, {2034,11,18}, {2034,11,19}, {2034,11,20}, 
-{2034,11,21}, {2034,11,22}, {2034,11,23}, {2034,11,24}, {2034,11,25}, {2034,11,26}, {2034,11,27}, {2034,11,28}, {2034,11,29}, {2034,11,30}, {2034,12,1}, {2034,12,2}, {2034,12,3}, {2034,12,4}, {2034,12,5}, {2034,12,6}, {2034,12,7}, {2034,12,8}, {2034,12,9}, {2034,12,10}, {2034,12,11}, {2034,12,12}, {2034,12,13}, {2034,12,14}, {2034,12,15}, {2034,12,16}, {2034,12,17}, {2034,12,18}, {2034,12,19}, {2034,12,20}, {2034,12,21}, {2034,12,22}, 
-{2034,12,23}, {2034,12,24}, {2034,12,25}, {2034,12,26}, {2034,12,27}, {2034,12,28}, {2034,12,29}, {2034,12,30}, {2034,12,31}, {2035,1,1}, {2035,1,2}, {2035,1,3}, {2035,1,4}, {2035,1,5}, {2035,1,6}, {2035,1,7}, {2035,1,8}, {2035,1,9}, {2035,1,10}, {2035,1,11}, {2035,1,12}, {2035,1,13}, {2035,1,14}, {2035,1,15}, {2035,1,16}, {2035,1,17}, {2035,1,18}, {2035,1,19}, {2035,1,20}, {2035,1,21}, {2035,1,22}, {2035,1,23}, 
-{2035,1,24}, {2035,1,25}, {2035,1,26}, {2035,1,27}, {2035,1,28}, {2035,1,29}, {2035,1,30}, {2035,1,31}, {2035,2,1}, {2035,2,2}, {2035,2,3}, {2035,2,4}, {2035,2,5}, {2035,2,6}, {2035,2,7}, {2035,2,8}, {2035,2,9}, {2035,2,10}, {2035,2,11}, {2035,2,12}, {2035,2,13}, {2035,2,14}, {2035,2,15}, {2035,2,16}, {2035,2,17}, {2035,2,18}, {2035,2,19}, {2035,2,20}, {2035,2,21}, {2035,2,22}, {2035,2,23}, {2035,2,24}, 
-{2035,2,25}, {2035,2,26}, {2035,2,27}, {2035,2,28}, {2035,3,1}, {2035,3,2}, {2035,3,3}, {2035,3,4}, {2035,3,5}, {2035,3,6}, {2035,3,7}, {2035,3,8}, {2035,3,9}, {2035,3,10}, {2035,3,11}, {2035,3,12}, {2035,3,13}, {2035,3,14}, {2035,3,15}, {2035,3,16}, {2035,3,17}, {2035,3,18}, {2035,3,19}, {2035,3,20}, {2035,3,21}, {2035,3,22}, {2035,3,23}, {2035,3,24}, {2035,3,25}, {2035,3,26}, {2035,3,27}, {2035,3,28}, 
-{2035,3,29}, {2035,3,30}, {2035,3,31}, {2035,4,1}, {2035,4,2}, {2035,4,3}, {2035,4,4}, {2035,4,5}, {2035,4,6}, {2035,4,7}, {2035,4,8}, {2035,4,9}, {2035,4,10}, {2035,4,11}, {2035,4,12}, {2035,4,13}, {2035,4,14}, {2035,4,15}, {2035,4,16}, {2035,4,17}, {2035,4,18}, {2035,4,19}, {2035,4,20}, {2035,4,21}, {2035,4,22}, {2035,4,23}, {2035,4,24}, {2035,4,25}, {2035,4,26}, {2035,4,27}, {2035,4,28}, {2035,4,29}, 
-{2035,4,30}, {2035,5,1}, {2035,5,2}, {2035,5,3}, {2035,5,4}, {2035,5,5}, {2035,5,6}, {2035,5,7}, {2035,5,8}, {2035,5,9}, {2035,5,10}, {2035,5,11}, {2035,5,12}, {2035,5,13}, {2035,5,14}, {2035,5,15}, {2035,5,16}, {2035,5,17}, {2035,5,18}, {2035,5,19}, {2035,5,20}, {2035,5,21}, {2035,5,22}, {2035,5,23}, {2035,5,24}, {2035,5,25}, {2035,5,26}, {2035,5,27}, {2035,5,28}, {2035,5,29}, {2035,5,30}, {2035,5,31}, 
-{2035,6,1}, {2035,6,2}, {2035,6,3}, {2035,6,4}, {2035,6,5}, {2035,6,6}, {2035,6,7}, {2035,6,8}, {2035,6,9}, {2035,6,10}, {2035,6,11}, {2035,6,12}, {2035,6,13}, {2035,6,14}, {2035,6,15}, {2035,6,16}, {2035,6,17}, {2035,6,18}, {2035,6,19}, {2035,6,20}, {2035,6,21}, {2035,6,22}, {2035,6,23}, {2035,6,24}, {2035,6,25}, {2035,6,26}, {2035,6,27}, {2035,6,28}, {2035,6,29}, {2035,6,30}, {2035,7,1}, {2035,7,2}, 
-{2035,7,3}, {2035,7,4}, {2035,7,5}, {2035,7,6}, {2035,7,7}, {2035,7,8}, {2035,7,9}, {2035,7,10}, {2035,7,11}, {2035,7,12}, {2035,7,13}, {2035,7,14}, {2035,7,15}, {2035,7,16}, {2035,7,17}, {2035,7,18}, {2035,7,19}, {2035,7,20}, {2035,7,21}, {2035,7,22}, {2035,7,23}, {2035,7,24}, {2035,7,25}, {2035,7,26}, {2035,7,27}, {2035,7,28}, {2035,7,29}, {2035,7,30}, {2035,7,31}, {2035,8,1}, {2035,8,2}, {2035,8,3}, 
-{2035,8,4}, {2035,8,5}, {2035,8,6}, {2035,8,7}, {2035,8,8}, {2035,8,9}, {2035,8,10}, {2035,8,11}, {2035,8,12}, {2035,8,13}, {2035,8,14}, {2035,8,15}, {2035,8,16}, {2035,8,17}, {2035,8,18}, {2035,8,19}, {2035,8,20}, {2035,8,21}, {2035,8,22}, {2035,8,23}, {2035,8,24}, {2035,8,25}, {2035,8,26}, {2035,8,27}, {2035,8,28}, {2035,8,29}, {2035,8,30}, {2035,8,31}, {2035,9,1}, {2035,9,2}, {2035,9,3}, {2035,9,4}, 
-{2035,9,5}, {2035,9,6}, {2035,9,7}, {2035,9,8}, {2035,9,9}, {2035,9,10}, {2035,9,11}, {2035,9,12}, {2035,9,13}, {2035,9,14}, {2035,9,15}, {2035,9,16}, {2035,9,17}, {2035,9,18}, {2035,9,19}, {2035,9,20}, {2035,9,21}, {2035,9,22}, {2035,9,23}, {2035,9,24}, {2035,9,25}, {2035,9,26}, {2035,9,27}, {2035,9,28}, {2035,9,29}, {2035,9,30}, {2035,10,1}, {2035,10,2}, {2035,10,3}, {2035,10,4}, {2035,10,5}, {2035,10,6}, 
-{2035,10,7}, {2035,10,8}, {2035,10,9}, {2035,10,10}, {2035,10,11}, {2035,10,12}, {2035,10,13}, {2035,10,14}, {2035,10,15}, {2035,10,16}, {2035,10,17}, {2035,10,18}, {2035,10,19}, {2035,10,20}, {2035,10,21}, {2035,10,22}, {2035,10,23}, {2035,10,24}, {2035,10,25}, {2035,10,26}, {2035,10,27}, {2035,10,28}, {2035,10,29}, {2035,10,30}, {2035,10,31}, {2035,11,1}, {2035,11,2}, {2035,11,3}, {2035,11,4}, {2035,11,5}, {2035,11,6}, {2035,11,7}, 
-{2035,11,8}, {2035,11,9}, {2035,11,10}, {2035,11,11}, {2035,11,12}, {2035,11,13}, {2035,11,14}, {2035,11,15}, {2035,11,16}, {2035,11,17}, {2035,11,18}, {2035,11,19}, {2035,11,20}, {2035,11,21}, {2035,11,22}, {2035,11,23}, {2035,11,24}, {2035,11,25}, {2035,11,26}, {2035,11,27}, {2035,11,28}, {2035,11,29}, {2035,11,30}, {2035,12,1}, {2035,12,2}, {2035,12,3}, {2035,12,4}, {2035,12,5}, {2035,12,6}, {2035,12,7}, {2035,12,8}, {2035,12,9}, 
-{2035,12,10}, {2035,12,11}, {2035,12,12}, {2035,12,13}, {2035,12,14}, {2035,12,15}, {2035,12,16}, {2035,12,17}, {2035,12,18}, {2035,12,19}, {2035,12,20}, {2035,12,21}, {2035,12,22}, {2035,12,23}, {2035,12,24}, {2035,12,25}, {2035,12,26}, {2035,12,27}, {2035,12,28}, {2035,12,29}, {2035,12,30}, {2035,12,31}, {2036,1,1}, {2036,1,2}, {2036,1,3}, {2036,1,4}, {2036,1,5}, {2036,1,6}, {2036,1,7}, {2036,1,8}, {2036,1,9}, {2036,1,10}, 
-{2036,1,11}, {2036,1,12}, {2036,1,13}, {2036,1,14}, {2036,1,15}, {2036,1,16}, {2036,1,17}, {2036,1,18}, {2036,1,19}, {2036,1,20}, {2036,1,21}, {2036,1,22}, {2036,1,23}, {2036,1,24}, {2036,1,25}, {2036,1,26}, {2036,1,27}, {2036,1,28}, {2036,1,29}, {2036,1,30}, {2036,1,31}, {2036,2,1}, {2036,2,2}, {2036,2,3}, {2036,2,4}, {2036,2,5}, {2036,2,6}, {2036,2,7}, {2036,2,8}, {2036,2,9}, {2036,2,10}, {2036,2,11}, 
-{2036,2,12}, {2036,2,13}, {2036,2,14}, {2036,2,15}, {2036,2,16}, {2036,2,17}, {2036,2,18}, {2036,2,19}, {2036,2,20}, {2036,2,21}, {2036,2,22}, {2036,2,23}, {2036,2,24}, {2036,2,25}, {2036,2,26}, {2036,2,27}, {2036,2,28}, {2036,2,29}, {2036,3,1}, {2036,3,2}, {2036,3,3}, {2036,3,4}, {2036,3,5}, {2036,3,6}, {2036,3,7}, {2036,3,8}, {2036,3,9}, {2036,3,10}, {2036,3,11}, {2036,3,12}, {2036,3,13}, {2036,3,14}, 
-{2036,3,15}, {2036,3,16}, {2036,3,17}, {2036,3,18}, {2036,3,19}, {2036,3,20}, {2036,3,21}, {2036,3,22}, {2036,3,23}, {2036,3,24}, {2036,3,25}, {2036,3,26}, {2036,3,27}, {2036,3,28}, {2036,3,29}, {2036,3,30}, {2036,3,31}, {2036,4,1}, {2036,4,2}, {2036,4,3}, {2036,4,4}, {2036,4,5}, {2036,4,6}, {2036,4,7}, {2036,4,8}, {2036,4,9}, {2036,4,10}, {2036,4,11}, {2036,4,12}, {2036,4,13}, {2036,4,14}, {2036,4,15}, 
-{2036,4,16}, {2036,4,17}, {2036,4,18}, {2036,4,19}, {2036,4,20}, {2036,4,21}, {2036,4,22}, {2036,4,23}, {2036,4,24}, {2036,4,25}, {2036,4,26}, {2036,4,27}, {2036,4,28}, {2036,4,29}, {2036,4,30}, {2036,5,1}, {2036,5,2}, {2036,5,3}, {2036,5,4}, {2036,5,5}, {2036,5,6}, {2036,5,7}, {2036,5,8}, {2036,5,9}, {2036,5,10}, {2036,5,11}, {2036,5,12}, {2036,5,13}, {2036,5,14}, {2036,5,15}, {2036,5,16}, {2036,5,17}, 
-{2036,5,18}, {2036,5,19}, {2036,5,20}, {2036,5,21}, {2036,5,22}, {2036,5,23}, {2036,5,24}, {2036,5,25}, {2036,5,26}, {2036,5,27}, {2036,5,28}, {2036,5,29}, {2036,5,30}, {2036,5,31}, {2036,6,1}, {2036,6,2}, {2036,6,3}, {2036,6,4}, {2036,6,5}, {2036,6,6}, {2036,6,7}, {2036,6,8}, {2036,6,9}, {2036,6,10}, {2036,6,11}, {2036,6,12}, {2036,6,13}, {2036,6,14}, {2036,6,15}, {2036,6,16}, {2036,6,17}, {2036,6,18}, 
-{2036,6,19}, {2036,6,20}, {2036,6,21}, {2036,6,22}, {2036,6,23}, {2036,6,24}, {2036,6,25}, {2036,6,26}, {2036,6,27}, {2036,6,28}, {2036,6,29}, {2036,6,30}, {2036,7,1}, {2036,7,2}, {2036,7,3}, {2036,7,4}, {2036,7,5}, {2036,7,6}, {2036,7,7}, {2036,7,8}, {2036,7,9}, {2036,7,10}, {2036,7,11}, {2036,7,12}, {2036,7,13}, {2036,7,14}, {2036,7,15}, {2036,7,16}, {2036,7,17}, {2036,7,18}, {2036,7,19}, {2036,7,20}, 
-{2036,7,21}, {2036,7,22}, {2036,7,23}, {2036,7,24}, {2036,7,25}, {2036,7,26}, {2036,7,27}, {2036,7,28}, {2036,7,29}, {2036,7,30}, {2036,7,31}, {2036,8,1}, {2036,8,2}, {2036,8,3}, {2036,8,4}, {2036,8,5}, {2036,8,6}, {2036,8,7}, {2036,8,8}, {2036,8,9}, {2036,8,10}, {2036,8,11}, {2036,8,12}, {2036,8,13}, {2036,8,14}, {2036,8,15}, {2036,8,16}, {2036,8,17}, {2036,8,18}, {2036,8,19}, {2036,8,20}, {2036,8,21}, 
-{2036,8,22}, {2036,8,23}, {2036,8,24}, {2036,8,25}, {2036,8,26}, {2036,8,27}, {2036,8,28}, {2036,8,29}, {2036,8,30}, {2036,8,31}, {2036,9,1}, {2036,9,2}, {2036,9,3}, {2036,9,4}, {2036,9,5}, {2036,9,6}, {2036,9,7}, {2036,9,8}, {2036,9,9}, {2036,9,10}, {2036,9,11}, {2036,9,12}, {2036,9,13}, {2036,9,14}, {2036,9,15}, {2036,9,16}, {2036,9,17}, {2036,9,18}, {2036,9,19}, {2036,9,20}, {2036,9,21}, {2036,9,22}, 
-{2036,9,23}, {2036,9,24}, {2036,9,25}, {2036,9,26}, {2036,9,27}, {2036,9,28}, {2036,9,29}, {2036,9,30}, {2036,10,1}, {2036,10,2}, {2036,10,3}, {2036,10,4}, {2036,10,5}, {2036,10,6}, {2036,10,7}, {2036,10,8}, {2036,10,9}, {2036,10,10}, {2036,10,11}, {2036,10,12}, {2036,10,13}, {2036,10,14}, {2036,10,15}, {2036,10,16}, {2036,10,17}, {2036,10,18}, {2036,10,19}, {2036,10,20}, {2036,10,21}, {2036,10,22}, {2036,10,23}, {2036,10,24}, 
-{2036,10,25}, {2036,10,26}, {2036,10,27}, {2036,10,28}, {2036,10,29}, {2036,10,30}, {2036,10,31}, {2036,11,1}, {2036,11,2}, {2036,11,3}, {2036,11,4}, {2036,11,5}, {2036,11,6}, {2036,11,7}, {2036,11,8}, {2036,11,9}, {2036,11,10}, {2036,11,11}, {2036,11,12}, {2036,11,13}, {2036,11,14}, {2036,11,15}, {2036,11,16}, {2036,11,17}, {2036,11,18}, {2036,11,19}, {2036,11,20}, {2036,11,21}, {2036,11,22}, {2036,11,23}, {2036,11,24}, {2036,11,25}, 
-{2036,11,26}, {2036,11,27}, {2036,11,28}, {2036,11,29}, {2036,11,30}, {2036,12,1}, {2036,12,2}, {2036,12,3}, {2036,12,4}, {2036,12,5}, {2036,12,6}, {2036,12,7}, {2036,12,8}, {2036,12,9}, {2036,12,10}, {2036,12,11}, {2036,12,12}, {2036,12,13}, {2036,12,14}, {2036,12,15}, {2036,12,16}, {2036,12,17}, {2036,12,18}, {2036,12,19}, {2036,12,20}, {2036,12,21}, {2036,12,22}, {2036,12,23}, {2036,12,24}, {2036,12,25}, {2036,12,26}, {2036,12,27}, 
-{2036,12,28}, {2036,12,29}, {2036,12,30}, {2036,12,31}, {2037,1,1}, {2037,1,2}, {2037,1,3}, {2037,1,4}, {2037,1,5}, {2037,1,6}, {2037,1,7}, {2037,1,8}, {2037,1,9}, {2037,1,10}, {2037,1,11}, {2037,1,12}, {2037,1,13}, {2037,1,14}, {2037,1,15}, {2037,1,16}, {2037,1,17}, {2037,1,18}, {2037,1,19}, {2037,1,20}, {2037,1,21}, {2037,1,22}, {2037,1,23}, {2037,1,24}, {2037,1,25}, {2037,1,26}, {2037,1,27}, {2037,1,28}, 
-{2037,1,29}, {2037,1,30}, {2037,1,31}, {2037,2,1}, {2037,2,2}, {2037,2,3}, {2037,2,4}, {2037,2,5}, {2037,2,6}, {2037,2,7}, {2037,2,8}, {2037,2,9}, {2037,2,10}, {2037,2,11}, {2037,2,12}, {2037,2,13}, {2037,2,14}, {2037,2,15}, {2037,2,16}, {2037,2,17}, {2037,2,18}, {2037,2,19}, {2037,2,20}, {2037,2,21}, {2037,2,22}, {2037,2,23}, {2037,2,24}, {2037,2,25}, {2037,2,26}, {2037,2,27}, {2037,2,28}, {2037,3,1}, 
-{2037,3,2}, {2037,3,3}, {2037,3,4}, {2037,3,5}, {2037,3,6}, {2037,3,7}, {2037,3,8}, {2037,3,9}, {2037,3,10}, {2037,3,11}, {2037,3,12}, {2037,3,13}, {2037,3,14}, {2037,3,15}, {2037,3,16}, {2037,3,17}, {2037,3,18}, {2037,3,19}, {2037,3,20}, {2037,3,21}, {2037,3,22}, {2037,3,23}, {2037,3,24}, {2037,3,25}, {2037,3,26}, {2037,3,27}, {2037,3,28}, {2037,3,29}, {2037,3,30}, {2037,3,31}, {2037,4,1}, {2037,4,2}, 
-{2037,4,3}, {2037,4,4}, {2037,4,5}, {2037,4,6}, {2037,4,7}, {2037,4,8}, {2037,4,9}, {2037,4,10}, {2037,4,11}, {2037,4,12}, {2037,4,13}, {2037,4,14}, {2037,4,15}, {2037,4,16}, {2037,4,17}, {2037,4,18}, {2037,4,19}, {2037,4,20}, {2037,4,21}, {2037,4,22}, {2037,4,23}, {2037,4,24}, {2037,4,25}, {2037,4,26}, {2037,4,27}, {2037,4,28}, {2037,4,29}, {2037,4,30}, {2037,5,1}, {2037,5,2}, {2037,5,3}, {2037,5,4}, 
-{2037,5,5}, {2037,5,6}, {2037,5,7}, {2037,5,8}, {2037,5,9}, {2037,5,10}, {2037,5,11}, {2037,5,12}, {2037,5,13}, {2037,5,14}, {2037,5,15}, {2037,5,16}, {2037,5,17}, {2037,5,18}, {2037,5,19}, {2037,5,20}, {2037,5,21}, {2037,5,22}, {2037,5,23}, {2037,5,24}, {2037,5,25}, {2037,5,26}, {2037,5,27}, {2037,5,28}, {2037,5,29}, {2037,5,30}, {2037,5,31}, {2037,6,1}, {2037,6,2}, {2037,6,3}, {2037,6,4}, {2037,6,5}, 
-{2037,6,6}, {2037,6,7}, {2037,6,8}, {2037,6,9}, {2037,6,10}, {2037,6,11}, {2037,6,12}, {2037,6,13}, {2037,6,14}, {2037,6,15}, {2037,6,16}, {2037,6,17}, {2037,6,18}, {2037,6,19}, {2037,6,20}, {2037,6,21}, {2037,6,22}, {2037,6,23}, {2037,6,24}, {2037,6,25}, {2037,6,26}, {2037,6,27}, {2037,6,28}, {2037,6,29}, {2037,6,30}, {2037,7,1}, {2037,7,2}, {2037,7,3}, {2037,7,4}, {2037,7,5}, {2037,7,6}, {2037,7,7}, 
-{2037,7,8}, {2037,7,9}, {2037,7,10}, {2037,7,11}, {2037,7,12}, {2037,7,13}, {2037,7,14}, {2037,7,15}, {2037,7,16}, {2037,7,17}, {2037,7,18}, {2037,7,19}, {2037,7,20}, {2037,7,21}, {2037,7,22}, {2037,7,23}, {2037,7,24}, {2037,7,25}, {2037,7,26}, {2037,7,27}, {2037,7,28}, {2037,7,29}, {2037,7,30}, {2037,7,31}, {2037,8,1}, {2037,8,2}, {2037,8,3}, {2037,8,4}, {2037,8,5}, {2037,8,6}, {2037,8,7}, {2037,8,8}, 
-{2037,8,9}, {2037,8,10}, {2037,8,11}, {2037,8,12}, {2037,8,13}, {2037,8,14}, {2037,8,15}, {2037,8,16}, {2037,8,17}, {2037,8,18}, {2037,8,19}, {2037,8,20}, {2037,8,21}, {2037,8,22}, {2037,8,23}, {2037,8,24}, {2037,8,25}, {2037,8,26}, {2037,8,27}, {2037,8,28}, {2037,8,29}, {2037,8,30}, {2037,8,31}, {2037,9,1}, {2037,9,2}, {2037,9,3}, {2037,9,4}, {2037,9,5}, {2037,9,6}, {2037,9,7}, {2037,9,8}, {2037,9,9}, 
-{2037,9,10}, {2037,9,11}, {2037,9,12}, {2037,9,13}, {2037,9,14}, {2037,9,15}, {2037,9,16}, {2037,9,17}, {2037,9,18}, {2037,9,19}, {2037,9,20}, {2037,9,21}, {2037,9,22}, {2037,9,23}, {2037,9,24}, {2037,9,25}, {2037,9,26}, {2037,9,27}, {2037,9,28}, {2037,9,29}, {2037,9,30}, {2037,10,1}, {2037,10,2}, {2037,10,3}, {2037,10,4}, {2037,10,5}, {2037,10,6}, {2037,10,7}, {2037,10,8}, {2037,10,9}, {2037,10,10}, {2037,10,11}, 
-{2037,10,12}, {2037,10,13}, {2037,10,14}, {2037,10,15}, {2037,10,16}, {2037,10,17}, {2037,10,18}, {2037,10,19}, {2037,10,20}, {2037,10,21}, {2037,10,22}, {2037,10,23}, {2037,10,24}, {2037,10,25}, {2037,10,26}, {2037,10,27}, {2037,10,28}, {2037,10,29}, {2037,10,30}, {2037,10,31}, {2037,11,1}, {2037,11,2}, {2037,11,3}, {2037,11,4}, {2037,11,5}, {2037,11,6}, {2037,11,7}, {2037,11,8}, {2037,11,9}, {2037,11,10}, {2037,11,11}, {2037,11,12}, 
-{2037,11,13}, {2037,11,14}, {2037,11,15}, {2037,11,16}, {2037,11,17}, {2037,11,18}, {2037,11,19}, {2037,11,20}, {2037,11,21}, {2037,11,22}, {2037,11,23}, {2037,11,24}, {2037,11,25}, {2037,11,26}, {2037,11,27}, {2037,11,28}, {2037,11,29}, {2037,11,30}, {2037,12,1}, {2037,12,2}, {2037,12,3}, {2037,12,4}, {2037,12,5}, {2037,12,6}, {2037,12,7}, {2037,12,8}, {2037,12,9}, {2037,12,10}, {2037,12,11}, {2037,12,12}, {2037,12,13}, {2037,12,14}, 
-{2037,12,15}, {2037,12,16}, {2037,12,17}, {2037,12,18}, {2037,12,19}, {2037,12,20}, {2037,12,21}, {2037,12,22}, {2037,12,23}, {2037,12,24}, {2037,12,25}, {2037,12,26}, {2037,12,27}, {2037,12,28}, {2037,12,29}, {2037,12,30}, {2037,12,31}, {2038,1,1}, {2038,1,2}, {2038,1,3}, {2038,1,4}, {2038,1,5}, {2038,1,6}, {2038,1,7}, {2038,1,8}, {2038,1,9}, {2038,1,10}, {2038,1,11}, {2038,1,12}, {2038,1,13}, {2038,1,14}, {2038,1,15}, 
-{2038,1,16}, {2038,1,17}, {2038,1,18}, {2038,1,19}, {2038,1,20}, {2038,1,21}, {2038,1,22}, {2038,1,23}, {2038,1,24}, {2038,1,25}, {2038,1,26}, {2038,1,27}, {2038,1,28}, {2038,1,29}, {2038,1,30}, {2038,1,31}, {2038,2,1}, {2038,2,2}, {2038,2,3}, {2038,2,4}, {2038,2,5}, {2038,2,6}, {2038,2,7}, {2038,2,8}, {2038,2,9}, {2038,2,10}, {2038,2,11}, {2038,2,12}, {2038,2,13}, {2038,2,14}, {2038,2,15}, {2038,2,16}, 
-{2038,2,17}, {2038,2,18}, {2038,2,19}, {2038,2,20}, {2038,2,21}, {2038,2,22}, {2038,2,23}, {2038,2,24}, {2038,2,25}, {2038,2,26}, {2038,2,27}, {2038,2,28}, {2038,3,1}, {2038,3,2}, {2038,3,3}, {2038,3,4}, {2038,3,5}, {2038,3,6}, {2038,3,7}, {2038,3,8}, {2038,3,9}, {2038,3,10}, {2038,3,11}, {2038,3,12}, {2038,3,13}, {2038,3,14}, {2038,3,15}, {2038,3,16}, {2038,3,17}, {2038,3,18}, {2038,3,19}, {2038,3,20}, 
-{2038,3,21}, {2038,3,22}, {2038,3,23}, {2038,3,24}, {2038,3,25}, {2038,3,26}, {2038,3,27}, {2038,3,28}, {2038,3,29}, {2038,3,30}, {2038,3,31}, {2038,4,1}, {2038,4,2}, {2038,4,3}, {2038,4,4}, {2038,4,5}, {2038,4,6}, {2038,4,7}, {2038,4,8}, {2038,4,9}, {2038,4,10}, {2038,4,11}, {2038,4,12}, {2038,4,13}, {2038,4,14}, {2038,4,15}, {2038,4,16}, {2038,4,17}, {2038,4,18}, {2038,4,19}, {2038,4,20}, {2038,4,21}, 
-{2038,4,22}, {2038,4,23}, {2038,4,24}, {2038,4,25}, {2038,4,26}, {2038,4,27}, {2038,4,28}, {2038,4,29}, {2038,4,30}, {2038,5,1}, {2038,5,2}, {2038,5,3}, {2038,5,4}, {2038,5,5}, {2038,5,6}, {2038,5,7}, {2038,5,8}, {2038,5,9}, {2038,5,10}, {2038,5,11}, {2038,5,12}, {2038,5,13}, {2038,5,14}, {2038,5,15}, {2038,5,16}, {2038,5,17}, {2038,5,18}, {2038,5,19}, {2038,5,20}, {2038,5,21}, {2038,5,22}, {2038,5,23}, 
-{2038,5,24}, {2038,5,25}, {2038,5,26}, {2038,5,27}, {2038,5,28}, {2038,5,29}, {2038,5,30}, {2038,5,31}, {2038,6,1}, {2038,6,2}, {2038,6,3}, {2038,6,4}, {2038,6,5}, {2038,6,6}, {2038,6,7}, {2038,6,8}, {2038,6,9}, {2038,6,10}, {2038,6,11}, {2038,6,12}, {2038,6,13}, {2038,6,14}, {2038,6,15}, {2038,6,16}, {2038,6,17}, {2038,6,18}, {2038,6,19}, {2038,6,20}, {2038,6,21}, {2038,6,22}, {2038,6,23}, {2038,6,24}, 
-{2038,6,25}, {2038,6,26}, {2038,6,27}, {2038,6,28}, {2038,6,29}, {2038,6,30}, {2038,7,1}, {2038,7,2}, {2038,7,3}, {2038,7,4}, {2038,7,5}, {2038,7,6}, {2038,7,7}, {2038,7,8}, {2038,7,9}, {2038,7,10}, {2038,7,11}, {2038,7,12}, {2038,7,13}, {2038,7,14}, {2038,7,15}, {2038,7,16}, {2038,7,17}, {2038,7,18}, {2038,7,19}, {2038,7,20}, {2038,7,21}, {2038,7,22}, {2038,7,23}, {2038,7,24}, {2038,7,25}, {2038,7,26}, 
-{2038,7,27}, {2038,7,28}, {2038,7,29}, {2038,7,30}, {2038,7,31}, {2038,8,1}, {2038,8,2}, {2038,8,3}, {2038,8,4}, {2038,8,5}, {2038,8,6}, {2038,8,7}, {2038,8,8}, {2038,8,9}, {2038,8,10}, {2038,8,11}, {2038,8,12}, {2038,8,13}, {2038,8,14}, {2038,8,15}, {2038,8,16}, {2038,8,17}, {2038,8,18}, {2038,8,19}, {2038,8,20}, {2038,8,21}, {2038,8,22}, {2038,8,23}, {2038,8,24}, {2038,8,25}, {2038,8,26}, {2038,8,27}, 
-{2038,8,28}, {2038,8,29}, {2038,8,30}, {2038,8,31}, {2038,9,1}, {2038,9,2}, {2038,9,3}, {2038,9,4}, {2038,9,5}, {2038,9,6}, {2038,9,7}, {2038,9,8}, {2038,9,9}, {2038,9,10}, {2038,9,11}, {2038,9,12}, {2038,9,13}, {2038,9,14}, {2038,9,15}, {2038,9,16}, {2038,9,17}, {2038,9,18}, {2038,9,19}, {2038,9,20}, {2038,9,21}, {2038,9,22}, {2038,9,23}, {2038,9,24}, {2038,9,25}, {2038,9,26}, {2038,9,27}, {2038,9,28}, 
-{2038,9,29}, {2038,9,30}, {2038,10,1}, {2038,10,2}, {2038,10,3}, {2038,10,4}, {2038,10,5}, {2038,10,6}, {2038,10,7}, {2038,10,8}, {2038,10,9}, {2038,10,10}, {2038,10,11}, {2038,10,12}, {2038,10,13}, {2038,10,14}, {2038,10,15}, {2038,10,16}, {2038,10,17}, {2038,10,18}, {2038,10,19}, {2038,10,20}, {2038,10,21}, {2038,10,22}, {2038,10,23}, {2038,10,24}, {2038,10,25}, {2038,10,26}, {2038,10,27}, {2038,10,28}, {2038,10,29}, {2038,10,30}, 
-{2038,10,31}, {2038,11,1}, {2038,11,2}, {2038,11,3}, {2038,11,4}, {2038,11,5}, {2038,11,6}, {2038,11,7}, {2038,11,8}, {2038,11,9}, {2038,11,10}, {2038,11,11}, {2038,11,12}, {2038,11,13}, {2038,11,14}, {2038,11,15}, {2038,11,16}, {2038,11,17}, {2038,11,18}, {2038,11,19}, {2038,11,20}, {2038,11,21}, {2038,11,22}, {2038,11,23}, {2038,11,24}, {2038,11,25}, {2038,11,26}, {2038,11,27}, {2038,11,28}, {2038,11,29}, {2038,11,30}, {2038,12,1}, 
-{2038,12,2}, {2038,12,3}, {2038,12,4}, {2038,12,5}, {2038,12,6}, {2038,12,7}, {2038,12,8}, {2038,12,9}, {2038,12,10}, {2038,12,11}, {2038,12,12}, {2038,12,13}, {2038,12,14}, {2038,12,15}, {2038,12,16}, {2038,12,17}, {2038,12,18}, {2038,12,19}, {2038,12,20}, {2038,12,21}, {2038,12,22}, {2038,12,23}, {2038,12,24}, {2038,12,25}, {2038,12,26}, {2038,12,27}, {2038,12,28}, {2038,12,29}, {2038,12,30}, {2038,12,31}, {2039,1,1}, {2039,1,2}, 
-{2039,1,3}, {2039,1,4}, {2039,1,5}, {2039,1,6}, {2039,1,7}, {2039,1,8}, {2039,1,9}, {2039,1,10}, {2039,1,11}, {2039,1,12}, {2039,1,13}, {2039,1,14}, {2039,1,15}, {2039,1,16}, {2039,1,17}, {2039,1,18}, {2039,1,19}, {2039,1,20}, {2039,1,21}, {2039,1,22}, {2039,1,23}, {2039,1,24}, {2039,1,25}, {2039,1,26}, {2039,1,27}, {2039,1,28}, {2039,1,29}, {2039,1,30}, {2039,1,31}, {2039,2,1}, {2039,2,2}, {2039,2,3}, 
-{2039,2,4}, {2039,2,5}, {2039,2,6}, {2039,2,7}, {2039,2,8}, {2039,2,9}, {2039,2,10}, {2039,2,11}, {2039,2,12}, {2039,2,13}, {2039,2,14}, {2039,2,15}, {2039,2,16}, {2039,2,17}, {2039,2,18}, {2039,2,19}, {2039,2,20}, {2039,2,21}, {2039,2,22}, {2039,2,23}, {2039,2,24}, {2039,2,25}, {2039,2,26}, {2039,2,27}, {2039,2,28}, {2039,3,1}, {2039,3,2}, {2039,3,3}, {2039,3,4}, {2039,3,5}, {2039,3,6}, {2039,3,7}, 
-{2039,3,8}, {2039,3,9}, {2039,3,10}, {2039,3,11}, {2039,3,12}, {2039,3,13}, {2039,3,14}, {2039,3,15}, {2039,3,16}, {2039,3,17}, {2039,3,18}, {2039,3,19}, {2039,3,20}, {2039,3,21}, {2039,3,22}, {2039,3,23}, {2039,3,24}, {2039,3,25}, {2039,3,26}, {2039,3,27}, {2039,3,28}, {2039,3,29}, {2039,3,30}, {2039,3,31}, {2039,4,1}, {2039,4,2}, {2039,4,3}, {2039,4,4}, {2039,4,5}, {2039,4,6}, {2039,4,7}, {2039,4,8}, 
-{2039,4,9}, {2039,4,10}, {2039,4,11}, {2039,4,12}, {2039,4,13}, {2039,4,14}, {2039,4,15}, {2039,4,16}, {2039,4,17}, {2039,4,18}, {2039,4,19}, {2039,4,20}, {2039,4,21}, {2039,4,22}, {2039,4,23}, {2039,4,24}, {2039,4,25}, {2039,4,26}, {2039,4,27}, {2039,4,28}, {2039,4,29}, {2039,4,30}, {2039,5,1}, {2039,5,2}, {2039,5,3}, {2039,5,4}, {2039,5,5}, {2039,5,6}, {2039,5,7}, {2039,5,8}, {2039,5,9}, {2039,5,10}, 
-{2039,5,11}, {2039,5,12}, {2039,5,13}, {2039,5,14}, {2039,5,15}, {2039,5,16}, {2039,5,17}, {2039,5,18}, {2039,5,19}, {2039,5,20}, {2039,5,21}, {2039,5,22}, {2039,5,23}, {2039,5,24}, {2039,5,25}, {2039,5,26}, {2039,5,27}, {2039,5,28}, {2039,5,29}, {2039,5,30}, {2039,5,31}, {2039,6,1}, {2039,6,2}, {2039,6,3}, {2039,6,4}, {2039,6,5}, {2039,6,6}, {2039,6,7}, {2039,6,8}, {2039,6,9}, {2039,6,10}, {2039,6,11}, 
-{2039,6,12}, {2039,6,13}, {2039,6,14}, {2039,6,15}, {2039,6,16}, {2039,6,17}, {2039,6,18}, {2039,6,19}, {2039,6,20}, {2039,6,21}, {2039,6,22}, {2039,6,23}, {2039,6,24}, {2039,6,25}, {2039,6,26}, {2039,6,27}, {2039,6,28}, {2039,6,29}, {2039,6,30}, {2039,7,1}, {2039,7,2}, {2039,7,3}, {2039,7,4}, {2039,7,5}, {2039,7,6}, {2039,7,7}, {2039,7,8}, {2039,7,9}, {2039,7,10}, {2039,7,11}, {2039,7,12}, {2039,7,13}, 
-{2039,7,14}, {2039,7,15}, {2039,7,16}, {2039,7,17}, {2039,7,18}, {2039,7,19}, {2039,7,20}, {2039,7,21}, {2039,7,22}, {2039,7,23}, {2039,7,24}, {2039,7,25}, {2039,7,26}, {2039,7,27}, {2039,7,28}, {2039,7,29}, {2039,7,30}, {2039,7,31}, {2039,8,1}, {2039,8,2}, {2039,8,3}, {2039,8,4}, {2039,8,5}, {2039,8,6}, {2039,8,7}, {2039,8,8}, {2039,8,9}, {2039,8,10}, {2039,8,11}, {2039,8,12}, {2039,8,13}, {2039,8,14}, 
-{2039,8,15}, {2039,8,16}, {2039,8,17}, {2039,8,18}, {2039,8,19}, {2039,8,20}, {2039,8,21}, {2039,8,22}, {2039,8,23}, {2039,8,24}, {2039,8,25}, {2039,8,26}, {2039,8,27}, {2039,8,28}, {2039,8,29}, {2039,8,30}, {2039,8,31}, {2039,9,1}, {2039,9,2}, {2039,9,3}, {2039,9,4}, {2039,9,5}, {2039,9,6}, {2039,9,7}, {2039,9,8}, {2039,9,9}, {2039,9,10}, {2039,9,11}, {2039,9,12}, {2039,9,13}, {2039,9,14}, {2039,9,15}, 
-{2039,9,16}, {2039,9,17}, {2039,9,18}, {2039,9,19}, {2039,9,20}, {2039,9,21}, {2039,9,22}, {2039,9,23}, {2039,9,24}, {2039,9,25}, {2039,9,26}, {2039,9,27}, {2039,9,28}, {2039,9,29}, {2039,9,30}, {2039,10,1}, {2039,10,2}, {2039,10,3}, {2039,10,4}, {2039,10,5}, {2039,10,6}, {2039,10,7}, {2039,10,8}, {2039,10,9}, {2039,10,10}, {2039,10,11}, {2039,10,12}, {2039,10,13}, {2039,10,14}, {2039,10,15}, {2039,10,16}, {2039,10,17}, 
-{2039,10,18}, {2039,10,19}, {2039,10,20}, {2039,10,21}, {2039,10,22}, {2039,10,23}, {2039,10,24}, {2039,10,25}, {2039,10,26}, {2039,10,27}, {2039,10,28}, {2039,10,29}, {2039,10,30}, {2039,10,31}, {2039,11,1}, {2039,11,2}, {2039,11,3}, {2039,11,4}, {2039,11,5}, {2039,11,6}, {2039,11,7}, {2039,11,8}, {2039,11,9}, {2039,11,10}, {2039,11,11}, {2039,11,12}, {2039,11,13}, {2039,11,14}, {2039,11,15}, {2039,11,16}, {2039,11,17}, {2039,11,18}, 
-{2039,11,19}, {2039,11,20}, {2039,11,21}, {2039,11,22}, {2039,11,23}, {2039,11,24}, {2039,11,25}, {2039,11,26}, {2039,11,27}, {2039,11,28}, {2039,11,29}, {2039,11,30}, {2039,12,1}, {2039,12,2}, {2039,12,3}, {2039,12,4}, {2039,12,5}, {2039,12,6}, {2039,12,7}, {2039,12,8}, {2039,12,9}, {2039,12,10}, {2039,12,11}, {2039,12,12}, {2039,12,13}, {2039,12,14}, {2039,12,15}, {2039,12,16}, {2039,12,17}, {2039,12,18}, {2039,12,19}, {2039,12,20}, 
-{2039,12,21}, {2039,12,22}, {2039,12,23}, {2039,12,24}, {2039,12,25}, {2039,12,26}, {2039,12,27}, {2039,12,28}, {2039,12,29}, {2039,12,30}, {2039,12,31}, {2040,1,1}, {2040,1,2}, {2040,1,3}, {2040,1,4}, {2040,1,5}, {2040,1,6}, {2040,1,7}, {2040,1,8}, {2040,1,9}, {2040,1,10}, {2040,1,11}, {2040,1,12}, {2040,1,13}, {2040,1,14}, {2040,1,15}, {2040,1,16}, {2040,1,17}, {2040,1,18}, {2040,1,19}, {2040,1,20}, {2040,1,21}, 
-{2040,1,22}, {2040,1,23}, {2040,1,24}, {2040,1,25}, {2040,1,26}, {2040,1,27}, {2040,1,28}, {2040,1,29}, {2040,1,30}, {2040,1,31}, {2040,2,1}, {2040,2,2}, {2040,2,3}, {2040,2,4}, {2040,2,5}, {2040,2,6}, {2040,2,7}, {2040,2,8}, {2040,2,9}, {2040,2,10}, {2040,2,11}, {2040,2,12}, {2040,2,13}, {2040,2,14}, {2040,2,15}, {2040,2,16}, {2040,2,17}, {2040,2,18}, {2040,2,19}, {2040,2,20}, {2040,2,21}, {2040,2,22}, 
-{2040,2,23}, {2040,2,24}, {2040,2,25}, {2040,2,26}, {2040,2,27}, {2040,2,28}, {2040,2,29}, {2040,3,1}, {2040,3,2}, {2040,3,3}, {2040,3,4}, {2040,3,5}, {2040,3,6}, {2040,3,7}, {2040,3,8}, {2040,3,9}, {2040,3,10}, {2040,3,11}, {2040,3,12}, {2040,3,13}, {2040,3,14}, {2040,3,15}, {2040,3,16}, {2040,3,17}, {2040,3,18}, {2040,3,19}, {2040,3,20}, {2040,3,21}, {2040,3,22}, {2040,3,23}, {2040,3,24}, {2040,3,25}, 
-{2040,3,26}, {2040,3,27}, {2040,3,28}, {2040,3,29}, {2040,3,30}, {2040,3,31}, {2040,4,1}, {2040,4,2}, {2040,4,3}, {2040,4,4}, {2040,4,5}, {2040,4,6}, {2040,4,7}, {2040,4,8}, {2040,4,9}, {2040,4,10}, {2040,4,11}, {2040,4,12}, {2040,4,13}, {2040,4,14}, {2040,4,15}, {2040,4,16}, {2040,4,17}, {2040,4,18}, {2040,4,19}, {2040,4,20}, {2040,4,21}, {2040,4,22}, {2040,4,23}, {2040,4,24}, {2040,4,25}, {2040,4,26}, 
-{2040,4,27}, {2040,4,28}, {2040,4,29}, {2040,4,30}, {2040,5,1}, {2040,5,2}, {2040,5,3}, {2040,5,4}, {2040,5,5}, {2040,5,6}, {2040,5,7}, {2040,5,8}, {2040,5,9}, {2040,5,10}, {2040,5,11}, {2040,5,12}, {2040,5,13}, {2040,5,14}, {2040,5,15}, {2040,5,16}, {2040,5,17}, {2040,5,18}, {2040,5,19}, {2040,5,20}, {2040,5,21}, {2040,5,22}, {2040,5,23}, {2040,5,24}, {2040,5,25}, {2040,5,26}, {2040,5,27}, {2040,5,28}, 
-{2040,5,29}, {2040,5,30}, {2040,5,31}, {2040,6,1}, {2040,6,2}, {2040,6,3}, {2040,6,4}, {2040,6,5}, {2040,6,6}, {2040,6,7}, {2040,6,8}, {2040,6,9}, {2040,6,10}, {2040,6,11}, {2040,6,12}, {2040,6,13}, {2040,6,14}, {2040,6,15}, {2040,6,16}, {2040,6,17}, {2040,6,18}, {2040,6,19}, {2040,6,20}, {2040,6,21}, {2040,6,22}, {2040,6,23}, {2040,6,24}, {2040,6,25}, {2040,6,26}, {2040,6,27}, {2040,6,28}, {2040,6,29}, 
-{2040,6,30}, {2040,7,1}, {2040,7,2}, {2040,7,3}, {2040,7,4}, {2040,7,5}, {2040,7,6}, {2040,7,7}, {2040,7,8}, {2040,7,9}, {2040,7,10}, {2040,7,11}, {2040,7,12}, {2040,7,13}, {2040,7,14}, {2040,7,15}, {2040,7,16}, {2040,7,17}, {2040,7,18}, {2040,7,19}, {2040,7,20}, {2040,7,21}, {2040,7,22}, {2040,7,23}, {2040,7,24}, {2040,7,25}, {2040,7,26}, {2040,7,27}, {2040,7,28}, {2040,7,29}, {2040,7,30}, {2040,7,31}, 
-{2040,8,1}, {2040,8,2}, {2040,8,3}, {2040,8,4}, {2040,8,5}, {2040,8,6}, {2040,8,7}, {2040,8,8}, {2040,8,9}, {2040,8,10}, {2040,8,11}, {2040,8,12}, {2040,8,13}, {2040,8,14}, {2040,8,15}, {2040,8,16}, {2040,8,17}, {2040,8,18}, {2040,8,19}, {2040,8,20}, {2040,8,21}, {2040,8,22}, {2040,8,23}, {2040,8,24}, {2040,8,25}, {2040,8,26}, {2040,8,27}, {2040,8,28}, {2040,8,29}, {2040,8,30}, {2040,8,31}, {2040,9,1}, 
-{2040,9,2}, {2040,9,3}, {2040,9,4}, {2040,9,5}, {2040,9,6}, {2040,9,7}, {2040,9,8}, {2040,9,9}, {2040,9,10}, {2040,9,11}, {2040,9,12}, {2040,9,13}, {2040,9,14}, {2040,9,15}, {2040,9,16}, {2040,9,17}, {2040,9,18}, {2040,9,19}, {2040,9,20}, {2040,9,21}, {2040,9,22}, {2040,9,23}, {2040,9,24}, {2040,9,25}, {2040,9,26}, {2040,9,27}, {2040,9,28}, {2040,9,29}, {2040,9,30}, {2040,10,1}, {2040,10,2}, {2040,10,3}, 
-{2040,10,4}, {2040,10,5}, {2040,10,6}, {2040,10,7}, {2040,10,8}, {2040,10,9}, {2040,10,10}, {2040,10,11}, {2040,10,12}, {2040,10,13}, {2040,10,14}, {2040,10,15}, {2040,10,16}, {2040,10,17}, {2040,10,18}, {2040,10,19}, {2040,10,20}, {2040,10,21}, {2040,10,22}, {2040,10,23}, {2040,10,24}, {2040,10,25}, {2040,10,26}, {2040,10,27}, {2040,10,28}, {2040,10,29}, {2040,10,30}, {2040,10,31}, {2040,11,1}, {2040,11,2}, {2040,11,3}, {2040,11,4}, 
-{2040,11,5}, {2040,11,6}, {2040,11,7}, {2040,11,8}, {2040,11,9}, {2040,11,10}, {2040,11,11}, {2040,11,12}, {2040,11,13}, {2040,11,14}, {2040,11,15}, {2040,11,16}, {2040,11,17}, {2040,11,18}, {2040,11,19}, {2040,11,20}, {2040,11,21}, {2040,11,22}, {2040,11,23}, {2040,11,24}, {2040,11,25}, {2040,11,26}, {2040,11,27}, {2040,11,28}, {2040,11,29}, {2040,11,30}, {2040,12,1}, {2040,12,2}, {2040,12,3}, {2040,12,4}, {2040,12,5}, {2040,12,6}, 
-{2040,12,7}, {2040,12,8}, {2040,12,9}, {2040,12,10}, {2040,12,11}, {2040,12,12}, {2040,12,13}, {2040,12,14}, {2040,12,15}, {2040,12,16}, {2040,12,17}, {2040,12,18}, {2040,12,19}, {2040,12,20}, {2040,12,21}, {2040,12,22}, {2040,12,23}, {2040,12,24}, {2040,12,25}, {2040,12,26}, {2040,12,27}, {2040,12,28}, {2040,12,29}, {2040,12,30}, {2040,12,31}, {2041,1,1}, {2041,1,2}, {2041,1,3}, {2041,1,4}, {2041,1,5}, {2041,1,6}, {2041,1,7}, 
-{2041,1,8}, {2041,1,9}, {2041,1,10}, {2041,1,11}, {2041,1,12}, {2041,1,13}, {2041,1,14}, {2041,1,15}, {2041,1,16}, {2041,1,17}, {2041,1,18}, {2041,1,19}, {2041,1,20}, {2041,1,21}, {2041,1,22}, {2041,1,23}, {2041,1,24}, {2041,1,25}, {2041,1,26}, {2041,1,27}, {2041,1,28}, {2041,1,29}, {2041,1,30}, {2041,1,31}, {2041,2,1}, {2041,2,2}, {2041,2,3}, {2041,2,4}, {2041,2,5}, {2041,2,6}, {2041,2,7}, {2041,2,8}, 
-{2041,2,9}, {2041,2,10}, {2041,2,11}, {2041,2,12}, {2041,2,13}, {2041,2,14}, {2041,2,15}, {2041,2,16}, {2041,2,17}, {2041,2,18}, {2041,2,19}, {2041,2,20}, {2041,2,21}, {2041,2,22}, {2041,2,23}, {2041,2,24}, {2041,2,25}, {2041,2,26}, {2041,2,27}, {2041,2,28}, {2041,3,1}, {2041,3,2}, {2041,3,3}, {2041,3,4}, {2041,3,5}, {2041,3,6}, {2041,3,7}, {2041,3,8}, {2041,3,9}, {2041,3,10}, {2041,3,11}, {2041,3,12}, 
-{2041,3,13}, {2041,3,14}, {2041,3,15}, {2041,3,16}, {2041,3,17}, {2041,3,18}, {2041,3,19}, {2041,3,20}, {2041,3,21}, {2041,3,22}, {2041,3,23}, {2041,3,24}, {2041,3,25}, {2041,3,26}, {2041,3,27}, {2041,3,28}, {2041,3,29}, {2041,3,30}, {2041,3,31}, {2041,4,1}, {2041,4,2}, {2041,4,3}, {2041,4,4}, {2041,4,5}, {2041,4,6}, {2041,4,7}, {2041,4,8}, {2041,4,9}, {2041,4,10}, {2041,4,11}, {2041,4,12}, {2041,4,13}, 
-{2041,4,14}, {2041,4,15}, {2041,4,16}, {2041,4,17}, {2041,4,18}, {2041,4,19}, {2041,4,20}, {2041,4,21}, {2041,4,22}, {2041,4,23}, {2041,4,24}, {2041,4,25}, {2041,4,26}, {2041,4,27}, {2041,4,28}, {2041,4,29}, {2041,4,30}, {2041,5,1}, {2041,5,2}, {2041,5,3}, {2041,5,4}, {2041,5,5}, {2041,5,6}, {2041,5,7}, {2041,5,8}, {2041,5,9}, {2041,5,10}, {2041,5,11}, {2041,5,12}, {2041,5,13}, {2041,5,14}, {2041,5,15}, 
-{2041,5,16}, {2041,5,17}, {2041,5,18}, {2041,5,19}, {2041,5,20}, {2041,5,21}, {2041,5,22}, {2041,5,23}, {2041,5,24}, {2041,5,25}, {2041,5,26}, {2041,5,27}, {2041,5,28}, {2041,5,29}, {2041,5,30}, {2041,5,31}, {2041,6,1}, {2041,6,2}, {2041,6,3}, {2041,6,4}, {2041,6,5}, {2041,6,6}, {2041,6,7}, {2041,6,8}, {2041,6,9}, {2041,6,10}, {2041,6,11}, {2041,6,12}, {2041,6,13}, {2041,6,14}, {2041,6,15}, {2041,6,16}, 
-{2041,6,17}, {2041,6,18}, {2041,6,19}, {2041,6,20}, {2041,6,21}, {2041,6,22}, {2041,6,23}, {2041,6,24}, {2041,6,25}, {2041,6,26}, {2041,6,27}, {2041,6,28}, {2041,6,29}, {2041,6,30}, {2041,7,1}, {2041,7,2}, {2041,7,3}, {2041,7,4}, {2041,7,5}, {2041,7,6}, {2041,7,7}, {2041,7,8}, {2041,7,9}, {2041,7,10}, {2041,7,11}, {2041,7,12}, {2041,7,13}, {2041,7,14}, {2041,7,15}, {2041,7,16}, {2041,7,17}, {2041,7,18}, 
-{2041,7,19}, {2041,7,20}, {2041,7,21}, {2041,7,22}, {2041,7,23}, {2041,7,24}, {2041,7,25}, {2041,7,26}, {2041,7,27}, {2041,7,28}, {2041,7,29}, {2041,7,30}, {2041,7,31}, {2041,8,1}, {2041,8,2}, {2041,8,3}, {2041,8,4}, {2041,8,5}, {2041,8,6}, {2041,8,7}, {2041,8,8}, {2041,8,9}, {2041,8,10}, {2041,8,11}, {2041,8,12}, {2041,8,13}, {2041,8,14}, {2041,8,15}, {2041,8,16}, {2041,8,17}, {2041,8,18}, {2041,8,19}, 
-{2041,8,20}, {2041,8,21}, {2041,8,22}, {2041,8,23}, {2041,8,24}, {2041,8,25}, {2041,8,26}, {2041,8,27}, {2041,8,28}, {2041,8,29}, {2041,8,30}, {2041,8,31}, {2041,9,1}, {2041,9,2}, {2041,9,3}, {2041,9,4}, {2041,9,5}, {2041,9,6}, {2041,9,7}, {2041,9,8}, {2041,9,9}, {2041,9,10}, {2041,9,11}, {2041,9,12}, {2041,9,13}, {2041,9,14}, {2041,9,15}, {2041,9,16}, {2041,9,17}, {2041,9,18}, {2041,9,19}, {2041,9,20}, 
-{2041,9,21}, {2041,9,22}, {2041,9,23}, {2041,9,24}, {2041,9,25}, {2041,9,26}, {2041,9,27}, {2041,9,28}, {2041,9,29}, {2041,9,30}, {2041,10,1}, {2041,10,2}, {2041,10,3}, {2041,10,4}, {2041,10,5}, {2041,10,6}, {2041,10,7}, {2041,10,8}, {2041,10,9}, {2041,10,10}, {2041,10,11}, {2041,10,12}, {2041,10,13}, {2041,10,14}, {2041,10,15}, {2041,10,16}, {2041,10,17}, {2041,10,18}, {2041,10,19}, {2041,10,20}, {2041,10,21}, {2041,10,22}, 
-{2041,10,23}, {2041,10,24}, {2041,10,25}, {2041,10,26}, {2041,10,27}, {2041,10,28}, {2041,10,29}, {2041,10,30}, {2041,10,31}, {2041,11,1}, {2041,11,2}, {2041,11,3}, {2041,11,4}, {2041,11,5}, {2041,11,6}, {2041,11,7}, {2041,11,8}, {2041,11,9}, {2041,11,10}, {2041,11,11}, {2041,11,12}, {2041,11,13}, {2041,11,14}, {2041,11,15}, {2041,11,16}, {2041,11,17}, {2041,11,18}, {2041,11,19}, {2041,11,20}, {2041,11,21}, {2041,11,22}, {2041,11,23}, 
-{2041,11,24}, {2041,11,25}, {2041,11,26}, {2041,11,27}, {2041,11,28}, {2041,11,29}, {2041,11,30}, {2041,12,1}, {2041,12,2}, {2041,12,3}, {2041,12,4}, {2041,12,5}, {2041,12,6}, {2041,12,7}, {2041,12,8}, {2041,12,9}, {2041,12,10}, {2041,12,11}, {2041,12,12}, {2041,12,13}, {2041,12,14}, {2041,12,15}, {2041,12,16}, {2041,12,17}, {2041,12,18}, {2041,12,19}, {2041,12,20}, {2041,12,21}, {2041,12,22}, {2041,12,23}, {2041,12,24}, {2041,12,25}, 
-{2041,12,26}, {2041,12,27}, {2041,12,28}, {2041,12,29}, {2041,12,30}, {2041,12,31}, {2042,1,1}, {2042,1,2}, {2042,1,3}, {2042,1,4}, {2042,1,5}, {2042,1,6}, {2042,1,7}, {2042,1,8}, {2042,1,9}, {2042,1,10}, {2042,1,11}, {2042,1,12}, {2042,1,13}, {2042,1,14}, {2042,1,15}, {2042,1,16}, {2042,1,17}, {2042,1,18}, {2042,1,19}, {2042,1,20}, {2042,1,21}, {2042,1,22}, {2042,1,23}, {2042,1,24}, {2042,1,25}, {2042,1,26}, 
-{2042,1,27}, {2042,1,28}, {2042,1,29}, {2042,1,30}, {2042,1,31}, {2042,2,1}, {2042,2,2}, {2042,2,3}, {2042,2,4}, {2042,2,5}, {2042,2,6}, {2042,2,7}, {2042,2,8}, {2042,2,9}, {2042,2,10}, {2042,2,11}, {2042,2,12}, {2042,2,13}, {2042,2,14}, {2042,2,15}, {2042,2,16}, {2042,2,17}, {2042,2,18}, {2042,2,19}, {2042,2,20}, {2042,2,21}, {2042,2,22}, {2042,2,23}, {2042,2,24}, {2042,2,25}, {2042,2,26}, {2042,2,27}, 
-{2042,2,28}, {2042,3,1}, {2042,3,2}, {2042,3,3}, {2042,3,4}, {2042,3,5}, {2042,3,6}, {2042,3,7}, {2042,3,8}, {2042,3,9}, {2042,3,10}, {2042,3,11}, {2042,3,12}, {2042,3,13}, {2042,3,14}, {2042,3,15}, {2042,3,16}, {2042,3,17}, {2042,3,18}, {2042,3,19}, {2042,3,20}, {2042,3,21}, {2042,3,22}, {2042,3,23}, {2042,3,24}, {2042,3,25}, {2042,3,26}, {2042,3,27}, {2042,3,28}, {2042,3,29}, {2042,3,30}, {2042,3,31}, 
-{2042,4,1}, {2042,4,2}, {2042,4,3}, {2042,4,4}, {2042,4,5}, {2042,4,6}, {2042,4,7}, {2042,4,8}, {2042,4,9}, {2042,4,10}, {2042,4,11}, {2042,4,12}, {2042,4,13}, {2042,4,14}, {2042,4,15}, {2042,4,16}, {2042,4,17}, {2042,4,18}, {2042,4,19}, {2042,4,20}, {2042,4,21}, {2042,4,22}, {2042,4,23}, {2042,4,24}, {2042,4,25}, {2042,4,26}, {2042,4,27}, {2042,4,28}, {2042,4,29}, {2042,4,30}, {2042,5,1}, {2042,5,2}, 
-{2042,5,3}, {2042,5,4}, {2042,5,5}, {2042,5,6}, {2042,5,7}, {2042,5,8}, {2042,5,9}, {2042,5,10}, {2042,5,11}, {2042,5,12}, {2042,5,13}, {2042,5,14}, {2042,5,15}, {2042,5,16}, {2042,5,17}, {2042,5,18}, {2042,5,19}, {2042,5,20}, {2042,5,21}, {2042,5,22}, {2042,5,23}, {2042,5,24}, {2042,5,25}, {2042,5,26}, {2042,5,27}, {2042,5,28}, {2042,5,29}, {2042,5,30}, {2042,5,31}, {2042,6,1}, {2042,6,2}, {2042,6,3}, 
-{2042,6,4}, {2042,6,5}, {2042,6,6}, {2042,6,7}, {2042,6,8}, {2042,6,9}, {2042,6,10}, {2042,6,11}, {2042,6,12}, {2042,6,13}, {2042,6,14}, {2042,6,15}, {2042,6,16}, {2042,6,17}, {2042,6,18}, {2042,6,19}, {2042,6,20}, {2042,6,21}, {2042,6,22}, {2042,6,23}, {2042,6,24}, {2042,6,25}, {2042,6,26}, {2042,6,27}, {2042,6,28}, {2042,6,29}, {2042,6,30}, {2042,7,1}, {2042,7,2}, {2042,7,3}, {2042,7,4}, {2042,7,5}, 
-{2042,7,6}, {2042,7,7}, {2042,7,8}, {2042,7,9}, {2042,7,10}, {2042,7,11}, {2042,7,12}, {2042,7,13}, {2042,7,14}, {2042,7,15}, {2042,7,16}, {2042,7,17}, {2042,7,18}, {2042,7,19}, {2042,7,20}, {2042,7,21}, {2042,7,22}, {2042,7,23}, {2042,7,24}, {2042,7,25}, {2042,7,26}, {2042,7,27}, {2042,7,28}, {2042,7,29}, {2042,7,30}, {2042,7,31}, {2042,8,1}, {2042,8,2}, {2042,8,3}, {2042,8,4}, {2042,8,5}, {2042,8,6}, 
-{2042,8,7}, {2042,8,8}, {2042,8,9}, {2042,8,10}, {2042,8,11}, {2042,8,12}, {2042,8,13}, {2042,8,14}, {2042,8,15}, {2042,8,16}, {2042,8,17}, {2042,8,18}, {2042,8,19}, {2042,8,20}, {2042,8,21}, {2042,8,22}, {2042,8,23}, {2042,8,24}, {2042,8,25}, {2042,8,26}, {2042,8,27}, {2042,8,28}, {2042,8,29}, {2042,8,30}, {2042,8,31}, {2042,9,1}, {2042,9,2}, {2042,9,3}, {2042,9,4}, {2042,9,5}, {2042,9,6}, {2042,9,7}, 
-{2042,9,8}, {2042,9,9}, {2042,9,10}, {2042,9,11}, {2042,9,12}, {2042,9,13}, {2042,9,14}, {2042,9,15}, {2042,9,16}, {2042,9,17}, {2042,9,18}, {2042,9,19}, {2042,9,20}, {2042,9,21}, {2042,9,22}, {2042,9,23}, {2042,9,24}, {2042,9,25}, {2042,9,26}, {2042,9,27}, {2042,9,28}, {2042,9,29}, {2042,9,30}, {2042,10,1}, {2042,10,2}, {2042,10,3}, {2042,10,4}, {2042,10,5}, {2042,10,6}, {2042,10,7}, {2042,10,8}, {2042,10,9}, 
-{2042,10,10}, {2042,10,11}, {2042,10,12}, {2042,10,13}, {2042,10,14}, {2042,10,15}, {2042,10,16}, {2042,10,17}, {2042,10,18}, {2042,10,19}, {2042,10,20}, {2042,10,21}, {2042,10,22}, {2042,10,23}, {2042,10,24}, {2042,10,25}, {2042,10,26}, {2042,10,27}, {2042,10,28}, {2042,10,29}, {2042,10,30}, {2042,10,31}, {2042,11,1}, {2042,11,2}, {2042,11,3}, {2042,11,4}, {2042,11,5}, {2042,11,6}, {2042,11,7}, {2042,11,8}, {2042,11,9}, {2042,11,10}, 
-{2042,11,11}, {2042,11,12}, {2042,11,13}, {2042,11,14}, {2042,11,15}, {2042,11,16}, {2042,11,17}, {2042,11,18}, {2042,11,19}, {2042,11,20}, {2042,11,21}, {2042,11,22}, {2042,11,23}, {2042,11,24}, {2042,11,25}, {2042,11,26}, {2042,11,27}, {2042,11,28}, {2042,11,29}, {2042,11,30}, {2042,12,1}, {2042,12,2}, {2042,12,3}, {2042,12,4}, {2042,12,5}, {2042,12,6}, {2042,12,7}, {2042,12,8}, {2042,12,9}, {2042,12,10}, {2042,12,11}, {2042,12,12}, 
-{2042,12,13}, {2042,12,14}, {2042,12,15}, {2042,12,16}, {2042,12,17}, {2042,12,18}, {2042,12,19}, {2042,12,20}, {2042,12,21}, {2042,12,22}, {2042,12,23}, {2042,12,24}, {2042,12,25}, {2042,12,26}, {2042,12,27}, {2042,12,28}, {2042,12,29}, {2042,12,30}, {2042,12,31}, {2043,1,1}, {2043,1,2}, {2043,1,3}, {2043,1,4}, {2043,1,5}, {2043,1,6}, {2043,1,7}, {2043,1,8}, {2043,1,9}, {2043,1,10}, {2043,1,11}, {2043,1,12}, {2043,1,13}, 
-{2043,1,14}, {2043,1,15}, {2043,1,16}, {2043,1,17}, {2043,1,18}, {2043,1,19}, {2043,1,20}, {2043,1,21}, {2043,1,22}, {2043,1,23}, {2043,1,24}, {2043,1,25}, {2043,1,26}, {2043,1,27}, {2043,1,28}, {2043,1,29}, {2043,1,30}, {2043,1,31}, {2043,2,1}, {2043,2,2}, {2043,2,3}, {2043,2,4}, {2043,2,5}, {2043,2,6}, {2043,2,7}, {2043,2,8}, {2043,2,9}, {2043,2,10}, {2043,2,11}, {2043,2,12}, {2043,2,13}, {2043,2,14}, 
-{2043,2,15}, {2043,2,16}, {2043,2,17}, {2043,2,18}, {2043,2,19}, {2043,2,20}, {2043,2,21}, {2043,2,22}, {2043,2,23}, {2043,2,24}, {2043,2,25}, {2043,2,26}, {2043,2,27}, {2043,2,28}, {2043,3,1}, {2043,3,2}, {2043,3,3}, {2043,3,4}, {2043,3,5}, {2043,3,6}, {2043,3,7}, {2043,3,8}, {2043,3,9}, {2043,3,10}, {2043,3,11}, {2043,3,12}, {2043,3,13}, {2043,3,14}, {2043,3,15}, {2043,3,16}, {2043,3,17}, {2043,3,18}, 
-{2043,3,19}, {2043,3,20}, {2043,3,21}, {2043,3,22}, {2043,3,23}, {2043,3,24}, {2043,3,25}, {2043,3,26}, {2043,3,27}, {2043,3,28}, {2043,3,29}, {2043,3,30}, {2043,3,31}, {2043,4,1}, {2043,4,2}, {2043,4,3}, {2043,4,4}, {2043,4,5}, {2043,4,6}, {2043,4,7}, {2043,4,8}, {2043,4,9}, {2043,4,10}, {2043,4,11}, {2043,4,12}, {2043,4,13}, {2043,4,14}, {2043,4,15}, {2043,4,16}, {2043,4,17}, {2043,4,18}, {2043,4,19}, 
-{2043,4,20}, {2043,4,21}, {2043,4,22}, {2043,4,23}, {2043,4,24}, {2043,4,25}, {2043,4,26}, {2043,4,27}, {2043,4,28}, {2043,4,29}, {2043,4,30}, {2043,5,1}, {2043,5,2}, {2043,5,3}, {2043,5,4}, {2043,5,5}, {2043,5,6}, {2043,5,7}, {2043,5,8}, {2043,5,9}, {2043,5,10}, {2043,5,11}, {2043,5,12}, {2043,5,13}, {2043,5,14}, {2043,5,15}, {2043,5,16}, {2043,5,17}, {2043,5,18}, {2043,5,19}, {2043,5,20}, {2043,5,21}, 
-{2043,5,22}, {2043,5,23}, {2043,5,24}, {2043,5,25}, {2043,5,26}, {2043,5,27}, {2043,5,28}, {2043,5,29}, {2043,5,30}, {2043,5,31}, {2043,6,1}, {2043,6,2}, {2043,6,3}, {2043,6,4}, {2043,6,5}, {2043,6,6}, {2043,6,7}, {2043,6,8}, {2043,6,9}, {2043,6,10}, {2043,6,11}, {2043,6,12}, {2043,6,13}, {2043,6,14}, {2043,6,15}, {2043,6,16}, {2043,6,17}, {2043,6,18}, {2043,6,19}, {2043,6,20}, {2043,6,21}, {2043,6,22}, 
-{2043,6,23}, {2043,6,24}, {2043,6,25}, {2043,6,26}, {2043,6,27}, {2043,6,28}, {2043,6,29}, {2043,6,30}, {2043,7,1}, {2043,7,2}, {2043,7,3}, {2043,7,4}, {2043,7,5}, {2043,7,6}, {2043,7,7}, {2043,7,8}, {2043,7,9}, {2043,7,10}, {2043,7,11}, {2043,7,12}, {2043,7,13}, {2043,7,14}, {2043,7,15}, {2043,7,16}, {2043,7,17}, {2043,7,18}, {2043,7,19}, {2043,7,20}, {2043,7,21}, {2043,7,22}, {2043,7,23}, {2043,7,24}, 
-{2043,7,25}, {2043,7,26}, {2043,7,27}, {2043,7,28}, {2043,7,29}, {2043,7,30}, {2043,7,31}, {2043,8,1}, {2043,8,2}, {2043,8,3}, {2043,8,4}, {2043,8,5}, {2043,8,6}, {2043,8,7}, {2043,8,8}, {2043,8,9}, {2043,8,10}, {2043,8,11}, {2043,8,12}, {2043,8,13}, {2043,8,14}, {2043,8,15}, {2043,8,16}, {2043,8,17}, {2043,8,18}, {2043,8,19}, {2043,8,20}, {2043,8,21}, {2043,8,22}, {2043,8,23}, {2043,8,24}, {2043,8,25}, 
-{2043,8,26}, {2043,8,27}, {2043,8,28}, {2043,8,29}, {2043,8,30}, {2043,8,31}, {2043,9,1}, {2043,9,2}, {2043,9,3}, {2043,9,4}, {2043,9,5}, {2043,9,6}, {2043,9,7}, {2043,9,8}, {2043,9,9}, {2043,9,10}, {2043,9,11}, {2043,9,12}, {2043,9,13}, {2043,9,14}, {2043,9,15}, {2043,9,16}, {2043,9,17}, {2043,9,18}, {2043,9,19}, {2043,9,20}, {2043,9,21}, {2043,9,22}, {2043,9,23}, {2043,9,24}, {2043,9,25}, {2043,9,26}, 
-{2043,9,27}, {2043,9,28}, {2043,9,29}, {2043,9,30}, {2043,10,1}, {2043,10,2}, {2043,10,3}, {2043,10,4}, {2043,10,5}, {2043,10,6}, {2043,10,7}, {2043,10,8}, {2043,10,9}, {2043,10,10}, {2043,10,11}, {2043,10,12}, {2043,10,13}, {2043,10,14}, {2043,10,15}, {2043,10,16}, {2043,10,17}, {2043,10,18}, {2043,10,19}, {2043,10,20}, {2043,10,21}, {2043,10,22}, {2043,10,23}, {2043,10,24}, {2043,10,25}, {2043,10,26}, {2043,10,27}, {2043,10,28}, 
-{2043,10,29}, {2043,10,30}, {2043,10,31}, {2043,11,1}, {2043,11,2}, {2043,11,3}, {2043,11,4}, {2043,11,5}, {2043,11,6}, {2043,11,7}, {2043,11,8}, {2043,11,9}, {2043,11,10}, {2043,11,11}, {2043,11,12}, {2043,11,13}, {2043,11,14}, {2043,11,15}, {2043,11,16}, {2043,11,17}, {2043,11,18}, {2043,11,19}, {2043,11,20}, {2043,11,21}, {2043,11,22}, {2043,11,23}, {2043,11,24}, {2043,11,25}, {2043,11,26}, {2043,11,27}, {2043,11,28}, {2043,11,29}, 
-{2043,11,30}, {2043,12,1}, {2043,12,2}, {2043,12,3}, {2043,12,4}, {2043,12,5}, {2043,12,6}, {2043,12,7}, {2043,12,8}, {2043,12,9}, {2043,12,10}, {2043,12,11}, {2043,12,12}, {2043,12,13}, {2043,12,14}, {2043,12,15}, {2043,12,16}, {2043,12,17}, {2043,12,18}, {2043,12,19}, {2043,12,20}, {2043,12,21}, {2043,12,22}, {2043,12,23}, {2043,12,24}, {2043,12,25}, {2043,12,26}, {2043,12,27}, {2043,12,28}, {2043,12,29}, {2043,12,30}, {2043,12,31}, 
-{2044,1,1}, {2044,1,2}, {2044,1,3}, {2044,1,4}, {2044,1,5}, {2044,1,6}, {2044,1,7}, {2044,1,8}, {2044,1,9}, {2044,1,10}, {2044,1,11}, {2044,1,12}, {2044,1,13}, {2044,1,14}, {2044,1,15}, {2044,1,16}, {2044,1,17}, {2044,1,18}, {2044,1,19}, {2044,1,20}, {2044,1,21}, {2044,1,22}, {2044,1,23}, {2044,1,24}, {2044,1,25}, {2044,1,26}, {2044,1,27}, {2044,1,28}, {2044,1,29}, {2044,1,30}, {2044,1,31}, {2044,2,1}, 
-{2044,2,2}, {2044,2,3}, {2044,2,4}, {2044,2,5}, {2044,2,6}, {2044,2,7}, {2044,2,8}, {2044,2,9}, {2044,2,10}, {2044,2,11}, {2044,2,12}, {2044,2,13}, {2044,2,14}, {2044,2,15}, {2044,2,16}, {2044,2,17}, {2044,2,18}, {2044,2,19}, {2044,2,20}, {2044,2,21}, {2044,2,22}, {2044,2,23}, {2044,2,24}, {2044,2,25}, {2044,2,26}, {2044,2,27}, {2044,2,28}, {2044,2,29}, {2044,3,1}, {2044,3,2}, {2044,3,3}, {2044,3,4}, 
-{2044,3,5}, {2044,3,6}, {2044,3,7}, {2044,3,8}, {2044,3,9}, {2044,3,10}, {2044,3,11}, {2044,3,12}, {2044,3,13}, {2044,3,14}, {2044,3,15}, {2044,3,16}, {2044,3,17}, {2044,3,18}, {2044,3,19}, {2044,3,20}, {2044,3,21}, {2044,3,22}, {2044,3,23}, {2044,3,24}, {2044,3,25}, {2044,3,26}, {2044,3,27}, {2044,3,28}, {2044,3,29}, {2044,3,30}, {2044,3,31}, {2044,4,1}, {2044,4,2}, {2044,4,3}, {2044,4,4}, {2044,4,5}, 
-{2044,4,6}, {2044,4,7}, {2044,4,8}, {2044,4,9}, {2044,4,10}, {2044,4,11}, {2044,4,12}, {2044,4,13}, {2044,4,14}, {2044,4,15}, {2044,4,16}, {2044,4,17}, {2044,4,18}, {2044,4,19}, {2044,4,20}, {2044,4,21}, {2044,4,22}, {2044,4,23}, {2044,4,24}, {2044,4,25}, {2044,4,26}, {2044,4,27}, {2044,4,28}, {2044,4,29}, {2044,4,30}, {2044,5,1}, {2044,5,2}, {2044,5,3}, {2044,5,4}, {2044,5,5}, {2044,5,6}, {2044,5,7}, 
-{2044,5,8}, {2044,5,9}, {2044,5,10}, {2044,5,11}, {2044,5,12}, {2044,5,13}, {2044,5,14}, {2044,5,15}, {2044,5,16}, {2044,5,17}, {2044,5,18}, {2044,5,19}, {2044,5,20}, {2044,5,21}, {2044,5,22}, {2044,5,23}, {2044,5,24}, {2044,5,25}, {2044,5,26}, {2044,5,27}, {2044,5,28}, {2044,5,29}, {2044,5,30}, {2044,5,31}, {2044,6,1}, {2044,6,2}, {2044,6,3}, {2044,6,4}, {2044,6,5}, {2044,6,6}, {2044,6,7}, {2044,6,8}, 
-{2044,6,9}, {2044,6,10}, {2044,6,11}, {2044,6,12}, {2044,6,13}, {2044,6,14}, {2044,6,15}, {2044,6,16}, {2044,6,17}, {2044,6,18}, {2044,6,19}, {2044,6,20}, {2044,6,21}, {2044,6,22}, {2044,6,23}, {2044,6,24}, {2044,6,25}, {2044,6,26}, {2044,6,27}, {2044,6,28}, {2044,6,29}, {2044,6,30}, {2044,7,1}, {2044,7,2}, {2044,7,3}, {2044,7,4}, {2044,7,5}, {2044,7,6}, {2044,7,7}, {2044,7,8}, {2044,7,9}, {2044,7,10}, 
-{2044,7,11}, {2044,7,12}, {2044,7,13}, {2044,7,14}, {2044,7,15}, {2044,7,16}, {2044,7,17}, {2044,7,18}, {2044,7,19}, {2044,7,20}, {2044,7,21}, {2044,7,22}, {2044,7,23}, {2044,7,24}, {2044,7,25}, {2044,7,26}, {2044,7,27}, {2044,7,28}, {2044,7,29}, {2044,7,30}, {2044,7,31}, {2044,8,1}, {2044,8,2}, {2044,8,3}, {2044,8,4}, {2044,8,5}, {2044,8,6}, {2044,8,7}, {2044,8,8}, {2044,8,9}, {2044,8,10}, {2044,8,11}, 
-{2044,8,12}, {2044,8,13}, {2044,8,14}, {2044,8,15}, {2044,8,16}, {2044,8,17}, {2044,8,18}, {2044,8,19}, {2044,8,20}, {2044,8,21}, {2044,8,22}, {2044,8,23}, {2044,8,24}, {2044,8,25}, {2044,8,26}, {2044,8,27}, {2044,8,28}, {2044,8,29}, {2044,8,30}, {2044,8,31}, {2044,9,1}, {2044,9,2}, {2044,9,3}, {2044,9,4}, {2044,9,5}, {2044,9,6}, {2044,9,7}, {2044,9,8}, {2044,9,9}, {2044,9,10}, {2044,9,11}, {2044,9,12}, 
-{2044,9,13}, {2044,9,14}, {2044,9,15}, {2044,9,16}, {2044,9,17}, {2044,9,18}, {2044,9,19}, {2044,9,20}, {2044,9,21}, {2044,9,22}, {2044,9,23}, {2044,9,24}, {2044,9,25}, {2044,9,26}, {2044,9,27}, {2044,9,28}, {2044,9,29}, {2044,9,30}, {2044,10,1}, {2044,10,2}, {2044,10,3}, {2044,10,4}, {2044,10,5}, {2044,10,6}, {2044,10,7}, {2044,10,8}, {2044,10,9}, {2044,10,10}, {2044,10,11}, {2044,10,12}, {2044,10,13}, {2044,10,14}, 
-{2044,10,15}, {2044,10,16}, {2044,10,17}, {2044,10,18}, {2044,10,19}, {2044,10,20}, {2044,10,21}, {2044,10,22}, {2044,10,23}, {2044,10,24}, {2044,10,25}, {2044,10,26}, {2044,10,27}, {2044,10,28}, {2044,10,29}, {2044,10,30}, {2044,10,31}, {2044,11,1}, {2044,11,2}, {2044,11,3}, {2044,11,4}, {2044,11,5}, {2044,11,6}, {2044,11,7}, {2044,11,8}, {2044,11,9}, {2044,11,10}, {2044,11,11}, {2044,11,12}, {2044,11,13}, {2044,11,14}, {2044,11,15}, 
-{2044,11,16}, {2044,11,17}, {2044,11,18}, {2044,11,19}, {2044,11,20}, {2044,11,21}, {2044,11,22}, {2044,11,23}, {2044,11,24}, {2044,11,25}, {2044,11,26}, {2044,11,27}, {2044,11,28}, {2044,11,29}, {2044,11,30}, {2044,12,1}, {2044,12,2}, {2044,12,3}, {2044,12,4}, {2044,12,5}, {2044,12,6}, {2044,12,7}, {2044,12,8}, {2044,12,9}, {2044,12,10}, {2044,12,11}, {2044,12,12}, {2044,12,13}, {2044,12,14}, {2044,12,15}, {2044,12,16}, {2044,12,17}, 
-{2044,12,18}, {2044,12,19}, {2044,12,20}, {2044,12,21}, {2044,12,22}, {2044,12,23}, {2044,12,24}, {2044,12,25}, {2044,12,26}, {2044,12,27}, {2044,12,28}, {2044,12,29}, {2044,12,30}, {2044,12,31}, {2045,1,1}, {2045,1,2}, {2045,1,3}, {2045,1,4}, {2045,1,5}, {2045,1,6}, {2045,1,7}, {2045,1,8}, {2045,1,9}, {2045,1,10}, {2045,1,11}, {2045,1,12}, {2045,1,13}, {2045,1,14}, {2045,1,15}, {2045,1,16}, {2045,1,17}, {2045,1,18}, 
-{2045,1,19}, {2045,1,20}, {2045,1,21}, {2045,1,22}, {2045,1,23}, {2045,1,24}, {2045,1,25}, {2045,1,26}, {2045,1,27}, {2045,1,28}, {2045,1,29}, {2045,1,30}, {2045,1,31}, {2045,2,1}, {2045,2,2}, {2045,2,3}, {2045,2,4}, {2045,2,5}, {2045,2,6}, {2045,2,7}, {2045,2,8}, {2045,2,9}, {2045,2,10}, {2045,2,11}, {2045,2,12}, {2045,2,13}, {2045,2,14}, {2045,2,15}, {2045,2,16}, {2045,2,17}, {2045,2,18}, {2045,2,19}, 
-{2045,2,20}, {2045,2,21}, {2045,2,22}, {2045,2,23}, {2045,2,24}, {2045,2,25}, {2045,2,26}, {2045,2,27}, {2045,2,28}, {2045,3,1}, {2045,3,2}, {2045,3,3}, {2045,3,4}, {2045,3,5}, {2045,3,6}, {2045,3,7}, {2045,3,8}, {2045,3,9}, {2045,3,10}, {2045,3,11}, {2045,3,12}, {2045,3,13}, {2045,3,14}, {2045,3,15}, {2045,3,16}, {2045,3,17}, {2045,3,18}, {2045,3,19}, {2045,3,20}, {2045,3,21}, {2045,3,22}, {2045,3,23}, 
-{2045,3,24}, {2045,3,25}, {2045,3,26}, {2045,3,27}, {2045,3,28}, {2045,3,29}, {2045,3,30}, {2045,3,31}, {2045,4,1}, {2045,4,2}, {2045,4,3}, {2045,4,4}, {2045,4,5}, {2045,4,6}, {2045,4,7}, {2045,4,8}, {2045,4,9}, {2045,4,10}, {2045,4,11}, {2045,4,12}, {2045,4,13}, {2045,4,14}, {2045,4,15}, {2045,4,16}, {2045,4,17}, {2045,4,18}, {2045,4,19}, {2045,4,20}, {2045,4,21}, {2045,4,22}, {2045,4,23}, {2045,4,24}, 
-{2045,4,25}, {2045,4,26}, {2045,4,27}, {2045,4,28}, {2045,4,29}, {2045,4,30}, {2045,5,1}, {2045,5,2}, {2045,5,3}, {2045,5,4}, {2045,5,5}, {2045,5,6}, {2045,5,7}, {2045,5,8}, {2045,5,9}, {2045,5,10}, {2045,5,11}, {2045,5,12}, {2045,5,13}, {2045,5,14}, {2045,5,15}, {2045,5,16}, {2045,5,17}, {2045,5,18}, {2045,5,19}, {2045,5,20}, {2045,5,21}, {2045,5,22}, {2045,5,23}, {2045,5,24}, {2045,5,25}, {2045,5,26}, 
-{2045,5,27}, {2045,5,28}, {2045,5,29}, {2045,5,30}, {2045,5,31}, {2045,6,1}, {2045,6,2}, {2045,6,3}, {2045,6,4}, {2045,6,5}, {2045,6,6}, {2045,6,7}, {2045,6,8}, {2045,6,9}, {2045,6,10}, {2045,6,11}, {2045,6,12}, {2045,6,13}, {2045,6,14}, {2045,6,15}, {2045,6,16}, {2045,6,17}, {2045,6,18}, {2045,6,19}, {2045,6,20}, {2045,6,21}, {2045,6,22}, {2045,6,23}, {2045,6,24}, {2045,6,25}, {2045,6,26}, {2045,6,27}, 
-{2045,6,28}, {2045,6,29}, {2045,6,30}, {2045,7,1}, {2045,7,2}, {2045,7,3}, {2045,7,4}, {2045,7,5}, {2045,7,6}, {2045,7,7}, {2045,7,8}, {2045,7,9}, {2045,7,10}, {2045,7,11}, {2045,7,12}, {2045,7,13}, {2045,7,14}, {2045,7,15}, {2045,7,16}, {2045,7,17}, {2045,7,18}, {2045,7,19}, {2045,7,20}, {2045,7,21}, {2045,7,22}, {2045,7,23}, {2045,7,24}, {2045,7,25}, {2045,7,26}, {2045,7,27}, {2045,7,28}, {2045,7,29}, 
-{2045,7,30}, {2045,7,31}, {2045,8,1}, {2045,8,2}, {2045,8,3}, {2045,8,4}, {2045,8,5}, {2045,8,6}, {2045,8,7}, {2045,8,8}, {2045,8,9}, {2045,8,10}, {2045,8,11}, {2045,8,12}, {2045,8,13}, {2045,8,14}, {2045,8,15}, {2045,8,16}, {2045,8,17}, {2045,8,18}, {2045,8,19}, {2045,8,20}, {2045,8,21}, {2045,8,22}, {2045,8,23}, {2045,8,24}, {2045,8,25}, {2045,8,26}, {2045,8,27}, {2045,8,28}, {2045,8,29}, {2045,8,30}, 
-{2045,8,31}, {2045,9,1}, {2045,9,2}, {2045,9,3}, {2045,9,4}, {2045,9,5}, {2045,9,6}, {2045,9,7}, {2045,9,8}, {2045,9,9}, {2045,9,10}, {2045,9,11}, {2045,9,12}, {2045,9,13}, {2045,9,14}, {2045,9,15}, {2045,9,16}, {2045,9,17}, {2045,9,18}, {2045,9,19}, {2045,9,20}, {2045,9,21}, {2045,9,22}, {2045,9,23}, {2045,9,24}, {2045,9,25}, {2045,9,26}, {2045,9,27}, {2045,9,28}, {2045,9,29}, {2045,9,30}, {2045,10,1}, 
-{2045,10,2}, {2045,10,3}, {2045,10,4}, {2045,10,5}, {2045,10,6}, {2045,10,7}, {2045,10,8}, {2045,10,9}, {2045,10,10}, {2045,10,11}, {2045,10,12}, {2045,10,13}, {2045,10,14}, {2045,10,15}, {2045,10,16}, {2045,10,17}, {2045,10,18}, {2045,10,19}, {2045,10,20}, {2045,10,21}, {2045,10,22}, {2045,10,23}, {2045,10,24}, {2045,10,25}, {2045,10,26}, {2045,10,27}, {2045,10,28}, {2045,10,29}, {2045,10,30}, {2045,10,31}, {2045,11,1}, {2045,11,2}, 
-{2045,11,3}, {2045,11,4}, {2045,11,5}, {2045,11,6}, {2045,11,7}, {2045,11,8}, {2045,11,9}, {2045,11,10}, {2045,11,11}, {2045,11,12}, {2045,11,13}, {2045,11,14}, {2045,11,15}, {2045,11,16}, {2045,11,17}, {2045,11,18}, {2045,11,19}, {2045,11,20}, {2045,11,21}, {2045,11,22}, {2045,11,23}, {2045,11,24}, {2045,11,25}, {2045,11,26}, {2045,11,27}, {2045,11,28}, {2045,11,29}, {2045,11,30}, {2045,12,1}, {2045,12,2}, {2045,12,3}, {2045,12,4}, 
-{2045,12,5}, {2045,12,6}, {2045,12,7}, {2045,12,8}, {2045,12,9}, {2045,12,10}, {2045,12,11}, {2045,12,12}, {2045,12,13}, {2045,12,14}, {2045,12,15}, {2045,12,16}, {2045,12,17}, {2045,12,18}, {2045,12,19}, {2045,12,20}, {2045,12,21}, {2045,12,22}, {2045,12,23}, {2045,12,24}, {2045,12,25}, {2045,12,26}, {2045,12,27}, {2045,12,28}, {2045,12,29}, {2045,12,30}, {2045,12,31}, {2046,1,1}, {2046,1,2}, {2046,1,3}, {2046,1,4}, {2046,1,5}, 
-{2046,1,6}, {2046,1,7}, {2046,1,8}, {2046,1,9}, {2046,1,10}, {2046,1,11}, {2046,1,12}, {2046,1,13}, {2046,1,14}, {2046,1,15}, {2046,1,16}, {2046,1,17}, {2046,1,18}, {2046,1,19}, {2046,1,20}, {2046,1,21}, {2046,1,22}, {2046,1,23}, {2046,1,24}, {2046,1,25}, {2046,1,26}, {2046,1,27}, {2046,1,28}, {2046,1,29}, {2046,1,30}, {2046,1,31}, {2046,2,1}, {2046,2,2}, {2046,2,3}, {2046,2,4}, {2046,2,5}, {2046,2,6}, 
-{2046,2,7}, {2046,2,8}, {2046,2,9}, {2046,2,10}, {2046,2,11}, {2046,2,12}, {2046,2,13}, {2046,2,14}, {2046,2,15}, {2046,2,16}, {2046,2,17}, {2046,2,18}, {2046,2,19}, {2046,2,20}, {2046,2,21}, {2046,2,22}, {2046,2,23}, {2046,2,24}, {2046,2,25}, {2046,2,26}, {2046,2,27}, {2046,2,28}, {2046,3,1}, {2046,3,2}, {2046,3,3}, {2046,3,4}, {2046,3,5}, {2046,3,6}, {2046,3,7}, {2046,3,8}, {2046,3,9}, {2046,3,10}, 
-{2046,3,11}, {2046,3,12}, {2046,3,13}, {2046,3,14}, {2046,3,15}, {2046,3,16}, {2046,3,17}, {2046,3,18}, {2046,3,19}, {2046,3,20}, {2046,3,21}, {2046,3,22}, {2046,3,23}, {2046,3,24}, {2046,3,25}, {2046,3,26}, {2046,3,27}, {2046,3,28}, {2046,3,29}, {2046,3,30}, {2046,3,31}, {2046,4,1}, {2046,4,2}, {2046,4,3}, {2046,4,4}, {2046,4,5}, {2046,4,6}, {2046,4,7}, {2046,4,8}, {2046,4,9}, {2046,4,10}, {2046,4,11}, 
-{2046,4,12}, {2046,4,13}, {2046,4,14}, {2046,4,15}, {2046,4,16}, {2046,4,17}, {2046,4,18}, {2046,4,19}, {2046,4,20}, {2046,4,21}, {2046,4,22}, {2046,4,23}, {2046,4,24}, {2046,4,25}, {2046,4,26}, {2046,4,27}, {2046,4,28}, {2046,4,29}, {2046,4,30}, {2046,5,1}, {2046,5,2}, {2046,5,3}, {2046,5,4}, {2046,5,5}, {2046,5,6}, {2046,5,7}, {2046,5,8}, {2046,5,9}, {2046,5,10}, {2046,5,11}, {2046,5,12}, {2046,5,13}, 
-{2046,5,14}, {2046,5,15}, {2046,5,16}, {2046,5,17}, {2046,5,18}, {2046,5,19}, {2046,5,20}, {2046,5,21}, {2046,5,22}, {2046,5,23}, {2046,5,24}, {2046,5,25}, {2046,5,26}, {2046,5,27}, {2046,5,28}, {2046,5,29}, {2046,5,30}, {2046,5,31}, {2046,6,1}, {2046,6,2}, {2046,6,3}, {2046,6,4}, {2046,6,5}, {2046,6,6}, {2046,6,7}, {2046,6,8}, {2046,6,9}, {2046,6,10}, {2046,6,11}, {2046,6,12}, {2046,6,13}, {2046,6,14}, 
-{2046,6,15}, {2046,6,16}, {2046,6,17}, {2046,6,18}, {2046,6,19}, {2046,6,20}, {2046,6,21}, {2046,6,22}, {2046,6,23}, {2046,6,24}, {2046,6,25}, {2046,6,26}, {2046,6,27}, {2046,6,28}, {2046,6,29}, {2046,6,30}, {2046,7,1}, {2046,7,2}, {2046,7,3}, {2046,7,4}, {2046,7,5}, {2046,7,6}, {2046,7,7}, {2046,7,8}, {2046,7,9}, {2046,7,10}, {2046,7,11}, {2046,7,12}, {2046,7,13}, {2046,7,14}, {2046,7,15}, {2046,7,16}, 
-{2046,7,17}, {2046,7,18}, {2046,7,19}, {2046,7,20}, {2046,7,21}, {2046,7,22}, {2046,7,23}, {2046,7,24}, {2046,7,25}, {2046,7,26}, {2046,7,27}, {2046,7,28}, {2046,7,29}, {2046,7,30}, {2046,7,31}, {2046,8,1}, {2046,8,2}, {2046,8,3}, {2046,8,4}, {2046,8,5}, {2046,8,6}, {2046,8,7}, {2046,8,8}, {2046,8,9}, {2046,8,10}, {2046,8,11}, {2046,8,12}, {2046,8,13}, {2046,8,14}, {2046,8,15}, {2046,8,16}, {2046,8,17}, 
-{2046,8,18}, {2046,8,19}, {2046,8,20}, {2046,8,21}, {2046,8,22}, {2046,8,23}, {2046,8,24}, {2046,8,25}, {2046,8,26}, {2046,8,27}, {2046,8,28}, {2046,8,29}, {2046,8,30}, {2046,8,31}, {2046,9,1}, {2046,9,2}, {2046,9,3}, {2046,9,4}, {2046,9,5}, {2046,9,6}, {2046,9,7}, {2046,9,8}, {2046,9,9}, {2046,9,10}, {2046,9,11}, {2046,9,12}, {2046,9,13}, {2046,9,14}, {2046,9,15}, {2046,9,16}, {2046,9,17}, {2046,9,18}, 
-{2046,9,19}, {2046,9,20}, {2046,9,21}, {2046,9,22}, {2046,9,23}, {2046,9,24}, {2046,9,25}, {2046,9,26}, {2046,9,27}, {2046,9,28}, {2046,9,29}, {2046,9,30}, {2046,10,1}, {2046,10,2}, {2046,10,3}, {2046,10,4}, {2046,10,5}, {2046,10,6}, {2046,10,7}, {2046,10,8}, {2046,10,9}, {2046,10,10}, {2046,10,11}, {2046,10,12}, {2046,10,13}, {2046,10,14}, {2046,10,15}, {2046,10,16}, {2046,10,17}, {2046,10,18}, {2046,10,19}, {2046,10,20}, 
-{2046,10,21}, {2046,10,22}, {2046,10,23}, {2046,10,24}, {2046,10,25}, {2046,10,26}, {2046,10,27}, {2046,10,28}, {2046,10,29}, {2046,10,30}, {2046,10,31}, {2046,11,1}, {2046,11,2}, {2046,11,3}, {2046,11,4}, {2046,11,5}, {2046,11,6}, {2046,11,7}, {2046,11,8}, {2046,11,9}, {2046,11,10}, {2046,11,11}, {2046,11,12}, {2046,11,13}, {2046,11,14}, {2046,11,15}, {2046,11,16}, {2046,11,17}, {2046,11,18}, {2046,11,19}, {2046,11,20}, {2046,11,21}, 
-{2046,11,22}, {2046,11,23}, {2046,11,24}, {2046,11,25}, {2046,11,26}, {2046,11,27}, {2046,11,28}, {2046,11,29}, {2046,11,30}, {2046,12,1}, {2046,12,2}, {2046,12,3}, {2046,12,4}, {2046,12,5}, {2046,12,6}, {2046,12,7}, {2046,12,8}, {2046,12,9}, {2046,12,10}, {2046,12,11}, {2046,12,12}, {2046,12,13}, {2046,12,14}, {2046,12,15}, {2046,12,16}, {2046,12,17}, {2046,12,18}, {2046,12,19}, {2046,12,20}, {2046,12,21}, {2046,12,22}, {2046,12,23}, 
-{2046,12,24}, {2046,12,25}, {2046,12,26}, {2046,12,27}, {2046,12,28}, {2046,12,29}, {2046,12,30}, {2046,12,31}, {2047,1,1}, {2047,1,2}, {2047,1,3}, {2047,1,4}, {2047,1,5}, {2047,1,6}, {2047,1,7}, {2047,1,8}, {2047,1,9}, {2047,1,10}, {2047,1,11}, {2047,1,12}, {2047,1,13}, {2047,1,14}, {2047,1,15}, {2047,1,16}, {2047,1,17}, {2047,1,18}, {2047,1,19}, {2047,1,20}, {2047,1,21}, {2047,1,22}, {2047,1,23}, {2047,1,24}, 
-{2047,1,25}, {2047,1,26}, {2047,1,27}, {2047,1,28}, {2047,1,29}, {2047,1,30}, {2047,1,31}, {2047,2,1}, {2047,2,2}, {2047,2,3}, {2047,2,4}, {2047,2,5}, {2047,2,6}, {2047,2,7}, {2047,2,8}, {2047,2,9}, {2047,2,10}, {2047,2,11}, {2047,2,12}, {2047,2,13}, {2047,2,14}, {2047,2,15}, {2047,2,16}, {2047,2,17}, {2047,2,18}, {2047,2,19}, {2047,2,20}, {2047,2,21}, {2047,2,22}, {2047,2,23}, {2047,2,24}, {2047,2,25}, 
-{2047,2,26}, {2047,2,27}, {2047,2,28}, {2047,3,1}, {2047,3,2}, {2047,3,3}, {2047,3,4}, {2047,3,5}, {2047,3,6}, {2047,3,7}, {2047,3,8}, {2047,3,9}, {2047,3,10}, {2047,3,11}, {2047,3,12}, {2047,3,13}, {2047,3,14}, {2047,3,15}, {2047,3,16}, {2047,3,17}, {2047,3,18}, {2047,3,19}, {2047,3,20}, {2047,3,21}, {2047,3,22}, {2047,3,23}, {2047,3,24}, {2047,3,25}, {2047,3,26}, {2047,3,27}, {2047,3,28}, {2047,3,29}, 
-{2047,3,30}, {2047,3,31}, {2047,4,1}, {2047,4,2}, {2047,4,3}, {2047,4,4}, {2047,4,5}, {2047,4,6}, {2047,4,7}, {2047,4,8}, {2047,4,9}, {2047,4,10}, {2047,4,11}, {2047,4,12}, {2047,4,13}, {2047,4,14}, {2047,4,15}, {2047,4,16}, {2047,4,17}, {2047,4,18}, {2047,4,19}, {2047,4,20}, {2047,4,21}, {2047,4,22}, {2047,4,23}, {2047,4,24}, {2047,4,25}, {2047,4,26}, {2047,4,27}, {2047,4,28}, {2047,4,29}, {2047,4,30}, 
-{2047,5,1}, {2047,5,2}, {2047,5,3}, {2047,5,4}, {2047,5,5}, {2047,5,6}, {2047,5,7}, {2047,5,8}, {2047,5,9}, {2047,5,10}, {2047,5,11}, {2047,5,12}, {2047,5,13}, {2047,5,14}, {2047,5,15}, {2047,5,16}, {2047,5,17}, {2047,5,18}, {2047,5,19}, {2047,5,20}, {2047,5,21}, {2047,5,22}, {2047,5,23}, {2047,5,24}, {2047,5,25}, {2047,5,26}, {2047,5,27}, {2047,5,28}, {2047,5,29}, {2047,5,30}, {2047,5,31}, {2047,6,1}, 
-{2047,6,2}, {2047,6,3}, {2047,6,4}, {2047,6,5}, {2047,6,6}, {2047,6,7}, {2047,6,8}, {2047,6,9}, {2047,6,10}, {2047,6,11}, {2047,6,12}, {2047,6,13}, {2047,6,14}, {2047,6,15}, {2047,6,16}, {2047,6,17}, {2047,6,18}, {2047,6,19}, {2047,6,20}, {2047,6,21}, {2047,6,22}, {2047,6,23}, {2047,6,24}, {2047,6,25}, {2047,6,26}, {2047,6,27}, {2047,6,28}, {2047,6,29}, {2047,6,30}, {2047,7,1}, {2047,7,2}, {2047,7,3}, 
-{2047,7,4}, {2047,7,5}, {2047,7,6}, {2047,7,7}, {2047,7,8}, {2047,7,9}, {2047,7,10}, {2047,7,11}, {2047,7,12}, {2047,7,13}, {2047,7,14}, {2047,7,15}, {2047,7,16}, {2047,7,17}, {2047,7,18}, {2047,7,19}, {2047,7,20}, {2047,7,21}, {2047,7,22}, {2047,7,23}, {2047,7,24}, {2047,7,25}, {2047,7,26}, {2047,7,27}, {2047,7,28}, {2047,7,29}, {2047,7,30}, {2047,7,31}, {2047,8,1}, {2047,8,2}, {2047,8,3}, {2047,8,4}, 
-{2047,8,5}, {2047,8,6}, {2047,8,7}, {2047,8,8}, {2047,8,9}, {2047,8,10}, {2047,8,11}, {2047,8,12}, {2047,8,13}, {2047,8,14}, {2047,8,15}, {2047,8,16}, {2047,8,17}, {2047,8,18}, {2047,8,19}, {2047,8,20}, {2047,8,21}, {2047,8,22}, {2047,8,23}, {2047,8,24}, {2047,8,25}, {2047,8,26}, {2047,8,27}, {2047,8,28}, {2047,8,29}, {2047,8,30}, {2047,8,31}, {2047,9,1}, {2047,9,2}, {2047,9,3}, {2047,9,4}, {2047,9,5}, 
-{2047,9,6}, {2047,9,7}, {2047,9,8}, {2047,9,9}, {2047,9,10}, {2047,9,11}, {2047,9,12}, {2047,9,13}, {2047,9,14}, {2047,9,15}, {2047,9,16}, {2047,9,17}, {2047,9,18}, {2047,9,19}, {2047,9,20}, {2047,9,21}, {2047,9,22}, {2047,9,23}, {2047,9,24}, {2047,9,25}, {2047,9,26}, {2047,9,27}, {2047,9,28}, {2047,9,29}, {2047,9,30}, {2047,10,1}, {2047,10,2}, {2047,10,3}, {2047,10,4}, {2047,10,5}, {2047,10,6}, {2047,10,7}, 
-{2047,10,8}, {2047,10,9}, {2047,10,10}, {2047,10,11}, {2047,10,12}, {2047,10,13}, {2047,10,14}, {2047,10,15}, {2047,10,16}, {2047,10,17}, {2047,10,18}, {2047,10,19}, {2047,10,20}, {2047,10,21}, {2047,10,22}, {2047,10,23}, {2047,10,24}, {2047,10,25}, {2047,10,26}, {2047,10,27}, {2047,10,28}, {2047,10,29}, {2047,10,30}, {2047,10,31}, {2047,11,1}, {2047,11,2}, {2047,11,3}, {2047,11,4}, {2047,11,5}, {2047,11,6}, {2047,11,7}, {2047,11,8}, 
-{2047,11,9}, {2047,11,10}, {2047,11,11}, {2047,11,12}, {2047,11,13}, {2047,11,14}, {2047,11,15}, {2047,11,16}, {2047,11,17}, {2047,11,18}, {2047,11,19}, {2047,11,20}, {2047,11,21}, {2047,11,22}, {2047,11,23}, {2047,11,24}, {2047,11,25}, {2047,11,26}, {2047,11,27}, {2047,11,28}, {2047,11,29}, {2047,11,30}, {2047,12,1}, {2047,12,2}, {2047,12,3}, {2047,12,4}, {2047,12,5}, {2047,12,6}, {2047,12,7}, {2047,12,8}, {2047,12,9}, {2047,12,10}, 
-{2047,12,11}, {2047,12,12}, {2047,12,13}, {2047,12,14}, {2047,12,15}, {2047,12,16}, {2047,12,17}, {2047,12,18}, {2047,12,19}, {2047,12,20}, {2047,12,21}, {2047,12,22}, {2047,12,23}, {2047,12,24}, {2047,12,25}, {2047,12,26}, {2047,12,27}, {2047,12,28}, {2047,12,29}, {2047,12,30}, {2047,12,31}, {2048,1,1}, {2048,1,2}, {2048,1,3}, {2048,1,4}, {2048,1,5}, {2048,1,6}, {2048,1,7}, {2048,1,8}, {2048,1,9}, {2048,1,10}, {2048,1,11}, 
-{2048,1,12}, {2048,1,13}, {2048,1,14}, {2048,1,15}, {2048,1,16}, {2048,1,17}, {2048,1,18}, {2048,1,19}, {2048,1,20}, {2048,1,21}, {2048,1,22}, {2048,1,23}, {2048,1,24}, {2048,1,25}, {2048,1,26}, {2048,1,27}, {2048,1,28}, {2048,1,29}, {2048,1,30}, {2048,1,31}, {2048,2,1}, {2048,2,2}, {2048,2,3}, {2048,2,4}, {2048,2,5}, {2048,2,6}, {2048,2,7}, {2048,2,8}, {2048,2,9}, {2048,2,10}, {2048,2,11}, {2048,2,12}, 
-{2048,2,13}, {2048,2,14}, {2048,2,15}, {2048,2,16}, {2048,2,17}, {2048,2,18}, {2048,2,19}, {2048,2,20}, {2048,2,21}, {2048,2,22}, {2048,2,23}, {2048,2,24}, {2048,2,25}, {2048,2,26}, {2048,2,27}, {2048,2,28}, {2048,2,29}, {2048,3,1}, {2048,3,2}, {2048,3,3}, {2048,3,4}, {2048,3,5}, {2048,3,6}, {2048,3,7}, {2048,3,8}, {2048,3,9}, {2048,3,10}, {2048,3,11}, {2048,3,12}, {2048,3,13}, {2048,3,14}, {2048,3,15}, 
-{2048,3,16}, {2048,3,17}, {2048,3,18}, {2048,3,19}, {2048,3,20}, {2048,3,21}, {2048,3,22}, {2048,3,23}, {2048,3,24}, {2048,3,25}, {2048,3,26}, {2048,3,27}, {2048,3,28}, {2048,3,29}, {2048,3,30}, {2048,3,31}, {2048,4,1}, {2048,4,2}, {2048,4,3}, {2048,4,4}, {2048,4,5}, {2048,4,6}, {2048,4,7}, {2048,4,8}, {2048,4,9}, {2048,4,10}, {2048,4,11}, {2048,4,12}, {2048,4,13}, {2048,4,14}, {2048,4,15}, {2048,4,16}, 
-{2048,4,17}, {2048,4,18}, {2048,4,19}, {2048,4,20}, {2048,4,21}, {2048,4,22}, {2048,4,23}, {2048,4,24}, {2048,4,25}, {2048,4,26}, {2048,4,27}, {2048,4,28}, {2048,4,29}, {2048,4,30}, {2048,5,1}, {2048,5,2}, {2048,5,3}, {2048,5,4}, {2048,5,5}, {2048,5,6}, {2048,5,7}, {2048,5,8}, {2048,5,9}, {2048,5,10}, {2048,5,11}, {2048,5,12}, {2048,5,13}, {2048,5,14}, {2048,5,15}, {2048,5,16}, {2048,5,17}, {2048,5,18}, 
-{2048,5,19}, {2048,5,20}, {2048,5,21}, {2048,5,22}, {2048,5,23}, {2048,5,24}, {2048,5,25}, {2048,5,26}, {2048,5,27}, {2048,5,28}, {2048,5,29}, {2048,5,30}, {2048,5,31}, {2048,6,1}, {2048,6,2}, {2048,6,3}, {2048,6,4}, {2048,6,5}, {2048,6,6}, {2048,6,7}, {2048,6,8}, {2048,6,9}, {2048,6,10}, {2048,6,11}, {2048,6,12}, {2048,6,13}, {2048,6,14}, {2048,6,15}, {2048,6,16}, {2048,6,17}, {2048,6,18}, {2048,6,19}, 
-{2048,6,20}, {2048,6,21}, {2048,6,22}, {2048,6,23}, {2048,6,24}, {2048,6,25}, {2048,6,26}, {2048,6,27}, {2048,6,28}, {2048,6,29}, {2048,6,30}, {2048,7,1}, {2048,7,2}, {2048,7,3}, {2048,7,4}, {2048,7,5}, {2048,7,6}, {2048,7,7}, {2048,7,8}, {2048,7,9}, {2048,7,10}, {2048,7,11}, {2048,7,12}, {2048,7,13}, {2048,7,14}, {2048,7,15}, {2048,7,16}, {2048,7,17}, {2048,7,18}, {2048,7,19}, {2048,7,20}, {2048,7,21}, 
-{2048,7,22}, {2048,7,23}, {2048,7,24}, {2048,7,25}, {2048,7,26}, {2048,7,27}, {2048,7,28}, {2048,7,29}, {2048,7,30}, {2048,7,31}, {2048,8,1}, {2048,8,2}, {2048,8,3}, {2048,8,4}, {2048,8,5}, {2048,8,6}, {2048,8,7}, {2048,8,8}, {2048,8,9}, {2048,8,10}, {2048,8,11}, {2048,8,12}, {2048,8,13}, {2048,8,14}, {2048,8,15}, {2048,8,16}, {2048,8,17}, {2048,8,18}, {2048,8,19}, {2048,8,20}, {2048,8,21}, {2048,8,22}, 
-{2048,8,23}, {2048,8,24}, {2048,8,25}, {2048,8,26}, {2048,8,27}, {2048,8,28}, {2048,8,29}, {2048,8,30}, {2048,8,31}, {2048,9,1}, {2048,9,2}, {2048,9,3}, {2048,9,4}, {2048,9,5}, {2048,9,6}, {2048,9,7}, {2048,9,8}, {2048,9,9}, {2048,9,10}, {2048,9,11}, {2048,9,12}, {2048,9,13}, {2048,9,14}, {2048,9,15}, {2048,9,16}, {2048,9,17}, {2048,9,18}, {2048,9,19}, {2048,9,20}, {2048,9,21}, {2048,9,22}, {2048,9,23}, 
-{2048,9,24}, {2048,9,25}, {2048,9,26}, {2048,9,27}, {2048,9,28}, {2048,9,29}, {2048,9,30}, {2048,10,1}, {2048,10,2}, {2048,10,3}, {2048,10,4}, {2048,10,5}, {2048,10,6}, {2048,10,7}, {2048,10,8}, {2048,10,9}, {2048,10,10}, {2048,10,11}, {2048,10,12}, {2048,10,13}, {2048,10,14}, {2048,10,15}, {2048,10,16}, {2048,10,17}, {2048,10,18}, {2048,10,19}, {2048,10,20}, {2048,10,21}, {2048,10,22}, {2048,10,23}, {2048,10,24}, {2048,10,25}, 
-{2048,10,26}, {2048,10,27}, {2048,10,28}, {2048,10,29}, {2048,10,30}, {2048,10,31}, {2048,11,1}, {2048,11,2}, {2048,11,3}, {2048,11,4}, {2048,11,5}, {2048,11,6}, {2048,11,7}, {2048,11,8}, {2048,11,9}, {2048,11,10}, {2048,11,11}, {2048,11,12}, {2048,11,13}, {2048,11,14}, {2048,11,15}, {2048,11,16}, {2048,11,17}, {2048,11,18}, {2048,11,19}, {2048,11,20}, {2048,11,21}, {2048,11,22}, {2048,11,23}, {2048,11,24}, {2048,11,25}, {2048,11,26}, 
-{2048,11,27}, {2048,11,28}, {2048,11,29}, {2048,11,30}, {2048,12,1}, {2048,12,2}, {2048,12,3}, {2048,12,4}, {2048,12,5}, {2048,12,6}, {2048,12,7}, {2048,12,8}, {2048,12,9}, {2048,12,10}, {2048,12,11}, {2048,12,12}, {2048,12,13}, {2048,12,14}, {2048,12,15}, {2048,12,16}, {2048,12,17}, {2048,12,18}, {2048,12,19}, {2048,12,20}, {2048,12,21}, {2048,12,22}, {2048,12,23}, {2048,12,24}, {2048,12,25}, {2048,12,26}, {2048,12,27}, {2048,12,28}, 
-{2048,12,29}, {2048,12,30}, {2048,12,31}, {2049,1,1}, {2049,1,2}, {2049,1,3}, {2049,1,4}, {2049,1,5}, {2049,1,6}, {2049,1,7}, {2049,1,8}, {2049,1,9}, {2049,1,10}, {2049,1,11}, {2049,1,12}, {2049,1,13}, {2049,1,14}, {2049,1,15}, {2049,1,16}, {2049,1,17}, {2049,1,18}, {2049,1,19}, {2049,1,20}, {2049,1,21}, {2049,1,22}, {2049,1,23}, {2049,1,24}, {2049,1,25}, {2049,1,26}, {2049,1,27}, {2049,1,28}, {2049,1,29}, 
-{2049,1,30}, {2049,1,31}, {2049,2,1}, {2049,2,2}, {2049,2,3}, {2049,2,4}, {2049,2,5}, {2049,2,6}, {2049,2,7}, {2049,2,8}, {2049,2,9}, {2049,2,10}, {2049,2,11}, {2049,2,12}, {2049,2,13}, {2049,2,14}, {2049,2,15}, {2049,2,16}, {2049,2,17}, {2049,2,18}, {2049,2,19}, {2049,2,20}, {2049,2,21}, {2049,2,22}, {2049,2,23}, {2049,2,24}, {2049,2,25}, {2049,2,26}, {2049,2,27}, {2049,2,28}, {2049,3,1}, {2049,3,2}, 
-{2049,3,3}, {2049,3,4}, {2049,3,5}, {2049,3,6}, {2049,3,7}, {2049,3,8}, {2049,3,9}, {2049,3,10}, {2049,3,11}, {2049,3,12}, {2049,3,13}, {2049,3,14}, {2049,3,15}, {2049,3,16}, {2049,3,17}, {2049,3,18}, {2049,3,19}, {2049,3,20}, {2049,3,21}, {2049,3,22}, {2049,3,23}, {2049,3,24}, {2049,3,25}, {2049,3,26}, {2049,3,27}, {2049,3,28}, {2049,3,29}, {2049,3,30}, {2049,3,31}, {2049,4,1}, {2049,4,2}, {2049,4,3}, 
-{2049,4,4}, {2049,4,5}, {2049,4,6}, {2049,4,7}, {2049,4,8}, {2049,4,9}, {2049,4,10}, {2049,4,11}, {2049,4,12}, {2049,4,13}, {2049,4,14}, {2049,4,15}, {2049,4,16}, {2049,4,17}, {2049,4,18}, {2049,4,19}, {2049,4,20}, {2049,4,21}, {2049,4,22}, {2049,4,23}, {2049,4,24}, {2049,4,25}, {2049,4,26}, {2049,4,27}, {2049,4,28}, {2049,4,29}, {2049,4,30}, {2049,5,1}, {2049,5,2}, {2049,5,3}, {2049,5,4}, {2049,5,5}, 
-{2049,5,6}, {2049,5,7}, {2049,5,8}, {2049,5,9}, {2049,5,10}, {2049,5,11}, {2049,5,12}, {2049,5,13}, {2049,5,14}, {2049,5,15}, {2049,5,16}, {2049,5,17}, {2049,5,18}, {2049,5,19}, {2049,5,20}, {2049,5,21}, {2049,5,22}, {2049,5,23}, {2049,5,24}, {2049,5,25}, {2049,5,26}, {2049,5,27}, {2049,5,28}, {2049,5,29}, {2049,5,30}, {2049,5,31}, {2049,6,1}, {2049,6,2}, {2049,6,3}, {2049,6,4}, {2049,6,5}, {2049,6,6}, 
-{2049,6,7}, {2049,6,8}, {2049,6,9}, {2049,6,10}, {2049,6,11}, {2049,6,12}, {2049,6,13}, {2049,6,14}, {2049,6,15}, {2049,6,16}, {2049,6,17}, {2049,6,18}, {2049,6,19}, {2049,6,20}, {2049,6,21}, {2049,6,22}, {2049,6,23}, {2049,6,24}, {2049,6,25}, {2049,6,26}, {2049,6,27}, {2049,6,28}, {2049,6,29}, {2049,6,30}, {2049,7,1}, {2049,7,2}, {2049,7,3}, {2049,7,4}, {2049,7,5}, {2049,7,6}, {2049,7,7}, {2049,7,8}, 
-{2049,7,9}, {2049,7,10}, {2049,7,11}, {2049,7,12}, {2049,7,13}, {2049,7,14}, {2049,7,15}, {2049,7,16}, {2049,7,17}, {2049,7,18}, {2049,7,19}, {2049,7,20}, {2049,7,21}, {2049,7,22}, {2049,7,23}, {2049,7,24}, {2049,7,25}, {2049,7,26}, {2049,7,27}, {2049,7,28}, {2049,7,29}, {2049,7,30}, {2049,7,31}, {2049,8,1}, {2049,8,2}, {2049,8,3}, {2049,8,4}, {2049,8,5}, {2049,8,6}, {2049,8,7}, {2049,8,8}, {2049,8,9}, 
-{2049,8,10}, {2049,8,11}, {2049,8,12}, {2049,8,13}, {2049,8,14}, {2049,8,15}, {2049,8,16}, {2049,8,17}, {2049,8,18}, {2049,8,19}, {2049,8,20}, {2049,8,21}, {2049,8,22}, {2049,8,23}, {2049,8,24}, {2049,8,25}, {2049,8,26}, {2049,8,27}, {2049,8,28}, {2049,8,29}, {2049,8,30}, {2049,8,31}, {2049,9,1}, {2049,9,2}, {2049,9,3}, {2049,9,4}, {2049,9,5}, {2049,9,6}, {2049,9,7}, {2049,9,8}, {2049,9,9}, {2049,9,10}, 
-{2049,9,11}, {2049,9,12}, {2049,9,13}, {2049,9,14}, {2049,9,15}, {2049,9,16}, {2049,9,17}, {2049,9,18}, {2049,9,19}, {2049,9,20}, {2049,9,21}, {2049,9,22}, {2049,9,23}, {2049,9,24}, {2049,9,25}, {2049,9,26}, {2049,9,27}, {2049,9,28}, {2049,9,29}, {2049,9,30}, {2049,10,1}, {2049,10,2}, {2049,10,3}, {2049,10,4}, {2049,10,5}, {2049,10,6}, {2049,10,7}, {2049,10,8}, {2049,10,9}, {2049,10,10}, {2049,10,11}, {2049,10,12}, 
-{2049,10,13}, {2049,10,14}, {2049,10,15}, {2049,10,16}, {2049,10,17}, {2049,10,18}, {2049,10,19}, {2049,10,20}, {2049,10,21}, {2049,10,22}, {2049,10,23}, {2049,10,24}, {2049,10,25}, {2049,10,26}, {2049,10,27}, {2049,10,28}, {2049,10,29}, {2049,10,30}, {2049,10,31}, {2049,11,1}, {2049,11,2}, {2049,11,3}, {2049,11,4}, {2049,11,5}, {2049,11,6}, {2049,11,7}, {2049,11,8}, {2049,11,9}, {2049,11,10}, {2049,11,11}, {2049,11,12}, {2049,11,13}, 
-{2049,11,14}, {2049,11,15}, {2049,11,16}, {2049,11,17}, {2049,11,18}, {2049,11,19}, {2049,11,20}, {2049,11,21}, {2049,11,22}, {2049,11,23}, {2049,11,24}, {2049,11,25}, {2049,11,26}, {2049,11,27}, {2049,11,28}, {2049,11,29}, {2049,11,30}, {2049,12,1}, {2049,12,2}, {2049,12,3}, {2049,12,4}, {2049,12,5}, {2049,12,6}, {2049,12,7}, {2049,12,8}, {2049,12,9}, {2049,12,10}, {2049,12,11}, {2049,12,12}, {2049,12,13}, {2049,12,14}, {2049,12,15}, 
-{2049,12,16}, {2049,12,17}, {2049,12,18}, {2049,12,19}, {2049,12,20}, {2049,12,21}, {2049,12,22}, {2049,12,23}, {2049,12,24}, {2049,12,25}, {2049,12,26}, {2049,12,27}, {2049,12,28}, {2049,12,29}, {2049,12,30}, {2049,12,31}, {2050,1,1}, {2050,1,2}, {2050,1,3}, {2050,1,4}, {2050,1,5}, {2050,1,6}, {2050,1,7}, {2050,1,8}, {2050,1,9}, {2050,1,10}, {2050,1,11}, {2050,1,12}, {2050,1,13}, {2050,1,14}, {2050,1,15}, {2050,1,16}, 
-{2050,1,17}, {2050,1,18}, {2050,1,19}, {2050,1,20}, {2050,1,21}, {2050,1,22}, {2050,1,23}, {2050,1,24}, {2050,1,25}, {2050,1,26}, {2050,1,27}, {2050,1,28}, {2050,1,29}, {2050,1,30}, {2050,1,31}, {2050,2,1}, {2050,2,2}, {2050,2,3}, {2050,2,4}, {2050,2,5}, {2050,2,6}, {2050,2,7}, {2050,2,8}, {2050,2,9}, {2050,2,10}, {2050,2,11}, {2050,2,12}, {2050,2,13}, {2050,2,14}, {2050,2,15}, {2050,2,16}, {2050,2,17}, 
-{2050,2,18}, {2050,2,19}, {2050,2,20}, {2050,2,21}, {2050,2,22}, {2050,2,23}, {2050,2,24}, {2050,2,25}, {2050,2,26}, {2050,2,27}, {2050,2,28}, {2050,3,1}, {2050,3,2}, {2050,3,3}, {2050,3,4}, {2050,3,5}, {2050,3,6}, {2050,3,7}, {2050,3,8}, {2050,3,9}, {2050,3,10}, {2050,3,11}, {2050,3,12}, {2050,3,13}, {2050,3,14}, {2050,3,15}, {2050,3,16}, {2050,3,17}, {2050,3,18}, {2050,3,19}, {2050,3,20}, {2050,3,21}, 
-{2050,3,22}, {2050,3,23}, {2050,3,24}, {2050,3,25}, {2050,3,26}, {2050,3,27}, {2050,3,28}, {2050,3,29}, {2050,3,30}, {2050,3,31}, {2050,4,1}, {2050,4,2}, {2050,4,3}, {2050,4,4}, {2050,4,5}, {2050,4,6}, {2050,4,7}, {2050,4,8}, {2050,4,9}, {2050,4,10}, {2050,4,11}, {2050,4,12}, {2050,4,13}, {2050,4,14}, {2050,4,15}, {2050,4,16}, {2050,4,17}, {2050,4,18}, {2050,4,19}, {2050,4,20}, {2050,4,21}, {2050,4,22}, 
-{2050,4,23}, {2050,4,24}, {2050,4,25}, {2050,4,26}, {2050,4,27}, {2050,4,28}, {2050,4,29}, {2050,4,30}, {2050,5,1}, {2050,5,2}, {2050,5,3}, {2050,5,4}, {2050,5,5}, {2050,5,6}, {2050,5,7}, {2050,5,8}, {2050,5,9}, {2050,5,10}, {2050,5,11}, {2050,5,12}, {2050,5,13}, {2050,5,14}, {2050,5,15}, {2050,5,16}, {2050,5,17}, {2050,5,18}, {2050,5,19}, {2050,5,20}, {2050,5,21}, {2050,5,22}, {2050,5,23}, {2050,5,24}, 
-{2050,5,25}, {2050,5,26}, {2050,5,27}, {2050,5,28}, {2050,5,29}, {2050,5,30}, {2050,5,31}, {2050,6,1}, {2050,6,2}, {2050,6,3}, {2050,6,4}, {2050,6,5}, {2050,6,6}, {2050,6,7}, {2050,6,8}, {2050,6,9}, {2050,6,10}, {2050,6,11}, {2050,6,12}, {2050,6,13}, {2050,6,14}, {2050,6,15}, {2050,6,16}, {2050,6,17}, {2050,6,18}, {2050,6,19}, {2050,6,20}, {2050,6,21}, {2050,6,22}, {2050,6,23}, {2050,6,24}, {2050,6,25}, 
-{2050,6,26}, {2050,6,27}, {2050,6,28}, {2050,6,29}, {2050,6,30}, {2050,7,1}, {2050,7,2}, {2050,7,3}, {2050,7,4}, {2050,7,5}, {2050,7,6}, {2050,7,7}, {2050,7,8}, {2050,7,9}, {2050,7,10}, {2050,7,11}, {2050,7,12}, {2050,7,13}, {2050,7,14}, {2050,7,15}, {2050,7,16}, {2050,7,17}, {2050,7,18}, {2050,7,19}, {2050,7,20}, {2050,7,21}, {2050,7,22}, {2050,7,23}, {2050,7,24}, {2050,7,25}, {2050,7,26}, {2050,7,27}, 
-{2050,7,28}, {2050,7,29}, {2050,7,30}, {2050,7,31}, {2050,8,1}, {2050,8,2}, {2050,8,3}, {2050,8,4}, {2050,8,5}, {2050,8,6}, {2050,8,7}, {2050,8,8}, {2050,8,9}, {2050,8,10}, {2050,8,11}, {2050,8,12}, {2050,8,13}, {2050,8,14}, {2050,8,15}, {2050,8,16}, {2050,8,17}, {2050,8,18}, {2050,8,19}, {2050,8,20}, {2050,8,21}, {2050,8,22}, {2050,8,23}, {2050,8,24}, {2050,8,25}, {2050,8,26}, {2050,8,27}, {2050,8,28}, 
-{2050,8,29}, {2050,8,30}, {2050,8,31}, {2050,9,1}, {2050,9,2}, {2050,9,3}, {2050,9,4}, {2050,9,5}, {2050,9,6}, {2050,9,7}, {2050,9,8}, {2050,9,9}, {2050,9,10}, {2050,9,11}, {2050,9,12}, {2050,9,13}, {2050,9,14}, {2050,9,15}, {2050,9,16}, {2050,9,17}, {2050,9,18}, {2050,9,19}, {2050,9,20}, {2050,9,21}, {2050,9,22}, {2050,9,23}, {2050,9,24}, {2050,9,25}, {2050,9,26}, {2050,9,27}, {2050,9,28}, {2050,9,29}, 
-{2050,9,30}, {2050,10,1}, {2050,10,2}, {2050,10,3}, {2050,10,4}, {2050,10,5}, {2050,10,6}, {2050,10,7}, {2050,10,8}, {2050,10,9}, {2050,10,10}, {2050,10,11}, {2050,10,12}, {2050,10,13}, {2050,10,14}, {2050,10,15}, {2050,10,16}, {2050,10,17}, {2050,10,18}, {2050,10,19}, {2050,10,20}, {2050,10,21}, {2050,10,22}, {2050,10,23}, {2050,10,24}, {2050,10,25}, {2050,10,26}, {2050,10,27}, {2050,10,28}, {2050,10,29}, {2050,10,30}, {2050,10,31}, 
-{2050,11,1}, {2050,11,2}, {2050,11,3}, {2050,11,4}, {2050,11,5}, {2050,11,6}, {2050,11,7}, {2050,11,8}, {2050,11,9}, {2050,11,10}, {2050,11,11}, {2050,11,12}, {2050,11,13}, {2050,11,14}, {2050,11,15}, {2050,11,16}, {2050,11,17}, {2050,11,18}, {2050,11,19}, {2050,11,20}, {2050,11,21}, {2050,11,22}, {2050,11,23}, {2050,11,24}, {2050,11,25}, {2050,11,26}, {2050,11,27}, {2050,11,28}, {2050,11,29}, {2050,11,30}, {2050,12,1}, {2050,12,2}, 
-{2050,12,3}, {2050,12,4}, {2050,12,5}, {2050,12,6}, {2050,12,7}, {2050,12,8}, {2050,12,9}, {2050,12,10}, {2050,12,11}, {2050,12,12}, {2050,12,13}, {2050,12,14}, {2050,12,15}, {2050,12,16}, {2050,12,17}, {2050,12,18}, {2050,12,19}, {2050,12,20}, {2050,12,21}, {2050,12,22}, {2050,12,23}, {2050,12,24}, {2050,12,25}, {2050,12,26}, {2050,12,27}, {2050,12,28}, {2050,12,29}, {2050,12,30}, {2050,12,31}, {2051,1,1}, {2051,1,2}, {2051,1,3}, 
-{2051,1,4}, {2051,1,5}, {2051,1,6}, {2051,1,7}, {2051,1,8}, {2051,1,9}, {2051,1,10}, {2051,1,11}, {2051,1,12}, {2051,1,13}, {2051,1,14}, {2051,1,15}, {2051,1,16}, {2051,1,17}, {2051,1,18}, {2051,1,19}, {2051,1,20}, {2051,1,21}, {2051,1,22}, {2051,1,23}, {2051,1,24}, {2051,1,25}, {2051,1,26}, {2051,1,27}, {2051,1,28}, {2051,1,29}, {2051,1,30}, {2051,1,31}, {2051,2,1}, {2051,2,2}, {2051,2,3}, {2051,2,4}, 
-{2051,2,5}, {2051,2,6}, {2051,2,7}, {2051,2,8}, {2051,2,9}, {2051,2,10}, {2051,2,11}, {2051,2,12}, {2051,2,13}, {2051,2,14}, {2051,2,15}, {2051,2,16}, {2051,2,17}, {2051,2,18}, {2051,2,19}, {2051,2,20}, {2051,2,21}, {2051,2,22}, {2051,2,23}, {2051,2,24}, {2051,2,25}, {2051,2,26}, {2051,2,27}, {2051,2,28}, {2051,3,1}, {2051,3,2}, {2051,3,3}, {2051,3,4}, {2051,3,5}, {2051,3,6}, {2051,3,7}, {2051,3,8}, 
-{2051,3,9}, {2051,3,10}, {2051,3,11}, {2051,3,12}, {2051,3,13}, {2051,3,14}, {2051,3,15}, {2051,3,16}, {2051,3,17}, {2051,3,18}, {2051,3,19}, {2051,3,20}, {2051,3,21}, {2051,3,22}, {2051,3,23}, {2051,3,24}, {2051,3,25}, {2051,3,26}, {2051,3,27}, {2051,3,28}, {2051,3,29}, {2051,3,30}, {2051,3,31}, {2051,4,1}, {2051,4,2}, {2051,4,3}, {2051,4,4}, {2051,4,5}, {2051,4,6}, {2051,4,7}, {2051,4,8}, {2051,4,9}, 
-{2051,4,10}, {2051,4,11}, {2051,4,12}, {2051,4,13}, {2051,4,14}, {2051,4,15}, {2051,4,16}, {2051,4,17}, {2051,4,18}, {2051,4,19}, {2051,4,20}, {2051,4,21}, {2051,4,22}, {2051,4,23}, {2051,4,24}, {2051,4,25}, {2051,4,26}, {2051,4,27}, {2051,4,28}, {2051,4,29}, {2051,4,30}, {2051,5,1}, {2051,5,2}, {2051,5,3}, {2051,5,4}, {2051,5,5}, {2051,5,6}, {2051,5,7}, {2051,5,8}, {2051,5,9}, {2051,5,10}, {2051,5,11}, 
-{2051,5,12}, {2051,5,13}, {2051,5,14}, {2051,5,15}, {2051,5,16}, {2051,5,17}, {2051,5,18}, {2051,5,19}, {2051,5,20}, {2051,5,21}, {2051,5,22}, {2051,5,23}, {2051,5,24}, {2051,5,25}, {2051,5,26}, {2051,5,27}, {2051,5,28}, {2051,5,29}, {2051,5,30}, {2051,5,31}, {2051,6,1}, {2051,6,2}, {2051,6,3}, {2051,6,4}, {2051,6,5}, {2051,6,6}, {2051,6,7}, {2051,6,8}, {2051,6,9}, {2051,6,10}, {2051,6,11}, {2051,6,12}, 
-{2051,6,13}, {2051,6,14}, {2051,6,15}, {2051,6,16}, {2051,6,17}, {2051,6,18}, {2051,6,19}, {2051,6,20}, {2051,6,21}, {2051,6,22}, {2051,6,23}, {2051,6,24}, {2051,6,25}, {2051,6,26}, {2051,6,27}, {2051,6,28}, {2051,6,29}, {2051,6,30}, {2051,7,1}, {2051,7,2}, {2051,7,3}, {2051,7,4}, {2051,7,5}, {2051,7,6}, {2051,7,7}, {2051,7,8}, {2051,7,9}, {2051,7,10}, {2051,7,11}, {2051,7,12}, {2051,7,13}, {2051,7,14}, 
-{2051,7,15}, {2051,7,16}, {2051,7,17}, {2051,7,18}, {2051,7,19}, {2051,7,20}, {2051,7,21}, {2051,7,22}, {2051,7,23}, {2051,7,24}, {2051,7,25}, {2051,7,26}, {2051,7,27}, {2051,7,28}, {2051,7,29}, {2051,7,30}, {2051,7,31}, {2051,8,1}, {2051,8,2}, {2051,8,3}, {2051,8,4}, {2051,8,5}, {2051,8,6}, {2051,8,7}, {2051,8,8}, {2051,8,9}, {2051,8,10}, {2051,8,11}, {2051,8,12}, {2051,8,13}, {2051,8,14}, {2051,8,15}, 
-{2051,8,16}, {2051,8,17}, {2051,8,18}, {2051,8,19}, {2051,8,20}, {2051,8,21}, {2051,8,22}, {2051,8,23}, {2051,8,24}, {2051,8,25}, {2051,8,26}, {2051,8,27}, {2051,8,28}, {2051,8,29}, {2051,8,30}, {2051,8,31}, {2051,9,1}, {2051,9,2}, {2051,9,3}, {2051,9,4}, {2051,9,5}, {2051,9,6}, {2051,9,7}, {2051,9,8}, {2051,9,9}, {2051,9,10}, {2051,9,11}, {2051,9,12}, {2051,9,13}, {2051,9,14}, {2051,9,15}, {2051,9,16}, 
-{2051,9,17}, {2051,9,18}, {2051,9,19}, {2051,9,20}, {2051,9,21}, {2051,9,22}, {2051,9,23}, {2051,9,24}, {2051,9,25}, {2051,9,26}, {2051,9,27}, {2051,9,28}, {2051,9,29}, {2051,9,30}, {2051,10,1}, {2051,10,2}, {2051,10,3}, {2051,10,4}, {2051,10,5}, {2051,10,6}, {2051,10,7}, {2051,10,8}, {2051,10,9}, {2051,10,10}, {2051,10,11}, {2051,10,12}, {2051,10,13}, {2051,10,14}, {2051,10,15}, {2051,10,16}, {2051,10,17}, {2051,10,18}, 
-{2051,10,19}, {2051,10,20}, {2051,10,21}, {2051,10,22}, {2051,10,23}, {2051,10,24}, {2051,10,25}, {2051,10,26}, {2051,10,27}, {2051,10,28}, {2051,10,29}, {2051,10,30}, {2051,10,31}, {2051,11,1}, {2051,11,2}, {2051,11,3}, {2051,11,4}, {2051,11,5}, {2051,11,6}, {2051,11,7}, {2051,11,8}, {2051,11,9}, {2051,11,10}, {2051,11,11}, {2051,11,12}, {2051,11,13}, {2051,11,14}, {2051,11,15}, {2051,11,16}, {2051,11,17}, {2051,11,18}, {2051,11,19}, 
-{2051,11,20}, {2051,11,21}, {2051,11,22}, {2051,11,23}, {2051,11,24}, {2051,11,25}, {2051,11,26}, {2051,11,27}, {2051,11,28}, {2051,11,29}, {2051,11,30}, {2051,12,1}, {2051,12,2}, {2051,12,3}, {2051,12,4}, {2051,12,5}, {2051,12,6}, {2051,12,7}, {2051,12,8}, {2051,12,9}, {2051,12,10}, {2051,12,11}, {2051,12,12}, {2051,12,13}, {2051,12,14}, {2051,12,15}, {2051,12,16}, {2051,12,17}, {2051,12,18}, {2051,12,19}, {2051,12,20}, {2051,12,21}, 
-{2051,12,22}, {2051,12,23}, {2051,12,24}, {2051,12,25}, {2051,12,26}, {2051,12,27}, {2051,12,28}, {2051,12,29}, {2051,12,30}, {2051,12,31}, {2052,1,1}, {2052,1,2}, {2052,1,3}, {2052,1,4}, {2052,1,5}, {2052,1,6}, {2052,1,7}, {2052,1,8}, {2052,1,9}, {2052,1,10}, {2052,1,11}, {2052,1,12}, {2052,1,13}, {2052,1,14}, {2052,1,15}, {2052,1,16}, {2052,1,17}, {2052,1,18}, {2052,1,19}, {2052,1,20}, {2052,1,21}, {2052,1,22}, 
-{2052,1,23}, {2052,1,24}, {2052,1,25}, {2052,1,26}, {2052,1,27}, {2052,1,28}, {2052,1,29}, {2052,1,30}, {2052,1,31}, {2052,2,1}, {2052,2,2}, {2052,2,3}, {2052,2,4}, {2052,2,5}, {2052,2,6}, {2052,2,7}, {2052,2,8}, {2052,2,9}, {2052,2,10}, {2052,2,11}, {2052,2,12}, {2052,2,13}, {2052,2,14}, {2052,2,15}, {2052,2,16}, {2052,2,17}, {2052,2,18}, {2052,2,19}, {2052,2,20}, {2052,2,21}, {2052,2,22}, {2052,2,23}, 
-{2052,2,24}, {2052,2,25}, {2052,2,26}, {2052,2,27}, {2052,2,28}, {2052,2,29}, {2052,3,1}, {2052,3,2}, {2052,3,3}, {2052,3,4}, {2052,3,5}, {2052,3,6}, {2052,3,7}, {2052,3,8}, {2052,3,9}, {2052,3,10}, {2052,3,11}, {2052,3,12}, {2052,3,13}, {2052,3,14}, {2052,3,15}, {2052,3,16}, {2052,3,17}, {2052,3,18}, {2052,3,19}, {2052,3,20}, {2052,3,21}, {2052,3,22}, {2052,3,23}, {2052,3,24}, {2052,3,25}, {2052,3,26}, 
-{2052,3,27}, {2052,3,28}, {2052,3,29}, {2052,3,30}, {2052,3,31}, {2052,4,1}, {2052,4,2}, {2052,4,3}, {2052,4,4}, {2052,4,5}, {2052,4,6}, {2052,4,7}, {2052,4,8}, {2052,4,9}, {2052,4,10}, {2052,4,11}, {2052,4,12}, {2052,4,13}, {2052,4,14}, {2052,4,15}, {2052,4,16}, {2052,4,17}, {2052,4,18}, {2052,4,19}, {2052,4,20}, {2052,4,21}, {2052,4,22}, {2052,4,23}, {2052,4,24}, {2052,4,25}, {2052,4,26}, {2052,4,27}, 
-{2052,4,28}, {2052,4,29}, {2052,4,30}, {2052,5,1}, {2052,5,2}, {2052,5,3}, {2052,5,4}, {2052,5,5}, {2052,5,6}, {2052,5,7}, {2052,5,8}, {2052,5,9}, {2052,5,10}, {2052,5,11}, {2052,5,12}, {2052,5,13}, {2052,5,14}, {2052,5,15}, {2052,5,16}, {2052,5,17}, {2052,5,18}, {2052,5,19}, {2052,5,20}, {2052,5,21}, {2052,5,22}, {2052,5,23}, {2052,5,24}, {2052,5,25}, {2052,5,26}, {2052,5,27}, {2052,5,28}, {2052,5,29}, 
-{2052,5,30}, {2052,5,31}, {2052,6,1}, {2052,6,2}, {2052,6,3}, {2052,6,4}, {2052,6,5}, {2052,6,6}, {2052,6,7}, {2052,6,8}, {2052,6,9}, {2052,6,10}, {2052,6,11}, {2052,6,12}, {2052,6,13}, {2052,6,14}, {2052,6,15}, {2052,6,16}, {2052,6,17}, {2052,6,18}, {2052,6,19}, {2052,6,20}, {2052,6,21}, {2052,6,22}, {2052,6,23}, {2052,6,24}, {2052,6,25}, {2052,6,26}, {2052,6,27}, {2052,6,28}, {2052,6,29}, {2052,6,30}, 
-{2052,7,1}, {2052,7,2}, {2052,7,3}, {2052,7,4}, {2052,7,5}, {2052,7,6}, {2052,7,7}, {2052,7,8}, {2052,7,9}, {2052,7,10}, {2052,7,11}, {2052,7,12}, {2052,7,13}, {2052,7,14}, {2052,7,15}, {2052,7,16}, {2052,7,17}, {2052,7,18}, {2052,7,19}, {2052,7,20}, {2052,7,21}, {2052,7,22}, {2052,7,23}, {2052,7,24}, {2052,7,25}, {2052,7,26}, {2052,7,27}, {2052,7,28}, {2052,7,29}, {2052,7,30}, {2052,7,31}, {2052,8,1}, 
-{2052,8,2}, {2052,8,3}, {2052,8,4}, {2052,8,5}, {2052,8,6}, {2052,8,7}, {2052,8,8}, {2052,8,9}, {2052,8,10}, {2052,8,11}, {2052,8,12}, {2052,8,13}, {2052,8,14}, {2052,8,15}, {2052,8,16}, {2052,8,17}, {2052,8,18}, {2052,8,19}, {2052,8,20}, {2052,8,21}, {2052,8,22}, {2052,8,23}, {2052,8,24}, {2052,8,25}, {2052,8,26}, {2052,8,27}, {2052,8,28}, {2052,8,29}, {2052,8,30}, {2052,8,31}, {2052,9,1}, {2052,9,2}, 
-{2052,9,3}, {2052,9,4}, {2052,9,5}, {2052,9,6}, {2052,9,7}, {2052,9,8}, {2052,9,9}, {2052,9,10}, {2052,9,11}, {2052,9,12}, {2052,9,13}, {2052,9,14}, {2052,9,15}, {2052,9,16}, {2052,9,17}, {2052,9,18}, {2052,9,19}, {2052,9,20}, {2052,9,21}, {2052,9,22}, {2052,9,23}, {2052,9,24}, {2052,9,25}, {2052,9,26}, {2052,9,27}, {2052,9,28}, {2052,9,29}, {2052,9,30}, {2052,10,1}, {2052,10,2}, {2052,10,3}, {2052,10,4}, 
-{2052,10,5}, {2052,10,6}, {2052,10,7}, {2052,10,8}, {2052,10,9}, {2052,10,10}, {2052,10,11}, {2052,10,12}, {2052,10,13}, {2052,10,14}, {2052,10,15}, {2052,10,16}, {2052,10,17}, {2052,10,18}, {2052,10,19}, {2052,10,20}, {2052,10,21}, {2052,10,22}, {2052,10,23}, {2052,10,24}, {2052,10,25}, {2052,10,26}, {2052,10,27}, {2052,10,28}, {2052,10,29}, {2052,10,30}, {2052,10,31}, {2052,11,1}, {2052,11,2}, {2052,11,3}, {2052,11,4}, {2052,11,5}, 
-{2052,11,6}, {2052,11,7}, {2052,11,8}, {2052,11,9}, {2052,11,10}, {2052,11,11}, {2052,11,12}, {2052,11,13}, {2052,11,14}, {2052,11,15}, {2052,11,16}, {2052,11,17}, {2052,11,18}, {2052,11,19}, {2052,11,20}, {2052,11,21}, {2052,11,22}, {2052,11,23}, {2052,11,24}, {2052,11,25}, {2052,11,26}, {2052,11,27}, {2052,11,28}, {2052,11,29}, {2052,11,30}, {2052,12,1}, {2052,12,2}, {2052,12,3}, {2052,12,4}, {2052,12,5}, {2052,12,6}, {2052,12,7}, 
-{2052,12,8}, {2052,12,9}, {2052,12,10}, {2052,12,11}, {2052,12,12}, {2052,12,13}, {2052,12,14}, {2052,12,15}, {2052,12,16}, {2052,12,17}, {2052,12,18}, {2052,12,19}, {2052,12,20}, {2052,12,21}, {2052,12,22}, {2052,12,23}, {2052,12,24}, {2052,12,25}, {2052,12,26}, {2052,12,27}, {2052,12,28}, {2052,12,29}, {2052,12,30}, {2052,12,31}, {2053,1,1}, {2053,1,2}, {2053,1,3}, {2053,1,4}, {2053,1,5}, {2053,1,6}, {2053,1,7}, {2053,1,8}, 
-{2053,1,9}, {2053,1,10}, {2053,1,11}, {2053,1,12}, {2053,1,13}, {2053,1,14}, {2053,1,15}, {2053,1,16}, {2053,1,17}, {2053,1,18}, {2053,1,19}, {2053,1,20}, {2053,1,21}, {2053,1,22}, {2053,1,23}, {2053,1,24}, {2053,1,25}, {2053,1,26}, {2053,1,27}, {2053,1,28}, {2053,1,29}, {2053,1,30}, {2053,1,31}, {2053,2,1}, {2053,2,2}, {2053,2,3}, {2053,2,4}, {2053,2,5}, {2053,2,6}, {2053,2,7}, {2053,2,8}, {2053,2,9}, 
-{2053,2,10}, {2053,2,11}, {2053,2,12}, {2053,2,13}, {2053,2,14}, {2053,2,15}, {2053,2,16}, {2053,2,17}, {2053,2,18}, {2053,2,19}, {2053,2,20}, {2053,2,21}, {2053,2,22}, {2053,2,23}, {2053,2,24}, {2053,2,25}, {2053,2,26}, {2053,2,27}, {2053,2,28}, {2053,3,1}, {2053,3,2}, {2053,3,3}, {2053,3,4}, {2053,3,5}, {2053,3,6}, {2053,3,7}, {2053,3,8}, {2053,3,9}, {2053,3,10}, {2053,3,11}, {2053,3,12}, {2053,3,13}, 
-{2053,3,14}, {2053,3,15}, {2053,3,16}, {2053,3,17}, {2053,3,18}, {2053,3,19}, {2053,3,20}, {2053,3,21}, {2053,3,22}, {2053,3,23}, {2053,3,24}, {2053,3,25}, {2053,3,26}, {2053,3,27}, {2053,3,28}, {2053,3,29}, {2053,3,30}, {2053,3,31}, {2053,4,1}, {2053,4,2}, {2053,4,3}, {2053,4,4}, {2053,4,5}, {2053,4,6}, {2053,4,7}, {2053,4,8}, {2053,4,9}, {2053,4,10}, {2053,4,11}, {2053,4,12}, {2053,4,13}, {2053,4,14}, 
-{2053,4,15}, {2053,4,16}, {2053,4,17}, {2053,4,18}, {2053,4,19}, {2053,4,20}, {2053,4,21}, {2053,4,22}, {2053,4,23}, {2053,4,24}, {2053,4,25}, {2053,4,26}, {2053,4,27}, {2053,4,28}, {2053,4,29}, {2053,4,30}, {2053,5,1}, {2053,5,2}, {2053,5,3}, {2053,5,4}, {2053,5,5}, {2053,5,6}, {2053,5,7}, {2053,5,8}, {2053,5,9}, {2053,5,10}, {2053,5,11}, {2053,5,12}, {2053,5,13}, {2053,5,14}, {2053,5,15}, {2053,5,16}, 
-{2053,5,17}, {2053,5,18}, {2053,5,19}, {2053,5,20}, {2053,5,21}, {2053,5,22}, {2053,5,23}, {2053,5,24}, {2053,5,25}, {2053,5,26}, {2053,5,27}, {2053,5,28}, {2053,5,29}, {2053,5,30}, {2053,5,31}, {2053,6,1}, {2053,6,2}, {2053,6,3}, {2053,6,4}, {2053,6,5}, {2053,6,6}, {2053,6,7}, {2053,6,8}, {2053,6,9}, {2053,6,10}, {2053,6,11}, {2053,6,12}, {2053,6,13}, {2053,6,14}, {2053,6,15}, {2053,6,16}, {2053,6,17}, 
-{2053,6,18}, {2053,6,19}, {2053,6,20}, {2053,6,21}, {2053,6,22}, {2053,6,23}, {2053,6,24}, {2053,6,25}, {2053,6,26}, {2053,6,27}, {2053,6,28}, {2053,6,29}, {2053,6,30}, {2053,7,1}, {2053,7,2}, {2053,7,3}, {2053,7,4}, {2053,7,5}, {2053,7,6}, {2053,7,7}, {2053,7,8}, {2053,7,9}, {2053,7,10}, {2053,7,11}, {2053,7,12}, {2053,7,13}, {2053,7,14}, {2053,7,15}, {2053,7,16}, {2053,7,17}, {2053,7,18}, {2053,7,19}, 
-{2053,7,20}, {2053,7,21}, {2053,7,22}, {2053,7,23}, {2053,7,24}, {2053,7,25}, {2053,7,26}, {2053,7,27}, {2053,7,28}, {2053,7,29}, {2053,7,30}, {2053,7,31}, {2053,8,1}, {2053,8,2}, {2053,8,3}, {2053,8,4}, {2053,8,5}, {2053,8,6}, {2053,8,7}, {2053,8,8}, {2053,8,9}, {2053,8,10}, {2053,8,11}, {2053,8,12}, {2053,8,13}, {2053,8,14}, {2053,8,15}, {2053,8,16}, {2053,8,17}, {2053,8,18}, {2053,8,19}, {2053,8,20}, 
-{2053,8,21}, {2053,8,22}, {2053,8,23}, {2053,8,24}, {2053,8,25}, {2053,8,26}, {2053,8,27}, {2053,8,28}, {2053,8,29}, {2053,8,30}, {2053,8,31}, {2053,9,1}, {2053,9,2}, {2053,9,3}, {2053,9,4}, {2053,9,5}, {2053,9,6}, {2053,9,7}, {2053,9,8}, {2053,9,9}, {2053,9,10}, {2053,9,11}, {2053,9,12}, {2053,9,13}, {2053,9,14}, {2053,9,15}, {2053,9,16}, {2053,9,17}, {2053,9,18}, {2053,9,19}, {2053,9,20}, {2053,9,21}, 
-{2053,9,22}, {2053,9,23}, {2053,9,24}, {2053,9,25}, {2053,9,26}, {2053,9,27}, {2053,9,28}, {2053,9,29}, {2053,9,30}, {2053,10,1}, {2053,10,2}, {2053,10,3}, {2053,10,4}, {2053,10,5}, {2053,10,6}, {2053,10,7}, {2053,10,8}, {2053,10,9}, {2053,10,10}, {2053,10,11}, {2053,10,12}, {2053,10,13}, {2053,10,14}, {2053,10,15}, {2053,10,16}, {2053,10,17}, {2053,10,18}, {2053,10,19}, {2053,10,20}, {2053,10,21}, {2053,10,22}, {2053,10,23}, 
-{2053,10,24}, {2053,10,25}, {2053,10,26}, {2053,10,27}, {2053,10,28}, {2053,10,29}, {2053,10,30}, {2053,10,31}, {2053,11,1}, {2053,11,2}, {2053,11,3}, {2053,11,4}, {2053,11,5}, {2053,11,6}, {2053,11,7}, {2053,11,8}, {2053,11,9}, {2053,11,10}, {2053,11,11}, {2053,11,12}, {2053,11,13}, {2053,11,14}, {2053,11,15}, {2053,11,16}, {2053,11,17}, {2053,11,18}, {2053,11,19}, {2053,11,20}, {2053,11,21}, {2053,11,22}, {2053,11,23}, {2053,11,24}, 
-{2053,11,25}, {2053,11,26}, {2053,11,27}, {2053,11,28}, {2053,11,29}, {2053,11,30}, {2053,12,1}, {2053,12,2}, {2053,12,3}, {2053,12,4}, {2053,12,5}, {2053,12,6}, {2053,12,7}, {2053,12,8}, {2053,12,9}, {2053,12,10}, {2053,12,11}, {2053,12,12}, {2053,12,13}, {2053,12,14}, {2053,12,15}, {2053,12,16}, {2053,12,17}, {2053,12,18}, {2053,12,19}, {2053,12,20}, {2053,12,21}, {2053,12,22}, {2053,12,23}, {2053,12,24}, {2053,12,25}, {2053,12,26}, 
-{2053,12,27}, {2053,12,28}, {2053,12,29}, {2053,12,30}, {2053,12,31}, {2054,1,1}, {2054,1,2}, {2054,1,3}, {2054,1,4}, {2054,1,5}, {2054,1,6}, {2054,1,7}, {2054,1,8}, {2054,1,9}, {2054,1,10}, {2054,1,11}, {2054,1,12}, {2054,1,13}, {2054,1,14}, {2054,1,15}, {2054,1,16}, {2054,1,17}, {2054,1,18}, {2054,1,19}, {2054,1,20}, {2054,1,21}, {2054,1,22}, {2054,1,23}, {2054,1,24}, {2054,1,25}, {2054,1,26}, {2054,1,27}, 
-{2054,1,28}, {2054,1,29}, {2054,1,30}, {2054,1,31}, {2054,2,1}, {2054,2,2}, {2054,2,3}, {2054,2,4}, {2054,2,5}, {2054,2,6}, {2054,2,7}, {2054,2,8}, {2054,2,9}, {2054,2,10}, {2054,2,11}, {2054,2,12}, {2054,2,13}, {2054,2,14}, {2054,2,15}, {2054,2,16}, {2054,2,17}, {2054,2,18}, {2054,2,19}, {2054,2,20}, {2054,2,21}, {2054,2,22}, {2054,2,23}, {2054,2,24}, {2054,2,25}, {2054,2,26}, {2054,2,27}, {2054,2,28}, 
-{2054,3,1}, {2054,3,2}, {2054,3,3}, {2054,3,4}, {2054,3,5}, {2054,3,6}, {2054,3,7}, {2054,3,8}, {2054,3,9}, {2054,3,10}, {2054,3,11}, {2054,3,12}, {2054,3,13}, {2054,3,14}, {2054,3,15}, {2054,3,16}, {2054,3,17}, {2054,3,18}, {2054,3,19}, {2054,3,20}, {2054,3,21}, {2054,3,22}, {2054,3,23}, {2054,3,24}, {2054,3,25}, {2054,3,26}, {2054,3,27}, {2054,3,28}, {2054,3,29}, {2054,3,30}, {2054,3,31}, {2054,4,1}, 
-{2054,4,2}, {2054,4,3}, {2054,4,4}, {2054,4,5}, {2054,4,6}, {2054,4,7}, {2054,4,8}, {2054,4,9}, {2054,4,10}, {2054,4,11}, {2054,4,12}, {2054,4,13}, {2054,4,14}, {2054,4,15}, {2054,4,16}, {2054,4,17}, {2054,4,18}, {2054,4,19}, {2054,4,20}, {2054,4,21}, {2054,4,22}, {2054,4,23}, {2054,4,24}, {2054,4,25}, {2054,4,26}, {2054,4,27}, {2054,4,28}, {2054,4,29}, {2054,4,30}, {2054,5,1}, {2054,5,2}, {2054,5,3}, 
-{2054,5,4}, {2054,5,5}, {2054,5,6}, {2054,5,7}, {2054,5,8}, {2054,5,9}, {2054,5,10}, {2054,5,11}, {2054,5,12}, {2054,5,13}, {2054,5,14}, {2054,5,15}, {2054,5,16}, {2054,5,17}, {2054,5,18}, {2054,5,19}, {2054,5,20}, {2054,5,21}, {2054,5,22}, {2054,5,23}, {2054,5,24}, {2054,5,25}, {2054,5,26}, {2054,5,27}, {2054,5,28}, {2054,5,29}, {2054,5,30}, {2054,5,31}, {2054,6,1}, {2054,6,2}, {2054,6,3}, {2054,6,4}, 
-{2054,6,5}, {2054,6,6}, {2054,6,7}, {2054,6,8}, {2054,6,9}, {2054,6,10}, {2054,6,11}, {2054,6,12}, {2054,6,13}, {2054,6,14}, {2054,6,15}, {2054,6,16}, {2054,6,17}, {2054,6,18}, {2054,6,19}, {2054,6,20}, {2054,6,21}, {2054,6,22}, {2054,6,23}, {2054,6,24}, {2054,6,25}, {2054,6,26}, {2054,6,27}, {2054,6,28}, {2054,6,29}, {2054,6,30}, {2054,7,1}, {2054,7,2}, {2054,7,3}, {2054,7,4}, {2054,7,5}, {2054,7,6}, 
-{2054,7,7}, {2054,7,8}, {2054,7,9}, {2054,7,10}, {2054,7,11}, {2054,7,12}, {2054,7,13}, {2054,7,14}, {2054,7,15}, {2054,7,16}, {2054,7,17}, {2054,7,18}, {2054,7,19}, {2054,7,20}, {2054,7,21}, {2054,7,22}, {2054,7,23}, {2054,7,24}, {2054,7,25}, {2054,7,26}, {2054,7,27}, {2054,7,28}, {2054,7,29}, {2054,7,30}, {2054,7,31}, {2054,8,1}, {2054,8,2}, {2054,8,3}, {2054,8,4}, {2054,8,5}, {2054,8,6}, {2054,8,7}, 
-{2054,8,8}, {2054,8,9}, {2054,8,10}, {2054,8,11}, {2054,8,12}, {2054,8,13}, {2054,8,14}, {2054,8,15}, {2054,8,16}, {2054,8,17}, {2054,8,18}, {2054,8,19}, {2054,8,20}, {2054,8,21}, {2054,8,22}, {2054,8,23}, {2054,8,24}, {2054,8,25}, {2054,8,26}, {2054,8,27}, {2054,8,28}, {2054,8,29}, {2054,8,30}, {2054,8,31}, {2054,9,1}, {2054,9,2}, {2054,9,3}, {2054,9,4}, {2054,9,5}, {2054,9,6}, {2054,9,7}, {2054,9,8}, 
-{2054,9,9}, {2054,9,10}, {2054,9,11}, {2054,9,12}, {2054,9,13}, {2054,9,14}, {2054,9,15}, {2054,9,16}, {2054,9,17}, {2054,9,18}, {2054,9,19}, {2054,9,20}, {2054,9,21}, {2054,9,22}, {2054,9,23}, {2054,9,24}, {2054,9,25}, {2054,9,26}, {2054,9,27}, {2054,9,28}, {2054,9,29}, {2054,9,30}, {2054,10,1}, {2054,10,2}, {2054,10,3}, {2054,10,4}, {2054,10,5}, {2054,10,6}, {2054,10,7}, {2054,10,8}, {2054,10,9}, {2054,10,10}, 
-{2054,10,11}, {2054,10,12}, {2054,10,13}, {2054,10,14}, {2054,10,15}, {2054,10,16}, {2054,10,17}, {2054,10,18}, {2054,10,19}, {2054,10,20}, {2054,10,21}, {2054,10,22}, {2054,10,23}, {2054,10,24}, {2054,10,25}, {2054,10,26}, {2054,10,27}, {2054,10,28}, {2054,10,29}, {2054,10,30}, {2054,10,31}, {2054,11,1}, {2054,11,2}, {2054,11,3}, {2054,11,4}, {2054,11,5}, {2054,11,6}, {2054,11,7}, {2054,11,8}, {2054,11,9}, {2054,11,10}, {2054,11,11}, 
-{2054,11,12}, {2054,11,13}, {2054,11,14}, {2054,11,15}, {2054,11,16}, {2054,11,17}, {2054,11,18}, {2054,11,19}, {2054,11,20}, {2054,11,21}, {2054,11,22}, {2054,11,23}, {2054,11,24}, {2054,11,25}, {2054,11,26}, {2054,11,27}, {2054,11,28}, {2054,11,29}, {2054,11,30}, {2054,12,1}, {2054,12,2}, {2054,12,3}, {2054,12,4}, {2054,12,5}, {2054,12,6}, {2054,12,7}, {2054,12,8}, {2054,12,9}, {2054,12,10}, {2054,12,11}, {2054,12,12}, {2054,12,13}, 
-{2054,12,14}, {2054,12,15}, {2054,12,16}, {2054,12,17}, {2054,12,18}, {2054,12,19}, {2054,12,20}, {2054,12,21}, {2054,12,22}, {2054,12,23}, {2054,12,24}, {2054,12,25}, {2054,12,26}, {2054,12,27}, {2054,12,28}, {2054,12,29}, {2054,12,30}, {2054,12,31}, {2055,1,1}, {2055,1,2}, {2055,1,3}, {2055,1,4}, {2055,1,5}, {2055,1,6}, {2055,1,7}, {2055,1,8}, {2055,1,9}, {2055,1,10}, {2055,1,11}, {2055,1,12}, {2055,1,13}, {2055,1,14}, 
-{2055,1,15}, {2055,1,16}, {2055,1,17}, {2055,1,18}, {2055,1,19}, {2055,1,20}, {2055,1,21}, {2055,1,22}, {2055,1,23}, {2055,1,24}, {2055,1,25}, {2055,1,26}, {2055,1,27}, {2055,1,28}, {2055,1,29}, {2055,1,30}, {2055,1,31}, {2055,2,1}, {2055,2,2}, {2055,2,3}, {2055,2,4}, {2055,2,5}, {2055,2,6}, {2055,2,7}, {2055,2,8}, {2055,2,9}, {2055,2,10}, {2055,2,11}, {2055,2,12}, {2055,2,13}, {2055,2,14}, {2055,2,15}, 
-{2055,2,16}, {2055,2,17}, {2055,2,18}, {2055,2,19}, {2055,2,20}, {2055,2,21}, {2055,2,22}, {2055,2,23}, {2055,2,24}, {2055,2,25}, {2055,2,26}, {2055,2,27}, {2055,2,28}, {2055,3,1}, {2055,3,2}, {2055,3,3}, {2055,3,4}, {2055,3,5}, {2055,3,6}, {2055,3,7}, {2055,3,8}, {2055,3,9}, {2055,3,10}, {2055,3,11}, {2055,3,12}, {2055,3,13}, {2055,3,14}, {2055,3,15}, {2055,3,16}, {2055,3,17}, {2055,3,18}, {2055,3,19}, 
-{2055,3,20}, {2055,3,21}, {2055,3,22}, {2055,3,23}, {2055,3,24}, {2055,3,25}, {2055,3,26}, {2055,3,27}, {2055,3,28}, {2055,3,29}, {2055,3,30}, {2055,3,31}, {2055,4,1}, {2055,4,2}, {2055,4,3}, {2055,4,4}, {2055,4,5}, {2055,4,6}, {2055,4,7}, {2055,4,8}, {2055,4,9}, {2055,4,10}, {2055,4,11}, {2055,4,12}, {2055,4,13}, {2055,4,14}, {2055,4,15}, {2055,4,16}, {2055,4,17}, {2055,4,18}, {2055,4,19}, {2055,4,20}, 
-{2055,4,21}, {2055,4,22}, {2055,4,23}, {2055,4,24}, {2055,4,25}, {2055,4,26}, {2055,4,27}, {2055,4,28}, {2055,4,29}, {2055,4,30}, {2055,5,1}, {2055,5,2}, {2055,5,3}, {2055,5,4}, {2055,5,5}, {2055,5,6}, {2055,5,7}, {2055,5,8}, {2055,5,9}, {2055,5,10}, {2055,5,11}, {2055,5,12}, {2055,5,13}, {2055,5,14}, {2055,5,15}, {2055,5,16}, {2055,5,17}, {2055,5,18}, {2055,5,19}, {2055,5,20}, {2055,5,21}, {2055,5,22}, 
-{2055,5,23}, {2055,5,24}, {2055,5,25}, {2055,5,26}, {2055,5,27}, {2055,5,28}, {2055,5,29}, {2055,5,30}, {2055,5,31}, {2055,6,1}, {2055,6,2}, {2055,6,3}, {2055,6,4}, {2055,6,5}, {2055,6,6}, {2055,6,7}, {2055,6,8}, {2055,6,9}, {2055,6,10}, {2055,6,11}, {2055,6,12}, {2055,6,13}, {2055,6,14}, {2055,6,15}, {2055,6,16}, {2055,6,17}, {2055,6,18}, {2055,6,19}, {2055,6,20}, {2055,6,21}, {2055,6,22}, {2055,6,23}, 
-{2055,6,24}, {2055,6,25}, {2055,6,26}, {2055,6,27}, {2055,6,28}, {2055,6,29}, {2055,6,30}, {2055,7,1}, {2055,7,2}, {2055,7,3}, {2055,7,4}, {2055,7,5}, {2055,7,6}, {2055,7,7}, {2055,7,8}, {2055,7,9}, {2055,7,10}, {2055,7,11}, {2055,7,12}, {2055,7,13}, {2055,7,14}, {2055,7,15}, {2055,7,16}, {2055,7,17}, {2055,7,18}, {2055,7,19}, {2055,7,20}, {2055,7,21}, {2055,7,22}, {2055,7,23}, {2055,7,24}, {2055,7,25}, 
-{2055,7,26}, {2055,7,27}, {2055,7,28}, {2055,7,29}, {2055,7,30}, {2055,7,31}, {2055,8,1}, {2055,8,2}, {2055,8,3}, {2055,8,4}, {2055,8,5}, {2055,8,6}, {2055,8,7}, {2055,8,8}, {2055,8,9}, {2055,8,10}, {2055,8,11}, {2055,8,12}, {2055,8,13}, {2055,8,14}, {2055,8,15}, {2055,8,16}, {2055,8,17}, {2055,8,18}, {2055,8,19}, {2055,8,20}, {2055,8,21}, {2055,8,22}, {2055,8,23}, {2055,8,24}, {2055,8,25}, {2055,8,26}, 
-{2055,8,27}, {2055,8,28}, {2055,8,29}, {2055,8,30}, {2055,8,31}, {2055,9,1}, {2055,9,2}, {2055,9,3}, {2055,9,4}, {2055,9,5}, {2055,9,6}, {2055,9,7}, {2055,9,8}, {2055,9,9}, {2055,9,10}, {2055,9,11}, {2055,9,12}, {2055,9,13}, {2055,9,14}, {2055,9,15}, {2055,9,16}, {2055,9,17}, {2055,9,18}, {2055,9,19}, {2055,9,20}, {2055,9,21}, {2055,9,22}, {2055,9,23}, {2055,9,24}, {2055,9,25}, {2055,9,26}, {2055,9,27}, 
-{2055,9,28}, {2055,9,29}, {2055,9,30}, {2055,10,1}, {2055,10,2}, {2055,10,3}, {2055,10,4}, {2055,10,5}, {2055,10,6}, {2055,10,7}, {2055,10,8}, {2055,10,9}, {2055,10,10}, {2055,10,11}, {2055,10,12}, {2055,10,13}, {2055,10,14}, {2055,10,15}, {2055,10,16}, {2055,10,17}, {2055,10,18}, {2055,10,19}, {2055,10,20}, {2055,10,21}, {2055,10,22}, {2055,10,23}, {2055,10,24}, {2055,10,25}, {2055,10,26}, {2055,10,27}, {2055,10,28}, {2055,10,29}, 
-{2055,10,30}, {2055,10,31}, {2055,11,1}, {2055,11,2}, {2055,11,3}, {2055,11,4}, {2055,11,5}, {2055,11,6}, {2055,11,7}, {2055,11,8}, {2055,11,9}, {2055,11,10}, {2055,11,11}, {2055,11,12}, {2055,11,13}, {2055,11,14}, {2055,11,15}, {2055,11,16}, {2055,11,17}, {2055,11,18}, {2055,11,19}, {2055,11,20}, {2055,11,21}, {2055,11,22}, {2055,11,23}, {2055,11,24}, {2055,11,25}, {2055,11,26}, {2055,11,27}, {2055,11,28}, {2055,11,29}, {2055,11,30}, 
-{2055,12,1}, {2055,12,2}, {2055,12,3}, {2055,12,4}, {2055,12,5}, {2055,12,6}, {2055,12,7}, {2055,12,8}, {2055,12,9}, {2055,12,10}, {2055,12,11}, {2055,12,12}, {2055,12,13}, {2055,12,14}, {2055,12,15}, {2055,12,16}, {2055,12,17}, {2055,12,18}, {2055,12,19}, {2055,12,20}, {2055,12,21}, {2055,12,22}, {2055,12,23}, {2055,12,24}, {2055,12,25}, {2055,12,26}, {2055,12,27}, {2055,12,28}, {2055,12,29}, {2055,12,30}, {2055,12,31}, {2056,1,1}, 
-{2056,1,2}, {2056,1,3}, {2056,1,4}, {2056,1,5}, {2056,1,6}, {2056,1,7}, {2056,1,8}, {2056,1,9}, {2056,1,10}, {2056,1,11}, {2056,1,12}, {2056,1,13}, {2056,1,14}, {2056,1,15}, {2056,1,16}, {2056,1,17}, {2056,1,18}, {2056,1,19}, {2056,1,20}, {2056,1,21}, {2056,1,22}, {2056,1,23}, {2056,1,24}, {2056,1,25}, {2056,1,26}, {2056,1,27}, {2056,1,28}, {2056,1,29}, {2056,1,30}, {2056,1,31}, {2056,2,1}, {2056,2,2}, 
-{2056,2,3}, {2056,2,4}, {2056,2,5}, {2056,2,6}, {2056,2,7}, {2056,2,8}, {2056,2,9}, {2056,2,10}, {2056,2,11}, {2056,2,12}, {2056,2,13}, {2056,2,14}, {2056,2,15}, {2056,2,16}, {2056,2,17}, {2056,2,18}, {2056,2,19}, {2056,2,20}, {2056,2,21}, {2056,2,22}, {2056,2,23}, {2056,2,24}, {2056,2,25}, {2056,2,26}, {2056,2,27}, {2056,2,28}, {2056,2,29}, {2056,3,1}, {2056,3,2}, {2056,3,3}, {2056,3,4}, {2056,3,5}, 
-{2056,3,6}, {2056,3,7}, {2056,3,8}, {2056,3,9}, {2056,3,10}, {2056,3,11}, {2056,3,12}, {2056,3,13}, {2056,3,14}, {2056,3,15}, {2056,3,16}, {2056,3,17}, {2056,3,18}, {2056,3,19}, {2056,3,20}, {2056,3,21}, {2056,3,22}, {2056,3,23}, {2056,3,24}, {2056,3,25}, {2056,3,26}, {2056,3,27}, {2056,3,28}, {2056,3,29}, {2056,3,30}, {2056,3,31}, {2056,4,1}, {2056,4,2}, {2056,4,3}, {2056,4,4}, {2056,4,5}, {2056,4,6}, 
-{2056,4,7}, {2056,4,8}, {2056,4,9}, {2056,4,10}, {2056,4,11}, {2056,4,12}, {2056,4,13}, {2056,4,14}, {2056,4,15}, {2056,4,16}, {2056,4,17}, {2056,4,18}, {2056,4,19}, {2056,4,20}, {2056,4,21}, {2056,4,22}, {2056,4,23}, {2056,4,24}, {2056,4,25}, {2056,4,26}, {2056,4,27}, {2056,4,28}, {2056,4,29}, {2056,4,30}, {2056,5,1}, {2056,5,2}, {2056,5,3}, {2056,5,4}, {2056,5,5}, {2056,5,6}, {2056,5,7}, {2056,5,8}, 
-{2056,5,9}, {2056,5,10}, {2056,5,11}, {2056,5,12}, {2056,5,13}, {2056,5,14}, {2056,5,15}, {2056,5,16}, {2056,5,17}, {2056,5,18}, {2056,5,19}, {2056,5,20}, {2056,5,21}, {2056,5,22}, {2056,5,23}, {2056,5,24}, {2056,5,25}, {2056,5,26}, {2056,5,27}, {2056,5,28}, {2056,5,29}, {2056,5,30}, {2056,5,31}, {2056,6,1}, {2056,6,2}, {2056,6,3}, {2056,6,4}, {2056,6,5}, {2056,6,6}, {2056,6,7}, {2056,6,8}, {2056,6,9}, 
-{2056,6,10}, {2056,6,11}, {2056,6,12}, {2056,6,13}, {2056,6,14}, {2056,6,15}, {2056,6,16}, {2056,6,17}, {2056,6,18}, {2056,6,19}, {2056,6,20}, {2056,6,21}, {2056,6,22}, {2056,6,23}, {2056,6,24}, {2056,6,25}, {2056,6,26}, {2056,6,27}, {2056,6,28}, {2056,6,29}, {2056,6,30}, {2056,7,1}, {2056,7,2}, {2056,7,3}, {2056,7,4}, {2056,7,5}, {2056,7,6}, {2056,7,7}, {2056,7,8}, {2056,7,9}, {2056,7,10}, {2056,7,11}, 
-{2056,7,12}, {2056,7,13}, {2056,7,14}, {2056,7,15}, {2056,7,16}, {2056,7,17}, {2056,7,18}, {2056,7,19}, {2056,7,20}, {2056,7,21}, {2056,7,22}, {2056,7,23}, {2056,7,24}, {2056,7,25}, {2056,7,26}, {2056,7,27}, {2056,7,28}, {2056,7,29}, {2056,7,30}, {2056,7,31}, {2056,8,1}, {2056,8,2}, {2056,8,3}, {2056,8,4}, {2056,8,5}, {2056,8,6}, {2056,8,7}, {2056,8,8}, {2056,8,9}, {2056,8,10}, {2056,8,11}, {2056,8,12}, 
-{2056,8,13}, {2056,8,14}, {2056,8,15}, {2056,8,16}, {2056,8,17}, {2056,8,18}, {2056,8,19}, {2056,8,20}, {2056,8,21}, {2056,8,22}, {2056,8,23}, {2056,8,24}, {2056,8,25}, {2056,8,26}, {2056,8,27}, {2056,8,28}, {2056,8,29}, {2056,8,30}, {2056,8,31}, {2056,9,1}, {2056,9,2}, {2056,9,3}, {2056,9,4}, {2056,9,5}, {2056,9,6}, {2056,9,7}, {2056,9,8}, {2056,9,9}, {2056,9,10}, {2056,9,11}, {2056,9,12}, {2056,9,13}, 
-{2056,9,14}, {2056,9,15}, {2056,9,16}, {2056,9,17}, {2056,9,18}, {2056,9,19}, {2056,9,20}, {2056,9,21}, {2056,9,22}, {2056,9,23}, {2056,9,24}, {2056,9,25}, {2056,9,26}, {2056,9,27}, {2056,9,28}, {2056,9,29}, {2056,9,30}, {2056,10,1}, {2056,10,2}, {2056,10,3}, {2056,10,4}, {2056,10,5}, {2056,10,6}, {2056,10,7}, {2056,10,8}, {2056,10,9}, {2056,10,10}, {2056,10,11}, {2056,10,12}, {2056,10,13}, {2056,10,14}, {2056,10,15}, 
-{2056,10,16}, {2056,10,17}, {2056,10,18}, {2056,10,19}, {2056,10,20}, {2056,10,21}, {2056,10,22}, {2056,10,23}, {2056,10,24}, {2056,10,25}, {2056,10,26}, {2056,10,27}, {2056,10,28}, {2056,10,29}, {2056,10,30}, {2056,10,31}, {2056,11,1}, {2056,11,2}, {2056,11,3}, {2056,11,4}, {2056,11,5}, {2056,11,6}, {2056,11,7}, {2056,11,8}, {2056,11,9}, {2056,11,10}, {2056,11,11}, {2056,11,12}, {2056,11,13}, {2056,11,14}, {2056,11,15}, {2056,11,16}, 
-{2056,11,17}, {2056,11,18}, {2056,11,19}, {2056,11,20}, {2056,11,21}, {2056,11,22}, {2056,11,23}, {2056,11,24}, {2056,11,25}, {2056,11,26}, {2056,11,27}, {2056,11,28}, {2056,11,29}, {2056,11,30}, {2056,12,1}, {2056,12,2}, {2056,12,3}, {2056,12,4}, {2056,12,5}, {2056,12,6}, {2056,12,7}, {2056,12,8}, {2056,12,9}, {2056,12,10}, {2056,12,11}, {2056,12,12}, {2056,12,13}, {2056,12,14}, {2056,12,15}, {2056,12,16}, {2056,12,17}, {2056,12,18}, 
-{2056,12,19}, {2056,12,20}, {2056,12,21}, {2056,12,22}, {2056,12,23}, {2056,12,24}, {2056,12,25}, {2056,12,26}, {2056,12,27}, {2056,12,28}, {2056,12,29}, {2056,12,30}, {2056,12,31}, {2057,1,1}, {2057,1,2}, {2057,1,3}, {2057,1,4}, {2057,1,5}, {2057,1,6}, {2057,1,7}, {2057,1,8}, {2057,1,9}, {2057,1,10}, {2057,1,11}, {2057,1,12}, {2057,1,13}, {2057,1,14}, {2057,1,15}, {2057,1,16}, {2057,1,17}, {2057,1,18}, {2057,1,19}, 
-{2057,1,20}, {2057,1,21}, {2057,1,22}, {2057,1,23}, {2057,1,24}, {2057,1,25}, {2057,1,26}, {2057,1,27}, {2057,1,28}, {2057,1,29}, {2057,1,30}, {2057,1,31}, {2057,2,1}, {2057,2,2}, {2057,2,3}, {2057,2,4}, {2057,2,5}, {2057,2,6}, {2057,2,7}, {2057,2,8}, {2057,2,9}, {2057,2,10}, {2057,2,11}, {2057,2,12}, {2057,2,13}, {2057,2,14}, {2057,2,15}, {2057,2,16}, {2057,2,17}, {2057,2,18}, {2057,2,19}, {2057,2,20}, 
-{2057,2,21}, {2057,2,22}, {2057,2,23}, {2057,2,24}, {2057,2,25}, {2057,2,26}, {2057,2,27}, {2057,2,28}, {2057,3,1}, {2057,3,2}, {2057,3,3}, {2057,3,4}, {2057,3,5}, {2057,3,6}, {2057,3,7}, {2057,3,8}, {2057,3,9}, {2057,3,10}, {2057,3,11}, {2057,3,12}, {2057,3,13}, {2057,3,14}, {2057,3,15}, {2057,3,16}, {2057,3,17}, {2057,3,18}, {2057,3,19}, {2057,3,20}, {2057,3,21}, {2057,3,22}, {2057,3,23}, {2057,3,24}, 
-{2057,3,25}, {2057,3,26}, {2057,3,27}, {2057,3,28}, {2057,3,29}, {2057,3,30}, {2057,3,31}, {2057,4,1}, {2057,4,2}, {2057,4,3}, {2057,4,4}, {2057,4,5}, {2057,4,6}, {2057,4,7}, {2057,4,8}, {2057,4,9}, {2057,4,10}, {2057,4,11}, {2057,4,12}, {2057,4,13}, {2057,4,14}, {2057,4,15}, {2057,4,16}, {2057,4,17}, {2057,4,18}, {2057,4,19}, {2057,4,20}, {2057,4,21}, {2057,4,22}, {2057,4,23}, {2057,4,24}, {2057,4,25}, 
-{2057,4,26}, {2057,4,27}, {2057,4,28}, {2057,4,29}, {2057,4,30}, {2057,5,1}, {2057,5,2}, {2057,5,3}, {2057,5,4}, {2057,5,5}, {2057,5,6}, {2057,5,7}, {2057,5,8}, {2057,5,9}, {2057,5,10}, {2057,5,11}, {2057,5,12}, {2057,5,13}, {2057,5,14}, {2057,5,15}, {2057,5,16}, {2057,5,17}, {2057,5,18}, {2057,5,19}, {2057,5,20}, {2057,5,21}, {2057,5,22}, {2057,5,23}, {2057,5,24}, {2057,5,25}, {2057,5,26}, {2057,5,27}, 
-{2057,5,28}, {2057,5,29}, {2057,5,30}, {2057,5,31}, {2057,6,1}, {2057,6,2}, {2057,6,3}, {2057,6,4}, {2057,6,5}, {2057,6,6}, {2057,6,7}, {2057,6,8}, {2057,6,9}, {2057,6,10}, {2057,6,11}, {2057,6,12}, {2057,6,13}, {2057,6,14}, {2057,6,15}, {2057,6,16}, {2057,6,17}, {2057,6,18}, {2057,6,19}, {2057,6,20}, {2057,6,21}, {2057,6,22}, {2057,6,23}, {2057,6,24}, {2057,6,25}, {2057,6,26}, {2057,6,27}, {2057,6,28}, 
-{2057,6,29}, {2057,6,30}, {2057,7,1}, {2057,7,2}, {2057,7,3}, {2057,7,4}, {2057,7,5}, {2057,7,6}, {2057,7,7}, {2057,7,8}, {2057,7,9}, {2057,7,10}, {2057,7,11}, {2057,7,12}, {2057,7,13}, {2057,7,14}, {2057,7,15}, {2057,7,16}, {2057,7,17}, {2057,7,18}, {2057,7,19}, {2057,7,20}, {2057,7,21}, {2057,7,22}, {2057,7,23}, {2057,7,24}, {2057,7,25}, {2057,7,26}, {2057,7,27}, {2057,7,28}, {2057,7,29}, {2057,7,30}, 
-{2057,7,31}, {2057,8,1}, {2057,8,2}, {2057,8,3}, {2057,8,4}, {2057,8,5}, {2057,8,6}, {2057,8,7}, {2057,8,8}, {2057,8,9}, {2057,8,10}, {2057,8,11}, {2057,8,12}, {2057,8,13}, {2057,8,14}, {2057,8,15}, {2057,8,16}, {2057,8,17}, {2057,8,18}, {2057,8,19}, {2057,8,20}, {2057,8,21}, {2057,8,22}, {2057,8,23}, {2057,8,24}, {2057,8,25}, {2057,8,26}, {2057,8,27}, {2057,8,28}, {2057,8,29}, {2057,8,30}, {2057,8,31}, 
-{2057,9,1}, {2057,9,2}, {2057,9,3}, {2057,9,4}, {2057,9,5}, {2057,9,6}, {2057,9,7}, {2057,9,8}, {2057,9,9}, {2057,9,10}, {2057,9,11}, {2057,9,12}, {2057,9,13}, {2057,9,14}, {2057,9,15}, {2057,9,16}, {2057,9,17}, {2057,9,18}, {2057,9,19}, {2057,9,20}, {2057,9,21}, {2057,9,22}, {2057,9,23}, {2057,9,24}, {2057,9,25}, {2057,9,26}, {2057,9,27}, {2057,9,28}, {2057,9,29}, {2057,9,30}, {2057,10,1}, {2057,10,2}, 
-{2057,10,3}, {2057,10,4}, {2057,10,5}, {2057,10,6}, {2057,10,7}, {2057,10,8}, {2057,10,9}, {2057,10,10}, {2057,10,11}, {2057,10,12}, {2057,10,13}, {2057,10,14}, {2057,10,15}, {2057,10,16}, {2057,10,17}, {2057,10,18}, {2057,10,19}, {2057,10,20}, {2057,10,21}, {2057,10,22}, {2057,10,23}, {2057,10,24}, {2057,10,25}, {2057,10,26}, {2057,10,27}, {2057,10,28}, {2057,10,29}, {2057,10,30}, {2057,10,31}, {2057,11,1}, {2057,11,2}, {2057,11,3}, 
-{2057,11,4}, {2057,11,5}, {2057,11,6}, {2057,11,7}, {2057,11,8}, {2057,11,9}, {2057,11,10}, {2057,11,11}, {2057,11,12}, {2057,11,13}, {2057,11,14}, {2057,11,15}, {2057,11,16}, {2057,11,17}, {2057,11,18}, {2057,11,19}, {2057,11,20}, {2057,11,21}, {2057,11,22}, {2057,11,23}, {2057,11,24}, {2057,11,25}, {2057,11,26}, {2057,11,27}, {2057,11,28}, {2057,11,29}, {2057,11,30}, {2057,12,1}, {2057,12,2}, {2057,12,3}, {2057,12,4}, {2057,12,5}, 
-{2057,12,6}, {2057,12,7}, {2057,12,8}, {2057,12,9}, {2057,12,10}, {2057,12,11}, {2057,12,12}, {2057,12,13}, {2057,12,14}, {2057,12,15}, {2057,12,16}, {2057,12,17}, {2057,12,18}, {2057,12,19}, {2057,12,20}, {2057,12,21}, {2057,12,22}, {2057,12,23}, {2057,12,24}, {2057,12,25}, {2057,12,26}, {2057,12,27}, {2057,12,28}, {2057,12,29}, {2057,12,30}, {2057,12,31}, {2058,1,1}, {2058,1,2}, {2058,1,3}, {2058,1,4}, {2058,1,5}, {2058,1,6}, 
-{2058,1,7}, {2058,1,8}, {2058,1,9}, {2058,1,10}, {2058,1,11}, {2058,1,12}, {2058,1,13}, {2058,1,14}, {2058,1,15}, {2058,1,16}, {2058,1,17}, {2058,1,18}, {2058,1,19}, {2058,1,20}, {2058,1,21}, {2058,1,22}, {2058,1,23}, {2058,1,24}, {2058,1,25}, {2058,1,26}, {2058,1,27}, {2058,1,28}, {2058,1,29}, {2058,1,30}, {2058,1,31}, {2058,2,1}, {2058,2,2}, {2058,2,3}, {2058,2,4}, {2058,2,5}, {2058,2,6}, {2058,2,7}, 
-{2058,2,8}, {2058,2,9}, {2058,2,10}, {2058,2,11}, {2058,2,12}, {2058,2,13}, {2058,2,14}, {2058,2,15}, {2058,2,16}, {2058,2,17}, {2058,2,18}, {2058,2,19}, {2058,2,20}, {2058,2,21}, {2058,2,22}, {2058,2,23}, {2058,2,24}, {2058,2,25}, {2058,2,26}, {2058,2,27}, {2058,2,28}, {2058,3,1}, {2058,3,2}, {2058,3,3}, {2058,3,4}, {2058,3,5}, {2058,3,6}, {2058,3,7}, {2058,3,8}, {2058,3,9}, {2058,3,10}, {2058,3,11}, 
-{2058,3,12}, {2058,3,13}, {2058,3,14}, {2058,3,15}, {2058,3,16}, {2058,3,17}, {2058,3,18}, {2058,3,19}, {2058,3,20}, {2058,3,21}, {2058,3,22}, {2058,3,23}, {2058,3,24}, {2058,3,25}, {2058,3,26}, {2058,3,27}, {2058,3,28}, {2058,3,29}, {2058,3,30}, {2058,3,31}, {2058,4,1}, {2058,4,2}, {2058,4,3}, {2058,4,4}, {2058,4,5}, {2058,4,6}, {2058,4,7}, {2058,4,8}, {2058,4,9}, {2058,4,10}, {2058,4,11}, {2058,4,12}, 
-{2058,4,13}, {2058,4,14}, {2058,4,15}, {2058,4,16}, {2058,4,17}, {2058,4,18}, {2058,4,19}, {2058,4,20}, {2058,4,21}, {2058,4,22}, {2058,4,23}, {2058,4,24}, {2058,4,25}, {2058,4,26}, {2058,4,27}, {2058,4,28}, {2058,4,29}, {2058,4,30}, {2058,5,1}, {2058,5,2}, {2058,5,3}, {2058,5,4}, {2058,5,5}, {2058,5,6}, {2058,5,7}, {2058,5,8}, {2058,5,9}, {2058,5,10}, {2058,5,11}, {2058,5,12}, {2058,5,13}, {2058,5,14}, 
-{2058,5,15}, {2058,5,16}, {2058,5,17}, {2058,5,18}, {2058,5,19}, {2058,5,20}, {2058,5,21}, {2058,5,22}, {2058,5,23}, {2058,5,24}, {2058,5,25}, {2058,5,26}, {2058,5,27}, {2058,5,28}, {2058,5,29}, {2058,5,30}, {2058,5,31}, {2058,6,1}, {2058,6,2}, {2058,6,3}, {2058,6,4}, {2058,6,5}, {2058,6,6}, {2058,6,7}, {2058,6,8}, {2058,6,9}, {2058,6,10}, {2058,6,11}, {2058,6,12}, {2058,6,13}, {2058,6,14}, {2058,6,15}, 
-{2058,6,16}, {2058,6,17}, {2058,6,18}, {2058,6,19}, {2058,6,20}, {2058,6,21}, {2058,6,22}, {2058,6,23}, {2058,6,24}, {2058,6,25}, {2058,6,26}, {2058,6,27}, {2058,6,28}, {2058,6,29}, {2058,6,30}, {2058,7,1}, {2058,7,2}, {2058,7,3}, {2058,7,4}, {2058,7,5}, {2058,7,6}, {2058,7,7}, {2058,7,8}, {2058,7,9}, {2058,7,10}, {2058,7,11}, {2058,7,12}, {2058,7,13}, {2058,7,14}, {2058,7,15}, {2058,7,16}, {2058,7,17}, 
-{2058,7,18}, {2058,7,19}, {2058,7,20}, {2058,7,21}, {2058,7,22}, {2058,7,23}, {2058,7,24}, {2058,7,25}, {2058,7,26}, {2058,7,27}, {2058,7,28}, {2058,7,29}, {2058,7,30}, {2058,7,31}, {2058,8,1}, {2058,8,2}, {2058,8,3}, {2058,8,4}, {2058,8,5}, {2058,8,6}, {2058,8,7}, {2058,8,8}, {2058,8,9}, {2058,8,10}, {2058,8,11}, {2058,8,12}, {2058,8,13}, {2058,8,14}, {2058,8,15}, {2058,8,16}, {2058,8,17}, {2058,8,18}, 
-{2058,8,19}, {2058,8,20}, {2058,8,21}, {2058,8,22}, {2058,8,23}, {2058,8,24}, {2058,8,25}, {2058,8,26}, {2058,8,27}, {2058,8,28}, {2058,8,29}, {2058,8,30}, {2058,8,31}, {2058,9,1}, {2058,9,2}, {2058,9,3}, {2058,9,4}, {2058,9,5}, {2058,9,6}, {2058,9,7}, {2058,9,8}, {2058,9,9}, {2058,9,10}, {2058,9,11}, {2058,9,12}, {2058,9,13}, {2058,9,14}, {2058,9,15}, {2058,9,16}, {2058,9,17}, {2058,9,18}, {2058,9,19}, 
-{2058,9,20}, {2058,9,21}, {2058,9,22}, {2058,9,23}, {2058,9,24}, {2058,9,25}, {2058,9,26}, {2058,9,27}, {2058,9,28}, {2058,9,29}, {2058,9,30}, {2058,10,1}, {2058,10,2}, {2058,10,3}, {2058,10,4}, {2058,10,5}, {2058,10,6}, {2058,10,7}, {2058,10,8}, {2058,10,9}, {2058,10,10}, {2058,10,11}, {2058,10,12}, {2058,10,13}, {2058,10,14}, {2058,10,15}, {2058,10,16}, {2058,10,17}, {2058,10,18}, {2058,10,19}, {2058,10,20}, {2058,10,21}, 
-{2058,10,22}, {2058,10,23}, {2058,10,24}, {2058,10,25}, {2058,10,26}, {2058,10,27}, {2058,10,28}, {2058,10,29}, {2058,10,30}, {2058,10,31}, {2058,11,1}, {2058,11,2}, {2058,11,3}, {2058,11,4}, {2058,11,5}, {2058,11,6}, {2058,11,7}, {2058,11,8}, {2058,11,9}, {2058,11,10}, {2058,11,11}, {2058,11,12}, {2058,11,13}, {2058,11,14}, {2058,11,15}, {2058,11,16}, {2058,11,17}, {2058,11,18}, {2058,11,19}, {2058,11,20}, {2058,11,21}, {2058,11,22}, 
-{2058,11,23}, {2058,11,24}, {2058,11,25}, {2058,11,26}, {2058,11,27}, {2058,11,28}, {2058,11,29}, {2058,11,30}, {2058,12,1}, {2058,12,2}, {2058,12,3}, {2058,12,4}, {2058,12,5}, {2058,12,6}, {2058,12,7}, {2058,12,8}, {2058,12,9}, {2058,12,10}, {2058,12,11}, {2058,12,12}, {2058,12,13}, {2058,12,14}, {2058,12,15}, {2058,12,16}, {2058,12,17}, {2058,12,18}, {2058,12,19}, {2058,12,20}, {2058,12,21}, {2058,12,22}, {2058,12,23}, {2058,12,24}, 
-{2058,12,25}, {2058,12,26}, {2058,12,27}, {2058,12,28}, {2058,12,29}, {2058,12,30}, {2058,12,31}, {2059,1,1}, {2059,1,2}, {2059,1,3}, {2059,1,4}, {2059,1,5}, {2059,1,6}, {2059,1,7}, {2059,1,8}, {2059,1,9}, {2059,1,10}, {2059,1,11}, {2059,1,12}, {2059,1,13}, {2059,1,14}, {2059,1,15}, {2059,1,16}, {2059,1,17}, {2059,1,18}, {2059,1,19}, {2059,1,20}, {2059,1,21}, {2059,1,22}, {2059,1,23}, {2059,1,24}, {2059,1,25}, 
-{2059,1,26}, {2059,1,27}, {2059,1,28}, {2059,1,29}, {2059,1,30}, {2059,1,31}, {2059,2,1}, {2059,2,2}, {2059,2,3}, {2059,2,4}, {2059,2,5}, {2059,2,6}, {2059,2,7}, {2059,2,8}, {2059,2,9}, {2059,2,10}, {2059,2,11}, {2059,2,12}, {2059,2,13}, {2059,2,14}, {2059,2,15}, {2059,2,16}, {2059,2,17}, {2059,2,18}, {2059,2,19}, {2059,2,20}, {2059,2,21}, {2059,2,22}, {2059,2,23}, {2059,2,24}, {2059,2,25}, {2059,2,26}, 
-{2059,2,27}, {2059,2,28}, {2059,3,1}, {2059,3,2}, {2059,3,3}, {2059,3,4}, {2059,3,5}, {2059,3,6}, {2059,3,7}, {2059,3,8}, {2059,3,9}, {2059,3,10}, {2059,3,11}, {2059,3,12}, {2059,3,13}, {2059,3,14}, {2059,3,15}, {2059,3,16}, {2059,3,17}, {2059,3,18}, {2059,3,19}, {2059,3,20}, {2059,3,21}, {2059,3,22}, {2059,3,23}, {2059,3,24}, {2059,3,25}, {2059,3,26}, {2059,3,27}, {2059,3,28}, {2059,3,29}, {2059,3,30}, 
-{2059,3,31}, {2059,4,1}, {2059,4,2}, {2059,4,3}, {2059,4,4}, {2059,4,5}, {2059,4,6}, {2059,4,7}, {2059,4,8}, {2059,4,9}, {2059,4,10}, {2059,4,11}, {2059,4,12}, {2059,4,13}, {2059,4,14}, {2059,4,15}, {2059,4,16}, {2059,4,17}, {2059,4,18}, {2059,4,19}, {2059,4,20}, {2059,4,21}, {2059,4,22}, {2059,4,23}, {2059,4,24}, {2059,4,25}, {2059,4,26}, {2059,4,27}, {2059,4,28}, {2059,4,29}, {2059,4,30}, {2059,5,1}, 
-{2059,5,2}, {2059,5,3}, {2059,5,4}, {2059,5,5}, {2059,5,6}, {2059,5,7}, {2059,5,8}, {2059,5,9}, {2059,5,10}, {2059,5,11}, {2059,5,12}, {2059,5,13}, {2059,5,14}, {2059,5,15}, {2059,5,16}, {2059,5,17}, {2059,5,18}, {2059,5,19}, {2059,5,20}, {2059,5,21}, {2059,5,22}, {2059,5,23}, {2059,5,24}, {2059,5,25}, {2059,5,26}, {2059,5,27}, {2059,5,28}, {2059,5,29}, {2059,5,30}, {2059,5,31}, {2059,6,1}, {2059,6,2}, 
-{2059,6,3}, {2059,6,4}, {2059,6,5}, {2059,6,6}, {2059,6,7}, {2059,6,8}, {2059,6,9}, {2059,6,10}, {2059,6,11}, {2059,6,12}, {2059,6,13}, {2059,6,14}, {2059,6,15}, {2059,6,16}, {2059,6,17}, {2059,6,18}, {2059,6,19}, {2059,6,20}, {2059,6,21}, {2059,6,22}, {2059,6,23}, {2059,6,24}, {2059,6,25}, {2059,6,26}, {2059,6,27}, {2059,6,28}, {2059,6,29}, {2059,6,30}, {2059,7,1}, {2059,7,2}, {2059,7,3}, {2059,7,4}, 
-{2059,7,5}, {2059,7,6}, {2059,7,7}, {2059,7,8}, {2059,7,9}, {2059,7,10}, {2059,7,11}, {2059,7,12}, {2059,7,13}, {2059,7,14}, {2059,7,15}, {2059,7,16}, {2059,7,17}, {2059,7,18}, {2059,7,19}, {2059,7,20}, {2059,7,21}, {2059,7,22}, {2059,7,23}, {2059,7,24}, {2059,7,25}, {2059,7,26}, {2059,7,27}, {2059,7,28}, {2059,7,29}, {2059,7,30}, {2059,7,31}, {2059,8,1}, {2059,8,2}, {2059,8,3}, {2059,8,4}, {2059,8,5}, 
-{2059,8,6}, {2059,8,7}, {2059,8,8}, {2059,8,9}, {2059,8,10}, {2059,8,11}, {2059,8,12}, {2059,8,13}, {2059,8,14}, {2059,8,15}, {2059,8,16}, {2059,8,17}, {2059,8,18}, {2059,8,19}, {2059,8,20}, {2059,8,21}, {2059,8,22}, {2059,8,23}, {2059,8,24}, {2059,8,25}, {2059,8,26}, {2059,8,27}, {2059,8,28}, {2059,8,29}, {2059,8,30}, {2059,8,31}, {2059,9,1}, {2059,9,2}, {2059,9,3}, {2059,9,4}, {2059,9,5}, {2059,9,6}, 
-{2059,9,7}, {2059,9,8}, {2059,9,9}, {2059,9,10}, {2059,9,11}, {2059,9,12}, {2059,9,13}, {2059,9,14}, {2059,9,15}, {2059,9,16}, {2059,9,17}, {2059,9,18}, {2059,9,19}, {2059,9,20}, {2059,9,21}, {2059,9,22}, {2059,9,23}, {2059,9,24}, {2059,9,25}, {2059,9,26}, {2059,9,27}, {2059,9,28}, {2059,9,29}, {2059,9,30}, {2059,10,1}, {2059,10,2}, {2059,10,3}, {2059,10,4}, {2059,10,5}, {2059,10,6}, {2059,10,7}, {2059,10,8}, 
-{2059,10,9}, {2059,10,10}, {2059,10,11}, {2059,10,12}, {2059,10,13}, {2059,10,14}, {2059,10,15}, {2059,10,16}, {2059,10,17}, {2059,10,18}, {2059,10,19}, {2059,10,20}, {2059,10,21}, {2059,10,22}, {2059,10,23}, {2059,10,24}, {2059,10,25}, {2059,10,26}, {2059,10,27}, {2059,10,28}, {2059,10,29}, {2059,10,30}, {2059,10,31}, {2059,11,1}, {2059,11,2}, {2059,11,3}, {2059,11,4}, {2059,11,5}, {2059,11,6}, {2059,11,7}, {2059,11,8}, {2059,11,9}, 
-{2059,11,10}, {2059,11,11}, {2059,11,12}, {2059,11,13}, {2059,11,14}, {2059,11,15}, {2059,11,16}, {2059,11,17}, {2059,11,18}, {2059,11,19}, {2059,11,20}, {2059,11,21}, {2059,11,22}, {2059,11,23}, {2059,11,24}, {2059,11,25}, {2059,11,26}, {2059,11,27}, {2059,11,28}, {2059,11,29}, {2059,11,30}, {2059,12,1}, {2059,12,2}, {2059,12,3}, {2059,12,4}, {2059,12,5}, {2059,12,6}, {2059,12,7}, {2059,12,8}, {2059,12,9}, {2059,12,10}, {2059,12,11}, 
-{2059,12,12}, {2059,12,13}, {2059,12,14}, {2059,12,15}, {2059,12,16}, {2059,12,17}, {2059,12,18}, {2059,12,19}, {2059,12,20}, {2059,12,21}, {2059,12,22}, {2059,12,23}, {2059,12,24}, {2059,12,25}, {2059,12,26}, {2059,12,27}, {2059,12,28}, {2059,12,29}, {2059,12,30}, {2059,12,31}, {2060,1,1}, {2060,1,2}, {2060,1,3}, {2060,1,4}, {2060,1,5}, {2060,1,6}, {2060,1,7}, {2060,1,8}, {2060,1,9}, {2060,1,10}, {2060,1,11}, {2060,1,12}, 
-{2060,1,13}, {2060,1,14}, {2060,1,15}, {2060,1,16}, {2060,1,17}, {2060,1,18}, {2060,1,19}, {2060,1,20}, {2060,1,21}, {2060,1,22}, {2060,1,23}, {2060,1,24}, {2060,1,25}, {2060,1,26}, {2060,1,27}, {2060,1,28}, {2060,1,29}, {2060,1,30}, {2060,1,31}, {2060,2,1}, {2060,2,2}, {2060,2,3}, {2060,2,4}, {2060,2,5}, {2060,2,6}, {2060,2,7}, {2060,2,8}, {2060,2,9}, {2060,2,10}, {2060,2,11}, {2060,2,12}, {2060,2,13}, 
-{2060,2,14}, {2060,2,15}, {2060,2,16}, {2060,2,17}, {2060,2,18}, {2060,2,19}, {2060,2,20}, {2060,2,21}, {2060,2,22}, {2060,2,23}, {2060,2,24}, {2060,2,25}, {2060,2,26}, {2060,2,27}, {2060,2,28}, {2060,2,29}, {2060,3,1}, {2060,3,2}, {2060,3,3}, {2060,3,4}, {2060,3,5}, {2060,3,6}, {2060,3,7}, {2060,3,8}, {2060,3,9}, {2060,3,10}, {2060,3,11}, {2060,3,12}, {2060,3,13}, {2060,3,14}, {2060,3,15}, {2060,3,16}, 
-{2060,3,17}, {2060,3,18}, {2060,3,19}, {2060,3,20}, {2060,3,21}, {2060,3,22}, {2060,3,23}, {2060,3,24}, {2060,3,25}, {2060,3,26}, {2060,3,27}, {2060,3,28}, {2060,3,29}, {2060,3,30}, {2060,3,31}, {2060,4,1}, {2060,4,2}, {2060,4,3}, {2060,4,4}, {2060,4,5}, {2060,4,6}, {2060,4,7}, {2060,4,8}, {2060,4,9}, {2060,4,10}, {2060,4,11}, {2060,4,12}, {2060,4,13}, {2060,4,14}, {2060,4,15}, {2060,4,16}, {2060,4,17}, 
-{2060,4,18}, {2060,4,19}, {2060,4,20}, {2060,4,21}, {2060,4,22}, {2060,4,23}, {2060,4,24}, {2060,4,25}, {2060,4,26}, {2060,4,27}, {2060,4,28}, {2060,4,29}, {2060,4,30}, {2060,5,1}, {2060,5,2}, {2060,5,3}, {2060,5,4}, {2060,5,5}, {2060,5,6}, {2060,5,7}, {2060,5,8}, {2060,5,9}, {2060,5,10}, {2060,5,11}, {2060,5,12}, {2060,5,13}, {2060,5,14}, {2060,5,15}, {2060,5,16}, {2060,5,17}, {2060,5,18}, {2060,5,19}, 
-{2060,5,20}, {2060,5,21}, {2060,5,22}, {2060,5,23}, {2060,5,24}, {2060,5,25}, {2060,5,26}, {2060,5,27}, {2060,5,28}, {2060,5,29}, {2060,5,30}, {2060,5,31}, {2060,6,1}, {2060,6,2}, {2060,6,3}, {2060,6,4}, {2060,6,5}, {2060,6,6}, {2060,6,7}, {2060,6,8}, {2060,6,9}, {2060,6,10}, {2060,6,11}, {2060,6,12}, {2060,6,13}, {2060,6,14}, {2060,6,15}, {2060,6,16}, {2060,6,17}, {2060,6,18}, {2060,6,19}, {2060,6,20}, 
-{2060,6,21}, {2060,6,22}, {2060,6,23}, {2060,6,24}, {2060,6,25}, {2060,6,26}, {2060,6,27}, {2060,6,28}, {2060,6,29}, {2060,6,30}, {2060,7,1}, {2060,7,2}, {2060,7,3}, {2060,7,4}, {2060,7,5}, {2060,7,6}, {2060,7,7}, {2060,7,8}, {2060,7,9}, {2060,7,10}, {2060,7,11}, {2060,7,12}, {2060,7,13}, {2060,7,14}, {2060,7,15}, {2060,7,16}, {2060,7,17}, {2060,7,18}, {2060,7,19}, {2060,7,20}, {2060,7,21}, {2060,7,22}, 
-{2060,7,23}, {2060,7,24}, {2060,7,25}, {2060,7,26}, {2060,7,27}, {2060,7,28}, {2060,7,29}, {2060,7,30}, {2060,7,31}, {2060,8,1}, {2060,8,2}, {2060,8,3}, {2060,8,4}, {2060,8,5}, {2060,8,6}, {2060,8,7}, {2060,8,8}, {2060,8,9}, {2060,8,10}, {2060,8,11}, {2060,8,12}, {2060,8,13}, {2060,8,14}, {2060,8,15}, {2060,8,16}, {2060,8,17}, {2060,8,18}, {2060,8,19}, {2060,8,20}, {2060,8,21}, {2060,8,22}, {2060,8,23}, 
-{2060,8,24}, {2060,8,25}, {2060,8,26}, {2060,8,27}, {2060,8,28}, {2060,8,29}, {2060,8,30}, {2060,8,31}, {2060,9,1}, {2060,9,2}, {2060,9,3}, {2060,9,4}, {2060,9,5}, {2060,9,6}, {2060,9,7}, {2060,9,8}, {2060,9,9}, {2060,9,10}, {2060,9,11}, {2060,9,12}, {2060,9,13}, {2060,9,14}, {2060,9,15}, {2060,9,16}, {2060,9,17}, {2060,9,18}, {2060,9,19}, {2060,9,20}, {2060,9,21}, {2060,9,22}, {2060,9,23}, {2060,9,24}, 
-{2060,9,25}, {2060,9,26}, {2060,9,27}, {2060,9,28}, {2060,9,29}, {2060,9,30}, {2060,10,1}, {2060,10,2}, {2060,10,3}, {2060,10,4}, {2060,10,5}, {2060,10,6}, {2060,10,7}, {2060,10,8}, {2060,10,9}, {2060,10,10}, {2060,10,11}, {2060,10,12}, {2060,10,13}, {2060,10,14}, {2060,10,15}, {2060,10,16}, {2060,10,17}, {2060,10,18}, {2060,10,19}, {2060,10,20}, {2060,10,21}, {2060,10,22}, {2060,10,23}, {2060,10,24}, {2060,10,25}, {2060,10,26}, 
-{2060,10,27}, {2060,10,28}, {2060,10,29}, {2060,10,30}, {2060,10,31}, {2060,11,1}, {2060,11,2}, {2060,11,3}, {2060,11,4}, {2060,11,5}, {2060,11,6}, {2060,11,7}, {2060,11,8}, {2060,11,9}, {2060,11,10}, {2060,11,11}, {2060,11,12}, {2060,11,13}, {2060,11,14}, {2060,11,15}, {2060,11,16}, {2060,11,17}, {2060,11,18}, {2060,11,19}, {2060,11,20}, {2060,11,21}, {2060,11,22}, {2060,11,23}, {2060,11,24}, {2060,11,25}, {2060,11,26}, {2060,11,27}, 
-{2060,11,28}, {2060,11,29}, {2060,11,30}, {2060,12,1}, {2060,12,2}, {2060,12,3}, {2060,12,4}, {2060,12,5}, {2060,12,6}, {2060,12,7}, {2060,12,8}, {2060,12,9}, {2060,12,10}, {2060,12,11}, {2060,12,12}, {2060,12,13}, {2060,12,14}, {2060,12,15}, {2060,12,16}, {2060,12,17}, {2060,12,18}, {2060,12,19}, {2060,12,20}, {2060,12,21}, {2060,12,22}, {2060,12,23}, {2060,12,24}, {2060,12,25}, {2060,12,26}, {2060,12,27}, {2060,12,28}, {2060,12,29}, 
-{2060,12,30}, {2060,12,31}, {2061,1,1}, {2061,1,2}, {2061,1,3}, {2061,1,4}, {2061,1,5}, {2061,1,6}, {2061,1,7}, {2061,1,8}, {2061,1,9}, {2061,1,10}, {2061,1,11}, {2061,1,12}, {2061,1,13}, {2061,1,14}, {2061,1,15}, {2061,1,16}, {2061,1,17}, {2061,1,18}, {2061,1,19}, {2061,1,20}, {2061,1,21}, {2061,1,22}, {2061,1,23}, {2061,1,24}, {2061,1,25}, {2061,1,26}, {2061,1,27}, {2061,1,28}, {2061,1,29}, {2061,1,30}, 
-{2061,1,31}, {2061,2,1}, {2061,2,2}, {2061,2,3}, {2061,2,4}, {2061,2,5}, {2061,2,6}, {2061,2,7}, {2061,2,8}, {2061,2,9}, {2061,2,10}, {2061,2,11}, {2061,2,12}, {2061,2,13}, {2061,2,14}, {2061,2,15}, {2061,2,16}, {2061,2,17}, {2061,2,18}, {2061,2,19}, {2061,2,20}, {2061,2,21}, {2061,2,22}, {2061,2,23}, {2061,2,24}, {2061,2,25}, {2061,2,26}, {2061,2,27}, {2061,2,28}, {2061,3,1}, {2061,3,2}, {2061,3,3}, 
-{2061,3,4}, {2061,3,5}, {2061,3,6}, {2061,3,7}, {2061,3,8}, {2061,3,9}, {2061,3,10}, {2061,3,11}, {2061,3,12}, {2061,3,13}, {2061,3,14}, {2061,3,15}, {2061,3,16}, {2061,3,17}, {2061,3,18}, {2061,3,19}, {2061,3,20}, {2061,3,21}, {2061,3,22}, {2061,3,23}, {2061,3,24}, {2061,3,25}, {2061,3,26}, {2061,3,27}, {2061,3,28}, {2061,3,29}, {2061,3,30}, {2061,3,31}, {2061,4,1}, {2061,4,2}, {2061,4,3}, {2061,4,4}, 
-{2061,4,5}, {2061,4,6}, {2061,4,7}, {2061,4,8}, {2061,4,9}, {2061,4,10}, {2061,4,11}, {2061,4,12}, {2061,4,13}, {2061,4,14}, {2061,4,15}, {2061,4,16}, {2061,4,17}, {2061,4,18}, {2061,4,19}, {2061,4,20}, {2061,4,21}, {2061,4,22}, {2061,4,23}, {2061,4,24}, {2061,4,25}, {2061,4,26}, {2061,4,27}, {2061,4,28}, {2061,4,29}, {2061,4,30}, {2061,5,1}, {2061,5,2}, {2061,5,3}, {2061,5,4}, {2061,5,5}, {2061,5,6}, 
-{2061,5,7}, {2061,5,8}, {2061,5,9}, {2061,5,10}, {2061,5,11}, {2061,5,12}, {2061,5,13}, {2061,5,14}, {2061,5,15}, {2061,5,16}, {2061,5,17}, {2061,5,18}, {2061,5,19}, {2061,5,20}, {2061,5,21}, {2061,5,22}, {2061,5,23}, {2061,5,24}, {2061,5,25}, {2061,5,26}, {2061,5,27}, {2061,5,28}, {2061,5,29}, {2061,5,30}, {2061,5,31}, {2061,6,1}, {2061,6,2}, {2061,6,3}, {2061,6,4}, {2061,6,5}, {2061,6,6}, {2061,6,7}, 
-{2061,6,8}, {2061,6,9}, {2061,6,10}, {2061,6,11}, {2061,6,12}, {2061,6,13}, {2061,6,14}, {2061,6,15}, {2061,6,16}, {2061,6,17}, {2061,6,18}, {2061,6,19}, {2061,6,20}, {2061,6,21}, {2061,6,22}, {2061,6,23}, {2061,6,24}, {2061,6,25}, {2061,6,26}, {2061,6,27}, {2061,6,28}, {2061,6,29}, {2061,6,30}, {2061,7,1}, {2061,7,2}, {2061,7,3}, {2061,7,4}, {2061,7,5}, {2061,7,6}, {2061,7,7}, {2061,7,8}, {2061,7,9}, 
-{2061,7,10}, {2061,7,11}, {2061,7,12}, {2061,7,13}, {2061,7,14}, {2061,7,15}, {2061,7,16}, {2061,7,17}, {2061,7,18}, {2061,7,19}, {2061,7,20}, {2061,7,21}, {2061,7,22}, {2061,7,23}, {2061,7,24}, {2061,7,25}, {2061,7,26}, {2061,7,27}, {2061,7,28}, {2061,7,29}, {2061,7,30}, {2061,7,31}, {2061,8,1}, {2061,8,2}, {2061,8,3}, {2061,8,4}, {2061,8,5}, {2061,8,6}, {2061,8,7}, {2061,8,8}, {2061,8,9}, {2061,8,10}, 
-{2061,8,11}, {2061,8,12}, {2061,8,13}, {2061,8,14}, {2061,8,15}, {2061,8,16}, {2061,8,17}, {2061,8,18}, {2061,8,19}, {2061,8,20}, {2061,8,21}, {2061,8,22}, {2061,8,23}, {2061,8,24}, {2061,8,25}, {2061,8,26}, {2061,8,27}, {2061,8,28}, {2061,8,29}, {2061,8,30}, {2061,8,31}, {2061,9,1}, {2061,9,2}, {2061,9,3}, {2061,9,4}, {2061,9,5}, {2061,9,6}, {2061,9,7}, {2061,9,8}, {2061,9,9}, {2061,9,10}, {2061,9,11}, 
-{2061,9,12}, {2061,9,13}, {2061,9,14}, {2061,9,15}, {2061,9,16}, {2061,9,17}, {2061,9,18}, {2061,9,19}, {2061,9,20}, {2061,9,21}, {2061,9,22}, {2061,9,23}, {2061,9,24}, {2061,9,25}, {2061,9,26}, {2061,9,27}, {2061,9,28}, {2061,9,29}, {2061,9,30}, {2061,10,1}, {2061,10,2}, {2061,10,3}, {2061,10,4}, {2061,10,5}, {2061,10,6}, {2061,10,7}, {2061,10,8}, {2061,10,9}, {2061,10,10}, {2061,10,11}, {2061,10,12}, {2061,10,13}, 
-{2061,10,14}, {2061,10,15}, {2061,10,16}, {2061,10,17}, {2061,10,18}, {2061,10,19}, {2061,10,20}, {2061,10,21}, {2061,10,22}, {2061,10,23}, {2061,10,24}, {2061,10,25}, {2061,10,26}, {2061,10,27}, {2061,10,28}, {2061,10,29}, {2061,10,30}, {2061,10,31}, {2061,11,1}, {2061,11,2}, {2061,11,3}, {2061,11,4}, {2061,11,5}, {2061,11,6}, {2061,11,7}, {2061,11,8}, {2061,11,9}, {2061,11,10}, {2061,11,11}, {2061,11,12}, {2061,11,13}, {2061,11,14}, 
-{2061,11,15}, {2061,11,16}, {2061,11,17}, {2061,11,18}, {2061,11,19}, {2061,11,20}, {2061,11,21}, {2061,11,22}, {2061,11,23}, {2061,11,24}, {2061,11,25}, {2061,11,26}, {2061,11,27}, {2061,11,28}, {2061,11,29}, {2061,11,30}, {2061,12,1}, {2061,12,2}, {2061,12,3}, {2061,12,4}, {2061,12,5}, {2061,12,6}, {2061,12,7}, {2061,12,8}, {2061,12,9}, {2061,12,10}, {2061,12,11}, {2061,12,12}, {2061,12,13}, {2061,12,14}, {2061,12,15}, {2061,12,16}, 
-{2061,12,17}, {2061,12,18}, {2061,12,19}, {2061,12,20}, {2061,12,21}, {2061,12,22}, {2061,12,23}, {2061,12,24}, {2061,12,25}, {2061,12,26}, {2061,12,27}, {2061,12,28}, {2061,12,29}, {2061,12,30}, {2061,12,31}, {2062,1,1}, {2062,1,2}, {2062,1,3}, {2062,1,4}, {2062,1,5}, {2062,1,6}, {2062,1,7}, {2062,1,8}, {2062,1,9}, {2062,1,10}, {2062,1,11}, {2062,1,12}, {2062,1,13}, {2062,1,14}, {2062,1,15}, {2062,1,16}, {2062,1,17}, 
-{2062,1,18}, {2062,1,19}, {2062,1,20}, {2062,1,21}, {2062,1,22}, {2062,1,23}, {2062,1,24}, {2062,1,25}, {2062,1,26}, {2062,1,27}, {2062,1,28}, {2062,1,29}, {2062,1,30}, {2062,1,31}, {2062,2,1}, {2062,2,2}, {2062,2,3}, {2062,2,4}, {2062,2,5}, {2062,2,6}, {2062,2,7}, {2062,2,8}, {2062,2,9}, {2062,2,10}, {2062,2,11}, {2062,2,12}, {2062,2,13}, {2062,2,14}, {2062,2,15}, {2062,2,16}, {2062,2,17}, {2062,2,18}, 
-{2062,2,19}, {2062,2,20}, {2062,2,21}, {2062,2,22}, {2062,2,23}, {2062,2,24}, {2062,2,25}, {2062,2,26}, {2062,2,27}, {2062,2,28}, {2062,3,1}, {2062,3,2}, {2062,3,3}, {2062,3,4}, {2062,3,5}, {2062,3,6}, {2062,3,7}, {2062,3,8}, {2062,3,9}, {2062,3,10}, {2062,3,11}, {2062,3,12}, {2062,3,13}, {2062,3,14}, {2062,3,15}, {2062,3,16}, {2062,3,17}, {2062,3,18}, {2062,3,19}, {2062,3,20}, {2062,3,21}, {2062,3,22}, 
-{2062,3,23}, {2062,3,24}, {2062,3,25}, {2062,3,26}, {2062,3,27}, {2062,3,28}, {2062,3,29}, {2062,3,30}, {2062,3,31}, {2062,4,1}, {2062,4,2}, {2062,4,3}, {2062,4,4}, {2062,4,5}, {2062,4,6}, {2062,4,7}, {2062,4,8}, {2062,4,9}, {2062,4,10}, {2062,4,11}, {2062,4,12}, {2062,4,13}, {2062,4,14}, {2062,4,15}, {2062,4,16}, {2062,4,17}, {2062,4,18}, {2062,4,19}, {2062,4,20}, {2062,4,21}, {2062,4,22}, {2062,4,23}, 
-{2062,4,24}, {2062,4,25}, {2062,4,26}, {2062,4,27}, {2062,4,28}, {2062,4,29}, {2062,4,30}, {2062,5,1}, {2062,5,2}, {2062,5,3}, {2062,5,4}, {2062,5,5}, {2062,5,6}, {2062,5,7}, {2062,5,8}, {2062,5,9}, {2062,5,10}, {2062,5,11}, {2062,5,12}, {2062,5,13}, {2062,5,14}, {2062,5,15}, {2062,5,16}, {2062,5,17}, {2062,5,18}, {2062,5,19}, {2062,5,20}, {2062,5,21}, {2062,5,22}, {2062,5,23}, {2062,5,24}, {2062,5,25}, 
-{2062,5,26}, {2062,5,27}, {2062,5,28}, {2062,5,29}, {2062,5,30}, {2062,5,31}, {2062,6,1}, {2062,6,2}, {2062,6,3}, {2062,6,4}, {2062,6,5}, {2062,6,6}, {2062,6,7}, {2062,6,8}, {2062,6,9}, {2062,6,10}, {2062,6,11}, {2062,6,12}, {2062,6,13}, {2062,6,14}, {2062,6,15}, {2062,6,16}, {2062,6,17}, {2062,6,18}, {2062,6,19}, {2062,6,20}, {2062,6,21}, {2062,6,22}, {2062,6,23}, {2062,6,24}, {2062,6,25}, {2062,6,26}, 
-{2062,6,27}, {2062,6,28}, {2062,6,29}, {2062,6,30}, {2062,7,1}, {2062,7,2}, {2062,7,3}, {2062,7,4}, {2062,7,5}, {2062,7,6}, {2062,7,7}, {2062,7,8}, {2062,7,9}, {2062,7,10}, {2062,7,11}, {2062,7,12}, {2062,7,13}, {2062,7,14}, {2062,7,15}, {2062,7,16}, {2062,7,17}, {2062,7,18}, {2062,7,19}, {2062,7,20}, {2062,7,21}, {2062,7,22}, {2062,7,23}, {2062,7,24}, {2062,7,25}, {2062,7,26}, {2062,7,27}, {2062,7,28}, 
-{2062,7,29}, {2062,7,30}, {2062,7,31}, {2062,8,1}, {2062,8,2}, {2062,8,3}, {2062,8,4}, {2062,8,5}, {2062,8,6}, {2062,8,7}, {2062,8,8}, {2062,8,9}, {2062,8,10}, {2062,8,11}, {2062,8,12}, {2062,8,13}, {2062,8,14}, {2062,8,15}, {2062,8,16}, {2062,8,17}, {2062,8,18}, {2062,8,19}, {2062,8,20}, {2062,8,21}, {2062,8,22}, {2062,8,23}, {2062,8,24}, {2062,8,25}, {2062,8,26}, {2062,8,27}, {2062,8,28}, {2062,8,29}, 
-{2062,8,30}, {2062,8,31}, {2062,9,1}, {2062,9,2}, {2062,9,3}, {2062,9,4}, {2062,9,5}, {2062,9,6}, {2062,9,7}, {2062,9,8}, {2062,9,9}, {2062,9,10}, {2062,9,11}, {2062,9,12}, {2062,9,13}, {2062,9,14}, {2062,9,15}, {2062,9,16}, {2062,9,17}, {2062,9,18}, {2062,9,19}, {2062,9,20}, {2062,9,21}, {2062,9,22}, {2062,9,23}, {2062,9,24}, {2062,9,25}, {2062,9,26}, {2062,9,27}, {2062,9,28}, {2062,9,29}, {2062,9,30}, 
-{2062,10,1}, {2062,10,2}, {2062,10,3}, {2062,10,4}, {2062,10,5}, {2062,10,6}, {2062,10,7}, {2062,10,8}, {2062,10,9}, {2062,10,10}, {2062,10,11}, {2062,10,12}, {2062,10,13}, {2062,10,14}, {2062,10,15}, {2062,10,16}, {2062,10,17}, {2062,10,18}, {2062,10,19}, {2062,10,20}, {2062,10,21}, {2062,10,22}, {2062,10,23}, {2062,10,24}, {2062,10,25}, {2062,10,26}, {2062,10,27}, {2062,10,28}, {2062,10,29}, {2062,10,30}, {2062,10,31}, {2062,11,1}, 
-{2062,11,2}, {2062,11,3}, {2062,11,4}, {2062,11,5}, {2062,11,6}, {2062,11,7}, {2062,11,8}, {2062,11,9}, {2062,11,10}, {2062,11,11}, {2062,11,12}, {2062,11,13}, {2062,11,14}, {2062,11,15}, {2062,11,16}, {2062,11,17}, {2062,11,18}, {2062,11,19}, {2062,11,20}, {2062,11,21}, {2062,11,22}, {2062,11,23}, {2062,11,24}, {2062,11,25}, {2062,11,26}, {2062,11,27}, {2062,11,28}, {2062,11,29}, {2062,11,30}, {2062,12,1}, {2062,12,2}, {2062,12,3}, 
-{2062,12,4}, {2062,12,5}, {2062,12,6}, {2062,12,7}, {2062,12,8}, {2062,12,9}, {2062,12,10}, {2062,12,11}, {2062,12,12}, {2062,12,13}, {2062,12,14}, {2062,12,15}, {2062,12,16}, {2062,12,17}, {2062,12,18}, {2062,12,19}, {2062,12,20}, {2062,12,21}, {2062,12,22}, {2062,12,23}, {2062,12,24}, {2062,12,25}, {2062,12,26}, {2062,12,27}, {2062,12,28}, {2062,12,29}, {2062,12,30}, {2062,12,31}, {2063,1,1}, {2063,1,2}, {2063,1,3}, {2063,1,4}, 
-{2063,1,5}, {2063,1,6}, {2063,1,7}, {2063,1,8}, {2063,1,9}, {2063,1,10}, {2063,1,11}, {2063,1,12}, {2063,1,13}, {2063,1,14}, {2063,1,15}, {2063,1,16}, {2063,1,17}, {2063,1,18}, {2063,1,19}, {2063,1,20}, {2063,1,21}, {2063,1,22}, {2063,1,23}, {2063,1,24}, {2063,1,25}, {2063,1,26}, {2063,1,27}, {2063,1,28}, {2063,1,29}, {2063,1,30}, {2063,1,31}, {2063,2,1}, {2063,2,2}, {2063,2,3}, {2063,2,4}, {2063,2,5}, 
-{2063,2,6}, {2063,2,7}, {2063,2,8}, {2063,2,9}, {2063,2,10}, {2063,2,11}, {2063,2,12}, {2063,2,13}, {2063,2,14}, {2063,2,15}, {2063,2,16}, {2063,2,17}, {2063,2,18}, {2063,2,19}, {2063,2,20}, {2063,2,21}, {2063,2,22}, {2063,2,23}, {2063,2,24}, {2063,2,25}, {2063,2,26}, {2063,2,27}, {2063,2,28}, {2063,3,1}, {2063,3,2}, {2063,3,3}, {2063,3,4}, {2063,3,5}, {2063,3,6}, {2063,3,7}, {2063,3,8}, {2063,3,9}, 
-{2063,3,10}, {2063,3,11}, {2063,3,12}, {2063,3,13}, {2063,3,14}, {2063,3,15}, {2063,3,16}, {2063,3,17}, {2063,3,18}, {2063,3,19}, {2063,3,20}, {2063,3,21}, {2063,3,22}, {2063,3,23}, {2063,3,24}, {2063,3,25}, {2063,3,26}, {2063,3,27}, {2063,3,28}, {2063,3,29}, {2063,3,30}, {2063,3,31}, {2063,4,1}, {2063,4,2}, {2063,4,3}, {2063,4,4}, {2063,4,5}, {2063,4,6}, {2063,4,7}, {2063,4,8}, {2063,4,9}, {2063,4,10}, 
-{2063,4,11}, {2063,4,12}, {2063,4,13}, {2063,4,14}, {2063,4,15}, {2063,4,16}, {2063,4,17}, {2063,4,18}, {2063,4,19}, {2063,4,20}, {2063,4,21}, {2063,4,22}, {2063,4,23}, {2063,4,24}, {2063,4,25}, {2063,4,26}, {2063,4,27}, {2063,4,28}, {2063,4,29}, {2063,4,30}, {2063,5,1}, {2063,5,2}, {2063,5,3}, {2063,5,4}, {2063,5,5}, {2063,5,6}, {2063,5,7}, {2063,5,8}, {2063,5,9}, {2063,5,10}, {2063,5,11}, {2063,5,12}, 
-{2063,5,13}, {2063,5,14}, {2063,5,15}, {2063,5,16}, {2063,5,17}, {2063,5,18}, {2063,5,19}, {2063,5,20}, {2063,5,21}, {2063,5,22}, {2063,5,23}, {2063,5,24}, {2063,5,25}, {2063,5,26}, {2063,5,27}, {2063,5,28}, {2063,5,29}, {2063,5,30}, {2063,5,31}, {2063,6,1}, {2063,6,2}, {2063,6,3}, {2063,6,4}, {2063,6,5}, {2063,6,6}, {2063,6,7}, {2063,6,8}, {2063,6,9}, {2063,6,10}, {2063,6,11}, {2063,6,12}, {2063,6,13}, 
-{2063,6,14}, {2063,6,15}, {2063,6,16}, {2063,6,17}, {2063,6,18}, {2063,6,19}, {2063,6,20}, {2063,6,21}, {2063,6,22}, {2063,6,23}, {2063,6,24}, {2063,6,25}, {2063,6,26}, {2063,6,27}, {2063,6,28}, {2063,6,29}, {2063,6,30}, {2063,7,1}, {2063,7,2}, {2063,7,3}, {2063,7,4}, {2063,7,5}, {2063,7,6}, {2063,7,7}, {2063,7,8}, {2063,7,9}, {2063,7,10}, {2063,7,11}, {2063,7,12}, {2063,7,13}, {2063,7,14}, {2063,7,15}, 
-{2063,7,16}, {2063,7,17}, {2063,7,18}, {2063,7,19}, {2063,7,20}, {2063,7,21}, {2063,7,22}, {2063,7,23}, {2063,7,24}, {2063,7,25}, {2063,7,26}, {2063,7,27}, {2063,7,28}, {2063,7,29}, {2063,7,30}, {2063,7,31}, {2063,8,1}, {2063,8,2}, {2063,8,3}, {2063,8,4}, {2063,8,5}, {2063,8,6}, {2063,8,7}, {2063,8,8}, {2063,8,9}, {2063,8,10}, {2063,8,11}, {2063,8,12}, {2063,8,13}, {2063,8,14}, {2063,8,15}, {2063,8,16}, 
-{2063,8,17}, {2063,8,18}, {2063,8,19}, {2063,8,20}, {2063,8,21}, {2063,8,22}, {2063,8,23}, {2063,8,24}, {2063,8,25}, {2063,8,26}, {2063,8,27}, {2063,8,28}, {2063,8,29}, {2063,8,30}, {2063,8,31}, {2063,9,1}, {2063,9,2}, {2063,9,3}, {2063,9,4}, {2063,9,5}, {2063,9,6}, {2063,9,7}, {2063,9,8}, {2063,9,9}, {2063,9,10}, {2063,9,11}, {2063,9,12}, {2063,9,13}, {2063,9,14}, {2063,9,15}, {2063,9,16}, {2063,9,17}, 
-{2063,9,18}, {2063,9,19}, {2063,9,20}, {2063,9,21}, {2063,9,22}, {2063,9,23}, {2063,9,24}, {2063,9,25}, {2063,9,26}, {2063,9,27}, {2063,9,28}, {2063,9,29}, {2063,9,30}, {2063,10,1}, {2063,10,2}, {2063,10,3}, {2063,10,4}, {2063,10,5}, {2063,10,6}, {2063,10,7}, {2063,10,8}, {2063,10,9}, {2063,10,10}, {2063,10,11}, {2063,10,12}, {2063,10,13}, {2063,10,14}, {2063,10,15}, {2063,10,16}, {2063,10,17}, {2063,10,18}, {2063,10,19}, 
-{2063,10,20}, {2063,10,21}, {2063,10,22}, {2063,10,23}, {2063,10,24}, {2063,10,25}, {2063,10,26}, {2063,10,27}, {2063,10,28}, {2063,10,29}, {2063,10,30}, {2063,10,31}, {2063,11,1}, {2063,11,2}, {2063,11,3}, {2063,11,4}, {2063,11,5}, {2063,11,6}, {2063,11,7}, {2063,11,8}, {2063,11,9}, {2063,11,10}, {2063,11,11}, {2063,11,12}, {2063,11,13}, {2063,11,14}, {2063,11,15}, {2063,11,16}, {2063,11,17}, {2063,11,18}, {2063,11,19}, {2063,11,20}, 
-{2063,11,21}, {2063,11,22}, {2063,11,23}, {2063,11,24}, {2063,11,25}, {2063,11,26}, {2063,11,27}, {2063,11,28}, {2063,11,29}, {2063,11,30}, {2063,12,1}, {2063,12,2}, {2063,12,3}, {2063,12,4}, {2063,12,5}, {2063,12,6}, {2063,12,7}, {2063,12,8}, {2063,12,9}, {2063,12,10}, {2063,12,11}, {2063,12,12}, {2063,12,13}, {2063,12,14}, {2063,12,15}, {2063,12,16}, {2063,12,17}, {2063,12,18}, {2063,12,19}, {2063,12,20}, {2063,12,21}, {2063,12,22}, 
-{2063,12,23}, {2063,12,24}, {2063,12,25}, {2063,12,26}, {2063,12,27}, {2063,12,28}, {2063,12,29}, {2063,12,30}, {2063,12,31}, {2064,1,1}, {2064,1,2}, {2064,1,3}, {2064,1,4}, {2064,1,5}, {2064,1,6}, {2064,1,7}, {2064,1,8}, {2064,1,9}, {2064,1,10}, {2064,1,11}, {2064,1,12}, {2064,1,13}, {2064,1,14}, {2064,1,15}, {2064,1,16}, {2064,1,17}, {2064,1,18}, {2064,1,19}, {2064,1,20}, {2064,1,21}, {2064,1,22}, {2064,1,23}, 
-{2064,1,24}, {2064,1,25}, {2064,1,26}, {2064,1,27}, {2064,1,28}, {2064,1,29}, {2064,1,30}, {2064,1,31}, {2064,2,1}, {2064,2,2}, {2064,2,3}, {2064,2,4}, {2064,2,5}, {2064,2,6}, {2064,2,7}, {2064,2,8}, {2064,2,9}, {2064,2,10}, {2064,2,11}, {2064,2,12}, {2064,2,13}, {2064,2,14}, {2064,2,15}, {2064,2,16}, {2064,2,17}, {2064,2,18}, {2064,2,19}, {2064,2,20}, {2064,2,21}, {2064,2,22}, {2064,2,23}, {2064,2,24}, 
-{2064,2,25}, {2064,2,26}, {2064,2,27}, {2064,2,28}, {2064,2,29}, {2064,3,1}, {2064,3,2}, {2064,3,3}, {2064,3,4}, {2064,3,5}, {2064,3,6}, {2064,3,7}, {2064,3,8}, {2064,3,9}, {2064,3,10}, {2064,3,11}, {2064,3,12}, {2064,3,13}, {2064,3,14}, {2064,3,15}, {2064,3,16}, {2064,3,17}, {2064,3,18}, {2064,3,19}, {2064,3,20}, {2064,3,21}, {2064,3,22}, {2064,3,23}, {2064,3,24}, {2064,3,25}, {2064,3,26}, {2064,3,27}, 
-{2064,3,28}, {2064,3,29}, {2064,3,30}, {2064,3,31}, {2064,4,1}, {2064,4,2}, {2064,4,3}, {2064,4,4}, {2064,4,5}, {2064,4,6}, {2064,4,7}, {2064,4,8}, {2064,4,9}, {2064,4,10}, {2064,4,11}, {2064,4,12}, {2064,4,13}, {2064,4,14}, {2064,4,15}, {2064,4,16}, {2064,4,17}, {2064,4,18}, {2064,4,19}, {2064,4,20}, {2064,4,21}, {2064,4,22}, {2064,4,23}, {2064,4,24}, {2064,4,25}, {2064,4,26}, {2064,4,27}, {2064,4,28}, 
-{2064,4,29}, {2064,4,30}, {2064,5,1}, {2064,5,2}, {2064,5,3}, {2064,5,4}, {2064,5,5}, {2064,5,6}, {2064,5,7}, {2064,5,8}, {2064,5,9}, {2064,5,10}, {2064,5,11}, {2064,5,12}, {2064,5,13}, {2064,5,14}, {2064,5,15}, {2064,5,16}, {2064,5,17}, {2064,5,18}, {2064,5,19}, {2064,5,20}, {2064,5,21}, {2064,5,22}, {2064,5,23}, {2064,5,24}, {2064,5,25}, {2064,5,26}, {2064,5,27}, {2064,5,28}, {2064,5,29}, {2064,5,30}, 
-{2064,5,31}, {2064,6,1}, {2064,6,2}, {2064,6,3}, {2064,6,4}, {2064,6,5}, {2064,6,6}, {2064,6,7}, {2064,6,8}, {2064,6,9}, {2064,6,10}, {2064,6,11}, {2064,6,12}, {2064,6,13}, {2064,6,14}, {2064,6,15}, {2064,6,16}, {2064,6,17}, {2064,6,18}, {2064,6,19}, {2064,6,20}, {2064,6,21}, {2064,6,22}, {2064,6,23}, {2064,6,24}, {2064,6,25}, {2064,6,26}, {2064,6,27}, {2064,6,28}, {2064,6,29}, {2064,6,30}, {2064,7,1}, 
-{2064,7,2}, {2064,7,3}, {2064,7,4}, {2064,7,5}, {2064,7,6}, {2064,7,7}, {2064,7,8}, {2064,7,9}, {2064,7,10}, {2064,7,11}, {2064,7,12}, {2064,7,13}, {2064,7,14}, {2064,7,15}, {2064,7,16}, {2064,7,17}, {2064,7,18}, {2064,7,19}, {2064,7,20}, {2064,7,21}, {2064,7,22}, {2064,7,23}, {2064,7,24}, {2064,7,25}, {2064,7,26}, {2064,7,27}, {2064,7,28}, {2064,7,29}, {2064,7,30}, {2064,7,31}, {2064,8,1}, {2064,8,2}, 
-{2064,8,3}, {2064,8,4}, {2064,8,5}, {2064,8,6}, {2064,8,7}, {2064,8,8}, {2064,8,9}, {2064,8,10}, {2064,8,11}, {2064,8,12}, {2064,8,13}, {2064,8,14}, {2064,8,15}, {2064,8,16}, {2064,8,17}, {2064,8,18}, {2064,8,19}, {2064,8,20}, {2064,8,21}, {2064,8,22}, {2064,8,23}, {2064,8,24}, {2064,8,25}, {2064,8,26}, {2064,8,27}, {2064,8,28}, {2064,8,29}, {2064,8,30}, {2064,8,31}, {2064,9,1}, {2064,9,2}, {2064,9,3}, 
-{2064,9,4}, {2064,9,5}, {2064,9,6}, {2064,9,7}, {2064,9,8}, {2064,9,9}, {2064,9,10}, {2064,9,11}, {2064,9,12}, {2064,9,13}, {2064,9,14}, {2064,9,15}, {2064,9,16}, {2064,9,17}, {2064,9,18}, {2064,9,19}, {2064,9,20}, {2064,9,21}, {2064,9,22}, {2064,9,23}, {2064,9,24}, {2064,9,25}, {2064,9,26}, {2064,9,27}, {2064,9,28}, {2064,9,29}, {2064,9,30}, {2064,10,1}, {2064,10,2}, {2064,10,3}, {2064,10,4}, {2064,10,5}, 
-{2064,10,6}, {2064,10,7}, {2064,10,8}, {2064,10,9}, {2064,10,10}, {2064,10,11}, {2064,10,12}, {2064,10,13}, {2064,10,14}, {2064,10,15}, {2064,10,16}, {2064,10,17}, {2064,10,18}, {2064,10,19}, {2064,10,20}, {2064,10,21}, {2064,10,22}, {2064,10,23}, {2064,10,24}, {2064,10,25}, {2064,10,26}, {2064,10,27}, {2064,10,28}, {2064,10,29}, {2064,10,30}, {2064,10,31}, {2064,11,1}, {2064,11,2}, {2064,11,3}, {2064,11,4}, {2064,11,5}, {2064,11,6}, 
-{2064,11,7}, {2064,11,8}, {2064,11,9}, {2064,11,10}, {2064,11,11}, {2064,11,12}, {2064,11,13}, {2064,11,14}, {2064,11,15}, {2064,11,16}, {2064,11,17}, {2064,11,18}, {2064,11,19}, {2064,11,20}, {2064,11,21}, {2064,11,22}, {2064,11,23}, {2064,11,24}, {2064,11,25}, {2064,11,26}, {2064,11,27}, {2064,11,28}, {2064,11,29}, {2064,11,30}, {2064,12,1}, {2064,12,2}, {2064,12,3}, {2064,12,4}, {2064,12,5}, {2064,12,6}, {2064,12,7}, {2064,12,8}, 
-{2064,12,9}, {2064,12,10}, {2064,12,11}, {2064,12,12}, {2064,12,13}, {2064,12,14}, {2064,12,15}, {2064,12,16}, {2064,12,17}, {2064,12,18}, {2064,12,19}, {2064,12,20}, {2064,12,21}, {2064,12,22}, {2064,12,23}, {2064,12,24}, {2064,12,25}, {2064,12,26}, {2064,12,27}, {2064,12,28}, {2064,12,29}, {2064,12,30}, {2064,12,31}, {2065,1,1}, {2065,1,2}, {2065,1,3}, {2065,1,4}, {2065,1,5}, {2065,1,6}, {2065,1,7}, {2065,1,8}, {2065,1,9}, 
-{2065,1,10}, {2065,1,11}, {2065,1,12}, {2065,1,13}, {2065,1,14}, {2065,1,15}, {2065,1,16}, {2065,1,17}, {2065,1,18}, {2065,1,19}, {2065,1,20}, {2065,1,21}, {2065,1,22}, {2065,1,23}, {2065,1,24}, {2065,1,25}, {2065,1,26}, {2065,1,27}, {2065,1,28}, {2065,1,29}, {2065,1,30}, {2065,1,31}, {2065,2,1}, {2065,2,2}, {2065,2,3}, {2065,2,4}, {2065,2,5}, {2065,2,6}, {2065,2,7}, {2065,2,8}, {2065,2,9}, {2065,2,10}, 
-{2065,2,11}, {2065,2,12}, {2065,2,13}, {2065,2,14}, {2065,2,15}, {2065,2,16}, {2065,2,17}, {2065,2,18}, {2065,2,19}, {2065,2,20}, {2065,2,21}, {2065,2,22}, {2065,2,23}, {2065,2,24}, {2065,2,25}, {2065,2,26}, {2065,2,27}, {2065,2,28}, {2065,3,1}, {2065,3,2}, {2065,3,3}, {2065,3,4}, {2065,3,5}, {2065,3,6}, {2065,3,7}, {2065,3,8}, {2065,3,9}, {2065,3,10}, {2065,3,11}, {2065,3,12}, {2065,3,13}, {2065,3,14}, 
-{2065,3,15}, {2065,3,16}, {2065,3,17}, {2065,3,18}, {2065,3,19}, {2065,3,20}, {2065,3,21}, {2065,3,22}, {2065,3,23}, {2065,3,24}, {2065,3,25}, {2065,3,26}, {2065,3,27}, {2065,3,28}, {2065,3,29}, {2065,3,30}, {2065,3,31}, {2065,4,1}, {2065,4,2}, {2065,4,3}, {2065,4,4}, {2065,4,5}, {2065,4,6}, {2065,4,7}, {2065,4,8}, {2065,4,9}, {2065,4,10}, {2065,4,11}, {2065,4,12}, {2065,4,13}, {2065,4,14}, {2065,4,15}, 
-{2065,4,16}, {2065,4,17}, {2065,4,18}, {2065,4,19}, {2065,4,20}, {2065,4,21}, {2065,4,22}, {2065,4,23}, {2065,4,24}, {2065,4,25}, {2065,4,26}, {2065,4,27}, {2065,4,28}, {2065,4,29}, {2065,4,30}, {2065,5,1}, {2065,5,2}, {2065,5,3}, {2065,5,4}, {2065,5,5}, {2065,5,6}, {2065,5,7}, {2065,5,8}, {2065,5,9}, {2065,5,10}, {2065,5,11}, {2065,5,12}, {2065,5,13}, {2065,5,14}, {2065,5,15}, {2065,5,16}, {2065,5,17}, 
-{2065,5,18}, {2065,5,19}, {2065,5,20}, {2065,5,21}, {2065,5,22}, {2065,5,23}, {2065,5,24}, {2065,5,25}, {2065,5,26}, {2065,5,27}, {2065,5,28}, {2065,5,29}, {2065,5,30}, {2065,5,31}, {2065,6,1}, {2065,6,2}, {2065,6,3}, {2065,6,4}, {2065,6,5}, {2065,6,6}, {2065,6,7}, {2065,6,8}, {2065,6,9}, {2065,6,10}, {2065,6,11}, {2065,6,12}, {2065,6,13}, {2065,6,14}, {2065,6,15}, {2065,6,16}, {2065,6,17}, {2065,6,18}, 
-{2065,6,19}, {2065,6,20}, {2065,6,21}, {2065,6,22}, {2065,6,23}, {2065,6,24}, {2065,6,25}, {2065,6,26}, {2065,6,27}, {2065,6,28}, {2065,6,29}, {2065,6,30}, {2065,7,1}, {2065,7,2}, {2065,7,3}, {2065,7,4}, {2065,7,5}, {2065,7,6}, {2065,7,7}, {2065,7,8}, {2065,7,9}, {2065,7,10}, {2065,7,11}, {2065,7,12}, {2065,7,13}, {2065,7,14}, {2065,7,15}, {2065,7,16}, {2065,7,17}, {2065,7,18}, {2065,7,19}, {2065,7,20}, 
-{2065,7,21}, {2065,7,22}, {2065,7,23}, {2065,7,24}, {2065,7,25}, {2065,7,26}, {2065,7,27}, {2065,7,28}, {2065,7,29}, {2065,7,30}, {2065,7,31}, {2065,8,1}, {2065,8,2}, {2065,8,3}, {2065,8,4}, {2065,8,5}, {2065,8,6}, {2065,8,7}, {2065,8,8}, {2065,8,9}, {2065,8,10}, {2065,8,11}, {2065,8,12}, {2065,8,13}, {2065,8,14}, {2065,8,15}, {2065,8,16}, {2065,8,17}, {2065,8,18}, {2065,8,19}, {2065,8,20}, {2065,8,21}, 
-{2065,8,22}, {2065,8,23}, {2065,8,24}, {2065,8,25}, {2065,8,26}, {2065,8,27}, {2065,8,28}, {2065,8,29}, {2065,8,30}, {2065,8,31}, {2065,9,1}, {2065,9,2}, {2065,9,3}, {2065,9,4}, {2065,9,5}, {2065,9,6}, {2065,9,7}, {2065,9,8}, {2065,9,9}, {2065,9,10}, {2065,9,11}, {2065,9,12}, {2065,9,13}, {2065,9,14}, {2065,9,15}, {2065,9,16}, {2065,9,17}, {2065,9,18}, {2065,9,19}, {2065,9,20}, {2065,9,21}, {2065,9,22}, 
-{2065,9,23}, {2065,9,24}, {2065,9,25}, {2065,9,26}, {2065,9,27}, {2065,9,28}, {2065,9,29}, {2065,9,30}, {2065,10,1}, {2065,10,2}, {2065,10,3}, {2065,10,4}, {2065,10,5}, {2065,10,6}, {2065,10,7}, {2065,10,8}, {2065,10,9}, {2065,10,10}, {2065,10,11}, {2065,10,12}, {2065,10,13}, {2065,10,14}, {2065,10,15}, {2065,10,16}, {2065,10,17}, {2065,10,18}, {2065,10,19}, {2065,10,20}, {2065,10,21}, {2065,10,22}, {2065,10,23}, {2065,10,24}, 
-{2065,10,25}, {2065,10,26}, {2065,10,27}, {2065,10,28}, {2065,10,29}, {2065,10,30}, {2065,10,31}, {2065,11,1}, {2065,11,2}, {2065,11,3}, {2065,11,4}, {2065,11,5}, {2065,11,6}, {2065,11,7}, {2065,11,8}, {2065,11,9}, {2065,11,10}, {2065,11,11}, {2065,11,12}, {2065,11,13}, {2065,11,14}, {2065,11,15}, {2065,11,16}, {2065,11,17}, {2065,11,18}, {2065,11,19}, {2065,11,20}, {2065,11,21}, {2065,11,22}, {2065,11,23}, {2065,11,24}, {2065,11,25}, 
-{2065,11,26}, {2065,11,27}, {2065,11,28}, {2065,11,29}, {2065,11,30}, {2065,12,1}, {2065,12,2}, {2065,12,3}, {2065,12,4}, {2065,12,5}, {2065,12,6}, {2065,12,7}, {2065,12,8}, {2065,12,9}, {2065,12,10}, {2065,12,11}, {2065,12,12}, {2065,12,13}, {2065,12,14}, {2065,12,15}, {2065,12,16}, {2065,12,17}, {2065,12,18}, {2065,12,19}, {2065,12,20}, {2065,12,21}, {2065,12,22}, {2065,12,23}, {2065,12,24}, {2065,12,25}, {2065,12,26}, {2065,12,27}, 
-{2065,12,28}, {2065,12,29}, {2065,12,30}, {2065,12,31}, {2066,1,1}, {2066,1,2}, {2066,1,3}, {2066,1,4}, {2066,1,5}, {2066,1,6}, {2066,1,7}, {2066,1,8}, {2066,1,9}, {2066,1,10}, {2066,1,11}, {2066,1,12}, {2066,1,13}, {2066,1,14}, {2066,1,15}, {2066,1,16}, {2066,1,17}, {2066,1,18}, {2066,1,19}, {2066,1,20}, {2066,1,21}, {2066,1,22}, {2066,1,23}, {2066,1,24}, {2066,1,25}, {2066,1,26}, {2066,1,27}, {2066,1,28}, 
-{2066,1,29}, {2066,1,30}, {2066,1,31}, {2066,2,1}, {2066,2,2}, {2066,2,3}, {2066,2,4}, {2066,2,5}, {2066,2,6}, {2066,2,7}, {2066,2,8}, {2066,2,9}, {2066,2,10}, {2066,2,11}, {2066,2,12}, {2066,2,13}, {2066,2,14}, {2066,2,15}, {2066,2,16}, {2066,2,17}, {2066,2,18}, {2066,2,19}, {2066,2,20}, {2066,2,21}, {2066,2,22}, {2066,2,23}, {2066,2,24}, {2066,2,25}, {2066,2,26}, {2066,2,27}, {2066,2,28}, {2066,3,1}, 
-{2066,3,2}, {2066,3,3}, {2066,3,4}, {2066,3,5}, {2066,3,6}, {2066,3,7}, {2066,3,8}, {2066,3,9}, {2066,3,10}, {2066,3,11}, {2066,3,12}, {2066,3,13}, {2066,3,14}, {2066,3,15}, {2066,3,16}, {2066,3,17}, {2066,3,18}, {2066,3,19}, {2066,3,20}, {2066,3,21}, {2066,3,22}, {2066,3,23}, {2066,3,24}, {2066,3,25}, {2066,3,26}, {2066,3,27}, {2066,3,28}, {2066,3,29}, {2066,3,30}, {2066,3,31}, {2066,4,1}, {2066,4,2}, 
-{2066,4,3}, {2066,4,4}, {2066,4,5}, {2066,4,6}, {2066,4,7}, {2066,4,8}, {2066,4,9}, {2066,4,10}, {2066,4,11}, {2066,4,12}, {2066,4,13}, {2066,4,14}, {2066,4,15}, {2066,4,16}, {2066,4,17}, {2066,4,18}, {2066,4,19}, {2066,4,20}, {2066,4,21}, {2066,4,22}, {2066,4,23}, {2066,4,24}, {2066,4,25}, {2066,4,26}, {2066,4,27}, {2066,4,28}, {2066,4,29}, {2066,4,30}, {2066,5,1}, {2066,5,2}, {2066,5,3}, {2066,5,4}, 
-{2066,5,5}, {2066,5,6}, {2066,5,7}, {2066,5,8}, {2066,5,9}, {2066,5,10}, {2066,5,11}, {2066,5,12}, {2066,5,13}, {2066,5,14}, {2066,5,15}, {2066,5,16}, {2066,5,17}, {2066,5,18}, {2066,5,19}, {2066,5,20}, {2066,5,21}, {2066,5,22}, {2066,5,23}, {2066,5,24}, {2066,5,25}, {2066,5,26}, {2066,5,27}, {2066,5,28}, {2066,5,29}, {2066,5,30}, {2066,5,31}, {2066,6,1}, {2066,6,2}, {2066,6,3}, {2066,6,4}, {2066,6,5}, 
-{2066,6,6}, {2066,6,7}, {2066,6,8}, {2066,6,9}, {2066,6,10}, {2066,6,11}, {2066,6,12}, {2066,6,13}, {2066,6,14}, {2066,6,15}, {2066,6,16}, {2066,6,17}, {2066,6,18}, {2066,6,19}, {2066,6,20}, {2066,6,21}, {2066,6,22}, {2066,6,23}, {2066,6,24}, {2066,6,25}, {2066,6,26}, {2066,6,27}, {2066,6,28}, {2066,6,29}, {2066,6,30}, {2066,7,1}, {2066,7,2}, {2066,7,3}, {2066,7,4}, {2066,7,5}, {2066,7,6}, {2066,7,7}, 
-{2066,7,8}, {2066,7,9}, {2066,7,10}, {2066,7,11}, {2066,7,12}, {2066,7,13}, {2066,7,14}, {2066,7,15}, {2066,7,16}, {2066,7,17}, {2066,7,18}, {2066,7,19}, {2066,7,20}, {2066,7,21}, {2066,7,22}, {2066,7,23}, {2066,7,24}, {2066,7,25}, {2066,7,26}, {2066,7,27}, {2066,7,28}, {2066,7,29}, {2066,7,30}, {2066,7,31}, {2066,8,1}, {2066,8,2}, {2066,8,3}, {2066,8,4}, {2066,8,5}, {2066,8,6}, {2066,8,7}, {2066,8,8}, 
-{2066,8,9}, {2066,8,10}, {2066,8,11}, {2066,8,12}, {2066,8,13}, {2066,8,14}, {2066,8,15}, {2066,8,16}, {2066,8,17}, {2066,8,18}, {2066,8,19}, {2066,8,20}, {2066,8,21}, {2066,8,22}, {2066,8,23}, {2066,8,24}, {2066,8,25}, {2066,8,26}, {2066,8,27}, {2066,8,28}, {2066,8,29}, {2066,8,30}, {2066,8,31}, {2066,9,1}, {2066,9,2}, {2066,9,3}, {2066,9,4}, {2066,9,5}, {2066,9,6}, {2066,9,7}, {2066,9,8}, {2066,9,9}, 
-{2066,9,10}, {2066,9,11}, {2066,9,12}, {2066,9,13}, {2066,9,14}, {2066,9,15}, {2066,9,16}, {2066,9,17}, {2066,9,18}, {2066,9,19}, {2066,9,20}, {2066,9,21}, {2066,9,22}, {2066,9,23}, {2066,9,24}, {2066,9,25}, {2066,9,26}, {2066,9,27}, {2066,9,28}, {2066,9,29}, {2066,9,30}, {2066,10,1}, {2066,10,2}, {2066,10,3}, {2066,10,4}, {2066,10,5}, {2066,10,6}, {2066,10,7}, {2066,10,8}, {2066,10,9}, {2066,10,10}, {2066,10,11}, 
-{2066,10,12}, {2066,10,13}, {2066,10,14}, {2066,10,15}, {2066,10,16}, {2066,10,17}, {2066,10,18}, {2066,10,19}, {2066,10,20}, {2066,10,21}, {2066,10,22}, {2066,10,23}, {2066,10,24}, {2066,10,25}, {2066,10,26}, {2066,10,27}, {2066,10,28}, {2066,10,29}, {2066,10,30}, {2066,10,31}, {2066,11,1}, {2066,11,2}, {2066,11,3}, {2066,11,4}, {2066,11,5}, {2066,11,6}, {2066,11,7}, {2066,11,8}, {2066,11,9}, {2066,11,10}, {2066,11,11}, {2066,11,12}, 
-{2066,11,13}, {2066,11,14}, {2066,11,15}, {2066,11,16}, {2066,11,17}, {2066,11,18}, {2066,11,19}, {2066,11,20}, {2066,11,21}, {2066,11,22}, {2066,11,23}, {2066,11,24}, {2066,11,25}, {2066,11,26}, {2066,11,27}, {2066,11,28}, {2066,11,29}, {2066,11,30}, {2066,12,1}, {2066,12,2}, {2066,12,3}, {2066,12,4}, {2066,12,5}, {2066,12,6}, {2066,12,7}, {2066,12,8}, {2066,12,9}, {2066,12,10}, {2066,12,11}, {2066,12,12}, {2066,12,13}, {2066,12,14}, 
-{2066,12,15}, {2066,12,16}, {2066,12,17}, {2066,12,18}, {2066,12,19}, {2066,12,20}, {2066,12,21}, {2066,12,22}, {2066,12,23}, {2066,12,24}, {2066,12,25}, {2066,12,26}, {2066,12,27}, {2066,12,28}, {2066,12,29}, {2066,12,30}, {2066,12,31}, {2067,1,1}, {2067,1,2}, {2067,1,3}, {2067,1,4}, {2067,1,5}, {2067,1,6}, {2067,1,7}, {2067,1,8}, {2067,1,9}, {2067,1,10}, {2067,1,11}, {2067,1,12}, {2067,1,13}, {2067,1,14}, {2067,1,15}, 
-{2067,1,16}, {2067,1,17}, {2067,1,18}, {2067,1,19}, {2067,1,20}, {2067,1,21}, {2067,1,22}, {2067,1,23}, {2067,1,24}, {2067,1,25}, {2067,1,26}, {2067,1,27}, {2067,1,28}, {2067,1,29}, {2067,1,30}, {2067,1,31}, {2067,2,1}, {2067,2,2}, {2067,2,3}, {2067,2,4}, {2067,2,5}, {2067,2,6}, {2067,2,7}, {2067,2,8}, {2067,2,9}, {2067,2,10}, {2067,2,11}, {2067,2,12}, {2067,2,13}, {2067,2,14}, {2067,2,15}, {2067,2,16}, 
-{2067,2,17}, {2067,2,18}, {2067,2,19}, {2067,2,20}, {2067,2,21}, {2067,2,22}, {2067,2,23}, {2067,2,24}, {2067,2,25}, {2067,2,26}, {2067,2,27}, {2067,2,28}, {2067,3,1}, {2067,3,2}, {2067,3,3}, {2067,3,4}, {2067,3,5}, {2067,3,6}, {2067,3,7}, {2067,3,8}, {2067,3,9}, {2067,3,10}, {2067,3,11}, {2067,3,12}, {2067,3,13}, {2067,3,14}, {2067,3,15}, {2067,3,16}, {2067,3,17}, {2067,3,18}, {2067,3,19}, {2067,3,20}, 
-{2067,3,21}, {2067,3,22}, {2067,3,23}, {2067,3,24}, {2067,3,25}, {2067,3,26}, {2067,3,27}, {2067,3,28}, {2067,3,29}, {2067,3,30}, {2067,3,31}, {2067,4,1}, {2067,4,2}, {2067,4,3}, {2067,4,4}, {2067,4,5}, {2067,4,6}, {2067,4,7}, {2067,4,8}, {2067,4,9}, {2067,4,10}, {2067,4,11}, {2067,4,12}, {2067,4,13}, {2067,4,14}, {2067,4,15}, {2067,4,16}, {2067,4,17}, {2067,4,18}, {2067,4,19}, {2067,4,20}, {2067,4,21}, 
-{2067,4,22}, {2067,4,23}, {2067,4,24}, {2067,4,25}, {2067,4,26}, {2067,4,27}, {2067,4,28}, {2067,4,29}, {2067,4,30}, {2067,5,1}, {2067,5,2}, {2067,5,3}, {2067,5,4}, {2067,5,5}, {2067,5,6}, {2067,5,7}, {2067,5,8}, {2067,5,9}, {2067,5,10}, {2067,5,11}, {2067,5,12}, {2067,5,13}, {2067,5,14}, {2067,5,15}, {2067,5,16}, {2067,5,17}, {2067,5,18}, {2067,5,19}, {2067,5,20}, {2067,5,21}, {2067,5,22}, {2067,5,23}, 
-{2067,5,24}, {2067,5,25}, {2067,5,26}, {2067,5,27}, {2067,5,28}, {2067,5,29}, {2067,5,30}, {2067,5,31}, {2067,6,1}, {2067,6,2}, {2067,6,3}, {2067,6,4}, {2067,6,5}, {2067,6,6}, {2067,6,7}, {2067,6,8}, {2067,6,9}, {2067,6,10}, {2067,6,11}, {2067,6,12}, {2067,6,13}, {2067,6,14}, {2067,6,15}, {2067,6,16}, {2067,6,17}, {2067,6,18}, {2067,6,19}, {2067,6,20}, {2067,6,21}, {2067,6,22}, {2067,6,23}, {2067,6,24}, 
-{2067,6,25}, {2067,6,26}, {2067,6,27}, {2067,6,28}, {2067,6,29}, {2067,6,30}, {2067,7,1}, {2067,7,2}, {2067,7,3}, {2067,7,4}, {2067,7,5}, {2067,7,6}, {2067,7,7}, {2067,7,8}, {2067,7,9}, {2067,7,10}, {2067,7,11}, {2067,7,12}, {2067,7,13}, {2067,7,14}, {2067,7,15}, {2067,7,16}, {2067,7,17}, {2067,7,18}, {2067,7,19}, {2067,7,20}, {2067,7,21}, {2067,7,22}, {2067,7,23}, {2067,7,24}, {2067,7,25}, {2067,7,26}, 
-{2067,7,27}, {2067,7,28}, {2067,7,29}, {2067,7,30}, {2067,7,31}, {2067,8,1}, {2067,8,2}, {2067,8,3}, {2067,8,4}, {2067,8,5}, {2067,8,6}, {2067,8,7}, {2067,8,8}, {2067,8,9}, {2067,8,10}, {2067,8,11}, {2067,8,12}, {2067,8,13}, {2067,8,14}, {2067,8,15}, {2067,8,16}, {2067,8,17}, {2067,8,18}, {2067,8,19}, {2067,8,20}, {2067,8,21}, {2067,8,22}, {2067,8,23}, {2067,8,24}, {2067,8,25}, {2067,8,26}, {2067,8,27}, 
-{2067,8,28}, {2067,8,29}, {2067,8,30}, {2067,8,31}, {2067,9,1}, {2067,9,2}, {2067,9,3}, {2067,9,4}, {2067,9,5}, {2067,9,6}, {2067,9,7}, {2067,9,8}, {2067,9,9}, {2067,9,10}, {2067,9,11}, {2067,9,12}, {2067,9,13}, {2067,9,14}, {2067,9,15}, {2067,9,16}, {2067,9,17}, {2067,9,18}, {2067,9,19}, {2067,9,20}, {2067,9,21}, {2067,9,22}, {2067,9,23}, {2067,9,24}, {2067,9,25}, {2067,9,26}, {2067,9,27}, {2067,9,28}, 
-{2067,9,29}, {2067,9,30}, {2067,10,1}, {2067,10,2}, {2067,10,3}, {2067,10,4}, {2067,10,5}, {2067,10,6}, {2067,10,7}, {2067,10,8}, {2067,10,9}, {2067,10,10}, {2067,10,11}, {2067,10,12}, {2067,10,13}, {2067,10,14}, {2067,10,15}, {2067,10,16}, {2067,10,17}, {2067,10,18}, {2067,10,19}, {2067,10,20}, {2067,10,21}, {2067,10,22}, {2067,10,23}, {2067,10,24}, {2067,10,25}, {2067,10,26}, {2067,10,27}, {2067,10,28}, {2067,10,29}, {2067,10,30}, 
-{2067,10,31}, {2067,11,1}, {2067,11,2}, {2067,11,3}, {2067,11,4}, {2067,11,5}, {2067,11,6}, {2067,11,7}, {2067,11,8}, {2067,11,9}, {2067,11,10}, {2067,11,11}, {2067,11,12}, {2067,11,13}, {2067,11,14}, {2067,11,15}, {2067,11,16}, {2067,11,17}, {2067,11,18}, {2067,11,19}, {2067,11,20}, {2067,11,21}, {2067,11,22}, {2067,11,23}, {2067,11,24}, {2067,11,25}, {2067,11,26}, {2067,11,27}, {2067,11,28}, {2067,11,29}, {2067,11,30}, {2067,12,1}, 
-{2067,12,2}, {2067,12,3}, {2067,12,4}, {2067,12,5}, {2067,12,6}, {2067,12,7}, {2067,12,8}, {2067,12,9}, {2067,12,10}, {2067,12,11}, {2067,12,12}, {2067,12,13}, {2067,12,14}, {2067,12,15}, {2067,12,16}, {2067,12,17}, {2067,12,18}, {2067,12,19}, {2067,12,20}, {2067,12,21}, {2067,12,22}, {2067,12,23}, {2067,12,24}, {2067,12,25}, {2067,12,26}, {2067,12,27}, {2067,12,28}, {2067,12,29}, {2067,12,30}, {2067,12,31}, {2068,1,1}, {2068,1,2}, 
-{2068,1,3}, {2068,1,4}, {2068,1,5}, {2068,1,6}, {2068,1,7}, {2068,1,8}, {2068,1,9}, {2068,1,10}, {2068,1,11}, {2068,1,12}, {2068,1,13}, {2068,1,14}, {2068,1,15}, {2068,1,16}, {2068,1,17}, {2068,1,18}, {2068,1,19}, {2068,1,20}, {2068,1,21}, {2068,1,22}, {2068,1,23}, {2068,1,24}, {2068,1,25}, {2068,1,26}, {2068,1,27}, {2068,1,28}, {2068,1,29}, {2068,1,30}, {2068,1,31}, {2068,2,1}, {2068,2,2}, {2068,2,3}, 
-{2068,2,4}, {2068,2,5}, {2068,2,6}, {2068,2,7}, {2068,2,8}, {2068,2,9}, {2068,2,10}, {2068,2,11}, {2068,2,12}, {2068,2,13}, {2068,2,14}, {2068,2,15}, {2068,2,16}, {2068,2,17}, {2068,2,18}, {2068,2,19}, {2068,2,20}, {2068,2,21}, {2068,2,22}, {2068,2,23}, {2068,2,24}, {2068,2,25}, {2068,2,26}, {2068,2,27}, {2068,2,28}, {2068,2,29}, {2068,3,1}, {2068,3,2}, {2068,3,3}, {2068,3,4}, {2068,3,5}, {2068,3,6}, 
-{2068,3,7}, {2068,3,8}, {2068,3,9}, {2068,3,10}, {2068,3,11}, {2068,3,12}, {2068,3,13}, {2068,3,14}, {2068,3,15}, {2068,3,16}, {2068,3,17}, {2068,3,18}, {2068,3,19}, {2068,3,20}, {2068,3,21}, {2068,3,22}, {2068,3,23}, {2068,3,24}, {2068,3,25}, {2068,3,26}, {2068,3,27}, {2068,3,28}, {2068,3,29}, {2068,3,30}, {2068,3,31}, {2068,4,1}, {2068,4,2}, {2068,4,3}, {2068,4,4}, {2068,4,5}, {2068,4,6}, {2068,4,7}, 
-{2068,4,8}, {2068,4,9}, {2068,4,10}, {2068,4,11}, {2068,4,12}, {2068,4,13}, {2068,4,14}, {2068,4,15}, {2068,4,16}, {2068,4,17}, {2068,4,18}, {2068,4,19}, {2068,4,20}, {2068,4,21}, {2068,4,22}, {2068,4,23}, {2068,4,24}, {2068,4,25}, {2068,4,26}, {2068,4,27}, {2068,4,28}, {2068,4,29}, {2068,4,30}, {2068,5,1}, {2068,5,2}, {2068,5,3}, {2068,5,4}, {2068,5,5}, {2068,5,6}, {2068,5,7}, {2068,5,8}, {2068,5,9}, 
-{2068,5,10}, {2068,5,11}, {2068,5,12}, {2068,5,13}, {2068,5,14}, {2068,5,15}, {2068,5,16}, {2068,5,17}, {2068,5,18}, {2068,5,19}, {2068,5,20}, {2068,5,21}, {2068,5,22}, {2068,5,23}, {2068,5,24}, {2068,5,25}, {2068,5,26}, {2068,5,27}, {2068,5,28}, {2068,5,29}, {2068,5,30}, {2068,5,31}, {2068,6,1}, {2068,6,2}, {2068,6,3}, {2068,6,4}, {2068,6,5}, {2068,6,6}, {2068,6,7}, {2068,6,8}, {2068,6,9}, {2068,6,10}, 
-{2068,6,11}, {2068,6,12}, {2068,6,13}, {2068,6,14}, {2068,6,15}, {2068,6,16}, {2068,6,17}, {2068,6,18}, {2068,6,19}, {2068,6,20}, {2068,6,21}, {2068,6,22}, {2068,6,23}, {2068,6,24}, {2068,6,25}, {2068,6,26}, {2068,6,27}, {2068,6,28}, {2068,6,29}, {2068,6,30}, {2068,7,1}, {2068,7,2}, {2068,7,3}, {2068,7,4}, {2068,7,5}, {2068,7,6}, {2068,7,7}, {2068,7,8}, {2068,7,9}, {2068,7,10}, {2068,7,11}, {2068,7,12}, 
-{2068,7,13}, {2068,7,14}, {2068,7,15}, {2068,7,16}, {2068,7,17}, {2068,7,18}, {2068,7,19}, {2068,7,20}, {2068,7,21}, {2068,7,22}, {2068,7,23}, {2068,7,24}, {2068,7,25}, {2068,7,26}, {2068,7,27}, {2068,7,28}, {2068,7,29}, {2068,7,30}, {2068,7,31}, {2068,8,1}, {2068,8,2}, {2068,8,3}, {2068,8,4}, {2068,8,5}, {2068,8,6}, {2068,8,7}, {2068,8,8}, {2068,8,9}, {2068,8,10}, {2068,8,11}, {2068,8,12}, {2068,8,13}, 
-{2068,8,14}, {2068,8,15}, {2068,8,16}, {2068,8,17}, {2068,8,18}, {2068,8,19}, {2068,8,20}, {2068,8,21}, {2068,8,22}, {2068,8,23}, {2068,8,24}, {2068,8,25}, {2068,8,26}, {2068,8,27}, {2068,8,28}, {2068,8,29}, {2068,8,30}, {2068,8,31}, {2068,9,1}, {2068,9,2}, {2068,9,3}, {2068,9,4}, {2068,9,5}, {2068,9,6}, {2068,9,7}, {2068,9,8}, {2068,9,9}, {2068,9,10}, {2068,9,11}, {2068,9,12}, {2068,9,13}, {2068,9,14}, 
-{2068,9,15}, {2068,9,16}, {2068,9,17}, {2068,9,18}, {2068,9,19}, {2068,9,20}, {2068,9,21}, {2068,9,22}, {2068,9,23}, {2068,9,24}, {2068,9,25}, {2068,9,26}, {2068,9,27}, {2068,9,28}, {2068,9,29}, {2068,9,30}, {2068,10,1}, {2068,10,2}, {2068,10,3}, {2068,10,4}, {2068,10,5}, {2068,10,6}, {2068,10,7}, {2068,10,8}, {2068,10,9}, {2068,10,10}, {2068,10,11}, {2068,10,12}, {2068,10,13}, {2068,10,14}, {2068,10,15}, {2068,10,16}, 
-{2068,10,17}, {2068,10,18}, {2068,10,19}, {2068,10,20}, {2068,10,21}, {2068,10,22}, {2068,10,23}, {2068,10,24}, {2068,10,25}, {2068,10,26}, {2068,10,27}, {2068,10,28}, {2068,10,29}, {2068,10,30}, {2068,10,31}, {2068,11,1}, {2068,11,2}, {2068,11,3}, {2068,11,4}, {2068,11,5}, {2068,11,6}, {2068,11,7}, {2068,11,8}, {2068,11,9}, {2068,11,10}, {2068,11,11}, {2068,11,12}, {2068,11,13}, {2068,11,14}, {2068,11,15}, {2068,11,16}, {2068,11,17}, 
-{2068,11,18}, {2068,11,19}, {2068,11,20}, {2068,11,21}, {2068,11,22}, {2068,11,23}, {2068,11,24}, {2068,11,25}, {2068,11,26}, {2068,11,27}, {2068,11,28}, {2068,11,29}, {2068,11,30}, {2068,12,1}, {2068,12,2}, {2068,12,3}, {2068,12,4}, {2068,12,5}, {2068,12,6}, {2068,12,7}, {2068,12,8}, {2068,12,9}, {2068,12,10}, {2068,12,11}, {2068,12,12}, {2068,12,13}, {2068,12,14}, {2068,12,15}, {2068,12,16}, {2068,12,17}, {2068,12,18}, {2068,12,19}, 
-{2068,12,20}, {2068,12,21}, {2068,12,22}, {2068,12,23}, {2068,12,24}, {2068,12,25}, {2068,12,26}, {2068,12,27}, {2068,12,28}, {2068,12,29}, {2068,12,30}, {2068,12,31}, {2069,1,1}, {2069,1,2}, {2069,1,3}, {2069,1,4}, {2069,1,5}, {2069,1,6}, {2069,1,7}, {2069,1,8}, {2069,1,9}, {2069,1,10}, {2069,1,11}, {2069,1,12}, {2069,1,13}, {2069,1,14}, {2069,1,15}, {2069,1,16}, {2069,1,17}, {2069,1,18}, {2069,1,19}, {2069,1,20}, 
-{2069,1,21}, {2069,1,22}, {2069,1,23}, {2069,1,24}, {2069,1,25}, {2069,1,26}, {2069,1,27}, {2069,1,28}, {2069,1,29}, {2069,1,30}, {2069,1,31}, {2069,2,1}, {2069,2,2}, {2069,2,3}, {2069,2,4}, {2069,2,5}, {2069,2,6}, {2069,2,7}, {2069,2,8}, {2069,2,9}, {2069,2,10}, {2069,2,11}, {2069,2,12}, {2069,2,13}, {2069,2,14}, {2069,2,15}, {2069,2,16}, {2069,2,17}, {2069,2,18}, {2069,2,19}, {2069,2,20}, {2069,2,21}, 
-{2069,2,22}, {2069,2,23}, {2069,2,24}, {2069,2,25}, {2069,2,26}, {2069,2,27}, {2069,2,28}, {2069,3,1}, {2069,3,2}, {2069,3,3}, {2069,3,4}, {2069,3,5}, {2069,3,6}, {2069,3,7}, {2069,3,8}, {2069,3,9}, {2069,3,10}, {2069,3,11}, {2069,3,12}, {2069,3,13}, {2069,3,14}, {2069,3,15}, {2069,3,16}, {2069,3,17}, {2069,3,18}, {2069,3,19}, {2069,3,20}, {2069,3,21}, {2069,3,22}, {2069,3,23}, {2069,3,24}, {2069,3,25}, 
-{2069,3,26}, {2069,3,27}, {2069,3,28}, {2069,3,29}, {2069,3,30}, {2069,3,31}, {2069,4,1}, {2069,4,2}, {2069,4,3}, {2069,4,4}, {2069,4,5}, {2069,4,6}, {2069,4,7}, {2069,4,8}, {2069,4,9}, {2069,4,10}, {2069,4,11}, {2069,4,12}, {2069,4,13}, {2069,4,14}, {2069,4,15}, {2069,4,16}, {2069,4,17}, {2069,4,18}, {2069,4,19}, {2069,4,20}, {2069,4,21}, {2069,4,22}, {2069,4,23}, {2069,4,24}, {2069,4,25}, {2069,4,26}, 
-{2069,4,27}, {2069,4,28}, {2069,4,29}, {2069,4,30}, {2069,5,1}, {2069,5,2}, {2069,5,3}, {2069,5,4}, {2069,5,5}, {2069,5,6}, {2069,5,7}, {2069,5,8}, {2069,5,9}, {2069,5,10}, {2069,5,11}, {2069,5,12}, {2069,5,13}, {2069,5,14}, {2069,5,15}, {2069,5,16}, {2069,5,17}, {2069,5,18}, {2069,5,19}, {2069,5,20}, {2069,5,21}, {2069,5,22}, {2069,5,23}, {2069,5,24}, {2069,5,25}, {2069,5,26}, {2069,5,27}, {2069,5,28}, 
-{2069,5,29}, {2069,5,30}, {2069,5,31}, {2069,6,1}, {2069,6,2}, {2069,6,3}, {2069,6,4}, {2069,6,5}, {2069,6,6}, {2069,6,7}, {2069,6,8}, {2069,6,9}, {2069,6,10}, {2069,6,11}, {2069,6,12}, {2069,6,13}, {2069,6,14}, {2069,6,15}, {2069,6,16}, {2069,6,17}, {2069,6,18}, {2069,6,19}, {2069,6,20}, {2069,6,21}, {2069,6,22}, {2069,6,23}, {2069,6,24}, {2069,6,25}, {2069,6,26}, {2069,6,27}, {2069,6,28}, {2069,6,29}, 
-{2069,6,30}, {2069,7,1}, {2069,7,2}, {2069,7,3}, {2069,7,4}, {2069,7,5}, {2069,7,6}, {2069,7,7}, {2069,7,8}, {2069,7,9}, {2069,7,10}, {2069,7,11}, {2069,7,12}, {2069,7,13}, {2069,7,14}, {2069,7,15}, {2069,7,16}, {2069,7,17}, {2069,7,18}, {2069,7,19}, {2069,7,20}, {2069,7,21}, {2069,7,22}, {2069,7,23}, {2069,7,24}, {2069,7,25}, {2069,7,26}, {2069,7,27}, {2069,7,28}, {2069,7,29}, {2069,7,30}, {2069,7,31}, 
-{2069,8,1}, {2069,8,2}, {2069,8,3}, {2069,8,4}, {2069,8,5}, {2069,8,6}, {2069,8,7}, {2069,8,8}, {2069,8,9}, {2069,8,10}, {2069,8,11}, {2069,8,12}, {2069,8,13}, {2069,8,14}, {2069,8,15}, {2069,8,16}, {2069,8,17}, {2069,8,18}, {2069,8,19}, {2069,8,20}, {2069,8,21}, {2069,8,22}, {2069,8,23}, {2069,8,24}, {2069,8,25}, {2069,8,26}, {2069,8,27}, {2069,8,28}, {2069,8,29}, {2069,8,30}, {2069,8,31}, {2069,9,1}, 
-{2069,9,2}, {2069,9,3}, {2069,9,4}, {2069,9,5}, {2069,9,6}, {2069,9,7}, {2069,9,8}, {2069,9,9}, {2069,9,10}, {2069,9,11}, {2069,9,12}, {2069,9,13}, {2069,9,14}, {2069,9,15}, {2069,9,16}, {2069,9,17}, {2069,9,18}, {2069,9,19}, {2069,9,20}, {2069,9,21}, {2069,9,22}, {2069,9,23}, {2069,9,24}, {2069,9,25}, {2069,9,26}, {2069,9,27}, {2069,9,28}, {2069,9,29}, {2069,9,30}, {2069,10,1}, {2069,10,2}, {2069,10,3}, 
-{2069,10,4}, {2069,10,5}, {2069,10,6}, {2069,10,7}, {2069,10,8}, {2069,10,9}, {2069,10,10}, {2069,10,11}, {2069,10,12}, {2069,10,13}, {2069,10,14}, {2069,10,15}, {2069,10,16}, {2069,10,17}, {2069,10,18}, {2069,10,19}, {2069,10,20}, {2069,10,21}, {2069,10,22}, {2069,10,23}, {2069,10,24}, {2069,10,25}, {2069,10,26}, {2069,10,27}, {2069,10,28}, {2069,10,29}, {2069,10,30}, {2069,10,31}, {2069,11,1}, {2069,11,2}, {2069,11,3}, {2069,11,4}, 
-{2069,11,5}, {2069,11,6}, {2069,11,7}, {2069,11,8}, {2069,11,9}, {2069,11,10}, {2069,11,11}, {2069,11,12}, {2069,11,13}, {2069,11,14}, {2069,11,15}, {2069,11,16}, {2069,11,17}, {2069,11,18}, {2069,11,19}, {2069,11,20}, {2069,11,21}, {2069,11,22}, {2069,11,23}, {2069,11,24}, {2069,11,25}, {2069,11,26}, {2069,11,27}, {2069,11,28}, {2069,11,29}, {2069,11,30}, {2069,12,1}, {2069,12,2}, {2069,12,3}, {2069,12,4}, {2069,12,5}, {2069,12,6}, 
-{2069,12,7}, {2069,12,8}, {2069,12,9}, {2069,12,10}, {2069,12,11}, {2069,12,12}, {2069,12,13}, {2069,12,14}, {2069,12,15}, {2069,12,16}, {2069,12,17}, {2069,12,18}, {2069,12,19}, {2069,12,20}, {2069,12,21}, {2069,12,22}, {2069,12,23}, {2069,12,24}, {2069,12,25}, {2069,12,26}, {2069,12,27}, {2069,12,28}, {2069,12,29}, {2069,12,30}, {2069,12,31}, {2070,1,1}, {2070,1,2}, {2070,1,3}, {2070,1,4}, {2070,1,5}, {2070,1,6}, {2070,1,7}, 
-{2070,1,8}, {2070,1,9}, {2070,1,10}, {2070,1,11}, {2070,1,12}, {2070,1,13}, {2070,1,14}, {2070,1,15}, {2070,1,16}, {2070,1,17}, {2070,1,18}, {2070,1,19}, {2070,1,20}, {2070,1,21}, {2070,1,22}, {2070,1,23}, {2070,1,24}, {2070,1,25}, {2070,1,26}, {2070,1,27}, {2070,1,28}, {2070,1,29}, {2070,1,30}, {2070,1,31}, {2070,2,1}, {2070,2,2}, {2070,2,3}, {2070,2,4}, {2070,2,5}, {2070,2,6}, {2070,2,7}, {2070,2,8}, 
-{2070,2,9}, {2070,2,10}, {2070,2,11}, {2070,2,12}, {2070,2,13}, {2070,2,14}, {2070,2,15}, {2070,2,16}, {2070,2,17}, {2070,2,18}, {2070,2,19}, {2070,2,20}, {2070,2,21}, {2070,2,22}, {2070,2,23}, {2070,2,24}, {2070,2,25}, {2070,2,26}, {2070,2,27}, {2070,2,28}, {2070,3,1}, {2070,3,2}, {2070,3,3}, {2070,3,4}, {2070,3,5}, {2070,3,6}, {2070,3,7}, {2070,3,8}, {2070,3,9}, {2070,3,10}, {2070,3,11}, {2070,3,12}, 
-{2070,3,13}, {2070,3,14}, {2070,3,15}, {2070,3,16}, {2070,3,17}, {2070,3,18}, {2070,3,19}, {2070,3,20}, {2070,3,21}, {2070,3,22}, {2070,3,23}, {2070,3,24}, {2070,3,25}, {2070,3,26}, {2070,3,27}, {2070,3,28}, {2070,3,29}, {2070,3,30}, {2070,3,31}, {2070,4,1}, {2070,4,2}, {2070,4,3}, {2070,4,4}, {2070,4,5}, {2070,4,6}, {2070,4,7}, {2070,4,8}, {2070,4,9}, {2070,4,10}, {2070,4,11}, {2070,4,12}, {2070,4,13}, 
-{2070,4,14}, {2070,4,15}, {2070,4,16}, {2070,4,17}, {2070,4,18}, {2070,4,19}, {2070,4,20}, {2070,4,21}, {2070,4,22}, {2070,4,23}, {2070,4,24}, {2070,4,25}, {2070,4,26}, {2070,4,27}, {2070,4,28}, {2070,4,29}, {2070,4,30}, {2070,5,1}, {2070,5,2}, {2070,5,3}, {2070,5,4}, {2070,5,5}, {2070,5,6}, {2070,5,7}, {2070,5,8}, {2070,5,9}, {2070,5,10}, {2070,5,11}, {2070,5,12}, {2070,5,13}, {2070,5,14}, {2070,5,15}, 
-{2070,5,16}, {2070,5,17}, {2070,5,18}, {2070,5,19}, {2070,5,20}, {2070,5,21}, {2070,5,22}, {2070,5,23}, {2070,5,24}, {2070,5,25}, {2070,5,26}, {2070,5,27}, {2070,5,28}, {2070,5,29}, {2070,5,30}, {2070,5,31}, {2070,6,1}, {2070,6,2}, {2070,6,3}, {2070,6,4}, {2070,6,5}, {2070,6,6}, {2070,6,7}, {2070,6,8}, {2070,6,9}, {2070,6,10}, {2070,6,11}, {2070,6,12}, {2070,6,13}, {2070,6,14}, {2070,6,15}, {2070,6,16}, 
-{2070,6,17}, {2070,6,18}, {2070,6,19}, {2070,6,20}, {2070,6,21}, {2070,6,22}, {2070,6,23}, {2070,6,24}, {2070,6,25}, {2070,6,26}, {2070,6,27}, {2070,6,28}, {2070,6,29}, {2070,6,30}, {2070,7,1}, {2070,7,2}, {2070,7,3}, {2070,7,4}, {2070,7,5}, {2070,7,6}, {2070,7,7}, {2070,7,8}, {2070,7,9}, {2070,7,10}, {2070,7,11}, {2070,7,12}, {2070,7,13}, {2070,7,14}, {2070,7,15}, {2070,7,16}, {2070,7,17}, {2070,7,18}, 
-{2070,7,19}, {2070,7,20}, {2070,7,21}, {2070,7,22}, {2070,7,23}, {2070,7,24}, {2070,7,25}, {2070,7,26}, {2070,7,27}, {2070,7,28}, {2070,7,29}, {2070,7,30}, {2070,7,31}, {2070,8,1}, {2070,8,2}, {2070,8,3}, {2070,8,4}, {2070,8,5}, {2070,8,6}, {2070,8,7}, {2070,8,8}, {2070,8,9}, {2070,8,10}, {2070,8,11}, {2070,8,12}, {2070,8,13}, {2070,8,14}, {2070,8,15}, {2070,8,16}, {2070,8,17}, {2070,8,18}, {2070,8,19}, 
-{2070,8,20}, {2070,8,21}, {2070,8,22}, {2070,8,23}, {2070,8,24}, {2070,8,25}, {2070,8,26}, {2070,8,27}, {2070,8,28}, {2070,8,29}, {2070,8,30}, {2070,8,31}, {2070,9,1}, {2070,9,2}, {2070,9,3}, {2070,9,4}, {2070,9,5}, {2070,9,6}, {2070,9,7}, {2070,9,8}, {2070,9,9}, {2070,9,10}, {2070,9,11}, {2070,9,12}, {2070,9,13}, {2070,9,14}, {2070,9,15}, {2070,9,16}, {2070,9,17}, {2070,9,18}, {2070,9,19}, {2070,9,20}, 
-{2070,9,21}, {2070,9,22}, {2070,9,23}, {2070,9,24}, {2070,9,25}, {2070,9,26}, {2070,9,27}, {2070,9,28}, {2070,9,29}, {2070,9,30}, {2070,10,1}, {2070,10,2}, {2070,10,3}, {2070,10,4}, {2070,10,5}, {2070,10,6}, {2070,10,7}, {2070,10,8}, {2070,10,9}, {2070,10,10}, {2070,10,11}, {2070,10,12}, {2070,10,13}, {2070,10,14}, {2070,10,15}, {2070,10,16}, {2070,10,17}, {2070,10,18}, {2070,10,19}, {2070,10,20}, {2070,10,21}, {2070,10,22}, 
-{2070,10,23}, {2070,10,24}, {2070,10,25}, {2070,10,26}, {2070,10,27}, {2070,10,28}, {2070,10,29}, {2070,10,30}, {2070,10,31}, {2070,11,1}, {2070,11,2}, {2070,11,3}, {2070,11,4}, {2070,11,5}, {2070,11,6}, {2070,11,7}, {2070,11,8}, {2070,11,9}, {2070,11,10}, {2070,11,11}, {2070,11,12}, {2070,11,13}, {2070,11,14}, {2070,11,15}, {2070,11,16}, {2070,11,17}, {2070,11,18}, {2070,11,19}, {2070,11,20}, {2070,11,21}, {2070,11,22}, {2070,11,23}, 
-{2070,11,24}, {2070,11,25}, {2070,11,26}, {2070,11,27}, {2070,11,28}, {2070,11,29}, {2070,11,30}, {2070,12,1}, {2070,12,2}, {2070,12,3}, {2070,12,4}, {2070,12,5}, {2070,12,6}, {2070,12,7}, {2070,12,8}, {2070,12,9}, {2070,12,10}, {2070,12,11}, {2070,12,12}, {2070,12,13}, {2070,12,14}, {2070,12,15}, {2070,12,16}, {2070,12,17}, {2070,12,18}, {2070,12,19}, {2070,12,20}, {2070,12,21}, {2070,12,22}, {2070,12,23}, {2070,12,24}, {2070,12,25}, 
-{2070,12,26}, {2070,12,27}, {2070,12,28}, {2070,12,29}, {2070,12,30}, {2070,12,31}, {2071,1,1}, {2071,1,2}, {2071,1,3}, {2071,1,4}, {2071,1,5}, {2071,1,6}, {2071,1,7}, {2071,1,8}, {2071,1,9}, {2071,1,10}, {2071,1,11}, {2071,1,12}, {2071,1,13}, {2071,1,14}, {2071,1,15}, {2071,1,16}, {2071,1,17}, {2071,1,18}, {2071,1,19}, {2071,1,20}, {2071,1,21}, {2071,1,22}, {2071,1,23}, {2071,1,24}, {2071,1,25}, {2071,1,26}, 
-{2071,1,27}, {2071,1,28}, {2071,1,29}, {2071,1,30}, {2071,1,31}, {2071,2,1}, {2071,2,2}, {2071,2,3}, {2071,2,4}, {2071,2,5}, {2071,2,6}, {2071,2,7}, {2071,2,8}, {2071,2,9}, {2071,2,10}, {2071,2,11}, {2071,2,12}, {2071,2,13}, {2071,2,14}, {2071,2,15}, {2071,2,16}, {2071,2,17}, {2071,2,18}, {2071,2,19}, {2071,2,20}, {2071,2,21}, {2071,2,22}, {2071,2,23}, {2071,2,24}, {2071,2,25}, {2071,2,26}, {2071,2,27}, 
-{2071,2,28}, {2071,3,1}, {2071,3,2}, {2071,3,3}, {2071,3,4}, {2071,3,5}, {2071,3,6}, {2071,3,7}, {2071,3,8}, {2071,3,9}, {2071,3,10}, {2071,3,11}, {2071,3,12}, {2071,3,13}, {2071,3,14}, {2071,3,15}, {2071,3,16}, {2071,3,17}, {2071,3,18}, {2071,3,19}, {2071,3,20}, {2071,3,21}, {2071,3,22}, {2071,3,23}, {2071,3,24}, {2071,3,25}, {2071,3,26}, {2071,3,27}, {2071,3,28}, {2071,3,29}, {2071,3,30}, {2071,3,31}, 
-{2071,4,1}, {2071,4,2}, {2071,4,3}, {2071,4,4}, {2071,4,5}, {2071,4,6}, {2071,4,7}, {2071,4,8}, {2071,4,9}, {2071,4,10}, {2071,4,11}, {2071,4,12}, {2071,4,13}, {2071,4,14}, {2071,4,15}, {2071,4,16}, {2071,4,17}, {2071,4,18}, {2071,4,19}, {2071,4,20}, {2071,4,21}, {2071,4,22}, {2071,4,23}, {2071,4,24}, {2071,4,25}, {2071,4,26}, {2071,4,27}, {2071,4,28}, {2071,4,29}, {2071,4,30}, {2071,5,1}, {2071,5,2}, 
-{2071,5,3}, {2071,5,4}, {2071,5,5}, {2071,5,6}, {2071,5,7}, {2071,5,8}, {2071,5,9}, {2071,5,10}, {2071,5,11}, {2071,5,12}, {2071,5,13}, {2071,5,14}, {2071,5,15}, {2071,5,16}, {2071,5,17}, {2071,5,18}, {2071,5,19}, {2071,5,20}, {2071,5,21}, {2071,5,22}, {2071,5,23}, {2071,5,24}, {2071,5,25}, {2071,5,26}, {2071,5,27}, {2071,5,28}, {2071,5,29}, {2071,5,30}, {2071,5,31}, {2071,6,1}, {2071,6,2}, {2071,6,3}, 
-{2071,6,4}, {2071,6,5}, {2071,6,6}, {2071,6,7}, {2071,6,8}, {2071,6,9}, {2071,6,10}, {2071,6,11}, {2071,6,12}, {2071,6,13}, {2071,6,14}, {2071,6,15}, {2071,6,16}, {2071,6,17}, {2071,6,18}, {2071,6,19}, {2071,6,20}, {2071,6,21}, {2071,6,22}, {2071,6,23}, {2071,6,24}, {2071,6,25}, {2071,6,26}, {2071,6,27}, {2071,6,28}, {2071,6,29}, {2071,6,30}, {2071,7,1}, {2071,7,2}, {2071,7,3}, {2071,7,4}, {2071,7,5}, 
-{2071,7,6}, {2071,7,7}, {2071,7,8}, {2071,7,9}, {2071,7,10}, {2071,7,11}, {2071,7,12}, {2071,7,13}, {2071,7,14}, {2071,7,15}, {2071,7,16}, {2071,7,17}, {2071,7,18}, {2071,7,19}, {2071,7,20}, {2071,7,21}, {2071,7,22}, {2071,7,23}, {2071,7,24}, {2071,7,25}, {2071,7,26}, {2071,7,27}, {2071,7,28}, {2071,7,29}, {2071,7,30}, {2071,7,31}, {2071,8,1}, {2071,8,2}, {2071,8,3}, {2071,8,4}, {2071,8,5}, {2071,8,6}, 
-{2071,8,7}, {2071,8,8}, {2071,8,9}, {2071,8,10}, {2071,8,11}, {2071,8,12}, {2071,8,13}, {2071,8,14}, {2071,8,15}, {2071,8,16}, {2071,8,17}, {2071,8,18}, {2071,8,19}, {2071,8,20}, {2071,8,21}, {2071,8,22}, {2071,8,23}, {2071,8,24}, {2071,8,25}, {2071,8,26}, {2071,8,27}, {2071,8,28}, {2071,8,29}, {2071,8,30}, {2071,8,31}, {2071,9,1}, {2071,9,2}, {2071,9,3}, {2071,9,4}, {2071,9,5}, {2071,9,6}, {2071,9,7}, 
-{2071,9,8}, {2071,9,9}, {2071,9,10}, {2071,9,11}, {2071,9,12}, {2071,9,13}, {2071,9,14}, {2071,9,15}, {2071,9,16}, {2071,9,17}, {2071,9,18}, {2071,9,19}, {2071,9,20}, {2071,9,21}, {2071,9,22}, {2071,9,23}, {2071,9,24}, {2071,9,25}, {2071,9,26}, {2071,9,27}, {2071,9,28}, {2071,9,29}, {2071,9,30}, {2071,10,1}, {2071,10,2}, {2071,10,3}, {2071,10,4}, {2071,10,5}, {2071,10,6}, {2071,10,7}, {2071,10,8}, {2071,10,9}, 
-{2071,10,10}, {2071,10,11}, {2071,10,12}, {2071,10,13}, {2071,10,14}, {2071,10,15}, {2071,10,16}, {2071,10,17}, {2071,10,18}, {2071,10,19}, {2071,10,20}, {2071,10,21}, {2071,10,22}, {2071,10,23}, {2071,10,24}, {2071,10,25}, {2071,10,26}, {2071,10,27}, {2071,10,28}, {2071,10,29}, {2071,10,30}, {2071,10,31}, {2071,11,1}, {2071,11,2}, {2071,11,3}, {2071,11,4}, {2071,11,5}, {2071,11,6}, {2071,11,7}, {2071,11,8}, {2071,11,9}, {2071,11,10}, 
-{2071,11,11}, {2071,11,12}, {2071,11,13}, {2071,11,14}, {2071,11,15}, {2071,11,16}, {2071,11,17}, {2071,11,18}, {2071,11,19}, {2071,11,20}, {2071,11,21}, {2071,11,22}, {2071,11,23}, {2071,11,24}, {2071,11,25}, {2071,11,26}, {2071,11,27}, {2071,11,28}, {2071,11,29}, {2071,11,30}, {2071,12,1}, {2071,12,2}, {2071,12,3}, {2071,12,4}, {2071,12,5}, {2071,12,6}, {2071,12,7}, {2071,12,8}, {2071,12,9}, {2071,12,10}, {2071,12,11}, {2071,12,12}, 
-{2071,12,13}, {2071,12,14}, {2071,12,15}, {2071,12,16}, {2071,12,17}, {2071,12,18}, {2071,12,19}, {2071,12,20}, {2071,12,21}, {2071,12,22}, {2071,12,23}, {2071,12,24}, {2071,12,25}, {2071,12,26}, {2071,12,27}, {2071,12,28}, {2071,12,29}, {2071,12,30}, {2071,12,31}, {2072,1,1}, {2072,1,2}, {2072,1,3}, {2072,1,4}, {2072,1,5}, {2072,1,6}, {2072,1,7}, {2072,1,8}, {2072,1,9}, {2072,1,10}, {2072,1,11}, {2072,1,12}, {2072,1,13}, 
-{2072,1,14}, {2072,1,15}, {2072,1,16}, {2072,1,17}, {2072,1,18}, {2072,1,19}, {2072,1,20}, {2072,1,21}, {2072,1,22}, {2072,1,23}, {2072,1,24}, {2072,1,25}, {2072,1,26}, {2072,1,27}, {2072,1,28}, {2072,1,29}, {2072,1,30}, {2072,1,31}, {2072,2,1}, {2072,2,2}, {2072,2,3}, {2072,2,4}, {2072,2,5}, {2072,2,6}, {2072,2,7}, {2072,2,8}, {2072,2,9}, {2072,2,10}, {2072,2,11}, {2072,2,12}, {2072,2,13}, {2072,2,14}, 
-{2072,2,15}, {2072,2,16}, {2072,2,17}, {2072,2,18}, {2072,2,19}, {2072,2,20}, {2072,2,21}, {2072,2,22}, {2072,2,23}, {2072,2,24}, {2072,2,25}, {2072,2,26}, {2072,2,27}, {2072,2,28}, {2072,2,29}, {2072,3,1}, {2072,3,2}, {2072,3,3}, {2072,3,4}, {2072,3,5}, {2072,3,6}, {2072,3,7}, {2072,3,8}, {2072,3,9}, {2072,3,10}, {2072,3,11}, {2072,3,12}, {2072,3,13}, {2072,3,14}, {2072,3,15}, {2072,3,16}, {2072,3,17}, 
-{2072,3,18}, {2072,3,19}, {2072,3,20}, {2072,3,21}, {2072,3,22}, {2072,3,23}, {2072,3,24}, {2072,3,25}, {2072,3,26}, {2072,3,27}, {2072,3,28}, {2072,3,29}, {2072,3,30}, {2072,3,31}, {2072,4,1}, {2072,4,2}, {2072,4,3}, {2072,4,4}, {2072,4,5}, {2072,4,6}, {2072,4,7}, {2072,4,8}, {2072,4,9}, {2072,4,10}, {2072,4,11}, {2072,4,12}, {2072,4,13}, {2072,4,14}, {2072,4,15}, {2072,4,16}, {2072,4,17}, {2072,4,18}, 
-{2072,4,19}, {2072,4,20}, {2072,4,21}, {2072,4,22}, {2072,4,23}, {2072,4,24}, {2072,4,25}, {2072,4,26}, {2072,4,27}, {2072,4,28}, {2072,4,29}, {2072,4,30}, {2072,5,1}, {2072,5,2}, {2072,5,3}, {2072,5,4}, {2072,5,5}, {2072,5,6}, {2072,5,7}, {2072,5,8}, {2072,5,9}, {2072,5,10}, {2072,5,11}, {2072,5,12}, {2072,5,13}, {2072,5,14}, {2072,5,15}, {2072,5,16}, {2072,5,17}, {2072,5,18}, {2072,5,19}, {2072,5,20}, 
-{2072,5,21}, {2072,5,22}, {2072,5,23}, {2072,5,24}, {2072,5,25}, {2072,5,26}, {2072,5,27}, {2072,5,28}, {2072,5,29}, {2072,5,30}, {2072,5,31}, {2072,6,1}, {2072,6,2}, {2072,6,3}, {2072,6,4}, {2072,6,5}, {2072,6,6}, {2072,6,7}, {2072,6,8}, {2072,6,9}, {2072,6,10}, {2072,6,11}, {2072,6,12}, {2072,6,13}, {2072,6,14}, {2072,6,15}, {2072,6,16}, {2072,6,17}, {2072,6,18}, {2072,6,19}, {2072,6,20}, {2072,6,21}, 
-{2072,6,22}, {2072,6,23}, {2072,6,24}, {2072,6,25}, {2072,6,26}, {2072,6,27}, {2072,6,28}, {2072,6,29}, {2072,6,30}, {2072,7,1}, {2072,7,2}, {2072,7,3}, {2072,7,4}, {2072,7,5}, {2072,7,6}, {2072,7,7}, {2072,7,8}, {2072,7,9}, {2072,7,10}, {2072,7,11}, {2072,7,12}, {2072,7,13}, {2072,7,14}, {2072,7,15}, {2072,7,16}, {2072,7,17}, {2072,7,18}, {2072,7,19}, {2072,7,20}, {2072,7,21}, {2072,7,22}, {2072,7,23}, 
-{2072,7,24}, {2072,7,25}, {2072,7,26}, {2072,7,27}, {2072,7,28}, {2072,7,29}, {2072,7,30}, {2072,7,31}, {2072,8,1}, {2072,8,2}, {2072,8,3}, {2072,8,4}, {2072,8,5}, {2072,8,6}, {2072,8,7}, {2072,8,8}, {2072,8,9}, {2072,8,10}, {2072,8,11}, {2072,8,12}, {2072,8,13}, {2072,8,14}, {2072,8,15}, {2072,8,16}, {2072,8,17}, {2072,8,18}, {2072,8,19}, {2072,8,20}, {2072,8,21}, {2072,8,22}, {2072,8,23}, {2072,8,24}, 
-{2072,8,25}, {2072,8,26}, {2072,8,27}, {2072,8,28}, {2072,8,29}, {2072,8,30}, {2072,8,31}, {2072,9,1}, {2072,9,2}, {2072,9,3}, {2072,9,4}, {2072,9,5}, {2072,9,6}, {2072,9,7}, {2072,9,8}, {2072,9,9}, {2072,9,10}, {2072,9,11}, {2072,9,12}, {2072,9,13}, {2072,9,14}, {2072,9,15}, {2072,9,16}, {2072,9,17}, {2072,9,18}, {2072,9,19}, {2072,9,20}, {2072,9,21}, {2072,9,22}, {2072,9,23}, {2072,9,24}, {2072,9,25}, 
-{2072,9,26}, {2072,9,27}, {2072,9,28}, {2072,9,29}, {2072,9,30}, {2072,10,1}, {2072,10,2}, {2072,10,3}, {2072,10,4}, {2072,10,5}, {2072,10,6}, {2072,10,7}, {2072,10,8}, {2072,10,9}, {2072,10,10}, {2072,10,11}, {2072,10,12}, {2072,10,13}, {2072,10,14}, {2072,10,15}, {2072,10,16}, {2072,10,17}, {2072,10,18}, {2072,10,19}, {2072,10,20}, {2072,10,21}, {2072,10,22}, {2072,10,23}, {2072,10,24}, {2072,10,25}, {2072,10,26}, {2072,10,27}, 
-{2072,10,28}, {2072,10,29}, {2072,10,30}, {2072,10,31}, {2072,11,1}, {2072,11,2}, {2072,11,3}, {2072,11,4}, {2072,11,5}, {2072,11,6}, {2072,11,7}, {2072,11,8}, {2072,11,9}, {2072,11,10}, {2072,11,11}, {2072,11,12}, {2072,11,13}, {2072,11,14}, {2072,11,15}, {2072,11,16}, {2072,11,17}, {2072,11,18}, {2072,11,19}, {2072,11,20}, {2072,11,21}, {2072,11,22}, {2072,11,23}, {2072,11,24}, {2072,11,25}, {2072,11,26}, {2072,11,27}, {2072,11,28}, 
-{2072,11,29}, {2072,11,30}, {2072,12,1}, {2072,12,2}, {2072,12,3}, {2072,12,4}, {2072,12,5}, {2072,12,6}, {2072,12,7}, {2072,12,8}, {2072,12,9}, {2072,12,10}, {2072,12,11}, {2072,12,12}, {2072,12,13}, {2072,12,14}, {2072,12,15}, {2072,12,16}, {2072,12,17}, {2072,12,18}, {2072,12,19}, {2072,12,20}, {2072,12,21}, {2072,12,22}, {2072,12,23}, {2072,12,24}, {2072,12,25}, {2072,12,26}, {2072,12,27}, {2072,12,28}, {2072,12,29}, {2072,12,30}, 
-{2072,12,31}, {2073,1,1}, {2073,1,2}, {2073,1,3}, {2073,1,4}, {2073,1,5}, {2073,1,6}, {2073,1,7}, {2073,1,8}, {2073,1,9}, {2073,1,10}, {2073,1,11}, {2073,1,12}, {2073,1,13}, {2073,1,14}, {2073,1,15}, {2073,1,16}, {2073,1,17}, {2073,1,18}, {2073,1,19}, {2073,1,20}, {2073,1,21}, {2073,1,22}, {2073,1,23}, {2073,1,24}, {2073,1,25}, {2073,1,26}, {2073,1,27}, {2073,1,28}, {2073,1,29}, {2073,1,30}, {2073,1,31}, 
-{2073,2,1}, {2073,2,2}, {2073,2,3}, {2073,2,4}, {2073,2,5}, {2073,2,6}, {2073,2,7}, {2073,2,8}, {2073,2,9}, {2073,2,10}, {2073,2,11}, {2073,2,12}, {2073,2,13}, {2073,2,14}, {2073,2,15}, {2073,2,16}, {2073,2,17}, {2073,2,18}, {2073,2,19}, {2073,2,20}, {2073,2,21}, {2073,2,22}, {2073,2,23}, {2073,2,24}, {2073,2,25}, {2073,2,26}, {2073,2,27}, {2073,2,28}, {2073,3,1}, {2073,3,2}, {2073,3,3}, {2073,3,4}, 
-{2073,3,5}, {2073,3,6}, {2073,3,7}, {2073,3,8}, {2073,3,9}, {2073,3,10}, {2073,3,11}, {2073,3,12}, {2073,3,13}, {2073,3,14}, {2073,3,15}, {2073,3,16}, {2073,3,17}, {2073,3,18}, {2073,3,19}, {2073,3,20}, {2073,3,21}, {2073,3,22}, {2073,3,23}, {2073,3,24}, {2073,3,25}, {2073,3,26}, {2073,3,27}, {2073,3,28}, {2073,3,29}, {2073,3,30}, {2073,3,31}, {2073,4,1}, {2073,4,2}, {2073,4,3}, {2073,4,4}, {2073,4,5}, 
-{2073,4,6}, {2073,4,7}, {2073,4,8}, {2073,4,9}, {2073,4,10}, {2073,4,11}, {2073,4,12}, {2073,4,13}, {2073,4,14}, {2073,4,15}, {2073,4,16}, {2073,4,17}, {2073,4,18}, {2073,4,19}, {2073,4,20}, {2073,4,21}, {2073,4,22}, {2073,4,23}, {2073,4,24}, {2073,4,25}, {2073,4,26}, {2073,4,27}, {2073,4,28}, {2073,4,29}, {2073,4,30}, {2073,5,1}, {2073,5,2}, {2073,5,3}, {2073,5,4}, {2073,5,5}, {2073,5,6}, {2073,5,7}, 
-{2073,5,8}, {2073,5,9}, {2073,5,10}, {2073,5,11}, {2073,5,12}, {2073,5,13}, {2073,5,14}, {2073,5,15}, {2073,5,16}, {2073,5,17}, {2073,5,18}, {2073,5,19}, {2073,5,20}, {2073,5,21}, {2073,5,22}, {2073,5,23}, {2073,5,24}, {2073,5,25}, {2073,5,26}, {2073,5,27}, {2073,5,28}, {2073,5,29}, {2073,5,30}, {2073,5,31}, {2073,6,1}, {2073,6,2}, {2073,6,3}, {2073,6,4}, {2073,6,5}, {2073,6,6}, {2073,6,7}, {2073,6,8}, 
-{2073,6,9}, {2073,6,10}, {2073,6,11}, {2073,6,12}, {2073,6,13}, {2073,6,14}, {2073,6,15}, {2073,6,16}, {2073,6,17}, {2073,6,18}, {2073,6,19}, {2073,6,20}, {2073,6,21}, {2073,6,22}, {2073,6,23}, {2073,6,24}, {2073,6,25}, {2073,6,26}, {2073,6,27}, {2073,6,28}, {2073,6,29}, {2073,6,30}, {2073,7,1}, {2073,7,2}, {2073,7,3}, {2073,7,4}, {2073,7,5}, {2073,7,6}, {2073,7,7}, {2073,7,8}, {2073,7,9}, {2073,7,10}, 
-{2073,7,11}, {2073,7,12}, {2073,7,13}, {2073,7,14}, {2073,7,15}, {2073,7,16}, {2073,7,17}, {2073,7,18}, {2073,7,19}, {2073,7,20}, {2073,7,21}, {2073,7,22}, {2073,7,23}, {2073,7,24}, {2073,7,25}, {2073,7,26}, {2073,7,27}, {2073,7,28}, {2073,7,29}, {2073,7,30}, {2073,7,31}, {2073,8,1}, {2073,8,2}, {2073,8,3}, {2073,8,4}, {2073,8,5}, {2073,8,6}, {2073,8,7}, {2073,8,8}, {2073,8,9}, {2073,8,10}, {2073,8,11}, 
-{2073,8,12}, {2073,8,13}, {2073,8,14}, {2073,8,15}, {2073,8,16}, {2073,8,17}, {2073,8,18}, {2073,8,19}, {2073,8,20}, {2073,8,21}, {2073,8,22}, {2073,8,23}, {2073,8,24}, {2073,8,25}, {2073,8,26}, {2073,8,27}, {2073,8,28}, {2073,8,29}, {2073,8,30}, {2073,8,31}, {2073,9,1}, {2073,9,2}, {2073,9,3}, {2073,9,4}, {2073,9,5}, {2073,9,6}, {2073,9,7}, {2073,9,8}, {2073,9,9}, {2073,9,10}, {2073,9,11}, {2073,9,12}, 
-{2073,9,13}, {2073,9,14}, {2073,9,15}, {2073,9,16}, {2073,9,17}, {2073,9,18}, {2073,9,19}, {2073,9,20}, {2073,9,21}, {2073,9,22}, {2073,9,23}, {2073,9,24}, {2073,9,25}, {2073,9,26}, {2073,9,27}, {2073,9,28}, {2073,9,29}, {2073,9,30}, {2073,10,1}, {2073,10,2}, {2073,10,3}, {2073,10,4}, {2073,10,5}, {2073,10,6}, {2073,10,7}, {2073,10,8}, {2073,10,9}, {2073,10,10}, {2073,10,11}, {2073,10,12}, {2073,10,13}, {2073,10,14}, 
-{2073,10,15}, {2073,10,16}, {2073,10,17}, {2073,10,18}, {2073,10,19}, {2073,10,20}, {2073,10,21}, {2073,10,22}, {2073,10,23}, {2073,10,24}, {2073,10,25}, {2073,10,26}, {2073,10,27}, {2073,10,28}, {2073,10,29}, {2073,10,30}, {2073,10,31}, {2073,11,1}, {2073,11,2}, {2073,11,3}, {2073,11,4}, {2073,11,5}, {2073,11,6}, {2073,11,7}, {2073,11,8}, {2073,11,9}, {2073,11,10}, {2073,11,11}, {2073,11,12}, {2073,11,13}, {2073,11,14}, {2073,11,15}, 
-{2073,11,16}, {2073,11,17}, {2073,11,18}, {2073,11,19}, {2073,11,20}, {2073,11,21}, {2073,11,22}, {2073,11,23}, {2073,11,24}, {2073,11,25}, {2073,11,26}, {2073,11,27}, {2073,11,28}, {2073,11,29}, {2073,11,30}, {2073,12,1}, {2073,12,2}, {2073,12,3}, {2073,12,4}, {2073,12,5}, {2073,12,6}, {2073,12,7}, {2073,12,8}, {2073,12,9}, {2073,12,10}, {2073,12,11}, {2073,12,12}, {2073,12,13}, {2073,12,14}, {2073,12,15}, {2073,12,16}, {2073,12,17}, 
-{2073,12,18}, {2073,12,19}, {2073,12,20}, {2073,12,21}, {2073,12,22}, {2073,12,23}, {2073,12,24}, {2073,12,25}, {2073,12,26}, {2073,12,27}, {2073,12,28}, {2073,12,29}, {2073,12,30}, {2073,12,31}, {2074,1,1}, {2074,1,2}, {2074,1,3}, {2074,1,4}, {2074,1,5}, {2074,1,6}, {2074,1,7}, {2074,1,8}, {2074,1,9}, {2074,1,10}, {2074,1,11}, {2074,1,12}, {2074,1,13}, {2074,1,14}, {2074,1,15}, {2074,1,16}, {2074,1,17}, {2074,1,18}, 
-{2074,1,19}, {2074,1,20}, {2074,1,21}, {2074,1,22}, {2074,1,23}, {2074,1,24}, {2074,1,25}, {2074,1,26}, {2074,1,27}, {2074,1,28}, {2074,1,29}, {2074,1,30}, {2074,1,31}, {2074,2,1}, {2074,2,2}, {2074,2,3}, {2074,2,4}, {2074,2,5}, {2074,2,6}, {2074,2,7}, {2074,2,8}, {2074,2,9}, {2074,2,10}, {2074,2,11}, {2074,2,12}, {2074,2,13}, {2074,2,14}, {2074,2,15}, {2074,2,16}, {2074,2,17}, {2074,2,18}, {2074,2,19}, 
-{2074,2,20}, {2074,2,21}, {2074,2,22}, {2074,2,23}, {2074,2,24}, {2074,2,25}, {2074,2,26}, {2074,2,27}, {2074,2,28}, {2074,3,1}, {2074,3,2}, {2074,3,3}, {2074,3,4}, {2074,3,5}, {2074,3,6}, {2074,3,7}, {2074,3,8}, {2074,3,9}, {2074,3,10}, {2074,3,11}, {2074,3,12}, {2074,3,13}, {2074,3,14}, {2074,3,15}, {2074,3,16}, {2074,3,17}, {2074,3,18}, {2074,3,19}, {2074,3,20}, {2074,3,21}, {2074,3,22}, {2074,3,23}, 
-{2074,3,24}, {2074,3,25}, {2074,3,26}, {2074,3,27}, {2074,3,28}, {2074,3,29}, {2074,3,30}, {2074,3,31}, {2074,4,1}, {2074,4,2}, {2074,4,3}, {2074,4,4}, {2074,4,5}, {2074,4,6}, {2074,4,7}, {2074,4,8}, {2074,4,9}, {2074,4,10}, {2074,4,11}, {2074,4,12}, {2074,4,13}, {2074,4,14}, {2074,4,15}, {2074,4,16}, {2074,4,17}, {2074,4,18}, {2074,4,19}, {2074,4,20}, {2074,4,21}, {2074,4,22}, {2074,4,23}, {2074,4,24}, 
-{2074,4,25}, {2074,4,26}, {2074,4,27}, {2074,4,28}, {2074,4,29}, {2074,4,30}, {2074,5,1}, {2074,5,2}, {2074,5,3}, {2074,5,4}, {2074,5,5}, {2074,5,6}, {2074,5,7}, {2074,5,8}, {2074,5,9}, {2074,5,10}, {2074,5,11}, {2074,5,12}, {2074,5,13}, {2074,5,14}, {2074,5,15}, {2074,5,16}, {2074,5,17}, {2074,5,18}, {2074,5,19}, {2074,5,20}, {2074,5,21}, {2074,5,22}, {2074,5,23}, {2074,5,24}, {2074,5,25}, {2074,5,26}, 
-{2074,5,27}, {2074,5,28}, {2074,5,29}, {2074,5,30}, {2074,5,31}, {2074,6,1}, {2074,6,2}, {2074,6,3}, {2074,6,4}, {2074,6,5}, {2074,6,6}, {2074,6,7}, {2074,6,8}, {2074,6,9}, {2074,6,10}, {2074,6,11}, {2074,6,12}, {2074,6,13}, {2074,6,14}, {2074,6,15}, {2074,6,16}, {2074,6,17}, {2074,6,18}, {2074,6,19}, {2074,6,20}, {2074,6,21}, {2074,6,22}, {2074,6,23}, {2074,6,24}, {2074,6,25}, {2074,6,26}, {2074,6,27}, 
-{2074,6,28}, {2074,6,29}, {2074,6,30}, {2074,7,1}, {2074,7,2}, {2074,7,3}, {2074,7,4}, {2074,7,5}, {2074,7,6}, {2074,7,7}, {2074,7,8}, {2074,7,9}, {2074,7,10}, {2074,7,11}, {2074,7,12}, {2074,7,13}, {2074,7,14}, {2074,7,15}, {2074,7,16}, {2074,7,17}, {2074,7,18}, {2074,7,19}, {2074,7,20}, {2074,7,21}, {2074,7,22}, {2074,7,23}, {2074,7,24}, {2074,7,25}, {2074,7,26}, {2074,7,27}, {2074,7,28}, {2074,7,29}, 
-{2074,7,30}, {2074,7,31}, {2074,8,1}, {2074,8,2}, {2074,8,3}, {2074,8,4}, {2074,8,5}, {2074,8,6}, {2074,8,7}, {2074,8,8}, {2074,8,9}, {2074,8,10}, {2074,8,11}, {2074,8,12}, {2074,8,13}, {2074,8,14}, {2074,8,15}, {2074,8,16}, {2074,8,17}, {2074,8,18}, {2074,8,19}, {2074,8,20}, {2074,8,21}, {2074,8,22}, {2074,8,23}, {2074,8,24}, {2074,8,25}, {2074,8,26}, {2074,8,27}, {2074,8,28}, {2074,8,29}, {2074,8,30}, 
-{2074,8,31}, {2074,9,1}, {2074,9,2}, {2074,9,3}, {2074,9,4}, {2074,9,5}, {2074,9,6}, {2074,9,7}, {2074,9,8}, {2074,9,9}, {2074,9,10}, {2074,9,11}, {2074,9,12}, {2074,9,13}, {2074,9,14}, {2074,9,15}, {2074,9,16}, {2074,9,17}, {2074,9,18}, {2074,9,19}, {2074,9,20}, {2074,9,21}, {2074,9,22}, {2074,9,23}, {2074,9,24}, {2074,9,25}, {2074,9,26}, {2074,9,27}, {2074,9,28}, {2074,9,29}, {2074,9,30}, {2074,10,1}, 
-{2074,10,2}, {2074,10,3}, {2074,10,4}, {2074,10,5}, {2074,10,6}, {2074,10,7}, {2074,10,8}, {2074,10,9}, {2074,10,10}, {2074,10,11}, {2074,10,12}, {2074,10,13}, {2074,10,14}, {2074,10,15}, {2074,10,16}, {2074,10,17}, {2074,10,18}, {2074,10,19}, {2074,10,20}, {2074,10,21}, {2074,10,22}, {2074,10,23}, {2074,10,24}, {2074,10,25}, {2074,10,26}, {2074,10,27}, {2074,10,28}, {2074,10,29}, {2074,10,30}, {2074,10,31}, {2074,11,1}, {2074,11,2}, 
-{2074,11,3}, {2074,11,4}, {2074,11,5}, {2074,11,6}, {2074,11,7}, {2074,11,8}, {2074,11,9}, {2074,11,10}, {2074,11,11}, {2074,11,12}, {2074,11,13}, {2074,11,14}, {2074,11,15}, {2074,11,16}, {2074,11,17}, {2074,11,18}, {2074,11,19}, {2074,11,20}, {2074,11,21}, {2074,11,22}, {2074,11,23}, {2074,11,24}, {2074,11,25}, {2074,11,26}, {2074,11,27}, {2074,11,28}, {2074,11,29}, {2074,11,30}, {2074,12,1}, {2074,12,2}, {2074,12,3}, {2074,12,4}, 
-{2074,12,5}, {2074,12,6}, {2074,12,7}, {2074,12,8}, {2074,12,9}, {2074,12,10}, {2074,12,11}, {2074,12,12}, {2074,12,13}, {2074,12,14}, {2074,12,15}, {2074,12,16}, {2074,12,17}, {2074,12,18}, {2074,12,19}, {2074,12,20}, {2074,12,21}, {2074,12,22}, {2074,12,23}, {2074,12,24}, {2074,12,25}, {2074,12,26}, {2074,12,27}, {2074,12,28}, {2074,12,29}, {2074,12,30}, {2074,12,31}, {2075,1,1}, {2075,1,2}, {2075,1,3}, {2075,1,4}, {2075,1,5}, 
-{2075,1,6}, {2075,1,7}, {2075,1,8}, {2075,1,9}, {2075,1,10}, {2075,1,11}, {2075,1,12}, {2075,1,13}, {2075,1,14}, {2075,1,15}, {2075,1,16}, {2075,1,17}, {2075,1,18}, {2075,1,19}, {2075,1,20}, {2075,1,21}, {2075,1,22}, {2075,1,23}, {2075,1,24}, {2075,1,25}, {2075,1,26}, {2075,1,27}, {2075,1,28}, {2075,1,29}, {2075,1,30}, {2075,1,31}, {2075,2,1}, {2075,2,2}, {2075,2,3}, {2075,2,4}, {2075,2,5}, {2075,2,6}, 
-{2075,2,7}, {2075,2,8}, {2075,2,9}, {2075,2,10}, {2075,2,11}, {2075,2,12}, {2075,2,13}, {2075,2,14}, {2075,2,15}, {2075,2,16}, {2075,2,17}, {2075,2,18}, {2075,2,19}, {2075,2,20}, {2075,2,21}, {2075,2,22}, {2075,2,23}, {2075,2,24}, {2075,2,25}, {2075,2,26}, {2075,2,27}, {2075,2,28}, {2075,3,1}, {2075,3,2}, {2075,3,3}, {2075,3,4}, {2075,3,5}, {2075,3,6}, {2075,3,7}, {2075,3,8}, {2075,3,9}, {2075,3,10}, 
-{2075,3,11}, {2075,3,12}, {2075,3,13}, {2075,3,14}, {2075,3,15}, {2075,3,16}, {2075,3,17}, {2075,3,18}, {2075,3,19}, {2075,3,20}, {2075,3,21}, {2075,3,22}, {2075,3,23}, {2075,3,24}, {2075,3,25}, {2075,3,26}, {2075,3,27}, {2075,3,28}, {2075,3,29}, {2075,3,30}, {2075,3,31}, {2075,4,1}, {2075,4,2}, {2075,4,3}, {2075,4,4}, {2075,4,5}, {2075,4,6}, {2075,4,7}, {2075,4,8}, {2075,4,9}, {2075,4,10}, {2075,4,11}, 
-{2075,4,12}, {2075,4,13}, {2075,4,14}, {2075,4,15}, {2075,4,16}, {2075,4,17}, {2075,4,18}, {2075,4,19}, {2075,4,20}, {2075,4,21}, {2075,4,22}, {2075,4,23}, {2075,4,24}, {2075,4,25}, {2075,4,26}, {2075,4,27}, {2075,4,28}, {2075,4,29}, {2075,4,30}, {2075,5,1}, {2075,5,2}, {2075,5,3}, {2075,5,4}, {2075,5,5}, {2075,5,6}, {2075,5,7}, {2075,5,8}, {2075,5,9}, {2075,5,10}, {2075,5,11}, {2075,5,12}, {2075,5,13}, 
-{2075,5,14}, {2075,5,15}, {2075,5,16}, {2075,5,17}, {2075,5,18}, {2075,5,19}, {2075,5,20}, {2075,5,21}, {2075,5,22}, {2075,5,23}, {2075,5,24}, {2075,5,25}, {2075,5,26}, {2075,5,27}, {2075,5,28}, {2075,5,29}, {2075,5,30}, {2075,5,31}, {2075,6,1}, {2075,6,2}, {2075,6,3}, {2075,6,4}, {2075,6,5}, {2075,6,6}, {2075,6,7}, {2075,6,8}, {2075,6,9}, {2075,6,10}, {2075,6,11}, {2075,6,12}, {2075,6,13}, {2075,6,14}, 
-{2075,6,15}, {2075,6,16}, {2075,6,17}, {2075,6,18}, {2075,6,19}, {2075,6,20}, {2075,6,21}, {2075,6,22}, {2075,6,23}, {2075,6,24}, {2075,6,25}, {2075,6,26}, {2075,6,27}, {2075,6,28}, {2075,6,29}, {2075,6,30}, {2075,7,1}, {2075,7,2}, {2075,7,3}, {2075,7,4}, {2075,7,5}, {2075,7,6}, {2075,7,7}, {2075,7,8}, {2075,7,9}, {2075,7,10}, {2075,7,11}, {2075,7,12}, {2075,7,13}, {2075,7,14}, {2075,7,15}, {2075,7,16}, 
-{2075,7,17}, {2075,7,18}, {2075,7,19}, {2075,7,20}, {2075,7,21}, {2075,7,22}, {2075,7,23}, {2075,7,24}, {2075,7,25}, {2075,7,26}, {2075,7,27}, {2075,7,28}, {2075,7,29}, {2075,7,30}, {2075,7,31}, {2075,8,1}, {2075,8,2}, {2075,8,3}, {2075,8,4}, {2075,8,5}, {2075,8,6}, {2075,8,7}, {2075,8,8}, {2075,8,9}, {2075,8,10}, {2075,8,11}, {2075,8,12}, {2075,8,13}, {2075,8,14}, {2075,8,15}, {2075,8,16}, {2075,8,17}, 
-{2075,8,18}, {2075,8,19}, {2075,8,20}, {2075,8,21}, {2075,8,22}, {2075,8,23}, {2075,8,24}, {2075,8,25}, {2075,8,26}, {2075,8,27}, {2075,8,28}, {2075,8,29}, {2075,8,30}, {2075,8,31}, {2075,9,1}, {2075,9,2}, {2075,9,3}, {2075,9,4}, {2075,9,5}, {2075,9,6}, {2075,9,7}, {2075,9,8}, {2075,9,9}, {2075,9,10}, {2075,9,11}, {2075,9,12}, {2075,9,13}, {2075,9,14}, {2075,9,15}, {2075,9,16}, {2075,9,17}, {2075,9,18}, 
-{2075,9,19}, {2075,9,20}, {2075,9,21}, {2075,9,22}, {2075,9,23}, {2075,9,24}, {2075,9,25}, {2075,9,26}, {2075,9,27}, {2075,9,28}, {2075,9,29}, {2075,9,30}, {2075,10,1}, {2075,10,2}, {2075,10,3}, {2075,10,4}, {2075,10,5}, {2075,10,6}, {2075,10,7}, {2075,10,8}, {2075,10,9}, {2075,10,10}, {2075,10,11}, {2075,10,12}, {2075,10,13}, {2075,10,14}, {2075,10,15}, {2075,10,16}, {2075,10,17}, {2075,10,18}, {2075,10,19}, {2075,10,20}, 
-{2075,10,21}, {2075,10,22}, {2075,10,23}, {2075,10,24}, {2075,10,25}, {2075,10,26}, {2075,10,27}, {2075,10,28}, {2075,10,29}, {2075,10,30}, {2075,10,31}, {2075,11,1}, {2075,11,2}, {2075,11,3}, {2075,11,4}, {2075,11,5}, {2075,11,6}, {2075,11,7}, {2075,11,8}, {2075,11,9}, {2075,11,10}, {2075,11,11}, {2075,11,12}, {2075,11,13}, {2075,11,14}, {2075,11,15}, {2075,11,16}, {2075,11,17}, {2075,11,18}, {2075,11,19}, {2075,11,20}, {2075,11,21}, 
-{2075,11,22}, {2075,11,23}, {2075,11,24}, {2075,11,25}, {2075,11,26}, {2075,11,27}, {2075,11,28}, {2075,11,29}, {2075,11,30}, {2075,12,1}, {2075,12,2}, {2075,12,3}, {2075,12,4}, {2075,12,5}, {2075,12,6}, {2075,12,7}, {2075,12,8}, {2075,12,9}, {2075,12,10}, {2075,12,11}, {2075,12,12}, {2075,12,13}, {2075,12,14}, {2075,12,15}, {2075,12,16}, {2075,12,17}, {2075,12,18}, {2075,12,19}, {2075,12,20}, {2075,12,21}, {2075,12,22}, {2075,12,23}, 
-{2075,12,24}, {2075,12,25}, {2075,12,26}, {2075,12,27}, {2075,12,28}, {2075,12,29}, {2075,12,30}, {2075,12,31}, {2076,1,1}, {2076,1,2}, {2076,1,3}, {2076,1,4}, {2076,1,5}, {2076,1,6}, {2076,1,7}, {2076,1,8}, {2076,1,9}, {2076,1,10}, {2076,1,11}, {2076,1,12}, {2076,1,13}, {2076,1,14}, {2076,1,15}, {2076,1,16}, {2076,1,17}, {2076,1,18}, {2076,1,19}, {2076,1,20}, {2076,1,21}, {2076,1,22}, {2076,1,23}, {2076,1,24}, 
-{2076,1,25}, {2076,1,26}, {2076,1,27}, {2076,1,28}, {2076,1,29}, {2076,1,30}, {2076,1,31}, {2076,2,1}, {2076,2,2}, {2076,2,3}, {2076,2,4}, {2076,2,5}, {2076,2,6}, {2076,2,7}, {2076,2,8}, {2076,2,9}, {2076,2,10}, {2076,2,11}, {2076,2,12}, {2076,2,13}, {2076,2,14}, {2076,2,15}, {2076,2,16}, {2076,2,17}, {2076,2,18}, {2076,2,19}, {2076,2,20}, {2076,2,21}, {2076,2,22}, {2076,2,23}, {2076,2,24}, {2076,2,25}, 
-{2076,2,26}, {2076,2,27}, {2076,2,28}, {2076,2,29}, {2076,3,1}, {2076,3,2}, {2076,3,3}, {2076,3,4}, {2076,3,5}, {2076,3,6}, {2076,3,7}, {2076,3,8}, {2076,3,9}, {2076,3,10}, {2076,3,11}, {2076,3,12}, {2076,3,13}, {2076,3,14}, {2076,3,15}, {2076,3,16}, {2076,3,17}, {2076,3,18}, {2076,3,19}, {2076,3,20}, {2076,3,21}, {2076,3,22}, {2076,3,23}, {2076,3,24}, {2076,3,25}, {2076,3,26}, {2076,3,27}, {2076,3,28}, 
-{2076,3,29}, {2076,3,30}, {2076,3,31}, {2076,4,1}, {2076,4,2}, {2076,4,3}, {2076,4,4}, {2076,4,5}, {2076,4,6}, {2076,4,7}, {2076,4,8}, {2076,4,9}, {2076,4,10}, {2076,4,11}, {2076,4,12}, {2076,4,13}, {2076,4,14}, {2076,4,15}, {2076,4,16}, {2076,4,17}, {2076,4,18}, {2076,4,19}, {2076,4,20}, {2076,4,21}, {2076,4,22}, {2076,4,23}, {2076,4,24}, {2076,4,25}, {2076,4,26}, {2076,4,27}, {2076,4,28}, {2076,4,29}, 
-{2076,4,30}, {2076,5,1}, {2076,5,2}, {2076,5,3}, {2076,5,4}, {2076,5,5}, {2076,5,6}, {2076,5,7}, {2076,5,8}, {2076,5,9}, {2076,5,10}, {2076,5,11}, {2076,5,12}, {2076,5,13}, {2076,5,14}, {2076,5,15}, {2076,5,16}, {2076,5,17}, {2076,5,18}, {2076,5,19}, {2076,5,20}, {2076,5,21}, {2076,5,22}, {2076,5,23}, {2076,5,24}, {2076,5,25}, {2076,5,26}, {2076,5,27}, {2076,5,28}, {2076,5,29}, {2076,5,30}, {2076,5,31}, 
-{2076,6,1}, {2076,6,2}, {2076,6,3}, {2076,6,4}, {2076,6,5}, {2076,6,6}, {2076,6,7}, {2076,6,8}, {2076,6,9}, {2076,6,10}, {2076,6,11}, {2076,6,12}, {2076,6,13}, {2076,6,14}, {2076,6,15}, {2076,6,16}, {2076,6,17}, {2076,6,18}, {2076,6,19}, {2076,6,20}, {2076,6,21}, {2076,6,22}, {2076,6,23}, {2076,6,24}, {2076,6,25}, {2076,6,26}, {2076,6,27}, {2076,6,28}, {2076,6,29}, {2076,6,30}, {2076,7,1}, {2076,7,2}, 
-{2076,7,3}, {2076,7,4}, {2076,7,5}, {2076,7,6}, {2076,7,7}, {2076,7,8}, {2076,7,9}, {2076,7,10}, {2076,7,11}, {2076,7,12}, {2076,7,13}, {2076,7,14}, {2076,7,15}, {2076,7,16}, {2076,7,17}, {2076,7,18}, {2076,7,19}, {2076,7,20}, {2076,7,21}, {2076,7,22}, {2076,7,23}, {2076,7,24}, {2076,7,25}, {2076,7,26}, {2076,7,27}, {2076,7,28}, {2076,7,29}, {2076,7,30}, {2076,7,31}, {2076,8,1}, {2076,8,2}, {2076,8,3}, 
-{2076,8,4}, {2076,8,5}, {2076,8,6}, {2076,8,7}, {2076,8,8}, {2076,8,9}, {2076,8,10}, {2076,8,11}, {2076,8,12}, {2076,8,13}, {2076,8,14}, {2076,8,15}, {2076,8,16}, {2076,8,17}, {2076,8,18}, {2076,8,19}, {2076,8,20}, {2076,8,21}, {2076,8,22}, {2076,8,23}, {2076,8,24}, {2076,8,25}, {2076,8,26}, {2076,8,27}, {2076,8,28}, {2076,8,29}, {2076,8,30}, {2076,8,31}, {2076,9,1}, {2076,9,2}, {2076,9,3}, {2076,9,4}, 
-{2076,9,5}, {2076,9,6}, {2076,9,7}, {2076,9,8}, {2076,9,9}, {2076,9,10}, {2076,9,11}, {2076,9,12}, {2076,9,13}, {2076,9,14}, {2076,9,15}, {2076,9,16}, {2076,9,17}, {2076,9,18}, {2076,9,19}, {2076,9,20}, {2076,9,21}, {2076,9,22}, {2076,9,23}, {2076,9,24}, {2076,9,25}, {2076,9,26}, {2076,9,27}, {2076,9,28}, {2076,9,29}, {2076,9,30}, {2076,10,1}, {2076,10,2}, {2076,10,3}, {2076,10,4}, {2076,10,5}, {2076,10,6}, 
-{2076,10,7}, {2076,10,8}, {2076,10,9}, {2076,10,10}, {2076,10,11}, {2076,10,12}, {2076,10,13}, {2076,10,14}, {2076,10,15}, {2076,10,16}, {2076,10,17}, {2076,10,18}, {2076,10,19}, {2076,10,20}, {2076,10,21}, {2076,10,22}, {2076,10,23}, {2076,10,24}, {2076,10,25}, {2076,10,26}, {2076,10,27}, {2076,10,28}, {2076,10,29}, {2076,10,30}, {2076,10,31}, {2076,11,1}, {2076,11,2}, {2076,11,3}, {2076,11,4}, {2076,11,5}, {2076,11,6}, {2076,11,7}, 
-{2076,11,8}, {2076,11,9}, {2076,11,10}, {2076,11,11}, {2076,11,12}, {2076,11,13}, {2076,11,14}, {2076,11,15}, {2076,11,16}, {2076,11,17}, {2076,11,18}, {2076,11,19}, {2076,11,20}, {2076,11,21}, {2076,11,22}, {2076,11,23}, {2076,11,24}, {2076,11,25}, {2076,11,26}, {2076,11,27}, {2076,11,28}, {2076,11,29}, {2076,11,30}, {2076,12,1}, {2076,12,2}, {2076,12,3}, {2076,12,4}, {2076,12,5}, {2076,12,6}, {2076,12,7}, {2076,12,8}, {2076,12,9}, 
-{2076,12,10}, {2076,12,11}, {2076,12,12}, {2076,12,13}, {2076,12,14}, {2076,12,15}, {2076,12,16}, {2076,12,17}, {2076,12,18}, {2076,12,19}, {2076,12,20}, {2076,12,21}, {2076,12,22}, {2076,12,23}, {2076,12,24}, {2076,12,25}, {2076,12,26}, {2076,12,27}, {2076,12,28}, {2076,12,29}, {2076,12,30}, {2076,12,31}, {2077,1,1}, {2077,1,2}, {2077,1,3}, {2077,1,4}, {2077,1,5}, {2077,1,6}, {2077,1,7}, {2077,1,8}, {2077,1,9}, {2077,1,10}, 
-{2077,1,11}, {2077,1,12}, {2077,1,13}, {2077,1,14}, {2077,1,15}, {2077,1,16}, {2077,1,17}, {2077,1,18}, {2077,1,19}, {2077,1,20}, {2077,1,21}, {2077,1,22}, {2077,1,23}, {2077,1,24}, {2077,1,25}, {2077,1,26}, {2077,1,27}, {2077,1,28}, {2077,1,29}, {2077,1,30}, {2077,1,31}, {2077,2,1}, {2077,2,2}, {2077,2,3}, {2077,2,4}, {2077,2,5}, {2077,2,6}, {2077,2,7}, {2077,2,8}, {2077,2,9}, {2077,2,10}, {2077,2,11}, 
-{2077,2,12}, {2077,2,13}, {2077,2,14}, {2077,2,15}, {2077,2,16}, {2077,2,17}, {2077,2,18}, {2077,2,19}, {2077,2,20}, {2077,2,21}, {2077,2,22}, {2077,2,23}, {2077,2,24}, {2077,2,25}, {2077,2,26}, {2077,2,27}, {2077,2,28}, {2077,3,1}, {2077,3,2}, {2077,3,3}, {2077,3,4}, {2077,3,5}, {2077,3,6}, {2077,3,7}, {2077,3,8}, {2077,3,9}, {2077,3,10}, {2077,3,11}, {2077,3,12}, {2077,3,13}, {2077,3,14}, {2077,3,15}, 
-{2077,3,16}, {2077,3,17}, {2077,3,18}, {2077,3,19}, {2077,3,20}, {2077,3,21}, {2077,3,22}, {2077,3,23}, {2077,3,24}, {2077,3,25}, {2077,3,26}, {2077,3,27}, {2077,3,28}, {2077,3,29}, {2077,3,30}, {2077,3,31}, {2077,4,1}, {2077,4,2}, {2077,4,3}, {2077,4,4}, {2077,4,5}, {2077,4,6}, {2077,4,7}, {2077,4,8}, {2077,4,9}, {2077,4,10}, {2077,4,11}, {2077,4,12}, {2077,4,13}, {2077,4,14}, {2077,4,15}, {2077,4,16}, 
-{2077,4,17}, {2077,4,18}, {2077,4,19}, {2077,4,20}, {2077,4,21}, {2077,4,22}, {2077,4,23}, {2077,4,24}, {2077,4,25}, {2077,4,26}, {2077,4,27}, {2077,4,28}, {2077,4,29}, {2077,4,30}, {2077,5,1}, {2077,5,2}, {2077,5,3}, {2077,5,4}, {2077,5,5}, {2077,5,6}, {2077,5,7}, {2077,5,8}, {2077,5,9}, {2077,5,10}, {2077,5,11}, {2077,5,12}, {2077,5,13}, {2077,5,14}, {2077,5,15}, {2077,5,16}, {2077,5,17}, {2077,5,18}, 
-{2077,5,19}, {2077,5,20}, {2077,5,21}, {2077,5,22}, {2077,5,23}, {2077,5,24}, {2077,5,25}, {2077,5,26}, {2077,5,27}, {2077,5,28}, {2077,5,29}, {2077,5,30}, {2077,5,31}, {2077,6,1}, {2077,6,2}, {2077,6,3}, {2077,6,4}, {2077,6,5}, {2077,6,6}, {2077,6,7}, {2077,6,8}, {2077,6,9}, {2077,6,10}, {2077,6,11}, {2077,6,12}, {2077,6,13}, {2077,6,14}, {2077,6,15}, {2077,6,16}, {2077,6,17}, {2077,6,18}, {2077,6,19}, 
-{2077,6,20}, {2077,6,21}, {2077,6,22}, {2077,6,23}, {2077,6,24}, {2077,6,25}, {2077,6,26}, {2077,6,27}, {2077,6,28}, {2077,6,29}, {2077,6,30}, {2077,7,1}, {2077,7,2}, {2077,7,3}, {2077,7,4}, {2077,7,5}, {2077,7,6}, {2077,7,7}, {2077,7,8}, {2077,7,9}, {2077,7,10}, {2077,7,11}, {2077,7,12}, {2077,7,13}, {2077,7,14}, {2077,7,15}, {2077,7,16}, {2077,7,17}, {2077,7,18}, {2077,7,19}, {2077,7,20}, {2077,7,21}, 
-{2077,7,22}, {2077,7,23}, {2077,7,24}, {2077,7,25}, {2077,7,26}, {2077,7,27}, {2077,7,28}, {2077,7,29}, {2077,7,30}, {2077,7,31}, {2077,8,1}, {2077,8,2}, {2077,8,3}, {2077,8,4}, {2077,8,5}, {2077,8,6}, {2077,8,7}, {2077,8,8}, {2077,8,9}, {2077,8,10}, {2077,8,11}, {2077,8,12}, {2077,8,13}, {2077,8,14}, {2077,8,15}, {2077,8,16}, {2077,8,17}, {2077,8,18}, {2077,8,19}, {2077,8,20}, {2077,8,21}, {2077,8,22}, 
-{2077,8,23}, {2077,8,24}, {2077,8,25}, {2077,8,26}, {2077,8,27}, {2077,8,28}, {2077,8,29}, {2077,8,30}, {2077,8,31}, {2077,9,1}, {2077,9,2}, {2077,9,3}, {2077,9,4}, {2077,9,5}, {2077,9,6}, {2077,9,7}, {2077,9,8}, {2077,9,9}, {2077,9,10}, {2077,9,11}, {2077,9,12}, {2077,9,13}, {2077,9,14}, {2077,9,15}, {2077,9,16}, {2077,9,17}, {2077,9,18}, {2077,9,19}, {2077,9,20}, {2077,9,21}, {2077,9,22}, {2077,9,23}, 
-{2077,9,24}, {2077,9,25}, {2077,9,26}, {2077,9,27}, {2077,9,28}, {2077,9,29}, {2077,9,30}, {2077,10,1}, {2077,10,2}, {2077,10,3}, {2077,10,4}, {2077,10,5}, {2077,10,6}, {2077,10,7}, {2077,10,8}, {2077,10,9}, {2077,10,10}, {2077,10,11}, {2077,10,12}, {2077,10,13}, {2077,10,14}, {2077,10,15}, {2077,10,16}, {2077,10,17}, {2077,10,18}, {2077,10,19}, {2077,10,20}, {2077,10,21}, {2077,10,22}, {2077,10,23}, {2077,10,24}, {2077,10,25}, 
-{2077,10,26}, {2077,10,27}, {2077,10,28}, {2077,10,29}, {2077,10,30}, {2077,10,31}, {2077,11,1}, {2077,11,2}, {2077,11,3}, {2077,11,4}, {2077,11,5}, {2077,11,6}, {2077,11,7}, {2077,11,8}, {2077,11,9}, {2077,11,10}, {2077,11,11}, {2077,11,12}, {2077,11,13}, {2077,11,14}, {2077,11,15}, {2077,11,16}, {2077,11,17}, {2077,11,18}, {2077,11,19}, {2077,11,20}, {2077,11,21}, {2077,11,22}, {2077,11,23}, {2077,11,24}, {2077,11,25}, {2077,11,26}, 
-{2077,11,27}, {2077,11,28}, {2077,11,29}, {2077,11,30}, {2077,12,1}, {2077,12,2}, {2077,12,3}, {2077,12,4}, {2077,12,5}, {2077,12,6}, {2077,12,7}, {2077,12,8}, {2077,12,9}, {2077,12,10}, {2077,12,11}, {2077,12,12}, {2077,12,13}, {2077,12,14}, {2077,12,15}, {2077,12,16}, {2077,12,17}, {2077,12,18}, {2077,12,19}, {2077,12,20}, {2077,12,21}, {2077,12,22}, {2077,12,23}, {2077,12,24}, {2077,12,25}, {2077,12,26}, {2077,12,27}, {2077,12,28}, 
-{2077,12,29}, {2077,12,30}, {2077,12,31}, {2078,1,1}, {2078,1,2}, {2078,1,3}, {2078,1,4}, {2078,1,5}, {2078,1,6}, {2078,1,7}, {2078,1,8}, {2078,1,9}, {2078,1,10}, {2078,1,11}, {2078,1,12}, {2078,1,13}, {2078,1,14}, {2078,1,15}, {2078,1,16}, {2078,1,17}, {2078,1,18}, {2078,1,19}, {2078,1,20}, {2078,1,21}, {2078,1,22}, {2078,1,23}, {2078,1,24}, {2078,1,25}, {2078,1,26}, {2078,1,27}, {2078,1,28}, {2078,1,29}, 
-{2078,1,30}, {2078,1,31}, {2078,2,1}, {2078,2,2}, {2078,2,3}, {2078,2,4}, {2078,2,5}, {2078,2,6}, {2078,2,7}, {2078,2,8}, {2078,2,9}, {2078,2,10}, {2078,2,11}, {2078,2,12}, {2078,2,13}, {2078,2,14}, {2078,2,15}, {2078,2,16}, {2078,2,17}, {2078,2,18}, {2078,2,19}, {2078,2,20}, {2078,2,21}, {2078,2,22}, {2078,2,23}, {2078,2,24}, {2078,2,25}, {2078,2,26}, {2078,2,27}, {2078,2,28}, {2078,3,1}, {2078,3,2}, 
-{2078,3,3}, {2078,3,4}, {2078,3,5}, {2078,3,6}, {2078,3,7}, {2078,3,8}, {2078,3,9}, {2078,3,10}, {2078,3,11}, {2078,3,12}, {2078,3,13}, {2078,3,14}, {2078,3,15}, {2078,3,16}, {2078,3,17}, {2078,3,18}, {2078,3,19}, {2078,3,20}, {2078,3,21}, {2078,3,22}, {2078,3,23}, {2078,3,24}, {2078,3,25}, {2078,3,26}, {2078,3,27}, {2078,3,28}, {2078,3,29}, {2078,3,30}, {2078,3,31}, {2078,4,1}, {2078,4,2}, {2078,4,3}, 
-{2078,4,4}, {2078,4,5}, {2078,4,6}, {2078,4,7}, {2078,4,8}, {2078,4,9}, {2078,4,10}, {2078,4,11}, {2078,4,12}, {2078,4,13}, {2078,4,14}, {2078,4,15}, {2078,4,16}, {2078,4,17}, {2078,4,18}, {2078,4,19}, {2078,4,20}, {2078,4,21}, {2078,4,22}, {2078,4,23}, {2078,4,24}, {2078,4,25}, {2078,4,26}, {2078,4,27}, {2078,4,28}, {2078,4,29}, {2078,4,30}, {2078,5,1}, {2078,5,2}, {2078,5,3}, {2078,5,4}, {2078,5,5}, 
-{2078,5,6}, {2078,5,7}, {2078,5,8}, {2078,5,9}, {2078,5,10}, {2078,5,11}, {2078,5,12}, {2078,5,13}, {2078,5,14}, {2078,5,15}, {2078,5,16}, {2078,5,17}, {2078,5,18}, {2078,5,19}, {2078,5,20}, {2078,5,21}, {2078,5,22}, {2078,5,23}, {2078,5,24}, {2078,5,25}, {2078,5,26}, {2078,5,27}, {2078,5,28}, {2078,5,29}, {2078,5,30}, {2078,5,31}, {2078,6,1}, {2078,6,2}, {2078,6,3}, {2078,6,4}, {2078,6,5}, {2078,6,6}, 
-{2078,6,7}, {2078,6,8}, {2078,6,9}, {2078,6,10}, {2078,6,11}, {2078,6,12}, {2078,6,13}, {2078,6,14}, {2078,6,15}, {2078,6,16}, {2078,6,17}, {2078,6,18}, {2078,6,19}, {2078,6,20}, {2078,6,21}, {2078,6,22}, {2078,6,23}, {2078,6,24}, {2078,6,25}, {2078,6,26}, {2078,6,27}, {2078,6,28}, {2078,6,29}, {2078,6,30}, {2078,7,1}, {2078,7,2}, {2078,7,3}, {2078,7,4}, {2078,7,5}, {2078,7,6}, {2078,7,7}, {2078,7,8}, 
-{2078,7,9}, {2078,7,10}, {2078,7,11}, {2078,7,12}, {2078,7,13}, {2078,7,14}, {2078,7,15}, {2078,7,16}, {2078,7,17}, {2078,7,18}, {2078,7,19}, {2078,7,20}, {2078,7,21}, {2078,7,22}, {2078,7,23}, {2078,7,24}, {2078,7,25}, {2078,7,26}, {2078,7,27}, {2078,7,28}, {2078,7,29}, {2078,7,30}, {2078,7,31}, {2078,8,1}, {2078,8,2}, {2078,8,3}, {2078,8,4}, {2078,8,5}, {2078,8,6}, {2078,8,7}, {2078,8,8}, {2078,8,9}, 
-{2078,8,10}, {2078,8,11}, {2078,8,12}, {2078,8,13}, {2078,8,14}, {2078,8,15}, {2078,8,16}, {2078,8,17}, {2078,8,18}, {2078,8,19}, {2078,8,20}, {2078,8,21}, {2078,8,22}, {2078,8,23}, {2078,8,24}, {2078,8,25}, {2078,8,26}, {2078,8,27}, {2078,8,28}, {2078,8,29}, {2078,8,30}, {2078,8,31}, {2078,9,1}, {2078,9,2}, {2078,9,3}, {2078,9,4}, {2078,9,5}, {2078,9,6}, {2078,9,7}, {2078,9,8}, {2078,9,9}, {2078,9,10}, 
-{2078,9,11}, {2078,9,12}, {2078,9,13}, {2078,9,14}, {2078,9,15}, {2078,9,16}, {2078,9,17}, {2078,9,18}, {2078,9,19}, {2078,9,20}, {2078,9,21}, {2078,9,22}, {2078,9,23}, {2078,9,24}, {2078,9,25}, {2078,9,26}, {2078,9,27}, {2078,9,28}, {2078,9,29}, {2078,9,30}, {2078,10,1}, {2078,10,2}, {2078,10,3}, {2078,10,4}, {2078,10,5}, {2078,10,6}, {2078,10,7}, {2078,10,8}, {2078,10,9}, {2078,10,10}, {2078,10,11}, {2078,10,12}, 
-{2078,10,13}, {2078,10,14}, {2078,10,15}, {2078,10,16}, {2078,10,17}, {2078,10,18}, {2078,10,19}, {2078,10,20}, {2078,10,21}, {2078,10,22}, {2078,10,23}, {2078,10,24}, {2078,10,25}, {2078,10,26}, {2078,10,27}, {2078,10,28}, {2078,10,29}, {2078,10,30}, {2078,10,31}, {2078,11,1}, {2078,11,2}, {2078,11,3}, {2078,11,4}, {2078,11,5}, {2078,11,6}, {2078,11,7}, {2078,11,8}, {2078,11,9}, {2078,11,10}, {2078,11,11}, {2078,11,12}, {2078,11,13}, 
-{2078,11,14}, {2078,11,15}, {2078,11,16}, {2078,11,17}, {2078,11,18}, {2078,11,19}, {2078,11,20}, {2078,11,21}, {2078,11,22}, {2078,11,23}, {2078,11,24}, {2078,11,25}, {2078,11,26}, {2078,11,27}, {2078,11,28}, {2078,11,29}, {2078,11,30}, {2078,12,1}, {2078,12,2}, {2078,12,3}, {2078,12,4}, {2078,12,5}, {2078,12,6}, {2078,12,7}, {2078,12,8}, {2078,12,9}, {2078,12,10}, {2078,12,11}, {2078,12,12}, {2078,12,13}, {2078,12,14}, {2078,12,15}, 
-{2078,12,16}, {2078,12,17}, {2078,12,18}, {2078,12,19}, {2078,12,20}, {2078,12,21}, {2078,12,22}, {2078,12,23}, {2078,12,24}, {2078,12,25}, {2078,12,26}, {2078,12,27}, {2078,12,28}, {2078,12,29}, {2078,12,30}, {2078,12,31}, {2079,1,1}, {2079,1,2}, {2079,1,3}, {2079,1,4}, {2079,1,5}, {2079,1,6}, {2079,1,7}, {2079,1,8}, {2079,1,9}, {2079,1,10}, {2079,1,11}, {2079,1,12}, {2079,1,13}, {2079,1,14}, {2079,1,15}, {2079,1,16}, 
-{2079,1,17}, {2079,1,18}, {2079,1,19}, {2079,1,20}, {2079,1,21}, {2079,1,22}, {2079,1,23}, {2079,1,24}, {2079,1,25}, {2079,1,26}, {2079,1,27}, {2079,1,28}, {2079,1,29}, {2079,1,30}, {2079,1,31}, {2079,2,1}, {2079,2,2}, {2079,2,3}, {2079,2,4}, {2079,2,5}, {2079,2,6}, {2079,2,7}, {2079,2,8}, {2079,2,9}, {2079,2,10}, {2079,2,11}, {2079,2,12}, {2079,2,13}, {2079,2,14}, {2079,2,15}, {2079,2,16}, {2079,2,17}, 
-{2079,2,18}, {2079,2,19}, {2079,2,20}, {2079,2,21}, {2079,2,22}, {2079,2,23}, {2079,2,24}, {2079,2,25}, {2079,2,26}, {2079,2,27}, {2079,2,28}, {2079,3,1}, {2079,3,2}, {2079,3,3}, {2079,3,4}, {2079,3,5}, {2079,3,6}, {2079,3,7}, {2079,3,8}, {2079,3,9}, {2079,3,10}, {2079,3,11}, {2079,3,12}, {2079,3,13}, {2079,3,14}, {2079,3,15}, {2079,3,16}, {2079,3,17}, {2079,3,18}, {2079,3,19}, {2079,3,20}, {2079,3,21}, 
-{2079,3,22}, {2079,3,23}, {2079,3,24}, {2079,3,25}, {2079,3,26}, {2079,3,27}, {2079,3,28}, {2079,3,29}, {2079,3,30}, {2079,3,31}, {2079,4,1}, {2079,4,2}, {2079,4,3}, {2079,4,4}, {2079,4,5}, {2079,4,6}, {2079,4,7}, {2079,4,8}, {2079,4,9}, {2079,4,10}, {2079,4,11}, {2079,4,12}, {2079,4,13}, {2079,4,14}, {2079,4,15}, {2079,4,16}, {2079,4,17}, {2079,4,18}, {2079,4,19}, {2079,4,20}, {2079,4,21}, {2079,4,22}, 
-{2079,4,23}, {2079,4,24}, {2079,4,25}, {2079,4,26}, {2079,4,27}, {2079,4,28}, {2079,4,29}, {2079,4,30}, {2079,5,1}, {2079,5,2}, {2079,5,3}, {2079,5,4}, {2079,5,5}, {2079,5,6}, {2079,5,7}, {2079,5,8}, {2079,5,9}, {2079,5,10}, {2079,5,11}, {2079,5,12}, {2079,5,13}, {2079,5,14}, {2079,5,15}, {2079,5,16}, {2079,5,17}, {2079,5,18}, {2079,5,19}, {2079,5,20}, {2079,5,21}, {2079,5,22}, {2079,5,23}, {2079,5,24}, 
-{2079,5,25}, {2079,5,26}, {2079,5,27}, {2079,5,28}, {2079,5,29}, {2079,5,30}, {2079,5,31}, {2079,6,1}, {2079,6,2}, {2079,6,3}, {2079,6,4}, {2079,6,5}, {2079,6,6}, {2079,6,7}, {2079,6,8}, {2079,6,9}, {2079,6,10}, {2079,6,11}, {2079,6,12}, {2079,6,13}, {2079,6,14}, {2079,6,15}, {2079,6,16}, {2079,6,17}, {2079,6,18}, {2079,6,19}, {2079,6,20}, {2079,6,21}, {2079,6,22}, {2079,6,23}, {2079,6,24}, {2079,6,25}, 
-{2079,6,26}, {2079,6,27}, {2079,6,28}, {2079,6,29}, {2079,6,30}, {2079,7,1}, {2079,7,2}, {2079,7,3}, {2079,7,4}, {2079,7,5}, {2079,7,6}, {2079,7,7}, {2079,7,8}, {2079,7,9}, {2079,7,10}, {2079,7,11}, {2079,7,12}, {2079,7,13}, {2079,7,14}, {2079,7,15}, {2079,7,16}, {2079,7,17}, {2079,7,18}, {2079,7,19}, {2079,7,20}, {2079,7,21}, {2079,7,22}, {2079,7,23}, {2079,7,24}, {2079,7,25}, {2079,7,26}, {2079,7,27}, 
-{2079,7,28}, {2079,7,29}, {2079,7,30}, {2079,7,31}, {2079,8,1}, {2079,8,2}, {2079,8,3}, {2079,8,4}, {2079,8,5}, {2079,8,6}, {2079,8,7}, {2079,8,8}, {2079,8,9}, {2079,8,10}, {2079,8,11}, {2079,8,12}, {2079,8,13}, {2079,8,14}, {2079,8,15}, {2079,8,16}, {2079,8,17}, {2079,8,18}, {2079,8,19}, {2079,8,20}, {2079,8,21}, {2079,8,22}, {2079,8,23}, {2079,8,24}, {2079,8,25}, {2079,8,26}, {2079,8,27}, {2079,8,28}, 
-{2079,8,29}, {2079,8,30}, {2079,8,31}, {2079,9,1}, {2079,9,2}, {2079,9,3}, {2079,9,4}, {2079,9,5}, {2079,9,6}, {2079,9,7}, {2079,9,8}, {2079,9,9}, {2079,9,10}, {2079,9,11}, {2079,9,12}, {2079,9,13}, {2079,9,14}, {2079,9,15}, {2079,9,16}, {2079,9,17}, {2079,9,18}, {2079,9,19}, {2079,9,20}, {2079,9,21}, {2079,9,22}, {2079,9,23}, {2079,9,24}, {2079,9,25}, {2079,9,26}, {2079,9,27}, {2079,9,28}, {2079,9,29}, 
-{2079,9,30}, {2079,10,1}, {2079,10,2}, {2079,10,3}, {2079,10,4}, {2079,10,5}, {2079,10,6}, {2079,10,7}, {2079,10,8}, {2079,10,9}, {2079,10,10}, {2079,10,11}, {2079,10,12}, {2079,10,13}, {2079,10,14}, {2079,10,15}, {2079,10,16}, {2079,10,17}, {2079,10,18}, {2079,10,19}, {2079,10,20}, {2079,10,21}, {2079,10,22}, {2079,10,23}, {2079,10,24}, {2079,10,25}, {2079,10,26}, {2079,10,27}, {2079,10,28}, {2079,10,29}, {2079,10,30}, {2079,10,31}, 
-{2079,11,1}, {2079,11,2}, {2079,11,3}, {2079,11,4}, {2079,11,5}, {2079,11,6}, {2079,11,7}, {2079,11,8}, {2079,11,9}, {2079,11,10}, {2079,11,11}, {2079,11,12}, {2079,11,13}, {2079,11,14}, {2079,11,15}, {2079,11,16}, {2079,11,17}, {2079,11,18}, {2079,11,19}, {2079,11,20}, {2079,11,21}, {2079,11,22}, {2079,11,23}, {2079,11,24}, {2079,11,25}, {2079,11,26}, {2079,11,27}, {2079,11,28}, {2079,11,29}, {2079,11,30}, {2079,12,1}, {2079,12,2}, 
-{2079,12,3}, {2079,12,4}, {2079,12,5}, {2079,12,6}, {2079,12,7}, {2079,12,8}, {2079,12,9}, {2079,12,10}, {2079,12,11}, {2079,12,12}, {2079,12,13}, {2079,12,14}, {2079,12,15}, {2079,12,16}, {2079,12,17}, {2079,12,18}, {2079,12,19}, {2079,12,20}, {2079,12,21}, {2079,12,22}, {2079,12,23}, {2079,12,24}, {2079,12,25}, {2079,12,26}, {2079,12,27}, {2079,12,28}, {2079,12,29}, {2079,12,30}, {2079,12,31}, {2080,1,1}, {2080,1,2}, {2080,1,3}, 
-{2080,1,4}, {2080,1,5}, {2080,1,6}, {2080,1,7}, {2080,1,8}, {2080,1,9}, {2080,1,10}, {2080,1,11}, {2080,1,12}, {2080,1,13}, {2080,1,14}, {2080,1,15}, {2080,1,16}, {2080,1,17}, {2080,1,18}, {2080,1,19}, {2080,1,20}, {2080,1,21}, {2080,1,22}, {2080,1,23}, {2080,1,24}, {2080,1,25}, {2080,1,26}, {2080,1,27}, {2080,1,28}, {2080,1,29}, {2080,1,30}, {2080,1,31}, {2080,2,1}, {2080,2,2}, {2080,2,3}, {2080,2,4}, 
-{2080,2,5}, {2080,2,6}, {2080,2,7}, {2080,2,8}, {2080,2,9}, {2080,2,10}, {2080,2,11}, {2080,2,12}, {2080,2,13}, {2080,2,14}, {2080,2,15}, {2080,2,16}, {2080,2,17}, {2080,2,18}, {2080,2,19}, {2080,2,20}, {2080,2,21}, {2080,2,22}, {2080,2,23}, {2080,2,24}, {2080,2,25}, {2080,2,26}, {2080,2,27}, {2080,2,28}, {2080,2,29}, {2080,3,1}, {2080,3,2}, {2080,3,3}, {2080,3,4}, {2080,3,5}, {2080,3,6}, {2080,3,7}, 
-{2080,3,8}, {2080,3,9}, {2080,3,10}, {2080,3,11}, {2080,3,12}, {2080,3,13}, {2080,3,14}, {2080,3,15}, {2080,3,16}, {2080,3,17}, {2080,3,18}, {2080,3,19}, {2080,3,20}, {2080,3,21}, {2080,3,22}, {2080,3,23}, {2080,3,24}, {2080,3,25}, {2080,3,26}, {2080,3,27}, {2080,3,28}, {2080,3,29}, {2080,3,30}, {2080,3,31}, {2080,4,1}, {2080,4,2}, {2080,4,3}, {2080,4,4}, {2080,4,5}, {2080,4,6}, {2080,4,7}, {2080,4,8}, 
-{2080,4,9}, {2080,4,10}, {2080,4,11}, {2080,4,12}, {2080,4,13}, {2080,4,14}, {2080,4,15}, {2080,4,16}, {2080,4,17}, {2080,4,18}, {2080,4,19}, {2080,4,20}, {2080,4,21}, {2080,4,22}, {2080,4,23}, {2080,4,24}, {2080,4,25}, {2080,4,26}, {2080,4,27}, {2080,4,28}, {2080,4,29}, {2080,4,30}, {2080,5,1}, {2080,5,2}, {2080,5,3}, {2080,5,4}, {2080,5,5}, {2080,5,6}, {2080,5,7}, {2080,5,8}, {2080,5,9}, {2080,5,10}, 
-{2080,5,11}, {2080,5,12}, {2080,5,13}, {2080,5,14}, {2080,5,15}, {2080,5,16}, {2080,5,17}, {2080,5,18}, {2080,5,19}, {2080,5,20}, {2080,5,21}, {2080,5,22}, {2080,5,23}, {2080,5,24}, {2080,5,25}, {2080,5,26}, {2080,5,27}, {2080,5,28}, {2080,5,29}, {2080,5,30}, {2080,5,31}, {2080,6,1}, {2080,6,2}, {2080,6,3}, {2080,6,4}, {2080,6,5}, {2080,6,6}, {2080,6,7}, {2080,6,8}, {2080,6,9}, {2080,6,10}, {2080,6,11}, 
-{2080,6,12}, {2080,6,13}, {2080,6,14}, {2080,6,15}, {2080,6,16}, {2080,6,17}, {2080,6,18}, {2080,6,19}, {2080,6,20}, {2080,6,21}, {2080,6,22}, {2080,6,23}, {2080,6,24}, {2080,6,25}, {2080,6,26}, {2080,6,27}, {2080,6,28}, {2080,6,29}, {2080,6,30}, {2080,7,1}, {2080,7,2}, {2080,7,3}, {2080,7,4}, {2080,7,5}, {2080,7,6}, {2080,7,7}, {2080,7,8}, {2080,7,9}, {2080,7,10}, {2080,7,11}, {2080,7,12}, {2080,7,13}, 
-{2080,7,14}, {2080,7,15}, {2080,7,16}, {2080,7,17}, {2080,7,18}, {2080,7,19}, {2080,7,20}, {2080,7,21}, {2080,7,22}, {2080,7,23}, {2080,7,24}, {2080,7,25}, {2080,7,26}, {2080,7,27}, {2080,7,28}, {2080,7,29}, {2080,7,30}, {2080,7,31}, {2080,8,1}, {2080,8,2}, {2080,8,3}, {2080,8,4}, {2080,8,5}, {2080,8,6}, {2080,8,7}, {2080,8,8}, {2080,8,9}, {2080,8,10}, {2080,8,11}, {2080,8,12}, {2080,8,13}, {2080,8,14}, 
-{2080,8,15}, {2080,8,16}, {2080,8,17}, {2080,8,18}, {2080,8,19}, {2080,8,20}, {2080,8,21}, {2080,8,22}, {2080,8,23}, {2080,8,24}, {2080,8,25}, {2080,8,26}, {2080,8,27}, {2080,8,28}, {2080,8,29}, {2080,8,30}, {2080,8,31}, {2080,9,1}, {2080,9,2}, {2080,9,3}, {2080,9,4}, {2080,9,5}, {2080,9,6}, {2080,9,7}, {2080,9,8}, {2080,9,9}, {2080,9,10}, {2080,9,11}, {2080,9,12}, {2080,9,13}, {2080,9,14}, {2080,9,15}, 
-{2080,9,16}, {2080,9,17}, {2080,9,18}, {2080,9,19}, {2080,9,20}, {2080,9,21}, {2080,9,22}, {2080,9,23}, {2080,9,24}, {2080,9,25}, {2080,9,26}, {2080,9,27}, {2080,9,28}, {2080,9,29}, {2080,9,30}, {2080,10,1}, {2080,10,2}, {2080,10,3}, {2080,10,4}, {2080,10,5}, {2080,10,6}, {2080,10,7}, {2080,10,8}, {2080,10,9}, {2080,10,10}, {2080,10,11}, {2080,10,12}, {2080,10,13}, {2080,10,14}, {2080,10,15}, {2080,10,16}, {2080,10,17}, 
-{2080,10,18}, {2080,10,19}, {2080,10,20}, {2080,10,21}, {2080,10,22}, {2080,10,23}, {2080,10,24}, {2080,10,25}, {2080,10,26}, {2080,10,27}, {2080,10,28}, {2080,10,29}, {2080,10,30}, {2080,10,31}, {2080,11,1}, {2080,11,2}, {2080,11,3}, {2080,11,4}, {2080,11,5}, {2080,11,6}, {2080,11,7}, {2080,11,8}, {2080,11,9}, {2080,11,10}, {2080,11,11}, {2080,11,12}, {2080,11,13}, {2080,11,14}, {2080,11,15}, {2080,11,16}, {2080,11,17}, {2080,11,18}, 
-{2080,11,19}, {2080,11,20}, {2080,11,21}, {2080,11,22}, {2080,11,23}, {2080,11,24}, {2080,11,25}, {2080,11,26}, {2080,11,27}, {2080,11,28}, {2080,11,29}, {2080,11,30}, {2080,12,1}, {2080,12,2}, {2080,12,3}, {2080,12,4}, {2080,12,5}, {2080,12,6}, {2080,12,7}, {2080,12,8}, {2080,12,9}, {2080,12,10}, {2080,12,11}, {2080,12,12}, {2080,12,13}, {2080,12,14}, {2080,12,15}, {2080,12,16}, {2080,12,17}, {2080,12,18}, {2080,12,19}, {2080,12,20}, 
-{2080,12,21}, {2080,12,22}, {2080,12,23}, {2080,12,24}, {2080,12,25}, {2080,12,26}, {2080,12,27}, {2080,12,28}, {2080,12,29}, {2080,12,30}, {2080,12,31}, {2081,1,1}, {2081,1,2}, {2081,1,3}, {2081,1,4}, {2081,1,5}, {2081,1,6}, {2081,1,7}, {2081,1,8}, {2081,1,9}, {2081,1,10}, {2081,1,11}, {2081,1,12}, {2081,1,13}, {2081,1,14}, {2081,1,15}, {2081,1,16}, {2081,1,17}, {2081,1,18}, {2081,1,19}, {2081,1,20}, {2081,1,21}, 
-{2081,1,22}, {2081,1,23}, {2081,1,24}, {2081,1,25}, {2081,1,26}, {2081,1,27}, {2081,1,28}, {2081,1,29}, {2081,1,30}, {2081,1,31}, {2081,2,1}, {2081,2,2}, {2081,2,3}, {2081,2,4}, {2081,2,5}, {2081,2,6}, {2081,2,7}, {2081,2,8}, {2081,2,9}, {2081,2,10}, {2081,2,11}, {2081,2,12}, {2081,2,13}, {2081,2,14}, {2081,2,15}, {2081,2,16}, {2081,2,17}, {2081,2,18}, {2081,2,19}, {2081,2,20}, {2081,2,21}, {2081,2,22}, 
-{2081,2,23}, {2081,2,24}, {2081,2,25}, {2081,2,26}, {2081,2,27}, {2081,2,28}, {2081,3,1}, {2081,3,2}, {2081,3,3}, {2081,3,4}, {2081,3,5}, {2081,3,6}, {2081,3,7}, {2081,3,8}, {2081,3,9}, {2081,3,10}, {2081,3,11}, {2081,3,12}, {2081,3,13}, {2081,3,14}, {2081,3,15}, {2081,3,16}, {2081,3,17}, {2081,3,18}, {2081,3,19}, {2081,3,20}, {2081,3,21}, {2081,3,22}, {2081,3,23}, {2081,3,24}, {2081,3,25}, {2081,3,26}, 
-{2081,3,27}, {2081,3,28}, {2081,3,29}, {2081,3,30}, {2081,3,31}, {2081,4,1}, {2081,4,2}, {2081,4,3}, {2081,4,4}, {2081,4,5}, {2081,4,6}, {2081,4,7}, {2081,4,8}, {2081,4,9}, {2081,4,10}, {2081,4,11}, {2081,4,12}, {2081,4,13}, {2081,4,14}, {2081,4,15}, {2081,4,16}, {2081,4,17}, {2081,4,18}, {2081,4,19}, {2081,4,20}, {2081,4,21}, {2081,4,22}, {2081,4,23}, {2081,4,24}, {2081,4,25}, {2081,4,26}, {2081,4,27}, 
-{2081,4,28}, {2081,4,29}, {2081,4,30}, {2081,5,1}, {2081,5,2}, {2081,5,3}, {2081,5,4}, {2081,5,5}, {2081,5,6}, {2081,5,7}, {2081,5,8}, {2081,5,9}, {2081,5,10}, {2081,5,11}, {2081,5,12}, {2081,5,13}, {2081,5,14}, {2081,5,15}, {2081,5,16}, {2081,5,17}, {2081,5,18}, {2081,5,19}, {2081,5,20}, {2081,5,21}, {2081,5,22}, {2081,5,23}, {2081,5,24}, {2081,5,25}, {2081,5,26}, {2081,5,27}, {2081,5,28}, {2081,5,29}, 
-{2081,5,30}, {2081,5,31}, {2081,6,1}, {2081,6,2}, {2081,6,3}, {2081,6,4}, {2081,6,5}, {2081,6,6}, {2081,6,7}, {2081,6,8}, {2081,6,9}, {2081,6,10}, {2081,6,11}, {2081,6,12}, {2081,6,13}, {2081,6,14}, {2081,6,15}, {2081,6,16}, {2081,6,17}, {2081,6,18}, {2081,6,19}, {2081,6,20}, {2081,6,21}, {2081,6,22}, {2081,6,23}, {2081,6,24}, {2081,6,25}, {2081,6,26}, {2081,6,27}, {2081,6,28}, {2081,6,29}, {2081,6,30}, 
-{2081,7,1}, {2081,7,2}, {2081,7,3}, {2081,7,4}, {2081,7,5}, {2081,7,6}, {2081,7,7}, {2081,7,8}, {2081,7,9}, {2081,7,10}, {2081,7,11}, {2081,7,12}, {2081,7,13}, {2081,7,14}, {2081,7,15}, {2081,7,16}, {2081,7,17}, {2081,7,18}, {2081,7,19}, {2081,7,20}, {2081,7,21}, {2081,7,22}, {2081,7,23}, {2081,7,24}, {2081,7,25}, {2081,7,26}, {2081,7,27}, {2081,7,28}, {2081,7,29}, {2081,7,30}, {2081,7,31}, {2081,8,1}, 
-{2081,8,2}, {2081,8,3}, {2081,8,4}, {2081,8,5}, {2081,8,6}, {2081,8,7}, {2081,8,8}, {2081,8,9}, {2081,8,10}, {2081,8,11}, {2081,8,12}, {2081,8,13}, {2081,8,14}, {2081,8,15}, {2081,8,16}, {2081,8,17}, {2081,8,18}, {2081,8,19}, {2081,8,20}, {2081,8,21}, {2081,8,22}, {2081,8,23}, {2081,8,24}, {2081,8,25}, {2081,8,26}, {2081,8,27}, {2081,8,28}, {2081,8,29}, {2081,8,30}, {2081,8,31}, {2081,9,1}, {2081,9,2}, 
-{2081,9,3}, {2081,9,4}, {2081,9,5}, {2081,9,6}, {2081,9,7}, {2081,9,8}, {2081,9,9}, {2081,9,10}, {2081,9,11}, {2081,9,12}, {2081,9,13}, {2081,9,14}, {2081,9,15}, {2081,9,16}, {2081,9,17}, {2081,9,18}, {2081,9,19}, {2081,9,20}, {2081,9,21}, {2081,9,22}, {2081,9,23}, {2081,9,24}, {2081,9,25}, {2081,9,26}, {2081,9,27}, {2081,9,28}, {2081,9,29}, {2081,9,30}, {2081,10,1}, {2081,10,2}, {2081,10,3}, {2081,10,4}, 
-{2081,10,5}, {2081,10,6}, {2081,10,7}, {2081,10,8}, {2081,10,9}, {2081,10,10}, {2081,10,11}, {2081,10,12}, {2081,10,13}, {2081,10,14}, {2081,10,15}, {2081,10,16}, {2081,10,17}, {2081,10,18}, {2081,10,19}, {2081,10,20}, {2081,10,21}, {2081,10,22}, {2081,10,23}, {2081,10,24}, {2081,10,25}, {2081,10,26}, {2081,10,27}, {2081,10,28}, {2081,10,29}, {2081,10,30}, {2081,10,31}, {2081,11,1}, {2081,11,2}, {2081,11,3}, {2081,11,4}, {2081,11,5}, 
-{2081,11,6}, {2081,11,7}, {2081,11,8}, {2081,11,9}, {2081,11,10}, {2081,11,11}, {2081,11,12}, {2081,11,13}, {2081,11,14}, {2081,11,15}, {2081,11,16}, {2081,11,17}, {2081,11,18}, {2081,11,19}, {2081,11,20}, {2081,11,21}, {2081,11,22}, {2081,11,23}, {2081,11,24}, {2081,11,25}, {2081,11,26}, {2081,11,27}, {2081,11,28}, {2081,11,29}, {2081,11,30}, {2081,12,1}, {2081,12,2}, {2081,12,3}, {2081,12,4}, {2081,12,5}, {2081,12,6}, {2081,12,7}, 
-{2081,12,8}, {2081,12,9}, {2081,12,10}, {2081,12,11}, {2081,12,12}, {2081,12,13}, {2081,12,14}, {2081,12,15}, {2081,12,16}, {2081,12,17}, {2081,12,18}, {2081,12,19}, {2081,12,20}, {2081,12,21}, {2081,12,22}, {2081,12,23}, {2081,12,24}, {2081,12,25}, {2081,12,26}, {2081,12,27}, {2081,12,28}, {2081,12,29}, {2081,12,30}, {2081,12,31}, {2082,1,1}, {2082,1,2}, {2082,1,3}, {2082,1,4}, {2082,1,5}, {2082,1,6}, {2082,1,7}, {2082,1,8}, 
-{2082,1,9}, {2082,1,10}, {2082,1,11}, {2082,1,12}, {2082,1,13}, {2082,1,14}, {2082,1,15}, {2082,1,16}, {2082,1,17}, {2082,1,18}, {2082,1,19}, {2082,1,20}, {2082,1,21}, {2082,1,22}, {2082,1,23}, {2082,1,24}, {2082,1,25}, {2082,1,26}, {2082,1,27}, {2082,1,28}, {2082,1,29}, {2082,1,30}, {2082,1,31}, {2082,2,1}, {2082,2,2}, {2082,2,3}, {2082,2,4}, {2082,2,5}, {2082,2,6}, {2082,2,7}, {2082,2,8}, {2082,2,9}, 
-{2082,2,10}, {2082,2,11}, {2082,2,12}, {2082,2,13}, {2082,2,14}, {2082,2,15}, {2082,2,16}, {2082,2,17}, {2082,2,18}, {2082,2,19}, {2082,2,20}, {2082,2,21}, {2082,2,22}, {2082,2,23}, {2082,2,24}, {2082,2,25}, {2082,2,26}, {2082,2,27}, {2082,2,28}, {2082,3,1}, {2082,3,2}, {2082,3,3}, {2082,3,4}, {2082,3,5}, {2082,3,6}, {2082,3,7}, {2082,3,8}, {2082,3,9}, {2082,3,10}, {2082,3,11}, {2082,3,12}, {2082,3,13}, 
-{2082,3,14}, {2082,3,15}, {2082,3,16}, {2082,3,17}, {2082,3,18}, {2082,3,19}, {2082,3,20}, {2082,3,21}, {2082,3,22}, {2082,3,23}, {2082,3,24}, {2082,3,25}, {2082,3,26}, {2082,3,27}, {2082,3,28}, {2082,3,29}, {2082,3,30}, {2082,3,31}, {2082,4,1}, {2082,4,2}, {2082,4,3}, {2082,4,4}, {2082,4,5}, {2082,4,6}, {2082,4,7}, {2082,4,8}, {2082,4,9}, {2082,4,10}, {2082,4,11}, {2082,4,12}, {2082,4,13}, {2082,4,14}, 
-{2082,4,15}, {2082,4,16}, {2082,4,17}, {2082,4,18}, {2082,4,19}, {2082,4,20}, {2082,4,21}, {2082,4,22}, {2082,4,23}, {2082,4,24}, {2082,4,25}, {2082,4,26}, {2082,4,27}, {2082,4,28}, {2082,4,29}, {2082,4,30}, {2082,5,1}, {2082,5,2}, {2082,5,3}, {2082,5,4}, {2082,5,5}, {2082,5,6}, {2082,5,7}, {2082,5,8}, {2082,5,9}, {2082,5,10}, {2082,5,11}, {2082,5,12}, {2082,5,13}, {2082,5,14}, {2082,5,15}, {2082,5,16}, 
-{2082,5,17}, {2082,5,18}, {2082,5,19}, {2082,5,20}, {2082,5,21}, {2082,5,22}, {2082,5,23}, {2082,5,24}, {2082,5,25}, {2082,5,26}, {2082,5,27}, {2082,5,28}, {2082,5,29}, {2082,5,30}, {2082,5,31}, {2082,6,1}, {2082,6,2}, {2082,6,3}, {2082,6,4}, {2082,6,5}, {2082,6,6}, {2082,6,7}, {2082,6,8}, {2082,6,9}, {2082,6,10}, {2082,6,11}, {2082,6,12}, {2082,6,13}, {2082,6,14}, {2082,6,15}, {2082,6,16}, {2082,6,17}, 
-{2082,6,18}, {2082,6,19}, {2082,6,20}, {2082,6,21}, {2082,6,22}, {2082,6,23}, {2082,6,24}, {2082,6,25}, {2082,6,26}, {2082,6,27}, {2082,6,28}, {2082,6,29}, {2082,6,30}, {2082,7,1}, {2082,7,2}, {2082,7,3}, {2082,7,4}, {2082,7,5}, {2082,7,6}, {2082,7,7}, {2082,7,8}, {2082,7,9}, {2082,7,10}, {2082,7,11}, {2082,7,12}, {2082,7,13}, {2082,7,14}, {2082,7,15}, {2082,7,16}, {2082,7,17}, {2082,7,18}, {2082,7,19}, 
-{2082,7,20}, {2082,7,21}, {2082,7,22}, {2082,7,23}, {2082,7,24}, {2082,7,25}, {2082,7,26}, {2082,7,27}, {2082,7,28}, {2082,7,29}, {2082,7,30}, {2082,7,31}, {2082,8,1}, {2082,8,2}, {2082,8,3}, {2082,8,4}, {2082,8,5}, {2082,8,6}, {2082,8,7}, {2082,8,8}, {2082,8,9}, {2082,8,10}, {2082,8,11}, {2082,8,12}, {2082,8,13}, {2082,8,14}, {2082,8,15}, {2082,8,16}, {2082,8,17}, {2082,8,18}, {2082,8,19}, {2082,8,20}, 
-{2082,8,21}, {2082,8,22}, {2082,8,23}, {2082,8,24}, {2082,8,25}, {2082,8,26}, {2082,8,27}, {2082,8,28}, {2082,8,29}, {2082,8,30}, {2082,8,31}, {2082,9,1}, {2082,9,2}, {2082,9,3}, {2082,9,4}, {2082,9,5}, {2082,9,6}, {2082,9,7}, {2082,9,8}, {2082,9,9}, {2082,9,10}, {2082,9,11}, {2082,9,12}, {2082,9,13}, {2082,9,14}, {2082,9,15}, {2082,9,16}, {2082,9,17}, {2082,9,18}, {2082,9,19}, {2082,9,20}, {2082,9,21}, 
-{2082,9,22}, {2082,9,23}, {2082,9,24}, {2082,9,25}, {2082,9,26}, {2082,9,27}, {2082,9,28}, {2082,9,29}, {2082,9,30}, {2082,10,1}, {2082,10,2}, {2082,10,3}, {2082,10,4}, {2082,10,5}, {2082,10,6}, {2082,10,7}, {2082,10,8}, {2082,10,9}, {2082,10,10}, {2082,10,11}, {2082,10,12}, {2082,10,13}, {2082,10,14}, {2082,10,15}, {2082,10,16}, {2082,10,17}, {2082,10,18}, {2082,10,19}, {2082,10,20}, {2082,10,21}, {2082,10,22}, {2082,10,23}, 
-{2082,10,24}, {2082,10,25}, {2082,10,26}, {2082,10,27}, {2082,10,28}, {2082,10,29}, {2082,10,30}, {2082,10,31}, {2082,11,1}, {2082,11,2}, {2082,11,3}, {2082,11,4}, {2082,11,5}, {2082,11,6}, {2082,11,7}, {2082,11,8}, {2082,11,9}, {2082,11,10}, {2082,11,11}, {2082,11,12}, {2082,11,13}, {2082,11,14}, {2082,11,15}, {2082,11,16}, {2082,11,17}, {2082,11,18}, {2082,11,19}, {2082,11,20}, {2082,11,21}, {2082,11,22}, {2082,11,23}, {2082,11,24}, 
-{2082,11,25}, {2082,11,26}, {2082,11,27}, {2082,11,28}, {2082,11,29}, {2082,11,30}, {2082,12,1}, {2082,12,2}, {2082,12,3}, {2082,12,4}, {2082,12,5}, {2082,12,6}, {2082,12,7}, {2082,12,8}, {2082,12,9}, {2082,12,10}, {2082,12,11}, {2082,12,12}, {2082,12,13}, {2082,12,14}, {2082,12,15}, {2082,12,16}, {2082,12,17}, {2082,12,18}, {2082,12,19}, {2082,12,20}, {2082,12,21}, {2082,12,22}, {2082,12,23}, {2082,12,24}, {2082,12,25}, {2082,12,26}, 
-{2082,12,27}, {2082,12,28}, {2082,12,29}, {2082,12,30}, {2082,12,31}, {2083,1,1}, {2083,1,2}, {2083,1,3}, {2083,1,4}, {2083,1,5}, {2083,1,6}, {2083,1,7}, {2083,1,8}, {2083,1,9}, {2083,1,10}, {2083,1,11}, {2083,1,12}, {2083,1,13}, {2083,1,14}, {2083,1,15}, {2083,1,16}, {2083,1,17}, {2083,1,18}, {2083,1,19}, {2083,1,20}, {2083,1,21}, {2083,1,22}, {2083,1,23}, {2083,1,24}, {2083,1,25}, {2083,1,26}, {2083,1,27}, 
-{2083,1,28}, {2083,1,29}, {2083,1,30}, {2083,1,31}, {2083,2,1}, {2083,2,2}, {2083,2,3}, {2083,2,4}, {2083,2,5}, {2083,2,6}, {2083,2,7}, {2083,2,8}, {2083,2,9}, {2083,2,10}, {2083,2,11}, {2083,2,12}, {2083,2,13}, {2083,2,14}, {2083,2,15}, {2083,2,16}, {2083,2,17}, {2083,2,18}, {2083,2,19}, {2083,2,20}, {2083,2,21}, {2083,2,22}, {2083,2,23}, {2083,2,24}, {2083,2,25}, {2083,2,26}, {2083,2,27}, {2083,2,28}, 
-{2083,3,1}, {2083,3,2}, {2083,3,3}, {2083,3,4}, {2083,3,5}, {2083,3,6}, {2083,3,7}, {2083,3,8}, {2083,3,9}, {2083,3,10}, {2083,3,11}, {2083,3,12}, {2083,3,13}, {2083,3,14}, {2083,3,15}, {2083,3,16}, {2083,3,17}, {2083,3,18}, {2083,3,19}, {2083,3,20}, {2083,3,21}, {2083,3,22}, {2083,3,23}, {2083,3,24}, {2083,3,25}, {2083,3,26}, {2083,3,27}, {2083,3,28}, {2083,3,29}, {2083,3,30}, {2083,3,31}, {2083,4,1}, 
-{2083,4,2}, {2083,4,3}, {2083,4,4}, {2083,4,5}, {2083,4,6}, {2083,4,7}, {2083,4,8}, {2083,4,9}, {2083,4,10}, {2083,4,11}, {2083,4,12}, {2083,4,13}, {2083,4,14}, {2083,4,15}, {2083,4,16}, {2083,4,17}, {2083,4,18}, {2083,4,19}, {2083,4,20}, {2083,4,21}, {2083,4,22}, {2083,4,23}, {2083,4,24}, {2083,4,25}, {2083,4,26}, {2083,4,27}, {2083,4,28}, {2083,4,29}, {2083,4,30}, {2083,5,1}, {2083,5,2}, {2083,5,3}, 
-{2083,5,4}, {2083,5,5}, {2083,5,6}, {2083,5,7}, {2083,5,8}, {2083,5,9}, {2083,5,10}, {2083,5,11}, {2083,5,12}, {2083,5,13}, {2083,5,14}, {2083,5,15}, {2083,5,16}, {2083,5,17}, {2083,5,18}, {2083,5,19}, {2083,5,20}, {2083,5,21}, {2083,5,22}, {2083,5,23}, {2083,5,24}, {2083,5,25}, {2083,5,26}, {2083,5,27}, {2083,5,28}, {2083,5,29}, {2083,5,30}, {2083,5,31}, {2083,6,1}, {2083,6,2}, {2083,6,3}, {2083,6,4}, 
-{2083,6,5}, {2083,6,6}, {2083,6,7}, {2083,6,8}, {2083,6,9}, {2083,6,10}, {2083,6,11}, {2083,6,12}, {2083,6,13}, {2083,6,14}, {2083,6,15}, {2083,6,16}, {2083,6,17}, {2083,6,18}, {2083,6,19}, {2083,6,20}, {2083,6,21}, {2083,6,22}, {2083,6,23}, {2083,6,24}, {2083,6,25}, {2083,6,26}, {2083,6,27}, {2083,6,28}, {2083,6,29}, {2083,6,30}, {2083,7,1}, {2083,7,2}, {2083,7,3}, {2083,7,4}, {2083,7,5}, {2083,7,6}, 
-{2083,7,7}, {2083,7,8}, {2083,7,9}, {2083,7,10}, {2083,7,11}, {2083,7,12}, {2083,7,13}, {2083,7,14}, {2083,7,15}, {2083,7,16}, {2083,7,17}, {2083,7,18}, {2083,7,19}, {2083,7,20}, {2083,7,21}, {2083,7,22}, {2083,7,23}, {2083,7,24}, {2083,7,25}, {2083,7,26}, {2083,7,27}, {2083,7,28}, {2083,7,29}, {2083,7,30}, {2083,7,31}, {2083,8,1}, {2083,8,2}, {2083,8,3}, {2083,8,4}, {2083,8,5}, {2083,8,6}, {2083,8,7}, 
-{2083,8,8}, {2083,8,9}, {2083,8,10}, {2083,8,11}, {2083,8,12}, {2083,8,13}, {2083,8,14}, {2083,8,15}, {2083,8,16}, {2083,8,17}, {2083,8,18}, {2083,8,19}, {2083,8,20}, {2083,8,21}, {2083,8,22}, {2083,8,23}, {2083,8,24}, {2083,8,25}, {2083,8,26}, {2083,8,27}, {2083,8,28}, {2083,8,29}, {2083,8,30}, {2083,8,31}, {2083,9,1}, {2083,9,2}, {2083,9,3}, {2083,9,4}, {2083,9,5}, {2083,9,6}, {2083,9,7}, {2083,9,8}, 
-{2083,9,9}, {2083,9,10}, {2083,9,11}, {2083,9,12}, {2083,9,13}, {2083,9,14}, {2083,9,15}, {2083,9,16}, {2083,9,17}, {2083,9,18}, {2083,9,19}, {2083,9,20}, {2083,9,21}, {2083,9,22}, {2083,9,23}, {2083,9,24}, {2083,9,25}, {2083,9,26}, {2083,9,27}, {2083,9,28}, {2083,9,29}, {2083,9,30}, {2083,10,1}, {2083,10,2}, {2083,10,3}, {2083,10,4}, {2083,10,5}, {2083,10,6}, {2083,10,7}, {2083,10,8}, {2083,10,9}, {2083,10,10}, 
-{2083,10,11}, {2083,10,12}, {2083,10,13}, {2083,10,14}, {2083,10,15}, {2083,10,16}, {2083,10,17}, {2083,10,18}, {2083,10,19}, {2083,10,20}, {2083,10,21}, {2083,10,22}, {2083,10,23}, {2083,10,24}, {2083,10,25}, {2083,10,26}, {2083,10,27}, {2083,10,28}, {2083,10,29}, {2083,10,30}, {2083,10,31}, {2083,11,1}, {2083,11,2}, {2083,11,3}, {2083,11,4}, {2083,11,5}, {2083,11,6}, {2083,11,7}, {2083,11,8}, {2083,11,9}, {2083,11,10}, {2083,11,11}, 
-{2083,11,12}, {2083,11,13}, {2083,11,14}, {2083,11,15}, {2083,11,16}, {2083,11,17}, {2083,11,18}, {2083,11,19}, {2083,11,20}, {2083,11,21}, {2083,11,22}, {2083,11,23}, {2083,11,24}, {2083,11,25}, {2083,11,26}, {2083,11,27}, {2083,11,28}, {2083,11,29}, {2083,11,30}, {2083,12,1}, {2083,12,2}, {2083,12,3}, {2083,12,4}, {2083,12,5}, {2083,12,6}, {2083,12,7}, {2083,12,8}, {2083,12,9}, {2083,12,10}, {2083,12,11}, {2083,12,12}, {2083,12,13}, 
-{2083,12,14}, {2083,12,15}, {2083,12,16}, {2083,12,17}, {2083,12,18}, {2083,12,19}, {2083,12,20}, {2083,12,21}, {2083,12,22}, {2083,12,23}, {2083,12,24}, {2083,12,25}, {2083,12,26}, {2083,12,27}, {2083,12,28}, {2083,12,29}, {2083,12,30}, {2083,12,31}, {2084,1,1}, {2084,1,2}, {2084,1,3}, {2084,1,4}, {2084,1,5}, {2084,1,6}, {2084,1,7}, {2084,1,8}, {2084,1,9}, {2084,1,10}, {2084,1,11}, {2084,1,12}, {2084,1,13}, {2084,1,14}, 
-{2084,1,15}, {2084,1,16}, {2084,1,17}, {2084,1,18}, {2084,1,19}, {2084,1,20}, {2084,1,21}, {2084,1,22}, {2084,1,23}, {2084,1,24}, {2084,1,25}, {2084,1,26}, {2084,1,27}, {2084,1,28}, {2084,1,29}, {2084,1,30}, {2084,1,31}, {2084,2,1}, {2084,2,2}, {2084,2,3}, {2084,2,4}, {2084,2,5}, {2084,2,6}, {2084,2,7}, {2084,2,8}, {2084,2,9}, {2084,2,10}, {2084,2,11}, {2084,2,12}, {2084,2,13}, {2084,2,14}, {2084,2,15}, 
-{2084,2,16}, {2084,2,17}, {2084,2,18}, {2084,2,19}, {2084,2,20}, {2084,2,21}, {2084,2,22}, {2084,2,23}, {2084,2,24}, {2084,2,25}, {2084,2,26}, {2084,2,27}, {2084,2,28}, {2084,2,29}, {2084,3,1}, {2084,3,2}, {2084,3,3}, {2084,3,4}, {2084,3,5}, {2084,3,6}, {2084,3,7}, {2084,3,8}, {2084,3,9}, {2084,3,10}, {2084,3,11}, {2084,3,12}, {2084,3,13}, {2084,3,14}, {2084,3,15}, {2084,3,16}, {2084,3,17}, {2084,3,18}, 
-{2084,3,19}, {2084,3,20}, {2084,3,21}, {2084,3,22}, {2084,3,23}, {2084,3,24}, {2084,3,25}, {2084,3,26}, {2084,3,27}, {2084,3,28}, {2084,3,29}, {2084,3,30}, {2084,3,31}, {2084,4,1}, {2084,4,2}, {2084,4,3}, {2084,4,4}, {2084,4,5}, {2084,4,6}, {2084,4,7}, {2084,4,8}, {2084,4,9}, {2084,4,10}, {2084,4,11}, {2084,4,12}, {2084,4,13}, {2084,4,14}, {2084,4,15}, {2084,4,16}, {2084,4,17}, {2084,4,18}, {2084,4,19}, 
-{2084,4,20}, {2084,4,21}, {2084,4,22}, {2084,4,23}, {2084,4,24}, {2084,4,25}, {2084,4,26}, {2084,4,27}, {2084,4,28}, {2084,4,29}, {2084,4,30}, {2084,5,1}, {2084,5,2}, {2084,5,3}, {2084,5,4}, {2084,5,5}, {2084,5,6}, {2084,5,7}, {2084,5,8}, {2084,5,9}, {2084,5,10}, {2084,5,11}, {2084,5,12}, {2084,5,13}, {2084,5,14}, {2084,5,15}, {2084,5,16}, {2084,5,17}, {2084,5,18}, {2084,5,19}, {2084,5,20}, {2084,5,21}, 
-{2084,5,22}, {2084,5,23}, {2084,5,24}, {2084,5,25}, {2084,5,26}, {2084,5,27}, {2084,5,28}, {2084,5,29}, {2084,5,30}, {2084,5,31}, {2084,6,1}, {2084,6,2}, {2084,6,3}, {2084,6,4}, {2084,6,5}, {2084,6,6}, {2084,6,7}, {2084,6,8}, {2084,6,9}, {2084,6,10}, {2084,6,11}, {2084,6,12}, {2084,6,13}, {2084,6,14}, {2084,6,15}, {2084,6,16}, {2084,6,17}, {2084,6,18}, {2084,6,19}, {2084,6,20}, {2084,6,21}, {2084,6,22}, 
-{2084,6,23}, {2084,6,24}, {2084,6,25}, {2084,6,26}, {2084,6,27}, {2084,6,28}, {2084,6,29}, {2084,6,30}, {2084,7,1}, {2084,7,2}, {2084,7,3}, {2084,7,4}, {2084,7,5}, {2084,7,6}, {2084,7,7}, {2084,7,8}, {2084,7,9}, {2084,7,10}, {2084,7,11}, {2084,7,12}, {2084,7,13}, {2084,7,14}, {2084,7,15}, {2084,7,16}, {2084,7,17}, {2084,7,18}, {2084,7,19}, {2084,7,20}, {2084,7,21}, {2084,7,22}, {2084,7,23}, {2084,7,24}, 
-{2084,7,25}, {2084,7,26}, {2084,7,27}, {2084,7,28}, {2084,7,29}, {2084,7,30}, {2084,7,31}, {2084,8,1}, {2084,8,2}, {2084,8,3}, {2084,8,4}, {2084,8,5}, {2084,8,6}, {2084,8,7}, {2084,8,8}, {2084,8,9}, {2084,8,10}, {2084,8,11}, {2084,8,12}, {2084,8,13}, {2084,8,14}, {2084,8,15}, {2084,8,16}, {2084,8,17}, {2084,8,18}, {2084,8,19}, {2084,8,20}, {2084,8,21}, {2084,8,22}, {2084,8,23}, {2084,8,24}, {2084,8,25}, 
-{2084,8,26}, {2084,8,27}, {2084,8,28}, {2084,8,29}, {2084,8,30}, {2084,8,31}, {2084,9,1}, {2084,9,2}, {2084,9,3}, {2084,9,4}, {2084,9,5}, {2084,9,6}, {2084,9,7}, {2084,9,8}, {2084,9,9}, {2084,9,10}, {2084,9,11}, {2084,9,12}, {2084,9,13}, {2084,9,14}, {2084,9,15}, {2084,9,16}, {2084,9,17}, {2084,9,18}, {2084,9,19}, {2084,9,20}, {2084,9,21}, {2084,9,22}, {2084,9,23}, {2084,9,24}, {2084,9,25}, {2084,9,26}, 
-{2084,9,27}, {2084,9,28}, {2084,9,29}, {2084,9,30}, {2084,10,1}, {2084,10,2}, {2084,10,3}, {2084,10,4}, {2084,10,5}, {2084,10,6}, {2084,10,7}, {2084,10,8}, {2084,10,9}, {2084,10,10}, {2084,10,11}, {2084,10,12}, {2084,10,13}, {2084,10,14}, {2084,10,15}, {2084,10,16}, {2084,10,17}, {2084,10,18}, {2084,10,19}, {2084,10,20}, {2084,10,21}, {2084,10,22}, {2084,10,23}, {2084,10,24}, {2084,10,25}, {2084,10,26}, {2084,10,27}, {2084,10,28}, 
-{2084,10,29}, {2084,10,30}, {2084,10,31}, {2084,11,1}, {2084,11,2}, {2084,11,3}, {2084,11,4}, {2084,11,5}, {2084,11,6}, {2084,11,7}, {2084,11,8}, {2084,11,9}, {2084,11,10}, {2084,11,11}, {2084,11,12}, {2084,11,13}, {2084,11,14}, {2084,11,15}, {2084,11,16}, {2084,11,17}, {2084,11,18}, {2084,11,19}, {2084,11,20}, {2084,11,21}, {2084,11,22}, {2084,11,23}, {2084,11,24}, {2084,11,25}, {2084,11,26}, {2084,11,27}, {2084,11,28}, {2084,11,29}, 
-{2084,11,30}, {2084,12,1}, {2084,12,2}, {2084,12,3}, {2084,12,4}, {2084,12,5}, {2084,12,6}, {2084,12,7}, {2084,12,8}, {2084,12,9}, {2084,12,10}, {2084,12,11}, {2084,12,12}, {2084,12,13}, {2084,12,14}, {2084,12,15}, {2084,12,16}, {2084,12,17}, {2084,12,18}, {2084,12,19}, {2084,12,20}, {2084,12,21}, {2084,12,22}, {2084,12,23}, {2084,12,24}, {2084,12,25}, {2084,12,26}, {2084,12,27}, {2084,12,28}, {2084,12,29}, {2084,12,30}, {2084,12,31}, 
-{2085,1,1}, {2085,1,2}, {2085,1,3}, {2085,1,4}, {2085,1,5}, {2085,1,6}, {2085,1,7}, {2085,1,8}, {2085,1,9}, {2085,1,10}, {2085,1,11}, {2085,1,12}, {2085,1,13}, {2085,1,14}, {2085,1,15}, {2085,1,16}, {2085,1,17}, {2085,1,18}, {2085,1,19}, {2085,1,20}, {2085,1,21}, {2085,1,22}, {2085,1,23}, {2085,1,24}, {2085,1,25}, {2085,1,26}, {2085,1,27}, {2085,1,28}, {2085,1,29}, {2085,1,30}, {2085,1,31}, {2085,2,1}, 
-{2085,2,2}, {2085,2,3}, {2085,2,4}, {2085,2,5}, {2085,2,6}, {2085,2,7}, {2085,2,8}, {2085,2,9}, {2085,2,10}, {2085,2,11}, {2085,2,12}, {2085,2,13}, {2085,2,14}, {2085,2,15}, {2085,2,16}, {2085,2,17}, {2085,2,18}, {2085,2,19}, {2085,2,20}, {2085,2,21}, {2085,2,22}, {2085,2,23}, {2085,2,24}, {2085,2,25}, {2085,2,26}, {2085,2,27}, {2085,2,28}, {2085,3,1}, {2085,3,2}, {2085,3,3}, {2085,3,4}, {2085,3,5}, 
-{2085,3,6}, {2085,3,7}, {2085,3,8}, {2085,3,9}, {2085,3,10}, {2085,3,11}, {2085,3,12}, {2085,3,13}, {2085,3,14}, {2085,3,15}, {2085,3,16}, {2085,3,17}, {2085,3,18}, {2085,3,19}, {2085,3,20}, {2085,3,21}, {2085,3,22}, {2085,3,23}, {2085,3,24}, {2085,3,25}, {2085,3,26}, {2085,3,27}, {2085,3,28}, {2085,3,29}, {2085,3,30}, {2085,3,31}, {2085,4,1}, {2085,4,2}, {2085,4,3}, {2085,4,4}, {2085,4,5}, {2085,4,6}, 
-{2085,4,7}, {2085,4,8}, {2085,4,9}, {2085,4,10}, {2085,4,11}, {2085,4,12}, {2085,4,13}, {2085,4,14}, {2085,4,15}, {2085,4,16}, {2085,4,17}, {2085,4,18}, {2085,4,19}, {2085,4,20}, {2085,4,21}, {2085,4,22}, {2085,4,23}, {2085,4,24}, {2085,4,25}, {2085,4,26}, {2085,4,27}, {2085,4,28}, {2085,4,29}, {2085,4,30}, {2085,5,1}, {2085,5,2}, {2085,5,3}, {2085,5,4}, {2085,5,5}, {2085,5,6}, {2085,5,7}, {2085,5,8}, 
-{2085,5,9}, {2085,5,10}, {2085,5,11}, {2085,5,12}, {2085,5,13}, {2085,5,14}, {2085,5,15}, {2085,5,16}, {2085,5,17}, {2085,5,18}, {2085,5,19}, {2085,5,20}, {2085,5,21}, {2085,5,22}, {2085,5,23}, {2085,5,24}, {2085,5,25}, {2085,5,26}, {2085,5,27}, {2085,5,28}, {2085,5,29}, {2085,5,30}, {2085,5,31}, {2085,6,1}, {2085,6,2}, {2085,6,3}, {2085,6,4}, {2085,6,5}, {2085,6,6}, {2085,6,7}, {2085,6,8}, {2085,6,9}, 
-{2085,6,10}, {2085,6,11}, {2085,6,12}, {2085,6,13}, {2085,6,14}, {2085,6,15}, {2085,6,16}, {2085,6,17}, {2085,6,18}, {2085,6,19}, {2085,6,20}, {2085,6,21}, {2085,6,22}, {2085,6,23}, {2085,6,24}, {2085,6,25}, {2085,6,26}, {2085,6,27}, {2085,6,28}, {2085,6,29}, {2085,6,30}, {2085,7,1}, {2085,7,2}, {2085,7,3}, {2085,7,4}, {2085,7,5}, {2085,7,6}, {2085,7,7}, {2085,7,8}, {2085,7,9}, {2085,7,10}, {2085,7,11}, 
-{2085,7,12}, {2085,7,13}, {2085,7,14}, {2085,7,15}, {2085,7,16}, {2085,7,17}, {2085,7,18}, {2085,7,19}, {2085,7,20}, {2085,7,21}, {2085,7,22}, {2085,7,23}, {2085,7,24}, {2085,7,25}, {2085,7,26}, {2085,7,27}, {2085,7,28}, {2085,7,29}, {2085,7,30}, {2085,7,31}, {2085,8,1}, {2085,8,2}, {2085,8,3}, {2085,8,4}, {2085,8,5}, {2085,8,6}, {2085,8,7}, {2085,8,8}, {2085,8,9}, {2085,8,10}, {2085,8,11}, {2085,8,12}, 
-{2085,8,13}, {2085,8,14}, {2085,8,15}, {2085,8,16}, {2085,8,17}, {2085,8,18}, {2085,8,19}, {2085,8,20}, {2085,8,21}, {2085,8,22}, {2085,8,23}, {2085,8,24}, {2085,8,25}, {2085,8,26}, {2085,8,27}, {2085,8,28}, {2085,8,29}, {2085,8,30}, {2085,8,31}, {2085,9,1}, {2085,9,2}, {2085,9,3}, {2085,9,4}, {2085,9,5}, {2085,9,6}, {2085,9,7}, {2085,9,8}, {2085,9,9}, {2085,9,10}, {2085,9,11}, {2085,9,12}, {2085,9,13}, 
-{2085,9,14}, {2085,9,15}, {2085,9,16}, {2085,9,17}, {2085,9,18}, {2085,9,19}, {2085,9,20}, {2085,9,21}, {2085,9,22}, {2085,9,23}, {2085,9,24}, {2085,9,25}, {2085,9,26}, {2085,9,27}, {2085,9,28}, {2085,9,29}, {2085,9,30}, {2085,10,1}, {2085,10,2}, {2085,10,3}, {2085,10,4}, {2085,10,5}, {2085,10,6}, {2085,10,7}, {2085,10,8}, {2085,10,9}, {2085,10,10}, {2085,10,11}, {2085,10,12}, {2085,10,13}, {2085,10,14}, {2085,10,15}, 
-{2085,10,16}, {2085,10,17}, {2085,10,18}, {2085,10,19}, {2085,10,20}, {2085,10,21}, {2085,10,22}, {2085,10,23}, {2085,10,24}, {2085,10,25}, {2085,10,26}, {2085,10,27}, {2085,10,28}, {2085,10,29}, {2085,10,30}, {2085,10,31}, {2085,11,1}, {2085,11,2}, {2085,11,3}, {2085,11,4}, {2085,11,5}, {2085,11,6}, {2085,11,7}, {2085,11,8}, {2085,11,9}, {2085,11,10}, {2085,11,11}, {2085,11,12}, {2085,11,13}, {2085,11,14}, {2085,11,15}, {2085,11,16}, 
-{2085,11,17}, {2085,11,18}, {2085,11,19}, {2085,11,20}, {2085,11,21}, {2085,11,22}, {2085,11,23}, {2085,11,24}, {2085,11,25}, {2085,11,26}, {2085,11,27}, {2085,11,28}, {2085,11,29}, {2085,11,30}, {2085,12,1}, {2085,12,2}, {2085,12,3}, {2085,12,4}, {2085,12,5}, {2085,12,6}, {2085,12,7}, {2085,12,8}, {2085,12,9}, {2085,12,10}, {2085,12,11}, {2085,12,12}, {2085,12,13}, {2085,12,14}, {2085,12,15}, {2085,12,16}, {2085,12,17}, {2085,12,18}, 
-{2085,12,19}, {2085,12,20}, {2085,12,21}, {2085,12,22}, {2085,12,23}, {2085,12,24}, {2085,12,25}, {2085,12,26}, {2085,12,27}, {2085,12,28}, {2085,12,29}, {2085,12,30}, {2085,12,31}, {2086,1,1}, {2086,1,2}, {2086,1,3}, {2086,1,4}, {2086,1,5}, {2086,1,6}, {2086,1,7}, {2086,1,8}, {2086,1,9}, {2086,1,10}, {2086,1,11}, {2086,1,12}, {2086,1,13}, {2086,1,14}, {2086,1,15}, {2086,1,16}, {2086,1,17}, {2086,1,18}, {2086,1,19}, 
-{2086,1,20}, {2086,1,21}, {2086,1,22}, {2086,1,23}, {2086,1,24}, {2086,1,25}, {2086,1,26}, {2086,1,27}, {2086,1,28}, {2086,1,29}, {2086,1,30}, {2086,1,31}, {2086,2,1}, {2086,2,2}, {2086,2,3}, {2086,2,4}, {2086,2,5}, {2086,2,6}, {2086,2,7}, {2086,2,8}, {2086,2,9}, {2086,2,10}, {2086,2,11}, {2086,2,12}, {2086,2,13}, {2086,2,14}, {2086,2,15}, {2086,2,16}, {2086,2,17}, {2086,2,18}, {2086,2,19}, {2086,2,20}, 
-{2086,2,21}, {2086,2,22}, {2086,2,23}, {2086,2,24}, {2086,2,25}, {2086,2,26}, {2086,2,27}, {2086,2,28}, {2086,3,1}, {2086,3,2}, {2086,3,3}, {2086,3,4}, {2086,3,5}, {2086,3,6}, {2086,3,7}, {2086,3,8}, {2086,3,9}, {2086,3,10}, {2086,3,11}, {2086,3,12}, {2086,3,13}, {2086,3,14}, {2086,3,15}, {2086,3,16}, {2086,3,17}, {2086,3,18}, {2086,3,19}, {2086,3,20}, {2086,3,21}, {2086,3,22}, {2086,3,23}, {2086,3,24}, 
-{2086,3,25}, {2086,3,26}, {2086,3,27}, {2086,3,28}, {2086,3,29}, {2086,3,30}, {2086,3,31}, {2086,4,1}, {2086,4,2}, {2086,4,3}, {2086,4,4}, {2086,4,5}, {2086,4,6}, {2086,4,7}, {2086,4,8}, {2086,4,9}, {2086,4,10}, {2086,4,11}, {2086,4,12}, {2086,4,13}, {2086,4,14}, {2086,4,15}, {2086,4,16}, {2086,4,17}, {2086,4,18}, {2086,4,19}, {2086,4,20}, {2086,4,21}, {2086,4,22}, {2086,4,23}, {2086,4,24}, {2086,4,25}, 
-{2086,4,26}, {2086,4,27}, {2086,4,28}, {2086,4,29}, {2086,4,30}, {2086,5,1}, {2086,5,2}, {2086,5,3}, {2086,5,4}, {2086,5,5}, {2086,5,6}, {2086,5,7}, {2086,5,8}, {2086,5,9}, {2086,5,10}, {2086,5,11}, {2086,5,12}, {2086,5,13}, {2086,5,14}, {2086,5,15}, {2086,5,16}, {2086,5,17}, {2086,5,18}, {2086,5,19}, {2086,5,20}, {2086,5,21}, {2086,5,22}, {2086,5,23}, {2086,5,24}, {2086,5,25}, {2086,5,26}, {2086,5,27}, 
-{2086,5,28}, {2086,5,29}, {2086,5,30}, {2086,5,31}, {2086,6,1}, {2086,6,2}, {2086,6,3}, {2086,6,4}, {2086,6,5}, {2086,6,6}, {2086,6,7}, {2086,6,8}, {2086,6,9}, {2086,6,10}, {2086,6,11}, {2086,6,12}, {2086,6,13}, {2086,6,14}, {2086,6,15}, {2086,6,16}, {2086,6,17}, {2086,6,18}, {2086,6,19}, {2086,6,20}, {2086,6,21}, {2086,6,22}, {2086,6,23}, {2086,6,24}, {2086,6,25}, {2086,6,26}, {2086,6,27}, {2086,6,28}, 
-{2086,6,29}, {2086,6,30}, {2086,7,1}, {2086,7,2}, {2086,7,3}, {2086,7,4}, {2086,7,5}, {2086,7,6}, {2086,7,7}, {2086,7,8}, {2086,7,9}, {2086,7,10}, {2086,7,11}, {2086,7,12}, {2086,7,13}, {2086,7,14}, {2086,7,15}, {2086,7,16}, {2086,7,17}, {2086,7,18}, {2086,7,19}, {2086,7,20}, {2086,7,21}, {2086,7,22}, {2086,7,23}, {2086,7,24}, {2086,7,25}, {2086,7,26}, {2086,7,27}, {2086,7,28}, {2086,7,29}, {2086,7,30}, 
-{2086,7,31}, {2086,8,1}, {2086,8,2}, {2086,8,3}, {2086,8,4}, {2086,8,5}, {2086,8,6}, {2086,8,7}, {2086,8,8}, {2086,8,9}, {2086,8,10}, {2086,8,11}, {2086,8,12}, {2086,8,13}, {2086,8,14}, {2086,8,15}, {2086,8,16}, {2086,8,17}, {2086,8,18}, {2086,8,19}, {2086,8,20}, {2086,8,21}, {2086,8,22}, {2086,8,23}, {2086,8,24}, {2086,8,25}, {2086,8,26}, {2086,8,27}, {2086,8,28}, {2086,8,29}, {2086,8,30}, {2086,8,31}, 
-{2086,9,1}, {2086,9,2}, {2086,9,3}, {2086,9,4}, {2086,9,5}, {2086,9,6}, {2086,9,7}, {2086,9,8}, {2086,9,9}, {2086,9,10}, {2086,9,11}, {2086,9,12}, {2086,9,13}, {2086,9,14}, {2086,9,15}, {2086,9,16}, {2086,9,17}, {2086,9,18}, {2086,9,19}, {2086,9,20}, {2086,9,21}, {2086,9,22}, {2086,9,23}, {2086,9,24}, {2086,9,25}, {2086,9,26}, {2086,9,27}, {2086,9,28}, {2086,9,29}, {2086,9,30}, {2086,10,1}, {2086,10,2}, 
-{2086,10,3}, {2086,10,4}, {2086,10,5}, {2086,10,6}, {2086,10,7}, {2086,10,8}, {2086,10,9}, {2086,10,10}, {2086,10,11}, {2086,10,12}, {2086,10,13}, {2086,10,14}, {2086,10,15}, {2086,10,16}, {2086,10,17}, {2086,10,18}, {2086,10,19}, {2086,10,20}, {2086,10,21}, {2086,10,22}, {2086,10,23}, {2086,10,24}, {2086,10,25}, {2086,10,26}, {2086,10,27}, {2086,10,28}, {2086,10,29}, {2086,10,30}, {2086,10,31}, {2086,11,1}, {2086,11,2}, {2086,11,3}, 
-{2086,11,4}, {2086,11,5}, {2086,11,6}, {2086,11,7}, {2086,11,8}, {2086,11,9}, {2086,11,10}, {2086,11,11}, {2086,11,12}, {2086,11,13}, {2086,11,14}, {2086,11,15}, {2086,11,16}, {2086,11,17}, {2086,11,18}, {2086,11,19}, {2086,11,20}, {2086,11,21}, {2086,11,22}, {2086,11,23}, {2086,11,24}, {2086,11,25}, {2086,11,26}, {2086,11,27}, {2086,11,28}, {2086,11,29}, {2086,11,30}, {2086,12,1}, {2086,12,2}, {2086,12,3}, {2086,12,4}, {2086,12,5}, 
-{2086,12,6}, {2086,12,7}, {2086,12,8}, {2086,12,9}, {2086,12,10}, {2086,12,11}, {2086,12,12}, {2086,12,13}, {2086,12,14}, {2086,12,15}, {2086,12,16}, {2086,12,17}, {2086,12,18}, {2086,12,19}, {2086,12,20}, {2086,12,21}, {2086,12,22}, {2086,12,23}, {2086,12,24}, {2086,12,25}, {2086,12,26}, {2086,12,27}, {2086,12,28}, {2086,12,29}, {2086,12,30}, {2086,12,31}, {2087,1,1}, {2087,1,2}, {2087,1,3}, {2087,1,4}, {2087,1,5}, {2087,1,6}, 
-{2087,1,7}, {2087,1,8}, {2087,1,9}, {2087,1,10}, {2087,1,11}, {2087,1,12}, {2087,1,13}, {2087,1,14}, {2087,1,15}, {2087,1,16}, {2087,1,17}, {2087,1,18}, {2087,1,19}, {2087,1,20}, {2087,1,21}, {2087,1,22}, {2087,1,23}, {2087,1,24}, {2087,1,25}, {2087,1,26}, {2087,1,27}, {2087,1,28}, {2087,1,29}, {2087,1,30}, {2087,1,31}, {2087,2,1}, {2087,2,2}, {2087,2,3}, {2087,2,4}, {2087,2,5}, {2087,2,6}, {2087,2,7}, 
-{2087,2,8}, {2087,2,9}, {2087,2,10}, {2087,2,11}, {2087,2,12}, {2087,2,13}, {2087,2,14}, {2087,2,15}, {2087,2,16}, {2087,2,17}, {2087,2,18}, {2087,2,19}, {2087,2,20}, {2087,2,21}, {2087,2,22}, {2087,2,23}, {2087,2,24}, {2087,2,25}, {2087,2,26}, {2087,2,27}, {2087,2,28}, {2087,3,1}, {2087,3,2}, {2087,3,3}, {2087,3,4}, {2087,3,5}, {2087,3,6}, {2087,3,7}, {2087,3,8}, {2087,3,9}, {2087,3,10}, {2087,3,11}, 
-{2087,3,12}, {2087,3,13}, {2087,3,14}, {2087,3,15}, {2087,3,16}, {2087,3,17}, {2087,3,18}, {2087,3,19}, {2087,3,20}, {2087,3,21}, {2087,3,22}, {2087,3,23}, {2087,3,24}, {2087,3,25}, {2087,3,26}, {2087,3,27}, {2087,3,28}, {2087,3,29}, {2087,3,30}, {2087,3,31}, {2087,4,1}, {2087,4,2}, {2087,4,3}, {2087,4,4}, {2087,4,5}, {2087,4,6}, {2087,4,7}, {2087,4,8}, {2087,4,9}, {2087,4,10}, {2087,4,11}, {2087,4,12}, 
-{2087,4,13}, {2087,4,14}, {2087,4,15}, {2087,4,16}, {2087,4,17}, {2087,4,18}, {2087,4,19}, {2087,4,20}, {2087,4,21}, {2087,4,22}, {2087,4,23}, {2087,4,24}, {2087,4,25}, {2087,4,26}, {2087,4,27}, {2087,4,28}, {2087,4,29}, {2087,4,30}, {2087,5,1}, {2087,5,2}, {2087,5,3}, {2087,5,4}, {2087,5,5}, {2087,5,6}, {2087,5,7}, {2087,5,8}, {2087,5,9}, {2087,5,10}, {2087,5,11}, {2087,5,12}, {2087,5,13}, {2087,5,14}, 
-{2087,5,15}, {2087,5,16}, {2087,5,17}, {2087,5,18}, {2087,5,19}, {2087,5,20}, {2087,5,21}, {2087,5,22}, {2087,5,23}, {2087,5,24}, {2087,5,25}, {2087,5,26}, {2087,5,27}, {2087,5,28}, {2087,5,29}, {2087,5,30}, {2087,5,31}, {2087,6,1}, {2087,6,2}, {2087,6,3}, {2087,6,4}, {2087,6,5}, {2087,6,6}, {2087,6,7}, {2087,6,8}, {2087,6,9}, {2087,6,10}, {2087,6,11}, {2087,6,12}, {2087,6,13}, {2087,6,14}, {2087,6,15}, 
-{2087,6,16}, {2087,6,17}, {2087,6,18}, {2087,6,19}, {2087,6,20}, {2087,6,21}, {2087,6,22}, {2087,6,23}, {2087,6,24}, {2087,6,25}, {2087,6,26}, {2087,6,27}, {2087,6,28}, {2087,6,29}, {2087,6,30}, {2087,7,1}, {2087,7,2}, {2087,7,3}, {2087,7,4}, {2087,7,5}, {2087,7,6}, {2087,7,7}, {2087,7,8}, {2087,7,9}, {2087,7,10}, {2087,7,11}, {2087,7,12}, {2087,7,13}, {2087,7,14}, {2087,7,15}, {2087,7,16}, {2087,7,17}, 
-{2087,7,18}, {2087,7,19}, {2087,7,20}, {2087,7,21}, {2087,7,22}, {2087,7,23}, {2087,7,24}, {2087,7,25}, {2087,7,26}, {2087,7,27}, {2087,7,28}, {2087,7,29}, {2087,7,30}, {2087,7,31}, {2087,8,1}, {2087,8,2}, {2087,8,3}, {2087,8,4}, {2087,8,5}, {2087,8,6}, {2087,8,7}, {2087,8,8}, {2087,8,9}, {2087,8,10}, {2087,8,11}, {2087,8,12}, {2087,8,13}, {2087,8,14}, {2087,8,15}, {2087,8,16}, {2087,8,17}, {2087,8,18}, 
-{2087,8,19}, {2087,8,20}, {2087,8,21}, {2087,8,22}, {2087,8,23}, {2087,8,24}, {2087,8,25}, {2087,8,26}, {2087,8,27}, {2087,8,28}, {2087,8,29}, {2087,8,30}, {2087,8,31}, {2087,9,1}, {2087,9,2}, {2087,9,3}, {2087,9,4}, {2087,9,5}, {2087,9,6}, {2087,9,7}, {2087,9,8}, {2087,9,9}, {2087,9,10}, {2087,9,11}, {2087,9,12}, {2087,9,13}, {2087,9,14}, {2087,9,15}, {2087,9,16}, {2087,9,17}, {2087,9,18}, {2087,9,19}, 
-{2087,9,20}, {2087,9,21}, {2087,9,22}, {2087,9,23}, {2087,9,24}, {2087,9,25}, {2087,9,26}, {2087,9,27}, {2087,9,28}, {2087,9,29}, {2087,9,30}, {2087,10,1}, {2087,10,2}, {2087,10,3}, {2087,10,4}, {2087,10,5}, {2087,10,6}, {2087,10,7}, {2087,10,8}, {2087,10,9}, {2087,10,10}, {2087,10,11}, {2087,10,12}, {2087,10,13}, {2087,10,14}, {2087,10,15}, {2087,10,16}, {2087,10,17}, {2087,10,18}, {2087,10,19}, {2087,10,20}, {2087,10,21}, 
-{2087,10,22}, {2087,10,23}, {2087,10,24}, {2087,10,25}, {2087,10,26}, {2087,10,27}, {2087,10,28}, {2087,10,29}, {2087,10,30}, {2087,10,31}, {2087,11,1}, {2087,11,2}, {2087,11,3}, {2087,11,4}, {2087,11,5}, {2087,11,6}, {2087,11,7}, {2087,11,8}, {2087,11,9}, {2087,11,10}, {2087,11,11}, {2087,11,12}, {2087,11,13}, {2087,11,14}, {2087,11,15}, {2087,11,16}, {2087,11,17}, {2087,11,18}, {2087,11,19}, {2087,11,20}, {2087,11,21}, {2087,11,22}, 
-{2087,11,23}, {2087,11,24}, {2087,11,25}, {2087,11,26}, {2087,11,27}, {2087,11,28}, {2087,11,29}, {2087,11,30}, {2087,12,1}, {2087,12,2}, {2087,12,3}, {2087,12,4}, {2087,12,5}, {2087,12,6}, {2087,12,7}, {2087,12,8}, {2087,12,9}, {2087,12,10}, {2087,12,11}, {2087,12,12}, {2087,12,13}, {2087,12,14}, {2087,12,15}, {2087,12,16}, {2087,12,17}, {2087,12,18}, {2087,12,19}, {2087,12,20}, {2087,12,21}, {2087,12,22}, {2087,12,23}, {2087,12,24}, 
-{2087,12,25}, {2087,12,26}, {2087,12,27}, {2087,12,28}, {2087,12,29}, {2087,12,30}, {2087,12,31}, {2088,1,1}, {2088,1,2}, {2088,1,3}, {2088,1,4}, {2088,1,5}, {2088,1,6}, {2088,1,7}, {2088,1,8}, {2088,1,9}, {2088,1,10}, {2088,1,11}, {2088,1,12}, {2088,1,13}, {2088,1,14}, {2088,1,15}, {2088,1,16}, {2088,1,17}, {2088,1,18}, {2088,1,19}, {2088,1,20}, {2088,1,21}, {2088,1,22}, {2088,1,23}, {2088,1,24}, {2088,1,25}, 
-{2088,1,26}, {2088,1,27}, {2088,1,28}, {2088,1,29}, {2088,1,30}, {2088,1,31}, {2088,2,1}, {2088,2,2}, {2088,2,3}, {2088,2,4}, {2088,2,5}, {2088,2,6}, {2088,2,7}, {2088,2,8}, {2088,2,9}, {2088,2,10}, {2088,2,11}, {2088,2,12}, {2088,2,13}, {2088,2,14}, {2088,2,15}, {2088,2,16}, {2088,2,17}, {2088,2,18}, {2088,2,19}, {2088,2,20}, {2088,2,21}, {2088,2,22}, {2088,2,23}, {2088,2,24}, {2088,2,25}, {2088,2,26}, 
-{2088,2,27}, {2088,2,28}, {2088,2,29}, {2088,3,1}, {2088,3,2}, {2088,3,3}, {2088,3,4}, {2088,3,5}, {2088,3,6}, {2088,3,7}, {2088,3,8}, {2088,3,9}, {2088,3,10}, {2088,3,11}, {2088,3,12}, {2088,3,13}, {2088,3,14}, {2088,3,15}, {2088,3,16}, {2088,3,17}, {2088,3,18}, {2088,3,19}, {2088,3,20}, {2088,3,21}, {2088,3,22}, {2088,3,23}, {2088,3,24}, {2088,3,25}, {2088,3,26}, {2088,3,27}, {2088,3,28}, {2088,3,29}, 
-{2088,3,30}, {2088,3,31}, {2088,4,1}, {2088,4,2}, {2088,4,3}, {2088,4,4}, {2088,4,5}, {2088,4,6}, {2088,4,7}, {2088,4,8}, {2088,4,9}, {2088,4,10}, {2088,4,11}, {2088,4,12}, {2088,4,13}, {2088,4,14}, {2088,4,15}, {2088,4,16}, {2088,4,17}, {2088,4,18}, {2088,4,19}, {2088,4,20}, {2088,4,21}, {2088,4,22}, {2088,4,23}, {2088,4,24}, {2088,4,25}, {2088,4,26}, {2088,4,27}, {2088,4,28}, {2088,4,29}, {2088,4,30}, 
-{2088,5,1}, {2088,5,2}, {2088,5,3}, {2088,5,4}, {2088,5,5}, {2088,5,6}, {2088,5,7}, {2088,5,8}, {2088,5,9}, {2088,5,10}, {2088,5,11}, {2088,5,12}, {2088,5,13}, {2088,5,14}, {2088,5,15}, {2088,5,16}, {2088,5,17}, {2088,5,18}, {2088,5,19}, {2088,5,20}, {2088,5,21}, {2088,5,22}, {2088,5,23}, {2088,5,24}, {2088,5,25}, {2088,5,26}, {2088,5,27}, {2088,5,28}, {2088,5,29}, {2088,5,30}, {2088,5,31}, {2088,6,1}, 
-{2088,6,2}, {2088,6,3}, {2088,6,4}, {2088,6,5}, {2088,6,6}, {2088,6,7}, {2088,6,8}, {2088,6,9}, {2088,6,10}, {2088,6,11}, {2088,6,12}, {2088,6,13}, {2088,6,14}, {2088,6,15}, {2088,6,16}, {2088,6,17}, {2088,6,18}, {2088,6,19}, {2088,6,20}, {2088,6,21}, {2088,6,22}, {2088,6,23}, {2088,6,24}, {2088,6,25}, {2088,6,26}, {2088,6,27}, {2088,6,28}, {2088,6,29}, {2088,6,30}, {2088,7,1}, {2088,7,2}, {2088,7,3}, 
-{2088,7,4}, {2088,7,5}, {2088,7,6}, {2088,7,7}, {2088,7,8}, {2088,7,9}, {2088,7,10}, {2088,7,11}, {2088,7,12}, {2088,7,13}, {2088,7,14}, {2088,7,15}, {2088,7,16}, {2088,7,17}, {2088,7,18}, {2088,7,19}, {2088,7,20}, {2088,7,21}, {2088,7,22}, {2088,7,23}, {2088,7,24}, {2088,7,25}, {2088,7,26}, {2088,7,27}, {2088,7,28}, {2088,7,29}, {2088,7,30}, {2088,7,31}, {2088,8,1}, {2088,8,2}, {2088,8,3}, {2088,8,4}, 
-{2088,8,5}, {2088,8,6}, {2088,8,7}, {2088,8,8}, {2088,8,9}, {2088,8,10}, {2088,8,11}, {2088,8,12}, {2088,8,13}, {2088,8,14}, {2088,8,15}, {2088,8,16}, {2088,8,17}, {2088,8,18}, {2088,8,19}, {2088,8,20}, {2088,8,21}, {2088,8,22}, {2088,8,23}, {2088,8,24}, {2088,8,25}, {2088,8,26}, {2088,8,27}, {2088,8,28}, {2088,8,29}, {2088,8,30}, {2088,8,31}, {2088,9,1}, {2088,9,2}, {2088,9,3}, {2088,9,4}, {2088,9,5}, 
-{2088,9,6}, {2088,9,7}, {2088,9,8}, {2088,9,9}, {2088,9,10}, {2088,9,11}, {2088,9,12}, {2088,9,13}, {2088,9,14}, {2088,9,15}, {2088,9,16}, {2088,9,17}, {2088,9,18}, {2088,9,19}, {2088,9,20}, {2088,9,21}, {2088,9,22}, {2088,9,23}, {2088,9,24}, {2088,9,25}, {2088,9,26}, {2088,9,27}, {2088,9,28}, {2088,9,29}, {2088,9,30}, {2088,10,1}, {2088,10,2}, {2088,10,3}, {2088,10,4}, {2088,10,5}, {2088,10,6}, {2088,10,7}, 
-{2088,10,8}, {2088,10,9}, {2088,10,10}, {2088,10,11}, {2088,10,12}, {2088,10,13}, {2088,10,14}, {2088,10,15}, {2088,10,16}, {2088,10,17}, {2088,10,18}, {2088,10,19}, {2088,10,20}, {2088,10,21}, {2088,10,22}, {2088,10,23}, {2088,10,24}, {2088,10,25}, {2088,10,26}, {2088,10,27}, {2088,10,28}, {2088,10,29}, {2088,10,30}, {2088,10,31}, {2088,11,1}, {2088,11,2}, {2088,11,3}, {2088,11,4}, {2088,11,5}, {2088,11,6}, {2088,11,7}, {2088,11,8}, 
-{2088,11,9}, {2088,11,10}, {2088,11,11}, {2088,11,12}, {2088,11,13}, {2088,11,14}, {2088,11,15}, {2088,11,16}, {2088,11,17}, {2088,11,18}, {2088,11,19}, {2088,11,20}, {2088,11,21}, {2088,11,22}, {2088,11,23}, {2088,11,24}, {2088,11,25}, {2088,11,26}, {2088,11,27}, {2088,11,28}, {2088,11,29}, {2088,11,30}, {2088,12,1}, {2088,12,2}, {2088,12,3}, {2088,12,4}, {2088,12,5}, {2088,12,6}, {2088,12,7}, {2088,12,8}, {2088,12,9}, {2088,12,10}, 
-{2088,12,11}, {2088,12,12}, {2088,12,13}, {2088,12,14}, {2088,12,15}, {2088,12,16}, {2088,12,17}, {2088,12,18}, {2088,12,19}, {2088,12,20}, {2088,12,21}, {2088,12,22}, {2088,12,23}, {2088,12,24}, {2088,12,25}, {2088,12,26}, {2088,12,27}, {2088,12,28}, {2088,12,29}, {2088,12,30}, {2088,12,31}, {2089,1,1}, {2089,1,2}, {2089,1,3}, {2089,1,4}, {2089,1,5}, {2089,1,6}, {2089,1,7}, {2089,1,8}, {2089,1,9}, {2089,1,10}, {2089,1,11}, 
-{2089,1,12}, {2089,1,13}, {2089,1,14}, {2089,1,15}, {2089,1,16}, {2089,1,17}, {2089,1,18}, {2089,1,19}, {2089,1,20}, {2089,1,21}, {2089,1,22}, {2089,1,23}, {2089,1,24}, {2089,1,25}, {2089,1,26}, {2089,1,27}, {2089,1,28}, {2089,1,29}, {2089,1,30}, {2089,1,31}, {2089,2,1}, {2089,2,2}, {2089,2,3}, {2089,2,4}, {2089,2,5}, {2089,2,6}, {2089,2,7}, {2089,2,8}, {2089,2,9}, {2089,2,10}, {2089,2,11}, {2089,2,12}, 
-{2089,2,13}, {2089,2,14}, {2089,2,15}, {2089,2,16}, {2089,2,17}, {2089,2,18}, {2089,2,19}, {2089,2,20}, {2089,2,21}, {2089,2,22}, {2089,2,23}, {2089,2,24}, {2089,2,25}, {2089,2,26}, {2089,2,27}, {2089,2,28}, {2089,3,1}, {2089,3,2}, {2089,3,3}, {2089,3,4}, {2089,3,5}, {2089,3,6}, {2089,3,7}, {2089,3,8}, {2089,3,9}, {2089,3,10}, {2089,3,11}, {2089,3,12}, {2089,3,13}, {2089,3,14}, {2089,3,15}, {2089,3,16}, 
-{2089,3,17}, {2089,3,18}, {2089,3,19}, {2089,3,20}, {2089,3,21}, {2089,3,22}, {2089,3,23}, {2089,3,24}, {2089,3,25}, {2089,3,26}, {2089,3,27}, {2089,3,28}, {2089,3,29}, {2089,3,30}, {2089,3,31}, {2089,4,1}, {2089,4,2}, {2089,4,3}, {2089,4,4}, {2089,4,5}, {2089,4,6}, {2089,4,7}, {2089,4,8}, {2089,4,9}, {2089,4,10}, {2089,4,11}, {2089,4,12}, {2089,4,13}, {2089,4,14}, {2089,4,15}, {2089,4,16}, {2089,4,17}, 
-{2089,4,18}, {2089,4,19}, {2089,4,20}, {2089,4,21}, {2089,4,22}, {2089,4,23}, {2089,4,24}, {2089,4,25}, {2089,4,26}, {2089,4,27}, {2089,4,28}, {2089,4,29}, {2089,4,30}, {2089,5,1}, {2089,5,2}, {2089,5,3}, {2089,5,4}, {2089,5,5}, {2089,5,6}, {2089,5,7}, {2089,5,8}, {2089,5,9}, {2089,5,10}, {2089,5,11}, {2089,5,12}, {2089,5,13}, {2089,5,14}, {2089,5,15}, {2089,5,16}, {2089,5,17}, {2089,5,18}, {2089,5,19}, 
-{2089,5,20}, {2089,5,21}, {2089,5,22}, {2089,5,23}, {2089,5,24}, {2089,5,25}, {2089,5,26}, {2089,5,27}, {2089,5,28}, {2089,5,29}, {2089,5,30}, {2089,5,31}, {2089,6,1}, {2089,6,2}, {2089,6,3}, {2089,6,4}, {2089,6,5}, {2089,6,6}, {2089,6,7}, {2089,6,8}, {2089,6,9}, {2089,6,10}, {2089,6,11}, {2089,6,12}, {2089,6,13}, {2089,6,14}, {2089,6,15}, {2089,6,16}, {2089,6,17}, {2089,6,18}, {2089,6,19}, {2089,6,20}, 
-{2089,6,21}, {2089,6,22}, {2089,6,23}, {2089,6,24}, {2089,6,25}, {2089,6,26}, {2089,6,27}, {2089,6,28}, {2089,6,29}, {2089,6,30}, {2089,7,1}, {2089,7,2}, {2089,7,3}, {2089,7,4}, {2089,7,5}, {2089,7,6}, {2089,7,7}, {2089,7,8}, {2089,7,9}, {2089,7,10}, {2089,7,11}, {2089,7,12}, {2089,7,13}, {2089,7,14}, {2089,7,15}, {2089,7,16}, {2089,7,17}, {2089,7,18}, {2089,7,19}, {2089,7,20}, {2089,7,21}, {2089,7,22}, 
-{2089,7,23}, {2089,7,24}, {2089,7,25}, {2089,7,26}, {2089,7,27}, {2089,7,28}, {2089,7,29}, {2089,7,30}, {2089,7,31}, {2089,8,1}, {2089,8,2}, {2089,8,3}, {2089,8,4}, {2089,8,5}, {2089,8,6}, {2089,8,7}, {2089,8,8}, {2089,8,9}, {2089,8,10}, {2089,8,11}, {2089,8,12}, {2089,8,13}, {2089,8,14}, {2089,8,15}, {2089,8,16}, {2089,8,17}, {2089,8,18}, {2089,8,19}, {2089,8,20}, {2089,8,21}, {2089,8,22}, {2089,8,23}, 
-{2089,8,24}, {2089,8,25}, {2089,8,26}, {2089,8,27}, {2089,8,28}, {2089,8,29}, {2089,8,30}, {2089,8,31}, {2089,9,1}, {2089,9,2}, {2089,9,3}, {2089,9,4}, {2089,9,5}, {2089,9,6}, {2089,9,7}, {2089,9,8}, {2089,9,9}, {2089,9,10}, {2089,9,11}, {2089,9,12}, {2089,9,13}, {2089,9,14}, {2089,9,15}, {2089,9,16}, {2089,9,17}, {2089,9,18}, {2089,9,19}, {2089,9,20}, {2089,9,21}, {2089,9,22}, {2089,9,23}, {2089,9,24}, 
-{2089,9,25}, {2089,9,26}, {2089,9,27}, {2089,9,28}, {2089,9,29}, {2089,9,30}, {2089,10,1}, {2089,10,2}, {2089,10,3}, {2089,10,4}, {2089,10,5}, {2089,10,6}, {2089,10,7}, {2089,10,8}, {2089,10,9}, {2089,10,10}, {2089,10,11}, {2089,10,12}, {2089,10,13}, {2089,10,14}, {2089,10,15}, {2089,10,16}, {2089,10,17}, {2089,10,18}, {2089,10,19}, {2089,10,20}, {2089,10,21}, {2089,10,22}, {2089,10,23}, {2089,10,24}, {2089,10,25}, {2089,10,26}, 
-{2089,10,27}, {2089,10,28}, {2089,10,29}, {2089,10,30}, {2089,10,31}, {2089,11,1}, {2089,11,2}, {2089,11,3}, {2089,11,4}, {2089,11,5}, {2089,11,6}, {2089,11,7}, {2089,11,8}, {2089,11,9}, {2089,11,10}, {2089,11,11}, {2089,11,12}, {2089,11,13}, {2089,11,14}, {2089,11,15}, {2089,11,16}, {2089,11,17}, {2089,11,18}, {2089,11,19}, {2089,11,20}, {2089,11,21}, {2089,11,22}, {2089,11,23}, {2089,11,24}, {2089,11,25}, {2089,11,26}, {2089,11,27}, 
-{2089,11,28}, {2089,11,29}, {2089,11,30}, {2089,12,1}, {2089,12,2}, {2089,12,3}, {2089,12,4}, {2089,12,5}, {2089,12,6}, {2089,12,7}, {2089,12,8}, {2089,12,9}, {2089,12,10}, {2089,12,11}, {2089,12,12}, {2089,12,13}, {2089,12,14}, {2089,12,15}, {2089,12,16}, {2089,12,17}, {2089,12,18}, {2089,12,19}, {2089,12,20}, {2089,12,21}, {2089,12,22}, {2089,12,23}, {2089,12,24}, {2089,12,25}, {2089,12,26}, {2089,12,27}, {2089,12,28}, {2089,12,29}, 
-{2089,12,30}, {2089,12,31}, {2090,1,1}, {2090,1,2}, {2090,1,3}, {2090,1,4}, {2090,1,5}, {2090,1,6}, {2090,1,7}, {2090,1,8}, {2090,1,9}, {2090,1,10}, {2090,1,11}, {2090,1,12}, {2090,1,13}, {2090,1,14}, {2090,1,15}, {2090,1,16}, {2090,1,17}, {2090,1,18}, {2090,1,19}, {2090,1,20}, {2090,1,21}, {2090,1,22}, {2090,1,23}, {2090,1,24}, {2090,1,25}, {2090,1,26}, {2090,1,27}, {2090,1,28}, {2090,1,29}, {2090,1,30}, 
-{2090,1,31}, {2090,2,1}, {2090,2,2}, {2090,2,3}, {2090,2,4}, {2090,2,5}, {2090,2,6}, {2090,2,7}, {2090,2,8}, {2090,2,9}, {2090,2,10}, {2090,2,11}, {2090,2,12}, {2090,2,13}, {2090,2,14}, {2090,2,15}, {2090,2,16}, {2090,2,17}, {2090,2,18}, {2090,2,19}, {2090,2,20}, {2090,2,21}, {2090,2,22}, {2090,2,23}, {2090,2,24}, {2090,2,25}, {2090,2,26}, {2090,2,27}, {2090,2,28}, {2090,3,1}, {2090,3,2}, {2090,3,3}, 
-{2090,3,4}, {2090,3,5}, {2090,3,6}, {2090,3,7}, {2090,3,8}, {2090,3,9}, {2090,3,10}, {2090,3,11}, {2090,3,12}, {2090,3,13}, {2090,3,14}, {2090,3,15}, {2090,3,16}, {2090,3,17}, {2090,3,18}, {2090,3,19}, {2090,3,20}, {2090,3,21}, {2090,3,22}, {2090,3,23}, {2090,3,24}, {2090,3,25}, {2090,3,26}, {2090,3,27}, {2090,3,28}, {2090,3,29}, {2090,3,30}, {2090,3,31}, {2090,4,1}, {2090,4,2}, {2090,4,3}, {2090,4,4}, 
-{2090,4,5}, {2090,4,6}, {2090,4,7}, {2090,4,8}, {2090,4,9}, {2090,4,10}, {2090,4,11}, {2090,4,12}, {2090,4,13}, {2090,4,14}, {2090,4,15}, {2090,4,16}, {2090,4,17}, {2090,4,18}, {2090,4,19}, {2090,4,20}, {2090,4,21}, {2090,4,22}, {2090,4,23}, {2090,4,24}, {2090,4,25}, {2090,4,26}, {2090,4,27}, {2090,4,28}, {2090,4,29}, {2090,4,30}, {2090,5,1}, {2090,5,2}, {2090,5,3}, {2090,5,4}, {2090,5,5}, {2090,5,6}, 
-{2090,5,7}, {2090,5,8}, {2090,5,9}, {2090,5,10}, {2090,5,11}, {2090,5,12}, {2090,5,13}, {2090,5,14}, {2090,5,15}, {2090,5,16}, {2090,5,17}, {2090,5,18}, {2090,5,19}, {2090,5,20}, {2090,5,21}, {2090,5,22}, {2090,5,23}, {2090,5,24}, {2090,5,25}, {2090,5,26}, {2090,5,27}, {2090,5,28}, {2090,5,29}, {2090,5,30}, {2090,5,31}, {2090,6,1}, {2090,6,2}, {2090,6,3}, {2090,6,4}, {2090,6,5}, {2090,6,6}, {2090,6,7}, 
-{2090,6,8}, {2090,6,9}, {2090,6,10}, {2090,6,11}, {2090,6,12}, {2090,6,13}, {2090,6,14}, {2090,6,15}, {2090,6,16}, {2090,6,17}, {2090,6,18}, {2090,6,19}, {2090,6,20}, {2090,6,21}, {2090,6,22}, {2090,6,23}, {2090,6,24}, {2090,6,25}, {2090,6,26}, {2090,6,27}, {2090,6,28}, {2090,6,29}, {2090,6,30}, {2090,7,1}, {2090,7,2}, {2090,7,3}, {2090,7,4}, {2090,7,5}, {2090,7,6}, {2090,7,7}, {2090,7,8}, {2090,7,9}, 
-{2090,7,10}, {2090,7,11}, {2090,7,12}, {2090,7,13}, {2090,7,14}, {2090,7,15}, {2090,7,16}, {2090,7,17}, {2090,7,18}, {2090,7,19}, {2090,7,20}, {2090,7,21}, {2090,7,22}, {2090,7,23}, {2090,7,24}, {2090,7,25}, {2090,7,26}, {2090,7,27}, {2090,7,28}, {2090,7,29}, {2090,7,30}, {2090,7,31}, {2090,8,1}, {2090,8,2}, {2090,8,3}, {2090,8,4}, {2090,8,5}, {2090,8,6}, {2090,8,7}, {2090,8,8}, {2090,8,9}, {2090,8,10}, 
-{2090,8,11}, {2090,8,12}, {2090,8,13}, {2090,8,14}, {2090,8,15}, {2090,8,16}, {2090,8,17}, {2090,8,18}, {2090,8,19}, {2090,8,20}, {2090,8,21}, {2090,8,22}, {2090,8,23}, {2090,8,24}, {2090,8,25}, {2090,8,26}, {2090,8,27}, {2090,8,28}, {2090,8,29}, {2090,8,30}, {2090,8,31}, {2090,9,1}, {2090,9,2}, {2090,9,3}, {2090,9,4}, {2090,9,5}, {2090,9,6}, {2090,9,7}, {2090,9,8}, {2090,9,9}, {2090,9,10}, {2090,9,11}, 
-{2090,9,12}, {2090,9,13}, {2090,9,14}, {2090,9,15}, {2090,9,16}, {2090,9,17}, {2090,9,18}, {2090,9,19}, {2090,9,20}, {2090,9,21}, {2090,9,22}, {2090,9,23}, {2090,9,24}, {2090,9,25}, {2090,9,26}, {2090,9,27}, {2090,9,28}, {2090,9,29}, {2090,9,30}, {2090,10,1}, {2090,10,2}, {2090,10,3}, {2090,10,4}, {2090,10,5}, {2090,10,6}, {2090,10,7}, {2090,10,8}, {2090,10,9}, {2090,10,10}, {2090,10,11}, {2090,10,12}, {2090,10,13}, 
-{2090,10,14}, {2090,10,15}, {2090,10,16}, {2090,10,17}, {2090,10,18}, {2090,10,19}, {2090,10,20}, {2090,10,21}, {2090,10,22}, {2090,10,23}, {2090,10,24}, {2090,10,25}, {2090,10,26}, {2090,10,27}, {2090,10,28}, {2090,10,29}, {2090,10,30}, {2090,10,31}, {2090,11,1}, {2090,11,2}, {2090,11,3}, {2090,11,4}, {2090,11,5}, {2090,11,6}, {2090,11,7}, {2090,11,8}, {2090,11,9}, {2090,11,10}, {2090,11,11}, {2090,11,12}, {2090,11,13}, {2090,11,14}, 
-{2090,11,15}, {2090,11,16}, {2090,11,17}, {2090,11,18}, {2090,11,19}, {2090,11,20}, {2090,11,21}, {2090,11,22}, {2090,11,23}, {2090,11,24}, {2090,11,25}, {2090,11,26}, {2090,11,27}, {2090,11,28}, {2090,11,29}, {2090,11,30}, {2090,12,1}, {2090,12,2}, {2090,12,3}, {2090,12,4}, {2090,12,5}, {2090,12,6}, {2090,12,7}, {2090,12,8}, {2090,12,9}, {2090,12,10}, {2090,12,11}, {2090,12,12}, {2090,12,13}, {2090,12,14}, {2090,12,15}, {2090,12,16}, 
-{2090,12,17}, {2090,12,18}, {2090,12,19}, {2090,12,20}, {2090,12,21}, {2090,12,22}, {2090,12,23}, {2090,12,24}, {2090,12,25}, {2090,12,26}, {2090,12,27}, {2090,12,28}, {2090,12,29}, {2090,12,30}, {2090,12,31}, {2091,1,1}, {2091,1,2}, {2091,1,3}, {2091,1,4}, {2091,1,5}, {2091,1,6}, {2091,1,7}, {2091,1,8}, {2091,1,9}, {2091,1,10}, {2091,1,11}, {2091,1,12}, {2091,1,13}, {2091,1,14}, {2091,1,15}, {2091,1,16}, {2091,1,17}, 
-{2091,1,18}, {2091,1,19}, {2091,1,20}, {2091,1,21}, {2091,1,22}, {2091,1,23}, {2091,1,24}, {2091,1,25}, {2091,1,26}, {2091,1,27}, {2091,1,28}, {2091,1,29}, {2091,1,30}, {2091,1,31}, {2091,2,1}, {2091,2,2}, {2091,2,3}, {2091,2,4}, {2091,2,5}, {2091,2,6}, {2091,2,7}, {2091,2,8}, {2091,2,9}, {2091,2,10}, {2091,2,11}, {2091,2,12}, {2091,2,13}, {2091,2,14}, {2091,2,15}, {2091,2,16}, {2091,2,17}, {2091,2,18}, 
-{2091,2,19}, {2091,2,20}, {2091,2,21}, {2091,2,22}, {2091,2,23}, {2091,2,24}, {2091,2,25}, {2091,2,26}, {2091,2,27}, {2091,2,28}, {2091,3,1}, {2091,3,2}, {2091,3,3}, {2091,3,4}, {2091,3,5}, {2091,3,6}, {2091,3,7}, {2091,3,8}, {2091,3,9}, {2091,3,10}, {2091,3,11}, {2091,3,12}, {2091,3,13}, {2091,3,14}, {2091,3,15}, {2091,3,16}, {2091,3,17}, {2091,3,18}, {2091,3,19}, {2091,3,20}, {2091,3,21}, {2091,3,22}, 
-{2091,3,23}, {2091,3,24}, {2091,3,25}, {2091,3,26}, {2091,3,27}, {2091,3,28}, {2091,3,29}, {2091,3,30}, {2091,3,31}, {2091,4,1}, {2091,4,2}, {2091,4,3}, {2091,4,4}, {2091,4,5}, {2091,4,6}, {2091,4,7}, {2091,4,8}, {2091,4,9}, {2091,4,10}, {2091,4,11}, {2091,4,12}, {2091,4,13}, {2091,4,14}, {2091,4,15}, {2091,4,16}, {2091,4,17}, {2091,4,18}, {2091,4,19}, {2091,4,20}, {2091,4,21}, {2091,4,22}, {2091,4,23}, 
-{2091,4,24}, {2091,4,25}, {2091,4,26}, {2091,4,27}, {2091,4,28}, {2091,4,29}, {2091,4,30}, {2091,5,1}, {2091,5,2}, {2091,5,3}, {2091,5,4}, {2091,5,5}, {2091,5,6}, {2091,5,7}, {2091,5,8}, {2091,5,9}, {2091,5,10}, {2091,5,11}, {2091,5,12}, {2091,5,13}, {2091,5,14}, {2091,5,15}, {2091,5,16}, {2091,5,17}, {2091,5,18}, {2091,5,19}, {2091,5,20}, {2091,5,21}, {2091,5,22}, {2091,5,23}, {2091,5,24}, {2091,5,25}, 
-{2091,5,26}, {2091,5,27}, {2091,5,28}, {2091,5,29}, {2091,5,30}, {2091,5,31}, {2091,6,1}, {2091,6,2}, {2091,6,3}, {2091,6,4}, {2091,6,5}, {2091,6,6}, {2091,6,7}, {2091,6,8}, {2091,6,9}, {2091,6,10}, {2091,6,11}, {2091,6,12}, {2091,6,13}, {2091,6,14}, {2091,6,15}, {2091,6,16}, {2091,6,17}, {2091,6,18}, {2091,6,19}, {2091,6,20}, {2091,6,21}, {2091,6,22}, {2091,6,23}, {2091,6,24}, {2091,6,25}, {2091,6,26}, 
-{2091,6,27}, {2091,6,28}, {2091,6,29}, {2091,6,30}, {2091,7,1}, {2091,7,2}, {2091,7,3}, {2091,7,4}, {2091,7,5}, {2091,7,6}, {2091,7,7}, {2091,7,8}, {2091,7,9}, {2091,7,10}, {2091,7,11}, {2091,7,12}, {2091,7,13}, {2091,7,14}, {2091,7,15}, {2091,7,16}, {2091,7,17}, {2091,7,18}, {2091,7,19}, {2091,7,20}, {2091,7,21}, {2091,7,22}, {2091,7,23}, {2091,7,24}, {2091,7,25}, {2091,7,26}, {2091,7,27}, {2091,7,28}, 
-{2091,7,29}, {2091,7,30}, {2091,7,31}, {2091,8,1}, {2091,8,2}, {2091,8,3}, {2091,8,4}, {2091,8,5}, {2091,8,6}, {2091,8,7}, {2091,8,8}, {2091,8,9}, {2091,8,10}, {2091,8,11}, {2091,8,12}, {2091,8,13}, {2091,8,14}, {2091,8,15}, {2091,8,16}, {2091,8,17}, {2091,8,18}, {2091,8,19}, {2091,8,20}, {2091,8,21}, {2091,8,22}, {2091,8,23}, {2091,8,24}, {2091,8,25}, {2091,8,26}, {2091,8,27}, {2091,8,28}, {2091,8,29}, 
-{2091,8,30}, {2091,8,31}, {2091,9,1}, {2091,9,2}, {2091,9,3}, {2091,9,4}, {2091,9,5}, {2091,9,6}, {2091,9,7}, {2091,9,8}, {2091,9,9}, {2091,9,10}, {2091,9,11}, {2091,9,12}, {2091,9,13}, {2091,9,14}, {2091,9,15}, {2091,9,16}, {2091,9,17}, {2091,9,18}, {2091,9,19}, {2091,9,20}, {2091,9,21}, {2091,9,22}, {2091,9,23}, {2091,9,24}, {2091,9,25}, {2091,9,26}, {2091,9,27}, {2091,9,28}, {2091,9,29}, {2091,9,30}, 
-{2091,10,1}, {2091,10,2}, {2091,10,3}, {2091,10,4}, {2091,10,5}, {2091,10,6}, {2091,10,7}, {2091,10,8}, {2091,10,9}, {2091,10,10}, {2091,10,11}, {2091,10,12}, {2091,10,13}, {2091,10,14}, {2091,10,15}, {2091,10,16}, {2091,10,17}, {2091,10,18}, {2091,10,19}, {2091,10,20}, {2091,10,21}, {2091,10,22}, {2091,10,23}, {2091,10,24}, {2091,10,25}, {2091,10,26}, {2091,10,27}, {2091,10,28}, {2091,10,29}, {2091,10,30}, {2091,10,31}, {2091,11,1}, 
-{2091,11,2}, {2091,11,3}, {2091,11,4}, {2091,11,5}, {2091,11,6}, {2091,11,7}, {2091,11,8}, {2091,11,9}, {2091,11,10}, {2091,11,11}, {2091,11,12}, {2091,11,13}, {2091,11,14}, {2091,11,15}, {2091,11,16}, {2091,11,17}, {2091,11,18}, {2091,11,19}, {2091,11,20}, {2091,11,21}, {2091,11,22}, {2091,11,23}, {2091,11,24}, {2091,11,25}, {2091,11,26}, {2091,11,27}, {2091,11,28}, {2091,11,29}, {2091,11,30}, {2091,12,1}, {2091,12,2}, {2091,12,3}, 
-{2091,12,4}, {2091,12,5}, {2091,12,6}, {2091,12,7}, {2091,12,8}, {2091,12,9}, {2091,12,10}, {2091,12,11}, {2091,12,12}, {2091,12,13}, {2091,12,14}, {2091,12,15}, {2091,12,16}, {2091,12,17}, {2091,12,18}, {2091,12,19}, {2091,12,20}, {2091,12,21}, {2091,12,22}, {2091,12,23}, {2091,12,24}, {2091,12,25}, {2091,12,26}, {2091,12,27}, {2091,12,28}, {2091,12,29}, {2091,12,30}, {2091,12,31}, {2092,1,1}, {2092,1,2}, {2092,1,3}, {2092,1,4}, 
-{2092,1,5}, {2092,1,6}, {2092,1,7}, {2092,1,8}, {2092,1,9}, {2092,1,10}, {2092,1,11}, {2092,1,12}, {2092,1,13}, {2092,1,14}, {2092,1,15}, {2092,1,16}, {2092,1,17}, {2092,1,18}, {2092,1,19}, {2092,1,20}, {2092,1,21}, {2092,1,22}, {2092,1,23}, {2092,1,24}, {2092,1,25}, {2092,1,26}, {2092,1,27}, {2092,1,28}, {2092,1,29}, {2092,1,30}, {2092,1,31}, {2092,2,1}, {2092,2,2}, {2092,2,3}, {2092,2,4}, {2092,2,5}, 
-{2092,2,6}, {2092,2,7}, {2092,2,8}, {2092,2,9}, {2092,2,10}, {2092,2,11}, {2092,2,12}, {2092,2,13}, {2092,2,14}, {2092,2,15}, {2092,2,16}, {2092,2,17}, {2092,2,18}, {2092,2,19}, {2092,2,20}, {2092,2,21}, {2092,2,22}, {2092,2,23}, {2092,2,24}, {2092,2,25}, {2092,2,26}, {2092,2,27}, {2092,2,28}, {2092,2,29}, {2092,3,1}, {2092,3,2}, {2092,3,3}, {2092,3,4}, {2092,3,5}, {2092,3,6}, {2092,3,7}, {2092,3,8}, 
-{2092,3,9}, {2092,3,10}, {2092,3,11}, {2092,3,12}, {2092,3,13}, {2092,3,14}, {2092,3,15}, {2092,3,16}, {2092,3,17}, {2092,3,18}, {2092,3,19}, {2092,3,20}, {2092,3,21}, {2092,3,22}, {2092,3,23}, {2092,3,24}, {2092,3,25}, {2092,3,26}, {2092,3,27}, {2092,3,28}, {2092,3,29}, {2092,3,30}, {2092,3,31}, {2092,4,1}, {2092,4,2}, {2092,4,3}, {2092,4,4}, {2092,4,5}, {2092,4,6}, {2092,4,7}, {2092,4,8}, {2092,4,9}, 
-{2092,4,10}, {2092,4,11}, {2092,4,12}, {2092,4,13}, {2092,4,14}, {2092,4,15}, {2092,4,16}, {2092,4,17}, {2092,4,18}, {2092,4,19}, {2092,4,20}, {2092,4,21}, {2092,4,22}, {2092,4,23}, {2092,4,24}, {2092,4,25}, {2092,4,26}, {2092,4,27}, {2092,4,28}, {2092,4,29}, {2092,4,30}, {2092,5,1}, {2092,5,2}, {2092,5,3}, {2092,5,4}, {2092,5,5}, {2092,5,6}, {2092,5,7}, {2092,5,8}, {2092,5,9}, {2092,5,10}, {2092,5,11}, 
-{2092,5,12}, {2092,5,13}, {2092,5,14}, {2092,5,15}, {2092,5,16}, {2092,5,17}, {2092,5,18}, {2092,5,19}, {2092,5,20}, {2092,5,21}, {2092,5,22}, {2092,5,23}, {2092,5,24}, {2092,5,25}, {2092,5,26}, {2092,5,27}, {2092,5,28}, {2092,5,29}, {2092,5,30}, {2092,5,31}, {2092,6,1}, {2092,6,2}, {2092,6,3}, {2092,6,4}, {2092,6,5}, {2092,6,6}, {2092,6,7}, {2092,6,8}, {2092,6,9}, {2092,6,10}, {2092,6,11}, {2092,6,12}, 
-{2092,6,13}, {2092,6,14}, {2092,6,15}, {2092,6,16}, {2092,6,17}, {2092,6,18}, {2092,6,19}, {2092,6,20}, {2092,6,21}, {2092,6,22}, {2092,6,23}, {2092,6,24}, {2092,6,25}, {2092,6,26}, {2092,6,27}, {2092,6,28}, {2092,6,29}, {2092,6,30}, {2092,7,1}, {2092,7,2}, {2092,7,3}, {2092,7,4}, {2092,7,5}, {2092,7,6}, {2092,7,7}, {2092,7,8}, {2092,7,9}, {2092,7,10}, {2092,7,11}, {2092,7,12}, {2092,7,13}, {2092,7,14}, 
-{2092,7,15}, {2092,7,16}, {2092,7,17}, {2092,7,18}, {2092,7,19}, {2092,7,20}, {2092,7,21}, {2092,7,22}, {2092,7,23}, {2092,7,24}, {2092,7,25}, {2092,7,26}, {2092,7,27}, {2092,7,28}, {2092,7,29}, {2092,7,30}, {2092,7,31}, {2092,8,1}, {2092,8,2}, {2092,8,3}, {2092,8,4}, {2092,8,5}, {2092,8,6}, {2092,8,7}, {2092,8,8}, {2092,8,9}, {2092,8,10}, {2092,8,11}, {2092,8,12}, {2092,8,13}, {2092,8,14}, {2092,8,15}, 
-{2092,8,16}, {2092,8,17}, {2092,8,18}, {2092,8,19}, {2092,8,20}, {2092,8,21}, {2092,8,22}, {2092,8,23}, {2092,8,24}, {2092,8,25}, {2092,8,26}, {2092,8,27}, {2092,8,28}, {2092,8,29}, {2092,8,30}, {2092,8,31}, {2092,9,1}, {2092,9,2}, {2092,9,3}, {2092,9,4}, {2092,9,5}, {2092,9,6}, {2092,9,7}, {2092,9,8}, {2092,9,9}, {2092,9,10}, {2092,9,11}, {2092,9,12}, {2092,9,13}, {2092,9,14}, {2092,9,15}, {2092,9,16}, 
-{2092,9,17}, {2092,9,18}, {2092,9,19}, {2092,9,20}, {2092,9,21}, {2092,9,22}, {2092,9,23}, {2092,9,24}, {2092,9,25}, {2092,9,26}, {2092,9,27}, {2092,9,28}, {2092,9,29}, {2092,9,30}, {2092,10,1}, {2092,10,2}, {2092,10,3}, {2092,10,4}, {2092,10,5}, {2092,10,6}, {2092,10,7}, {2092,10,8}, {2092,10,9}, {2092,10,10}, {2092,10,11}, {2092,10,12}, {2092,10,13}, {2092,10,14}, {2092,10,15}, {2092,10,16}, {2092,10,17}, {2092,10,18}, 
-{2092,10,19}, {2092,10,20}, {2092,10,21}, {2092,10,22}, {2092,10,23}, {2092,10,24}, {2092,10,25}, {2092,10,26}, {2092,10,27}, {2092,10,28}, {2092,10,29}, {2092,10,30}, {2092,10,31}, {2092,11,1}, {2092,11,2}, {2092,11,3}, {2092,11,4}, {2092,11,5}, {2092,11,6}, {2092,11,7}, {2092,11,8}, {2092,11,9}, {2092,11,10}, {2092,11,11}, {2092,11,12}, {2092,11,13}, {2092,11,14}, {2092,11,15}, {2092,11,16}, {2092,11,17}, {2092,11,18}, {2092,11,19}, 
-{2092,11,20}, {2092,11,21}, {2092,11,22}, {2092,11,23}, {2092,11,24}, {2092,11,25}, {2092,11,26}, {2092,11,27}, {2092,11,28}, {2092,11,29}, {2092,11,30}, {2092,12,1}, {2092,12,2}, {2092,12,3}, {2092,12,4}, {2092,12,5}, {2092,12,6}, {2092,12,7}, {2092,12,8}, {2092,12,9}, {2092,12,10}, {2092,12,11}, {2092,12,12}, {2092,12,13}, {2092,12,14}, {2092,12,15}, {2092,12,16}, {2092,12,17}, {2092,12,18}, {2092,12,19}, {2092,12,20}, {2092,12,21}, 
-{2092,12,22}, {2092,12,23}, {2092,12,24}, {2092,12,25}, {2092,12,26}, {2092,12,27}, {2092,12,28}, {2092,12,29}, {2092,12,30}, {2092,12,31}, {2093,1,1}, {2093,1,2}, {2093,1,3}, {2093,1,4}, {2093,1,5}, {2093,1,6}, {2093,1,7}, {2093,1,8}, {2093,1,9}, {2093,1,10}, {2093,1,11}, {2093,1,12}, {2093,1,13}, {2093,1,14}, {2093,1,15}, {2093,1,16}, {2093,1,17}, {2093,1,18}, {2093,1,19}, {2093,1,20}, {2093,1,21}, {2093,1,22}, 
-{2093,1,23}, {2093,1,24}, {2093,1,25}, {2093,1,26}, {2093,1,27}, {2093,1,28}, {2093,1,29}, {2093,1,30}, {2093,1,31}, {2093,2,1}, {2093,2,2}, {2093,2,3}, {2093,2,4}, {2093,2,5}, {2093,2,6}, {2093,2,7}, {2093,2,8}, {2093,2,9}, {2093,2,10}, {2093,2,11}, {2093,2,12}, {2093,2,13}, {2093,2,14}, {2093,2,15}, {2093,2,16}, {2093,2,17}, {2093,2,18}, {2093,2,19}, {2093,2,20}, {2093,2,21}, {2093,2,22}, {2093,2,23}, 
-{2093,2,24}, {2093,2,25}, {2093,2,26}, {2093,2,27}, {2093,2,28}, {2093,3,1}, {2093,3,2}, {2093,3,3}, {2093,3,4}, {2093,3,5}, {2093,3,6}, {2093,3,7}, {2093,3,8}, {2093,3,9}, {2093,3,10}, {2093,3,11}, {2093,3,12}, {2093,3,13}, {2093,3,14}, {2093,3,15}, {2093,3,16}, {2093,3,17}, {2093,3,18}, {2093,3,19}, {2093,3,20}, {2093,3,21}, {2093,3,22}, {2093,3,23}, {2093,3,24}, {2093,3,25}, {2093,3,26}, {2093,3,27}, 
-{2093,3,28}, {2093,3,29}, {2093,3,30}, {2093,3,31}, {2093,4,1}, {2093,4,2}, {2093,4,3}, {2093,4,4}, {2093,4,5}, {2093,4,6}, {2093,4,7}, {2093,4,8}, {2093,4,9}, {2093,4,10}, {2093,4,11}, {2093,4,12}, {2093,4,13}, {2093,4,14}, {2093,4,15}, {2093,4,16}, {2093,4,17}, {2093,4,18}, {2093,4,19}, {2093,4,20}, {2093,4,21}, {2093,4,22}, {2093,4,23}, {2093,4,24}, {2093,4,25}, {2093,4,26}, {2093,4,27}, {2093,4,28}, 
-{2093,4,29}, {2093,4,30}, {2093,5,1}, {2093,5,2}, {2093,5,3}, {2093,5,4}, {2093,5,5}, {2093,5,6}, {2093,5,7}, {2093,5,8}, {2093,5,9}, {2093,5,10}, {2093,5,11}, {2093,5,12}, {2093,5,13}, {2093,5,14}, {2093,5,15}, {2093,5,16}, {2093,5,17}, {2093,5,18}, {2093,5,19}, {2093,5,20}, {2093,5,21}, {2093,5,22}, {2093,5,23}, {2093,5,24}, {2093,5,25}, {2093,5,26}, {2093,5,27}, {2093,5,28}, {2093,5,29}, {2093,5,30}, 
-{2093,5,31}, {2093,6,1}, {2093,6,2}, {2093,6,3}, {2093,6,4}, {2093,6,5}, {2093,6,6}, {2093,6,7}, {2093,6,8}, {2093,6,9}, {2093,6,10}, {2093,6,11}, {2093,6,12}, {2093,6,13}, {2093,6,14}, {2093,6,15}, {2093,6,16}, {2093,6,17}, {2093,6,18}, {2093,6,19}, {2093,6,20}, {2093,6,21}, {2093,6,22}, {2093,6,23}, {2093,6,24}, {2093,6,25}, {2093,6,26}, {2093,6,27}, {2093,6,28}, {2093,6,29}, {2093,6,30}, {2093,7,1}, 
-{2093,7,2}, {2093,7,3}, {2093,7,4}, {2093,7,5}, {2093,7,6}, {2093,7,7}, {2093,7,8}, {2093,7,9}, {2093,7,10}, {2093,7,11}, {2093,7,12}, {2093,7,13}, {2093,7,14}, {2093,7,15}, {2093,7,16}, {2093,7,17}, {2093,7,18}, {2093,7,19}, {2093,7,20}, {2093,7,21}, {2093,7,22}, {2093,7,23}, {2093,7,24}, {2093,7,25}, {2093,7,26}, {2093,7,27}, {2093,7,28}, {2093,7,29}, {2093,7,30}, {2093,7,31}, {2093,8,1}, {2093,8,2}, 
-{2093,8,3}, {2093,8,4}, {2093,8,5}, {2093,8,6}, {2093,8,7}, {2093,8,8}, {2093,8,9}, {2093,8,10}, {2093,8,11}, {2093,8,12}, {2093,8,13}, {2093,8,14}, {2093,8,15}, {2093,8,16}, {2093,8,17}, {2093,8,18}, {2093,8,19}, {2093,8,20}, {2093,8,21}, {2093,8,22}, {2093,8,23}, {2093,8,24}, {2093,8,25}, {2093,8,26}, {2093,8,27}, {2093,8,28}, {2093,8,29}, {2093,8,30}, {2093,8,31}, {2093,9,1}, {2093,9,2}, {2093,9,3}, 
-{2093,9,4}, {2093,9,5}, {2093,9,6}, {2093,9,7}, {2093,9,8}, {2093,9,9}, {2093,9,10}, {2093,9,11}, {2093,9,12}, {2093,9,13}, {2093,9,14}, {2093,9,15}, {2093,9,16}, {2093,9,17}, {2093,9,18}, {2093,9,19}, {2093,9,20}, {2093,9,21}, {2093,9,22}, {2093,9,23}, {2093,9,24}, {2093,9,25}, {2093,9,26}, {2093,9,27}, {2093,9,28}, {2093,9,29}, {2093,9,30}, {2093,10,1}, {2093,10,2}, {2093,10,3}, {2093,10,4}, {2093,10,5}, 
-{2093,10,6}, {2093,10,7}, {2093,10,8}, {2093,10,9}, {2093,10,10}, {2093,10,11}, {2093,10,12}, {2093,10,13}, {2093,10,14}, {2093,10,15}, {2093,10,16}, {2093,10,17}, {2093,10,18}, {2093,10,19}, {2093,10,20}, {2093,10,21}, {2093,10,22}, {2093,10,23}, {2093,10,24}, {2093,10,25}, {2093,10,26}, {2093,10,27}, {2093,10,28}, {2093,10,29}, {2093,10,30}, {2093,10,31}, {2093,11,1}, {2093,11,2}, {2093,11,3}, {2093,11,4}, {2093,11,5}, {2093,11,6}, 
-{2093,11,7}, {2093,11,8}, {2093,11,9}, {2093,11,10}, {2093,11,11}, {2093,11,12}, {2093,11,13}, {2093,11,14}, {2093,11,15}, {2093,11,16}, {2093,11,17}, {2093,11,18}, {2093,11,19}, {2093,11,20}, {2093,11,21}, {2093,11,22}, {2093,11,23}, {2093,11,24}, {2093,11,25}, {2093,11,26}, {2093,11,27}, {2093,11,28}, {2093,11,29}, {2093,11,30}, {2093,12,1}, {2093,12,2}, {2093,12,3}, {2093,12,4}, {2093,12,5}, {2093,12,6}, {2093,12,7}, {2093,12,8}, 
-{2093,12,9}, {2093,12,10}, {2093,12,11}, {2093,12,12}, {2093,12,13}, {2093,12,14}, {2093,12,15}, {2093,12,16}, {2093,12,17}, {2093,12,18}, {2093,12,19}, {2093,12,20}, {2093,12,21}, {2093,12,22}, {2093,12,23}, {2093,12,24}, {2093,12,25}, {2093,12,26}, {2093,12,27}, {2093,12,28}, {2093,12,29}, {2093,12,30}, {2093,12,31}, {2094,1,1}, {2094,1,2}, {2094,1,3}, {2094,1,4}, {2094,1,5}, {2094,1,6}, {2094,1,7}, {2094,1,8}, {2094,1,9}, 
-{2094,1,10}, {2094,1,11}, {2094,1,12}, {2094,1,13}, {2094,1,14}, {2094,1,15}, {2094,1,16}, {2094,1,17}, {2094,1,18}, {2094,1,19}, {2094,1,20}, {2094,1,21}, {2094,1,22}, {2094,1,23}, {2094,1,24}, {2094,1,25}, {2094,1,26}, {2094,1,27}, {2094,1,28}, {2094,1,29}, {2094,1,30}, {2094,1,31}, {2094,2,1}, {2094,2,2}, {2094,2,3}, {2094,2,4}, {2094,2,5}, {2094,2,6}, {2094,2,7}, {2094,2,8}, {2094,2,9}, {2094,2,10}, 
-{2094,2,11}, {2094,2,12}, {2094,2,13}, {2094,2,14}, {2094,2,15}, {2094,2,16}, {2094,2,17}, {2094,2,18}, {2094,2,19}, {2094,2,20}, {2094,2,21}, {2094,2,22}, {2094,2,23}, {2094,2,24}, {2094,2,25}, {2094,2,26}, {2094,2,27}, {2094,2,28}, {2094,3,1}, {2094,3,2}, {2094,3,3}, {2094,3,4}, {2094,3,5}, {2094,3,6}, {2094,3,7}, {2094,3,8}, {2094,3,9}, {2094,3,10}, {2094,3,11}, {2094,3,12}, {2094,3,13}, {2094,3,14}, 
-{2094,3,15}, {2094,3,16}, {2094,3,17}, {2094,3,18}, {2094,3,19}, {2094,3,20}, {2094,3,21}, {2094,3,22}, {2094,3,23}, {2094,3,24}, {2094,3,25}, {2094,3,26}, {2094,3,27}, {2094,3,28}, {2094,3,29}, {2094,3,30}, {2094,3,31}, {2094,4,1}, {2094,4,2}, {2094,4,3}, {2094,4,4}, {2094,4,5}, {2094,4,6}, {2094,4,7}, {2094,4,8}, {2094,4,9}, {2094,4,10}, {2094,4,11}, {2094,4,12}, {2094,4,13}, {2094,4,14}, {2094,4,15}, 
-{2094,4,16}, {2094,4,17}, {2094,4,18}, {2094,4,19}, {2094,4,20}, {2094,4,21}, {2094,4,22}, {2094,4,23}, {2094,4,24}, {2094,4,25}, {2094,4,26}, {2094,4,27}, {2094,4,28}, {2094,4,29}, {2094,4,30}, {2094,5,1}, {2094,5,2}, {2094,5,3}, {2094,5,4}, {2094,5,5}, {2094,5,6}, {2094,5,7}, {2094,5,8}, {2094,5,9}, {2094,5,10}, {2094,5,11}, {2094,5,12}, {2094,5,13}, {2094,5,14}, {2094,5,15}, {2094,5,16}, {2094,5,17}, 
-{2094,5,18}, {2094,5,19}, {2094,5,20}, {2094,5,21}, {2094,5,22}, {2094,5,23}, {2094,5,24}, {2094,5,25}, {2094,5,26}, {2094,5,27}, {2094,5,28}, {2094,5,29}, {2094,5,30}, {2094,5,31}, {2094,6,1}, {2094,6,2}, {2094,6,3}, {2094,6,4}, {2094,6,5}, {2094,6,6}, {2094,6,7}, {2094,6,8}, {2094,6,9}, {2094,6,10}, {2094,6,11}, {2094,6,12}, {2094,6,13}, {2094,6,14}, {2094,6,15}, {2094,6,16}, {2094,6,17}, {2094,6,18}, 
-{2094,6,19}, {2094,6,20}, {2094,6,21}, {2094,6,22}, {2094,6,23}, {2094,6,24}, {2094,6,25}, {2094,6,26}, {2094,6,27}, {2094,6,28}, {2094,6,29}, {2094,6,30}, {2094,7,1}, {2094,7,2}, {2094,7,3}, {2094,7,4}, {2094,7,5}, {2094,7,6}, {2094,7,7}, {2094,7,8}, {2094,7,9}, {2094,7,10}, {2094,7,11}, {2094,7,12}, {2094,7,13}, {2094,7,14}, {2094,7,15}, {2094,7,16}, {2094,7,17}, {2094,7,18}, {2094,7,19}, {2094,7,20}, 
-{2094,7,21}, {2094,7,22}, {2094,7,23}, {2094,7,24}, {2094,7,25}, {2094,7,26}, {2094,7,27}, {2094,7,28}, {2094,7,29}, {2094,7,30}, {2094,7,31}, {2094,8,1}, {2094,8,2}, {2094,8,3}, {2094,8,4}, {2094,8,5}, {2094,8,6}, {2094,8,7}, {2094,8,8}, {2094,8,9}, {2094,8,10}, {2094,8,11}, {2094,8,12}, {2094,8,13}, {2094,8,14}, {2094,8,15}, {2094,8,16}, {2094,8,17}, {2094,8,18}, {2094,8,19}, {2094,8,20}, {2094,8,21}, 
-{2094,8,22}, {2094,8,23}, {2094,8,24}, {2094,8,25}, {2094,8,26}, {2094,8,27}, {2094,8,28}, {2094,8,29}, {2094,8,30}, {2094,8,31}, {2094,9,1}, {2094,9,2}, {2094,9,3}, {2094,9,4}, {2094,9,5}, {2094,9,6}, {2094,9,7}, {2094,9,8}, {2094,9,9}, {2094,9,10}, {2094,9,11}, {2094,9,12}, {2094,9,13}, {2094,9,14}, {2094,9,15}, {2094,9,16}, {2094,9,17}, {2094,9,18}, {2094,9,19}, {2094,9,20}, {2094,9,21}, {2094,9,22}, 
-{2094,9,23}, {2094,9,24}, {2094,9,25}, {2094,9,26}, {2094,9,27}, {2094,9,28}, {2094,9,29}, {2094,9,30}, {2094,10,1}, {2094,10,2}, {2094,10,3}, {2094,10,4}, {2094,10,5}, {2094,10,6}, {2094,10,7}, {2094,10,8}, {2094,10,9}, {2094,10,10}, {2094,10,11}, {2094,10,12}, {2094,10,13}, {2094,10,14}, {2094,10,15}, {2094,10,16}, {2094,10,17}, {2094,10,18}, {2094,10,19}, {2094,10,20}, {2094,10,21}, {2094,10,22}, {2094,10,23}, {2094,10,24}, 
-{2094,10,25}, {2094,10,26}, {2094,10,27}, {2094,10,28}, {2094,10,29}, {2094,10,30}, {2094,10,31}, {2094,11,1}, {2094,11,2}, {2094,11,3}, {2094,11,4}, {2094,11,5}, {2094,11,6}, {2094,11,7}, {2094,11,8}, {2094,11,9}, {2094,11,10}, {2094,11,11}, {2094,11,12}, {2094,11,13}, {2094,11,14}, {2094,11,15}, {2094,11,16}, {2094,11,17}, {2094,11,18}, {2094,11,19}, {2094,11,20}, {2094,11,21}, {2094,11,22}, {2094,11,23}, {2094,11,24}, {2094,11,25}, 
-{2094,11,26}, {2094,11,27}, {2094,11,28}, {2094,11,29}, {2094,11,30}, {2094,12,1}, {2094,12,2}, {2094,12,3}, {2094,12,4}, {2094,12,5}, {2094,12,6}, {2094,12,7}, {2094,12,8}, {2094,12,9}, {2094,12,10}, {2094,12,11}, {2094,12,12}, {2094,12,13}, {2094,12,14}, {2094,12,15}, {2094,12,16}, {2094,12,17}, {2094,12,18}, {2094,12,19}, {2094,12,20}, {2094,12,21}, {2094,12,22}, {2094,12,23}, {2094,12,24}, {2094,12,25}, {2094,12,26}, {2094,12,27}, 
-{2094,12,28}, {2094,12,29}, {2094,12,30}, {2094,12,31}, {2095,1,1}, {2095,1,2}, {2095,1,3}, {2095,1,4}, {2095,1,5}, {2095,1,6}, {2095,1,7}, {2095,1,8}, {2095,1,9}, {2095,1,10}, {2095,1,11}, {2095,1,12}, {2095,1,13}, {2095,1,14}, {2095,1,15}, {2095,1,16}, {2095,1,17}, {2095,1,18}, {2095,1,19}, {2095,1,20}, {2095,1,21}, {2095,1,22}, {2095,1,23}, {2095,1,24}, {2095,1,25}, {2095,1,26}, {2095,1,27}, {2095,1,28}, 
-{2095,1,29}, {2095,1,30}, {2095,1,31}, {2095,2,1}, {2095,2,2}, {2095,2,3}, {2095,2,4}, {2095,2,5}, {2095,2,6}, {2095,2,7}, {2095,2,8}, {2095,2,9}, {2095,2,10}, {2095,2,11}, {2095,2,12}, {2095,2,13}, {2095,2,14}, {2095,2,15}, {2095,2,16}, {2095,2,17}, {2095,2,18}, {2095,2,19}, {2095,2,20}, {2095,2,21}, {2095,2,22}, {2095,2,23}, {2095,2,24}, {2095,2,25}, {2095,2,26}, {2095,2,27}, {2095,2,28}, {2095,3,1}, 
-{2095,3,2}, {2095,3,3}, {2095,3,4}, {2095,3,5}, {2095,3,6}, {2095,3,7}, {2095,3,8}, {2095,3,9}, {2095,3,10}, {2095,3,11}, {2095,3,12}, {2095,3,13}, {2095,3,14}, {2095,3,15}, {2095,3,16}, {2095,3,17}, {2095,3,18}, {2095,3,19}, {2095,3,20}, {2095,3,21}, {2095,3,22}, {2095,3,23}, {2095,3,24}, {2095,3,25}, {2095,3,26}, {2095,3,27}, {2095,3,28}, {2095,3,29}, {2095,3,30}, {2095,3,31}, {2095,4,1}, {2095,4,2}, 
-{2095,4,3}, {2095,4,4}, {2095,4,5}, {2095,4,6}, {2095,4,7}, {2095,4,8}, {2095,4,9}, {2095,4,10}, {2095,4,11}, {2095,4,12}, {2095,4,13}, {2095,4,14}, {2095,4,15}, {2095,4,16}, {2095,4,17}, {2095,4,18}, {2095,4,19}, {2095,4,20}, {2095,4,21}, {2095,4,22}, {2095,4,23}, {2095,4,24}, {2095,4,25}, {2095,4,26}, {2095,4,27}, {2095,4,28}, {2095,4,29}, {2095,4,30}, {2095,5,1}, {2095,5,2}, {2095,5,3}, {2095,5,4}, 
-{2095,5,5}, {2095,5,6}, {2095,5,7}, {2095,5,8}, {2095,5,9}, {2095,5,10}, {2095,5,11}, {2095,5,12}, {2095,5,13}, {2095,5,14}, {2095,5,15}, {2095,5,16}, {2095,5,17}, {2095,5,18}, {2095,5,19}, {2095,5,20}, {2095,5,21}, {2095,5,22}, {2095,5,23}, {2095,5,24}, {2095,5,25}, {2095,5,26}, {2095,5,27}, {2095,5,28}, {2095,5,29}, {2095,5,30}, {2095,5,31}, {2095,6,1}, {2095,6,2}, {2095,6,3}, {2095,6,4}, {2095,6,5}, 
-{2095,6,6}, {2095,6,7}, {2095,6,8}, {2095,6,9}, {2095,6,10}, {2095,6,11}, {2095,6,12}, {2095,6,13}, {2095,6,14}, {2095,6,15}, {2095,6,16}, {2095,6,17}, {2095,6,18}, {2095,6,19}, {2095,6,20}, {2095,6,21}, {2095,6,22}, {2095,6,23}, {2095,6,24}, {2095,6,25}, {2095,6,26}, {2095,6,27}, {2095,6,28}, {2095,6,29}, {2095,6,30}, {2095,7,1}, {2095,7,2}, {2095,7,3}, {2095,7,4}, {2095,7,5}, {2095,7,6}, {2095,7,7}, 
-{2095,7,8}, {2095,7,9}, {2095,7,10}, {2095,7,11}, {2095,7,12}, {2095,7,13}, {2095,7,14}, {2095,7,15}, {2095,7,16}, {2095,7,17}, {2095,7,18}, {2095,7,19}, {2095,7,20}, {2095,7,21}, {2095,7,22}, {2095,7,23}, {2095,7,24}, {2095,7,25}, {2095,7,26}, {2095,7,27}, {2095,7,28}, {2095,7,29}, {2095,7,30}, {2095,7,31}, {2095,8,1}, {2095,8,2}, {2095,8,3}, {2095,8,4}, {2095,8,5}, {2095,8,6}, {2095,8,7}, {2095,8,8}, 
-{2095,8,9}, {2095,8,10}, {2095,8,11}, {2095,8,12}, {2095,8,13}, {2095,8,14}, {2095,8,15}, {2095,8,16}, {2095,8,17}, {2095,8,18}, {2095,8,19}, {2095,8,20}, {2095,8,21}, {2095,8,22}, {2095,8,23}, {2095,8,24}, {2095,8,25}, {2095,8,26}, {2095,8,27}, {2095,8,28}, {2095,8,29}, {2095,8,30}, {2095,8,31}, {2095,9,1}, {2095,9,2}, {2095,9,3}, {2095,9,4}, {2095,9,5}, {2095,9,6}, {2095,9,7}, {2095,9,8}, {2095,9,9}, 
-{2095,9,10}, {2095,9,11}, {2095,9,12}, {2095,9,13}, {2095,9,14}, {2095,9,15}, {2095,9,16}, {2095,9,17}, {2095,9,18}, {2095,9,19}, {2095,9,20}, {2095,9,21}, {2095,9,22}, {2095,9,23}, {2095,9,24}, {2095,9,25}, {2095,9,26}, {2095,9,27}, {2095,9,28}, {2095,9,29}, {2095,9,30}, {2095,10,1}, {2095,10,2}, {2095,10,3}, {2095,10,4}, {2095,10,5}, {2095,10,6}, {2095,10,7}, {2095,10,8}, {2095,10,9}, {2095,10,10}, {2095,10,11}, 
-{2095,10,12}, {2095,10,13}, {2095,10,14}, {2095,10,15}, {2095,10,16}, {2095,10,17}, {2095,10,18}, {2095,10,19}, {2095,10,20}, {2095,10,21}, {2095,10,22}, {2095,10,23}, {2095,10,24}, {2095,10,25}, {2095,10,26}, {2095,10,27}, {2095,10,28}, {2095,10,29}, {2095,10,30}, {2095,10,31}, {2095,11,1}, {2095,11,2}, {2095,11,3}, {2095,11,4}, {2095,11,5}, {2095,11,6}, {2095,11,7}, {2095,11,8}, {2095,11,9}, {2095,11,10}, {2095,11,11}, {2095,11,12}, 
-{2095,11,13}, {2095,11,14}, {2095,11,15}, {2095,11,16}, {2095,11,17}, {2095,11,18}, {2095,11,19}, {2095,11,20}, {2095,11,21}, {2095,11,22}, {2095,11,23}, {2095,11,24}, {2095,11,25}, {2095,11,26}, {2095,11,27}, {2095,11,28}, {2095,11,29}, {2095,11,30}, {2095,12,1}, {2095,12,2}, {2095,12,3}, {2095,12,4}, {2095,12,5}, {2095,12,6}, {2095,12,7}, {2095,12,8}, {2095,12,9}, {2095,12,10}, {2095,12,11}, {2095,12,12}, {2095,12,13}, {2095,12,14}, 
-{2095,12,15}, {2095,12,16}, {2095,12,17}, {2095,12,18}, {2095,12,19}, {2095,12,20}, {2095,12,21}, {2095,12,22}, {2095,12,23}, {2095,12,24}, {2095,12,25}, {2095,12,26}, {2095,12,27}, {2095,12,28}, {2095,12,29}, {2095,12,30}, {2095,12,31}, {2096,1,1}, {2096,1,2}, {2096,1,3}, {2096,1,4}, {2096,1,5}, {2096,1,6}, {2096,1,7}, {2096,1,8}, {2096,1,9}, {2096,1,10}, {2096,1,11}, {2096,1,12}, {2096,1,13}, {2096,1,14}, {2096,1,15}, 
-{2096,1,16}, {2096,1,17}, {2096,1,18}, {2096,1,19}, {2096,1,20}, {2096,1,21}, {2096,1,22}, {2096,1,23}, {2096,1,24}, {2096,1,25}, {2096,1,26}, {2096,1,27}, {2096,1,28}, {2096,1,29}, {2096,1,30}, {2096,1,31}, {2096,2,1}, {2096,2,2}, {2096,2,3}, {2096,2,4}, {2096,2,5}, {2096,2,6}, {2096,2,7}, {2096,2,8}, {2096,2,9}, {2096,2,10}, {2096,2,11}, {2096,2,12}, {2096,2,13}, {2096,2,14}, {2096,2,15}, {2096,2,16}, 
-{2096,2,17}, {2096,2,18}, {2096,2,19}, {2096,2,20}, {2096,2,21}, {2096,2,22}, {2096,2,23}, {2096,2,24}, {2096,2,25}, {2096,2,26}, {2096,2,27}, {2096,2,28}, {2096,2,29}, {2096,3,1}, {2096,3,2}, {2096,3,3}, {2096,3,4}, {2096,3,5}, {2096,3,6}, {2096,3,7}, {2096,3,8}, {2096,3,9}, {2096,3,10}, {2096,3,11}, {2096,3,12}, {2096,3,13}, {2096,3,14}, {2096,3,15}, {2096,3,16}, {2096,3,17}, {2096,3,18}, {2096,3,19}, 
-{2096,3,20}, {2096,3,21}, {2096,3,22}, {2096,3,23}, {2096,3,24}, {2096,3,25}, {2096,3,26}, {2096,3,27}, {2096,3,28}, {2096,3,29}, {2096,3,30}, {2096,3,31}, {2096,4,1}, {2096,4,2}, {2096,4,3}, {2096,4,4}, {2096,4,5}, {2096,4,6}, {2096,4,7}, {2096,4,8}, {2096,4,9}, {2096,4,10}, {2096,4,11}, {2096,4,12}, {2096,4,13}, {2096,4,14}, {2096,4,15}, {2096,4,16}, {2096,4,17}, {2096,4,18}, {2096,4,19}, {2096,4,20}, 
-{2096,4,21}, {2096,4,22}, {2096,4,23}, {2096,4,24}, {2096,4,25}, {2096,4,26}, {2096,4,27}, {2096,4,28}, {2096,4,29}, {2096,4,30}, {2096,5,1}, {2096,5,2}, {2096,5,3}, {2096,5,4}, {2096,5,5}, {2096,5,6}, {2096,5,7}, {2096,5,8}, {2096,5,9}, {2096,5,10}, {2096,5,11}, {2096,5,12}, {2096,5,13}, {2096,5,14}, {2096,5,15}, {2096,5,16}, {2096,5,17}, {2096,5,18}, {2096,5,19}, {2096,5,20}, {2096,5,21}, {2096,5,22}, 
-{2096,5,23}, {2096,5,24}, {2096,5,25}, {2096,5,26}, {2096,5,27}, {2096,5,28}, {2096,5,29}, {2096,5,30}, {2096,5,31}, {2096,6,1}, {2096,6,2}, {2096,6,3}, {2096,6,4}, {2096,6,5}, {2096,6,6}, {2096,6,7}, {2096,6,8}, {2096,6,9}, {2096,6,10}, {2096,6,11}, {2096,6,12}, {2096,6,13}, {2096,6,14}, {2096,6,15}, {2096,6,16}, {2096,6,17}, {2096,6,18}, {2096,6,19}, {2096,6,20}, {2096,6,21}, {2096,6,22}, {2096,6,23}, 
-{2096,6,24}, {2096,6,25}, {2096,6,26}, {2096,6,27}, {2096,6,28}, {2096,6,29}, {2096,6,30}, {2096,7,1}, {2096,7,2}, {2096,7,3}, {2096,7,4}, {2096,7,5}, {2096,7,6}, {2096,7,7}, {2096,7,8}, {2096,7,9}, {2096,7,10}, {2096,7,11}, {2096,7,12}, {2096,7,13}, {2096,7,14}, {2096,7,15}, {2096,7,16}, {2096,7,17}, {2096,7,18}, {2096,7,19}, {2096,7,20}, {2096,7,21}, {2096,7,22}, {2096,7,23}, {2096,7,24}, {2096,7,25}, 
-{2096,7,26}, {2096,7,27}, {2096,7,28}, {2096,7,29}, {2096,7,30}, {2096,7,31}, {2096,8,1}, {2096,8,2}, {2096,8,3}, {2096,8,4}, {2096,8,5}, {2096,8,6}, {2096,8,7}, {2096,8,8}, {2096,8,9}, {2096,8,10}, {2096,8,11}, {2096,8,12}, {2096,8,13}, {2096,8,14}, {2096,8,15}, {2096,8,16}, {2096,8,17}, {2096,8,18}, {2096,8,19}, {2096,8,20}, {2096,8,21}, {2096,8,22}, {2096,8,23}, {2096,8,24}, {2096,8,25}, {2096,8,26}, 
-{2096,8,27}, {2096,8,28}, {2096,8,29}, {2096,8,30}, {2096,8,31}, {2096,9,1}, {2096,9,2}, {2096,9,3}, {2096,9,4}, {2096,9,5}, {2096,9,6}, {2096,9,7}, {2096,9,8}, {2096,9,9}, {2096,9,10}, {2096,9,11}, {2096,9,12}, {2096,9,13}, {2096,9,14}, {2096,9,15}, {2096,9,16}, {2096,9,17}, {2096,9,18}, {2096,9,19}, {2096,9,20}, {2096,9,21}, {2096,9,22}, {2096,9,23}, {2096,9,24}, {2096,9,25}, {2096,9,26}, {2096,9,27}, 
-{2096,9,28}, {2096,9,29}, {2096,9,30}, {2096,10,1}, {2096,10,2}, {2096,10,3}, {2096,10,4}, {2096,10,5}, {2096,10,6}, {2096,10,7}, {2096,10,8}, {2096,10,9}, {2096,10,10}, {2096,10,11}, {2096,10,12}, {2096,10,13}, {2096,10,14}, {2096,10,15}, {2096,10,16}, {2096,10,17}, {2096,10,18}, {2096,10,19}, {2096,10,20}, {2096,10,21}, {2096,10,22}, {2096,10,23}, {2096,10,24}, {2096,10,25}, {2096,10,26}, {2096,10,27}, {2096,10,28}, {2096,10,29}, 
-{2096,10,30}, {2096,10,31}, {2096,11,1}, {2096,11,2}, {2096,11,3}, {2096,11,4}, {2096,11,5}, {2096,11,6}, {2096,11,7}, {2096,11,8}, {2096,11,9}, {2096,11,10}, {2096,11,11}, {2096,11,12}, {2096,11,13}, {2096,11,14}, {2096,11,15}, {2096,11,16}, {2096,11,17}, {2096,11,18}, {2096,11,19}, {2096,11,20}, {2096,11,21}, {2096,11,22}, {2096,11,23}, {2096,11,24}, {2096,11,25}, {2096,11,26}, {2096,11,27}, {2096,11,28}, {2096,11,29}, {2096,11,30}, 
-{2096,12,1}, {2096,12,2}, {2096,12,3}, {2096,12,4}, {2096,12,5}, {2096,12,6}, {2096,12,7}, {2096,12,8}, {2096,12,9}, {2096,12,10}, {2096,12,11}, {2096,12,12}, {2096,12,13}, {2096,12,14}, {2096,12,15}, {2096,12,16}, {2096,12,17}, {2096,12,18}, {2096,12,19}, {2096,12,20}, {2096,12,21}, {2096,12,22}, {2096,12,23}, {2096,12,24}, {2096,12,25}, {2096,12,26}, {2096,12,27}, {2096,12,28}, {2096,12,29}, {2096,12,30}, {2096,12,31}, {2097,1,1}, 
-{2097,1,2}, {2097,1,3}, {2097,1,4}, {2097,1,5}, {2097,1,6}, {2097,1,7}, {2097,1,8}, {2097,1,9}, {2097,1,10}, {2097,1,11}, {2097,1,12}, {2097,1,13}, {2097,1,14}, {2097,1,15}, {2097,1,16}, {2097,1,17}, {2097,1,18}, {2097,1,19}, {2097,1,20}, {2097,1,21}, {2097,1,22}, {2097,1,23}, {2097,1,24}, {2097,1,25}, {2097,1,26}, {2097,1,27}, {2097,1,28}, {2097,1,29}, {2097,1,30}, {2097,1,31}, {2097,2,1}, {2097,2,2}, 
-{2097,2,3}, {2097,2,4}, {2097,2,5}, {2097,2,6}, {2097,2,7}, {2097,2,8}, {2097,2,9}, {2097,2,10}, {2097,2,11}, {2097,2,12}, {2097,2,13}, {2097,2,14}, {2097,2,15}, {2097,2,16}, {2097,2,17}, {2097,2,18}, {2097,2,19}, {2097,2,20}, {2097,2,21}, {2097,2,22}, {2097,2,23}, {2097,2,24}, {2097,2,25}, {2097,2,26}, {2097,2,27}, {2097,2,28}, {2097,3,1}, {2097,3,2}, {2097,3,3}, {2097,3,4}, {2097,3,5}, {2097,3,6}, 
-{2097,3,7}, {2097,3,8}, {2097,3,9}, {2097,3,10}, {2097,3,11}, {2097,3,12}, {2097,3,13}, {2097,3,14}, {2097,3,15}, {2097,3,16}, {2097,3,17}, {2097,3,18}, {2097,3,19}, {2097,3,20}, {2097,3,21}, {2097,3,22}, {2097,3,23}, {2097,3,24}, {2097,3,25}, {2097,3,26}, {2097,3,27}, {2097,3,28}, {2097,3,29}, {2097,3,30}, {2097,3,31}, {2097,4,1}, {2097,4,2}, {2097,4,3}, {2097,4,4}, {2097,4,5}, {2097,4,6}, {2097,4,7}, 
-{2097,4,8}, {2097,4,9}, {2097,4,10}, {2097,4,11}, {2097,4,12}, {2097,4,13}, {2097,4,14}, {2097,4,15}, {2097,4,16}, {2097,4,17}, {2097,4,18}, {2097,4,19}, {2097,4,20}, {2097,4,21}, {2097,4,22}, {2097,4,23}, {2097,4,24}, {2097,4,25}, {2097,4,26}, {2097,4,27}, {2097,4,28}, {2097,4,29}, {2097,4,30}, {2097,5,1}, {2097,5,2}, {2097,5,3}, {2097,5,4}, {2097,5,5}, {2097,5,6}, {2097,5,7}, {2097,5,8}, {2097,5,9}, 
-{2097,5,10}, {2097,5,11}, {2097,5,12}, {2097,5,13}, {2097,5,14}, {2097,5,15}, {2097,5,16}, {2097,5,17}, {2097,5,18}, {2097,5,19}, {2097,5,20}, {2097,5,21}, {2097,5,22}, {2097,5,23}, {2097,5,24}, {2097,5,25}, {2097,5,26}, {2097,5,27}, {2097,5,28}, {2097,5,29}, {2097,5,30}, {2097,5,31}, {2097,6,1}, {2097,6,2}, {2097,6,3}, {2097,6,4}, {2097,6,5}, {2097,6,6}, {2097,6,7}, {2097,6,8}, {2097,6,9}, {2097,6,10}, 
-{2097,6,11}, {2097,6,12}, {2097,6,13}, {2097,6,14}, {2097,6,15}, {2097,6,16}, {2097,6,17}, {2097,6,18}, {2097,6,19}, {2097,6,20}, {2097,6,21}, {2097,6,22}, {2097,6,23}, {2097,6,24}, {2097,6,25}, {2097,6,26}, {2097,6,27}, {2097,6,28}, {2097,6,29}, {2097,6,30}, {2097,7,1}, {2097,7,2}, {2097,7,3}, {2097,7,4}, {2097,7,5}, {2097,7,6}, {2097,7,7}, {2097,7,8}, {2097,7,9}, {2097,7,10}, {2097,7,11}, {2097,7,12}, 
-{2097,7,13}, {2097,7,14}, {2097,7,15}, {2097,7,16}, {2097,7,17}, {2097,7,18}, {2097,7,19}, {2097,7,20}, {2097,7,21}, {2097,7,22}, {2097,7,23}, {2097,7,24}, {2097,7,25}, {2097,7,26}, {2097,7,27}, {2097,7,28}, {2097,7,29}, {2097,7,30}, {2097,7,31}, {2097,8,1}, {2097,8,2}, {2097,8,3}, {2097,8,4}, {2097,8,5}, {2097,8,6}, {2097,8,7}, {2097,8,8}, {2097,8,9}, {2097,8,10}, {2097,8,11}, {2097,8,12}, {2097,8,13}, 
-{2097,8,14}, {2097,8,15}, {2097,8,16}, {2097,8,17}, {2097,8,18}, {2097,8,19}, {2097,8,20}, {2097,8,21}, {2097,8,22}, {2097,8,23}, {2097,8,24}, {2097,8,25}, {2097,8,26}, {2097,8,27}, {2097,8,28}, {2097,8,29}, {2097,8,30}, {2097,8,31}, {2097,9,1}, {2097,9,2}, {2097,9,3}, {2097,9,4}, {2097,9,5}, {2097,9,6}, {2097,9,7}, {2097,9,8}, {2097,9,9}, {2097,9,10}, {2097,9,11}, {2097,9,12}, {2097,9,13}, {2097,9,14}, 
-{2097,9,15}, {2097,9,16}, {2097,9,17}, {2097,9,18}, {2097,9,19}, {2097,9,20}, {2097,9,21}, {2097,9,22}, {2097,9,23}, {2097,9,24}, {2097,9,25}, {2097,9,26}, {2097,9,27}, {2097,9,28}, {2097,9,29}, {2097,9,30}, {2097,10,1}, {2097,10,2}, {2097,10,3}, {2097,10,4}, {2097,10,5}, {2097,10,6}, {2097,10,7}, {2097,10,8}, {2097,10,9}, {2097,10,10}, {2097,10,11}, {2097,10,12}, {2097,10,13}, {2097,10,14}, {2097,10,15}, {2097,10,16}, 
-{2097,10,17}, {2097,10,18}, {2097,10,19}, {2097,10,20}, {2097,10,21}, {2097,10,22}, {2097,10,23}, {2097,10,24}, {2097,10,25}, {2097,10,26}, {2097,10,27}, {2097,10,28}, {2097,10,29}, {2097,10,30}, {2097,10,31}, {2097,11,1}, {2097,11,2}, {2097,11,3}, {2097,11,4}, {2097,11,5}, {2097,11,6}, {2097,11,7}, {2097,11,8}, {2097,11,9}, {2097,11,10}, {2097,11,11}, {2097,11,12}, {2097,11,13}, {2097,11,14}, {2097,11,15}, {2097,11,16}, {2097,11,17}, 
-{2097,11,18}, {2097,11,19}, {2097,11,20}, {2097,11,21}, {2097,11,22}, {2097,11,23}, {2097,11,24}, {2097,11,25}, {2097,11,26}, {2097,11,27}, {2097,11,28}, {2097,11,29}, {2097,11,30}, {2097,12,1}, {2097,12,2}, {2097,12,3}, {2097,12,4}, {2097,12,5}, {2097,12,6}, {2097,12,7}, {2097,12,8}, {2097,12,9}, {2097,12,10}, {2097,12,11}, {2097,12,12}, {2097,12,13}, {2097,12,14}, {2097,12,15}, {2097,12,16}, {2097,12,17}, {2097,12,18}, {2097,12,19}, 
-{2097,12,20}, {2097,12,21}, {2097,12,22}, {2097,12,23}, {2097,12,24}, {2097,12,25}, {2097,12,26}, {2097,12,27}, {2097,12,28}, {2097,12,29}, {2097,12,30}, {2097,12,31}, {2098,1,1}, {2098,1,2}, {2098,1,3}, {2098,1,4}, {2098,1,5}, {2098,1,6}, {2098,1,7}, {2098,1,8}, {2098,1,9}, {2098,1,10}, {2098,1,11}, {2098,1,12}, {2098,1,13}, {2098,1,14}, {2098,1,15}, {2098,1,16}, {2098,1,17}, {2098,1,18}, {2098,1,19}, {2098,1,20}, 
-{2098,1,21}, {2098,1,22}, {2098,1,23}, {2098,1,24}, {2098,1,25}, {2098,1,26}, {2098,1,27}, {2098,1,28}, {2098,1,29}, {2098,1,30}, {2098,1,31}, {2098,2,1}, {2098,2,2}, {2098,2,3}, {2098,2,4}, {2098,2,5}, {2098,2,6}, {2098,2,7}, {2098,2,8}, {2098,2,9}, {2098,2,10}, {2098,2,11}, {2098,2,12}, {2098,2,13}, {2098,2,14}, {2098,2,15}, {2098,2,16}, {2098,2,17}, {2098,2,18}, {2098,2,19}, {2098,2,20}, {2098,2,21}, 
-{2098,2,22}, {2098,2,23}, {2098,2,24}, {2098,2,25}, {2098,2,26}, {2098,2,27}, {2098,2,28}, {2098,3,1}, {2098,3,2}, {2098,3,3}, {2098,3,4}, {2098,3,5}, {2098,3,6}, {2098,3,7}, {2098,3,8}, {2098,3,9}, {2098,3,10}, {2098,3,11}, {2098,3,12}, {2098,3,13}, {2098,3,14}, {2098,3,15}, {2098,3,16}, {2098,3,17}, {2098,3,18}, {2098,3,19}, {2098,3,20}, {2098,3,21}, {2098,3,22}, {2098,3,23}, {2098,3,24}, {2098,3,25}, 
-{2098,3,26}, {2098,3,27}, {2098,3,28}, {2098,3,29}, {2098,3,30}, {2098,3,31}, {2098,4,1}, {2098,4,2}, {2098,4,3}, {2098,4,4}, {2098,4,5}, {2098,4,6}, {2098,4,7}, {2098,4,8}, {2098,4,9}, {2098,4,10}, {2098,4,11}, {2098,4,12}, {2098,4,13}, {2098,4,14}, {2098,4,15}, {2098,4,16}, {2098,4,17}, {2098,4,18}, {2098,4,19}, {2098,4,20}, {2098,4,21}, {2098,4,22}, {2098,4,23}, {2098,4,24}, {2098,4,25}, {2098,4,26}, 
-{2098,4,27}, {2098,4,28}, {2098,4,29}, {2098,4,30}, {2098,5,1}, {2098,5,2}, {2098,5,3}, {2098,5,4}, {2098,5,5}, {2098,5,6}, {2098,5,7}, {2098,5,8}, {2098,5,9}, {2098,5,10}, {2098,5,11}, {2098,5,12}, {2098,5,13}, {2098,5,14}, {2098,5,15}, {2098,5,16}, {2098,5,17}, {2098,5,18}, {2098,5,19}, {2098,5,20}, {2098,5,21}, {2098,5,22}, {2098,5,23}, {2098,5,24}, {2098,5,25}, {2098,5,26}, {2098,5,27}, {2098,5,28}, 
-{2098,5,29}, {2098,5,30}, {2098,5,31}, {2098,6,1}, {2098,6,2}, {2098,6,3}, {2098,6,4}, {2098,6,5}, {2098,6,6}, {2098,6,7}, {2098,6,8}, {2098,6,9}, {2098,6,10}, {2098,6,11}, {2098,6,12}, {2098,6,13}, {2098,6,14}, {2098,6,15}, {2098,6,16}, {2098,6,17}, {2098,6,18}, {2098,6,19}, {2098,6,20}, {2098,6,21}, {2098,6,22}, {2098,6,23}, {2098,6,24}, {2098,6,25}, {2098,6,26}, {2098,6,27}, {2098,6,28}, {2098,6,29}, 
-{2098,6,30}, {2098,7,1}, {2098,7,2}, {2098,7,3}, {2098,7,4}, {2098,7,5}, {2098,7,6}, {2098,7,7}, {2098,7,8}, {2098,7,9}, {2098,7,10}, {2098,7,11}, {2098,7,12}, {2098,7,13}, {2098,7,14}, {2098,7,15}, {2098,7,16}, {2098,7,17}, {2098,7,18}, {2098,7,19}, {2098,7,20}, {2098,7,21}, {2098,7,22}, {2098,7,23}, {2098,7,24}, {2098,7,25}, {2098,7,26}, {2098,7,27}, {2098,7,28}, {2098,7,29}, {2098,7,30}, {2098,7,31}, 
-{2098,8,1}, {2098,8,2}, {2098,8,3}, {2098,8,4}, {2098,8,5}, {2098,8,6}, {2098,8,7}, {2098,8,8}, {2098,8,9}, {2098,8,10}, {2098,8,11}, {2098,8,12}, {2098,8,13}, {2098,8,14}, {2098,8,15}, {2098,8,16}, {2098,8,17}, {2098,8,18}, {2098,8,19}, {2098,8,20}, {2098,8,21}, {2098,8,22}, {2098,8,23}, {2098,8,24}, {2098,8,25}, {2098,8,26}, {2098,8,27}, {2098,8,28}, {2098,8,29}, {2098,8,30}, {2098,8,31}, {2098,9,1}, 
-{2098,9,2}, {2098,9,3}, {2098,9,4}, {2098,9,5}, {2098,9,6}, {2098,9,7}, {2098,9,8}, {2098,9,9}, {2098,9,10}, {2098,9,11}, {2098,9,12}, {2098,9,13}, {2098,9,14}, {2098,9,15}, {2098,9,16}, {2098,9,17}, {2098,9,18}, {2098,9,19}, {2098,9,20}, {2098,9,21}, {2098,9,22}, {2098,9,23}, {2098,9,24}, {2098,9,25}, {2098,9,26}, {2098,9,27}, {2098,9,28}, {2098,9,29}, {2098,9,30}, {2098,10,1}, {2098,10,2}, {2098,10,3}, 
-{2098,10,4}, {2098,10,5}, {2098,10,6}, {2098,10,7}, {2098,10,8}, {2098,10,9}, {2098,10,10}, {2098,10,11}, {2098,10,12}, {2098,10,13}, {2098,10,14}, {2098,10,15}, {2098,10,16}, {2098,10,17}, {2098,10,18}, {2098,10,19}, {2098,10,20}, {2098,10,21}, {2098,10,22}, {2098,10,23}, {2098,10,24}, {2098,10,25}, {2098,10,26}, {2098,10,27}, {2098,10,28}, {2098,10,29}, {2098,10,30}, {2098,10,31}, {2098,11,1}, {2098,11,2}, {2098,11,3}, {2098,11,4}, 
-{2098,11,5}, {2098,11,6}, {2098,11,7}, {2098,11,8}, {2098,11,9}, {2098,11,10}, {2098,11,11}, {2098,11,12}, {2098,11,13}, {2098,11,14}, {2098,11,15}, {2098,11,16}, {2098,11,17}, {2098,11,18}, {2098,11,19}, {2098,11,20}, {2098,11,21}, {2098,11,22}, {2098,11,23}, {2098,11,24}, {2098,11,25}, {2098,11,26}, {2098,11,27}, {2098,11,28}, {2098,11,29}, {2098,11,30}, {2098,12,1}, {2098,12,2}, {2098,12,3}, {2098,12,4}, {2098,12,5}, {2098,12,6}, 
-{2098,12,7}, {2098,12,8}, {2098,12,9}, {2098,12,10}, {2098,12,11}, {2098,12,12}, {2098,12,13}, {2098,12,14}, {2098,12,15}, {2098,12,16}, {2098,12,17}, {2098,12,18}, {2098,12,19}, {2098,12,20}, {2098,12,21}, {2098,12,22}, {2098,12,23}, {2098,12,24}, {2098,12,25}, {2098,12,26}, {2098,12,27}, {2098,12,28}, {2098,12,29}, {2098,12,30}, {2098,12,31}, {2099,1,1}, {2099,1,2}, {2099,1,3}, {2099,1,4}, {2099,1,5}, {2099,1,6}, {2099,1,7}, 
-{2099,1,8}, {2099,1,9}, {2099,1,10}, {2099,1,11}, {2099,1,12}, {2099,1,13}, {2099,1,14}, {2099,1,15}, {2099,1,16}, {2099,1,17}, {2099,1,18}, {2099,1,19}, {2099,1,20}, {2099,1,21}, {2099,1,22}, {2099,1,23}, {2099,1,24}, {2099,1,25}, {2099,1,26}, {2099,1,27}, {2099,1,28}, {2099,1,29}, {2099,1,30}, {2099,1,31}, {2099,2,1}, {2099,2,2}, {2099,2,3}, {2099,2,4}, {2099,2,5}, {2099,2,6}, {2099,2,7}, {2099,2,8}, 
-{2099,2,9}, {2099,2,10}, {2099,2,11}, {2099,2,12}, {2099,2,13}, {2099,2,14}, {2099,2,15}, {2099,2,16}, {2099,2,17}, {2099,2,18}, {2099,2,19}, {2099,2,20}, {2099,2,21}, {2099,2,22}, {2099,2,23}, {2099,2,24}, {2099,2,25}, {2099,2,26}, {2099,2,27}, {2099,2,28}, {2099,3,1}, {2099,3,2}, {2099,3,3}, {2099,3,4}, {2099,3,5}, {2099,3,6}, {2099,3,7}, {2099,3,8}, {2099,3,9}, {2099,3,10}, {2099,3,11}, {2099,3,12}, 
-{2099,3,13}, {2099,3,14}, {2099,3,15}, {2099,3,16}, {2099,3,17}, {2099,3,18}, {2099,3,19}, {2099,3,20}, {2099,3,21}, {2099,3,22}, {2099,3,23}, {2099,3,24}, {2099,3,25}, {2099,3,26}, {2099,3,27}, {2099,3,28}, {2099,3,29}, {2099,3,30}, {2099,3,31}, {2099,4,1}, {2099,4,2}, {2099,4,3}, {2099,4,4}, {2099,4,5}, {2099,4,6}, {2099,4,7}, {2099,4,8}, {2099,4,9}, {2099,4,10}, {2099,4,11}, {2099,4,12}, {2099,4,13}, 
-{2099,4,14}, {2099,4,15}, {2099,4,16}, {2099,4,17}, {2099,4,18}, {2099,4,19}, {2099,4,20}, {2099,4,21}, {2099,4,22}, {2099,4,23}, {2099,4,24}, {2099,4,25}, {2099,4,26}, {2099,4,27}, {2099,4,28}, {2099,4,29}, {2099,4,30}, {2099,5,1}, {2099,5,2}, {2099,5,3}, {2099,5,4}, {2099,5,5}, {2099,5,6}, {2099,5,7}, {2099,5,8}, {2099,5,9}, {2099,5,10}, {2099,5,11}, {2099,5,12}, {2099,5,13}, {2099,5,14}, {2099,5,15}, 
-{2099,5,16}, {2099,5,17}, {2099,5,18}, {2099,5,19}, {2099,5,20}, {2099,5,21}, {2099,5,22}, {2099,5,23}, {2099,5,24}, {2099,5,25}, {2099,5,26}, {2099,5,27}, {2099,5,28}, {2099,5,29}, {2099,5,30}, {2099,5,31}, {2099,6,1}, {2099,6,2}, {2099,6,3}, {2099,6,4}, {2099,6,5}, {2099,6,6}, {2099,6,7}, {2099,6,8}, {2099,6,9}, {2099,6,10}, {2099,6,11}, {2099,6,12}, {2099,6,13}, {2099,6,14}, {2099,6,15}, {2099,6,16}, 
-{2099,6,17}, {2099,6,18}, {2099,6,19}, {2099,6,20}, {2099,6,21}, {2099,6,22}, {2099,6,23}, {2099,6,24}, {2099,6,25}, {2099,6,26}, {2099,6,27}, {2099,6,28}, {2099,6,29}, {2099,6,30}, {2099,7,1}, {2099,7,2}, {2099,7,3}, {2099,7,4}, {2099,7,5}, {2099,7,6}, {2099,7,7}, {2099,7,8}, {2099,7,9}, {2099,7,10}, {2099,7,11}, {2099,7,12}, {2099,7,13}, {2099,7,14}, {2099,7,15}, {2099,7,16}, {2099,7,17}, {2099,7,18}, 
-{2099,7,19}, {2099,7,20}, {2099,7,21}, {2099,7,22}, {2099,7,23}, {2099,7,24}, {2099,7,25}, {2099,7,26}, {2099,7,27}, {2099,7,28}, {2099,7,29}, {2099,7,30}, {2099,7,31}, {2099,8,1}, {2099,8,2}, {2099,8,3}, {2099,8,4}, {2099,8,5}, {2099,8,6}, {2099,8,7}, {2099,8,8}, {2099,8,9}, {2099,8,10}, {2099,8,11}, {2099,8,12}, {2099,8,13}, {2099,8,14}, {2099,8,15}, {2099,8,16}, {2099,8,17}, {2099,8,18}, {2099,8,19}, 
-{2099,8,20}, {2099,8,21}, {2099,8,22}, {2099,8,23}, {2099,8,24}, {2099,8,25}, {2099,8,26}, {2099,8,27}, {2099,8,28}, {2099,8,29}, {2099,8,30}, {2099,8,31}, {2099,9,1}, {2099,9,2}, {2099,9,3}, {2099,9,4}, {2099,9,5}, {2099,9,6}, {2099,9,7}, {2099,9,8}, {2099,9,9}, {2099,9,10}, {2099,9,11}, {2099,9,12}, {2099,9,13}, {2099,9,14}, {2099,9,15}, {2099,9,16}, {2099,9,17}, {2099,9,18}, {2099,9,19}, {2099,9,20}, 
-{2099,9,21}, {2099,9,22}, {2099,9,23}, {2099,9,24}, {2099,9,25}, {2099,9,26}, {2099,9,27}, {2099,9,28}, {2099,9,29}, {2099,9,30}, {2099,10,1}, {2099,10,2}, {2099,10,3}, {2099,10,4}, {2099,10,5}, {2099,10,6}, {2099,10,7}, {2099,10,8}, {2099,10,9}, {2099,10,10}, {2099,10,11}, {2099,10,12}, {2099,10,13}, {2099,10,14}, {2099,10,15}, {2099,10,16}, {2099,10,17}, {2099,10,18}, {2099,10,19}, {2099,10,20}, {2099,10,21}, {2099,10,22}, 
-{2099,10,23}, {2099,10,24}, {2099,10,25}, {2099,10,26}, {2099,10,27}, {2099,10,28}, {2099,10,29}, {2099,10,30}, {2099,10,31}, {2099,11,1}, {2099,11,2}, {2099,11,3}, {2099,11,4}, {2099,11,5}, {2099,11,6}, {2099,11,7}, {2099,11,8}, {2099,11,9}, {2099,11,10}, {2099,11,11}, {2099,11,12}, {2099,11,13}, {2099,11,14}, {2099,11,15}, {2099,11,16}, {2099,11,17}, {2099,11,18}, {2099,11,19}, {2099,11,20}, {2099,11,21}, {2099,11,22}, {2099,11,23}, 
-{2099,11,24}, {2099,11,25}, {2099,11,26}, {2099,11,27}, {2099,11,28}, {2099,11,29}, {2099,11,30}, {2099,12,1}, {2099,12,2}, {2099,12,3}, {2099,12,4}, {2099,12,5}, {2099,12,6}, {2099,12,7}, {2099,12,8}, {2099,12,9}, {2099,12,10}, {2099,12,11}, {2099,12,12}, {2099,12,13}, {2099,12,14}, {2099,12,15}, {2099,12,16}, {2099,12,17}, {2099,12,18}, {2099,12,19}, {2099,12,20}, {2099,12,21}, {2099,12,22}, {2099,12,23}, {2099,12,24}, {2099,12,25}, 
-{2099,12,26}, {2099,12,27}, {2099,12,28}, {2099,12,29}, {2099,12,30}, {2099,12,31}, 
\ No newline at end of file
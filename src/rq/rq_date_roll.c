@@ -39,9 +39,10 @@ rq_date_roll_is_good_date(
         for (i = 0; i < num_cals && good_date; i++)
         {
             const rq_calendar_t cal = cals[i];
-            good_date = !rq_calendar_is_weekend(cal, date) && 
-                (date_roll_convention == RQ_DATE_ROLL_NO_ADJUSTMENT ||
-                 !rq_calendar_is_holiday(cal, date));
+            if (date_roll_convention == RQ_DATE_ROLL_NO_ADJUSTMENT)
+                good_date = !rq_calendar_is_weekend(cal, date);
+            else
+                good_date = rq_calendar_is_good_date(cal, date);
         }
     }
     else
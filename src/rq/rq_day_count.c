@@ -28,18 +28,20 @@
 
 static rq_calendar_t rq_day_count_bus_252_calendar;
 
-/* Set the calendar to be used for BUS_252 daycount calculation. */
+/* Set the calendar to be used for BUS_252 daycount calculation when
+   the caller doesn't give one. */
 RQ_EXPORT void
 rq_day_count_set_bus_252_calendar(rq_calendar_t cal)
 {
     rq_day_count_bus_252_calendar = cal;
 }
 
-static double rq_day_count_bus_252(rq_date start_date, rq_date end_date)
+static double rq_day_count_bus_252(const rq_calendar_t given_calendar, rq_date start_date, rq_date end_date)
 {
+    rq_calendar_t calendar = (given_calendar ? given_calendar : rq_day_count_bus_252_calendar);
     double days_in_period;
-    if(rq_day_count_bus_252_calendar)
-        days_in_period = rq_calendar_businessday_count(rq_day_count_bus_252_calendar, start_date+1, end_date);
+    if(calendar)
+        days_in_period = rq_calendar_businessday_count(calendar, start_date+1, end_date);
     else // If no calendar set then just calculate workdays difference.
         days_in_period = rq_date_weekday_diff(start_date, end_date);
     return days_in_period;
@@ -52,13 +54,24 @@ static double rq_day_count_bus_252(rq_date start_date, rq_date end_date)
 /* ACTUAL_365    as YEARFRAC(d1,d2,3) */
 /* E30_360       as YEARFRAC(d1,d2,4) */
 
-/* Tweaked for performance. */
 RQ_EXPORT double
 rq_day_count_get_year_fraction(
     enum rq_day_count_convention day_count_convention,
     rq_date start_date,
     rq_date end_date
     )
+{
+    return rq_day_count_get_year_fraction_calendar(day_count_convention, start_date, end_date, NULL);
+}
+
+/* Tweaked for performance. */
+RQ_EXPORT double
+rq_day_count_get_year_fraction_calendar(
+    enum rq_day_count_convention day_count_convention,
+    rq_date start_date,
+    rq_date end_date,
+    const rq_calendar_t calendar
+    )
 {
     double days_in_period = end_date - start_date;
     double days_in_year;
@@ -74,10 +87,11 @@ rq_day_count_get_year_fraction(
         {
 			short start_day_of_month, start_month, start_year;
 			short end_day_of_month, end_month, end_year;
-            int num_months = rq_date_month_diff(start_date, end_date);
+            int num_months;
 
             rq_date_to_dmy(start_date, &start_day_of_month, &start_month, &start_year);
             rq_date_to_dmy(end_date, &end_day_of_month, &end_month, &end_year);
+            num_months = (end_year - start_year) * 12 + end_month - start_month;
 
             /* All months are assumed to have 30 days in them. 
                16-jun-2000 - 2-mar-2001
@@ -242,7 +256,7 @@ rq_day_count_get_year_fraction(
         /* Brazilian Real bus days / 252. */
         case RQ_DAY_COUNT_BUS_252:
             days_in_year = 252.0;
-            days_in_period = rq_day_count_bus_252(start_date, end_date);
+            days_in_period = rq_day_count_bus_252(calendar, start_date, end_date);
             break;
 
         case RQ_DAY_COUNT_ACTUAL_365_ACTUAL:
@@ -256,6 +270,79 @@ rq_day_count_get_year_fraction(
     return days_in_period / days_in_year;
 }
 
+RQ_EXPORT void
+rq_day_count_get_year_fractions(
+    enum rq_day_count_convention day_count_convention,
+    const rq_date * RQ_RESTRICT start_dates,
+    const rq_date * RQ_RESTRICT end_dates,
+    double * RQ_RESTRICT year_fractions,
+    unsigned long num_dates
+    )
+{
+    unsigned long i;
+
+    /* The actual/fixed conventions are a subtract and a divide per
+       element, which the compiler can vectorize. The 30/360 ones do
+       the day/month/year split inline with the end-of-month rules
+       written as arithmetic rather than branches. Everything else
+       goes through rq_day_count_get_year_fraction(). */
+    switch (day_count_convention)
+    {
+        case RQ_DAY_COUNT_ACTUAL_360:
+            for (i = 0; i < num_dates; i++)
+                year_fractions[i] = (double)(end_dates[i] - start_dates[i]) / 360.0;
+            break;
+
+        case RQ_DAY_COUNT_ACTUAL_365:
+        case RQ_DAY_COUNT_ACTUAL_365_FIXED:
+            for (i = 0; i < num_dates; i++)
+                year_fractions[i] = (double)(end_dates[i] - start_dates[i]) / 365.0;
+            break;
+
+        case RQ_DAY_COUNT_ACTUAL_365_25:
+            for (i = 0; i < num_dates; i++)
+                year_fractions[i] = (double)(end_dates[i] - start_dates[i]) / 365.25;
+            break;
+
+        case RQ_DAY_COUNT_30_360:
+        case RQ_DAY_COUNT_E30_360:
+        {
+            int isda = (day_count_convention == RQ_DAY_COUNT_30_360);
+
+            for (i = 0; i < num_dates; i++)
+            {
+                short sd, sm, sy;
+                short ed, em, ey;
+                int start_adj;
+                int end_adj;
+
+                rq_date_to_dmy(start_dates[i], &sd, &sm, &sy);
+                rq_date_to_dmy(end_dates[i], &ed, &em, &ey);
+
+                /* ISDA moves a 31st end date back only if the start
+                   date was the 30th or 31st */
+                start_adj = (isda ? sd > 29 : sd == 31);
+                end_adj = (ed == 31) & (isda ? start_adj : 1);
+                sd = (short)(start_adj ? 30 : sd);
+                ed = (short)(ed - end_adj);
+
+                year_fractions[i] = 
+                    (double)(((ey - sy) * 12 + em - sm) * 30 + ed - sd) / 360.0;
+            }
+        }
+        break;
+
+        default:
+            for (i = 0; i < num_dates; i++)
+                year_fractions[i] = rq_day_count_get_year_fraction(
+                    day_count_convention, 
+                    start_dates[i], 
+                    end_dates[i]
+                    );
+            break;
+    }
+}
+
 // returns n+f/d
 RQ_EXPORT double
 rq_day_count_get_nfd(
@@ -315,10 +402,11 @@ rq_day_count_get_year_fraction_nfd(
         {
 			short start_day_of_month, start_month, start_year;
 			short end_day_of_month, end_month, end_year;
-            int num_months = rq_date_month_diff(start_date, end_date);
+            int num_months;
 
             rq_date_to_dmy(start_date, &start_day_of_month, &start_month, &start_year);
             rq_date_to_dmy(end_date, &end_day_of_month, &end_month, &end_year);
+            num_months = (end_year - start_year) * 12 + end_month - start_month;
 
             /* All months are assumed to have 30 days in them. 
                16-jun-2000 - 2-mar-2001
@@ -480,7 +568,7 @@ rq_day_count_get_year_fraction_nfd(
         /* Brazilian Real bus days / 252. */
         case RQ_DAY_COUNT_BUS_252:
             days_in_year = 252.0;
-            days_in_period = rq_day_count_bus_252(start_date, end_date);
+            days_in_period = rq_day_count_bus_252(NULL, start_date, end_date);
             break;
 
         case RQ_DAY_COUNT_ACTUAL_365_ACTUAL:
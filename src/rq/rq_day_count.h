@@ -43,10 +43,24 @@ extern "C" {
 #endif
 #endif
 
-/* Set the calendar used for bus 252 day count calculation. */
+/** Set the calendar used for the business day conventions (BUS/252)
+ * when no calendar is given, as by rq_day_count_get_year_fraction().
+ * Without one, weekdays are counted.
+ *
+ * This is a process wide setting, so it should be made before any
+ * threads are started. A curve's own calendar
+ * (rq_yield_curve_set_day_count_calendar()) takes precedence.
+ */
 RQ_EXPORT void
 rq_day_count_set_bus_252_calendar(rq_calendar_t cal);
 
+/** Calculate the year fraction between two dates.
+ *
+ * The business day conventions (BUS/252) count the good dates in the
+ * calendar set with rq_day_count_set_bus_252_calendar(), or weekdays
+ * if none was set. Use rq_day_count_get_year_fraction_calendar() to
+ * count the good dates in another calendar.
+ */
 RQ_EXPORT double
 rq_day_count_get_year_fraction(
     enum rq_day_count_convention day_count_convention,
@@ -54,6 +68,34 @@ rq_day_count_get_year_fraction(
     rq_date end_date
     );
 
+/** Calculate the year fraction between two dates, counting business
+ * days in the calendar for the business day conventions (BUS/252).
+ * The calendar may be NULL, in which case it is as for
+ * rq_day_count_get_year_fraction().
+ */
+RQ_EXPORT double
+rq_day_count_get_year_fraction_calendar(
+    enum rq_day_count_convention day_count_convention,
+    rq_date start_date,
+    rq_date end_date,
+    const rq_calendar_t calendar
+    );
+
+/** Calculate the year fraction for each pair of start and end dates.
+ *
+ * The results are the same as calling
+ * rq_day_count_get_year_fraction() on each pair, but the common
+ * conventions are computed in tight loops over the arrays.
+ */
+RQ_EXPORT void
+rq_day_count_get_year_fractions(
+    enum rq_day_count_convention day_count_convention,
+    const rq_date * RQ_RESTRICT start_dates,
+    const rq_date * RQ_RESTRICT end_dates,
+    double * RQ_RESTRICT year_fractions, /**< the output, num_dates long */
+    unsigned long num_dates
+    );
+
 // returns n+f/d
 RQ_EXPORT double
 rq_day_count_get_nfd(
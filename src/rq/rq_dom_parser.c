@@ -50,7 +50,7 @@ dom_parser_cb(
         case RQ_XML_PARSER_PARSE_EVENT_TYPE_ENTERING_ELEMENT:
         {
             struct rq_xml_node *n = rq_xml_node_alloc(RQ_XML_NODE_TYPE_ELEMENT);
-            n->node.el.tag = strdup(p1);
+            n->node.el.tag = RQ_STRDUP(p1);
             if (dom_parser->cur_element)
             {
                 rq_xml_node_add_child(dom_parser->cur_element, n);
@@ -107,7 +107,7 @@ rq_dom_parser_parse_stream(rq_stream_t stream)
 {
     rq_xml_parser_t parser = rq_xml_parser_alloc();
 
-    struct rq_dom_parser *dom_parser = (struct rq_dom_parser *)calloc(1, sizeof(struct rq_dom_parser));
+    struct rq_dom_parser *dom_parser = (struct rq_dom_parser *)RQ_CALLOC(1, sizeof(struct rq_dom_parser));
 
 	struct rq_xml_node *ret_node = NULL;
 
@@ -119,7 +119,7 @@ rq_dom_parser_parse_stream(rq_stream_t stream)
 
 	ret_node = dom_parser->head_element;
 
-    free(dom_parser);
+    RQ_FREE(dom_parser);
 
     rq_xml_parser_free(parser);
 
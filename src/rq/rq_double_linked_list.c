@@ -312,5 +312,5 @@ rq_double_linked_list_erase(rq_double_linked_list_t ll, rq_double_linked_list_it
 
     ll->count--;
 
-    return iter;
+    return ret;
 }
@@ -77,7 +77,7 @@ rq_electricity_curve_add_price(rq_electricity_curve_t curve, rq_date date, unsig
     {
         int i;
 
-        h = (struct hourly_prices_for_day *)malloc(sizeof(struct hourly_prices_for_day));
+        h = (struct hourly_prices_for_day *)RQ_MALLOC(sizeof(struct hourly_prices_for_day));
         h->date = date;
         for (i = 0; i < 25; i++)
             h->prices[i] = rq_math_get_nan();
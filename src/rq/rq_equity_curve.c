@@ -270,7 +270,7 @@ rq_equity_curve_add_to_dividend_yield(rq_equity_curve_t ec, rq_date date, double
 		/* need to grow size */
 		unsigned int new_max_size = ec->dividend_yield_function_max_size * 2;
         ec->dividend_yield_function = 
-            (struct rq_dividend_yield_elem *) realloc(
+            (struct rq_dividend_yield_elem *) RQ_REALLOC(
             ec->dividend_yield_function, 
             new_max_size * sizeof(struct rq_dividend_yield_elem)
             );
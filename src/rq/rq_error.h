@@ -43,6 +43,19 @@
 
 /* -- rq_xml_parser error codes -- */
 #define RQ_ERR_XML_PARSER_STREAM_NOT_ASSIGNED -100
+#define RQ_ERR_XML_PARSER_READ -101
+#define RQ_ERR_XML_PARSER_BAD_FORMAT -102
+
+/* -- rq_snapshot error codes -- */
+#define RQ_ERR_SNAPSHOT_BAD_FORMAT -110
+#define RQ_ERR_SNAPSHOT_VERSION -111
+
+/* -- rq_rate_loader error codes -- */
+#define RQ_ERR_RATE_LOADER_BAD_LINE -120
+
+/* -- rq_results_columns error codes -- */
+#define RQ_ERR_RESULTS_COLUMNS_BAD_FORMAT -130
+#define RQ_ERR_RESULTS_COLUMNS_VERSION -131
 
 #define RQ_PRICING_FINITE_DIFFERENCES_SOR_DID_NOT_CONVERGE -10
 
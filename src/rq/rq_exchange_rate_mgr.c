@@ -79,6 +79,8 @@ rq_exchange_rate_mgr_clone(rq_exchange_rate_mgr_t m)
 	else
 		cm->cross_thru_node = NULL;
 
+    cm->frozen = 0;
+
     return cm;
 }
 
@@ -110,6 +112,13 @@ rq_exchange_rate_mgr_clear(rq_exchange_rate_mgr_t m)
     if (m->cross_thru_node)
         rq_exchange_rate_mgr_cross_thru_node_free(m->cross_thru_node);
     m->cross_thru_node = NULL;
+    m->frozen = 0;
+}
+
+RQ_EXPORT void
+rq_exchange_rate_mgr_freeze(rq_exchange_rate_mgr_t m)
+{
+    m->frozen = 1;
 }
 
 static int
@@ -271,7 +280,8 @@ rq_exchange_rate_mgr_get_or_imply(
     {
         if (!lookup_exchange_rate(m->cross_thru_node, forward_curve_mgr, asset_mgr, ccy_code_from, ccy_code_to, date, exchange_rate))
         {
-            if (cache_result)
+            /* a frozen manager may be shared between threads */
+            if (cache_result && !m->frozen)
             {
 				double other_rate = 0.0;
 
@@ -309,6 +319,7 @@ rq_exchange_rate_mgr_add(
 {
     rq_exchange_rate_t er = rq_exchange_rate_build(ccy_code_from, ccy_code_to, exchange_rate);
     rq_tree_rb_add(m->tree, (void *)rq_exchange_rate_get_key(er), er);
+    m->frozen = 0;
 }
 
 
@@ -69,6 +69,8 @@ typedef struct rq_exchange_rate_mgr {
     rq_tree_rb_t tree;
 
     struct rq_exchange_rate_cross_thru_node *cross_thru_node;
+
+    short frozen; /**< set by rq_exchange_rate_mgr_freeze() until the rates next change */
 } *rq_exchange_rate_mgr_t;
 
 typedef struct rq_exchange_rate_mgr_iterator {
@@ -103,6 +105,10 @@ RQ_EXPORT void rq_exchange_rate_mgr_clear(rq_exchange_rate_mgr_t exchange_rate_m
 /**
  * This function, if successful, returns the exchange rate that converts
  * the "from" currency amount into the "to" currency amount.
+ *
+ * If cache_result is set, a rate that had to be implied is added to
+ * the manager, along with its inverse. A frozen manager isn't
+ * changed, so that it can be read from many threads at once.
  */
 RQ_EXPORT int 
 rq_exchange_rate_mgr_get_or_imply(
@@ -116,6 +122,13 @@ rq_exchange_rate_mgr_get_or_imply(
     short cache_result
     );
 
+/**
+ * Stop rq_exchange_rate_mgr_get_or_imply() caching implied rates, so
+ * that the manager isn't changed by reading it. Adding a rate, or
+ * clearing the manager, thaws it.
+ */
+RQ_EXPORT void rq_exchange_rate_mgr_freeze(rq_exchange_rate_mgr_t exchange_rate_mgr);
+
 /**
  * Add an exchange rate to the manager
  */
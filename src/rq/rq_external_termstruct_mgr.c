@@ -37,8 +37,8 @@ _rq_external_termstruct_free(void *p)
     }
     else
     {
-        free((char *)et->id);
-        free(et);
+        RQ_FREE((char *)et->id);
+        RQ_FREE(et);
     }
 }
 
@@ -60,8 +60,8 @@ _rq_external_termstruct_clone(void *p)
     }
     else
     {
-        et_clone = (rq_external_termstruct_t) malloc(sizeof(struct rq_external_termstruct));
-        et_clone->id = strdup(et->id);
+        et_clone = (rq_external_termstruct_t) RQ_MALLOC(sizeof(struct rq_external_termstruct));
+        et_clone->id = RQ_STRDUP(et->id);
         et_clone->external_termstruct = (*et->clone_func)(et->external_termstruct);
         et_clone->free_func = et->free_func;
         et_clone->clone_func = et->clone_func;
@@ -72,7 +72,7 @@ _rq_external_termstruct_clone(void *p)
 RQ_EXPORT rq_external_termstruct_mgr_t
 rq_external_termstruct_mgr_alloc()
 {
-    struct rq_external_termstruct_mgr *etm = (struct rq_external_termstruct_mgr *)malloc(sizeof(struct rq_external_termstruct_mgr));
+    struct rq_external_termstruct_mgr *etm = (struct rq_external_termstruct_mgr *)RQ_MALLOC(sizeof(struct rq_external_termstruct_mgr));
 	etm->tree = rq_tree_rb_alloc(_rq_external_termstruct_free, (int (*)(const void *, const void *))strcmp);
 
     return etm;
@@ -100,7 +100,7 @@ rq_external_termstruct_mgr_is_null(rq_external_termstruct_mgr_t obj)
 RQ_EXPORT rq_external_termstruct_mgr_t 
 rq_external_termstruct_mgr_clone(const rq_external_termstruct_mgr_t etm)
 {
-    struct rq_external_termstruct_mgr *etm_clone = (struct rq_external_termstruct_mgr *)malloc(sizeof(struct rq_external_termstruct_mgr));
+    struct rq_external_termstruct_mgr *etm_clone = (struct rq_external_termstruct_mgr *)RQ_MALLOC(sizeof(struct rq_external_termstruct_mgr));
 	etm_clone->tree = rq_tree_rb_clone(etm->tree, (const void *(*)(const void *))_rq_external_termstruct_get_id, (void *(*)(const void *))_rq_external_termstruct_clone);
 
     return etm_clone;
@@ -110,8 +110,8 @@ rq_external_termstruct_mgr_clone(const rq_external_termstruct_mgr_t etm)
 RQ_EXPORT void 
 rq_external_termstruct_mgr_add(rq_external_termstruct_mgr_t etm, const char *id, void *external_termstruct, void (*free_func)(void *), void *(*clone_func)(void *))
 {
-    rq_external_termstruct_t et = (rq_external_termstruct_t)malloc(sizeof(struct rq_external_termstruct));
-    et->id = (const char *)strdup(id);
+    rq_external_termstruct_t et = (rq_external_termstruct_t)RQ_MALLOC(sizeof(struct rq_external_termstruct));
+    et->id = (const char *)RQ_STRDUP(id);
     et->external_termstruct = external_termstruct;
     et->free_func = free_func;
     et->clone_func = clone_func;
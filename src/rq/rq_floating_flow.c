@@ -31,6 +31,13 @@
 #include "rq_vol_surface.h"
 #include "rq_pricing_blackscholes.h"
 
+#ifndef min
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#endif
+#ifndef max
+#define max(a, b) ((a) > (b) ? (a) : (b))
+#endif
+
 RQ_EXPORT rq_floating_flow_rate_list_t 
 rq_floating_flow_rate_list_alloc()
 {
@@ -663,6 +670,16 @@ rq_rateset_get_forward_discount_factor(const rq_rateset_t rs, rq_date start_date
     return (df1 != 0 ? df / df1 : df);
 }
 
+/* As rq_rateset_get_forward_discount_factor(), for a strip of dates
+   from the same start date whose discount factor is already known. */
+static double
+forward_discount_factor(const rq_rateset_t rs, double df1, rq_date end_date)
+{
+    double df = rq_rateset_get_discount_factor(rs, end_date);
+
+    return (df1 != 0 ? df / df1 : df);
+}
+
 RQ_EXPORT double
 rq_rateset_get_forward_par_rate_day_count(
     const rq_rateset_t rs,
@@ -680,9 +697,10 @@ rq_rateset_get_forward_par_rate_day_count(
     {
         double sum_df = 0.0;
         double year_count_frac = 1.0;
-        double last_df = rq_rateset_get_forward_discount_factor(
+        double from_df = rq_rateset_get_discount_factor(rs, from_date);
+        double last_df = forward_discount_factor(
                 rs,
-                from_date,
+                from_df,
                 dates[num_dates-1]
                 );
         unsigned int i;
@@ -690,9 +708,9 @@ rq_rateset_get_forward_par_rate_day_count(
         {
             if (dates[i] > from_date)
             {
-                double df = rq_rateset_get_forward_discount_factor(
+                double df = forward_discount_factor(
                     rs,
-                    from_date,
+                    from_df,
                     dates[i]
                     );
                 year_count_frac = rq_day_count_get_year_fraction(day_count, dates[i-1], dates[i]);
@@ -726,12 +744,13 @@ rq_rateset_get_accrual_day_count(
     if (num_dates > 0)
     {
         double sum_df = 0.0;
+        double from_df = rq_rateset_get_discount_factor(rs, from_date);
         unsigned int i;
         for (i = 1; i < num_dates; i++)
         {
-            double df = rq_rateset_get_forward_discount_factor(
+            double df = forward_discount_factor(
                 rs,
-                from_date,
+                from_df,
                 dates[i]
                 );
             year_count_frac = rq_day_count_get_year_fraction(day_count, dates[i-1], dates[i]);
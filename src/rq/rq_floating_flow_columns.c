@@ -0,0 +1,444 @@
+/*
+** rq_floating_flow_columns.c
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#include "rq_floating_flow_columns.h"
+#include <stdlib.h>
+#include <string.h>
+
+RQ_EXPORT rq_floating_flow_columns_t
+rq_floating_flow_columns_alloc()
+{
+    return (rq_floating_flow_columns_t)RQ_CALLOC(1, sizeof(struct rq_floating_flow_columns));
+}
+
+RQ_EXPORT void
+rq_floating_flow_columns_free(rq_floating_flow_columns_t cols)
+{
+    if (cols->block)
+        RQ_FREE(cols->block);
+    RQ_FREE(cols);
+}
+
+/* Make room for max_flows flows. All the columns live in one block,
+   the doubles first so everything is aligned.
+*/
+static void
+reserve_columns(rq_floating_flow_columns_t cols, unsigned long max_flows)
+{
+    unsigned long max_queries = 3 * max_flows + 1;
+    double *d;
+    unsigned long *ul;
+    rq_floating_flow_t *f;
+    rq_date *dt;
+    unsigned short *us;
+
+    if (max_flows <= cols->max_flows && cols->block)
+        return;
+
+    if (cols->block)
+        RQ_FREE(cols->block);
+
+    cols->block = RQ_MALLOC(
+        (10 * max_flows + 2 * max_queries) * sizeof(double) +
+        3 * max_flows * sizeof(unsigned long) +
+        max_flows * sizeof(rq_floating_flow_t) +
+        (4 * max_flows + max_queries) * sizeof(rq_date) +
+        2 * max_flows * sizeof(unsigned short)
+        );
+    cols->max_flows = max_flows;
+
+    d = (double *)cols->block;
+    cols->notional_fractions = d; d += max_flows;
+    cols->signs = d; d += max_flows;
+    cols->multipliers = d; d += max_flows;
+    cols->spreads = d; d += max_flows;
+    cols->rates = d; d += max_flows;
+    cols->payments = d; d += max_flows;
+    cols->discount_factors = d; d += max_flows;
+    cols->present_values = d; d += max_flows;
+    cols->query_fractions = d; d += max_flows;
+    cols->query_weights = d; d += max_flows;
+    cols->query_projection_factors = d; d += max_queries;
+    cols->query_discount_factors = d; d += max_queries;
+
+    ul = (unsigned long *)d;
+    cols->start_queries = ul; ul += max_flows;
+    cols->end_queries = ul; ul += max_flows;
+    cols->payment_queries = ul; ul += max_flows;
+
+    f = (rq_floating_flow_t *)ul;
+    cols->flows = f; f += max_flows;
+
+    dt = (rq_date *)f;
+    cols->payment_dates = dt; dt += max_flows;
+    cols->fixing_dates = dt; dt += max_flows;
+    cols->rate_start_dates = dt; dt += max_flows;
+    cols->rate_end_dates = dt; dt += max_flows;
+    cols->query_dates = dt; dt += max_queries;
+
+    us = (unsigned short *)dt;
+    cols->statuses = us; us += max_flows;
+    cols->kinds = us;
+}
+
+RQ_EXPORT void
+rq_floating_flow_columns_build(rq_floating_flow_columns_t cols, rq_floating_flow_list_t ffl)
+{
+    unsigned long size = rq_floating_flow_list_size(ffl);
+    unsigned long i;
+    unsigned long n = 0;
+
+    reserve_columns(cols, size);
+
+    for (i = 0; i < size; i++)
+    {
+        rq_floating_flow_t ff = rq_floating_flow_list_get_at(ffl, i);
+        rq_floating_flow_rate_t ffr = ff->floating_rate;
+
+        if (!rq_floating_flow_has_interest_payment_characteristic(ff))
+            continue;
+
+        cols->flows[n] = ff;
+        cols->payment_dates[n] = ff->payment_date;
+        cols->notional_fractions[n] = rq_floating_flow_get_notional_fraction_calc(ff);
+        cols->signs[n] = (ff->pay_receive == RQ_PAY_RECEIVE_PAY ? -1.0 : 1.0);
+        cols->statuses[n] = ff->flow_status;
+        cols->rates[n] = ff->rate;
+        if (ffr)
+        {
+            cols->fixing_dates[n] = ffr->fixing_date;
+            cols->rate_start_dates[n] = ffr->rate_start_date;
+            cols->rate_end_dates[n] = ffr->rate_end_date;
+            cols->multipliers[n] = ffr->rate_multiplier;
+            cols->spreads[n] = ffr->spread;
+        }
+        else
+        {
+            cols->fixing_dates[n] = 0;
+            cols->rate_start_dates[n] = ff->accrual_start_date;
+            cols->rate_end_dates[n] = ff->accrual_end_date;
+            cols->multipliers[n] = 1.0;
+            cols->spreads[n] = 0.0;
+        }
+        cols->payments[n] = ff->payment_amount;
+        cols->discount_factors[n] = 1.0;
+        cols->present_values[n] = 0.0;
+        n++;
+    }
+
+    cols->num_flows = n;
+    cols->num_queries = 0;
+}
+
+/* Decide how a flow is valued, following the branches of
+   rq_floating_flow_set_floating_rate_from_curve_and_historic() and
+   rq_floating_flow_get_effective_rate().
+*/
+static unsigned short
+classify_flow(const rq_floating_flow_t ff, unsigned short status, rq_date from_date, int projects)
+{
+    unsigned short kind = RQ_FLOATING_FLOW_COLUMN_KNOWN;
+
+    if (ff->override_get_payment_func || ff->override_set_rate_func || ff->frBasket)
+        return RQ_FLOATING_FLOW_COLUMN_SINGLE;
+
+    if ((ff->flow_type & RQ_FLOATING_FLOW_TYPE_IS_RATE_SET_MASK) != 0 &&
+        (status & RQ_FLOATING_FLOW_STATUS_FLOATING_RATE_SET) == 0)
+    {
+        if (!projects || ff->floating_rate->fixing_date < from_date)
+            return RQ_FLOATING_FLOW_COLUMN_SINGLE;
+        kind = RQ_FLOATING_FLOW_COLUMN_PROJECTED;
+    }
+
+    if (ff->floating_rate &&
+        (status & (RQ_FLOATING_FLOW_STATUS_CAP_RATE_SET | RQ_FLOATING_FLOW_STATUS_FLOOR_RATE_SET)) != 0)
+        kind |= RQ_FLOATING_FLOW_COLUMN_OPTION;
+
+    return kind;
+}
+
+static int
+date_cmp(const void *p1, const void *p2)
+{
+    rq_date d1 = *(const rq_date *)p1;
+    rq_date d2 = *(const rq_date *)p2;
+
+    return (d1 < d2 ? -1 : (d1 > d2 ? 1 : 0));
+}
+
+static unsigned long
+find_query(const rq_date *dates, unsigned long num_dates, rq_date d)
+{
+    unsigned long lo = 1;
+    unsigned long hi = num_dates;
+
+    while (lo < hi)
+    {
+        unsigned long mid = lo + (hi - lo) / 2;
+        if (dates[mid] < d)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+/* The first pass: classify the flows and collect the distinct dates
+   the leg needs discount factors for. The year fractions of the rate
+   periods are the projection curve's, so that a business day count
+   uses its calendar, as rq_yield_curve_get_forward_simple_rate()
+   does.
+*/
+static void
+gather_queries(rq_floating_flow_columns_t cols, rq_date from_date, rq_yield_curve_t projection_curve)
+{
+    int projects = (projection_curve != NULL);
+    rq_date *dates = cols->query_dates;
+    unsigned long num_dates = 1;
+    unsigned long i;
+    unsigned long j;
+
+    dates[0] = 0;
+    for (i = 0; i < cols->num_flows; i++)
+    {
+        rq_date rate_start_date = cols->rate_start_dates[i];
+        rq_date rate_end_date = cols->rate_end_dates[i];
+
+        cols->kinds[i] = classify_flow(cols->flows[i], cols->statuses[i], from_date, projects);
+        dates[num_dates++] = cols->payment_dates[i];
+        cols->query_fractions[i] = 1.0;
+        cols->query_weights[i] = 0.0;
+        if (cols->kinds[i] & RQ_FLOATING_FLOW_COLUMN_PROJECTED)
+        {
+            /* no historic rate, so a rate period that has started
+               is moved up to the curve date. */
+            if (rate_start_date < from_date)
+            {
+                rate_end_date += (from_date - rate_start_date);
+                rate_start_date = from_date;
+            }
+            cols->query_fractions[i] = rq_yield_curve_get_year_fraction(
+                projection_curve,
+                cols->flows[i]->day_count_convention,
+                rate_start_date,
+                rate_end_date
+                );
+            cols->query_weights[i] = 1.0;
+            dates[num_dates++] = rate_start_date;
+            dates[num_dates++] = rate_end_date;
+        }
+    }
+
+    qsort(dates + 1, num_dates - 1, sizeof(rq_date), date_cmp);
+    for (i = 1, j = 1; i < num_dates; i++)
+        if (j == 1 || dates[i] != dates[j-1])
+            dates[j++] = dates[i];
+    cols->num_queries = j;
+
+    for (i = 0; i < cols->num_flows; i++)
+    {
+        cols->payment_queries[i] = find_query(dates, j, cols->payment_dates[i]);
+        cols->start_queries[i] = 0;
+        cols->end_queries[i] = 0;
+        if (cols->kinds[i] & RQ_FLOATING_FLOW_COLUMN_PROJECTED)
+        {
+            rq_date rate_start_date = cols->rate_start_dates[i];
+            rq_date rate_end_date = cols->rate_end_dates[i];
+            if (rate_start_date < from_date)
+            {
+                rate_end_date += (from_date - rate_start_date);
+                rate_start_date = from_date;
+            }
+            cols->start_queries[i] = find_query(dates, j, rate_start_date);
+            cols->end_queries[i] = find_query(dates, j, rate_end_date);
+        }
+    }
+
+    cols->query_from_date = from_date;
+    cols->query_projects = projects;
+    cols->query_calendar = (projects ? projection_curve->day_count_calendar : NULL);
+}
+
+/* The second pass over the columns. Flows that aren't projected point
+   at query 0, whose factor is 1.0, so they get a forward rate of zero
+   that the weight discards. A rate period with no length also gets a
+   forward rate of zero.
+*/
+static void
+project_columns(
+    unsigned long n,
+    const double *RQ_RESTRICT proj_factors,
+    const double *RQ_RESTRICT disc_factors,
+    const unsigned long *RQ_RESTRICT start_queries,
+    const unsigned long *RQ_RESTRICT end_queries,
+    const unsigned long *RQ_RESTRICT payment_queries,
+    const double *RQ_RESTRICT fractions,
+    const double *RQ_RESTRICT weights,
+    const double *RQ_RESTRICT notional_fractions,
+    const double *RQ_RESTRICT multipliers,
+    const double *RQ_RESTRICT spreads,
+    double *RQ_RESTRICT rates,
+    double *RQ_RESTRICT payments,
+    double *RQ_RESTRICT discount_factors
+    )
+{
+    unsigned long i;
+
+    for (i = 0; i < n; i++)
+    {
+        double df1 = proj_factors[start_queries[i]];
+        double df = proj_factors[end_queries[i]];
+        double fwd_df = (df1 != 0 ? df / df1 : df);
+        double fwd = (fractions[i] != 0 ? ((1.0 / fwd_df) - 1.0) * (1.0 / fractions[i]) : 0.0);
+        double rate = (weights[i] != 0.0 ? fwd : rates[i]);
+
+        rates[i] = rate;
+        payments[i] = notional_fractions[i] * ((rate * multipliers[i]) + spreads[i]);
+        discount_factors[i] = disc_factors[payment_queries[i]];
+    }
+}
+
+static void
+discount_columns(
+    unsigned long n,
+    const double *RQ_RESTRICT signs,
+    const double *RQ_RESTRICT payments,
+    const double *RQ_RESTRICT discount_factors,
+    double *RQ_RESTRICT present_values
+    )
+{
+    unsigned long i;
+
+    for (i = 0; i < n; i++)
+        present_values[i] = signs[i] * payments[i] * discount_factors[i];
+}
+
+RQ_EXPORT short
+rq_floating_flow_columns_evaluate(
+    rq_floating_flow_columns_t cols,
+    rq_rateset_t rs,
+    rq_yield_curve_t discount_curve
+    )
+{
+    rq_date from_date = rq_rateset_get_from_date(rs);
+    int projects = (rs->yc1 && !rs->yc2 && !rs->yc_basket);
+    int regather = 0;
+    unsigned long i;
+
+    if (cols->num_queries == 0 ||
+        cols->query_from_date != from_date ||
+        cols->query_projects != projects ||
+        (projects && cols->query_calendar != rs->yc1->day_count_calendar))
+        gather_queries(cols, from_date, (projects ? rs->yc1 : NULL));
+
+    cols->query_projection_factors[0] = 1.0;
+    cols->query_discount_factors[0] = 1.0;
+    for (i = 1; i < cols->num_queries; i++)
+    {
+        rq_date d = cols->query_dates[i];
+        cols->query_projection_factors[i] = (projects ? rq_yield_curve_get_discount_factor(rs->yc1, d) : 1.0);
+        cols->query_discount_factors[i] = rq_yield_curve_get_discount_factor(discount_curve, d);
+    }
+
+    project_columns(
+        cols->num_flows,
+        cols->query_projection_factors,
+        cols->query_discount_factors,
+        cols->start_queries,
+        cols->end_queries,
+        cols->payment_queries,
+        cols->query_fractions,
+        cols->query_weights,
+        cols->notional_fractions,
+        cols->multipliers,
+        cols->spreads,
+        cols->rates,
+        cols->payments,
+        cols->discount_factors
+        );
+
+    /* write the results back, and value the flows the columns can't */
+    for (i = 0; i < cols->num_flows; i++)
+    {
+        rq_floating_flow_t ff = cols->flows[i];
+        unsigned short kind = cols->kinds[i];
+
+        if (kind & RQ_FLOATING_FLOW_COLUMN_PROJECTED)
+        {
+            ff->rate = cols->rates[i];
+            ff->floating_rate->date_observed = from_date;
+            if (cols->fixing_dates[i] == from_date)
+            {
+                ff->flow_status |= RQ_FLOATING_FLOW_STATUS_FLOATING_RATE_SET;
+                cols->statuses[i] = ff->flow_status;
+                regather = 1;
+            }
+        }
+
+        if (kind & RQ_FLOATING_FLOW_COLUMN_SINGLE)
+        {
+            if (!ff->override_set_rate_func)
+                rq_floating_flow_set_floating_rate_from_curve_and_historic(ff, rs, 0.0, 0);
+            rq_floating_flow_set_payment(ff, rs);
+            if (ff->flow_status != cols->statuses[i])
+            {
+                cols->statuses[i] = ff->flow_status;
+                regather = 1;
+            }
+            cols->rates[i] = ff->rate;
+            cols->payments[i] = ff->payment_amount;
+        }
+        else if (kind & RQ_FLOATING_FLOW_COLUMN_OPTION)
+        {
+            rq_floating_flow_set_payment(ff, rs);
+            cols->payments[i] = ff->payment_amount;
+        }
+        else
+        {
+            ff->payment_amount = cols->payments[i];
+        }
+    }
+
+    discount_columns(
+        cols->num_flows,
+        cols->signs,
+        cols->payments,
+        cols->discount_factors,
+        cols->present_values
+        );
+
+    if (regather)
+        cols->num_queries = 0;
+
+    return 0;
+}
+
+RQ_EXPORT double
+rq_floating_flow_columns_get_present_value(const rq_floating_flow_columns_t cols)
+{
+    double pv = 0.0;
+    unsigned long i;
+
+    for (i = 0; i < cols->num_flows; i++)
+        pv += cols->present_values[i];
+
+    return pv;
+}
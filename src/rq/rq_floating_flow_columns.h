@@ -0,0 +1,156 @@
+/**
+ * @file
+ *
+ * A columnar copy of the interest payments in a floating flow list, valued a leg at a time.
+ */
+/*
+** rq_floating_flow_columns.h
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#ifndef rq_floating_flow_columns_h
+#define rq_floating_flow_columns_h
+
+#include "rq_config.h"
+#include "rq_date.h"
+#include "rq_yield_curve.h"
+#include "rq_floating_flow.h"
+#include "rq_floating_flow_list.h"
+
+#ifdef __cplusplus
+extern "C" {
+#if 0
+} // purely to not screw up my indenting...
+#endif
+#endif
+
+/* How a flow is valued on the last evaluation. */
+#define RQ_FLOATING_FLOW_COLUMN_KNOWN 0x0000 /**< the rate is fixed or has already been set */
+#define RQ_FLOATING_FLOW_COLUMN_PROJECTED 0x0001 /**< the rate is projected off the curve with the rest of the leg */
+#define RQ_FLOATING_FLOW_COLUMN_SINGLE 0x0002 /**< the rate and payment are set by the per-flow functions */
+#define RQ_FLOATING_FLOW_COLUMN_OPTION 0x0004 /**< capped or floored, so the payment is set by the per-flow functions */
+
+/** The interest payments of a floating flow list held as parallel
+ * arrays, one element per flow.
+ *
+ * The columns are a snapshot of the flows taken by
+ * rq_floating_flow_columns_build(). Rebuild them if the flows are
+ * changed other than through rq_floating_flow_columns_evaluate().
+ */
+typedef struct rq_floating_flow_columns {
+    unsigned long num_flows;
+    unsigned long max_flows;
+    rq_floating_flow_t *flows; /**< the flows the columns were built from */
+
+    rq_date *payment_dates;
+    rq_date *fixing_dates;
+    rq_date *rate_start_dates;
+    rq_date *rate_end_dates;
+    double *notional_fractions; /**< notional amount times the accrual year fraction */
+    double *signs; /**< 1.0 to receive, -1.0 to pay */
+    double *multipliers;
+    double *spreads;
+    unsigned short *statuses; /**< the RQ_FLOATING_FLOW_STATUS flags of each flow */
+
+    /* results of the last evaluation */
+    unsigned short *kinds; /**< RQ_FLOATING_FLOW_COLUMN flags */
+    double *rates; /**< the observed, fixed or projected rate, before multiplier and spread */
+    double *payments;
+    double *discount_factors;
+    double *present_values;
+
+    /* the curve queries for the whole leg, gathered once per
+       curve from_date and day count calendar. Query 0 is a dummy with
+       a discount factor of 1.0, which the flows that are not
+       projected point at.
+     */
+    rq_date query_from_date;
+    int query_projects;
+    rq_calendar_t query_calendar; /**< the projection curve's day count calendar */
+    unsigned long num_queries;
+    rq_date *query_dates;
+    double *query_projection_factors;
+    double *query_discount_factors;
+    unsigned long *start_queries;
+    unsigned long *end_queries;
+    unsigned long *payment_queries;
+    double *query_fractions; /**< year fraction of the projected rate period, by the projection curve */
+    double *query_weights; /**< 1.0 where the rate is projected, otherwise 0.0 */
+
+    void *block;
+} *rq_floating_flow_columns_t;
+
+/** Allocate an empty set of columns.
+ */
+RQ_EXPORT rq_floating_flow_columns_t rq_floating_flow_columns_alloc();
+
+/** Free the columns. The flows they were built from are untouched.
+ */
+RQ_EXPORT void rq_floating_flow_columns_free(rq_floating_flow_columns_t cols);
+
+/** Fill the columns from the fixed, floating and average rate
+ * payments in a floating flow list. Other flows are skipped. The
+ * list must outlive the columns.
+ */
+RQ_EXPORT void
+rq_floating_flow_columns_build(
+    rq_floating_flow_columns_t cols, /**< the columns to fill */
+    rq_floating_flow_list_t ffl /**< the flows to copy */
+    );
+
+/** Set the rates and payments of all the flows, and discount them.
+ *
+ * Nothing in the library calls this; it is for callers that value a
+ * leg many times and would otherwise loop over the flows themselves.
+ *
+ * This is equivalent to calling
+ * rq_floating_flow_set_floating_rate_from_curve_and_historic() with no
+ * historic rate and then rq_floating_flow_set_payment() on every
+ * flow, and writes the rates and payments back to the flows in the
+ * same way. The work is done in two passes: the discount factors for
+ * every date the leg needs are fetched first, then the forward rates,
+ * payments and present values are computed across the columns.
+ *
+ * Flows with a payment function, a rate basket, a capped or floored
+ * rate, or a fixing between the last observation and the curve date
+ * are valued with the per-flow functions. Flows with a rate setting
+ * function are expected to have had their rate set already.
+ *
+ * @return 0 on success
+ */
+RQ_EXPORT short
+rq_floating_flow_columns_evaluate(
+    rq_floating_flow_columns_t cols, /**< the columns to value */
+    rq_rateset_t rs, /**< the curves used to set the rates */
+    rq_yield_curve_t discount_curve /**< the curve to discount the payments with, NULL for none */
+    );
+
+/** Get the sum of the present values from the last evaluation.
+ */
+RQ_EXPORT double
+rq_floating_flow_columns_get_present_value(const rq_floating_flow_columns_t cols);
+
+#ifdef __cplusplus
+#if 0
+{ // purely to not screw up my indenting...
+#endif
+};
+#endif
+
+#endif
@@ -156,6 +156,85 @@ rq_floating_flow_list_get_at(
             );
 }
 
+RQ_EXPORT void
+rq_floating_flow_list_add_floating_leg(
+    rq_floating_flow_list_t ffl,
+    const rq_schedule_t schedule,
+    enum rq_pay_receive pay_receive,
+    const char *termstruct_id,
+    const char *payment_asset_id,
+    double notional_amount,
+    double spread
+    )
+{
+    const rq_date *dates = rq_schedule_get_dates(schedule);
+    const rq_date *payment_dates = rq_schedule_get_payment_dates(schedule);
+    const rq_date *fixing_dates = rq_schedule_get_fixing_dates(schedule);
+    unsigned int num_periods = rq_schedule_get_num_periods(schedule);
+    unsigned int i;
+
+    for (i = 0; i < num_periods; i++)
+    {
+        rq_floating_flow_t ff = rq_floating_flow_alloc();
+
+        rq_floating_flow_set_type_floating_rate_payment(
+            ff,
+            pay_receive,
+            termstruct_id,
+            payment_asset_id,
+            payment_dates[i],
+            fixing_dates[i],
+            dates[i],
+            dates[i+1],
+            dates[i],
+            dates[i+1],
+            schedule->params.day_count_convention,
+            notional_amount,
+            0,
+            1.0
+            );
+        if (spread != 0.0)
+            rq_floating_flow_set_spread(ff, spread);
+
+        rq_floating_flow_list_add(ffl, ff);
+    }
+}
+
+RQ_EXPORT void
+rq_floating_flow_list_add_fixed_leg(
+    rq_floating_flow_list_t ffl,
+    const rq_schedule_t schedule,
+    enum rq_pay_receive pay_receive,
+    const char *payment_asset_id,
+    double notional_amount,
+    double fixed_rate
+    )
+{
+    const rq_date *dates = rq_schedule_get_dates(schedule);
+    const rq_date *payment_dates = rq_schedule_get_payment_dates(schedule);
+    unsigned int num_periods = rq_schedule_get_num_periods(schedule);
+    unsigned int i;
+
+    for (i = 0; i < num_periods; i++)
+    {
+        rq_floating_flow_t ff = rq_floating_flow_alloc();
+
+        rq_floating_flow_set_type_fixed_rate_payment(
+            ff,
+            pay_receive,
+            payment_asset_id,
+            payment_dates[i],
+            dates[i],
+            dates[i+1],
+            schedule->params.day_count_convention,
+            notional_amount,
+            fixed_rate
+            );
+
+        rq_floating_flow_list_add(ffl, ff);
+    }
+}
+
 RQ_EXPORT void
 rq_floating_flow_list_invert_pay_receive(
     rq_floating_flow_list_t ffl
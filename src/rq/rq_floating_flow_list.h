@@ -37,6 +37,7 @@
 #include "rq_date.h"
 #include "rq_array.h"
 #include "rq_floating_flow.h"
+#include "rq_schedule.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -110,6 +111,33 @@ rq_floating_flow_list_get_at(
     unsigned long offset
     );
 
+/** Add a floating rate payment for each period in the schedule. The
+ * rate for each period is set over the accrual period, fixing on the
+ * schedule's fixing date.
+ */
+RQ_EXPORT void
+rq_floating_flow_list_add_floating_leg(
+    rq_floating_flow_list_t ffl,
+    const rq_schedule_t schedule,
+    enum rq_pay_receive pay_receive,
+    const char *termstruct_id,
+    const char *payment_asset_id,
+    double notional_amount,
+    double spread
+    );
+
+/** Add a fixed rate payment for each period in the schedule.
+ */
+RQ_EXPORT void
+rq_floating_flow_list_add_fixed_leg(
+    rq_floating_flow_list_t ffl,
+    const rq_schedule_t schedule,
+    enum rq_pay_receive pay_receive,
+    const char *payment_asset_id,
+    double notional_amount,
+    double fixed_rate
+    );
+
 /** This function inverts the pay/receive flags on all the floating
  * flows in the list.
  */
@@ -28,7 +28,7 @@
 #include <string.h>
 
 
-static unsigned int s_initial_max_forward_rates = 20;
+static const unsigned int s_initial_max_forward_rates = 20;
 
 static struct rq_forward_curve *
 rq_forward_curve_alloc(unsigned int default_size)
@@ -107,7 +107,7 @@ rq_forward_curve_set_rate(rq_forward_curve_t forward_curve, rq_date date, double
     {
         unsigned int new_max_forward_rates = forward_curve->max_forward_rates * 2;
         forward_curve->forward_rates = 
-            (struct rq_forward_rate *)realloc(
+            (struct rq_forward_rate *)RQ_REALLOC(
                 forward_curve->forward_rates,
                 new_max_forward_rates * sizeof(struct rq_forward_rate)
                 );
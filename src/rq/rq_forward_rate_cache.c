@@ -0,0 +1,178 @@
+/*
+** rq_forward_rate_cache.c
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#include "rq_forward_rate_cache.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define INITIAL_SLOTS 256
+
+RQ_EXPORT rq_forward_rate_cache_t
+rq_forward_rate_cache_alloc()
+{
+    rq_forward_rate_cache_t c = (rq_forward_rate_cache_t)RQ_MALLOC(sizeof(struct rq_forward_rate_cache));
+
+    c->mutex = rq_mutex_alloc();
+    c->num_slots = INITIAL_SLOTS;
+    c->num_entries = 0;
+    c->entries = (struct rq_forward_rate_cache_entry *)RQ_CALLOC(c->num_slots, sizeof(struct rq_forward_rate_cache_entry));
+    c->hits = 0;
+    c->misses = 0;
+
+    return c;
+}
+
+RQ_EXPORT void
+rq_forward_rate_cache_free(rq_forward_rate_cache_t c)
+{
+    rq_mutex_free(c->mutex);
+    RQ_FREE(c->entries);
+    RQ_FREE(c);
+}
+
+static unsigned long
+hash_key(rq_date start_date, rq_date end_date, enum rq_day_count_convention day_count_convention)
+{
+    unsigned long h = (unsigned long)start_date;
+
+    h = h * 31 + (unsigned long)(end_date - start_date);
+    h = h * 31 + (unsigned long)day_count_convention;
+    return (h * 2654435761UL) ^ (h >> 15);
+}
+
+/* Find the slot holding the key, or the empty slot it would go
+   in. There is always at least one empty slot. */
+static struct rq_forward_rate_cache_entry *
+find_slot(
+    struct rq_forward_rate_cache_entry *entries,
+    unsigned long num_slots,
+    rq_date start_date,
+    rq_date end_date,
+    enum rq_day_count_convention day_count_convention
+    )
+{
+    unsigned long i = hash_key(start_date, end_date, day_count_convention) & (num_slots - 1);
+
+    while (entries[i].start_date != 0 &&
+           (entries[i].start_date != start_date ||
+            entries[i].end_date != end_date ||
+            entries[i].day_count_convention != day_count_convention))
+        i = (i + 1) & (num_slots - 1);
+
+    return &entries[i];
+}
+
+RQ_EXPORT int
+rq_forward_rate_cache_find(
+    rq_forward_rate_cache_t c,
+    rq_date start_date,
+    rq_date end_date,
+    enum rq_day_count_convention day_count_convention,
+    double *rate
+    )
+{
+    struct rq_forward_rate_cache_entry *e;
+    int found;
+
+    rq_mutex_lock(c->mutex);
+    e = find_slot(c->entries, c->num_slots, start_date, end_date, day_count_convention);
+    found = (e->start_date != 0);
+    if (found)
+    {
+        *rate = e->rate;
+        c->hits++;
+    }
+    else
+        c->misses++;
+    rq_mutex_unlock(c->mutex);
+
+    return found;
+}
+
+static void
+grow(rq_forward_rate_cache_t c)
+{
+    unsigned long num_slots = c->num_slots * 2;
+    struct rq_forward_rate_cache_entry *entries = (struct rq_forward_rate_cache_entry *)
+        RQ_CALLOC(num_slots, sizeof(struct rq_forward_rate_cache_entry));
+    unsigned long i;
+
+    for (i = 0; i < c->num_slots; i++)
+    {
+        struct rq_forward_rate_cache_entry *e = &c->entries[i];
+        if (e->start_date != 0)
+            *find_slot(entries, num_slots, e->start_date, e->end_date, e->day_count_convention) = *e;
+    }
+
+    RQ_FREE(c->entries);
+    c->entries = entries;
+    c->num_slots = num_slots;
+}
+
+RQ_EXPORT void
+rq_forward_rate_cache_add(
+    rq_forward_rate_cache_t c,
+    rq_date start_date,
+    rq_date end_date,
+    enum rq_day_count_convention day_count_convention,
+    double rate
+    )
+{
+    struct rq_forward_rate_cache_entry *e;
+
+    if (start_date == 0)
+        return;
+
+    rq_mutex_lock(c->mutex);
+    e = find_slot(c->entries, c->num_slots, start_date, end_date, day_count_convention);
+    if (e->start_date == 0)
+    {
+        if (c->num_entries >= RQ_FORWARD_RATE_CACHE_MAX_SIZE)
+        {
+            memset(c->entries, 0, c->num_slots * sizeof(struct rq_forward_rate_cache_entry));
+            c->num_entries = 0;
+        }
+        else if (2 * (c->num_entries + 1) > c->num_slots)
+            grow(c);
+        e = find_slot(c->entries, c->num_slots, start_date, end_date, day_count_convention);
+        e->start_date = start_date;
+        e->end_date = end_date;
+        e->day_count_convention = day_count_convention;
+        c->num_entries++;
+    }
+    e->rate = rate;
+    rq_mutex_unlock(c->mutex);
+}
+
+RQ_EXPORT void
+rq_forward_rate_cache_clear(rq_forward_rate_cache_t c)
+{
+    rq_mutex_lock(c->mutex);
+    memset(c->entries, 0, c->num_slots * sizeof(struct rq_forward_rate_cache_entry));
+    c->num_entries = 0;
+    rq_mutex_unlock(c->mutex);
+}
+
+RQ_EXPORT unsigned long
+rq_forward_rate_cache_size(rq_forward_rate_cache_t c)
+{
+    return c->num_entries;
+}
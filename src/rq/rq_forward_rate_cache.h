@@ -0,0 +1,114 @@
+/**
+ * @file
+ *
+ * A memo table of forward rates projected off a yield curve.
+ */
+/*
+** rq_forward_rate_cache.h
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#ifndef rq_forward_rate_cache_h
+#define rq_forward_rate_cache_h
+
+#include "rq_config.h"
+#include "rq_date.h"
+#include "rq_enum.h"
+#include "rq_mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#if 0
+} // purely to not screw up my indenting...
+#endif
+#endif
+
+/** The most rates a cache holds. When it fills up it is emptied and
+ * starts again.
+ */
+#define RQ_FORWARD_RATE_CACHE_MAX_SIZE 65536
+
+struct rq_forward_rate_cache_entry {
+    rq_date start_date; /**< 0 if the slot is empty */
+    rq_date end_date;
+    enum rq_day_count_convention day_count_convention;
+    double rate;
+};
+
+/** A hash table of forward rates keyed by start date, end date and
+ * day count convention. Each yield curve owns its own cache, so the
+ * curve ID is implied. The cache can be shared between threads.
+ */
+typedef struct rq_forward_rate_cache {
+    rq_mutex_t mutex;
+    unsigned long num_slots; /**< always a power of two */
+    unsigned long num_entries;
+    struct rq_forward_rate_cache_entry *entries;
+    unsigned long hits;
+    unsigned long misses;
+} *rq_forward_rate_cache_t;
+
+/** Allocate an empty forward rate cache.
+ */
+RQ_EXPORT rq_forward_rate_cache_t rq_forward_rate_cache_alloc();
+
+/** Free the cache.
+ */
+RQ_EXPORT void rq_forward_rate_cache_free(rq_forward_rate_cache_t c);
+
+/** Look up a rate.
+ *
+ * @return 1 and set *rate if the rate is in the cache, 0 otherwise
+ */
+RQ_EXPORT int
+rq_forward_rate_cache_find(
+    rq_forward_rate_cache_t c,
+    rq_date start_date,
+    rq_date end_date,
+    enum rq_day_count_convention day_count_convention,
+    double *rate /**< set to the cached rate */
+    );
+
+/** Add a rate to the cache, replacing any rate with the same key.
+ */
+RQ_EXPORT void
+rq_forward_rate_cache_add(
+    rq_forward_rate_cache_t c,
+    rq_date start_date,
+    rq_date end_date,
+    enum rq_day_count_convention day_count_convention,
+    double rate
+    );
+
+/** Drop all the rates in the cache.
+ */
+RQ_EXPORT void rq_forward_rate_cache_clear(rq_forward_rate_cache_t c);
+
+/** Get the number of rates in the cache.
+ */
+RQ_EXPORT unsigned long rq_forward_rate_cache_size(rq_forward_rate_cache_t c);
+
+#ifdef __cplusplus
+#if 0
+{ // purely to not screw up my indenting...
+#endif
+};
+#endif
+
+#endif
@@ -28,7 +28,7 @@
 #include <string.h>
 
 
-static unsigned int s_initial_max_future_prices = 20;
+static const unsigned int s_initial_max_future_prices = 20;
 
 static struct rq_future_curve *
 rq_future_curve_alloc(unsigned int default_size)
@@ -109,7 +109,7 @@ rq_future_curve_set_price(rq_future_curve_t future_curve, const char* asset_id,
 	{
 		unsigned int new_max_future_prices = future_curve->max_future_prices * 2;
 		future_curve->future_prices = 
-			(struct rq_future_price *)realloc(
+			(struct rq_future_price *)RQ_REALLOC(
 			future_curve->future_prices,
 			new_max_future_prices * sizeof(struct rq_future_price)
 			);
@@ -0,0 +1,456 @@
+/*
+** rq_instrument.c
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#include "rq_instrument.h"
+#include "rq_mutex.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(WIN32)
+#include <windows.h>
+#define ATOMIC_ADD(p, n) InterlockedExchangeAdd((LONG volatile *)(p), (LONG)(n))
+#elif defined(__GNUC__)
+#include <time.h>
+#include <sys/time.h>
+#define ATOMIC_ADD(p, n) __sync_fetch_and_add((p), (n))
+#else
+#include <time.h>
+#include <sys/time.h>
+#define ATOMIC_ADD(p, n) (*(p) += (n))
+#endif
+
+/* the source file name fragments that place a file in a subsystem,
+   tried in order. */
+static const struct {
+    const char *pattern;
+    enum rq_instrument_subsystem subsystem;
+} s_file_patterns[] = {
+    { "bootstrap", RQ_INSTRUMENT_SUBSYSTEM_BOOTSTRAP },
+    { "monte_carlo", RQ_INSTRUMENT_SUBSYSTEM_MONTE_CARLO },
+    { "simulation", RQ_INSTRUMENT_SUBSYSTEM_MONTE_CARLO },
+    { "random", RQ_INSTRUMENT_SUBSYSTEM_MONTE_CARLO },
+    { "pricing", RQ_INSTRUMENT_SUBSYSTEM_PRICING },
+    { "xml", RQ_INSTRUMENT_SUBSYSTEM_XML },
+    { "dom_parser", RQ_INSTRUMENT_SUBSYSTEM_XML },
+    { "object_builder", RQ_INSTRUMENT_SUBSYSTEM_XML },
+    { "object_schema", RQ_INSTRUMENT_SUBSYSTEM_XML },
+    { "curve", RQ_INSTRUMENT_SUBSYSTEM_TERMSTRUCT },
+    { "termstruct", RQ_INSTRUMENT_SUBSYSTEM_TERMSTRUCT },
+    { "vol_surface", RQ_INSTRUMENT_SUBSYSTEM_TERMSTRUCT },
+    { "market", RQ_INSTRUMENT_SUBSYSTEM_MARKET },
+    { "rate", RQ_INSTRUMENT_SUBSYSTEM_MARKET },
+    { "spot_price", RQ_INSTRUMENT_SUBSYSTEM_MARKET },
+    { "trade", RQ_INSTRUMENT_SUBSYSTEM_TRADE },
+    { "product", RQ_INSTRUMENT_SUBSYSTEM_TRADE },
+    { "assetflow", RQ_INSTRUMENT_SUBSYSTEM_TRADE }
+};
+
+static const char *s_subsystem_names[RQ_INSTRUMENT_NUM_SUBSYSTEMS] = {
+    "other", "bootstrap", "pricing", "monte_carlo", "xml", "termstruct", "market", "trade"
+};
+
+static const char *s_timer_names[RQ_INSTRUMENT_NUM_TIMERS] = {
+    "bootstrap", "pricing", "monte_carlo", "xml_load"
+};
+
+/* Each thread remembers the subsystems of the files it has seen,
+   keyed on the address of the __FILE__ string, so the file name is
+   only matched against the patterns once. */
+#define FILE_CACHE_SIZE 256
+
+struct file_cache_entry {
+    const char *file;
+    enum rq_instrument_subsystem subsystem;
+};
+
+static int s_enabled = 0;
+static unsigned long s_sample_rate = 0;
+static rq_mutex_t s_mutex = NULL; /* guards the timers and call sites */
+static struct rq_instrument_alloc_stats s_alloc_stats[RQ_INSTRUMENT_NUM_SUBSYSTEMS];
+static struct rq_instrument_timer_stats s_timer_stats[RQ_INSTRUMENT_NUM_TIMERS];
+static struct rq_instrument_call_site s_call_sites[RQ_INSTRUMENT_MAX_CALL_SITES];
+static unsigned int s_num_call_sites = 0;
+
+static RQ_THREAD_LOCAL struct file_cache_entry s_file_cache[FILE_CACHE_SIZE];
+static RQ_THREAD_LOCAL unsigned long s_sample_countdown = 0;
+
+static double
+now()
+{
+#if defined(WIN32)
+    LARGE_INTEGER count;
+    LARGE_INTEGER frequency;
+
+    QueryPerformanceCounter(&count);
+    QueryPerformanceFrequency(&frequency);
+    return (double)count.QuadPart / (double)frequency.QuadPart;
+#elif defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+#else
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec * 1e-6;
+#endif
+}
+
+RQ_EXPORT void
+rq_instrument_set_enabled(int enabled)
+{
+    /* the mutex is allocated before the allocation hooks are live,
+       so allocating it isn't itself recorded. */
+    if (enabled && !s_mutex)
+        s_mutex = rq_mutex_alloc();
+    s_enabled = enabled;
+}
+
+RQ_EXPORT int
+rq_instrument_is_enabled()
+{
+    return s_enabled;
+}
+
+RQ_EXPORT void
+rq_instrument_set_sample_rate(unsigned long sample_rate)
+{
+    s_sample_rate = sample_rate;
+}
+
+RQ_EXPORT unsigned long
+rq_instrument_get_sample_rate()
+{
+    return s_sample_rate;
+}
+
+RQ_EXPORT void
+rq_instrument_reset()
+{
+    if (s_mutex)
+        rq_mutex_lock(s_mutex);
+
+    memset(s_alloc_stats, 0, sizeof(s_alloc_stats));
+    memset(s_timer_stats, 0, sizeof(s_timer_stats));
+    memset(s_call_sites, 0, sizeof(s_call_sites));
+    s_num_call_sites = 0;
+
+    if (s_mutex)
+        rq_mutex_unlock(s_mutex);
+}
+
+RQ_EXPORT double
+rq_instrument_timer_begin()
+{
+    return s_enabled ? now() : 0.0;
+}
+
+RQ_EXPORT void
+rq_instrument_timer_end(enum rq_instrument_timer timer, double begin)
+{
+    double elapsed;
+    struct rq_instrument_timer_stats *ts;
+
+    /* begin is 0 if the instrumentation was switched on mid-call */
+    if (!s_enabled || begin == 0.0)
+        return;
+
+    elapsed = now() - begin;
+    ts = &s_timer_stats[timer];
+
+    rq_mutex_lock(s_mutex);
+    ts->calls++;
+    ts->total_seconds += elapsed;
+    if (elapsed > ts->max_seconds)
+        ts->max_seconds = elapsed;
+    rq_mutex_unlock(s_mutex);
+}
+
+RQ_EXPORT enum rq_instrument_subsystem
+rq_instrument_get_subsystem_for_file(const char *file)
+{
+    const char *base = file;
+    const char *s;
+    unsigned int i;
+
+    /* match on the file name only, not the directories above it */
+    for (s = file; *s; s++)
+        if (*s == '/' || *s == '\\')
+            base = s + 1;
+
+    for (i = 0; i < sizeof(s_file_patterns) / sizeof(s_file_patterns[0]); i++)
+        if (strstr(base, s_file_patterns[i].pattern))
+            return s_file_patterns[i].subsystem;
+
+    return RQ_INSTRUMENT_SUBSYSTEM_OTHER;
+}
+
+static enum rq_instrument_subsystem
+lookup_subsystem(const char *file)
+{
+    struct file_cache_entry *e = &s_file_cache[((size_t)file >> 4) % FILE_CACHE_SIZE];
+
+    if (e->file != file)
+    {
+        e->file = file;
+        e->subsystem = rq_instrument_get_subsystem_for_file(file);
+    }
+
+    return e->subsystem;
+}
+
+static void
+sample_call_site(const char *file, unsigned int line, enum rq_instrument_subsystem subsystem, size_t size)
+{
+    unsigned int i = (unsigned int)((((size_t)file >> 4) * 31 + line) % RQ_INSTRUMENT_MAX_CALL_SITES);
+    unsigned int probes;
+
+    rq_mutex_lock(s_mutex);
+    for (probes = 0; probes < RQ_INSTRUMENT_MAX_CALL_SITES; probes++)
+    {
+        struct rq_instrument_call_site *cs = &s_call_sites[i];
+
+        if (!cs->file)
+        {
+            cs->file = file;
+            cs->line = line;
+            cs->subsystem = subsystem;
+            s_num_call_sites++;
+        }
+
+        if (cs->file == file && cs->line == line)
+        {
+            cs->samples++;
+            cs->bytes += size;
+            break;
+        }
+
+        i = (i + 1) % RQ_INSTRUMENT_MAX_CALL_SITES;
+    }
+    rq_mutex_unlock(s_mutex);
+}
+
+static void
+add_in_flight(struct rq_instrument_alloc_stats *as, long bytes)
+{
+    ATOMIC_ADD(&as->bytes_in_flight, bytes);
+    /* the peak is best effort when threads race */
+    if (as->bytes_in_flight > as->peak_bytes_in_flight)
+        as->peak_bytes_in_flight = as->bytes_in_flight;
+}
+
+RQ_EXPORT enum rq_instrument_subsystem
+rq_instrument_record_alloc(const char *file, unsigned int line, size_t size)
+{
+    enum rq_instrument_subsystem subsystem;
+    struct rq_instrument_alloc_stats *as;
+
+    if (!s_enabled)
+        return RQ_INSTRUMENT_SUBSYSTEM_OTHER;
+
+    subsystem = lookup_subsystem(file);
+    as = &s_alloc_stats[subsystem];
+    ATOMIC_ADD(&as->allocs, 1);
+    ATOMIC_ADD(&as->bytes_allocated, size);
+    add_in_flight(as, (long)size);
+
+    if (s_sample_rate)
+    {
+        if (s_sample_countdown == 0 || s_sample_countdown > s_sample_rate)
+            s_sample_countdown = s_sample_rate;
+        if (--s_sample_countdown == 0)
+            sample_call_site(file, line, subsystem, size);
+    }
+
+    return subsystem;
+}
+
+RQ_EXPORT void
+rq_instrument_record_realloc(enum rq_instrument_subsystem subsystem, size_t old_size, size_t size)
+{
+    struct rq_instrument_alloc_stats *as;
+
+    if (!s_enabled)
+        return;
+
+    as = &s_alloc_stats[subsystem];
+    ATOMIC_ADD(&as->reallocs, 1);
+    if (size > old_size)
+        ATOMIC_ADD(&as->bytes_allocated, size - old_size);
+    add_in_flight(as, (long)size - (long)old_size);
+}
+
+RQ_EXPORT void
+rq_instrument_record_free(enum rq_instrument_subsystem subsystem, size_t size)
+{
+    struct rq_instrument_alloc_stats *as;
+
+    if (!s_enabled)
+        return;
+
+    as = &s_alloc_stats[subsystem];
+    ATOMIC_ADD(&as->frees, 1);
+    ATOMIC_ADD(&as->bytes_in_flight, -(long)size);
+}
+
+RQ_EXPORT const char *
+rq_instrument_get_subsystem_name(enum rq_instrument_subsystem subsystem)
+{
+    return s_subsystem_names[subsystem];
+}
+
+RQ_EXPORT const char *
+rq_instrument_get_timer_name(enum rq_instrument_timer timer)
+{
+    return s_timer_names[timer];
+}
+
+RQ_EXPORT void
+rq_instrument_get_alloc_stats(enum rq_instrument_subsystem subsystem, struct rq_instrument_alloc_stats *stats)
+{
+    *stats = s_alloc_stats[subsystem];
+}
+
+RQ_EXPORT void
+rq_instrument_get_timer_stats(enum rq_instrument_timer timer, struct rq_instrument_timer_stats *stats)
+{
+    if (s_mutex)
+        rq_mutex_lock(s_mutex);
+    *stats = s_timer_stats[timer];
+    if (s_mutex)
+        rq_mutex_unlock(s_mutex);
+}
+
+static int
+compare_call_sites(const void *a, const void *b)
+{
+    const struct rq_instrument_call_site *csa = (const struct rq_instrument_call_site *)a;
+    const struct rq_instrument_call_site *csb = (const struct rq_instrument_call_site *)b;
+
+    if (csa->bytes != csb->bytes)
+        return csa->bytes > csb->bytes ? -1 : 1;
+    if (csa->samples != csb->samples)
+        return csa->samples > csb->samples ? -1 : 1;
+    return 0;
+}
+
+RQ_EXPORT unsigned int
+rq_instrument_get_call_sites(struct rq_instrument_call_site *call_sites, unsigned int max_call_sites)
+{
+    struct rq_instrument_call_site *sorted;
+    unsigned int num_call_sites = 0;
+    unsigned int i;
+
+    if (!s_mutex)
+        return 0;
+
+    /* copied out under the lock and sorted outside it. The copy
+       uses libc rather than RQ_MALLOC so it isn't itself counted. */
+    sorted = (struct rq_instrument_call_site *)malloc(sizeof(s_call_sites));
+    if (!sorted)
+        return 0;
+
+    rq_mutex_lock(s_mutex);
+    for (i = 0; i < RQ_INSTRUMENT_MAX_CALL_SITES; i++)
+        if (s_call_sites[i].file)
+            sorted[num_call_sites++] = s_call_sites[i];
+    rq_mutex_unlock(s_mutex);
+
+    qsort(sorted, num_call_sites, sizeof(struct rq_instrument_call_site), compare_call_sites);
+
+    if (num_call_sites > max_call_sites)
+        num_call_sites = max_call_sites;
+    memcpy(call_sites, sorted, num_call_sites * sizeof(struct rq_instrument_call_site));
+    free(sorted);
+
+    return num_call_sites;
+}
+
+static void
+write_json_string(rq_stream_t stream, const char *s)
+{
+    rq_stream_write_string(stream, "\"");
+    for (; *s; s++)
+    {
+        if (*s == '"' || *s == '\\')
+            rq_stream_write(stream, "\\", 1);
+        rq_stream_write(stream, s, 1);
+    }
+    rq_stream_write_string(stream, "\"");
+}
+
+RQ_EXPORT void
+rq_instrument_write_json(rq_stream_t stream)
+{
+    struct rq_instrument_call_site *call_sites;
+    unsigned int num_call_sites;
+    unsigned int i;
+
+    rq_stream_printf(stream, "{\n  \"enabled\": %s,\n  \"sample_rate\": %lu,\n", s_enabled ? "true" : "false", s_sample_rate);
+
+    rq_stream_write_string(stream, "  \"allocations\": {");
+    for (i = 0; i < RQ_INSTRUMENT_NUM_SUBSYSTEMS; i++)
+    {
+        struct rq_instrument_alloc_stats as;
+
+        rq_instrument_get_alloc_stats((enum rq_instrument_subsystem)i, &as);
+        rq_stream_printf(
+            stream,
+            "%s\n    \"%s\": { \"allocs\": %lu, \"reallocs\": %lu, \"frees\": %lu, \"bytes_allocated\": %lu, \"bytes_in_flight\": %ld, \"peak_bytes_in_flight\": %ld }",
+            i ? "," : "", s_subsystem_names[i],
+            as.allocs, as.reallocs, as.frees, as.bytes_allocated, as.bytes_in_flight, as.peak_bytes_in_flight
+            );
+    }
+    rq_stream_write_string(stream, "\n  },\n");
+
+    rq_stream_write_string(stream, "  \"timers\": {");
+    for (i = 0; i < RQ_INSTRUMENT_NUM_TIMERS; i++)
+    {
+        struct rq_instrument_timer_stats ts;
+
+        rq_instrument_get_timer_stats((enum rq_instrument_timer)i, &ts);
+        rq_stream_printf(
+            stream,
+            "%s\n    \"%s\": { \"calls\": %lu, \"total_seconds\": %.9f, \"max_seconds\": %.9f }",
+            i ? "," : "", s_timer_names[i],
+            ts.calls, ts.total_seconds, ts.max_seconds
+            );
+    }
+    rq_stream_write_string(stream, "\n  },\n");
+
+    rq_stream_write_string(stream, "  \"call_sites\": [");
+    call_sites = (struct rq_instrument_call_site *)malloc(sizeof(s_call_sites));
+    num_call_sites = (call_sites ? rq_instrument_get_call_sites(call_sites, RQ_INSTRUMENT_MAX_CALL_SITES) : 0);
+    for (i = 0; i < num_call_sites; i++)
+    {
+        rq_stream_printf(stream, "%s\n    { \"file\": ", i ? "," : "");
+        write_json_string(stream, call_sites[i].file);
+        rq_stream_printf(
+            stream,
+            ", \"line\": %u, \"subsystem\": \"%s\", \"samples\": %lu, \"bytes\": %lu }",
+            call_sites[i].line, s_subsystem_names[call_sites[i].subsystem],
+            call_sites[i].samples, call_sites[i].bytes
+            );
+    }
+    free(call_sites);
+    rq_stream_write_string(stream, num_call_sites ? "\n  ]\n}\n" : "]\n}\n");
+}
@@ -0,0 +1,184 @@
+/**
+ * @file
+ *
+ * Counters and timers for finding hotspots in production runs.
+ */
+/*
+** rq_instrument.h
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#ifndef rq_instrument_h
+#define rq_instrument_h
+
+#include "rq_config.h"
+#include "rq_stream.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#if 0
+} // purely to not screw up my indenting...
+#endif
+#endif
+
+/*
+   The instrumentation is compiled into every build and switched on
+   at run time with rq_instrument_set_enabled(). While it is off each
+   hook costs a function call and a test of a flag.
+
+   - Timers accumulate the number of calls and the elapsed time
+     spent bootstrapping curves, in pricing adapters, in the Monte
+     Carlo engines and loading XML.
+   - Allocation counters need the library built with RQ_INSTRUMENT
+     (configure --enable-instrumentation), which routes RQ_MALLOC and
+     friends through rq_memdbg. Each allocation is charged to a
+     subsystem worked out from the source file that made it.
+   - With a sample rate of N every Nth allocation on each thread is
+     also charged to its file and line, giving a cheap picture of
+     which call sites allocate the most.
+
+   The results can be read with the query functions or written out
+   as JSON with rq_instrument_write_json().
+*/
+
+/** The subsystems allocations are charged to. */
+enum rq_instrument_subsystem {
+    RQ_INSTRUMENT_SUBSYSTEM_OTHER,
+    RQ_INSTRUMENT_SUBSYSTEM_BOOTSTRAP,
+    RQ_INSTRUMENT_SUBSYSTEM_PRICING,
+    RQ_INSTRUMENT_SUBSYSTEM_MONTE_CARLO,
+    RQ_INSTRUMENT_SUBSYSTEM_XML,
+    RQ_INSTRUMENT_SUBSYSTEM_TERMSTRUCT,
+    RQ_INSTRUMENT_SUBSYSTEM_MARKET,
+    RQ_INSTRUMENT_SUBSYSTEM_TRADE,
+
+    RQ_INSTRUMENT_NUM_SUBSYSTEMS
+};
+
+/** The hot paths that are timed. */
+enum rq_instrument_timer {
+    RQ_INSTRUMENT_TIMER_BOOTSTRAP,
+    RQ_INSTRUMENT_TIMER_PRICING,
+    RQ_INSTRUMENT_TIMER_MONTE_CARLO,
+    RQ_INSTRUMENT_TIMER_XML_LOAD,
+
+    RQ_INSTRUMENT_NUM_TIMERS
+};
+
+/** The number of distinct call sites the sampler can track. Samples
+ * from further call sites are dropped.
+ */
+#define RQ_INSTRUMENT_MAX_CALL_SITES 1024
+
+struct rq_instrument_alloc_stats {
+    unsigned long allocs;
+    unsigned long reallocs;
+    unsigned long frees;
+    unsigned long bytes_allocated; /**< the total of all the sizes asked for */
+    long bytes_in_flight; /**< allocated and not yet freed */
+    long peak_bytes_in_flight;
+};
+
+struct rq_instrument_timer_stats {
+    unsigned long calls;
+    double total_seconds;
+    double max_seconds;
+};
+
+struct rq_instrument_call_site {
+    const char *file;
+    unsigned int line;
+    enum rq_instrument_subsystem subsystem;
+    unsigned long samples;
+    unsigned long bytes; /**< the total size of the sampled allocations */
+};
+
+/** Turn the instrumentation on or off. Turn it on before starting
+ * any threads that use the library.
+ */
+RQ_EXPORT void rq_instrument_set_enabled(int enabled);
+
+RQ_EXPORT int rq_instrument_is_enabled();
+
+/** Sample every Nth allocation made on each thread. 0, the
+ * default, turns sampling off.
+ */
+RQ_EXPORT void rq_instrument_set_sample_rate(unsigned long sample_rate);
+
+RQ_EXPORT unsigned long rq_instrument_get_sample_rate();
+
+/** Zero the counters, timers and call sites. Bytes still in flight
+ * are forgotten, so the in flight gauges can go negative as they
+ * are freed.
+ */
+RQ_EXPORT void rq_instrument_reset();
+
+/** Start timing. Pass the result to rq_instrument_timer_end().
+ */
+RQ_EXPORT double rq_instrument_timer_begin();
+
+/** Stop timing and charge the time since begin to the timer.
+ */
+RQ_EXPORT void rq_instrument_timer_end(enum rq_instrument_timer timer, double begin);
+
+/** Record an allocation made at file and line, returning the
+ * subsystem it was charged to. Called by rq_memdbg.
+ */
+RQ_EXPORT enum rq_instrument_subsystem rq_instrument_record_alloc(const char *file, unsigned int line, size_t size);
+
+/** Record a reallocation from old_size to size bytes.
+ */
+RQ_EXPORT void rq_instrument_record_realloc(enum rq_instrument_subsystem subsystem, size_t old_size, size_t size);
+
+/** Record the freeing of size bytes charged to subsystem.
+ */
+RQ_EXPORT void rq_instrument_record_free(enum rq_instrument_subsystem subsystem, size_t size);
+
+/** Work out which subsystem a source file belongs to.
+ */
+RQ_EXPORT enum rq_instrument_subsystem rq_instrument_get_subsystem_for_file(const char *file);
+
+RQ_EXPORT const char *rq_instrument_get_subsystem_name(enum rq_instrument_subsystem subsystem);
+
+RQ_EXPORT const char *rq_instrument_get_timer_name(enum rq_instrument_timer timer);
+
+RQ_EXPORT void rq_instrument_get_alloc_stats(enum rq_instrument_subsystem subsystem, struct rq_instrument_alloc_stats *stats);
+
+RQ_EXPORT void rq_instrument_get_timer_stats(enum rq_instrument_timer timer, struct rq_instrument_timer_stats *stats);
+
+/** Get the sampled call sites, the ones with the most bytes first.
+ *
+ * @return the number of call sites copied into call_sites
+ */
+RQ_EXPORT unsigned int rq_instrument_get_call_sites(struct rq_instrument_call_site *call_sites, unsigned int max_call_sites);
+
+/** Write the counters, timers and call sites to a stream as a JSON
+ * object.
+ */
+RQ_EXPORT void rq_instrument_write_json(rq_stream_t stream);
+
+#ifdef __cplusplus
+#if 0
+{ // purely to not screw up my indenting...
+#endif
+};
+#endif
+
+#endif
@@ -299,7 +299,7 @@ rq_interpreter_getc(struct rq_interpreter *i, rq_stream_t stream)
             unsigned new_buffer_size = 
                 i->parse_buffer_len + 
                 RQ_INTERP_PARSER_PARSE_BUFFER_GROW_SIZE;
-            i->parse_buffer = (char *)realloc(i->parse_buffer, new_buffer_size);
+            i->parse_buffer = (char *)RQ_REALLOC(i->parse_buffer, new_buffer_size);
             i->parse_buffer_len = new_buffer_size;
         }
 
@@ -328,7 +328,7 @@ add_char_to_token_buffer(struct rq_interpreter *i, char ch)
     {
         unsigned new_token_buffer_len = 
             i->token_buffer_len + RQ_INTERP_PARSER_TOKEN_BUFFER_GROW_SIZE;
-        i->token_buffer = (char *)realloc(
+        i->token_buffer = (char *)RQ_REALLOC(
             i->token_buffer, 
             new_token_buffer_len
             );
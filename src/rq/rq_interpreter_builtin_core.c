@@ -56,7 +56,7 @@ static rq_object_t
 rq_func_progn(void *interpreter, rq_object_t args)
 {
 	rq_object_t p = args;
-    rq_object_t res;
+    rq_object_t res = rq_object_nil;
     rq_interpreter_t interp = (rq_interpreter_t)interpreter;
 
     while (!rq_object_is_nil(p))
@@ -78,12 +78,64 @@ rq_func_if(void *interpreter, rq_object_t args)
     rq_interpreter_t interp = (rq_interpreter_t)interpreter;
 
 	res = rq_interpreter_eval(interp, if_test);
-    if (rq_object_is_nil(res))
+    if (!rq_object_is_nil(res))
 		return rq_interpreter_eval(interp, if_body);
 
 	return rq_func_progn(interpreter, else_body);
 }
 
+/* bind local variables, (let ((id value) ...) body...), the values
+   being evaluated before any of them are bound */
+static rq_object_t
+rq_func_let(void *interpreter, rq_object_t args)
+{
+    rq_interpreter_t interp = (rq_interpreter_t)interpreter;
+    rq_object_mgr_t object_mgr = rq_interpreter_get_object_mgr(interp);
+    rq_object_t values = rq_object_nil;
+    rq_object_t last = rq_object_nil;
+    rq_object_t bindings;
+    rq_object_t res;
+
+    for (bindings = rq_object_get_cons_car(args); !rq_object_is_nil(bindings); bindings = rq_object_get_cons_cdr(bindings))
+    {
+        rq_object_t binding = rq_object_get_cons_car(bindings);
+        rq_object_t value = rq_object_nil;
+        rq_object_t cell;
+
+        if (rq_object_get_object_type(binding) == RQ_OBJECT_TYPE_CONS)
+            value = rq_object_clone(
+                object_mgr, 
+                rq_interpreter_eval(interp, rq_object_get_cons_car(rq_object_get_cons_cdr(binding)))
+                );
+
+        cell = rq_object_alloc_cons(object_mgr, value, rq_object_nil);
+        if (rq_object_is_nil(last))
+            values = cell;
+        else
+            rq_object_set_cons_cdr(last, cell);
+        last = cell;
+    }
+
+    rq_interpreter_variable_block_enter(interp);
+
+    for (bindings = rq_object_get_cons_car(args); !rq_object_is_nil(bindings); bindings = rq_object_get_cons_cdr(bindings))
+    {
+        rq_object_t binding = rq_object_get_cons_car(bindings);
+        rq_object_t id = binding;
+
+        if (rq_object_get_object_type(binding) == RQ_OBJECT_TYPE_CONS)
+            id = rq_object_get_cons_car(binding);
+        rq_interpreter_set_local(interp, rq_object_coerce_identifier(id), rq_object_get_cons_car(values));
+        values = rq_object_get_cons_cdr(values);
+    }
+
+    res = rq_func_progn(interpreter, rq_object_get_cons_cdr(args));
+
+    rq_interpreter_variable_block_leave(interp);
+
+	return res;
+}
+
 static rq_object_t
 rq_func_defun(void *interpreter, rq_object_t args)
 {
@@ -222,6 +274,7 @@ rq_interpreter_builtin_core_register(rq_interpreter_t interp)
     rq_interpreter_add_builtin(interp, "setq", rq_func_setq);
     rq_interpreter_add_builtin(interp, "if", rq_func_if);
     rq_interpreter_add_builtin(interp, "progn", rq_func_progn);
+    rq_interpreter_add_builtin(interp, "let", rq_func_let);
     rq_interpreter_add_builtin(interp, "princ", rq_func_princ);
     rq_interpreter_add_builtin(interp, "defun", rq_func_defun);
 }
@@ -0,0 +1,140 @@
+/*
+** rq_interpreter_builtin_date.c
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#include "rq_interpreter_builtin_date.h"
+#include "rq_date.h"
+#include <stdlib.h>
+
+/* the value of a number or date as a long without coercing the object */
+static long
+eval_long(rq_interpreter_t interp, rq_object_t arg)
+{
+    rq_object_t obj = rq_interpreter_eval(interp, arg);
+
+    switch (rq_object_get_object_type(obj))
+    {
+        case RQ_OBJECT_TYPE_INTEGER:
+            return obj->value.i;
+
+        case RQ_OBJECT_TYPE_DOUBLE:
+            return (long)obj->value.d;
+
+        case RQ_OBJECT_TYPE_DATE:
+            return obj->value.date;
+
+        default:
+            break;
+    }
+
+    return 0;
+}
+
+static rq_object_t
+rq_func_add_days(void *interpreter, rq_object_t args)
+{
+    rq_interpreter_t interp = (rq_interpreter_t)interpreter;
+    rq_date date = eval_long(interp, rq_object_get_cons_car(args));
+    long days = eval_long(interp, rq_object_get_cons_car(rq_object_get_cons_cdr(args)));
+
+    return rq_object_alloc_date(rq_interpreter_get_object_mgr(interp), date + days);
+}
+
+static rq_object_t
+rq_func_add_months(void *interpreter, rq_object_t args)
+{
+    rq_interpreter_t interp = (rq_interpreter_t)interpreter;
+    rq_date date = eval_long(interp, rq_object_get_cons_car(args));
+    long months = eval_long(interp, rq_object_get_cons_car(rq_object_get_cons_cdr(args)));
+
+    return rq_object_alloc_date(rq_interpreter_get_object_mgr(interp), rq_date_add_months(date, (short)months, 0));
+}
+
+static rq_object_t
+rq_func_date_diff(void *interpreter, rq_object_t args)
+{
+    rq_interpreter_t interp = (rq_interpreter_t)interpreter;
+    rq_date d1 = eval_long(interp, rq_object_get_cons_car(args));
+    rq_date d2 = eval_long(interp, rq_object_get_cons_car(rq_object_get_cons_cdr(args)));
+
+    return rq_object_alloc_integer(rq_interpreter_get_object_mgr(interp), rq_date_diff(d1, d2));
+}
+
+static rq_object_t
+rq_func_year(void *interpreter, rq_object_t args)
+{
+    rq_interpreter_t interp = (rq_interpreter_t)interpreter;
+
+    return rq_object_alloc_integer(rq_interpreter_get_object_mgr(interp), rq_date_get_year(eval_long(interp, rq_object_get_cons_car(args))));
+}
+
+static rq_object_t
+rq_func_month(void *interpreter, rq_object_t args)
+{
+    rq_interpreter_t interp = (rq_interpreter_t)interpreter;
+
+    return rq_object_alloc_integer(rq_interpreter_get_object_mgr(interp), rq_date_get_month(eval_long(interp, rq_object_get_cons_car(args))));
+}
+
+static rq_object_t
+rq_func_day(void *interpreter, rq_object_t args)
+{
+    rq_interpreter_t interp = (rq_interpreter_t)interpreter;
+
+    return rq_object_alloc_integer(rq_interpreter_get_object_mgr(interp), rq_date_get_day(eval_long(interp, rq_object_get_cons_car(args))));
+}
+
+static const struct date_builtin {
+    const char *function_id;
+    rq_object_t (*func)(void *, rq_object_t);
+    enum rq_interpreter_date_op op;
+} date_builtins[] = {
+    { "add-days", rq_func_add_days, RQ_INTERPRETER_DATE_OP_ADD_DAYS },
+    { "add-months", rq_func_add_months, RQ_INTERPRETER_DATE_OP_ADD_MONTHS },
+    { "date-diff", rq_func_date_diff, RQ_INTERPRETER_DATE_OP_DIFF },
+    { "year", rq_func_year, RQ_INTERPRETER_DATE_OP_YEAR },
+    { "month", rq_func_month, RQ_INTERPRETER_DATE_OP_MONTH },
+    { "day", rq_func_day, RQ_INTERPRETER_DATE_OP_DAY },
+    { NULL, NULL, RQ_INTERPRETER_DATE_OP_NONE }
+};
+
+RQ_EXPORT void 
+rq_interpreter_builtin_date_register(rq_interpreter_t interp)
+{
+    const struct date_builtin *b;
+
+    for (b = date_builtins; b->function_id; b++)
+        rq_interpreter_add_builtin(interp, b->function_id, b->func);
+}
+
+RQ_EXPORT enum rq_interpreter_date_op
+rq_interpreter_builtin_date_get_op(rq_object_t builtin)
+{
+    const struct date_builtin *b;
+
+    if (rq_object_get_object_type(builtin) != RQ_OBJECT_TYPE_BUILTIN)
+        return RQ_INTERPRETER_DATE_OP_NONE;
+
+    for (b = date_builtins; b->function_id; b++)
+        if (b->func == builtin->value.func)
+            return b->op;
+
+    return RQ_INTERPRETER_DATE_OP_NONE;
+}
@@ -0,0 +1,77 @@
+/**
+ * @file
+ *
+ * The date builtin functions for the interpreter.
+ */
+/*
+** rq_interpreter_builtin_date.h
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#ifndef rq_interpreter_builtin_date_h
+#define rq_interpreter_builtin_date_h
+
+#include "rq_config.h"
+#include "rq_defs.h"
+#include "rq_interpreter.h"
+
+#ifdef __cplusplus
+extern "C" {
+#if 0
+} // purely to not screw up my indenting...
+#endif
+#endif
+
+/**
+ * The operations the date builtins perform, so that compiled
+ * programs can do them directly on dates held as doubles.
+ */
+enum rq_interpreter_date_op {
+    RQ_INTERPRETER_DATE_OP_NONE = 0, /**< Not a date builtin */
+    RQ_INTERPRETER_DATE_OP_ADD_DAYS,
+    RQ_INTERPRETER_DATE_OP_ADD_MONTHS,
+    RQ_INTERPRETER_DATE_OP_DIFF,
+    RQ_INTERPRETER_DATE_OP_YEAR,
+    RQ_INTERPRETER_DATE_OP_MONTH,
+    RQ_INTERPRETER_DATE_OP_DAY
+};
+
+/**
+ * Register the date builtins:
+ *
+ * (add-days date days), (add-months date months), (date-diff d1 d2),
+ * which returns d1 - d2 in days, and (year date), (month date) and
+ * (day date).
+ */
+RQ_EXPORT void rq_interpreter_builtin_date_register(rq_interpreter_t interp);
+
+/**
+ * Get the operation a builtin object performs, or
+ * RQ_INTERPRETER_DATE_OP_NONE if it isn't one of the date builtins.
+ */
+RQ_EXPORT enum rq_interpreter_date_op rq_interpreter_builtin_date_get_op(rq_object_t builtin);
+
+#ifdef __cplusplus
+#if 0
+{ // purely to not screw up my indenting...
+#endif
+};
+#endif
+
+#endif
@@ -24,6 +24,7 @@
 #include "rq_interpreter_builtin_math.h"
 #include <stdlib.h>
 #include <string.h>
+#include <math.h>
 
 /* add together the list of arguments */
 rq_object_t
@@ -105,7 +106,7 @@ rq_func_multiply(void *interpreter, rq_object_t args)
 
     res = rq_object_alloc_integer(
         rq_interpreter_get_object_mgr(interp), 
-        0
+        1
         );
     while (!rq_object_is_nil(args))
     {
@@ -166,11 +167,238 @@ rq_func_divide(void *interpreter, rq_object_t args)
     return res;
 }
 
+/* the value of a number, date or t without coercing the object */
+static double
+eval_double(rq_interpreter_t interp, rq_object_t arg)
+{
+    rq_object_t obj = rq_interpreter_eval(interp, arg);
+
+    switch (rq_object_get_object_type(obj))
+    {
+        case RQ_OBJECT_TYPE_TRUE:
+            return 1.0;
+
+        case RQ_OBJECT_TYPE_INTEGER:
+            return obj->value.i;
+
+        case RQ_OBJECT_TYPE_DOUBLE:
+            return obj->value.d;
+
+        case RQ_OBJECT_TYPE_DATE:
+            return obj->value.date;
+
+        default:
+            break;
+    }
+
+    return 0.0;
+}
+
+static rq_object_t
+min_max(rq_interpreter_t interp, rq_object_t args, int want_max)
+{
+    double res = 0.0;
+    int got_first = 0;
+
+    while (!rq_object_is_nil(args))
+    {
+        double d = eval_double(interp, rq_object_get_cons_car(args));
+        if (!got_first || (want_max ? d > res : d < res))
+            res = d;
+        got_first = 1;
+        args = rq_object_get_cons_cdr(args);
+    }
+
+    return rq_object_alloc_double(rq_interpreter_get_object_mgr(interp), res);
+}
+
+static rq_object_t
+rq_func_max(void *interpreter, rq_object_t args)
+{
+    return min_max((rq_interpreter_t)interpreter, args, 1);
+}
+
+static rq_object_t
+rq_func_min(void *interpreter, rq_object_t args)
+{
+    return min_max((rq_interpreter_t)interpreter, args, 0);
+}
+
+static rq_object_t
+unary(rq_interpreter_t interp, rq_object_t args, enum rq_interpreter_math_op op)
+{
+    double d = eval_double(interp, rq_object_get_cons_car(args));
+
+    switch (op)
+    {
+        case RQ_INTERPRETER_MATH_OP_ABS:
+            d = fabs(d);
+            break;
+
+        case RQ_INTERPRETER_MATH_OP_EXP:
+            d = exp(d);
+            break;
+
+        case RQ_INTERPRETER_MATH_OP_LOG:
+            d = log(d);
+            break;
+
+        case RQ_INTERPRETER_MATH_OP_SQRT:
+            d = sqrt(d);
+            break;
+
+        default:
+            break;
+    }
+
+    return rq_object_alloc_double(rq_interpreter_get_object_mgr(interp), d);
+}
+
+static rq_object_t
+rq_func_abs(void *interpreter, rq_object_t args)
+{
+    return unary((rq_interpreter_t)interpreter, args, RQ_INTERPRETER_MATH_OP_ABS);
+}
+
+static rq_object_t
+rq_func_exp(void *interpreter, rq_object_t args)
+{
+    return unary((rq_interpreter_t)interpreter, args, RQ_INTERPRETER_MATH_OP_EXP);
+}
+
+static rq_object_t
+rq_func_log(void *interpreter, rq_object_t args)
+{
+    return unary((rq_interpreter_t)interpreter, args, RQ_INTERPRETER_MATH_OP_LOG);
+}
+
+static rq_object_t
+rq_func_sqrt(void *interpreter, rq_object_t args)
+{
+    return unary((rq_interpreter_t)interpreter, args, RQ_INTERPRETER_MATH_OP_SQRT);
+}
+
+static rq_object_t
+rq_func_pow(void *interpreter, rq_object_t args)
+{
+    rq_interpreter_t interp = (rq_interpreter_t)interpreter;
+    double x = eval_double(interp, rq_object_get_cons_car(args));
+    double y = eval_double(interp, rq_object_get_cons_car(rq_object_get_cons_cdr(args)));
+
+    return rq_object_alloc_double(rq_interpreter_get_object_mgr(interp), pow(x, y));
+}
+
+/* compare two arguments, returning t or nil */
+static rq_object_t
+compare(rq_interpreter_t interp, rq_object_t args, enum rq_interpreter_math_op op)
+{
+    double x = eval_double(interp, rq_object_get_cons_car(args));
+    double y = eval_double(interp, rq_object_get_cons_car(rq_object_get_cons_cdr(args)));
+    int res = 0;
+
+    switch (op)
+    {
+        case RQ_INTERPRETER_MATH_OP_LESS:
+            res = x < y;
+            break;
+
+        case RQ_INTERPRETER_MATH_OP_GREATER:
+            res = x > y;
+            break;
+
+        case RQ_INTERPRETER_MATH_OP_LESS_EQUAL:
+            res = x <= y;
+            break;
+
+        case RQ_INTERPRETER_MATH_OP_GREATER_EQUAL:
+            res = x >= y;
+            break;
+
+        case RQ_INTERPRETER_MATH_OP_EQUAL:
+            res = x == y;
+            break;
+
+        default:
+            break;
+    }
+
+    return res ? rq_object_true : rq_object_nil;
+}
+
+static rq_object_t
+rq_func_less(void *interpreter, rq_object_t args)
+{
+    return compare((rq_interpreter_t)interpreter, args, RQ_INTERPRETER_MATH_OP_LESS);
+}
+
+static rq_object_t
+rq_func_greater(void *interpreter, rq_object_t args)
+{
+    return compare((rq_interpreter_t)interpreter, args, RQ_INTERPRETER_MATH_OP_GREATER);
+}
+
+static rq_object_t
+rq_func_less_equal(void *interpreter, rq_object_t args)
+{
+    return compare((rq_interpreter_t)interpreter, args, RQ_INTERPRETER_MATH_OP_LESS_EQUAL);
+}
+
+static rq_object_t
+rq_func_greater_equal(void *interpreter, rq_object_t args)
+{
+    return compare((rq_interpreter_t)interpreter, args, RQ_INTERPRETER_MATH_OP_GREATER_EQUAL);
+}
+
+static rq_object_t
+rq_func_equal(void *interpreter, rq_object_t args)
+{
+    return compare((rq_interpreter_t)interpreter, args, RQ_INTERPRETER_MATH_OP_EQUAL);
+}
+
+static const struct math_builtin {
+    const char *function_id;
+    rq_object_t (*func)(void *, rq_object_t);
+    enum rq_interpreter_math_op op;
+} math_builtins[] = {
+    { "+", rq_func_add, RQ_INTERPRETER_MATH_OP_ADD },
+    { "-", rq_func_substract, RQ_INTERPRETER_MATH_OP_SUBTRACT },
+    { "*", rq_func_multiply, RQ_INTERPRETER_MATH_OP_MULTIPLY },
+    { "/", rq_func_divide, RQ_INTERPRETER_MATH_OP_DIVIDE },
+    { "max", rq_func_max, RQ_INTERPRETER_MATH_OP_MAX },
+    { "min", rq_func_min, RQ_INTERPRETER_MATH_OP_MIN },
+    { "abs", rq_func_abs, RQ_INTERPRETER_MATH_OP_ABS },
+    { "exp", rq_func_exp, RQ_INTERPRETER_MATH_OP_EXP },
+    { "log", rq_func_log, RQ_INTERPRETER_MATH_OP_LOG },
+    { "sqrt", rq_func_sqrt, RQ_INTERPRETER_MATH_OP_SQRT },
+    { "pow", rq_func_pow, RQ_INTERPRETER_MATH_OP_POW },
+    { "<", rq_func_less, RQ_INTERPRETER_MATH_OP_LESS },
+    { ">", rq_func_greater, RQ_INTERPRETER_MATH_OP_GREATER },
+    { "<=", rq_func_less_equal, RQ_INTERPRETER_MATH_OP_LESS_EQUAL },
+    { ">=", rq_func_greater_equal, RQ_INTERPRETER_MATH_OP_GREATER_EQUAL },
+    { "=", rq_func_equal, RQ_INTERPRETER_MATH_OP_EQUAL },
+    { NULL, NULL, RQ_INTERPRETER_MATH_OP_NONE }
+};
+
 RQ_EXPORT void 
 rq_interpreter_builtin_math_register(rq_interpreter_t interp)
 {
-    rq_interpreter_add_builtin(interp, "+", rq_func_add);
-    rq_interpreter_add_builtin(interp, "-", rq_func_substract);
-    rq_interpreter_add_builtin(interp, "*", rq_func_multiply);
-    rq_interpreter_add_builtin(interp, "/", rq_func_multiply);
+    const struct math_builtin *b;
+
+    for (b = math_builtins; b->function_id; b++)
+        rq_interpreter_add_builtin(interp, b->function_id, b->func);
+}
+
+RQ_EXPORT enum rq_interpreter_math_op
+rq_interpreter_builtin_math_get_op(rq_object_t builtin)
+{
+    const struct math_builtin *b;
+
+    if (rq_object_get_object_type(builtin) != RQ_OBJECT_TYPE_BUILTIN)
+        return RQ_INTERPRETER_MATH_OP_NONE;
+
+    for (b = math_builtins; b->function_id; b++)
+        if (b->func == builtin->value.func)
+            return b->op;
+
+    return RQ_INTERPRETER_MATH_OP_NONE;
 }
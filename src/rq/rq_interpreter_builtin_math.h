@@ -40,8 +40,42 @@ extern "C" {
 #endif
 #endif
 
+/**
+ * The operations the math builtins perform, so that compiled
+ * programs can do them directly on doubles.
+ */
+enum rq_interpreter_math_op {
+    RQ_INTERPRETER_MATH_OP_NONE = 0, /**< Not a math builtin */
+    RQ_INTERPRETER_MATH_OP_ADD,
+    RQ_INTERPRETER_MATH_OP_SUBTRACT,
+    RQ_INTERPRETER_MATH_OP_MULTIPLY,
+    RQ_INTERPRETER_MATH_OP_DIVIDE,
+    RQ_INTERPRETER_MATH_OP_MAX,
+    RQ_INTERPRETER_MATH_OP_MIN,
+    RQ_INTERPRETER_MATH_OP_ABS,
+    RQ_INTERPRETER_MATH_OP_EXP,
+    RQ_INTERPRETER_MATH_OP_LOG,
+    RQ_INTERPRETER_MATH_OP_SQRT,
+    RQ_INTERPRETER_MATH_OP_POW,
+    RQ_INTERPRETER_MATH_OP_LESS,
+    RQ_INTERPRETER_MATH_OP_GREATER,
+    RQ_INTERPRETER_MATH_OP_LESS_EQUAL,
+    RQ_INTERPRETER_MATH_OP_GREATER_EQUAL,
+    RQ_INTERPRETER_MATH_OP_EQUAL
+};
+
+/**
+ * Register the math builtins: + - * / max min abs exp log sqrt pow
+ * and the comparisons < > <= >= =, which return t or nil.
+ */
 RQ_EXPORT void rq_interpreter_builtin_math_register(rq_interpreter_t interp);
 
+/**
+ * Get the operation a builtin object performs, or
+ * RQ_INTERPRETER_MATH_OP_NONE if it isn't one of the math builtins.
+ */
+RQ_EXPORT enum rq_interpreter_math_op rq_interpreter_builtin_math_get_op(rq_object_t builtin);
+
 #ifdef __cplusplus
 #if 0
 { // purely to not screw up my indenting...
@@ -0,0 +1,1155 @@
+/*
+** rq_interpreter_program.c
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#include "rq_interpreter_program.h"
+#include "rq_interpreter_builtin_math.h"
+#include "rq_interpreter_builtin_date.h"
+#include "rq_date.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/* -- defines ----------------------------------------------------- */
+#define MAX_REGISTERS 0x7fff
+#define MAX_CONSTANTS 0x7fff
+#define MAX_INSTRUCTIONS 0xffff /* jump targets are unsigned shorts */
+#define MAX_GLOBALS 0xffff
+#define MAX_INLINE_DEPTH 32
+
+/* marks a constant's register number until the other registers have
+   been counted and the constants can be put after them */
+#define CONSTANT_REGISTER 0x8000
+
+enum opcode {
+    OP_RETURN = 0, /* return a */
+    OP_MOVE, /* dst = a */
+    OP_LOAD_GLOBAL, /* dst = globals[a] */
+    OP_STORE_GLOBAL, /* globals[a] = b */
+    OP_JUMP, /* jump to a */
+    OP_JUMP_IF_ZERO, /* jump to a if b is zero */
+    OP_ADD,
+    OP_SUBTRACT,
+    OP_MULTIPLY,
+    OP_DIVIDE,
+    OP_INTEGER_ADD, /* the integer ops truncate to an int, as the interpreter does */
+    OP_INTEGER_SUBTRACT,
+    OP_INTEGER_MULTIPLY,
+    OP_INTEGER_DIVIDE,
+    OP_MAX,
+    OP_MIN,
+    OP_POW,
+    OP_ABS,
+    OP_EXP,
+    OP_LOG,
+    OP_SQRT,
+    OP_LESS,
+    OP_GREATER,
+    OP_LESS_EQUAL,
+    OP_GREATER_EQUAL,
+    OP_EQUAL,
+    OP_ADD_DAYS,
+    OP_DATE_DIFF,
+    OP_ADD_MONTHS,
+    OP_YEAR,
+    OP_MONTH,
+    OP_DAY
+};
+
+/* the type of object the interpreter would have for a value */
+enum kind {
+    KIND_INTEGER,
+    KIND_DOUBLE,
+    KIND_DATE,
+    KIND_TRUTH, /* t or nil */
+    KIND_MIXED /* different kinds from the branches of an if */
+};
+
+/* -- structs ----------------------------------------------------- */
+/* a parameter or local variable and the register holding it */
+struct binding {
+    const char *id;
+    unsigned short reg;
+    int kind;
+};
+
+struct compiler {
+    rq_interpreter_t interp;
+    struct rq_interpreter_program *program;
+    unsigned max_instructions;
+    unsigned max_globals;
+
+    double *constants;
+    unsigned num_constants;
+    unsigned max_constants;
+
+    struct binding *bindings;
+    unsigned num_bindings;
+    unsigned max_bindings;
+    unsigned scope; /**< The first binding visible to the form being compiled, other than the parameters */
+
+    unsigned next_register; /**< The first free register */
+    unsigned num_registers; /**< The most registers used */
+
+    rq_object_t inlining[MAX_INLINE_DEPTH]; /**< The functions being compiled inline */
+    unsigned depth;
+
+    int failed;
+};
+
+/* -- prototypes -------------------------------------------------- */
+static int compile_into(struct compiler *c, rq_object_t form, unsigned dst);
+static unsigned compile_operand(struct compiler *c, rq_object_t form, int *kind);
+static int compile_body(struct compiler *c, rq_object_t forms, unsigned dst);
+
+/* -- code -------------------------------------------------------- */
+static void
+compile_error(struct compiler *c, const char *message, const char *id)
+{
+    if (!c->failed)
+        rq_interpreter_signal_error(c->interp, RQ_ERROR_SEVERITY_CRITICAL, "compile: %s '%s'", message, id);
+    c->failed = 1;
+}
+
+static unsigned
+emit(struct compiler *c, unsigned op, unsigned dst, unsigned a, unsigned b)
+{
+    struct rq_interpreter_program *program = c->program;
+    struct rq_interpreter_instruction *ins;
+
+    if (program->num_instructions == MAX_INSTRUCTIONS)
+    {
+        compile_error(c, "too many instructions needed for", "form");
+        return 0;
+    }
+
+    if (program->num_instructions == c->max_instructions)
+    {
+        c->max_instructions *= 2;
+        program->code = (struct rq_interpreter_instruction *)RQ_REALLOC(
+            program->code, 
+            c->max_instructions * sizeof(struct rq_interpreter_instruction)
+            );
+    }
+
+    ins = program->code + program->num_instructions;
+    ins->op = (unsigned short)op;
+    ins->dst = (unsigned short)dst;
+    ins->a = (unsigned short)a;
+    ins->b = (unsigned short)b;
+
+    return program->num_instructions++;
+}
+
+static unsigned
+alloc_register(struct compiler *c)
+{
+    if (c->next_register == MAX_REGISTERS)
+    {
+        compile_error(c, "too many registers needed for", "form");
+        return 0;
+    }
+
+    c->next_register++;
+    if (c->next_register > c->num_registers)
+        c->num_registers = c->next_register;
+
+    return c->next_register - 1;
+}
+
+static unsigned
+constant(struct compiler *c, double value)
+{
+    unsigned i;
+
+    for (i = 0; i < c->num_constants; i++)
+        if (c->constants[i] == value)
+            return CONSTANT_REGISTER | i;
+
+    if (c->num_constants == MAX_CONSTANTS)
+    {
+        compile_error(c, "too many constants in", "form");
+        return CONSTANT_REGISTER;
+    }
+
+    if (c->num_constants == c->max_constants)
+    {
+        c->max_constants *= 2;
+        c->constants = (double *)RQ_REALLOC(c->constants, c->max_constants * sizeof(double));
+    }
+    c->constants[c->num_constants] = value;
+
+    return CONSTANT_REGISTER | c->num_constants++;
+}
+
+static void
+bind(struct compiler *c, const char *id, unsigned reg, int kind)
+{
+    if (c->num_bindings == c->max_bindings)
+    {
+        c->max_bindings *= 2;
+        c->bindings = (struct binding *)RQ_REALLOC(c->bindings, c->max_bindings * sizeof(struct binding));
+    }
+    c->bindings[c->num_bindings].id = id;
+    c->bindings[c->num_bindings].reg = (unsigned short)reg;
+    c->bindings[c->num_bindings].kind = kind;
+    c->num_bindings++;
+}
+
+/* a visible local variable or parameter, or NULL */
+static struct binding *
+find_binding(struct compiler *c, const char *id)
+{
+    unsigned i;
+
+    for (i = c->num_bindings; i > c->scope; i--)
+        if (!strcmp(c->bindings[i - 1].id, id))
+            return c->bindings + i - 1;
+
+    for (i = 0; i < c->program->num_params; i++)
+        if (!strcmp(c->bindings[i].id, id))
+            return c->bindings + i;
+
+    return NULL;
+}
+
+/* the number of a numeric symbol in the program's globals, and the
+   kind of value it has now */
+static unsigned
+find_global(struct compiler *c, const char *id, int *kind)
+{
+    struct rq_interpreter_program *program = c->program;
+    rq_object_t obj = rq_interpreter_symbol_find(c->interp, id);
+    unsigned i;
+
+    *kind = KIND_DOUBLE;
+    switch (rq_object_get_object_type(obj))
+    {
+        case RQ_OBJECT_TYPE_TRUE:
+            *kind = KIND_TRUTH;
+            break;
+
+        case RQ_OBJECT_TYPE_INTEGER:
+            *kind = KIND_INTEGER;
+            break;
+
+        case RQ_OBJECT_TYPE_DOUBLE:
+            *kind = KIND_DOUBLE;
+            break;
+
+        case RQ_OBJECT_TYPE_DATE:
+            *kind = KIND_DATE;
+            break;
+
+        case RQ_OBJECT_TYPE_NIL:
+            compile_error(c, "undefined variable", id);
+            return 0;
+
+        default:
+            compile_error(c, "can't compile the value of", id);
+            return 0;
+    }
+
+    for (i = 0; i < program->num_globals; i++)
+        if (program->globals[i] == obj)
+            return i;
+
+    if (program->num_globals == MAX_GLOBALS)
+    {
+        compile_error(c, "too many globals used by", "form");
+        return 0;
+    }
+
+    if (program->num_globals == c->max_globals)
+    {
+        c->max_globals *= 2;
+        program->globals = (rq_object_t *)RQ_REALLOC(program->globals, c->max_globals * sizeof(rq_object_t));
+    }
+    program->globals[program->num_globals] = obj;
+
+    return program->num_globals++;
+}
+
+/* a function defined with defun, or NULL */
+static rq_object_t
+get_lambda(rq_object_t func)
+{
+    rq_object_t car;
+
+    if (rq_object_get_object_type(func) != RQ_OBJECT_TYPE_CONS)
+        return NULL;
+
+    car = rq_object_get_cons_car(func);
+    if (rq_object_get_object_type(car) != RQ_OBJECT_TYPE_IDENTIFIER ||
+        strcmp(rq_object_get_identifier(car), "lambda"))
+        return NULL;
+
+    return func;
+}
+
+static unsigned
+count_forms(rq_object_t forms)
+{
+    unsigned n = 0;
+
+    while (rq_object_get_object_type(forms) == RQ_OBJECT_TYPE_CONS)
+    {
+        n++;
+        forms = rq_object_get_cons_cdr(forms);
+    }
+
+    return n;
+}
+
+/* 
+ * Whether evaluating the form could set a variable. A variable used
+ * as an operand is read straight from its register, so it has to be
+ * copied first if a later operand might set it.
+ */
+static int
+form_assigns(struct compiler *c, rq_object_t form)
+{
+    rq_object_t head;
+
+    if (rq_object_get_object_type(form) != RQ_OBJECT_TYPE_CONS)
+        return 0;
+
+    head = rq_object_get_cons_car(form);
+    if (rq_object_get_object_type(head) == RQ_OBJECT_TYPE_IDENTIFIER &&
+        (!strcmp(rq_object_get_identifier(head), "setq") || 
+         get_lambda(rq_interpreter_symbol_find(c->interp, rq_object_get_identifier(head)))))
+        return 1;
+
+    for (; rq_object_get_object_type(form) == RQ_OBJECT_TYPE_CONS; form = rq_object_get_cons_cdr(form))
+        if (form_assigns(c, rq_object_get_cons_car(form)))
+            return 1;
+
+    return 0;
+}
+
+/* the kind of a value that is one kind or another */
+static int
+join_kinds(int kind1, int kind2)
+{
+    return (kind1 == kind2 ? kind1 : KIND_MIXED);
+}
+
+/* whether the interpreter's integer and double arithmetic can be
+   matched for a value of the kind */
+static int
+check_arithmetic(struct compiler *c, int kind, const char *id)
+{
+    if (kind == KIND_TRUTH)
+        compile_error(c, "can't do arithmetic on t or nil in", id);
+    else if (kind == KIND_MIXED)
+        compile_error(c, "can't tell whether to use integer or double arithmetic in", id);
+    else
+        return 1;
+
+    return 0;
+}
+
+/* 
+ * An operation on the first two arguments, the first copied if the
+ * others might set it. If there's an integer op it's used unless an
+ * argument is a double, and the kind returned says which was used.
+ */
+static int
+compile_binary(struct compiler *c, const char *id, unsigned op, unsigned integer_op, rq_object_t args, unsigned dst)
+{
+    unsigned mark = c->next_register;
+    int a_kind;
+    unsigned a = compile_operand(c, rq_object_get_cons_car(args), &a_kind);
+    rq_object_t rest = rq_object_get_cons_cdr(args);
+    int b_kind;
+    unsigned b;
+    int kind = KIND_DOUBLE;
+
+    if (!(a & CONSTANT_REGISTER) && a < mark && form_assigns(c, rest))
+    {
+        unsigned t = alloc_register(c);
+        emit(c, OP_MOVE, t, a, 0);
+        a = t;
+    }
+
+    b = compile_operand(c, rq_object_get_cons_car(rest), &b_kind);
+    if (integer_op && check_arithmetic(c, a_kind, id) && check_arithmetic(c, b_kind, id) &&
+        a_kind != KIND_DOUBLE && b_kind != KIND_DOUBLE)
+    {
+        op = integer_op;
+        kind = KIND_INTEGER;
+    }
+    emit(c, op, dst, a, b);
+    c->next_register = mark;
+
+    return kind;
+}
+
+/* 
+ * + - * / max min: the first argument, then each of the others in
+ * turn. Like the interpreter, arithmetic stays in integers until it
+ * meets a double; max and min are always doubles.
+ */
+static int
+compile_variadic(struct compiler *c, const char *id, unsigned op, unsigned integer_op, rq_object_t args, unsigned dst)
+{
+    rq_object_t rest;
+    int kind;
+
+    if (rq_object_is_nil(args))
+    {
+        emit(c, OP_MOVE, dst, constant(c, op == OP_MULTIPLY ? 1.0 : 0.0), 0);
+        return (integer_op ? KIND_INTEGER : KIND_DOUBLE);
+    }
+
+    rest = rq_object_get_cons_cdr(args);
+    if (rq_object_is_nil(rest))
+    {
+        kind = compile_into(c, rq_object_get_cons_car(args), dst);
+        if (!integer_op)
+            return KIND_DOUBLE;
+        check_arithmetic(c, kind, id);
+        return (kind == KIND_DOUBLE ? KIND_DOUBLE : KIND_INTEGER);
+    }
+
+    kind = compile_binary(c, id, op, integer_op, args, dst);
+
+    for (rest = rq_object_get_cons_cdr(rest); !rq_object_is_nil(rest); rest = rq_object_get_cons_cdr(rest))
+    {
+        unsigned mark = c->next_register;
+        int arg_kind;
+        unsigned reg = compile_operand(c, rq_object_get_cons_car(rest), &arg_kind);
+
+        if (integer_op && check_arithmetic(c, arg_kind, id) && arg_kind == KIND_DOUBLE)
+            kind = KIND_DOUBLE;
+        emit(c, kind == KIND_DOUBLE ? op : integer_op, dst, dst, reg);
+        c->next_register = mark;
+    }
+
+    return kind;
+}
+
+static void
+compile_fixed(struct compiler *c, const char *id, unsigned op, unsigned num_args, rq_object_t args, unsigned dst)
+{
+    if (count_forms(args) != num_args)
+    {
+        compile_error(c, num_args == 1 ? "expected one argument to" : "expected two arguments to", id);
+        return;
+    }
+
+    if (num_args == 1)
+    {
+        unsigned mark = c->next_register;
+        int kind;
+        emit(c, op, dst, compile_operand(c, rq_object_get_cons_car(args), &kind), 0);
+        c->next_register = mark;
+    }
+    else
+        compile_binary(c, id, op, 0, args, dst);
+}
+
+static int
+compile_math(struct compiler *c, const char *id, enum rq_interpreter_math_op math_op, rq_object_t args, unsigned dst)
+{
+    switch (math_op)
+    {
+        case RQ_INTERPRETER_MATH_OP_ADD: return compile_variadic(c, id, OP_ADD, OP_INTEGER_ADD, args, dst);
+        case RQ_INTERPRETER_MATH_OP_SUBTRACT: return compile_variadic(c, id, OP_SUBTRACT, OP_INTEGER_SUBTRACT, args, dst);
+        case RQ_INTERPRETER_MATH_OP_MULTIPLY: return compile_variadic(c, id, OP_MULTIPLY, OP_INTEGER_MULTIPLY, args, dst);
+        case RQ_INTERPRETER_MATH_OP_DIVIDE: return compile_variadic(c, id, OP_DIVIDE, OP_INTEGER_DIVIDE, args, dst);
+        case RQ_INTERPRETER_MATH_OP_MAX: return compile_variadic(c, id, OP_MAX, 0, args, dst);
+        case RQ_INTERPRETER_MATH_OP_MIN: return compile_variadic(c, id, OP_MIN, 0, args, dst);
+        case RQ_INTERPRETER_MATH_OP_ABS: compile_fixed(c, id, OP_ABS, 1, args, dst); break;
+        case RQ_INTERPRETER_MATH_OP_EXP: compile_fixed(c, id, OP_EXP, 1, args, dst); break;
+        case RQ_INTERPRETER_MATH_OP_LOG: compile_fixed(c, id, OP_LOG, 1, args, dst); break;
+        case RQ_INTERPRETER_MATH_OP_SQRT: compile_fixed(c, id, OP_SQRT, 1, args, dst); break;
+        case RQ_INTERPRETER_MATH_OP_POW: compile_fixed(c, id, OP_POW, 2, args, dst); break;
+        case RQ_INTERPRETER_MATH_OP_LESS: compile_fixed(c, id, OP_LESS, 2, args, dst); return KIND_TRUTH;
+        case RQ_INTERPRETER_MATH_OP_GREATER: compile_fixed(c, id, OP_GREATER, 2, args, dst); return KIND_TRUTH;
+        case RQ_INTERPRETER_MATH_OP_LESS_EQUAL: compile_fixed(c, id, OP_LESS_EQUAL, 2, args, dst); return KIND_TRUTH;
+        case RQ_INTERPRETER_MATH_OP_GREATER_EQUAL: compile_fixed(c, id, OP_GREATER_EQUAL, 2, args, dst); return KIND_TRUTH;
+        case RQ_INTERPRETER_MATH_OP_EQUAL: compile_fixed(c, id, OP_EQUAL, 2, args, dst); return KIND_TRUTH;
+        default: compile_error(c, "can't compile", id); break;
+    }
+
+    return KIND_DOUBLE;
+}
+
+static int
+compile_date(struct compiler *c, const char *id, enum rq_interpreter_date_op date_op, rq_object_t args, unsigned dst)
+{
+    switch (date_op)
+    {
+        case RQ_INTERPRETER_DATE_OP_ADD_DAYS: compile_fixed(c, id, OP_ADD_DAYS, 2, args, dst); return KIND_DATE;
+        case RQ_INTERPRETER_DATE_OP_ADD_MONTHS: compile_fixed(c, id, OP_ADD_MONTHS, 2, args, dst); return KIND_DATE;
+        case RQ_INTERPRETER_DATE_OP_DIFF: compile_fixed(c, id, OP_DATE_DIFF, 2, args, dst); break;
+        case RQ_INTERPRETER_DATE_OP_YEAR: compile_fixed(c, id, OP_YEAR, 1, args, dst); break;
+        case RQ_INTERPRETER_DATE_OP_MONTH: compile_fixed(c, id, OP_MONTH, 1, args, dst); break;
+        case RQ_INTERPRETER_DATE_OP_DAY: compile_fixed(c, id, OP_DAY, 1, args, dst); break;
+        default: compile_error(c, "can't compile", id); break;
+    }
+
+    return KIND_INTEGER;
+}
+
+/* 
+ * (if test then else...). Only nil is false to the interpreter,
+ * where a number is true even if it's 0, so the test has to be t or
+ * nil, such as a comparison, to be compiled as 1 or 0.
+ */
+static int
+compile_if(struct compiler *c, rq_object_t args, unsigned dst)
+{
+    unsigned mark = c->next_register;
+    unsigned jump_to_else;
+    unsigned jump_to_end;
+    unsigned test;
+    int kind;
+
+    if (count_forms(args) < 2)
+    {
+        compile_error(c, "expected a test and a body for", "if");
+        return KIND_MIXED;
+    }
+
+    test = compile_operand(c, rq_object_get_cons_car(args), &kind);
+    if (kind != KIND_TRUTH)
+        compile_error(c, "expected a comparison as the test of", "if");
+    jump_to_else = emit(c, OP_JUMP_IF_ZERO, 0, 0, test);
+    c->next_register = mark;
+
+    args = rq_object_get_cons_cdr(args);
+    kind = compile_into(c, rq_object_get_cons_car(args), dst);
+    jump_to_end = emit(c, OP_JUMP, 0, 0, 0);
+
+    c->program->code[jump_to_else].a = (unsigned short)c->program->num_instructions;
+    kind = join_kinds(kind, compile_body(c, rq_object_get_cons_cdr(args), dst));
+    c->program->code[jump_to_end].a = (unsigned short)c->program->num_instructions;
+
+    return kind;
+}
+
+/* 
+ * (setq id value ...). A global keeps the type it has, so it can only
+ * be set to a value of that type, as the interpreter would give it
+ * the type of the value.
+ */
+static int
+compile_setq(struct compiler *c, rq_object_t args, unsigned dst)
+{
+    int kind = KIND_TRUTH;
+
+    if (rq_object_is_nil(args))
+        emit(c, OP_MOVE, dst, constant(c, 0.0), 0);
+
+    while (!rq_object_is_nil(args) && !c->failed)
+    {
+        rq_object_t id = rq_object_get_cons_car(args);
+        rq_object_t rest = rq_object_get_cons_cdr(args);
+        unsigned mark = c->next_register;
+        struct binding *binding;
+        unsigned t;
+
+        if (rq_object_get_object_type(id) != RQ_OBJECT_TYPE_IDENTIFIER || rq_object_is_nil(rest))
+        {
+            compile_error(c, "expected identifiers and values for", "setq");
+            break;
+        }
+
+        /* into a temporary, as the value may use the variable's old value */
+        t = alloc_register(c);
+        kind = compile_into(c, rq_object_get_cons_car(rest), t);
+
+        binding = find_binding(c, rq_object_get_identifier(id));
+        if (binding)
+        {
+            binding->kind = join_kinds(binding->kind, kind);
+            emit(c, OP_MOVE, binding->reg, t, 0);
+        }
+        else
+        {
+            int global_kind;
+            unsigned global = find_global(c, rq_object_get_identifier(id), &global_kind);
+
+            if (global_kind == KIND_TRUTH)
+                compile_error(c, "can't compile setting", rq_object_get_identifier(id));
+            else if (kind != global_kind)
+                compile_error(c, "can't change the type of", rq_object_get_identifier(id));
+            emit(c, OP_STORE_GLOBAL, 0, global, t);
+        }
+        emit(c, OP_MOVE, dst, t, 0);
+
+        c->next_register = mark;
+        args = rq_object_get_cons_cdr(rest);
+    }
+
+    return kind;
+}
+
+/* (let ((id value) ...) body...), the values evaluated before any are bound */
+static int
+compile_let(struct compiler *c, rq_object_t args, unsigned dst)
+{
+    unsigned mark = c->next_register;
+    unsigned first_binding = c->num_bindings;
+    unsigned num_values = count_forms(rq_object_get_cons_car(args));
+    int *kinds = (int *)RQ_MALLOC((num_values + 1) * sizeof(int));
+    rq_object_t bindings;
+    unsigned i;
+    int kind;
+
+    for (bindings = rq_object_get_cons_car(args), i = 0; !rq_object_is_nil(bindings); bindings = rq_object_get_cons_cdr(bindings), i++)
+    {
+        rq_object_t binding = rq_object_get_cons_car(bindings);
+        unsigned reg = alloc_register(c);
+
+        if (rq_object_get_object_type(binding) == RQ_OBJECT_TYPE_CONS)
+            kinds[i] = compile_into(c, rq_object_get_cons_car(rq_object_get_cons_cdr(binding)), reg);
+        else
+        {
+            emit(c, OP_MOVE, reg, constant(c, 0.0), 0);
+            kinds[i] = KIND_TRUTH;
+        }
+    }
+
+    for (bindings = rq_object_get_cons_car(args), i = 0; !rq_object_is_nil(bindings); bindings = rq_object_get_cons_cdr(bindings), i++)
+    {
+        rq_object_t binding = rq_object_get_cons_car(bindings);
+        rq_object_t id = binding;
+
+        if (rq_object_get_object_type(binding) == RQ_OBJECT_TYPE_CONS)
+            id = rq_object_get_cons_car(binding);
+        if (rq_object_get_object_type(id) != RQ_OBJECT_TYPE_IDENTIFIER)
+        {
+            compile_error(c, "expected identifiers to bind in", "let");
+            break;
+        }
+        bind(c, rq_object_get_identifier(id), mark + i, kinds[i]);
+    }
+    RQ_FREE(kinds);
+
+    kind = compile_body(c, rq_object_get_cons_cdr(args), dst);
+
+    c->num_bindings = first_binding;
+    c->next_register = mark;
+
+    return kind;
+}
+
+/* a call to a function defined with defun, compiled inline */
+static int
+compile_inline(struct compiler *c, const char *id, rq_object_t lambda, rq_object_t args, unsigned dst)
+{
+    rq_object_t params = rq_object_get_cons_car(rq_object_get_cons_cdr(lambda));
+    unsigned mark = c->next_register;
+    unsigned first_binding = c->num_bindings;
+    unsigned saved_scope = c->scope;
+    unsigned num_params = count_forms(params);
+    int *kinds;
+    unsigned i;
+    int kind;
+
+    for (i = 0; i < c->depth; i++)
+        if (c->inlining[i] == lambda)
+        {
+            compile_error(c, "can't compile the recursive function", id);
+            return KIND_MIXED;
+        }
+    if (c->depth == MAX_INLINE_DEPTH)
+    {
+        compile_error(c, "functions nested too deeply at", id);
+        return KIND_MIXED;
+    }
+    if (count_forms(args) != num_params)
+    {
+        compile_error(c, "wrong number of arguments to", id);
+        return KIND_MIXED;
+    }
+
+    /* the arguments are evaluated where the function is called */
+    kinds = (int *)RQ_MALLOC((num_params + 1) * sizeof(int));
+    for (i = 0; !rq_object_is_nil(args); args = rq_object_get_cons_cdr(args), i++)
+        kinds[i] = compile_into(c, rq_object_get_cons_car(args), alloc_register(c));
+
+    /* and the body only sees the function's parameters */
+    c->scope = c->num_bindings;
+    for (i = 0; i < num_params; i++, params = rq_object_get_cons_cdr(params))
+    {
+        rq_object_t param = rq_object_get_cons_car(params);
+
+        if (rq_object_get_object_type(param) != RQ_OBJECT_TYPE_IDENTIFIER)
+        {
+            compile_error(c, "expected identifiers as the parameters of", id);
+            break;
+        }
+        bind(c, rq_object_get_identifier(param), mark + i, kinds[i]);
+    }
+    RQ_FREE(kinds);
+
+    c->inlining[c->depth++] = lambda;
+    kind = compile_body(c, rq_object_get_cons_cdr(rq_object_get_cons_cdr(lambda)), dst);
+    c->depth--;
+
+    c->scope = saved_scope;
+    c->num_bindings = first_binding;
+    c->next_register = mark;
+
+    return kind;
+}
+
+static int
+compile_call(struct compiler *c, rq_object_t form, unsigned dst)
+{
+    rq_object_t head = rq_object_get_cons_car(form);
+    rq_object_t args = rq_object_get_cons_cdr(form);
+    enum rq_interpreter_math_op math_op;
+    enum rq_interpreter_date_op date_op;
+    rq_object_t func;
+    rq_object_t lambda;
+    const char *id;
+
+    if (rq_object_get_object_type(head) != RQ_OBJECT_TYPE_IDENTIFIER)
+    {
+        compile_error(c, "expected a function name in", "form");
+        return KIND_MIXED;
+    }
+    id = rq_object_get_identifier(head);
+
+    if (!strcmp(id, "if"))
+        return compile_if(c, args, dst);
+    if (!strcmp(id, "progn"))
+        return compile_body(c, args, dst);
+    if (!strcmp(id, "setq"))
+        return compile_setq(c, args, dst);
+    if (!strcmp(id, "let"))
+        return compile_let(c, args, dst);
+
+    func = rq_interpreter_symbol_find(c->interp, id);
+    if ((math_op = rq_interpreter_builtin_math_get_op(func)) != RQ_INTERPRETER_MATH_OP_NONE)
+        return compile_math(c, id, math_op, args, dst);
+    if ((date_op = rq_interpreter_builtin_date_get_op(func)) != RQ_INTERPRETER_DATE_OP_NONE)
+        return compile_date(c, id, date_op, args, dst);
+    if ((lambda = get_lambda(func)) != NULL)
+        return compile_inline(c, id, lambda, args, dst);
+
+    if (rq_object_is_nil(func))
+        compile_error(c, "undefined function", id);
+    else
+        compile_error(c, "can't compile a call to", id);
+
+    return KIND_MIXED;
+}
+
+/* 
+ * Compile the form to leave its value in dst, freeing any registers
+ * used, and return the kind of value it is.
+ */
+static int
+compile_into(struct compiler *c, rq_object_t form, unsigned dst)
+{
+    unsigned mark = c->next_register;
+    int kind = KIND_MIXED;
+    const char *id;
+
+    if (c->failed)
+        return kind;
+
+    switch (rq_object_get_object_type(form))
+    {
+        case RQ_OBJECT_TYPE_CONS:
+            kind = compile_call(c, form, dst);
+            break;
+
+        case RQ_OBJECT_TYPE_IDENTIFIER:
+            id = rq_object_get_identifier(form);
+            if (!find_binding(c, id))
+            {
+                unsigned global = find_global(c, id, &kind);
+                emit(c, OP_LOAD_GLOBAL, dst, global, 0);
+                break;
+            }
+            /* FALLTHRU */
+
+        default:
+            emit(c, OP_MOVE, dst, compile_operand(c, form, &kind), 0);
+            break;
+    }
+
+    c->next_register = mark;
+
+    return kind;
+}
+
+/* the register holding the form's value, allocating one if it's needed */
+static unsigned
+compile_operand(struct compiler *c, rq_object_t form, int *kind)
+{
+    struct binding *binding;
+    unsigned reg;
+
+    switch (rq_object_get_object_type(form))
+    {
+        case RQ_OBJECT_TYPE_NIL:
+            *kind = KIND_TRUTH;
+            return constant(c, 0.0);
+
+        case RQ_OBJECT_TYPE_TRUE:
+            *kind = KIND_TRUTH;
+            return constant(c, 1.0);
+
+        case RQ_OBJECT_TYPE_INTEGER:
+            *kind = KIND_INTEGER;
+            return constant(c, form->value.i);
+
+        case RQ_OBJECT_TYPE_DOUBLE:
+            *kind = KIND_DOUBLE;
+            return constant(c, form->value.d);
+
+        case RQ_OBJECT_TYPE_DATE:
+            *kind = KIND_DATE;
+            return constant(c, form->value.date);
+
+        case RQ_OBJECT_TYPE_IDENTIFIER:
+            binding = find_binding(c, rq_object_get_identifier(form));
+            if (binding)
+            {
+                *kind = binding->kind;
+                return binding->reg;
+            }
+            /* FALLTHRU */
+
+        case RQ_OBJECT_TYPE_CONS:
+            reg = alloc_register(c);
+            *kind = compile_into(c, form, reg);
+            return reg;
+
+        default:
+            compile_error(c, "can't compile a", rq_object_get_object_type(form) == RQ_OBJECT_TYPE_STRING ? "string" : "value");
+            break;
+    }
+
+    *kind = KIND_MIXED;
+    return constant(c, 0.0);
+}
+
+/* the forms one after the other, the last one's value left in dst */
+static int
+compile_body(struct compiler *c, rq_object_t forms, unsigned dst)
+{
+    int kind = KIND_TRUTH;
+
+    if (rq_object_is_nil(forms))
+        emit(c, OP_MOVE, dst, constant(c, 0.0), 0);
+
+    for (; !rq_object_is_nil(forms); forms = rq_object_get_cons_cdr(forms))
+        kind = compile_into(c, rq_object_get_cons_car(forms), dst);
+
+    return kind;
+}
+
+static unsigned short
+constant_to_register(unsigned short reg, unsigned num_registers)
+{
+    if (reg & CONSTANT_REGISTER)
+        return (unsigned short)(num_registers + (reg & ~CONSTANT_REGISTER));
+    return reg;
+}
+
+RQ_EXPORT rq_interpreter_program_t
+rq_interpreter_program_compile(
+    rq_interpreter_t interp, 
+    rq_object_t form, 
+    const char **param_ids,
+    unsigned num_params
+    )
+{
+    struct rq_interpreter_program *program = (struct rq_interpreter_program *)RQ_CALLOC(1, sizeof(struct rq_interpreter_program));
+    struct compiler c;
+    unsigned result;
+    unsigned i;
+
+    memset(&c, 0, sizeof(c));
+    c.interp = interp;
+    c.program = program;
+    c.max_instructions = 16;
+    c.max_globals = 4;
+    c.max_constants = 8;
+    c.max_bindings = num_params + 8;
+    c.constants = (double *)RQ_MALLOC(c.max_constants * sizeof(double));
+    c.bindings = (struct binding *)RQ_MALLOC(c.max_bindings * sizeof(struct binding));
+    program->code = (struct rq_interpreter_instruction *)RQ_MALLOC(c.max_instructions * sizeof(struct rq_interpreter_instruction));
+    program->globals = (rq_object_t *)RQ_MALLOC(c.max_globals * sizeof(rq_object_t));
+    program->num_params = num_params;
+
+    for (i = 0; i < num_params; i++)
+        bind(&c, param_ids[i], alloc_register(&c), KIND_DOUBLE);
+    c.scope = c.num_bindings;
+
+    result = alloc_register(&c);
+    compile_into(&c, form, result);
+    emit(&c, OP_RETURN, 0, result, 0);
+
+    if (c.failed)
+    {
+        RQ_FREE(c.constants);
+        RQ_FREE(c.bindings);
+        rq_interpreter_program_free(program);
+        return NULL;
+    }
+
+    /* the constants go after the other registers */
+    for (i = 0; i < program->num_instructions; i++)
+    {
+        struct rq_interpreter_instruction *ins = program->code + i;
+
+        switch (ins->op)
+        {
+            case OP_LOAD_GLOBAL:
+            case OP_JUMP:
+                break;
+
+            case OP_STORE_GLOBAL:
+            case OP_JUMP_IF_ZERO:
+                ins->b = constant_to_register(ins->b, c.num_registers);
+                break;
+
+            default:
+                ins->a = constant_to_register(ins->a, c.num_registers);
+                ins->b = constant_to_register(ins->b, c.num_registers);
+                break;
+        }
+    }
+
+    program->num_registers = c.num_registers + c.num_constants;
+    program->registers = (double *)RQ_CALLOC(program->num_registers, sizeof(double));
+    memcpy(program->registers + c.num_registers, c.constants, c.num_constants * sizeof(double));
+
+    RQ_FREE(c.constants);
+    RQ_FREE(c.bindings);
+
+    return program;
+}
+
+RQ_EXPORT void
+rq_interpreter_program_free(rq_interpreter_program_t program)
+{
+    RQ_FREE(program->code);
+    RQ_FREE(program->globals);
+    if (program->registers)
+        RQ_FREE(program->registers);
+    RQ_FREE(program);
+}
+
+/* the value of a global without coercing the object */
+static double
+global_value(rq_object_t obj)
+{
+    switch (obj->object_type)
+    {
+        case RQ_OBJECT_TYPE_TRUE:
+            return 1.0;
+
+        case RQ_OBJECT_TYPE_INTEGER:
+            return obj->value.i;
+
+        case RQ_OBJECT_TYPE_DOUBLE:
+            return obj->value.d;
+
+        case RQ_OBJECT_TYPE_DATE:
+            return obj->value.date;
+
+        default:
+            break;
+    }
+
+    return 0.0;
+}
+
+/* set a global, keeping the type of object it is */
+static void
+store_global(rq_object_t obj, double value)
+{
+    switch (obj->object_type)
+    {
+        case RQ_OBJECT_TYPE_INTEGER:
+            rq_object_set_integer(obj, (int)(long)value);
+            break;
+
+        case RQ_OBJECT_TYPE_DATE:
+            rq_object_set_date(obj, (rq_date)value);
+            break;
+
+        default:
+            rq_object_set_double(obj, value);
+            break;
+    }
+}
+
+RQ_EXPORT double
+rq_interpreter_program_eval(rq_interpreter_program_t program, const double *params)
+{
+    const struct rq_interpreter_instruction *code = program->code;
+    const struct rq_interpreter_instruction *ip = code;
+    double *r = program->registers;
+
+    if (program->num_params)
+        memcpy(r, params, program->num_params * sizeof(double));
+
+    for (;;)
+    {
+        switch (ip->op)
+        {
+            case OP_RETURN:
+                return r[ip->a];
+
+            case OP_MOVE:
+                r[ip->dst] = r[ip->a];
+                break;
+
+            case OP_LOAD_GLOBAL:
+                r[ip->dst] = global_value(program->globals[ip->a]);
+                break;
+
+            case OP_STORE_GLOBAL:
+                store_global(program->globals[ip->a], r[ip->b]);
+                break;
+
+            case OP_JUMP:
+                ip = code + ip->a;
+                continue;
+
+            case OP_JUMP_IF_ZERO:
+                if (r[ip->b] == 0.0)
+                {
+                    ip = code + ip->a;
+                    continue;
+                }
+                break;
+
+            case OP_ADD:
+                r[ip->dst] = r[ip->a] + r[ip->b];
+                break;
+
+            case OP_SUBTRACT:
+                r[ip->dst] = r[ip->a] - r[ip->b];
+                break;
+
+            case OP_MULTIPLY:
+                r[ip->dst] = r[ip->a] * r[ip->b];
+                break;
+
+            case OP_DIVIDE:
+                r[ip->dst] = r[ip->a] / r[ip->b];
+                break;
+
+            case OP_INTEGER_ADD:
+                r[ip->dst] = (int)((long)r[ip->a] + (long)r[ip->b]);
+                break;
+
+            case OP_INTEGER_SUBTRACT:
+                r[ip->dst] = (int)((long)r[ip->a] - (long)r[ip->b]);
+                break;
+
+            case OP_INTEGER_MULTIPLY:
+                r[ip->dst] = (int)((long)r[ip->a] * (long)r[ip->b]);
+                break;
+
+            case OP_INTEGER_DIVIDE:
+                /* 0 rather than a trap for a division by zero */
+                r[ip->dst] = ((long)r[ip->b] ? (int)((long)r[ip->a] / (long)r[ip->b]) : 0);
+                break;
+
+            case OP_MAX:
+                r[ip->dst] = (r[ip->b] > r[ip->a] ? r[ip->b] : r[ip->a]);
+                break;
+
+            case OP_MIN:
+                r[ip->dst] = (r[ip->b] < r[ip->a] ? r[ip->b] : r[ip->a]);
+                break;
+
+            case OP_POW:
+                r[ip->dst] = pow(r[ip->a], r[ip->b]);
+                break;
+
+            case OP_ABS:
+                r[ip->dst] = fabs(r[ip->a]);
+                break;
+
+            case OP_EXP:
+                r[ip->dst] = exp(r[ip->a]);
+                break;
+
+            case OP_LOG:
+                r[ip->dst] = log(r[ip->a]);
+                break;
+
+            case OP_SQRT:
+                r[ip->dst] = sqrt(r[ip->a]);
+                break;
+
+            case OP_LESS:
+                r[ip->dst] = (r[ip->a] < r[ip->b]);
+                break;
+
+            case OP_GREATER:
+                r[ip->dst] = (r[ip->a] > r[ip->b]);
+                break;
+
+            case OP_LESS_EQUAL:
+                r[ip->dst] = (r[ip->a] <= r[ip->b]);
+                break;
+
+            case OP_GREATER_EQUAL:
+                r[ip->dst] = (r[ip->a] >= r[ip->b]);
+                break;
+
+            case OP_EQUAL:
+                r[ip->dst] = (r[ip->a] == r[ip->b]);
+                break;
+
+            case OP_ADD_DAYS:
+                r[ip->dst] = (rq_date)r[ip->a] + (long)r[ip->b];
+                break;
+
+            case OP_DATE_DIFF:
+                r[ip->dst] = rq_date_diff((rq_date)r[ip->a], (rq_date)r[ip->b]);
+                break;
+
+            case OP_ADD_MONTHS:
+                r[ip->dst] = rq_date_add_months((rq_date)r[ip->a], (short)(long)r[ip->b], 0);
+                break;
+
+            case OP_YEAR:
+                r[ip->dst] = rq_date_get_year((rq_date)r[ip->a]);
+                break;
+
+            case OP_MONTH:
+                r[ip->dst] = rq_date_get_month((rq_date)r[ip->a]);
+                break;
+
+            case OP_DAY:
+                r[ip->dst] = rq_date_get_day((rq_date)r[ip->a]);
+                break;
+        }
+
+        ip++;
+    }
+}
@@ -0,0 +1,146 @@
+/**
+ * @file
+ *
+ * Compile interpreter forms into bytecode for a small register machine.
+ */
+/*
+** rq_interpreter_program.h
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#ifndef rq_interpreter_program_h
+#define rq_interpreter_program_h
+
+#include "rq_config.h"
+#include "rq_defs.h"
+#include "rq_interpreter.h"
+
+#ifdef __cplusplus
+extern "C" {
+#if 0
+} // purely to not screw up my indenting...
+#endif
+#endif
+
+/* -- structs ----------------------------------------------------- */
+/**
+ * An instruction. The operands are register numbers, apart from
+ * jump targets, which are instruction offsets, and global numbers.
+ */
+struct rq_interpreter_instruction {
+    unsigned short op;
+    unsigned short dst;
+    unsigned short a;
+    unsigned short b;
+};
+
+/**
+ * A compiled form. 
+ *
+ * Everything is a double in a compiled program: numbers, dates (as
+ * their julian day) and truth values, where nil and false
+ * comparisons are 0 and t and true comparisons are 1. The compiler
+ * keeps track of the type the interpreter would have for each value
+ * so that the program gives the same answers:
+ *
+ * - Arithmetic on integers and dates is done in integers, truncated
+ *   to an int, until it meets a double, so (/ 7 2) is 3. Arithmetic
+ *   on t or nil, or on a value that could be an integer or a double
+ *   depending on the branch an if takes, can't be compiled. The
+ *   parameters are doubles.
+ * - The interpreter treats only nil as false, so a number used as
+ *   the test of an if is always true there, even if it's 0. The
+ *   test of a compiled if therefore has to be t or nil, such as a
+ *   comparison or a function returning one.
+ * - Setting a global keeps the type of object it has, so it can only
+ *   be set to a value of the same type, and not when it's t.
+ *
+ * The parameters, local variables, temporaries and constants all
+ * live in one array of registers, the parameters first and the
+ * constants last.
+ *
+ * Local variables bound by let and the parameters of functions
+ * defined with defun are given registers when the program is
+ * compiled, and calls to such functions are compiled inline. Any
+ * other identifier is looked up in the interpreter's symbol table
+ * once, when the program is compiled, and its object read each time
+ * the program runs, so setting the symbol later changes the result
+ * without compiling again, although the types of globals are taken
+ * when the program is compiled.
+ */
+typedef struct rq_interpreter_program {
+    struct rq_interpreter_instruction *code;
+    unsigned num_instructions;
+
+    rq_object_t *globals; /**< The symbol objects read by the program */
+    unsigned num_globals;
+
+    double *registers;
+    unsigned num_registers; /**< Including the constants */
+    unsigned num_params;
+} *rq_interpreter_program_t;
+
+/* -- prototypes -------------------------------------------------- */
+/**
+ * Compile a form into a program.
+ *
+ * The form can use the math and date builtins, if, progn, setq, let
+ * and functions defined with defun, as long as they don't call
+ * themselves. Arithmetic is done in doubles. As functions are
+ * compiled inline, a form that calls them many times over can be
+ * too big to compile; a program is limited to 65535 instructions.
+ *
+ * @param interp The interpreter with the symbols the form uses. 
+ * Compile at the top level, rather than from inside a builtin, so
+ * that the symbols found aren't local ones.
+ * @param form The form to compile
+ * @param param_ids The identifiers the form uses for the values
+ * passed to rq_interpreter_program_eval.
+ * @param num_params The number of parameters
+ * @return The program, or NULL if the form can't be compiled, in
+ * which case an error has been signalled in the interpreter.
+ */
+RQ_EXPORT rq_interpreter_program_t
+rq_interpreter_program_compile(
+    rq_interpreter_t interp, 
+    rq_object_t form, 
+    const char **param_ids,
+    unsigned num_params
+    );
+
+/**
+ * Free a compiled program.
+ */
+RQ_EXPORT void rq_interpreter_program_free(rq_interpreter_program_t program);
+
+/**
+ * Run a program with the parameter values passed, returning its
+ * result. A program keeps its registers, so run it from one thread
+ * at a time.
+ */
+RQ_EXPORT double rq_interpreter_program_eval(rq_interpreter_program_t program, const double *params);
+
+#ifdef __cplusplus
+#if 0
+{ // purely to not screw up my indenting...
+#endif
+};
+#endif
+
+#endif
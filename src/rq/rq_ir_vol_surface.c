@@ -27,7 +27,7 @@
 #include <string.h>
 #include <stdio.h>
 
-static unsigned short s_default_max_curves = 16;
+static const unsigned short s_default_max_curves = 16;
 
 
 RQ_EXPORT rq_ir_vol_surface_t
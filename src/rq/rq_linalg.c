@@ -0,0 +1,643 @@
+/*
+** rq_linalg.c
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#include "rq_linalg.h"
+#include "rq_math.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#ifdef RQ_USE_CBLAS
+#include <cblas.h>
+#endif
+
+#ifdef RQ_USE_LAPACKE
+#include <lapacke.h>
+#endif
+
+/* Block sizes for the GEMM kernel. A block of A (BLOCK_M x BLOCK_K)
+   plus a panel of B (BLOCK_K x BLOCK_N) is sized to sit in L2.
+*/
+#define RQ_LINALG_BLOCK_M 64
+#define RQ_LINALG_BLOCK_K 128
+#define RQ_LINALG_BLOCK_N 512
+
+#define ELEM(a, ld, r, c) ((a)[(r) * (ld) + (c)])
+
+RQ_EXPORT double *
+rq_linalg_alloc(unsigned long n)
+{
+    char *raw = (char *)RQ_CALLOC(1, n * sizeof(double) + RQ_LINALG_ALIGNMENT + sizeof(void *));
+    char *p;
+
+    if (!raw)
+        return NULL;
+
+    /* leave room to store the pointer that was actually allocated
+       immediately before the aligned block */
+    p = raw + sizeof(void *);
+    p += RQ_LINALG_ALIGNMENT - ((size_t)p % RQ_LINALG_ALIGNMENT);
+    ((void **)p)[-1] = raw;
+
+    return (double *)p;
+}
+
+RQ_EXPORT void
+rq_linalg_free(double *p)
+{
+    if (p)
+        RQ_FREE(((void **)p)[-1]);
+}
+
+RQ_EXPORT void
+rq_linalg_gemm(
+    unsigned long m,
+    unsigned long n,
+    unsigned long k,
+    double alpha,
+    const double *a,
+    unsigned long lda,
+    const double *b,
+    unsigned long ldb,
+    double beta,
+    double *c,
+    unsigned long ldc
+    )
+{
+#ifdef RQ_USE_CBLAS
+    cblas_dgemm(
+        CblasRowMajor, CblasNoTrans, CblasNoTrans, 
+        (int)m, (int)n, (int)k, alpha, a, (int)lda, b, (int)ldb, beta, c, (int)ldc
+        );
+#else
+    unsigned long ii;
+    unsigned long jj;
+    unsigned long kk;
+    unsigned long i;
+
+    for (i = 0; i < m; i++)
+    {
+        double *ci = c + i * ldc;
+        unsigned long j;
+
+        if (beta == 0.0)
+        {
+            for (j = 0; j < n; j++)
+                ci[j] = 0.0;
+        }
+        else if (beta != 1.0)
+        {
+            for (j = 0; j < n; j++)
+                ci[j] *= beta;
+        }
+    }
+
+    if (alpha == 0.0)
+        return;
+
+    for (kk = 0; kk < k; kk += RQ_LINALG_BLOCK_K)
+    {
+        unsigned long k_end = (kk + RQ_LINALG_BLOCK_K < k ? kk + RQ_LINALG_BLOCK_K : k);
+
+        for (jj = 0; jj < n; jj += RQ_LINALG_BLOCK_N)
+        {
+            unsigned long j_end = (jj + RQ_LINALG_BLOCK_N < n ? jj + RQ_LINALG_BLOCK_N : n);
+
+            for (ii = 0; ii < m; ii += RQ_LINALG_BLOCK_M)
+            {
+                unsigned long i_end = (ii + RQ_LINALG_BLOCK_M < m ? ii + RQ_LINALG_BLOCK_M : m);
+
+                for (i = ii; i < i_end; i++)
+                {
+                    double * RQ_RESTRICT ci = c + i * ldc;
+                    const double *ai = a + i * lda;
+                    unsigned long p;
+
+                    for (p = kk; p < k_end; p++)
+                    {
+                        const double * RQ_RESTRICT bp = b + p * ldb;
+                        double aip = alpha * ai[p];
+                        unsigned long j;
+
+                        /* unit stride through both B and C */
+                        for (j = jj; j < j_end; j++)
+                            ci[j] += aip * bp[j];
+                    }
+                }
+            }
+        }
+    }
+#endif
+}
+
+/* Dot product with four independent accumulators, so the additions
+   can be pipelined (and vectorized) without reassociation.
+*/
+static double
+dot(const double * RQ_RESTRICT x, const double * RQ_RESTRICT y, unsigned long n)
+{
+    double s0 = 0.0;
+    double s1 = 0.0;
+    double s2 = 0.0;
+    double s3 = 0.0;
+    unsigned long i;
+
+    for (i = 0; i + 4 <= n; i += 4)
+    {
+        s0 += x[i] * y[i];
+        s1 += x[i+1] * y[i+1];
+        s2 += x[i+2] * y[i+2];
+        s3 += x[i+3] * y[i+3];
+    }
+
+    for (; i < n; i++)
+        s0 += x[i] * y[i];
+
+    return (s0 + s1) + (s2 + s3);
+}
+
+RQ_EXPORT void
+rq_linalg_gemv(
+    unsigned long m,
+    unsigned long n,
+    double alpha,
+    const double *a,
+    unsigned long lda,
+    const double *x,
+    double beta,
+    double *y
+    )
+{
+#ifdef RQ_USE_CBLAS
+    cblas_dgemv(
+        CblasRowMajor, CblasNoTrans, 
+        (int)m, (int)n, alpha, a, (int)lda, x, 1, beta, y, 1
+        );
+#else
+    unsigned long i;
+
+    for (i = 0; i < m; i++)
+    {
+        double v = alpha * dot(a + i * lda, x, n);
+        y[i] = (beta == 0.0 ? v : v + beta * y[i]);
+    }
+#endif
+}
+
+RQ_EXPORT void
+rq_linalg_trmv_lower(
+    unsigned long n,
+    const double *l,
+    unsigned long ldl,
+    double *x
+    )
+{
+#ifdef RQ_USE_CBLAS
+    cblas_dtrmv(
+        CblasRowMajor, CblasLower, CblasNoTrans, CblasNonUnit,
+        (int)n, l, (int)ldl, x, 1
+        );
+#else
+    unsigned long i;
+
+    /* work from the bottom row up so x[0..i] is still the input when
+       row i is calculated */
+    for (i = n; i-- > 0; )
+        x[i] = dot(l + i * ldl, x, i + 1);
+#endif
+}
+
+RQ_EXPORT void
+rq_linalg_trsv_lower(
+    unsigned long n,
+    const double *l,
+    unsigned long ldl,
+    double *x
+    )
+{
+#ifdef RQ_USE_CBLAS
+    cblas_dtrsv(
+        CblasRowMajor, CblasLower, CblasNoTrans, CblasNonUnit,
+        (int)n, l, (int)ldl, x, 1
+        );
+#else
+    unsigned long i;
+
+    for (i = 0; i < n; i++)
+    {
+        const double *li = l + i * ldl;
+        x[i] = (x[i] - dot(li, x, i)) / li[i];
+    }
+#endif
+}
+
+RQ_EXPORT void
+rq_linalg_trsv_lower_trans(
+    unsigned long n,
+    const double *l,
+    unsigned long ldl,
+    double *x
+    )
+{
+#ifdef RQ_USE_CBLAS
+    cblas_dtrsv(
+        CblasRowMajor, CblasLower, CblasTrans, CblasNonUnit,
+        (int)n, l, (int)ldl, x, 1
+        );
+#else
+    unsigned long i;
+
+    /* column-oriented back substitution, which walks the rows of L */
+    for (i = n; i-- > 0; )
+    {
+        const double *li = l + i * ldl;
+        double xi = x[i] / li[i];
+        unsigned long j;
+
+        x[i] = xi;
+        for (j = 0; j < i; j++)
+            x[j] -= li[j] * xi;
+    }
+#endif
+}
+
+RQ_EXPORT short
+rq_linalg_cholesky(
+    unsigned long n,
+    double *a,
+    unsigned long lda
+    )
+{
+    unsigned long i;
+    unsigned long j;
+
+#ifdef RQ_USE_LAPACKE
+    if (LAPACKE_dpotrf(LAPACK_ROW_MAJOR, 'L', (lapack_int)n, a, (lapack_int)lda) != 0)
+        return 1;
+#else
+    /* Cholesky-Crout by rows. Each element of L is a dot product of
+       two contiguous, already computed row prefixes. */
+    for (i = 0; i < n; i++)
+    {
+        double *ai = a + i * lda;
+
+        for (j = 0; j < i; j++)
+        {
+            const double *aj = a + j * lda;
+            ai[j] = (ai[j] - dot(ai, aj, j)) / aj[j];
+        }
+
+        ai[i] -= dot(ai, ai, i);
+        if (!(ai[i] > 0.0))
+            return 1; /* not positive definite, or NaN */
+        ai[i] = sqrt(ai[i]);
+    }
+#endif
+
+    for (i = 0; i < n; i++)
+    {
+        for (j = i + 1; j < n; j++)
+            ELEM(a, lda, i, j) = 0.0;
+    }
+
+    return 0;
+}
+
+RQ_EXPORT void
+rq_linalg_tridiagonalize(
+    unsigned long un,
+    double *a,
+    unsigned long lda,
+    double *d,
+    double *e
+    )
+{
+    long n = (long)un;
+    long i;
+
+    for (i = n - 1; i >= 1; i--)
+    {
+        double *ai = a + i * lda;
+        long l = i - 1;
+        double h = 0.0;
+
+        if (l > 0)
+        {
+            long k;
+            double scale = 0.0;
+
+            for (k = 0; k <= l; k++)
+                scale += fabs(ai[k]);
+
+            if (scale == 0.0)
+            {
+                e[i] = ai[l];
+            }
+            else
+            {
+                double f;
+                double g;
+                double hh;
+                long j;
+
+                for (k = 0; k <= l; k++)
+                {
+                    ai[k] /= scale;
+                    h += ai[k] * ai[k];
+                }
+
+                f = ai[l];
+                g = (f >= 0.0 ? -sqrt(h) : sqrt(h));
+
+                e[i] = scale * g;
+                h -= f * g;
+                ai[l] = f - g;
+                f = 0.0;
+
+                for (j = 0; j <= l; j++)
+                {
+                    double *aj = a + j * lda;
+
+                    aj[i] = ai[j] / h;
+
+                    g = dot(aj, ai, j + 1);
+                    for (k = j + 1; k <= l; k++)
+                        g += ELEM(a, lda, k, j) * ai[k];
+
+                    e[j] = g / h;
+                    f += e[j] * ai[j];
+                }
+
+                hh = f / (h + h);
+
+                for (j = 0; j <= l; j++)
+                {
+                    double *aj = a + j * lda;
+
+                    f = ai[j];
+                    g = e[j] - hh * f;
+                    e[j] = g;
+
+                    for (k = 0; k <= j; k++)
+                        aj[k] -= (f * e[k] + g * ai[k]);
+                }
+            }
+        }
+        else
+        {
+            e[i] = ai[l];
+        }
+
+        d[i] = h;
+    }
+
+    d[0] = 0.0;
+    e[0] = 0.0;
+
+    /* accumulate the transformations */
+    for (i = 0; i < n; i++)
+    {
+        double *ai = a + i * lda;
+        long l = i - 1;
+        long j;
+
+        if (d[i])
+        {
+            for (j = 0; j <= l; j++)
+            {
+                double g = 0.0;
+                long k;
+
+                for (k = 0; k <= l; k++)
+                    g += ai[k] * ELEM(a, lda, k, j);
+
+                for (k = 0; k <= l; k++)
+                    ELEM(a, lda, k, j) -= g * ELEM(a, lda, k, i);
+            }
+        }
+
+        d[i] = ai[i];
+        ai[i] = 1.0;
+
+        for (j = 0; j <= l; j++)
+        {
+            ELEM(a, lda, j, i) = 0.0;
+            ai[j] = 0.0;
+        }
+    }
+}
+
+static void
+transpose_square(unsigned long n, double *a, unsigned long lda)
+{
+    unsigned long i;
+
+    for (i = 0; i < n; i++)
+    {
+        unsigned long j;
+        for (j = i + 1; j < n; j++)
+        {
+            double t = ELEM(a, lda, i, j);
+            ELEM(a, lda, i, j) = ELEM(a, lda, j, i);
+            ELEM(a, lda, j, i) = t;
+        }
+    }
+}
+
+/* The QL iteration with the eigenvectors held in the ROWS of zt, so
+   that each plane rotation updates two contiguous rows.
+*/
+static short
+tridiagonal_ql_rows(
+    long n,
+    double *zt,
+    unsigned long ldz,
+    double *d,
+    double *e
+    )
+{
+    long i;
+    long l;
+
+    for (i = 1; i < n; i++)
+        e[i-1] = e[i];
+    e[n-1] = 0.0;
+
+    for (l = 0; l < n; l++)
+    {
+        int iter = 0;
+        long m;
+
+        do
+        {
+            /* look for a single small subdiagonal element to split
+               the matrix.
+            */
+            for (m = l; m < n-1; m++)
+            {
+                double dd = fabs(d[m]) + fabs(d[m+1]);
+                if ((double)(fabs(e[m]) + dd) == dd)
+                    break;
+            }
+
+            if (m != l)
+            {
+                double g;
+                double r;
+                double s;
+                double p;
+                double c;
+
+                if (iter++ == 30)
+                    return 1;
+
+                g = (d[l+1] - d[l]) / (2.0 * e[l]);
+                r = rq_pythag(g, 1.0);
+                g = d[m] - d[l] + e[l] / (g + RQ_SIGN(r, g));
+                s = c = 1.0;
+                p = 0.0;
+
+                for (i = m - 1; i >= l; i--)
+                {
+                    double * RQ_RESTRICT zi = zt + i * ldz;
+                    double * RQ_RESTRICT zi1 = zt + (i + 1) * ldz;
+                    double f = s * e[i];
+                    double b = c * e[i];
+                    long k;
+
+                    e[i + 1] = (r = rq_pythag(f, g));
+
+                    if (r == 0.0)
+                    {
+                        d[i+1] -= p;
+                        e[m] = 0.0;
+                        break;
+                    }
+
+                    s = f / r;
+                    c = g / r;
+                    g = d[i+1] - p;
+                    r = (d[i] - g) * s + 2.0 * c * b;
+                    d[i+1] = g + (p = s * r);
+                    g = c * r - b;
+
+                    for (k = 0; k < n; k++)
+                    {
+                        f = zi1[k];
+                        zi1[k] = s * zi[k] + c * f;
+                        zi[k] = c * zi[k] - s * f;
+                    }
+                }
+
+                if (r == 0.0 && i >= l)
+                    continue;
+
+                d[l] -= p;
+                e[l] = g;
+                e[m] = 0.0;
+            }
+        }
+        while (m != l);
+    }
+
+    return 0;
+}
+
+RQ_EXPORT short
+rq_linalg_tridiagonal_ql(
+    unsigned long n,
+    double *z,
+    unsigned long ldz,
+    double *d,
+    double *e
+    )
+{
+    short failed;
+
+    if (n == 0)
+        return 0;
+
+    transpose_square(n, z, ldz);
+    failed = tridiagonal_ql_rows((long)n, z, ldz, d, e);
+    transpose_square(n, z, ldz);
+
+    return failed;
+}
+
+RQ_EXPORT short
+rq_linalg_eigen_symmetric(
+    unsigned long n,
+    double *a,
+    unsigned long lda,
+    double *d,
+    double *e
+    )
+{
+#ifdef RQ_USE_LAPACKE
+    (void)e;
+    return (LAPACKE_dsyev(LAPACK_ROW_MAJOR, 'V', 'L', (lapack_int)n, a, (lapack_int)lda, d) != 0);
+#else
+    unsigned long i;
+
+    if (n == 0)
+        return 0;
+
+    rq_linalg_tridiagonalize(n, a, lda, d, e);
+
+    transpose_square(n, a, lda);
+
+    if (tridiagonal_ql_rows((long)n, a, lda, d, e))
+        return 1;
+
+    /* selection sort into ascending order, swapping the (contiguous)
+       eigenvector rows along with the eigenvalues */
+    for (i = 0; i + 1 < n; i++)
+    {
+        unsigned long min = i;
+        unsigned long j;
+
+        for (j = i + 1; j < n; j++)
+            if (d[j] < d[min])
+                min = j;
+
+        if (min != i)
+        {
+            double *ri = a + i * lda;
+            double *rm = a + min * lda;
+            double t = d[i];
+
+            d[i] = d[min];
+            d[min] = t;
+
+            for (j = 0; j < n; j++)
+            {
+                t = ri[j];
+                ri[j] = rm[j];
+                rm[j] = t;
+            }
+        }
+    }
+
+    transpose_square(n, a, lda);
+
+    return 0;
+#endif
+}
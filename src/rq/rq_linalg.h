@@ -0,0 +1,199 @@
+/**
+ * @file
+ *
+ * Dense linear algebra kernels operating on row-major arrays of doubles.
+ */
+/*
+** rq_linalg.h
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#ifndef rq_linalg_h
+#define rq_linalg_h
+
+#include "rq_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#if 0
+} // purely to not screw up my indenting...
+#endif
+#endif
+
+/* All the matrices passed to these functions are stored in row-major
+   order. The leading dimension (lda etc) is the distance in doubles
+   between the start of one row and the start of the next.
+
+   If the library is configured with --with-blas or --with-lapack the
+   kernels are passed through to CBLAS or LAPACKE respectively.
+*/
+
+/** The alignment (in bytes) of arrays allocated with rq_linalg_alloc().
+ */
+#define RQ_LINALG_ALIGNMENT 64
+
+/** Allocate a zeroed, RQ_LINALG_ALIGNMENT aligned array of n doubles.
+ * The array must be freed with rq_linalg_free().
+ */
+RQ_EXPORT double *rq_linalg_alloc(unsigned long n);
+
+/** Free an array allocated with rq_linalg_alloc().
+ */
+RQ_EXPORT void rq_linalg_free(double *p);
+
+/** Calculate C = alpha * A * B + beta * C, where A is m x k, B is k x
+ * n and C is m x n. C must not overlap A or B.
+ */
+RQ_EXPORT void
+rq_linalg_gemm(
+    unsigned long m,
+    unsigned long n,
+    unsigned long k,
+    double alpha,
+    const double *a,
+    unsigned long lda,
+    const double *b,
+    unsigned long ldb,
+    double beta,
+    double *c,
+    unsigned long ldc
+    );
+
+/** Calculate y = alpha * A * x + beta * y, where A is m x n.
+ */
+RQ_EXPORT void
+rq_linalg_gemv(
+    unsigned long m,
+    unsigned long n,
+    double alpha,
+    const double *a,
+    unsigned long lda,
+    const double *x,
+    double beta,
+    double *y
+    );
+
+/** Calculate x = L * x in place, where L is an n x n lower
+ * triangular matrix. The upper triangle of L is not referenced.
+ */
+RQ_EXPORT void
+rq_linalg_trmv_lower(
+    unsigned long n,
+    const double *l,
+    unsigned long ldl,
+    double *x
+    );
+
+/** Solve L * x = b in place, where L is an n x n lower triangular
+ * matrix. On entry x holds b.
+ */
+RQ_EXPORT void
+rq_linalg_trsv_lower(
+    unsigned long n,
+    const double *l,
+    unsigned long ldl,
+    double *x
+    );
+
+/** Solve transpose(L) * x = b in place, where L is an n x n lower
+ * triangular matrix. On entry x holds b.
+ */
+RQ_EXPORT void
+rq_linalg_trsv_lower_trans(
+    unsigned long n,
+    const double *l,
+    unsigned long ldl,
+    double *x
+    );
+
+/** Perform an in-place cholesky decomposition of the symmetric n x n
+ * matrix A, leaving L in the lower triangle and zeros in the upper
+ * triangle.
+ *
+ * Returns 0 on success, or non-zero if the matrix isn't positive
+ * definite, a zero or NaN pivot included.
+ */
+RQ_EXPORT short
+rq_linalg_cholesky(
+    unsigned long n,
+    double *a,
+    unsigned long lda
+    );
+
+/** Reduce the symmetric n x n matrix A to tridiagonal form using
+ * householder reductions. On return A holds the orthogonal
+ * transformation, d the diagonal and e the sub-diagonal (with e[0] =
+ * 0).
+ */
+RQ_EXPORT void
+rq_linalg_tridiagonalize(
+    unsigned long n,
+    double *a,
+    unsigned long lda,
+    double *d,
+    double *e
+    );
+
+/** Determine the eigenvalues and eigenvectors of a symmetric
+ * tridiagonal matrix using the QL algorithm with implicit shifts.
+ *
+ * On entry z holds the transformation returned by
+ * rq_linalg_tridiagonalize() (or the identity), d the diagonal and e
+ * the sub-diagonal. On return d holds the eigenvalues and the columns
+ * of z the corresponding eigenvectors. e is destroyed.
+ *
+ * Returns 0 on success or non-zero if the algorithm failed to
+ * converge.
+ */
+RQ_EXPORT short
+rq_linalg_tridiagonal_ql(
+    unsigned long n,
+    double *z,
+    unsigned long ldz,
+    double *d,
+    double *e
+    );
+
+/** Calculate the eigenvalues and eigenvectors of the symmetric n x n
+ * matrix A.
+ *
+ * On return d holds the eigenvalues in ascending order, and the
+ * columns of A the corresponding normalized eigenvectors. e must
+ * hold at least n doubles of workspace.
+ *
+ * Returns 0 on success or non-zero if the algorithm failed to
+ * converge.
+ */
+RQ_EXPORT short
+rq_linalg_eigen_symmetric(
+    unsigned long n,
+    double *a,
+    unsigned long lda,
+    double *d,
+    double *e
+    );
+
+#ifdef __cplusplus
+#if 0
+{ // purely to not screw up my indenting...
+#endif
+};
+#endif
+
+#endif
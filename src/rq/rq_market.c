@@ -399,6 +399,21 @@ rq_market_clear(rq_market_t market)
     rq_equity_curve_mgr_clear(market->equity_curve_mgr);
 }
 
+RQ_EXPORT void
+rq_market_freeze(rq_market_t market)
+{
+    rq_yield_curve_mgr_iterator_t it = rq_yield_curve_mgr_iterator_alloc();
+
+    for (rq_yield_curve_mgr_begin(market->yield_curve_mgr, it); 
+         !rq_yield_curve_mgr_at_end(it); 
+         rq_yield_curve_mgr_next(it))
+        rq_yield_curve_freeze(rq_yield_curve_mgr_iterator_deref(it));
+
+    rq_yield_curve_mgr_iterator_free(it);
+
+    rq_exchange_rate_mgr_freeze(market->exchange_rate_mgr);
+}
+
 RQ_EXPORT rq_market_t
 rq_market_transition_through_time(rq_market_t base_market, rq_date to_date)
 {
@@ -152,6 +152,24 @@ RQ_EXPORT rq_market_t rq_market_clone(rq_market_t market);
  */
 RQ_EXPORT void rq_market_clear(rq_market_t market);
 
+/** Freeze the market once its term structures are built, so that it
+ * can be shared between pricing threads.
+ *
+ * The yield curves have their discount factor caches filled and
+ * stop writing to them (see rq_yield_curve_freeze()), and the
+ * exchange rate manager stops caching the rates it implies (see
+ * rq_exchange_rate_mgr_freeze()). The other term structures aren't
+ * changed by reading them, and the correlation matrix cache is
+ * locked.
+ *
+ * So reading a frozen market doesn't change it, apart from the caches
+ * that are locked, and any number of threads may price against it at
+ * once. Nothing may change the market while it is shared; a change
+ * to a curve or an exchange rate thaws it, and the market must be
+ * frozen again before it is shared again.
+ */
+RQ_EXPORT void rq_market_freeze(rq_market_t market);
+
 /** Set the market date in the market object.
  */
 RQ_EXPORT void rq_market_set_market_date(rq_market_t market, rq_date market_date);
@@ -29,6 +29,7 @@
 #include <math.h>
 
 #include "rq_math.h"
+#include "rq_linalg.h"
 
 RQ_EXPORT rq_matrix_t
 rq_matrix_alloc()
@@ -46,7 +47,7 @@ rq_matrix_build(unsigned long rows, unsigned long cols)
     struct rq_matrix *m = (struct rq_matrix *)RQ_CALLOC(1, sizeof(struct rq_matrix));
     m->rows = rows;
     m->cols = cols;
-    m->vals = (double *)RQ_CALLOC(rows * cols, sizeof(double));
+    m->vals = rq_linalg_alloc(rows * cols);
 
     return m;
 }
@@ -63,7 +64,7 @@ rq_matrix_build_with_values(unsigned long rows, unsigned long cols, double first
 
     m->rows = rows;
     m->cols = cols;
-    m->vals = (double *)RQ_MALLOC(rows * cols * sizeof(double));
+    m->vals = rq_linalg_alloc(rows * cols);
 
     m->vals[0] = first_value;
 
@@ -80,14 +81,12 @@ rq_matrix_clone(rq_matrix_t mat)
 {
     struct rq_matrix *m = (struct rq_matrix *)RQ_CALLOC(1, sizeof(struct rq_matrix));
     unsigned long max_offset = mat->rows * mat->cols;
-    unsigned long i;
 
     m->rows = mat->rows;
     m->cols = mat->cols;
-    m->vals = (double *)RQ_MALLOC(max_offset * sizeof(double));
+    m->vals = rq_linalg_alloc(max_offset);
 
-    for (i = 0; i < max_offset; i++)
-        m->vals[i] = mat->vals[i];
+    memcpy(m->vals, mat->vals, max_offset * sizeof(double));
 
     return m;
 }
@@ -98,10 +97,9 @@ rq_matrix_dim(rq_matrix_t m, unsigned long rows, unsigned long cols)
     unsigned long dim = rows * cols;
     if (m->rows * m->cols < dim)
     {
-        if (m->vals)
-            RQ_FREE(m->vals);
+        rq_linalg_free(m->vals);
 
-        m->vals = (double *)RQ_CALLOC(rows * cols, sizeof(double));
+        m->vals = rq_linalg_alloc(rows * cols);
     }
 
     m->rows = rows;
@@ -111,8 +109,7 @@ rq_matrix_dim(rq_matrix_t m, unsigned long rows, unsigned long cols)
 RQ_EXPORT void  
 rq_matrix_free(rq_matrix_t m)
 {
-    if (m->vals)
-        RQ_FREE(m->vals);
+    rq_linalg_free(m->vals);
     RQ_FREE(m);
 }
 
@@ -194,53 +191,16 @@ rq_matrix_print(const rq_matrix_t m)
 RQ_EXPORT short 
 rq_matrix_cholesky(const rq_matrix_t in, rq_matrix_t out)
 {
-    short failed = 1;
+    if (in->rows != out->rows || in->cols != out->cols || in->rows != in->cols)
+        return 1;
 
-    if (in->rows == out->rows && in->cols == out->cols)
-    {
-        unsigned r;
-        for (r = 0; r < in->rows; r++)
-        {
-            unsigned c;
-            for (c = r; c < in->cols; c++)
-            {
-                double sum = rq_matrix_get(in, r, c);
-
-                if (r > 0)
-                {
-                    int k;
-                    for (k = r - 1; k >= 0; k--)
-                    {
-                        sum -= 
-                            (rq_matrix_get(out, r, (unsigned)k) * 
-                             rq_matrix_get(out, c, (unsigned)k));
-                    }
-                }
-
-                if (r == c)
-                {
-                    if (sum < 0.0) /* changed from <= 0 */
-                    {
-                        /* Not positive definite. Return failure. */
-                        printf("Not positive definite! sum = %f\n", sum);
-                        return 2;
-                    }
-                    rq_matrix_set(out, r, c, sqrt(sum));
-                }
-                else
-                {
-                    double v = sum / rq_matrix_get(out, r, r);
-
-                    /* rq_matrix_set(in, c, r, v); */
-                    rq_matrix_set(out, c, r, v);
-                }
-            }
-        }
+    if (in != out)
+        memcpy(out->vals, in->vals, in->rows * in->cols * sizeof(double));
 
-        failed = 0; /* yippee */
-    }
+    if (rq_linalg_cholesky(out->rows, out->vals, out->cols))
+        return 2; /* Not positive definite. */
 
-    return failed;
+    return 0;
 }
 
 RQ_EXPORT void
@@ -249,9 +209,10 @@ rq_matrix_transpose(const rq_matrix_t in, rq_matrix_t out)
     unsigned long r;
     for (r = 0; r < in->rows; r++)
     {
+        const double *row = in->vals + r * in->cols;
         unsigned long c;
         for (c = 0; c < in->cols; c++)
-            rq_matrix_set(out, c, r, rq_matrix_get(in, r, c));
+            out->vals[c * out->cols + r] = row[c];
     }
 }
 
@@ -336,251 +297,203 @@ rq_matrix_multiply_scalar(const rq_matrix_t m1, double scalar, rq_matrix_t out)
 RQ_EXPORT void
 rq_matrix_householder(rq_matrix_t m, double *d, double *e)
 {
-    int i;
-
-    for (i = m->rows-1; i >= 1; i--)
-    {
-        int l = i - 1;
-        double h = 0.0;
-
-        if (l > 0)
-        {
-            int k;
-            double scale = 0.0;
-
-            for (k = 0; k <= l; k++)
-                scale += fabs(rq_matrix_get(m, i, k));
-
-            if (scale == 0.0)
-            {
-                e[i] = rq_matrix_get(m, i, l);
-            }
-            else
-            {
-                double f;
-                double g;
-                double hh;
-                int j;
-                int k;
+    rq_linalg_tridiagonalize(m->rows, m->vals, m->cols, d, e);
+}
 
-                for (k = 0; k <= l; k++)
-                {
-                    double v = rq_matrix_get(m, i, k);
-                    v /= scale;
-                    rq_matrix_set(m, i, k, v);
-                    h += (v * v);
-                }
+RQ_EXPORT short
+rq_matrix_ql(rq_matrix_t z, double *d, double *e)
+{
+    return rq_linalg_tridiagonal_ql(z->cols, z->vals, z->cols, d, e);
+}
 
-                f = rq_matrix_get(m, i, l);
-                g = (f >= 0.0 ? -sqrt(h) : sqrt(h));
+RQ_EXPORT short
+rq_matrix_eigen_symmetric(rq_matrix_t m, double *d)
+{
+    double *e;
+    short failed;
 
-                e[i] = scale * g;
+    if (m->rows != m->cols)
+        return 1;
 
-                h -= f * g;
+    e = (double *)RQ_MALLOC(sizeof(double) * (m->rows + 1));
+    failed = rq_linalg_eigen_symmetric(m->rows, m->vals, m->cols, d, e);
+    RQ_FREE(e);
 
-                rq_matrix_set(m, i, l, f - g);
+    return (failed ? 2 : 0);
+}
 
-                f = 0.0;
+RQ_EXPORT short
+rq_matrix_multiply(const rq_matrix_t m1, rq_matrix_t m2, rq_matrix_t out)
+{
+    if (m1->cols == m2->rows)
+    {
+        if (out->rows == m1->rows && out->cols == m2->cols)
+        {
+            rq_linalg_gemm(
+                m1->rows, m2->cols, m1->cols,
+                1.0, m1->vals, m1->cols,
+                m2->vals, m2->cols,
+                0.0, out->vals, out->cols
+                );
 
-                for (j = 0; j <= l; j++)
-                {
-                    /* next statement can be ommitted if eigenvalues
-                     * not wanted.
-                     */
-                    rq_matrix_set(m, j, i, rq_matrix_get(m, i, j) / h);
+            return 0;
+        }
 
-                    g = 0.0;
+        return 2;
+    }
 
-                    for (k = 0; k <= j; k++)
-                        g += rq_matrix_get(m, j, k) * rq_matrix_get(m, i, k);
+    return 1;
+}
 
-                    for (k = j + 1; k <= l; k++)
-                        g += rq_matrix_get(m, k, j) * rq_matrix_get(m, i, k);
+RQ_EXPORT short
+rq_matrix_multiply_vector(const rq_matrix_t m, const double *x, double *y)
+{
+    rq_linalg_gemv(m->rows, m->cols, 1.0, m->vals, m->cols, x, 0.0, y);
+    return 0;
+}
 
-                    e[j] = g / h;
+RQ_EXPORT short
+rq_matrix_solve_lower(const rq_matrix_t l, double *x)
+{
+    if (l->rows != l->cols)
+        return 1;
 
-                    f += e[j] * rq_matrix_get(m, i, j);
-                }
+    rq_linalg_trsv_lower(l->rows, l->vals, l->cols, x);
+    return 0;
+}
 
-                hh = f / (h + h);
+/* The smallest eigenvalue allowed in a repaired correlation matrix,
+   so that it stays safely positive definite. */
+#define RQ_MATRIX_EIGENVALUE_FLOOR 1e-10
 
-                for (j = 0; j <= l; j++)
-                {
-                    f = rq_matrix_get(m, i, j);
+/* Project the symmetric matrix 'a' onto the positive semi-definite
+   cone by zeroing the negative eigenvalues: a = V * max(D, floor) * V'.
+   'v' and 'w' are n x n workspaces and 'd', 'e' n-vectors.
+*/
+static short
+project_psd(unsigned long n, double *a, double *v, double *w, double *d, double *e, double floor)
+{
+    unsigned long i;
+    unsigned long j;
 
-                    g = e[j] - hh * f;
-                    e[j] = g;
+    memcpy(v, a, n * n * sizeof(double));
+    if (rq_linalg_eigen_symmetric(n, v, n, d, e))
+        return 1;
 
-                    for (k = 0; k <= j; k++)
-                        rq_matrix_set(m, j, k, rq_matrix_get(m, j, k) - (f * e[k] + g * rq_matrix_get(m, i, k)));
-                }
-            }
-        }
-        else
+    /* w = V * sqrt(D), so that a = w * w' */
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < n; j++)
         {
-            e[i] = rq_matrix_get(m, i, l);
+            double lambda = (d[j] > floor ? d[j] : floor);
+            w[i * n + j] = v[i * n + j] * sqrt(lambda);
         }
-
-        d[i] = h;
     }
 
-    d[0] = 0.0;
-    e[0] = 0.0;
-
-    for (i = 0; i < m->rows; i++)
+    for (i = 0; i < n; i++)
     {
-        int l = i - 1;
-        int j;
-
-        if (d[i])
+        const double *wi = w + i * n;
+        for (j = 0; j <= i; j++)
         {
-            for (j = 0; j <= l; j++)
-            {
-                double g = 0.0;
-                int k;
-
-                for (k = 0; k <= l; k++)
-                    g += rq_matrix_get(m, i, k) * rq_matrix_get(m, k, j);
+            const double *wj = w + j * n;
+            double sum = 0.0;
+            unsigned long k;
 
-                for (k = 0; k <= l; k++)
-                    rq_matrix_set(m, k, j, rq_matrix_get(m, k, j) - (g * rq_matrix_get(m, k, i)));
-            }
-        }
-
-        d[i] = rq_matrix_get(m, i, i);
-        rq_matrix_set(m, i, i, 1.0);
+            for (k = 0; k < n; k++)
+                sum += wi[k] * wj[k];
 
-        for (j = 0; j <= l; j++)
-        {
-            rq_matrix_set(m, j, i, 0.0);
-            rq_matrix_set(m, i, j, 0.0);
+            a[i * n + j] = a[j * n + i] = sum;
         }
     }
+
+    return 0;
 }
 
-short
-rq_matrix_ql(rq_matrix_t z, double *d, double *e)
+RQ_EXPORT short
+rq_matrix_nearest_correlation(const rq_matrix_t in, rq_matrix_t out, double tolerance, unsigned int max_iterations)
 {
-    int i;
-    int l;
-    unsigned long n = rq_matrix_get_columns(z);
+    unsigned long n = in->rows;
+    unsigned long nn = n * n;
+    double *y;
+    double *x;
+    double *ds;
+    double *v;
+    double *w;
+    double *d;
+    unsigned long i;
+    unsigned int iter;
+    short converged = 0;
+
+    if (in->rows != in->cols || out->rows != n || out->cols != n)
+        return 1;
+
+    y = rq_linalg_alloc(5 * nn + 2 * (n + 1));
+    x = y + nn;
+    ds = x + nn;
+    v = ds + nn;
+    w = v + nn;
+    d = w + nn;
 
-    for (i = 1; i < n; i++)
-        e[i-1] = e[i];
-    e[n-1] = 0.0;
+    /* start from the symmetric part of the input */
+    for (i = 0; i < n; i++)
+    {
+        unsigned long j;
+        for (j = 0; j < n; j++)
+            y[i * n + j] = 0.5 * (in->vals[i * n + j] + in->vals[j * n + i]);
+    }
 
-    for (l = 0; l < n; l++)
+    for (iter = 0; iter < max_iterations; iter++)
     {
-        int iter = 0;
-        int m;
+        double diff = 0.0;
+        double norm = 0.0;
 
-        do
+        /* R = Y - dS; X = P_psd(R); dS = X - R */
+        for (i = 0; i < nn; i++)
         {
+            x[i] = y[i] - ds[i];
+            ds[i] = x[i];
+        }
 
-            /* look for a single small subdiagonal element to split
-               the matrix.
-            */
-            for (m = l; m < n-1; m++)
-            {
-                double dd = fabs(d[m]) + fabs(d[m+1]);
-                if ((double)(fabs(e[m]) + dd) == dd)
-                    break;
-            }
-
-            if (m != l)
-            {
-                double g;
-                double r;
-                double s;
-                double p;
-                double c;
-
-                if (iter++ == 30)
-                    return 1;
-
-                g = (d[l+1] - d[l]) / (2.0 * e[l]);
-                r = rq_pythag(g, 1.0);
-                g = d[m] - d[l] + e[l] / (g + RQ_SIGN(r, g));
-                s = c = 1.0;
-                p = 0.0;
-
-                for (i = m - 1; i >= l; i--)
-                {
-                    int k;
-                    double f = s * e[i];
-                    double b = c * e[i];
-                    e[i + 1] = (r = rq_pythag(f, g));
-
-                    if (r == 0.0)
-                    {
-                        d[i+1] -= p;
-                        e[m] = 0.0;
-                        break;
-                    }
-
-                    s = f / r;
-                    c = g / r;
-                    g = d[i+1] - p;
-                    r = (d[i] - g) * s + 2.0 * c * b;
-                    d[i+1] = g + (p = s * r);
-                    g = c * r - b;
-
-                    for (k = 0; k < n; k++)
-                    {
-                        f = rq_matrix_get(z, k, i + 1);
-                        rq_matrix_set(
-                            z, k, i + 1, 
-                            s * rq_matrix_get(z, k, i) + c * f
-                            );
-                        rq_matrix_set(
-                            z, k, i, 
-                            c * rq_matrix_get(z, k, i) - s * f
-                            );
-                    }
-                }
-
-                if (r == 0.0 && i >= l)
-                    continue;
-
-                d[l] -= p;
-                e[l] = g;
-                e[m] = 0.0;
-            }
+        if (project_psd(n, x, v, w, d, d + n + 1, 0.0))
+            break;
+
+        for (i = 0; i < nn; i++)
+        {
+            ds[i] = x[i] - ds[i];
+            y[i] = x[i];
         }
-        while (m != l);
-    }
 
-    return 0;
-}
+        /* Y = P_unit_diagonal(X) */
+        for (i = 0; i < n; i++)
+            y[i * n + i] = 1.0;
 
-RQ_EXPORT short
-rq_matrix_multiply(const rq_matrix_t m1, rq_matrix_t m2, rq_matrix_t out)
-{
-    if (m1->cols == m2->rows)
-    {
-        if (out->rows == m1->rows && out->cols == m2->cols)
+        for (i = 0; i < nn; i++)
         {
-            unsigned long c;
-            for (c = 0; c < m2->cols; c++)
-            {
-                unsigned long r;
-                for (r = 0; r < m1->rows; r++)
-                {
-                    double v = 0.0;
-                    unsigned long i;
-
-                    for (i = 0; i < m1->cols; i++)
-                        v += rq_matrix_get(m1, r, i) * rq_matrix_get(m2, i, c);
-
-                    rq_matrix_set(out, r, c, v);
-                }
-            }
+            diff += (y[i] - x[i]) * (y[i] - x[i]);
+            norm += y[i] * y[i];
+        }
 
-            return 0;
+        if (sqrt(diff) <= tolerance * sqrt(norm))
+        {
+            converged = 1;
+            break;
         }
+    }
 
-        return 2;
+    /* The limit is only positive semi-definite. Lift the small
+       eigenvalues to the floor and rescale back to a unit diagonal,
+       which keeps it positive definite. */
+    project_psd(n, y, v, w, d, d + n + 1, RQ_MATRIX_EIGENVALUE_FLOOR);
+    for (i = 0; i < n; i++)
+        d[i] = 1.0 / sqrt(y[i * n + i]);
+    for (i = 0; i < n; i++)
+    {
+        unsigned long j;
+        for (j = 0; j < n; j++)
+            out->vals[i * n + j] = (i == j ? 1.0 : y[i * n + j] * d[i] * d[j]);
     }
 
-    return 1;
+    rq_linalg_free(y);
+
+    return (converged ? 0 : 2);
 }
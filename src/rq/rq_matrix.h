@@ -47,6 +47,16 @@ typedef struct rq_matrix {
     double *vals;
 } *rq_matrix_t;
 
+/** Get a value in the matrix, without the function call overhead of
+ * rq_matrix_get(). The values are stored in row-major order.
+ */
+#define RQ_MATRIX_GET(m, r, c) ((m)->vals[(r) * (m)->cols + (c)])
+
+/** Set a value in the matrix, without the function call overhead of
+ * rq_matrix_set().
+ */
+#define RQ_MATRIX_SET(m, r, c, v) ((m)->vals[(r) * (m)->cols + (c)] = (v))
+
 
 /** Test whether the rq_matrix is NULL */
 RQ_EXPORT int rq_matrix_is_null(rq_matrix_t obj);
@@ -130,6 +140,11 @@ RQ_EXPORT short rq_matrix_multiply_scalar(const rq_matrix_t m1, double scalar, r
 RQ_EXPORT void rq_matrix_transpose(const rq_matrix_t in, rq_matrix_t out);
 
 /** Perform a cholesky decomposition of a matrix.
+ *
+ * The lower triangle of 'out' receives L and the upper triangle is
+ * zeroed. 'in' and 'out' may be the same matrix. Returns 0 on
+ * success, 1 if the dimensions are wrong and 2 if the matrix isn't
+ * positive definite.
  */
 RQ_EXPORT short rq_matrix_cholesky(const rq_matrix_t in, rq_matrix_t out);
 
@@ -144,10 +159,42 @@ RQ_EXPORT void rq_matrix_householder(rq_matrix_t m, double *d, double *e);
  */
 RQ_EXPORT short rq_matrix_ql(rq_matrix_t m, double *d, double *e);
 
-/** Calculate the cross product of 2 matrices.
+/** Calculate the eigenvalues and eigenvectors of a real symmetric
+ * matrix.
+ *
+ * On return 'd' holds the eigenvalues in ascending order and the
+ * columns of 'm' the corresponding eigenvectors. Returns 0 on
+ * success.
+ */
+RQ_EXPORT short rq_matrix_eigen_symmetric(rq_matrix_t m, double *d);
+
+/** Find the nearest correlation matrix (in the Frobenius norm) to a
+ * symmetric matrix of approximate correlations, using Higham's
+ * alternating projections algorithm with Dykstra's correction.
+ *
+ * The result in 'out' has a unit diagonal and eigenvalues no smaller
+ * than a small positive floor, so it can always be passed to
+ * rq_matrix_cholesky(). 'in' and 'out' may be the same matrix.
+ * Returns 0 if the algorithm converged to within 'tolerance' in
+ * 'max_iterations' iterations, otherwise non-zero (though 'out' is
+ * still a valid correlation matrix).
+ */
+RQ_EXPORT short rq_matrix_nearest_correlation(const rq_matrix_t in, rq_matrix_t out, double tolerance, unsigned int max_iterations);
+
+/** Calculate the cross product of 2 matrices. 'out' must not be the
+ * same matrix as 'm1' or 'm2'.
  */
 RQ_EXPORT short rq_matrix_multiply(const rq_matrix_t m1, rq_matrix_t m2, rq_matrix_t out);
 
+/** Multiply a matrix by the vector 'x', putting the result in 'y'.
+ */
+RQ_EXPORT short rq_matrix_multiply_vector(const rq_matrix_t m, const double *x, double *y);
+
+/** Solve L * x = b in place, where 'l' is lower triangular (such as
+ * the result of rq_matrix_cholesky()). On entry 'x' holds b.
+ */
+RQ_EXPORT short rq_matrix_solve_lower(const rq_matrix_t l, double *x);
+
 #ifdef __cplusplus
 #if 0
 { // purely to not screw up my indenting...
@@ -22,6 +22,7 @@
 ** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 */
 #include "rq_memdbg.h"
+#include "rq_instrument.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -34,80 +35,118 @@
 #define RQ_MEMDBG_RQ_REALLOC_ID	3
 #define RQ_MEMDBG_RQ_STRDUP_ID		4
 
+/* the header is padded to keep the memory handed out 16 byte aligned */
+#define MEMHDR_SIZE ((sizeof(struct memhdr) + 15) & ~(size_t)15)
+#define MEMHDR(p) ((struct memhdr *)(((char *)(p)) - MEMHDR_SIZE))
+#define MEMHDR_DATA(mh) ((void *)(((char *)(mh)) + MEMHDR_SIZE))
+
 /* -- structs ----------------------------------------------------- */
 
 struct memhdr {
     unsigned long alloc_id;
+    size_t size;
     short freed;
     short alloced_by;
+    unsigned short subsystem; /* as charged by rq_instrument */
 };
 
 /* -- statics ----------------------------------------------------- */
 
 static unsigned long alloc_id = 0;
 
+#ifdef DEBUG_MEMORY
+static int s_trace = 1;
+#else
+static int s_trace = 0;
+#endif
+
 /* -- code -------------------------------------------------------- */
 
-RQ_EXPORT void *
-malloc_dbg(const char *file, unsigned int line, unsigned int size)
+RQ_EXPORT void
+rq_memdbg_set_trace(int trace)
 {
-    struct memhdr *p = (struct memhdr *)malloc(size + sizeof(struct memhdr));
+    s_trace = trace;
+}
+
+static void *
+alloc_dbg(const char *file, unsigned int line, size_t size, short alloced_by)
+{
+    struct memhdr *p = (struct memhdr *)malloc(size + MEMHDR_SIZE);
 	if (p)
 	{
 		p->alloc_id = ++alloc_id;
+		p->size = size;
 		p->freed = 0;
-		p->alloced_by = RQ_MEMDBG_RQ_MALLOC_ID;
-
-		printf("malloc\t%s\t%d\t'%p'\n", file, line, p);
+		p->alloced_by = alloced_by;
+		p->subsystem = (unsigned short)rq_instrument_record_alloc(file, line, size);
 	}
 	else
 	{
-		printf("memory error! Unable to malloc %d bytes\n", size);
+		printf("memory error! Unable to allocate %lu bytes\n", (unsigned long)size);
 		assert(0);
 	}
 
-    return ((char *)p) + sizeof(struct memhdr);
+    return p ? MEMHDR_DATA(p) : NULL;
+}
+
+RQ_EXPORT void *
+malloc_dbg(const char *file, unsigned int line, unsigned int size)
+{
+    void *p = alloc_dbg(file, line, size, RQ_MEMDBG_RQ_MALLOC_ID);
+
+    if (s_trace)
+        printf("malloc\t%s\t%d\t'%p'\n", file, line, (void *)MEMHDR(p));
+
+    return p;
 }
 
 RQ_EXPORT void *
 calloc_dbg(const char *file, unsigned int line, unsigned int n, unsigned int s)
 {
-    struct memhdr *p = (struct memhdr *)malloc((n * s) + sizeof(struct memhdr));
-	if (p)
-	{
-		memset((void *)(((char *)p) + sizeof(struct memhdr)), '\0', n * s);
+    void *p = alloc_dbg(file, line, n * s, RQ_MEMDBG_RQ_CALLOC_ID);
 
-		p->alloc_id = ++alloc_id;
-		p->freed = 0;
-		p->alloced_by = RQ_MEMDBG_RQ_CALLOC_ID;
+    memset(p, '\0', n * s);
 
-		printf("calloc\t%s\t%d\t'%p'\n", file, line, (void *)p);
-	}
-	else
-	{
-		printf("memory error! Unable to calloc %d x %d bytes\n", n, s);
-		assert(0);
-	}
+    if (s_trace)
+        printf("calloc\t%s\t%d\t'%p'\n", file, line, (void *)MEMHDR(p));
 
-    return (void *)(((char *)p) + sizeof(struct memhdr));
+    return p;
 }
 
 RQ_EXPORT void *
 realloc_dbg(const char *file, unsigned int line, void *ptr, unsigned int s)
 {
-    struct memhdr *mh = (struct memhdr *)(((char *)ptr) - sizeof(struct memhdr));
+    struct memhdr *mh;
     struct memhdr *p;
+    size_t old_size;
+
+    if (!ptr)
+    {
+        p = MEMHDR(alloc_dbg(file, line, s, RQ_MEMDBG_RQ_REALLOC_ID));
+
+        if (s_trace)
+            printf("realloc\t%s\t%d\t'%p'\n", file, line, (void *)p);
+
+        return MEMHDR_DATA(p);
+    }
+
+    mh = MEMHDR(ptr);
+    old_size = mh->size;
 
     /** \todo Print out original header here */
 
-    p = (struct memhdr *)realloc(mh, s + sizeof(struct memhdr));
+    p = (struct memhdr *)realloc(mh, s + MEMHDR_SIZE);
 	if (p)
 	{
 		p->alloc_id = ++alloc_id;
+		p->size = s;
 		p->freed = 0;
 		p->alloced_by = RQ_MEMDBG_RQ_REALLOC_ID;
 
-		printf("realloc\t%s\t%d\t'%p'\n", file, line, p);
+		rq_instrument_record_realloc((enum rq_instrument_subsystem)p->subsystem, old_size, s);
+
+		if (s_trace)
+			printf("realloc\t%s\t%d\t'%p'\n", file, line, (void *)p);
 	}
 	else
 	{
@@ -115,68 +154,68 @@ realloc_dbg(const char *file, unsigned int line, void *ptr, unsigned int s)
 		assert(0);
 	}
 
-    return ((char *)p) + sizeof(struct memhdr);
+    return p ? MEMHDR_DATA(p) : NULL;
 
 }
 
 RQ_EXPORT char *
 strdup_dbg(const char *file, unsigned int line, const char *s)
 {
-    struct memhdr *p = (struct memhdr *)malloc(strlen(s) + 1 + sizeof(struct memhdr));
-	if (p)
-	{
-		p->alloc_id = ++alloc_id;
-		p->freed = 0;
-		p->alloced_by = RQ_MEMDBG_RQ_STRDUP_ID;
+    char *p = (char *)alloc_dbg(file, line, strlen(s) + 1, RQ_MEMDBG_RQ_STRDUP_ID);
 
-		strcpy((char *)(((char *)p) + sizeof(struct memhdr)), s);
+    strcpy(p, s);
     
-        printf("strdup\t%s\t%d\t'%p'\t%s\n", file, line, p, s); 
-	}
-	else
-	{
-		printf("memory error! Unable to strdup %d bytes\n", strlen(s)+1+sizeof(struct memhdr));
-		assert(0);
-	}
+    if (s_trace)
+        printf("strdup\t%s\t%d\t'%p'\t%s\n", file, line, (void *)MEMHDR(p), s); 
 
-    return (char *)(((char *)p) + sizeof(struct memhdr));
+    return p;
 }
 
 RQ_EXPORT void 
 free_dbg(const char *file, unsigned int line, void *p)
 {
-    struct memhdr *mh = (struct memhdr *)(((char *)p) - sizeof(struct memhdr));
+    struct memhdr *mh;
     const char *alloced_by = "UNKNOWN";
     const char *memdmp = "";
 
+    if (!p)
+        return;
+
+    mh = MEMHDR(p);
+
     if (mh->freed)
         printf("*Block %p alloced by %d has already been freed!\n", 
-               mh,
+               (void *)mh,
                mh->alloced_by
                );
 
-    switch (mh->alloced_by)
+    rq_instrument_record_free((enum rq_instrument_subsystem)mh->subsystem, mh->size);
+
+    if (s_trace)
     {
-        case RQ_MEMDBG_RQ_MALLOC_ID:
-            alloced_by = "malloc";
-            break;
-
-        case RQ_MEMDBG_RQ_CALLOC_ID:
-            alloced_by = "calloc";
-            break;
-
-        case RQ_MEMDBG_RQ_REALLOC_ID:
-            alloced_by = "realloc";
-            break;
-
-        case RQ_MEMDBG_RQ_STRDUP_ID:
-            alloced_by = "strdup";
-            memdmp = p;
-            break;
+        switch (mh->alloced_by)
+        {
+            case RQ_MEMDBG_RQ_MALLOC_ID:
+                alloced_by = "malloc";
+                break;
+
+            case RQ_MEMDBG_RQ_CALLOC_ID:
+                alloced_by = "calloc";
+                break;
+
+            case RQ_MEMDBG_RQ_REALLOC_ID:
+                alloced_by = "realloc";
+                break;
+
+            case RQ_MEMDBG_RQ_STRDUP_ID:
+                alloced_by = "strdup";
+                memdmp = p;
+                break;
+        }
+
+        printf("free called by\t%s\t%d\t'%p'\t%s\t%s\n", file, line, (void *)mh, alloced_by, memdmp);
     }
 
-    printf("free called by\t%s\t%d\t'%p'\t%s\t%s\n", file, line, mh, alloced_by, memdmp);
-
 	mh->freed = 1;
 
     free(mh);
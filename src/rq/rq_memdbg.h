@@ -42,6 +42,11 @@ extern "C" {
 
 /* -- prototypes -------------------------------------------------- */
 
+/** Print every allocation and free to stdout, for tracking down
+ * leaks. On by default when built with DEBUG_MEMORY.
+ */
+RQ_EXPORT void rq_memdbg_set_trace(int trace);
+
 RQ_EXPORT void *malloc_dbg(const char *file, unsigned int line, unsigned int);
 
 RQ_EXPORT void *calloc_dbg(const char *file, unsigned int line, unsigned int, unsigned int);
@@ -0,0 +1,123 @@
+/*
+** rq_mutex.c
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#include "rq_mutex.h"
+#include <stdlib.h>
+
+#if defined(WIN32)
+
+#include <windows.h>
+
+struct rq_mutex {
+    CRITICAL_SECTION cs;
+};
+
+RQ_EXPORT rq_mutex_t
+rq_mutex_alloc()
+{
+    rq_mutex_t m = (rq_mutex_t)RQ_MALLOC(sizeof(struct rq_mutex));
+    InitializeCriticalSection(&m->cs);
+    return m;
+}
+
+RQ_EXPORT void
+rq_mutex_free(rq_mutex_t m)
+{
+    DeleteCriticalSection(&m->cs);
+    RQ_FREE(m);
+}
+
+RQ_EXPORT void
+rq_mutex_lock(rq_mutex_t m)
+{
+    EnterCriticalSection(&m->cs);
+}
+
+RQ_EXPORT void
+rq_mutex_unlock(rq_mutex_t m)
+{
+    LeaveCriticalSection(&m->cs);
+}
+
+#elif defined(RQ_THREADS)
+
+#include <pthread.h>
+
+struct rq_mutex {
+    pthread_mutex_t mutex;
+};
+
+RQ_EXPORT rq_mutex_t
+rq_mutex_alloc()
+{
+    rq_mutex_t m = (rq_mutex_t)RQ_MALLOC(sizeof(struct rq_mutex));
+    pthread_mutex_init(&m->mutex, NULL);
+    return m;
+}
+
+RQ_EXPORT void
+rq_mutex_free(rq_mutex_t m)
+{
+    pthread_mutex_destroy(&m->mutex);
+    RQ_FREE(m);
+}
+
+RQ_EXPORT void
+rq_mutex_lock(rq_mutex_t m)
+{
+    pthread_mutex_lock(&m->mutex);
+}
+
+RQ_EXPORT void
+rq_mutex_unlock(rq_mutex_t m)
+{
+    pthread_mutex_unlock(&m->mutex);
+}
+
+#else
+
+struct rq_mutex {
+    int unused;
+};
+
+RQ_EXPORT rq_mutex_t
+rq_mutex_alloc()
+{
+    return (rq_mutex_t)RQ_CALLOC(1, sizeof(struct rq_mutex));
+}
+
+RQ_EXPORT void
+rq_mutex_free(rq_mutex_t m)
+{
+    RQ_FREE(m);
+}
+
+RQ_EXPORT void
+rq_mutex_lock(rq_mutex_t m)
+{
+}
+
+RQ_EXPORT void
+rq_mutex_unlock(rq_mutex_t m)
+{
+}
+
+#endif
@@ -0,0 +1,69 @@
+/**
+ * @file
+ *
+ * A mutual exclusion lock, for the caches that are shared between threads.
+ */
+/*
+** rq_mutex.h
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#ifndef rq_mutex_h
+#define rq_mutex_h
+
+#include "rq_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#if 0
+} // purely to not screw up my indenting...
+#endif
+#endif
+
+/** A handle to a mutex. On Win32 this is a critical section, and
+ * elsewhere a pthread mutex if the library was configured with
+ * threads (RQ_THREADS). Without threads locking does nothing.
+ */
+typedef struct rq_mutex *rq_mutex_t;
+
+/** Allocate an unlocked mutex.
+ */
+RQ_EXPORT rq_mutex_t rq_mutex_alloc();
+
+/** Free a mutex. It must not be locked.
+ */
+RQ_EXPORT void rq_mutex_free(rq_mutex_t m);
+
+/** Lock the mutex, waiting for any other thread holding it. The
+ * mutex is not recursive.
+ */
+RQ_EXPORT void rq_mutex_lock(rq_mutex_t m);
+
+/** Unlock a mutex locked by this thread.
+ */
+RQ_EXPORT void rq_mutex_unlock(rq_mutex_t m);
+
+#ifdef __cplusplus
+#if 0
+{ // purely to not screw up my indenting...
+#endif
+};
+#endif
+
+#endif
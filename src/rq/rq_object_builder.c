@@ -37,7 +37,8 @@ _rq_object_builder_alloc(
     const char *type_name,
     void *derived_data,
     void (*free_func)(void *),
-    void * (*build_func)(void *, rq_stream_t, rq_object_schema_mgr_t, const char *, const char *)
+    void * (*build_func)(void *, rq_stream_t, rq_object_schema_mgr_t, const char *, const char *),
+    rq_error_code (*build_all_func)(void *, rq_stream_t, rq_object_schema_mgr_t, const char *, const char *, void (*)(void *, void *), void *, unsigned long *)
     )
 {
     struct rq_object_builder *b = (struct rq_object_builder *)
@@ -47,6 +48,7 @@ _rq_object_builder_alloc(
     b->derived_data = derived_data;
     b->free_func = free_func;
     b->build_func = build_func;
+    b->build_all_func = build_all_func;
 
     return b;
 }
@@ -83,3 +85,27 @@ rq_object_builder_build(
         type_name
         );
 }
+
+RQ_EXPORT rq_error_code
+rq_object_builder_build_all(
+    rq_object_builder_t b, 
+    rq_stream_t stream, 
+    rq_object_schema_mgr_t schema_mgr, 
+    const char *path,
+    const char *type_name,
+    void (*object_func)(void *object_func_data, void *object),
+    void *object_func_data,
+    unsigned long *num_built
+    )
+{
+    return (*b->build_all_func)(
+        b->derived_data,
+        stream,
+        schema_mgr,
+        path,
+        type_name,
+        object_func,
+        object_func_data,
+        num_built
+        );
+}
@@ -50,6 +50,7 @@ typedef struct rq_object_builder {
     void *derived_data;
     void (*free_func)(void *);
     void * (*build_func)(void *, rq_stream_t, rq_object_schema_mgr_t, const char *, const char *);
+    rq_error_code (*build_all_func)(void *, rq_stream_t, rq_object_schema_mgr_t, const char *, const char *, void (*)(void *, void *), void *, unsigned long *);
 } *rq_object_builder_t;
 
 /** Test whether the rq_object_builder is NULL */
@@ -64,7 +65,8 @@ RQ_EXPORT rq_object_builder_t _rq_object_builder_alloc(
     const char *type_name,
     void *derived_data,
     void (*free_func)(void *),
-    void * (*build_func)(void *, rq_stream_t, rq_object_schema_mgr_t, const char *, const char *)
+    void * (*build_func)(void *, rq_stream_t, rq_object_schema_mgr_t, const char *, const char *),
+    rq_error_code (*build_all_func)(void *, rq_stream_t, rq_object_schema_mgr_t, const char *, const char *, void (*)(void *, void *), void *, unsigned long *)
     );
 
 /**
@@ -89,6 +91,27 @@ rq_object_builder_build(
     const char *type_name
     );
 
+/**
+ * Build an object from every match for the path in the stream,
+ * handing each one to object_func, which takes ownership of it.
+ * The schemas are prepared once for the whole stream. The objects
+ * before an error in the stream are still handed out.
+ *
+ * @param num_built If not NULL, set to the number of objects built
+ * @return RQ_OK, or the error from reading or parsing the stream
+ */
+RQ_EXPORT rq_error_code
+rq_object_builder_build_all(
+    rq_object_builder_t builder, 
+    rq_stream_t stream, 
+    rq_object_schema_mgr_t schema_mgr, 
+    const char *path,
+    const char *type_name,
+    void (*object_func)(void *object_func_data, void *object),
+    void *object_func_data,
+    unsigned long *num_built
+    );
+
 #ifdef __cplusplus
 #if 0
 { // purely to not screw up my indenting...
@@ -23,345 +23,600 @@
 */
 #include "rq_object_builder_xml.h"
 #include "rq_xml_parser.h"
-#include "rq_double_linked_list.h"
+#include "rq_error.h"
 #include "rq_object.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
 
+/*
+ * Before parsing, the schema for the type being built and the
+ * schemas of all the types it can contain are compiled into
+ * dispatch tables. Each table maps a property's element or
+ * attribute name to what to do with it through a perfect hash, so a
+ * parse event needs one hash of the name, one probe and one
+ * comparison. The parser hands over views into the document, and
+ * nothing is allocated or copied per event except the values handed
+ * to the schema setters, which need NUL terminated strings.
+ */
+
+enum rq_object_builder_xml_value_type {
+    VALUE_TYPE_STRING,
+    VALUE_TYPE_INTEGER,
+    VALUE_TYPE_DOUBLE,
+    VALUE_TYPE_DATE,
+    VALUE_TYPE_OBJECT
+};
 
-enum rq_next_value_type {
-    NEXT_VALUE_TYPE_NONE,
-    NEXT_VALUE_TYPE_STRING,
-    NEXT_VALUE_TYPE_INTEGER,
-    NEXT_VALUE_TYPE_DOUBLE,
-    NEXT_VALUE_TYPE_DATE
+struct rq_object_builder_xml_type;
+
+struct rq_object_builder_xml_property {
+    const char *name; /**< the schema's property name, '@' first for attributes */
+    unsigned len;
+    enum rq_object_builder_xml_value_type value_type;
+    struct rq_object_builder_xml_type *object_type; /**< for VALUE_TYPE_OBJECT */
 };
 
-struct rq_object_builder_xml_el_node {
-    const char *object_name;
+struct rq_object_builder_xml_type {
+    rq_object_schema_t schema;
+    struct rq_object_builder_xml_property *properties;
+    unsigned num_properties;
+    struct rq_object_builder_xml_property **slots; /**< the perfect hash table */
+    unsigned slot_mask;
+    unsigned long seed;
+    struct rq_object_builder_xml_property *content; /**< the "." property, if any */
+};
+
+/* An object under construction, and the depth of its element. */
+struct rq_object_builder_xml_frame {
+    struct rq_object_builder_xml_type *type;
     void *object;
-    rq_object_schema_t object_schema;
+    unsigned depth;
+    const char *property_name; /**< in the parent, NULL for the object being built */
 };
 
 struct rq_object_builder_xml {
     rq_object_schema_mgr_t object_schema_mgr;
-    rq_double_linked_list_t object_list;
-    int started_construction;
-    const char *object_path;
-    const char *object_type_name;
-    const char *current_path_ptr;
-    unsigned current_path_depth;
-    char *namebuf;
-    unsigned namebuflen;
-    enum rq_next_value_type next_value_type;
-    struct rq_object_builder_xml_el_node *current_node;
+    struct rq_object_builder_xml_type **types;
+    unsigned num_types;
+
+    struct rq_xml_parser_view *path; /**< the components of the object path */
+    unsigned path_len;
+    unsigned path_matched; /**< how many path components the current element is inside */
+    unsigned depth;
+
+    struct rq_object_builder_xml_frame *frames;
+    unsigned num_frames;
+    unsigned max_frames;
 
+    struct rq_object_builder_xml_property *pending; /**< a property element waiting for its value */
+    unsigned pending_depth;
+
+    char *valuebuf;
+    unsigned valuebuflen;
+
+    void (*object_func)(void *, void *);
+    void *object_func_data;
+    unsigned long num_built;
     int finished;
     void *built_object;
 };
 
 const char * const rq_object_builder_xml_type_name = "XMLObjectBuilder";
 
-static void
-rq_object_builder_xml_el_node_free(void *p)
+/* FNV-1a, started from a seed so that the table can retry with
+   another seed until no two properties share a slot. */
+#define HASH_START(seed) (2166136261UL ^ (seed))
+#define HASH_STEP(h, c) ((((h) ^ (unsigned char)(c)) * 16777619UL) & 0xFFFFFFFFUL)
+
+#define MAX_HASH_SEEDS 64
+
+static unsigned long
+hash_name(unsigned long seed, int is_attribute, const char *name, unsigned len)
 {
-    struct rq_object_builder_xml_el_node *n = (struct rq_object_builder_xml_el_node *)p;
+    unsigned long h = HASH_START(seed);
+    unsigned i;
+
+    if (is_attribute)
+        h = HASH_STEP(h, '@');
+    for (i = 0; i < len; i++)
+        h = HASH_STEP(h, name[i]);
 
-    if (n->object_name)
-       RQ_FREE((char *)n->object_name);
-   RQ_FREE(n);
+    return h;
 }
 
-static void
-rq_object_builder_xml_free(void *p)
+static struct rq_object_builder_xml_property *
+find_property(const struct rq_object_builder_xml_type *type, int is_attribute, const struct rq_xml_parser_view *name)
 {
-    struct rq_object_builder_xml *obx = (struct rq_object_builder_xml *)p;
-    if (obx)
-    {
-        rq_double_linked_list_free(obx->object_list);
+    struct rq_object_builder_xml_property *prop;
 
-        if (obx->object_type_name)
-           RQ_FREE((char *)obx->object_type_name);
-       RQ_FREE(obx);
-    }
+    if (!type->slots)
+        return NULL;
+
+    prop = type->slots[hash_name(type->seed, is_attribute, name->str, name->len) & type->slot_mask];
+    if (!prop || prop->len != name->len + (is_attribute ? 1 : 0))
+        return NULL;
+    if (is_attribute)
+        return (prop->name[0] == '@' && !memcmp(prop->name + 1, name->str, name->len) ? prop : NULL);
+
+    return (prop->name[0] != '@' && !memcmp(prop->name, name->str, name->len) ? prop : NULL);
 }
 
-void 
-rq_object_builder_xml_callback(
-    void *callback_data, 
-    enum rq_xml_parser_parse_event_type parse_event_type, 
-    const char *name, 
-    const char *value
-    )
+/* Find a seed and table size that give every property its own slot. */
+static void
+build_hash_table(struct rq_object_builder_xml_type *type)
 {
-    struct rq_object_builder_xml *obx = (struct rq_object_builder_xml *)callback_data;
-    short process_event = 0;
+    unsigned num_slots = 4;
 
-    if (obx->finished)
+    if (!type->num_properties)
         return;
 
-    if (!obx->started_construction)
+    while (num_slots < type->num_properties * 2)
+        num_slots *= 2;
+
+    while (1)
     {
-        if (parse_event_type == RQ_XML_PARSER_PARSE_EVENT_TYPE_ENTERING_ELEMENT &&
-            !memcmp(obx->current_path_ptr, name, strlen(name)) &&
-            (obx->current_path_ptr[strlen(name)] == '/' || 
-             obx->current_path_ptr[strlen(name)] == '\0')
-            )
+        unsigned long seed;
+
+        type->slots = (struct rq_object_builder_xml_property **)
+            RQ_REALLOC(type->slots, num_slots * sizeof(struct rq_object_builder_xml_property *));
+        type->slot_mask = num_slots - 1;
+
+        for (seed = 0; seed < MAX_HASH_SEEDS; seed++)
         {
-            if (obx->current_path_ptr[strlen(name)] == '/')
+            unsigned i;
+
+            memset(type->slots, 0, num_slots * sizeof(struct rq_object_builder_xml_property *));
+            for (i = 0; i < type->num_properties; i++)
             {
-                obx->current_path_ptr = obx->current_path_ptr + strlen(name) + 1;
-                obx->current_path_depth++;
+                struct rq_object_builder_xml_property *prop = &type->properties[i];
+                int is_attribute = (prop->name[0] == '@');
+                unsigned slot = hash_name(seed, is_attribute, prop->name + is_attribute, prop->len - is_attribute) & type->slot_mask;
+
+                if (type->slots[slot])
+                    break;
+                type->slots[slot] = prop;
             }
-            else if (obx->current_path_ptr[strlen(name)] == '\0')
+
+            if (i == type->num_properties)
             {
-                obx->started_construction = 1;
-                process_event = 1;
+                type->seed = seed;
+                return;
             }
         }
-        else if (parse_event_type == RQ_XML_PARSER_PARSE_EVENT_TYPE_LEAVING_ELEMENT &&
-                 obx->current_path_depth > 0)
+
+        num_slots *= 2;
+    }
+}
+
+static struct rq_object_builder_xml_type *compile_type(struct rq_object_builder_xml *obx, rq_object_schema_t schema);
+
+struct compile_property_data {
+    struct rq_object_builder_xml *obx;
+    struct rq_object_builder_xml_type *type;
+};
+
+static void
+compile_property(void *p, void *node_data)
+{
+    struct compile_property_data *cpd = (struct compile_property_data *)p;
+    rq_object_schema_node_t node = (rq_object_schema_node_t)node_data;
+    const char *type_name = rq_object_schema_node_get_type_name(node);
+    struct rq_object_builder_xml_property prop;
+
+    prop.name = rq_object_schema_node_get_property_name(node);
+    prop.len = (unsigned)strlen(prop.name);
+    prop.object_type = NULL;
+
+    if (!strcmp(type_name, "string"))
+        prop.value_type = VALUE_TYPE_STRING;
+    else if (!strcmp(type_name, "integer"))
+        prop.value_type = VALUE_TYPE_INTEGER;
+    else if (!strcmp(type_name, "double"))
+        prop.value_type = VALUE_TYPE_DOUBLE;
+    else if (!strcmp(type_name, "date"))
+        prop.value_type = VALUE_TYPE_DATE;
+    else
+    {
+        rq_object_schema_t schema = rq_object_schema_mgr_find(cpd->obx->object_schema_mgr, type_name);
+
+        /* properties of unknown types, and objects as attributes or
+           content, are skipped */
+        if (!schema || prop.name[0] == '@' || !strcmp(prop.name, "."))
+            return;
+
+        prop.value_type = VALUE_TYPE_OBJECT;
+        prop.object_type = compile_type(cpd->obx, schema);
+    }
+
+    cpd->type->properties[cpd->type->num_properties++] = prop;
+}
+
+/* Compile a schema, and those of the types it contains. Each schema
+   is compiled once, so recursive types are fine. */
+static struct rq_object_builder_xml_type *
+compile_type(struct rq_object_builder_xml *obx, rq_object_schema_t schema)
+{
+    struct rq_object_builder_xml_type *type;
+    struct compile_property_data cpd;
+    unsigned i;
+
+    for (i = 0; i < obx->num_types; i++)
+        if (obx->types[i]->schema == schema)
+            return obx->types[i];
+
+    type = (struct rq_object_builder_xml_type *)RQ_CALLOC(1, sizeof(struct rq_object_builder_xml_type));
+    type->schema = schema;
+    type->properties = (struct rq_object_builder_xml_property *)
+        RQ_CALLOC(rq_tree_rb_size(schema->properties) + 1, sizeof(struct rq_object_builder_xml_property));
+
+    obx->types = (struct rq_object_builder_xml_type **)
+        RQ_REALLOC(obx->types, (obx->num_types + 1) * sizeof(struct rq_object_builder_xml_type *));
+    obx->types[obx->num_types++] = type;
+
+    cpd.obx = obx;
+    cpd.type = type;
+    rq_tree_rb_traverse_inorder(schema->properties, &cpd, compile_property);
+
+    /* the element's own content isn't looked up by name */
+    for (i = 0; i < type->num_properties; i++)
+        if (!strcmp(type->properties[i].name, "."))
         {
-            if (obx->current_path_ptr > obx->object_path && 
-                *(obx->current_path_ptr-1) == '/')
-                obx->current_path_ptr -= 2;
-            while (obx->current_path_ptr > obx->object_path)
-            {
-                if (*(obx->current_path_ptr-1) == '/')
-                    break;
-                obx->current_path_depth--;
-            }
+            type->content = &type->properties[i];
+            break;
         }
+
+    build_hash_table(type);
+
+    return type;
+}
+
+static void
+free_types(struct rq_object_builder_xml *obx)
+{
+    unsigned i;
+
+    for (i = 0; i < obx->num_types; i++)
+    {
+        if (obx->types[i]->slots)
+            RQ_FREE(obx->types[i]->slots);
+        RQ_FREE(obx->types[i]->properties);
+        RQ_FREE(obx->types[i]);
     }
-    else
-        process_event = 1;
+    if (obx->types)
+        RQ_FREE(obx->types);
+}
 
-    if (process_event)
+/* Copy a view into the value buffer, NUL terminated. */
+static const char *
+view_to_string(struct rq_object_builder_xml *obx, const struct rq_xml_parser_view *v)
+{
+    if (v->len >= obx->valuebuflen)
     {
-        switch (parse_event_type)
-        {
-            case RQ_XML_PARSER_PARSE_EVENT_TYPE_ENTERING_ELEMENT:
-            {
-                const char *object_type_name = NULL;
+        obx->valuebuflen = v->len + 1;
+        obx->valuebuf = (char *)RQ_REALLOC(obx->valuebuf, obx->valuebuflen);
+    }
+    memcpy(obx->valuebuf, v->str, v->len);
+    obx->valuebuf[v->len] = '\0';
 
-                if (rq_double_linked_list_size(obx->object_list) > 0)
-                {
-                    rq_double_linked_list_iterator_t dll_it = rq_double_linked_list_rbegin(obx->object_list);
-                    struct rq_object_builder_xml_el_node *node = 
-                        (struct rq_object_builder_xml_el_node *)rq_double_linked_list_iterator_get_data(dll_it);
+    return obx->valuebuf;
+}
 
-                    rq_object_schema_node_t osn = rq_object_schema_find_property(node->object_schema, name);
-                    if (osn)
-                        object_type_name = rq_object_schema_node_get_type_name(osn);
-                }
-                else
-                    object_type_name = obx->object_type_name;
+#define IS_DIGIT(c) ((unsigned)((c) - '0') <= 9)
 
-                if (object_type_name)
-                {
-                    if (!strcmp(object_type_name, "string"))
-                        obx->next_value_type = NEXT_VALUE_TYPE_STRING;
-                    else if (!strcmp(object_type_name, "integer"))
-                        obx->next_value_type = NEXT_VALUE_TYPE_INTEGER;
-                    else if (!strcmp(object_type_name, "double"))
-                        obx->next_value_type = NEXT_VALUE_TYPE_DOUBLE;
-                    else if (!strcmp(object_type_name, "date"))
-                        obx->next_value_type = NEXT_VALUE_TYPE_DATE;
-                    else
-                    {
-                        rq_object_schema_t object_schema = 
-                            rq_object_schema_mgr_find(obx->object_schema_mgr, object_type_name);
-                        if (object_schema)
-                        {
-                            struct rq_object_builder_xml_el_node *node = 
-                                (struct rq_object_builder_xml_el_node *)
-                                RQ_MALLOC(sizeof(struct rq_object_builder_xml_el_node));
-
-                            obx->current_node = node;
-
-                            node->object_name = RQ_STRDUP(name);
-                            node->object = rq_object_schema_construct_object(object_schema);
-                            node->object_schema = object_schema;
-                            rq_double_linked_list_append(obx->object_list, node);
-                        }
-                    }
-                }
+static rq_date
+parse_date(struct rq_object_builder_xml *obx, const struct rq_xml_parser_view *v)
+{
+    const char *s = v->str;
 
-            }
-            break;
+    if (v->len == 10 && s[4] == '-' && s[7] == '-' &&
+        IS_DIGIT(s[0]) && IS_DIGIT(s[1]) && IS_DIGIT(s[2]) && IS_DIGIT(s[3]) &&
+        IS_DIGIT(s[5]) && IS_DIGIT(s[6]) && IS_DIGIT(s[8]) && IS_DIGIT(s[9]))
+    {
+        short month = (short)((s[5] - '0') * 10 + (s[6] - '0'));
+        short day = (short)((s[8] - '0') * 10 + (s[9] - '0'));
 
-            case RQ_XML_PARSER_PARSE_EVENT_TYPE_LEAVING_ELEMENT:
-            {
-                rq_double_linked_list_iterator_t dll_it = rq_double_linked_list_rbegin(obx->object_list);
-                /* if (rq_double_linked_list_at_rend(dll_it))
-                   do error processing... 
-                */
-                struct rq_object_builder_xml_el_node *child_node = 
-                    (struct rq_object_builder_xml_el_node *)rq_double_linked_list_iterator_get_data(dll_it);
+        if (month >= 1 && month <= 12 && day >= 1 && day <= 31)
+            return rq_date_from_dmy(
+                day, month, 
+                (short)((s[0] - '0') * 1000 + (s[1] - '0') * 100 + (s[2] - '0') * 10 + (s[3] - '0')));
+    }
 
-                obx->next_value_type = NEXT_VALUE_TYPE_NONE;
+    return rq_date_parse(view_to_string(obx, v), RQ_DATE_FORMAT_YMD);
+}
 
-                if (!strcmp(child_node->object_name, name))
-                {
-                    struct rq_object_builder_xml_el_node *parent_node = NULL;
+static void
+set_value(struct rq_object_builder_xml *obx, struct rq_object_builder_xml_frame *frame, const struct rq_object_builder_xml_property *prop, const struct rq_xml_parser_view *value)
+{
+    rq_object_schema_t schema = frame->type->schema;
 
-                    dll_it = rq_double_linked_list_iterator_decr(dll_it);
-                    parent_node = 
-                        (struct rq_object_builder_xml_el_node *)rq_double_linked_list_iterator_get_data(dll_it);
+    switch (prop->value_type)
+    {
+        case VALUE_TYPE_STRING:
+            rq_object_schema_set_value_string(schema, frame->object, prop->name, view_to_string(obx, value));
+            break;
 
-                    if (!parent_node)
-                    {
-                        obx->finished = 1;
-                        obx->built_object = child_node->object;
-                        obx->current_node = NULL;
-                    }
-                    else
-                    {
-                        rq_object_schema_set_value_object(parent_node->object_schema, parent_node->object, name, child_node->object);
-                        obx->current_node = parent_node;
-                    }
+        case VALUE_TYPE_INTEGER:
+            rq_object_schema_set_value_integer(schema, frame->object, prop->name, atol(view_to_string(obx, value)));
+            break;
 
-                    dll_it = rq_double_linked_list_rbegin(obx->object_list);
-                    rq_double_linked_list_erase(obx->object_list, dll_it);
-                }
-            }
+        case VALUE_TYPE_DOUBLE:
+            rq_object_schema_set_value_double(schema, frame->object, prop->name, atof(view_to_string(obx, value)));
+            break;
+
+        case VALUE_TYPE_DATE:
+            rq_object_schema_set_value_date(schema, frame->object, prop->name, parse_date(obx, value));
             break;
 
-            case RQ_XML_PARSER_PARSE_EVENT_TYPE_GOT_ATTRIBUTE_VALUE:
+        case VALUE_TYPE_OBJECT:
+            break;
+    }
+}
+
+static void
+push_frame(struct rq_object_builder_xml *obx, struct rq_object_builder_xml_type *type, const char *property_name)
+{
+    struct rq_object_builder_xml_frame *frame;
+
+    if (obx->num_frames == obx->max_frames)
+    {
+        obx->max_frames = (obx->max_frames ? obx->max_frames * 2 : 8);
+        obx->frames = (struct rq_object_builder_xml_frame *)
+            RQ_REALLOC(obx->frames, obx->max_frames * sizeof(struct rq_object_builder_xml_frame));
+    }
+
+    frame = &obx->frames[obx->num_frames++];
+    frame->type = type;
+    frame->object = rq_object_schema_construct_object(type->schema);
+    frame->depth = obx->depth;
+    frame->property_name = property_name;
+}
+
+static void
+pop_frame(struct rq_object_builder_xml *obx)
+{
+    struct rq_object_builder_xml_frame *frame = &obx->frames[--obx->num_frames];
+
+    if (obx->num_frames > 0)
+    {
+        struct rq_object_builder_xml_frame *parent = &obx->frames[obx->num_frames - 1];
+        rq_object_schema_set_value_object(parent->type->schema, parent->object, frame->property_name, frame->object);
+    }
+    else
+    {
+        obx->num_built++;
+        if (obx->object_func)
+            (*obx->object_func)(obx->object_func_data, frame->object);
+        else
+        {
+            obx->built_object = frame->object;
+            obx->finished = 1;
+        }
+    }
+}
+
+static int
+view_equals(const struct rq_xml_parser_view *v1, const struct rq_xml_parser_view *v2)
+{
+    return v1->len == v2->len && !memcmp(v1->str, v2->str, v1->len);
+}
+
+/* The text between an object's child elements is just layout. */
+static int
+is_blank(const struct rq_xml_parser_view *v)
+{
+    unsigned i;
+
+    for (i = 0; i < v->len; i++)
+        if (v->str[i] != ' ' && v->str[i] != '\t' && v->str[i] != '\r' && v->str[i] != '\n')
+            return 0;
+
+    return 1;
+}
+
+static void
+rq_object_builder_xml_callback(
+    void *callback_data, 
+    enum rq_xml_parser_parse_event_type parse_event_type, 
+    const struct rq_xml_parser_view *v1, 
+    const struct rq_xml_parser_view *v2, 
+    const struct rq_xml_parser_view *v3
+    )
+{
+    struct rq_object_builder_xml *obx = (struct rq_object_builder_xml *)callback_data;
+
+    if (obx->finished)
+        return;
+
+    switch (parse_event_type)
+    {
+        case RQ_XML_PARSER_PARSE_EVENT_TYPE_ENTERING_ELEMENT:
+            obx->depth++;
+            if (obx->num_frames == 0)
             {
-                if (obx->current_node != NULL)
+                /* still looking for the object path */
+                if (obx->path_matched == obx->depth - 1 && 
+                    obx->path_matched < obx->path_len &&
+                    view_equals(v1, &obx->path[obx->path_matched]))
                 {
-                    rq_object_schema_t object_schema = obx->current_node->object_schema;
-                    unsigned namelen = (unsigned)strlen(name);
-                    if (namelen >= obx->namebuflen)
-                    {
-                        obx->namebuf = (char *)realloc(obx->namebuf, namelen+1);
-                        obx->namebuflen = namelen+1;
-                    }
-
-                    strcpy(obx->namebuf, "@");
-                    strcat(obx->namebuf, name);
-                    rq_object_schema_set_value_string(object_schema, obx->current_node->object, obx->namebuf, value);
+                    obx->path_matched++;
+                    if (obx->path_matched == obx->path_len)
+                        push_frame(obx, obx->types[0], NULL);
+                }
+            }
+            else if (obx->depth == obx->frames[obx->num_frames - 1].depth + 1)
+            {
+                struct rq_object_builder_xml_property *prop = 
+                    find_property(obx->frames[obx->num_frames - 1].type, 0, v1);
 
+                if (prop && prop->value_type == VALUE_TYPE_OBJECT)
+                    push_frame(obx, prop->object_type, prop->name);
+                else if (prop)
+                {
+                    obx->pending = prop;
+                    obx->pending_depth = obx->depth;
                 }
             }
             break;
 
-            case RQ_XML_PARSER_PARSE_EVENT_TYPE_GOT_ELEMENT_VALUE:
+        case RQ_XML_PARSER_PARSE_EVENT_TYPE_GOT_ATTRIBUTE_VALUE:
+            /* v1 is the element, v2 the attribute name and v3 the value */
+            if (obx->num_frames > 0 && obx->frames[obx->num_frames - 1].depth == obx->depth)
             {
-                if (obx->current_node != NULL)
-                {
-                    int process_value = (obx->next_value_type != NEXT_VALUE_TYPE_NONE);
-                    const char *property_name = name;
-                    enum rq_next_value_type next_value_type = obx->next_value_type;
-                    rq_object_schema_t object_schema = obx->current_node->object_schema;
+                struct rq_object_builder_xml_frame *frame = &obx->frames[obx->num_frames - 1];
+                struct rq_object_builder_xml_property *prop = find_property(frame->type, 1, v2);
 
-                    if (!process_value)
-                    {
-                        if (!strcmp(obx->current_node->object_name, name))
-                        {
-                            rq_object_schema_node_t node = 
-                                rq_object_schema_find_property(object_schema, ".");
-                            if (node)
-                            {
-                                process_value = 1;
-                                property_name = ".";
-
-                                if (!strcmp(rq_object_schema_node_get_type_name(node), "string"))
-                                    next_value_type = NEXT_VALUE_TYPE_STRING;
-                                else if (!strcmp(rq_object_schema_node_get_type_name(node), "integer"))
-                                    next_value_type = NEXT_VALUE_TYPE_INTEGER;
-                                else if (!strcmp(rq_object_schema_node_get_type_name(node), "double"))
-                                    next_value_type = NEXT_VALUE_TYPE_DOUBLE;
-                                else if (!strcmp(rq_object_schema_node_get_type_name(node), "date"))
-                                    next_value_type = NEXT_VALUE_TYPE_DATE;
-                                else
-                                    process_value = 0;
-                            }
-                        }
-                    }
+                if (prop)
+                    set_value(obx, frame, prop, v3);
+                else
+                {
+                    /* Attributes the schema doesn't declare are
+                       handed to the string setter as "@name". */
+                    char name[128];
+                    const char *value;
 
-                    if (process_value)
+                    if (v2->len + 2 <= sizeof(name))
                     {
-                        switch (next_value_type)
-                        {
-                            case NEXT_VALUE_TYPE_STRING:
-                                rq_object_schema_set_value_string(object_schema, obx->current_node->object, ".", value);
-                                break;
-
-                            case NEXT_VALUE_TYPE_INTEGER:
-                            {
-                                long l = atol(value);
-                                rq_object_schema_set_value_integer(object_schema, obx->current_node->object, ".", l);
-                            }
-                            break;
-
-                            case NEXT_VALUE_TYPE_DOUBLE:
-                            {
-                                double d = atof(value);
-                                rq_object_schema_set_value_double(object_schema, obx->current_node->object, ".", d);
-                            }
-                            break;
-
-                            case NEXT_VALUE_TYPE_DATE:
-                            {
-                                rq_date d = rq_date_parse(value, RQ_DATE_FORMAT_YMD);
-                                rq_object_schema_set_value_date(object_schema, obx->current_node->object, ".", d);
-                            }
-                            break;
-                        }
+                        name[0] = '@';
+                        memcpy(name + 1, v2->str, v2->len);
+                        name[v2->len + 1] = '\0';
+                        value = view_to_string(obx, v3);
+                        rq_object_schema_set_value_string(frame->type->schema, frame->object, name, value);
                     }
                 }
             }
             break;
+
+        case RQ_XML_PARSER_PARSE_EVENT_TYPE_GOT_ELEMENT_VALUE:
+            if (obx->pending && obx->pending_depth == obx->depth)
+                set_value(obx, &obx->frames[obx->num_frames - 1], obx->pending, v2);
+            else if (obx->num_frames > 0 && 
+                     obx->frames[obx->num_frames - 1].depth == obx->depth &&
+                     obx->frames[obx->num_frames - 1].type->content &&
+                     !is_blank(v2))
+            {
+                struct rq_object_builder_xml_frame *frame = &obx->frames[obx->num_frames - 1];
+                set_value(obx, frame, frame->type->content, v2);
+            }
+            break;
+
+        case RQ_XML_PARSER_PARSE_EVENT_TYPE_LEAVING_ELEMENT:
+            if (obx->pending && obx->pending_depth == obx->depth)
+                obx->pending = NULL;
+            if (obx->num_frames > 0 && obx->frames[obx->num_frames - 1].depth == obx->depth)
+                pop_frame(obx);
+            if (obx->num_frames == 0 && obx->path_matched == obx->depth)
+                obx->path_matched--;
+            obx->depth--;
+            break;
+    }
+}
+
+/* Set up a build: split the path into its components and compile
+   the schemas. Returns 0 if the type has no schema. */
+static int
+begin_build(struct rq_object_builder_xml *obx, rq_object_schema_mgr_t schema_mgr, const char *object_path, const char *object_type_name)
+{
+    rq_object_schema_t schema = rq_object_schema_mgr_find(schema_mgr, object_type_name);
+    const char *p = object_path;
+
+    memset(obx, 0, sizeof(struct rq_object_builder_xml));
+    obx->object_schema_mgr = schema_mgr;
+
+    if (!schema)
+        return 0;
+
+    obx->path = (struct rq_xml_parser_view *)
+        RQ_CALLOC(strlen(object_path) / 2 + 1, sizeof(struct rq_xml_parser_view));
+    while (*p)
+    {
+        const char *slash = strchr(p, '/');
+        unsigned len = (unsigned)(slash ? slash - p : strlen(p));
+
+        if (len > 0)
+        {
+            obx->path[obx->path_len].str = p;
+            obx->path[obx->path_len].len = len;
+            obx->path_len++;
         }
+        p += len;
+        if (*p == '/')
+            p++;
     }
+
+    compile_type(obx, schema);
+
+    return obx->path_len > 0;
 }
 
+static void
+end_build(struct rq_object_builder_xml *obx)
+{
+    /* anything left half built by a document that ended early */
+    while (obx->num_frames > 0)
+    {
+        struct rq_object_builder_xml_frame *frame = &obx->frames[--obx->num_frames];
+        rq_object_schema_destroy_object(frame->type->schema, frame->object);
+    }
 
-static void *
-rq_object_builder_xml_build(void *p, rq_stream_t stream, rq_object_schema_mgr_t schema_mgr, const char *object_path, const char *object_type_name)
+    if (obx->frames)
+        RQ_FREE(obx->frames);
+    if (obx->path)
+        RQ_FREE(obx->path);
+    if (obx->valuebuf)
+        RQ_FREE(obx->valuebuf);
+    free_types(obx);
+}
+
+static rq_error_code
+parse(struct rq_object_builder_xml *obx, rq_stream_t stream)
 {
-    struct rq_object_builder_xml obx;
     rq_xml_parser_t parser = rq_xml_parser_alloc();
+    rq_error_code err;
 
-    obx.object_schema_mgr = schema_mgr;
-    obx.object_path = object_path;
-    obx.object_type_name = object_type_name;
-    obx.current_path_ptr = object_path;
-    if (*obx.current_path_ptr == '/')
-        obx.current_path_ptr++;
+    rq_xml_parser_set_callback_data(parser, obx);
+    rq_xml_parser_set_view_callback(parser, rq_object_builder_xml_callback);
+    err = rq_xml_parser_parse(parser, stream);
+    rq_xml_parser_free(parser);
 
-    obx.namebuf = (char *)RQ_MALLOC(256);
-    obx.namebuflen = 256;
-    obx.next_value_type = NEXT_VALUE_TYPE_NONE;
+    return err;
+}
 
-    obx.started_construction = 0;
-    obx.object_list = rq_double_linked_list_alloc(rq_object_builder_xml_el_node_free);
-    obx.finished = 0;
-    obx.built_object = NULL;
+static void
+rq_object_builder_xml_free(void *p)
+{
+}
 
-    obx.current_node = NULL;
+static void *
+rq_object_builder_xml_build(void *p, rq_stream_t stream, rq_object_schema_mgr_t schema_mgr, const char *object_path, const char *object_type_name)
+{
+    struct rq_object_builder_xml obx;
 
-    rq_xml_parser_set_callback_data(
-        parser, 
-        &obx
-        );
+    if (begin_build(&obx, schema_mgr, object_path, object_type_name))
+        parse(&obx, stream);
+    end_build(&obx);
 
-    rq_xml_parser_set_callback(
-        parser,
-        rq_object_builder_xml_callback
-        );
+    return obx.built_object;
+}
 
-    rq_xml_parser_parse(parser, stream);
+static rq_error_code
+rq_object_builder_xml_build_all(void *p, rq_stream_t stream, rq_object_schema_mgr_t schema_mgr, const char *object_path, const char *object_type_name, void (*object_func)(void *, void *), void *object_func_data, unsigned long *num_built)
+{
+    struct rq_object_builder_xml obx;
+    rq_error_code err = RQ_OK;
 
-    rq_double_linked_list_free(obx.object_list);
-    rq_xml_parser_free(parser);
+    if (begin_build(&obx, schema_mgr, object_path, object_type_name))
+    {
+        obx.object_func = object_func;
+        obx.object_func_data = object_func_data;
+        err = parse(&obx, stream);
+    }
+    end_build(&obx);
 
-   RQ_FREE(obx.namebuf);
+    if (num_built)
+        *num_built = obx.num_built;
 
-    return obx.built_object;
+    return err;
 }
 
 RQ_EXPORT rq_object_builder_t 
@@ -371,7 +626,7 @@ rq_object_builder_xml_alloc()
         rq_object_builder_xml_type_name,
         NULL,
         rq_object_builder_xml_free,
-        rq_object_builder_xml_build
+        rq_object_builder_xml_build,
+        rq_object_builder_xml_build_all
         );
 }
-
@@ -29,6 +29,7 @@
 
 /* -- the objects to initialize in the object schema -- */
 #include "rq_calendar.h"
+#include "rq_trade.h"
 
 RQ_EXPORT int 
 rq_object_schema_mgr_is_null(rq_object_schema_mgr_t obj)
@@ -79,4 +80,5 @@ RQ_EXPORT void
 rq_object_schema_mgr_init_object_schemas(rq_object_schema_mgr_t schema_mgr)
 {
     rq_calendar_init_object_schemas(schema_mgr);
+    rq_trade_init_object_schemas(schema_mgr);
 }
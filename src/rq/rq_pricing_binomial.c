@@ -22,7 +22,10 @@
 ** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 */
 #include "rq_pricing_normdist.h"
+#include "rq_pricing_blackscholes.h"
+#include "rq_pricing_binomial.h"
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 
 RQ_EXPORT double
@@ -104,3 +107,361 @@ rq_pricing_binomial(
 	return value;
 }
 
+
+/* -- lattice engine ---------------------------------------------- */
+
+/* The parameters of a single step in the lattice. The probabilities
+   have the per-step discount factor folded in.
+*/
+struct rq_binomial_step {
+    double u;
+    double d;
+    double pu;
+    double pd;
+};
+
+/* The Peizer-Pratt method 2 inversion used by the Leisen-Reimer tree. */
+static double
+peizer_pratt_inversion(double z, int n)
+{
+    double t = z / (n + 1.0 / 3.0 + 0.1 / (n + 1.0));
+    double h = 0.5 * sqrt(1.0 - exp(-t * t * (n + 1.0 / 6.0)));
+
+    return (z < 0.0 ? 0.5 - h : 0.5 + h);
+}
+
+/* Set up the step parameters for the tree. Returns the number of
+   steps actually used, which can differ from num_iters for trees
+   that need an odd number of steps.
+*/
+static int
+binomial_step_init(
+    enum rq_binomial_tree_type tree_type,
+    double S,
+    double X,
+    double r_dom,
+    double r_for,
+    double sigma,
+    double tau_e,
+    double tau_d,
+    int num_iters,
+    struct rq_binomial_step *step
+    )
+{
+    double dt_e;
+    double growth;
+    double disc;
+    double p;
+
+    if (num_iters < 1)
+        num_iters = 1;
+    if (tree_type == RQ_BINOMIAL_TREE_LEISEN_REIMER && num_iters % 2 == 0)
+        num_iters++;
+
+    dt_e = tau_e / num_iters;
+    growth = exp((r_dom - r_for) * tau_d / num_iters);
+    disc = exp(-r_dom * tau_d / num_iters);
+
+    switch (tree_type)
+    {
+        case RQ_BINOMIAL_TREE_TIAN:
+        {
+            double v = exp(sigma * sigma * dt_e);
+            double root = sqrt(v * v + 2.0 * v - 3.0);
+            step->u = 0.5 * growth * v * (v + 1.0 + root);
+            step->d = 0.5 * growth * v * (v + 1.0 - root);
+            p = (growth - step->d) / (step->u - step->d);
+        }
+        break;
+
+        case RQ_BINOMIAL_TREE_LEISEN_REIMER:
+        {
+            double sigma_tau_sqrt = sigma * sqrt(tau_e);
+            double d1 = 
+                (log(S / X) + (r_dom - r_for) * tau_d + 0.5 * sigma * sigma * tau_e) / sigma_tau_sqrt;
+            double d2 = d1 - sigma_tau_sqrt;
+            double p_star = peizer_pratt_inversion(d1, num_iters);
+
+            p = peizer_pratt_inversion(d2, num_iters);
+            step->u = growth * p_star / p;
+            step->d = (growth - p * step->u) / (1.0 - p);
+        }
+        break;
+
+        case RQ_BINOMIAL_TREE_CRR:
+        default:
+            step->u = exp(sigma * sqrt(dt_e));
+            step->d = 1.0 / step->u;
+            p = (growth - step->d) / (step->u - step->d);
+            break;
+    }
+
+    step->pu = p * disc;
+    step->pd = (1.0 - p) * disc;
+
+    return num_iters;
+}
+
+/* Fill spot[] with the spot prices of layer 'layer' of the lattice,
+   lowest first.
+*/
+static void
+binomial_spot_layer(
+    const struct rq_binomial_step *step,
+    double S,
+    int layer,
+    double *spot
+    )
+{
+    double log_u = log(step->u);
+    double log_d = log(step->d);
+    int i;
+
+    for (i = 0; i <= layer; i++)
+        spot[i] = S * exp(i * log_u + (layer - i) * log_d);
+}
+
+/* Value an option on a lattice whose top layer of spot prices (layer
+   'top') has already been built. 'spot' is modified if the option
+   is American.
+*/
+static double
+binomial_induct(
+    short call,
+    unsigned int flags,
+    const struct rq_binomial_step *step,
+    double X,
+    double r_dom,
+    double r_for,
+    double sigma,
+    double tau_e,
+    double tau_d,
+    int num_iters,
+    int top,
+    double *spot,
+    double *vals
+    )
+{
+    double m = (call ? 1.0 : -1.0);
+    double pu = step->pu;
+    double pd = step->pd;
+    double inv_d = 1.0 / step->d;
+    int i;
+    int j;
+
+    if (top < num_iters)
+    {
+        /* BBS: the last step is valued in closed form */
+        double dt_e = tau_e / num_iters;
+        double dt_d = tau_d / num_iters;
+
+        for (i = 0; i <= top; i++)
+        {
+            double v = rq_pricing_blackscholes(call, spot[i], X, r_dom, r_for, sigma, dt_e, dt_d);
+            double ex = m * (spot[i] - X);
+            if ((flags & RQ_BINOMIAL_FLAG_AMERICAN) && ex > v)
+                v = ex;
+            vals[i] = v;
+        }
+    }
+    else
+    {
+        for (i = 0; i <= top; i++)
+        {
+            double ex = m * (spot[i] - X);
+            vals[i] = (ex > 0.0 ? ex : 0.0);
+        }
+    }
+
+    if (flags & RQ_BINOMIAL_FLAG_AMERICAN)
+    {
+        for (j = top - 1; j >= 0; j--)
+        {
+            for (i = 0; i <= j; i++)
+            {
+                double cont = pd * vals[i] + pu * vals[i+1];
+                double ex = m * (spot[i] * inv_d - X);
+                spot[i] *= inv_d;
+                vals[i] = (cont > ex ? cont : ex);
+            }
+        }
+    }
+    else
+    {
+        for (j = top - 1; j >= 0; j--)
+        {
+            for (i = 0; i <= j; i++)
+                vals[i] = pd * vals[i] + pu * vals[i+1];
+        }
+    }
+
+    return vals[0];
+}
+
+RQ_EXPORT double
+rq_pricing_binomial_lattice(
+    short call,
+    unsigned int flags,
+    enum rq_binomial_tree_type tree_type,
+    double S,
+    double X,
+    double r_dom,
+    double r_for,
+    double sigma,
+    double tau_e,
+    double tau_d,
+    int num_iters,
+    double *passed_work
+    )
+{
+    struct rq_binomial_step step;
+    double *work;
+    double value;
+    int n;
+    int top;
+
+    if (tau_e <= 0.0 || sigma <= 0.0)
+        return rq_pricing_blackscholes(call, S, X, r_dom, r_for, sigma, tau_e, tau_d);
+
+    n = binomial_step_init(tree_type, S, X, r_dom, r_for, sigma, tau_e, tau_d, num_iters, &step);
+    top = ((flags & RQ_BINOMIAL_FLAG_SMOOTH) ? n - 1 : n);
+
+    work = (passed_work ? passed_work : (double *)RQ_MALLOC(sizeof(double) * RQ_PRICING_BINOMIAL_WORK_SIZE(n)));
+
+    binomial_spot_layer(&step, S, top, work);
+    value = binomial_induct(
+        call, flags, &step, X, r_dom, r_for, sigma, tau_e, tau_d, 
+        n, top, work, work + (n + 3)
+        );
+
+    if (!passed_work)
+        RQ_FREE(work);
+
+    return value;
+}
+
+RQ_EXPORT double
+rq_pricing_binomial_extrapolated(
+    short call,
+    unsigned int flags,
+    enum rq_binomial_tree_type tree_type,
+    double S,
+    double X,
+    double r_dom,
+    double r_for,
+    double sigma,
+    double tau_e,
+    double tau_d,
+    int num_iters,
+    double *passed_work
+    )
+{
+    double *work;
+    double order;
+    double v_fine;
+    double v_coarse;
+    double w_fine;
+    double w_coarse;
+    int n_fine = (num_iters < 4 ? 4 : num_iters);
+    int n_coarse;
+
+    if (tree_type == RQ_BINOMIAL_TREE_LEISEN_REIMER)
+    {
+        n_fine |= 1;
+        n_coarse = (n_fine / 2) | 1;
+        order = 2.0;
+    }
+    else
+    {
+        n_coarse = n_fine / 2;
+        flags |= RQ_BINOMIAL_FLAG_SMOOTH;
+        order = 1.0;
+    }
+
+    work = (passed_work ? passed_work : (double *)RQ_MALLOC(sizeof(double) * RQ_PRICING_BINOMIAL_WORK_SIZE(n_fine)));
+
+    v_fine = rq_pricing_binomial_lattice(
+        call, flags, tree_type, S, X, r_dom, r_for, sigma, tau_e, tau_d, n_fine, work
+        );
+    v_coarse = rq_pricing_binomial_lattice(
+        call, flags, tree_type, S, X, r_dom, r_for, sigma, tau_e, tau_d, n_coarse, work
+        );
+
+    if (!passed_work)
+        RQ_FREE(work);
+
+    /* the error is proportional to 1/n^order */
+    w_fine = pow((double)n_fine, order);
+    w_coarse = pow((double)n_coarse, order);
+
+    return (w_fine * v_fine - w_coarse * v_coarse) / (w_fine - w_coarse);
+}
+
+RQ_EXPORT void
+rq_pricing_binomial_strikes(
+    short call,
+    unsigned int flags,
+    enum rq_binomial_tree_type tree_type,
+    double S,
+    const double *X,
+    unsigned int num_strikes,
+    double r_dom,
+    double r_for,
+    double sigma,
+    double tau_e,
+    double tau_d,
+    int num_iters,
+    double *values,
+    double *passed_work
+    )
+{
+    struct rq_binomial_step step;
+    double *work;
+    double *layer;
+    double *spot;
+    double *vals;
+    unsigned int k;
+    int n;
+    int top;
+
+    if (tree_type == RQ_BINOMIAL_TREE_LEISEN_REIMER || tau_e <= 0.0 || sigma <= 0.0)
+    {
+        for (k = 0; k < num_strikes; k++)
+            values[k] = rq_pricing_binomial_lattice(
+                call, flags, tree_type, S, X[k], r_dom, r_for, 
+                sigma, tau_e, tau_d, num_iters, passed_work
+                );
+        return;
+    }
+
+    /* the CRR and Tian trees don't depend on the strike */
+    n = binomial_step_init(tree_type, S, 0.0, r_dom, r_for, sigma, tau_e, tau_d, num_iters, &step);
+    top = ((flags & RQ_BINOMIAL_FLAG_SMOOTH) ? n - 1 : n);
+
+    work = (passed_work ? passed_work : (double *)RQ_MALLOC(sizeof(double) * RQ_PRICING_BINOMIAL_WORK_SIZE(n)));
+    layer = work;
+    spot = work + (n + 3);
+    vals = spot + (n + 3);
+
+    binomial_spot_layer(&step, S, top, layer);
+
+    for (k = 0; k < num_strikes; k++)
+    {
+        double *s = layer;
+
+        /* only the American induction walks (and so overwrites) the spot layer */
+        if (flags & RQ_BINOMIAL_FLAG_AMERICAN)
+        {
+            memcpy(spot, layer, sizeof(double) * (top + 1));
+            s = spot;
+        }
+
+        values[k] = binomial_induct(
+            call, flags, &step, X[k], r_dom, r_for, sigma, tau_e, tau_d,
+            n, top, s, vals
+            );
+    }
+
+    if (!passed_work)
+        RQ_FREE(work);
+}
@@ -40,6 +40,27 @@ extern "C" {
 #endif
 #endif
 
+/** The type of lattice to build in rq_pricing_binomial_lattice().
+ */
+enum rq_binomial_tree_type {
+    RQ_BINOMIAL_TREE_CRR, /**< Cox-Ross-Rubinstein, u = 1/d */
+    RQ_BINOMIAL_TREE_TIAN, /**< Tian, matching the first three moments */
+    RQ_BINOMIAL_TREE_LEISEN_REIMER /**< Leisen-Reimer, centred on the strike. Always uses an odd number of steps. */
+};
+
+/** Price an American rather than a European option. */
+#define RQ_BINOMIAL_FLAG_AMERICAN 0x01
+/** Replace the last step of the lattice with the Black-Scholes
+ * value (the BBS method). This removes the odd-even oscillation
+ * of the CRR and Tian trees.
+ */
+#define RQ_BINOMIAL_FLAG_SMOOTH 0x02
+
+/** The number of doubles a work array passed to the lattice
+ * functions must hold for a tree of n steps.
+ */
+#define RQ_PRICING_BINOMIAL_WORK_SIZE(n) (3 * ((n) + 8))
+
 RQ_EXPORT double
 rq_pricing_binomial(
     short call, /**< non-zero value for a call option on foreign asset */
@@ -54,6 +75,79 @@ rq_pricing_binomial(
     double *vals /**< An array of doubles for performing calculations. Must be at least num_iters+1 in size. */
     );
 
+/** Price an option on a recombining binomial lattice.
+ *
+ * Only a single layer of the lattice is held in memory at any time,
+ * and the backward induction runs over contiguous arrays without
+ * branches so that the compiler can vectorize it.
+ */
+RQ_EXPORT double
+rq_pricing_binomial_lattice(
+    short call, /**< non-zero value for a call option on foreign asset */
+    unsigned int flags, /**< A combination of the RQ_BINOMIAL_FLAG_ values */
+    enum rq_binomial_tree_type tree_type, /**< The type of tree to build */
+    double S, /**< The spot rate, passed in domestic over foreign terms */
+    double X, /**< The strike rate, passed in domestic over foreign terms */
+    double r_dom, /**< The continuously compounded domestic interest rate, aka the numerator rate */
+    double r_for, /**< The continuously compounded foreign interest rate, aka the denominator rate */
+    double sigma, /**< The annualized volatility */
+    double tau_e, /**< Time from today to expiry in years */
+    double tau_d, /**< Time from spot to delivery in years */
+    int num_iters, /**< Number of steps in the tree */
+    double *work /**< NULL, or an array of at least RQ_PRICING_BINOMIAL_WORK_SIZE(num_iters) doubles */
+    );
+
+/** Price an option using Richardson extrapolation between lattices
+ * of num_iters and num_iters/2 steps.
+ *
+ * For the Leisen-Reimer tree the error is second order in the step
+ * size. The CRR and Tian trees are always smoothed, which gives the
+ * BBSR method with a first order error term.  Either way a few
+ * hundred steps gives the accuracy that the plain tree needs
+ * thousands for.
+ */
+RQ_EXPORT double
+rq_pricing_binomial_extrapolated(
+    short call, /**< non-zero value for a call option on foreign asset */
+    unsigned int flags, /**< A combination of the RQ_BINOMIAL_FLAG_ values */
+    enum rq_binomial_tree_type tree_type, /**< The type of tree to build */
+    double S, /**< The spot rate, passed in domestic over foreign terms */
+    double X, /**< The strike rate, passed in domestic over foreign terms */
+    double r_dom, /**< The continuously compounded domestic interest rate, aka the numerator rate */
+    double r_for, /**< The continuously compounded foreign interest rate, aka the denominator rate */
+    double sigma, /**< The annualized volatility */
+    double tau_e, /**< Time from today to expiry in years */
+    double tau_d, /**< Time from spot to delivery in years */
+    int num_iters, /**< Number of steps in the finer of the two trees */
+    double *work /**< NULL, or an array of at least RQ_PRICING_BINOMIAL_WORK_SIZE(num_iters) doubles */
+    );
+
+/** Price a batch of options that differ only by strike.
+ *
+ * For the CRR and Tian trees the lattice of spot prices doesn't
+ * depend on the strike, so it is built once and shared between all
+ * the strikes. The Leisen-Reimer tree is centred on the strike, so
+ * each strike gets its own lattice (but the work array is still
+ * shared).
+ */
+RQ_EXPORT void
+rq_pricing_binomial_strikes(
+    short call, /**< non-zero value for a call option on foreign asset */
+    unsigned int flags, /**< A combination of the RQ_BINOMIAL_FLAG_ values */
+    enum rq_binomial_tree_type tree_type, /**< The type of tree to build */
+    double S, /**< The spot rate, passed in domestic over foreign terms */
+    const double *X, /**< The array of strikes */
+    unsigned int num_strikes, /**< The number of strikes in X */
+    double r_dom, /**< The continuously compounded domestic interest rate, aka the numerator rate */
+    double r_for, /**< The continuously compounded foreign interest rate, aka the denominator rate */
+    double sigma, /**< The annualized volatility */
+    double tau_e, /**< Time from today to expiry in years */
+    double tau_d, /**< Time from spot to delivery in years */
+    int num_iters, /**< Number of steps in the tree */
+    double *values, /**< Returns the option value for each strike */
+    double *work /**< NULL, or an array of at least RQ_PRICING_BINOMIAL_WORK_SIZE(num_iters) doubles */
+    );
+
 #ifdef __cplusplus
 #if 0
 { // purely to not screw up my indenting...
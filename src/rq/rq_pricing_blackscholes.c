@@ -29,6 +29,11 @@
 #include "rq_pricing_normdist.h"
 #include "rq_pricing_blackscholes.h"
 
+/* MSVC's stdlib.h defines max, but nobody else does */
+#ifndef max
+#define max(a, b) ((a) > (b) ? (a) : (b))
+#endif
+
 RQ_EXPORT double 
 rq_pricing_blackscholes(
     int call,
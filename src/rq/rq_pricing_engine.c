@@ -23,6 +23,7 @@
 */
 /* -- includes ---------------------------------------------------- */
 #include "rq_pricing_engine.h"
+#include "rq_instrument.h"
 #include <stdlib.h>
 #include <string.h>
 
@@ -149,7 +150,12 @@ rq_pricing_engine_get_pricing_results(rq_pricing_engine_t e, const char *product
     {
         int cmp = strcmp(n->product_id, product_id);
         if (!cmp)
-            return (*n->pricing_adapter->get_pricing_results)(pricing_request, pricing_result);
+        {
+            double begin = rq_instrument_timer_begin();
+            int ret = (*n->pricing_adapter->get_pricing_results)(pricing_request, pricing_result);
+            rq_instrument_timer_end(RQ_INSTRUMENT_TIMER_PRICING, begin);
+            return ret;
+        }
         else if (cmp > 0)
             n = n->right;
         else if (cmp < 0)
@@ -24,6 +24,7 @@
 #include "rq_pricing_monte_carlo.h"
 #include "rq_pricing_normdist.h"
 #include "rq_random.h"
+#include "rq_instrument.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
@@ -59,6 +60,7 @@ rq_pricing_monte_carlo(
     double value = 0.0;
     int i;
     struct rq_pricing_monte_carlo_timestep timestep;
+    double begin = rq_instrument_timer_begin();
 
     timestep.num_timesteps = num_timesteps;
     timestep.num_paths = num_paths;
@@ -111,5 +113,7 @@ rq_pricing_monte_carlo(
     if (user_defined_free)
         (*user_defined_free)(user_defined);
 
+    rq_instrument_timer_end(RQ_INSTRUMENT_TIMER_MONTE_CARLO, begin);
+
     return value;
 }
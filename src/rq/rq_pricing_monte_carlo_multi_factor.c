@@ -23,6 +23,8 @@
 ** USA
 */
 #include "rq_pricing_monte_carlo_multi_factor.h"
+#include "rq_linalg.h"
+#include "rq_instrument.h"
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
@@ -56,11 +58,6 @@ rq_pricing_monte_carlo_multi_factor(
     struct rq_simulation_results *sim_results
     )
 {
-    double dt = tau_d / (double)num_timesteps;
-    double sqrt_dt = sqrt(dt);
-    unsigned long path;
-    unsigned long num_factors = rq_matrix_get_rows(correl_matrix);
-    double value = 0.0;
     short failed = 0;
 
     /* build a matrix to hold the cholesky results */
@@ -69,13 +66,50 @@ rq_pricing_monte_carlo_multi_factor(
         rq_matrix_get_columns(correl_matrix)
         );
 
-    if ((failed = rq_matrix_cholesky(correl_matrix, cholesky_matrix)) != 0)
+    if ((failed = rq_matrix_cholesky(correl_matrix, cholesky_matrix)) == 0)
     {
-        rq_matrix_free(cholesky_matrix);
-        return failed;
+        /* rq_matrix_print(cholesky_matrix); */
+
+        failed = rq_pricing_monte_carlo_multi_factor_cholesky(
+            values, tau_d, cholesky_matrix, num_paths, num_timesteps,
+            timestep_vals, random_factors, terminal_distribution,
+            random_func, user_defined, user_defined_init, 
+            user_defined_path_init, calc_timestep, calc_payoff,
+            user_defined_free, sim_results
+            );
     }
 
-    /* rq_matrix_print(cholesky_matrix); */
+    rq_matrix_free(cholesky_matrix);
+
+    return failed;
+}
+
+RQ_EXPORT short
+rq_pricing_monte_carlo_multi_factor_cholesky(
+    double *values,
+    double tau_d,
+    const rq_matrix_t cholesky_matrix,
+    unsigned long num_paths,
+    unsigned long num_timesteps,
+    double *timestep_vals,
+    double *random_factors,
+    double *terminal_distribution,
+    double (*random_func)(),
+    void *user_defined,
+    void (*user_defined_init)(void *user_defined),
+    void (*user_defined_path_init)(void *user_defined, unsigned long path, double *values),
+    double (*calc_timestep)(void *user_defined, unsigned long step, double *values, double *factors, double *timestep_vals),
+    double (*calc_payoff)(void *user_defined, unsigned long path, double *values, double *timestep_vals, unsigned long num_timesteps),
+    void (*user_defined_free)(void *user_defined),
+    struct rq_simulation_results *sim_results
+    )
+{
+    double dt = tau_d / (double)num_timesteps;
+    double sqrt_dt = sqrt(dt);
+    unsigned long path;
+    unsigned long num_factors = rq_matrix_get_rows(cholesky_matrix);
+    double value = 0.0;
+    double begin = rq_instrument_timer_begin();
 
     if (user_defined_init)
         (*user_defined_init)(user_defined);
@@ -91,22 +125,17 @@ rq_pricing_monte_carlo_multi_factor(
 		for (step = 0; step < num_timesteps; step++)
 		{
             unsigned long i;
-            unsigned long r;
-            unsigned long c;
 
             for (i = 0; i < num_factors; i++)
                 random_factors[i] = (*random_func)() * sqrt_dt;
 
-            /* multiply by matrix */
-            for (r = 0; r < num_factors; r++)
-            {
-                double sum = 0.0;
-
-                for (c = 0; c < num_factors; c++)
-                    sum += rq_matrix_get(cholesky_matrix, r, c) * random_factors[c];
-
-                random_factors[r] = sum;
-            }
+            /* multiply by the (lower triangular) cholesky matrix */
+            rq_linalg_trmv_lower(
+                num_factors, 
+                cholesky_matrix->vals, 
+                rq_matrix_get_columns(cholesky_matrix), 
+                random_factors
+                );
 /*
             for (i = 1; i < num_factors; i++)
             {
@@ -133,5 +162,7 @@ rq_pricing_monte_carlo_multi_factor(
 
     sim_results->mean = value;
 
+    rq_instrument_timer_end(RQ_INSTRUMENT_TIMER_MONTE_CARLO, begin);
+
     return 0;
 }
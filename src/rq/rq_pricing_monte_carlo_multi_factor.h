@@ -64,6 +64,32 @@ rq_pricing_monte_carlo_multi_factor(
     );
 
 
+/** The same as rq_pricing_monte_carlo_multi_factor(), but takes an
+ * already factorized correlation matrix, such as the one cached by
+ * rq_asset_correlation_mgr_get_matrix(). This saves decomposing the
+ * matrix on every pricing call.
+ */
+RQ_EXPORT short
+rq_pricing_monte_carlo_multi_factor_cholesky(
+    double *values, /**< N values, should be filled with the starting values */
+    double tau_d, /**< time to expiry/delivery in years. */
+    const rq_matrix_t cholesky_matrix, /**< The lower triangular cholesky factor (NxN) of the correlation matrix */
+    unsigned long num_paths, /**< The number of paths */
+    unsigned long num_timesteps, /**< The number of timesteps */
+    double *timestep_vals, /**< An array that is filled out with the values returned by the calc_timestep function, on this path */
+    double *random_factors, /**< An array of N random factors. */
+    double *terminal_distribution, /**< An array that is filled with the terminal distribution. */
+    double (*random_func)(), /**< A function for providing random numbers. */
+    void *user_defined, /**< A pointer to user defined data, that is passed to the callback functions */
+    void (*user_defined_init)(void *user_defined), /** < A call-back function for initializing the pricing. May be NULL. */
+    void (*user_defined_path_init)(void *user_defined, unsigned long path, double *values), /**< A callback function that is called before each path. May be NULL. */
+    double (*calc_timestep)(void *user_defined, unsigned long step, double *values, double *factors, double *timestep_vals), /**< A callback function that is called on each timestep. Returns the current value for the timestep. */
+    double (*calc_payoff)(void *user_defined, unsigned long path, double *values, double *timestep_vals, unsigned long num_timesteps), /** A callback function to calculate the payoff. Called at the end of the path */
+    void (*user_defined_free)(void *user_defined) /**< A callback function to free any user-defined data at the end of the pricing function. May be NULL. */,
+    struct rq_simulation_results *sim_results /* Used to return the results */
+    );
+
+
 /** A function to calculate exactly the same dt as the model uses.
  */
 RQ_EXPORT double
@@ -34,11 +34,11 @@
 RQ_EXPORT double 
 rq_pricing_norm_dist(double z)
 {
-    return 0.39894228040143 * exp(-(z*z) / 2.0);
+    return 0.398942280401432677939946059934 * exp(-(z*z) / 2.0);
 }
 
 RQ_EXPORT double 
-rq_pricing_cumul_norm_dist(double z) 
+rq_pricing_cumul_norm_dist_hart(double z) 
 {
 	double y = fabs(z);
 	double cnd, e, sumA, sumB;
@@ -80,6 +80,333 @@ rq_pricing_cumul_norm_dist(double z)
 	return (z > 0.0 ? 1.0 - cnd : cnd);
 }
 
+/* -- Cody's normal CDF ------------------------------------------ */
+
+/* Rational Chebyshev approximations from W. J. Cody, "Rational
+   Chebyshev approximations for the error function" (1969), as
+   arranged in ACM TOMS algorithm 715. Relative accuracy is close to
+   machine precision over the whole real line.
+*/
+static const double cody_a[5] = {
+    2.2352520354606839287,
+    161.02823106855587881,
+    1067.6894854603709582,
+    18154.981253343561249,
+    0.065682337918207449113
+};
+static const double cody_b[4] = {
+    47.20258190468824187,
+    976.09855173777669322,
+    10260.932208618978205,
+    45507.789335026729956
+};
+static const double cody_c[9] = {
+    0.39894151208813466764,
+    8.8831497943883759412,
+    93.506656132177855979,
+    597.27027639480026226,
+    2494.5375852903726711,
+    6848.1904505362823326,
+    11602.651437647350124,
+    9842.7148383839780218,
+    1.0765576773720192317e-8
+};
+static const double cody_d[8] = {
+    22.266688044328115691,
+    235.38790178262499861,
+    1519.377599407554805,
+    6485.558298266760755,
+    18615.571640885098091,
+    34900.952721145977266,
+    38912.003286093271411,
+    19685.429676859990727
+};
+static const double cody_p[6] = {
+    0.21589853405795699,
+    0.1274011611602473639,
+    0.022235277870649807,
+    0.001421619193227893466,
+    2.9112874951168792e-5,
+    0.02307344176494017303
+};
+static const double cody_q[5] = {
+    1.28426009614491121,
+    0.468238212480865118,
+    0.0659881378689285515,
+    0.00378239633202758244,
+    7.29751555083966205e-5
+};
+
+#define RQ_ONE_OVER_SQRT_2PI 0.398942280401432677939946059934
+
+/* exp(-y*y/2), split so that y*y is exact for the large part of y,
+   which keeps full relative accuracy in the far tails. */
+static double
+half_gaussian_exp(double y)
+{
+    double ysq = floor(y * 16.0) / 16.0;
+    double del = (y - ysq) * (y + ysq);
+    return exp(-ysq * ysq * 0.5) * exp(-del * 0.5);
+}
+
+RQ_EXPORT double 
+rq_pricing_cumul_norm_dist(double z) 
+{
+    double y = fabs(z);
+    double tail;
+
+    if (y <= 0.67448975)
+    {
+        double zsq = z * z;
+        double num = cody_a[4] * zsq;
+        double den = zsq;
+
+        num = (num + cody_a[0]) * zsq;
+        den = (den + cody_b[0]) * zsq;
+        num = (num + cody_a[1]) * zsq;
+        den = (den + cody_b[1]) * zsq;
+        num = (num + cody_a[2]) * zsq;
+        den = (den + cody_b[2]) * zsq;
+
+        return 0.5 + z * (num + cody_a[3]) / (den + cody_b[3]);
+    }
+    else if (y <= 5.656854249492380195206754896838) /* sqrt(32) */
+    {
+        double num = cody_c[8] * y;
+        double den = y;
+        int i;
+
+        for (i = 0; i < 7; i++)
+        {
+            num = (num + cody_c[i]) * y;
+            den = (den + cody_d[i]) * y;
+        }
+
+        /* y * y rounds to within 32 ulps here, so a single exp is
+           accurate enough */
+        tail = exp(-y * y * 0.5) * (num + cody_c[7]) / (den + cody_d[7]);
+    }
+    else if (y < 38.5)
+    {
+        double ysq = 1.0 / (z * z);
+        double num = cody_p[5] * ysq;
+        double den = ysq;
+        int i;
+
+        for (i = 0; i < 4; i++)
+        {
+            num = (num + cody_p[i]) * ysq;
+            den = (den + cody_q[i]) * ysq;
+        }
+
+        tail = half_gaussian_exp(y) * 
+            (RQ_ONE_OVER_SQRT_2PI - ysq * (num + cody_p[4]) / (den + cody_q[4])) / y;
+    }
+    else
+        tail = 0.0;
+
+    return (z > 0.0 ? 1.0 - tail : tail);
+}
+
+RQ_EXPORT void
+rq_pricing_cumul_norm_dist_array(const double *z, double *out, unsigned long n)
+{
+    unsigned long i;
+
+    for (i = 0; i < n; i++)
+        out[i] = rq_pricing_cumul_norm_dist(z[i]);
+}
+
+RQ_EXPORT void
+rq_pricing_norm_density_array(const double *x, double *out, unsigned long n)
+{
+    unsigned long i;
+
+    /* no calls except exp, so this vectorizes with a vector math
+       library */
+    for (i = 0; i < n; i++)
+        out[i] = RQ_ONE_OVER_SQRT_2PI * exp(-0.5 * x[i] * x[i]);
+}
+
+/* -- Genz's bivariate normal CDF --------------------------------- */
+
+/* Gauss-Legendre abscissae (negative half) and weights for 6, 12 and
+   20 points, from A. Genz, "Numerical computation of rectangular
+   bivariate and trivariate normal and t probabilities" (2004). */
+static const double genz_w6[3] = {
+    0.1713244923791705, 0.3607615730481384, 0.4679139345726904
+};
+static const double genz_x6[3] = {
+    -0.9324695142031522, -0.6612093864662647, -0.2386191860831970
+};
+static const double genz_w12[6] = {
+    0.04717533638651177, 0.1069393259953183, 0.1600783285433464,
+    0.2031674267230659, 0.2334925365383547, 0.2491470458134029
+};
+static const double genz_x12[6] = {
+    -0.9815606342467191, -0.9041172563704750, -0.7699026741943050,
+    -0.5873179542866171, -0.3678314989981802, -0.1252334085114692
+};
+static const double genz_w20[10] = {
+    0.01761400713915212, 0.04060142980038694, 0.06267204833410906,
+    0.08327674157670475, 0.1019301198172404, 0.1181945319615184,
+    0.1316886384491766, 0.1420961093183821, 0.1491729864726037,
+    0.1527533871307259
+};
+static const double genz_x20[10] = {
+    -0.9931285991850949, -0.9639719272779138, -0.9122344282513259,
+    -0.8391169718222188, -0.7463319064601508, -0.6360536807265150,
+    -0.5108670019508271, -0.3737060887154196, -0.2277858511416451,
+    -0.07652652113349733
+};
+
+#define RQ_TWO_PI 6.283185307179586476925286766559
+
+/* The upper bivariate normal probability P(X > h, Y > k). */
+static double
+genz_bvnu(double h, double k, double r)
+{
+    const double *w;
+    const double *x;
+    int lg;
+    int i;
+    double hk = h * k;
+    double bvn = 0.0;
+
+    if (fabs(r) < 0.3)
+    {
+        w = genz_w6;
+        x = genz_x6;
+        lg = 3;
+    }
+    else if (fabs(r) < 0.75)
+    {
+        w = genz_w12;
+        x = genz_x12;
+        lg = 6;
+    }
+    else
+    {
+        w = genz_w20;
+        x = genz_x20;
+        lg = 10;
+    }
+
+    if (fabs(r) < 0.925)
+    {
+        double hs = (h * h + k * k) / 2.0;
+        double asr = asin(r);
+
+        for (i = 0; i < lg; i++)
+        {
+            double sn = sin(asr * (x[i] + 1.0) / 2.0);
+            bvn += w[i] * exp((sn * hk - hs) / (1.0 - sn * sn));
+            sn = sin(asr * (1.0 - x[i]) / 2.0);
+            bvn += w[i] * exp((sn * hk - hs) / (1.0 - sn * sn));
+        }
+
+        return bvn * asr / (2.0 * RQ_TWO_PI) + 
+            rq_pricing_cumul_norm_dist(-h) * rq_pricing_cumul_norm_dist(-k);
+    }
+
+    if (r < 0.0)
+    {
+        k = -k;
+        hk = -hk;
+    }
+
+    if (fabs(r) < 1.0)
+    {
+        double as = (1.0 - r) * (1.0 + r);
+        double a = sqrt(as);
+        double bs = (h - k) * (h - k);
+        double c = (4.0 - hk) / 8.0;
+        double d = (12.0 - hk) / 16.0;
+        double asr = -(bs / as + hk) / 2.0;
+
+        if (asr > -100.0)
+            bvn = a * exp(asr) * 
+                (1.0 - c * (bs - as) * (1.0 - d * bs / 5.0) / 3.0 + c * d * as * as / 5.0);
+
+        if (hk > -100.0)
+        {
+            double b = sqrt(bs);
+            bvn -= exp(-hk / 2.0) * sqrt(RQ_TWO_PI) * rq_pricing_cumul_norm_dist(-b / a) * 
+                b * (1.0 - c * bs * (1.0 - d * bs / 5.0) / 3.0);
+        }
+
+        a /= 2.0;
+
+        for (i = 0; i < lg; i++)
+        {
+            int side;
+
+            for (side = -1; side <= 1; side += 2)
+            {
+                double xs = a * (side * x[i] + 1.0);
+                double rs;
+
+                xs *= xs;
+                rs = sqrt(1.0 - xs);
+                asr = -(bs / xs + hk) / 2.0;
+
+                if (asr > -100.0)
+                    bvn += a * w[i] * exp(asr) *
+                        (exp(-hk * (1.0 - rs) / (2.0 * (1.0 + rs))) / rs - 
+                         (1.0 + c * xs * (1.0 + d * xs)));
+            }
+        }
+
+        bvn = -bvn / RQ_TWO_PI;
+    }
+
+    if (r > 0.0)
+        return bvn + rq_pricing_cumul_norm_dist(-(h > k ? h : k));
+
+    bvn = -bvn;
+    if (k > h)
+    {
+        if (h < 0.0)
+            bvn += rq_pricing_cumul_norm_dist(k) - rq_pricing_cumul_norm_dist(h);
+        else
+            bvn += rq_pricing_cumul_norm_dist(-h) - rq_pricing_cumul_norm_dist(-k);
+    }
+
+    return bvn;
+}
+
+RQ_EXPORT double 
+rq_pricing_cumul_bivar_norm_dist(double a, double b, double rho) 
+{
+    double p;
+
+    if (rho >= 1.0)
+        return rq_pricing_cumul_norm_dist(a < b ? a : b);
+    if (rho <= -1.0)
+    {
+        p = rq_pricing_cumul_norm_dist(a) - rq_pricing_cumul_norm_dist(-b);
+        return (p > 0.0 ? p : 0.0);
+    }
+
+    p = genz_bvnu(-a, -b, rho);
+
+    /* keep rounding from pushing us outside [0, 1] */
+    if (p < 0.0)
+        return 0.0;
+    if (p > 1.0)
+        return 1.0;
+    return p;
+}
+
+RQ_EXPORT void
+rq_pricing_cumul_bivar_norm_dist_array(const double *a, const double *b, const double *rho, double *out, unsigned long n)
+{
+    unsigned long i;
+
+    for (i = 0; i < n; i++)
+        out[i] = rq_pricing_cumul_bivar_norm_dist(a[i], b[i], rho[i]);
+}
+
 RQ_EXPORT double 
 rq_pricing_density(double x, double y, double ad, double bd, double rho) 
 {
@@ -91,13 +418,13 @@ rq_pricing_density(double x, double y, double ad, double bd, double rho)
 RQ_EXPORT double 
 rq_pricing_norm_density(double x)
 {
-    return 0.39894228040143 * exp(-(x*x) / 2.0);
+    return RQ_ONE_OVER_SQRT_2PI * exp(-(x*x) / 2.0);
 }
 
 #define SGN(x) ((x) >= 0.0 ? 1.0 : -1.0)
 
 RQ_EXPORT double 
-rq_pricing_cumul_bivar_norm_dist(double a, double b, double rho) 
+rq_pricing_cumul_bivar_norm_dist_drezner(double a, double b, double rho) 
 {
     double x[] = {
         0.24840615, 
@@ -149,11 +476,11 @@ rq_pricing_cumul_bivar_norm_dist(double a, double b, double rho)
         r = sqrt(1 - pow(rho, 2)) / PI * sum;
     }
     else if (a <= 0 && b >= 0 && rho >= 0)
-        r = rq_pricing_cumul_norm_dist(a) - rq_pricing_cumul_bivar_norm_dist(a, -b, -rho);
+        r = rq_pricing_cumul_norm_dist_hart(a) - rq_pricing_cumul_bivar_norm_dist_drezner(a, -b, -rho);
     else if (a >= 0 && b <= 0 && rho >= 0)
-        r = rq_pricing_cumul_norm_dist(b) - rq_pricing_cumul_bivar_norm_dist(-a, b, -rho);
+        r = rq_pricing_cumul_norm_dist_hart(b) - rq_pricing_cumul_bivar_norm_dist_drezner(-a, b, -rho);
     else if (a >= 0 && b >= 0 && rho <= 0)
-        r = rq_pricing_cumul_norm_dist(a) + rq_pricing_cumul_norm_dist(b) - 1 + rq_pricing_cumul_bivar_norm_dist(-a, -b, rho);
+        r = rq_pricing_cumul_norm_dist_hart(a) + rq_pricing_cumul_norm_dist_hart(b) - 1 + rq_pricing_cumul_bivar_norm_dist_drezner(-a, -b, rho);
     else if (a * b * rho > 0)
     {
         double b_sqr = b * b;
@@ -162,7 +489,7 @@ rq_pricing_cumul_bivar_norm_dist(double a, double b, double rho)
         rho1 = (rho * a - b) * SGN(a) / sqrt(a_sqr_b_sqr);
         rho2 = (rho * b - a) * SGN(b) / sqrt(a_sqr_b_sqr);
         delta = (1 - SGN(a) * SGN(b)) / 4;
-        r = rq_pricing_cumul_bivar_norm_dist(a, 0, rho1) + rq_pricing_cumul_bivar_norm_dist(b, 0, rho2) - delta;
+        r = rq_pricing_cumul_bivar_norm_dist_drezner(a, 0, rho1) + rq_pricing_cumul_bivar_norm_dist_drezner(b, 0, rho2) - delta;
     }
 
     return r;
@@ -171,62 +498,7 @@ rq_pricing_cumul_bivar_norm_dist(double a, double b, double rho)
 RQ_EXPORT double 
 rq_pricing_cumul_bivar_norm_dist2(double a, double b, double r) 
 {
-	double ret = 0.0;
-
-	double x[] = {0.04691008, 0.23076534, 0.5, 0.76923466, 0.95308992};
-	double W[] = {0.018854042, 0.038088059, 0.0452707394, 0.038088059, 0.018854042};
-
-	double h1 = a;
-	double h2 = b;
-	double h12 = (h1 * h1 + h2 * h2) / 2.0;
-
-	int i;
-
-	if (fabs(r) >= 0.7) {
-		double r2 = 1.0 - r * r;
-		double r3 = sqrt(r2);
-		if (r < 0.0) { 
-			double h2 = -b;
-			double h3 = h1 * h2;
-			double h7 = exp(-h3 / 2.0);
-			double LH = 0.0;
-
-			if (fabs(r) < 1.0) {
-				double h6 = fabs(h1 - h2);
-				double h5 = h6 * h6 / 2.0;
-				double AA = 0.5 - h3 / 8.0;
-				double ab = 3.0 - 2.0 * AA * h5;
-				
-				h6 = h6 / r3;
-				LH = 0.13298076 * h6 * ab * (1.0 - rq_pricing_cumul_norm_dist(h6)) - exp(-h5 / r2) * (ab + AA * r2) * 0.053051647;
-				for (i = 0; i<5; i++) {
-					double r1 = r3 * x[i];
-					double rr = r1 * r1;
-					double r2 = sqrt(1 - rr);
-					double h8 = h7 == 0.0 ? 0.0 : exp(-h3 / (1 + r2)) / r2 / h7;
-					LH = LH - W[i] * exp(-h5 / rr) * (h8 - 1 - AA * rr);
-				}
-			}
-			ret = LH * r3 * h7 + rq_pricing_cumul_norm_dist((h1 < h2) ? h1 : h2);
-			if (r < 0.0) {
-				ret = rq_pricing_cumul_norm_dist(h1) - ret;
-			}
-		}
-	}
-	else {
-		double h3 = h1 * h2;
-		double LH = 0.0;
-		if (r != 0.0) {
-			for (i = 0; i<5; i++) {
-				double r1 = r * x[i];
-				double r2 = 1.0 - r1 * r1;
-				LH = LH + W[i] * exp((r1 * h3 - h12) / r2) / sqrt(r2);
-			}
-		}
-		ret = rq_pricing_cumul_norm_dist(h1) * rq_pricing_cumul_norm_dist(h2) + r * LH;
-	}
-
-	return ret;
+    return rq_pricing_cumul_bivar_norm_dist(a, b, r);
 }
 
 /** This function was taken from the book "Numerical Recipes in C" */
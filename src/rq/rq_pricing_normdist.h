@@ -44,21 +44,54 @@ extern "C" {
 
 RQ_EXPORT double rq_pricing_norm_dist(double z);
 
+/** Calculate the CDF for the Normal distribution, accurate to near
+ * machine precision, using W. J. Cody's rational Chebyshev
+ * approximations.
+ */
+RQ_EXPORT double rq_pricing_cumul_norm_dist(double z);
+
 /** Calculate the CDF for Normal distribution with double precision
    - adopted from "Option Pricing Formulas" by E.G. Haug 
+
+   This is the Hart algorithm that rq_pricing_cumul_norm_dist() used
+   to use. It is kept for comparison.
 */
-RQ_EXPORT double rq_pricing_cumul_norm_dist(double z);
+RQ_EXPORT double rq_pricing_cumul_norm_dist_hart(double z);
+
+/** Calculate the normal CDF for each of the n values in z.
+ */
+RQ_EXPORT void rq_pricing_cumul_norm_dist_array(const double *z, double *out, unsigned long n);
 
 RQ_EXPORT double rq_pricing_density(double x, double y, double ad, double bd, double rho);
 
 RQ_EXPORT double rq_pricing_norm_density(double x);
 
-/** The Drezner 1978 Algorithm */
+/** Calculate the normal density for each of the n values in x.
+ */
+RQ_EXPORT void rq_pricing_norm_density_array(const double *x, double *out, unsigned long n);
+
+/** The cumulative bivariate normal distribution, P(X < a, Y < b)
+ * with correlation r, using the Genz 2004 algorithm. Accurate to
+ * around 1e-15.
+ */
 RQ_EXPORT double rq_pricing_cumul_bivar_norm_dist(double a, double b, double r);
 
-/** The Genz 2004 Algorithm (Quasi Double Precision) */
+/** The Drezner 1978 Algorithm. This is what
+ * rq_pricing_cumul_bivar_norm_dist() used to use. It is kept for
+ * comparison.
+ */
+RQ_EXPORT double rq_pricing_cumul_bivar_norm_dist_drezner(double a, double b, double r);
+
+/** The same as rq_pricing_cumul_bivar_norm_dist(). Kept for
+ * backwards compatibility.
+ */
 RQ_EXPORT double rq_pricing_cumul_bivar_norm_dist2(double a, double b, double r);
 
+/** Calculate the cumulative bivariate normal distribution for each
+ * of the n triples (a[i], b[i], rho[i]).
+ */
+RQ_EXPORT void rq_pricing_cumul_bivar_norm_dist_array(const double *a, const double *b, const double *rho, double *out, unsigned long n);
+
 /** Return the natural log of the gamma function for xx.
  * 
  * This function was taken from "Numerical Recipes in C"
@@ -30,7 +30,7 @@
 RQ_EXPORT struct rq_pricing_result *
 rq_pricing_result_alloc()
 {
-    struct rq_pricing_result *pricing_result = (struct rq_pricing_result *)calloc(1, sizeof(struct rq_pricing_result));
+    struct rq_pricing_result *pricing_result = (struct rq_pricing_result *)RQ_CALLOC(1, sizeof(struct rq_pricing_result));
 
     return pricing_result;
 }
@@ -60,16 +60,16 @@ rq_pricing_result_exposure_alloc(struct rq_pricing_result *pricing_result, long
 {
     rq_pricing_result_free_exposure(pricing_result);
     pricing_result->exposure_profile.num_exposure_dates = numNodes;
-    pricing_result->exposure_profile.dates = (rq_date *)calloc(numNodes, sizeof(rq_date));
+    pricing_result->exposure_profile.dates = (rq_date *)RQ_CALLOC(numNodes, sizeof(rq_date));
     pricing_result->results_need_freeing = 1;
 
     if (fixed)
     {
-        pricing_result->exposure_profile.fixed_exposures = (double *)calloc(numNodes, sizeof(double));
+        pricing_result->exposure_profile.fixed_exposures = (double *)RQ_CALLOC(numNodes, sizeof(double));
     }
     else
     {
-        pricing_result->exposure_profile.exposures = (double *)calloc(numNodes, sizeof(double));
+        pricing_result->exposure_profile.exposures = (double *)RQ_CALLOC(numNodes, sizeof(double));
     }
 }
 
@@ -79,7 +79,7 @@ rq_pricing_result_free(struct rq_pricing_result *pricing_result)
     rq_pricing_result_free_data(pricing_result);
 	/* rq_named_variant_mgr_free(pricing_result->named_value_results); */
 
-    free(pricing_result);
+    RQ_FREE(pricing_result);
 }
 
 #if 0
@@ -101,16 +101,16 @@ rq_pricing_spread_numeric(
         return payoff > 0 ? payoff : 0.0;
     }
 
-    s1_payoff_grid = (double **)calloc(grid_size, sizeof(double));
-    s2_payoff_grid = (double **)calloc(grid_size, sizeof(double));
-    z = (double *)calloc(grid_size, sizeof(double));
-    probs = (double *)calloc(grid_size, sizeof(double));
+    s1_payoff_grid = (double **)RQ_CALLOC(grid_size, sizeof(double));
+    s2_payoff_grid = (double **)RQ_CALLOC(grid_size, sizeof(double));
+    z = (double *)RQ_CALLOC(grid_size, sizeof(double));
+    probs = (double *)RQ_CALLOC(grid_size, sizeof(double));
 
 
     for (i = 0; i < grid_size; i++)
     {
-        s1_payoff_grid[i] = (double *)calloc(grid_size, sizeof(double));
-        s2_payoff_grid[i] = (double *)calloc(grid_size, sizeof(double));
+        s1_payoff_grid[i] = (double *)RQ_CALLOC(grid_size, sizeof(double));
+        s2_payoff_grid[i] = (double *)RQ_CALLOC(grid_size, sizeof(double));
     }
 
     for (i = 0; i < grid_size; ++i)
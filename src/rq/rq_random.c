@@ -53,15 +53,15 @@ double
 tt800()
 {
     unsigned long y;
-    static int k = 0;
-    static unsigned long x[N]={ /* initial 25 seeds, change as you wish */
+    static RQ_THREAD_LOCAL int k = 0;
+    static RQ_THREAD_LOCAL unsigned long x[N]={ /* initial 25 seeds, change as you wish */
         0x95f24dab, 0x0b685215, 0xe76ccae7, 0xaf3ec239, 0x715fad23,
         0x24a590ad, 0x69e4b5ef, 0xbf456141, 0x96bc1b7b, 0xa7bdf825,
         0xc1de75b7, 0x8858a9c9, 0x2da87693, 0xb657f9dd, 0xffdc8a9f,
         0x8121da71, 0x8b823ecb, 0x885d05f5, 0x4e20cd47, 0x5a9ad5d9,
         0x512c0c03, 0xea857ccd, 0x4cc1d30f, 0x8891a8a1, 0xa6b7aadb
     };
-    static unsigned long mag01[2]={ 
+    static const unsigned long mag01[2]={ 
         0x0, 0x8ebfd028 /* this is magic vector `a', don't change */
     };
     if (k==N) { /* generate N words at one time */
@@ -92,14 +92,17 @@ tt800()
    The Box-Muller method of generating a normal random variable with
    mean 0 and standard deviation of 1. To adjust to some other
    distribution, multiply by the standard deviation and add the mean.
+
+   Each call makes two variates and returns the second on the next
+   call. The spare is kept per thread.
 */
 
 RQ_EXPORT double 
 rq_random_normal() 
 {
-    static double v2;
-    static double fac;
-    static int flipflop = 0;
+    static RQ_THREAD_LOCAL double v2;
+    static RQ_THREAD_LOCAL double fac;
+    static RQ_THREAD_LOCAL int flipflop = 0;
     double r;
 
     if (flipflop)
@@ -132,11 +135,6 @@ rq_random_normal()
 RQ_EXPORT double
 rq_random_poisson(double xm)
 {
-    static double sq;
-    static double alxm;
-    static double g;
-    static double oldm;
-
     double em;
 
     if (xm < 12.0)
@@ -144,12 +142,7 @@ rq_random_poisson(double xm)
         /* use direct method */
 
         double t = 1.0;
-
-        if (xm != oldm)
-        {
-            oldm = xm;
-            g = exp(-xm);
-        }
+        double g = exp(-xm);
 
         em = -1;
 
@@ -163,14 +156,9 @@ rq_random_poisson(double xm)
     else
     {
         double t;
-
-        if (xm != oldm)
-        {
-            oldm = xm;
-            sq = sqrt(2.0 * xm);
-            alxm = log(xm);
-            g = xm * alxm - rq_log_gamma(xm + 1.0);
-        }
+        double sq = sqrt(2.0 * xm);
+        double alxm = log(xm);
+        double g = xm * alxm - rq_log_gamma(xm + 1.0);
 
         do
         {
@@ -43,6 +43,10 @@ extern "C" {
 #include "rq_config.h"
 
 /** Pick a random number from the normal distribution.
+ *
+ * The uniform variates come from rand(), so threads draw from the
+ * one sequence; whether rand() may be called from many threads at
+ * once depends on the C library.
  */
 RQ_EXPORT double rq_random_normal();
 
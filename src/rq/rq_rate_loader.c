@@ -0,0 +1,362 @@
+/*
+** rq_rate_loader.c
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#include "rq_rate_loader.h"
+#include "rq_error.h"
+#include "rq_date.h"
+#include "rq_rate.h"
+#include "rq_scan.h"
+#include "rq_stream_mmap.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define NUM_FIELDS 6
+#define FIELD_RATE_ID 1
+#define FIELD_RATE_TYPE 2
+#define FIELD_OBSERVATION_DATE 3
+#define FIELD_VALUE_DATE 4
+#define FIELD_VALUE 5
+
+/* The size of the blocks read from streams that aren't mapped. A
+   block grows if a single line doesn't fit in it. */
+#define BLOCK_SIZE 65536
+
+struct rq_rate_loader {
+    rq_rate_mgr_t rate_mgr;
+    rq_market_mgr_t market_mgr;
+    rq_market_t market; /**< the market the last rate went into */
+    char *id; /**< the NUL terminated rate id of the current line */
+    unsigned int id_len;
+    unsigned long num_rates;
+    int failed;
+};
+
+#define IS_DIGIT(c) ((unsigned)((c) - '0') <= 9)
+
+/* Parse a YYYY-MM-DD date directly, handing anything else to
+   rq_date_parse(). Returns 0 if the date isn't valid.
+*/
+static rq_date
+parse_date(const char *s, const char *end)
+{
+    char buf[32];
+
+    if (end - s == 10 && s[4] == '-' && s[7] == '-' &&
+        IS_DIGIT(s[0]) && IS_DIGIT(s[1]) && IS_DIGIT(s[2]) && IS_DIGIT(s[3]) &&
+        IS_DIGIT(s[5]) && IS_DIGIT(s[6]) && IS_DIGIT(s[8]) && IS_DIGIT(s[9]))
+    {
+        short year = (short)((s[0] - '0') * 1000 + (s[1] - '0') * 100 + (s[2] - '0') * 10 + (s[3] - '0'));
+        short month = (short)((s[5] - '0') * 10 + (s[6] - '0'));
+        short day = (short)((s[8] - '0') * 10 + (s[9] - '0'));
+
+        if (month < 1 || month > 12 || day < 1 || day > rq_date_get_days_in_month(month, year))
+            return 0;
+
+        return rq_date_from_dmy(day, month, year);
+    }
+
+    if (end - s >= (int)sizeof(buf))
+        return 0;
+    memcpy(buf, s, end - s);
+    buf[end - s] = '\0';
+
+    return rq_date_parse(buf, RQ_DATE_FORMAT_YMD);
+}
+
+/* Parse a value. Plain decimals of up to 15 significant digits are
+   worked out as an integer divided by a power of ten, which like
+   strtod() gives the nearest double, since both are exact. Anything
+   else goes to strtod().
+*/
+static int
+parse_value(const char *s, const char *end, double *value)
+{
+    static const double powers_of_ten[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+        1e11, 1e12, 1e13, 1e14, 1e15
+    };
+    const char *p = s;
+    double mantissa = 0.0;
+    int num_digits = 0;
+    int num_decimals = -1;
+    int negative = 0;
+    char buf[64];
+    char *endp;
+
+    if (p < end && (*p == '-' || *p == '+'))
+        negative = (*p++ == '-');
+
+    for (; p < end; p++)
+    {
+        if (IS_DIGIT(*p))
+        {
+            mantissa = mantissa * 10.0 + (*p - '0');
+            num_digits++;
+            if (num_decimals >= 0)
+                num_decimals++;
+        }
+        else if (*p == '.' && num_decimals < 0)
+            num_decimals = 0;
+        else
+            break;
+    }
+
+    if (p == end && num_digits > 0 && num_digits <= 15)
+    {
+        if (num_decimals > 0)
+            mantissa /= powers_of_ten[num_decimals];
+        *value = (negative ? -mantissa : mantissa);
+        return 0;
+    }
+
+    if (end == s || end - s >= (int)sizeof(buf))
+        return -1;
+    memcpy(buf, s, end - s);
+    buf[end - s] = '\0';
+    *value = strtod(buf, &endp);
+
+    return (*endp == '\0' ? 0 : -1);
+}
+
+static enum rq_rate_type
+parse_rate_type(const char *s, const char *end)
+{
+    unsigned int len = (unsigned int)(end - s);
+    int i;
+
+    for (i = 0; i < RQ_RATE_TYPE_MAX_ENUM; i++)
+    {
+        const char *name = rq_rate_type_to_string((enum rq_rate_type)i);
+
+        if (name[0] == s[0] && !strncmp(name, s, len) && name[len] == '\0')
+            return (enum rq_rate_type)i;
+    }
+
+    return RQ_RATE_TYPE_INVALID;
+}
+
+static int
+add_rate(struct rq_rate_loader *l, const char **starts, const char **ends)
+{
+    unsigned int id_len = (unsigned int)(ends[FIELD_RATE_ID] - starts[FIELD_RATE_ID]);
+    enum rq_rate_type rate_type;
+    rq_date observation_date;
+    rq_date value_date;
+    double value;
+    rq_rate_t rate;
+
+    if (id_len == 0 || ends[FIELD_RATE_TYPE] == starts[FIELD_RATE_TYPE])
+        return -1;
+
+    rate_type = parse_rate_type(starts[FIELD_RATE_TYPE], ends[FIELD_RATE_TYPE]);
+    observation_date = parse_date(starts[FIELD_OBSERVATION_DATE], ends[FIELD_OBSERVATION_DATE]);
+    value_date = parse_date(starts[FIELD_VALUE_DATE], ends[FIELD_VALUE_DATE]);
+    if (rate_type == RQ_RATE_TYPE_INVALID || !observation_date || !value_date ||
+        parse_value(starts[FIELD_VALUE], ends[FIELD_VALUE], &value) != 0)
+        return -1;
+
+    if (id_len >= l->id_len)
+    {
+        l->id_len = id_len * 2;
+        l->id = (char *)RQ_REALLOC(l->id, l->id_len);
+    }
+    memcpy(l->id, starts[FIELD_RATE_ID], id_len);
+    l->id[id_len] = '\0';
+
+    rate = rq_rate_build(l->id, l->id, rate_type, observation_date, value_date, value);
+
+    if (l->market_mgr)
+    {
+        /* rate files are usually in date order, so the market is
+           usually the one the last rate went into */
+        if (!l->market || rq_market_get_market_date(l->market) != observation_date)
+        {
+            l->market = rq_market_mgr_get(l->market_mgr, observation_date);
+            if (!l->market)
+            {
+                l->market = rq_market_alloc(observation_date);
+                rq_market_mgr_add(l->market_mgr, l->market);
+            }
+        }
+        rq_rate_mgr_add(rq_market_get_rate_mgr(l->market), rate);
+    }
+    else
+        rq_rate_mgr_add(l->rate_mgr, rate);
+
+    l->num_rates++;
+
+    return 0;
+}
+
+/* Load the complete lines between buf and end, and if at_end is set
+   a last line without a line feed. Returns the start of the first
+   line not loaded, or NULL if a line couldn't be parsed.
+
+   The fields and line ends are found in a single scan for either
+   delimiter.
+*/
+static const char *
+load_lines(struct rq_rate_loader *l, const char *buf, const char *end, int at_end)
+{
+    const char *line = buf;
+
+    while (line < end)
+    {
+        const char *starts[NUM_FIELDS];
+        const char *ends[NUM_FIELDS];
+        const char *line_end;
+        const char *p = line;
+        int num_fields = 0;
+
+        if (*line == '#')
+        {
+            line_end = rq_scan_for(line, end, '\n', '\n');
+            if (line_end == end && !at_end)
+                return line;
+        }
+        else
+        {
+            while (1)
+            {
+                line_end = rq_scan_for(p, end, '|', '\n');
+                if (line_end == end && !at_end)
+                    return line;
+
+                if (num_fields < NUM_FIELDS)
+                {
+                    starts[num_fields] = p;
+                    ends[num_fields] = line_end;
+                    num_fields++;
+                }
+                if (line_end == end || *line_end == '\n')
+                    break;
+                p = line_end + 1;
+            }
+
+            /* CRLF */
+            if (line_end > line && line_end[-1] == '\r' && ends[num_fields - 1] == line_end)
+                ends[num_fields - 1]--;
+
+            if (num_fields == NUM_FIELDS)
+            {
+                if (add_rate(l, starts, ends) != 0)
+                {
+                    l->failed = 1;
+                    return NULL;
+                }
+            }
+            else if (num_fields > 1 || ends[0] != starts[0])
+            {
+                /* not a blank line */
+                l->failed = 1;
+                return NULL;
+            }
+        }
+
+        line = (line_end == end ? end : line_end + 1);
+    }
+
+    return line;
+}
+
+static rq_error_code
+load(struct rq_rate_loader *l, rq_stream_t stream, unsigned long *num_rates)
+{
+    unsigned long buffer_len;
+    const char *mapped = rq_stream_mmap_get_buffer(stream, &buffer_len);
+    rq_error_code ret = RQ_OK;
+
+    l->market = NULL;
+    l->id_len = 64;
+    l->id = (char *)RQ_MALLOC(l->id_len);
+    l->num_rates = 0;
+    l->failed = 0;
+
+    if (mapped)
+        load_lines(l, mapped, mapped + buffer_len, 1);
+    else
+    {
+        unsigned int block_size = BLOCK_SIZE;
+        char *block = (char *)RQ_MALLOC(block_size);
+        unsigned int carry = 0;
+        int at_end = 0;
+
+        while (!at_end && !l->failed)
+        {
+            int n = rq_stream_read(stream, block + carry, (int)(block_size - carry));
+            const char *rest;
+
+            if (n < 0)
+            {
+                ret = RQ_FAILED;
+                break;
+            }
+            at_end = (n == 0);
+
+            rest = load_lines(l, block, block + carry + n, at_end);
+            if (!rest)
+                break;
+
+            /* keep the partial line at the end for the next block */
+            carry = (unsigned int)(block + carry + n - rest);
+            memmove(block, rest, carry);
+            if (carry == block_size)
+            {
+                block_size *= 2;
+                block = (char *)RQ_REALLOC(block, block_size);
+            }
+        }
+
+        RQ_FREE(block);
+    }
+
+    if (l->failed)
+        ret = RQ_ERR_RATE_LOADER_BAD_LINE;
+
+    RQ_FREE(l->id);
+
+    if (num_rates)
+        *num_rates = l->num_rates;
+
+    return ret;
+}
+
+RQ_EXPORT rq_error_code 
+rq_rate_loader_load(rq_stream_t stream, rq_rate_mgr_t rate_mgr, unsigned long *num_rates)
+{
+    struct rq_rate_loader l;
+
+    l.rate_mgr = rate_mgr;
+    l.market_mgr = NULL;
+
+    return load(&l, stream, num_rates);
+}
+
+RQ_EXPORT rq_error_code 
+rq_rate_loader_load_markets(rq_stream_t stream, rq_market_mgr_t market_mgr, unsigned long *num_rates)
+{
+    struct rq_rate_loader l;
+
+    l.rate_mgr = NULL;
+    l.market_mgr = market_mgr;
+
+    return load(&l, stream, num_rates);
+}
@@ -0,0 +1,95 @@
+/**
+ * @file
+ *
+ * Bulk loading of rates from pipe-delimited text files.
+ */
+/*
+** rq_rate_loader.h
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#ifndef rq_rate_loader_h
+#define rq_rate_loader_h
+
+/* -- includes ----------------------------------------------------- */
+#include "rq_config.h"
+#include "rq_defs.h"
+#include "rq_stream.h"
+#include "rq_rate_mgr.h"
+#include "rq_market_mgr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#if 0
+} // purely to not screw up my indenting...
+#endif
+#endif
+
+/*
+ * A rate file has one rate per line, in the fields
+ *
+ *   kind|rate id|rate type|observation date|value date|value
+ *
+ * for example IntRate|AUDO/N|SIMPLE|2002-11-07|2002-11-08|0.0475.
+ * The kind isn't used. The rate id is both the rate class id and
+ * the asset id of the rate built, the rate type is one of the
+ * strings rq_rate_type_from_string() knows and the dates are
+ * YYYY-MM-DD. Blank lines, lines starting with '#' and any fields
+ * after the sixth are ignored, and lines can end in CRLF.
+ *
+ * A memory-mapped stream (see rq_stream_mmap.h) is parsed in place.
+ * Any other stream is read in large blocks.
+ */
+
+/* -- prototypes -------------------------------------------------- */
+
+/**
+ * Load the rates in a rate file into a rate manager. A rate
+ * replaces any rate already in the manager with the same id, so for
+ * a file covering several days the manager ends up with the last
+ * rate in the file for each id.
+ *
+ * @param stream An open stream on the rate file
+ * @param rate_mgr The manager to add the rates to
+ * @param num_rates If not NULL, set to the number of rates loaded
+ * @return RQ_OK, or RQ_ERR_RATE_LOADER_BAD_LINE at the first line
+ * that can't be parsed, in which case the rates before it have been
+ * loaded
+ */
+RQ_EXPORT rq_error_code 
+rq_rate_loader_load(rq_stream_t stream, rq_rate_mgr_t rate_mgr, unsigned long *num_rates);
+
+/**
+ * Load the rates in a rate file into the markets for their
+ * observation dates, allocating and adding to the market manager
+ * any market that isn't already there.
+ *
+ * @return As for rq_rate_loader_load()
+ */
+RQ_EXPORT rq_error_code 
+rq_rate_loader_load_markets(rq_stream_t stream, rq_market_mgr_t market_mgr, unsigned long *num_rates);
+
+#ifdef __cplusplus
+#if 0
+{ // purely to not screw up my indenting...
+#endif
+};
+#endif
+
+#endif
@@ -0,0 +1,395 @@
+/*
+** rq_results_columns.c
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#include "rq_results_columns.h"
+#include "rq_error.h"
+#include "rq_stream_mmap.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define NUM_COLUMNS 5
+
+/* Columns are padded out to this. */
+#define COLUMN_ALIGNMENT 8
+#define ALIGN(n) (((n) + COLUMN_ALIGNMENT - 1) & ~(COLUMN_ALIGNMENT - 1))
+
+static const char padding[COLUMN_ALIGNMENT] = { 0 };
+
+/* Allocate the columns in one block, the doubles first so that
+   every column is aligned. */
+static void
+allocate_columns(rq_results_columns_t cols, unsigned long max_rows)
+{
+    char *block = (char *)RQ_MALLOC(max_rows * (sizeof(double) + 3 * sizeof(unsigned int) + sizeof(unsigned short)));
+    unsigned int *trade_indexes;
+    unsigned int *scenarios;
+    unsigned short *measures;
+    int *dates;
+    double *values;
+
+    values = (double *)block;
+    trade_indexes = (unsigned int *)(values + max_rows);
+    scenarios = trade_indexes + max_rows;
+    dates = (int *)(scenarios + max_rows);
+    measures = (unsigned short *)(dates + max_rows);
+
+    if (cols->block)
+    {
+        memcpy(values, cols->values, cols->num_rows * sizeof(double));
+        memcpy(trade_indexes, cols->trade_indexes, cols->num_rows * sizeof(unsigned int));
+        memcpy(scenarios, cols->scenarios, cols->num_rows * sizeof(unsigned int));
+        memcpy(dates, cols->dates, cols->num_rows * sizeof(int));
+        memcpy(measures, cols->measures, cols->num_rows * sizeof(unsigned short));
+        RQ_FREE(cols->block);
+    }
+
+    cols->block = block;
+    cols->max_rows = max_rows;
+    cols->values = values;
+    cols->trade_indexes = trade_indexes;
+    cols->scenarios = scenarios;
+    cols->dates = dates;
+    cols->measures = measures;
+}
+
+static void
+init_header(struct rq_results_columns_header *header)
+{
+    memset(header, 0, sizeof(struct rq_results_columns_header));
+    memcpy(header->magic, RQ_RESULTS_COLUMNS_MAGIC, sizeof(header->magic));
+    header->version = RQ_RESULTS_COLUMNS_VERSION;
+    header->byte_order = RQ_RESULTS_COLUMNS_BYTE_ORDER;
+    header->num_columns = NUM_COLUMNS;
+}
+
+static rq_error_code
+write_header(rq_stream_t stream)
+{
+    struct rq_results_columns_header header;
+
+    init_header(&header);
+    if (rq_stream_write(stream, (const char *)&header, sizeof(header)) != (int)sizeof(header))
+        return RQ_FAILED;
+
+    return RQ_OK;
+}
+
+static void
+add_column(struct rq_stream_iovec *iov, int *iovcnt, unsigned int *offset, const void *column, unsigned int len)
+{
+    iov[*iovcnt].buf = (char *)column;
+    iov[*iovcnt].len = (int)len;
+    (*iovcnt)++;
+    if (ALIGN(len) != len)
+    {
+        iov[*iovcnt].buf = (char *)padding;
+        iov[*iovcnt].len = (int)(ALIGN(len) - len);
+        (*iovcnt)++;
+    }
+    *offset += ALIGN(len);
+}
+
+/* Write rows [first_row, first_row + num_rows) as a batch, straight
+   from the columns. */
+static rq_error_code
+write_batch(const rq_results_columns_t cols, rq_stream_t stream, unsigned long first_row, unsigned long num_rows)
+{
+    struct rq_results_columns_batch_header header;
+    struct rq_stream_iovec iov[1 + 2 * NUM_COLUMNS];
+    int iovcnt = 1;
+    unsigned int offset = sizeof(header);
+
+    memset(&header, 0, sizeof(header));
+    header.num_rows = (unsigned int)num_rows;
+
+    header.trade_index_offset = offset;
+    add_column(iov, &iovcnt, &offset, cols->trade_indexes + first_row, num_rows * sizeof(unsigned int));
+    header.scenario_offset = offset;
+    add_column(iov, &iovcnt, &offset, cols->scenarios + first_row, num_rows * sizeof(unsigned int));
+    header.measure_offset = offset;
+    add_column(iov, &iovcnt, &offset, cols->measures + first_row, num_rows * sizeof(unsigned short));
+    header.date_offset = offset;
+    add_column(iov, &iovcnt, &offset, cols->dates + first_row, num_rows * sizeof(int));
+    header.value_offset = offset;
+    add_column(iov, &iovcnt, &offset, cols->values + first_row, num_rows * sizeof(double));
+    header.length = offset;
+
+    iov[0].buf = (char *)&header;
+    iov[0].len = sizeof(header);
+
+    if (rq_stream_writev(stream, iov, iovcnt) != (int)offset)
+        return RQ_FAILED;
+
+    return RQ_OK;
+}
+
+RQ_EXPORT rq_results_columns_t
+rq_results_columns_alloc(rq_stream_t stream, unsigned long batch_rows)
+{
+    rq_results_columns_t cols = (rq_results_columns_t)RQ_CALLOC(1, sizeof(struct rq_results_columns));
+
+    if (batch_rows == 0)
+        batch_rows = RQ_RESULTS_COLUMNS_DEFAULT_BATCH_ROWS;
+    else if (batch_rows > RQ_RESULTS_COLUMNS_MAX_BATCH_ROWS)
+        batch_rows = RQ_RESULTS_COLUMNS_MAX_BATCH_ROWS;
+
+    allocate_columns(cols, batch_rows);
+
+    cols->stream = stream;
+    cols->error = RQ_OK;
+    if (stream)
+        cols->error = write_header(stream);
+
+    return cols;
+}
+
+RQ_EXPORT rq_error_code
+rq_results_columns_free(rq_results_columns_t cols)
+{
+    rq_error_code err = rq_results_columns_flush(cols);
+
+    RQ_FREE(cols->block);
+    RQ_FREE(cols);
+
+    return err;
+}
+
+RQ_EXPORT rq_error_code
+rq_results_columns_flush(rq_results_columns_t cols)
+{
+    if (cols->stream && cols->num_rows > 0)
+    {
+        if (cols->error == RQ_OK)
+            cols->error = write_batch(cols, cols->stream, 0, cols->num_rows);
+        cols->num_rows_written += cols->num_rows;
+        cols->num_rows = 0;
+    }
+
+    return cols->error;
+}
+
+/* Called when the columns are full. */
+static void
+make_room(rq_results_columns_t cols)
+{
+    if (cols->stream)
+        rq_results_columns_flush(cols);
+    else
+        allocate_columns(cols, cols->max_rows * 2);
+}
+
+RQ_EXPORT void
+rq_results_columns_append(
+    rq_results_columns_t cols,
+    unsigned int trade_index,
+    unsigned int scenario,
+    unsigned short measure,
+    rq_date date,
+    double value
+    )
+{
+    unsigned long row;
+
+    if (cols->num_rows == cols->max_rows)
+        make_room(cols);
+
+    row = cols->num_rows++;
+    cols->trade_indexes[row] = trade_index;
+    cols->scenarios[row] = scenario;
+    cols->measures[row] = measure;
+    cols->dates[row] = (int)date;
+    cols->values[row] = value;
+}
+
+RQ_EXPORT unsigned int
+rq_results_columns_append_pricing_result(
+    rq_results_columns_t cols,
+    unsigned int trade_index,
+    unsigned int scenario,
+    rq_date date,
+    const struct rq_pricing_result *pr
+    )
+{
+    unsigned long num_rows = cols->num_rows_written + cols->num_rows;
+    unsigned int i;
+
+    if (!pr->valid)
+        return 0;
+
+    if (pr->results_returned & RQ_PRICING_RESULTS_FACE_VALUE)
+        rq_results_columns_append(cols, trade_index, scenario, RQ_RESULTS_MEASURE_FACE_VALUE, date, pr->face_value);
+    if (pr->results_returned & RQ_PRICING_RESULTS_VALUE)
+        rq_results_columns_append(cols, trade_index, scenario, RQ_RESULTS_MEASURE_VALUE, date, pr->value);
+
+    if (pr->delta != 0.0)
+        rq_results_columns_append(cols, trade_index, scenario, RQ_RESULTS_MEASURE_DELTA, date, pr->delta);
+    if (pr->gamma != 0.0)
+        rq_results_columns_append(cols, trade_index, scenario, RQ_RESULTS_MEASURE_GAMMA, date, pr->gamma);
+    if (pr->theta != 0.0)
+        rq_results_columns_append(cols, trade_index, scenario, RQ_RESULTS_MEASURE_THETA, date, pr->theta);
+    if (pr->vega != 0.0)
+        rq_results_columns_append(cols, trade_index, scenario, RQ_RESULTS_MEASURE_VEGA, date, pr->vega);
+    if (pr->rho != 0.0)
+        rq_results_columns_append(cols, trade_index, scenario, RQ_RESULTS_MEASURE_RHO, date, pr->rho);
+
+    if (pr->results_returned & RQ_PRICING_RESULTS_EXPOSURE_PROFILE)
+    {
+        if (pr->exposure_profile.exposures)
+            for (i = 0; i < pr->exposure_profile.num_exposure_dates; i++)
+                rq_results_columns_append(cols, trade_index, scenario, RQ_RESULTS_MEASURE_EXPOSURE, 
+                                          pr->exposure_profile.dates[i], pr->exposure_profile.exposures[i]);
+        if (pr->exposure_profile.fixed_exposures)
+            for (i = 0; i < pr->exposure_profile.num_exposure_dates; i++)
+                rq_results_columns_append(cols, trade_index, scenario, RQ_RESULTS_MEASURE_FIXED_EXPOSURE, 
+                                          pr->exposure_profile.dates[i], pr->exposure_profile.fixed_exposures[i]);
+    }
+
+    return (unsigned int)(cols->num_rows_written + cols->num_rows - num_rows);
+}
+
+RQ_EXPORT rq_error_code
+rq_results_columns_write(const rq_results_columns_t cols, rq_stream_t stream)
+{
+    unsigned long row;
+    rq_error_code err = write_header(stream);
+
+    for (row = 0; err == RQ_OK && row < cols->num_rows; row += RQ_RESULTS_COLUMNS_MAX_BATCH_ROWS)
+    {
+        unsigned long num_rows = cols->num_rows - row;
+
+        if (num_rows > RQ_RESULTS_COLUMNS_MAX_BATCH_ROWS)
+            num_rows = RQ_RESULTS_COLUMNS_MAX_BATCH_ROWS;
+        err = write_batch(cols, stream, row, num_rows);
+    }
+
+    return err;
+}
+
+/* -- reading ------------------------------------------------------ */
+
+/* Check a column lies inside its batch and is aligned. */
+static int
+column_ok(const struct rq_results_columns_batch_header *header, unsigned int offset, unsigned int element_size)
+{
+    return offset % COLUMN_ALIGNMENT == 0 && 
+        offset >= sizeof(struct rq_results_columns_batch_header) &&
+        offset <= header->length &&
+        header->num_rows <= (header->length - offset) / element_size;
+}
+
+RQ_EXPORT rq_error_code
+rq_results_columns_read_buffer(
+    const char *buffer,
+    unsigned long buffer_len,
+    void (*batch_func)(void *batch_func_data, const struct rq_results_batch *batch),
+    void *batch_func_data
+    )
+{
+    const struct rq_results_columns_header *header = (const struct rq_results_columns_header *)buffer;
+    unsigned long offset = sizeof(struct rq_results_columns_header);
+
+    if (buffer_len < sizeof(struct rq_results_columns_header) ||
+        memcmp(header->magic, RQ_RESULTS_COLUMNS_MAGIC, sizeof(header->magic)))
+        return RQ_ERR_RESULTS_COLUMNS_BAD_FORMAT;
+    if (header->version > RQ_RESULTS_COLUMNS_VERSION || header->byte_order != RQ_RESULTS_COLUMNS_BYTE_ORDER)
+        return RQ_ERR_RESULTS_COLUMNS_VERSION;
+    if (header->num_columns != NUM_COLUMNS)
+        return RQ_ERR_RESULTS_COLUMNS_BAD_FORMAT;
+
+    while (offset < buffer_len)
+    {
+        const struct rq_results_columns_batch_header *bh = 
+            (const struct rq_results_columns_batch_header *)(buffer + offset);
+        struct rq_results_batch batch;
+
+        if (buffer_len - offset < sizeof(struct rq_results_columns_batch_header) ||
+            bh->length > buffer_len - offset ||
+            bh->length % COLUMN_ALIGNMENT != 0 ||
+            !column_ok(bh, bh->trade_index_offset, sizeof(unsigned int)) ||
+            !column_ok(bh, bh->scenario_offset, sizeof(unsigned int)) ||
+            !column_ok(bh, bh->measure_offset, sizeof(unsigned short)) ||
+            !column_ok(bh, bh->date_offset, sizeof(int)) ||
+            !column_ok(bh, bh->value_offset, sizeof(double)))
+            return RQ_ERR_RESULTS_COLUMNS_BAD_FORMAT;
+
+        batch.num_rows = bh->num_rows;
+        batch.trade_indexes = (const unsigned int *)((const char *)bh + bh->trade_index_offset);
+        batch.scenarios = (const unsigned int *)((const char *)bh + bh->scenario_offset);
+        batch.measures = (const unsigned short *)((const char *)bh + bh->measure_offset);
+        batch.dates = (const int *)((const char *)bh + bh->date_offset);
+        batch.values = (const double *)((const char *)bh + bh->value_offset);
+        (*batch_func)(batch_func_data, &batch);
+
+        offset += bh->length;
+    }
+
+    return RQ_OK;
+}
+
+RQ_EXPORT rq_error_code
+rq_results_columns_read(
+    rq_stream_t stream,
+    void (*batch_func)(void *batch_func_data, const struct rq_results_batch *batch),
+    void *batch_func_data
+    )
+{
+    const char *buffer;
+    unsigned long buffer_len;
+    char *data;
+    unsigned long len = 0;
+    unsigned long max_len = 65536;
+    int num_bytes_read;
+    rq_error_code err;
+
+    if (!rq_stream_is_open(stream))
+    {
+        err = rq_stream_open(stream);
+        if (err != RQ_OK)
+            return err;
+    }
+
+    buffer = rq_stream_mmap_get_buffer(stream, &buffer_len);
+    if (buffer)
+    {
+        long offset = rq_stream_tell(stream);
+        return rq_results_columns_read_buffer(buffer + offset, buffer_len - offset, batch_func, batch_func_data);
+    }
+
+    data = (char *)RQ_MALLOC(max_len);
+    do
+    {
+        if (len == max_len)
+        {
+            max_len *= 2;
+            data = (char *)RQ_REALLOC(data, max_len);
+        }
+
+        num_bytes_read = rq_stream_read(stream, data + len, (int)(max_len - len));
+        if (num_bytes_read > 0)
+            len += num_bytes_read;
+    }
+    while (num_bytes_read > 0);
+
+    err = rq_results_columns_read_buffer(data, len, batch_func, batch_func_data);
+    RQ_FREE(data);
+
+    return err;
+}
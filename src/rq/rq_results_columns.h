@@ -0,0 +1,237 @@
+/**
+ * @file
+ *
+ * Append pricing results into columns and write them as a columnar file.
+ */
+/*
+** rq_results_columns.h
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#ifndef rq_results_columns_h
+#define rq_results_columns_h
+
+/* -- includes ----------------------------------------------------- */
+#include "rq_config.h"
+#include "rq_defs.h"
+#include "rq_date.h"
+#include "rq_stream.h"
+#include "rq_pricing_result.h"
+
+#ifdef __cplusplus
+extern "C" {
+#if 0
+} // purely to not screw up my indenting...
+#endif
+#endif
+
+/*
+ * A results file holds rows of trade index, scenario, measure, date
+ * and value. It is a header followed by batches of rows, each batch
+ * holding its rows column by column: a batch header giving the
+ * offset of each column from the start of the batch, then the
+ * columns, each starting on an 8 byte boundary. A reader can map the
+ * file (see rq_stream_mmap.h) and use the columns where they lie.
+ *
+ * Batches are written as the column buffers fill, so a file can hold
+ * any number of rows while the writer holds only one batch. As with
+ * snapshots, everything is in the byte order of the machine that
+ * wrote it, which the header records, and uses 32 bit ints and IEEE
+ * doubles.
+ */
+
+/* -- defines ------------------------------------------------------ */
+#define RQ_RESULTS_COLUMNS_MAGIC "RQRSLT\r\n"
+#define RQ_RESULTS_COLUMNS_VERSION 1
+#define RQ_RESULTS_COLUMNS_BYTE_ORDER 0x01020304
+
+/** The number of rows in a batch if none is given. */
+#define RQ_RESULTS_COLUMNS_DEFAULT_BATCH_ROWS 65536
+
+/** The most rows a batch can have, which keeps a batch under 4GB. */
+#define RQ_RESULTS_COLUMNS_MAX_BATCH_ROWS 0x4000000
+
+enum rq_results_measure {
+    RQ_RESULTS_MEASURE_FACE_VALUE = 1,
+    RQ_RESULTS_MEASURE_VALUE,
+    RQ_RESULTS_MEASURE_DELTA,
+    RQ_RESULTS_MEASURE_GAMMA,
+    RQ_RESULTS_MEASURE_THETA,
+    RQ_RESULTS_MEASURE_VEGA,
+    RQ_RESULTS_MEASURE_RHO,
+    RQ_RESULTS_MEASURE_EXPOSURE, /**< one row per exposure profile date */
+    RQ_RESULTS_MEASURE_FIXED_EXPOSURE, /**< one row per exposure profile date */
+    RQ_RESULTS_MEASURE_USER = 256 /**< the caller's own measures start here */
+};
+
+/* -- structs ----------------------------------------------------- */
+struct rq_results_columns_header {
+    char magic[8]; /**< RQ_RESULTS_COLUMNS_MAGIC */
+    unsigned int version; /**< RQ_RESULTS_COLUMNS_VERSION */
+    unsigned int byte_order; /**< RQ_RESULTS_COLUMNS_BYTE_ORDER as written */
+    unsigned int num_columns; /**< 5 in this version */
+    unsigned int reserved;
+};
+
+struct rq_results_columns_batch_header {
+    unsigned int num_rows;
+    unsigned int length; /**< of the whole batch, including this header */
+    unsigned int trade_index_offset; /**< unsigned ints, from the start of the batch */
+    unsigned int scenario_offset; /**< unsigned ints */
+    unsigned int measure_offset; /**< unsigned shorts */
+    unsigned int date_offset; /**< ints */
+    unsigned int value_offset; /**< doubles */
+    unsigned int reserved;
+};
+
+/** A batch of rows as they lie in a results file. */
+struct rq_results_batch {
+    unsigned int num_rows;
+    const unsigned int *trade_indexes;
+    const unsigned int *scenarios;
+    const unsigned short *measures;
+    const int *dates;
+    const double *values;
+};
+
+/** The columns being filled. They are allocated once, for a batch of
+ * rows, and appending a row does no allocation unless the columns
+ * are held in memory and need to grow.
+ */
+typedef struct rq_results_columns {
+    rq_stream_t stream; /**< where full batches are written, or NULL to keep the rows */
+    rq_error_code error; /**< the first error writing to the stream */
+    unsigned long num_rows;
+    unsigned long max_rows;
+    unsigned long num_rows_written;
+
+    unsigned int *trade_indexes;
+    unsigned int *scenarios;
+    unsigned short *measures;
+    int *dates;
+    double *values;
+
+    void *block;
+} *rq_results_columns_t;
+
+/* -- prototypes -------------------------------------------------- */
+
+/**
+ * Allocate the columns for a batch of rows. With a stream, the file
+ * header is written straight away, and each time the columns fill
+ * they are written out as a batch and emptied. Without a stream the
+ * columns grow to hold every row.
+ *
+ * @param stream The stream to write the file to, or NULL
+ * @param batch_rows The number of rows in a batch, 0 for
+ * RQ_RESULTS_COLUMNS_DEFAULT_BATCH_ROWS
+ */
+RQ_EXPORT rq_results_columns_t rq_results_columns_alloc(rq_stream_t stream, unsigned long batch_rows);
+
+/**
+ * Write any rows not yet written and free the columns. The stream
+ * isn't closed.
+ *
+ * @return As for rq_results_columns_flush()
+ */
+RQ_EXPORT rq_error_code rq_results_columns_free(rq_results_columns_t cols);
+
+/**
+ * Append a row.
+ */
+RQ_EXPORT void
+rq_results_columns_append(
+    rq_results_columns_t cols,
+    unsigned int trade_index,
+    unsigned int scenario,
+    unsigned short measure,
+    rq_date date,
+    double value
+    );
+
+/**
+ * Append the results of pricing a trade: the face value and value
+ * if they were returned, the Greeks that aren't zero, and a row for
+ * each date of the exposure profile if it was returned. A Greek with
+ * no row is zero. Nothing is appended for a result that isn't valid.
+ *
+ * @param date The date of the value and Greeks
+ * @return The number of rows appended
+ */
+RQ_EXPORT unsigned int
+rq_results_columns_append_pricing_result(
+    rq_results_columns_t cols,
+    unsigned int trade_index,
+    unsigned int scenario,
+    rq_date date,
+    const struct rq_pricing_result *pricing_result
+    );
+
+/**
+ * Write the rows appended since the last batch as a batch. Does
+ * nothing without a stream or rows.
+ *
+ * @return RQ_OK, or RQ_FAILED if any write to the stream has failed
+ */
+RQ_EXPORT rq_error_code rq_results_columns_flush(rq_results_columns_t cols);
+
+/**
+ * Write the rows held in memory to a stream as a whole file.
+ */
+RQ_EXPORT rq_error_code rq_results_columns_write(const rq_results_columns_t cols, rq_stream_t stream);
+
+/**
+ * Hand each batch of a results file held in memory to batch_func.
+ * The batch points into the buffer.
+ *
+ * @return RQ_OK if successful, RQ_ERR_RESULTS_COLUMNS_BAD_FORMAT if
+ * the buffer isn't a valid results file, including one cut short, or
+ * RQ_ERR_RESULTS_COLUMNS_VERSION if it was written by a later
+ * version or on a machine of the other byte order. The batches
+ * before a bad batch have been handed over.
+ */
+RQ_EXPORT rq_error_code
+rq_results_columns_read_buffer(
+    const char *buffer,
+    unsigned long buffer_len,
+    void (*batch_func)(void *batch_func_data, const struct rq_results_batch *batch),
+    void *batch_func_data
+    );
+
+/**
+ * Read a results file from a stream. Memory-mapped streams are read
+ * in place, anything else is read into memory first.
+ *
+ * @see rq_results_columns_read_buffer
+ */
+RQ_EXPORT rq_error_code
+rq_results_columns_read(
+    rq_stream_t stream,
+    void (*batch_func)(void *batch_func_data, const struct rq_results_batch *batch),
+    void *batch_func_data
+    );
+
+#ifdef __cplusplus
+#if 0
+{ // purely to not screw up my indenting...
+#endif
+};
+#endif
+
+#endif
@@ -22,6 +22,7 @@
 ** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 */
 #include "rq_routing_explicit_details.h"
+#include "rq_alloc.h"
 #include <stdlib.h>
 
 RQ_EXPORT void
@@ -30,7 +31,7 @@ rq_routing_explicit_details_init(struct rq_routing_explicit_details *p)
     p->routing_name = NULL;
     p->routing_address = NULL;
     p->routing_account_number = NULL;
-    p->routing_reference_text = rq_array_alloc(free);
+    p->routing_reference_text = rq_array_alloc(rq_free_func);
 }
 
 RQ_EXPORT void
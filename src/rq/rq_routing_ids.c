@@ -22,12 +22,13 @@
 ** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 */
 #include "rq_routing_ids.h"
+#include "rq_alloc.h"
 #include <stdlib.h>
 
 RQ_EXPORT void
 rq_routing_ids_init(struct rq_routing_ids *p)
 {
-    p->routing_id_list = rq_array_alloc(free);
+    p->routing_id_list = rq_array_alloc(rq_free_func);
 }
 
 RQ_EXPORT void
@@ -63,5 +64,5 @@ RQ_EXPORT void
 rq_routing_ids_free(struct rq_routing_ids *p)
 {
     rq_routing_ids_clear(p);
-    free(p);
+    RQ_FREE(p);
 }
@@ -0,0 +1,60 @@
+/*
+** rq_scan.c
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#include "rq_scan.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# include <emmintrin.h>
+# define RQ_SCAN_SSE2
+#endif
+
+RQ_EXPORT const char *
+rq_scan_for(const char *s, const char *end, char c1, char c2)
+{
+#ifdef RQ_SCAN_SSE2
+    __m128i v1 = _mm_set1_epi8(c1);
+    __m128i v2 = _mm_set1_epi8(c2);
+
+    while (end - s >= 16)
+    {
+        __m128i b = _mm_loadu_si128((const __m128i *)s);
+        int mask = _mm_movemask_epi8(
+            _mm_or_si128(_mm_cmpeq_epi8(b, v1), _mm_cmpeq_epi8(b, v2)));
+
+        if (mask)
+        {
+            while (!(mask & 1))
+            {
+                mask >>= 1;
+                s++;
+            }
+            return s;
+        }
+        s += 16;
+    }
+#endif
+
+    for (; s < end; s++)
+        if (*s == c1 || *s == c2)
+            return s;
+
+    return end;
+}
@@ -0,0 +1,58 @@
+/**
+ * @file
+ *
+ * This file defines a function for finding characters in a buffer,
+ * shared by the library's parsers.
+ */
+/*
+** rq_scan.h
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#ifndef rq_scan_h
+#define rq_scan_h
+
+/* -- includes ---------------------------------------------------- */
+#include "rq_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#if 0
+} // purely to not screw up my indenting...
+#endif
+#endif
+
+/* -- prototypes -------------------------------------------------- */
+/**
+ * Find the first c1 or c2 in [s, end), 16 bytes at a time where SSE2
+ * is available. Pass the same character twice to look for just one.
+ * This is for the library's own parsers and isn't installed.
+ *
+ * @return The character found, or end if there isn't one.
+ */
+RQ_EXPORT const char *rq_scan_for(const char *s, const char *end, char c1, char c2);
+
+#ifdef __cplusplus
+#if 0
+{ // purely to not screw up my indenting...
+#endif
+};
+#endif
+
+#endif
@@ -0,0 +1,254 @@
+/*
+** rq_schedule.c
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#include "rq_schedule.h"
+#include "rq_date_roll.h"
+#include "rq_day_count.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* Schedules from the cache are shared between threads, so the
+   reference count is changed atomically. ATOMIC_ADD returns the
+   value before the add. */
+#if defined(WIN32)
+#include <windows.h>
+#define ATOMIC_ADD(p, n) InterlockedExchangeAdd((LONG volatile *)(p), (LONG)(n))
+#elif defined(__GNUC__)
+#define ATOMIC_ADD(p, n) __sync_fetch_and_add((p), (n))
+#else
+#define ATOMIC_ADD(p, n) ((*(p) += (n)) - (n))
+#endif
+
+RQ_EXPORT void
+rq_schedule_params_init(struct rq_schedule_params *params)
+{
+    memset(params, '\0', sizeof(struct rq_schedule_params));
+    params->roll_convention = RQ_ROLL_CONVENTION_NONE;
+    params->date_roll_convention = RQ_DATE_ROLL_MOD_FOLLOWING;
+    params->stub_position = RQ_DATE_ROLL_STUB_POSITION_NONE;
+    params->day_count_convention = RQ_DAY_COUNT_ACTUAL_365;
+}
+
+RQ_EXPORT void
+rq_schedule_params_set_calendars(struct rq_schedule_params *params, const rq_calendar_t *cals, unsigned short num_cals)
+{
+    unsigned short i;
+
+    if (num_cals > RQ_SCHEDULE_MAX_CALENDARS)
+        num_cals = RQ_SCHEDULE_MAX_CALENDARS;
+
+    params->num_cals = num_cals;
+    for (i = 0; i < RQ_SCHEDULE_MAX_CALENDARS; i++)
+        params->cals[i] = (i < num_cals ? cals[i] : NULL);
+}
+
+#define CMP_FIELD(a, b) if ((a) != (b)) return ((a) < (b) ? -1 : 1)
+
+RQ_EXPORT int
+rq_schedule_params_cmp(const struct rq_schedule_params *p1, const struct rq_schedule_params *p2)
+{
+    unsigned short i;
+
+    CMP_FIELD(p1->start_date, p2->start_date);
+    CMP_FIELD(p1->end_date, p2->end_date);
+    CMP_FIELD(p1->term.days, p2->term.days);
+    CMP_FIELD(p1->term.weeks, p2->term.weeks);
+    CMP_FIELD(p1->term.months, p2->term.months);
+    CMP_FIELD(p1->term.years, p2->term.years);
+    CMP_FIELD(p1->term.date, p2->term.date);
+    CMP_FIELD(p1->roll_convention, p2->roll_convention);
+    CMP_FIELD(p1->date_roll_convention, p2->date_roll_convention);
+    CMP_FIELD(p1->stub_position, p2->stub_position);
+    CMP_FIELD(p1->day_count_convention, p2->day_count_convention);
+    CMP_FIELD(p1->fixing_offset, p2->fixing_offset);
+    CMP_FIELD(p1->payment_offset, p2->payment_offset);
+    CMP_FIELD(p1->num_cals, p2->num_cals);
+    for (i = 0; i < p1->num_cals; i++)
+        CMP_FIELD(p1->cals[i], p2->cals[i]);
+
+    return 0;
+}
+
+RQ_EXPORT int
+rq_schedule_is_null(rq_schedule_t obj)
+{
+    return (obj == NULL);
+}
+
+RQ_EXPORT rq_schedule_t
+rq_schedule_generate(const struct rq_schedule_params *params)
+{
+    struct rq_schedule *schedule = 
+        (struct rq_schedule *)RQ_CALLOC(1, sizeof(struct rq_schedule));
+    unsigned int max_dates = 128;
+    rq_date *dates = NULL;
+    rq_date *payment_dates;
+    rq_date *fixing_dates;
+    double *year_fractions;
+    unsigned int num_periods;
+    unsigned int i;
+    int num_dates;
+    int start_stub_index;
+
+    schedule->params = *params;
+    schedule->ref_count = 1;
+
+    /* generate the roll dates, growing the buffer until they all fit */
+    while (1)
+    {
+        dates = (rq_date *)RQ_MALLOC(max_dates * sizeof(rq_date));
+        num_dates = rq_date_roll_generate_dates(
+            dates,
+            max_dates,
+            params->start_date,
+            params->end_date,
+            &params->term,
+            params->roll_convention,
+            params->date_roll_convention,
+            params->cals,
+            params->num_cals,
+            params->stub_position,
+            0,
+            &start_stub_index
+            );
+        if (num_dates < (int)max_dates - 1)
+            break;
+
+        RQ_FREE(dates);
+        max_dates *= 2;
+    }
+
+    num_periods = (num_dates > 1 ? num_dates - 1 : 0);
+
+    /* keep everything in a single block, doubles first so they are
+       aligned */
+    year_fractions = (double *)RQ_MALLOC(
+        num_periods * sizeof(double) + 
+        (num_dates + 2 * num_periods) * sizeof(rq_date)
+        );
+    payment_dates = (rq_date *)(year_fractions + num_periods);
+    fixing_dates = payment_dates + num_periods;
+    memcpy(fixing_dates + num_periods, dates, num_dates * sizeof(rq_date));
+    RQ_FREE(dates);
+    dates = fixing_dates + num_periods;
+
+    for (i = 0; i < num_periods; i++)
+    {
+        if (params->payment_offset)
+            payment_dates[i] = rq_date_roll_days_offset(
+                dates[i+1], 
+                params->payment_offset,
+                params->cals,
+                params->num_cals,
+                params->date_roll_convention
+                );
+        else
+            payment_dates[i] = dates[i+1];
+
+        if (params->fixing_offset)
+            fixing_dates[i] = rq_date_roll_days_offset(
+                dates[i], 
+                params->fixing_offset,
+                params->cals,
+                params->num_cals,
+                params->date_roll_convention
+                );
+        else
+            fixing_dates[i] = dates[i];
+    }
+
+    rq_day_count_get_year_fractions(
+        params->day_count_convention,
+        dates,
+        dates + 1,
+        year_fractions,
+        num_periods
+        );
+
+    schedule->num_dates = (unsigned int)num_dates;
+    schedule->start_stub_index = start_stub_index;
+    schedule->dates = dates;
+    schedule->payment_dates = payment_dates;
+    schedule->fixing_dates = fixing_dates;
+    schedule->year_fractions = year_fractions;
+
+    return schedule;
+}
+
+RQ_EXPORT rq_schedule_t
+rq_schedule_ref(rq_schedule_t schedule)
+{
+    ATOMIC_ADD(&schedule->ref_count, 1);
+    return schedule;
+}
+
+RQ_EXPORT void
+rq_schedule_free(rq_schedule_t schedule)
+{
+    if (ATOMIC_ADD(&schedule->ref_count, -1) == 1)
+    {
+        /* year_fractions is the start of the block */
+        RQ_FREE((double *)schedule->year_fractions);
+        RQ_FREE(schedule);
+    }
+}
+
+RQ_EXPORT unsigned int
+rq_schedule_get_num_dates(const rq_schedule_t schedule)
+{
+    return schedule->num_dates;
+}
+
+RQ_EXPORT unsigned int
+rq_schedule_get_num_periods(const rq_schedule_t schedule)
+{
+    return (schedule->num_dates > 1 ? schedule->num_dates - 1 : 0);
+}
+
+RQ_EXPORT const rq_date *
+rq_schedule_get_dates(const rq_schedule_t schedule)
+{
+    return schedule->dates;
+}
+
+RQ_EXPORT const rq_date *
+rq_schedule_get_payment_dates(const rq_schedule_t schedule)
+{
+    return schedule->payment_dates;
+}
+
+RQ_EXPORT const rq_date *
+rq_schedule_get_fixing_dates(const rq_schedule_t schedule)
+{
+    return schedule->fixing_dates;
+}
+
+RQ_EXPORT const double *
+rq_schedule_get_year_fractions(const rq_schedule_t schedule)
+{
+    return schedule->year_fractions;
+}
+
+RQ_EXPORT int
+rq_schedule_get_start_stub_index(const rq_schedule_t schedule)
+{
+    return schedule->start_stub_index;
+}
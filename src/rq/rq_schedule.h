@@ -0,0 +1,143 @@
+/**
+ * @file
+ *
+ * A generated schedule of accrual, payment and fixing dates with their year fractions.
+ */
+/*
+** rq_schedule.h
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#ifndef rq_schedule_h
+#define rq_schedule_h
+
+#include "rq_config.h"
+#include "rq_date.h"
+#include "rq_enum.h"
+#include "rq_term.h"
+#include "rq_calendar.h"
+
+#ifdef __cplusplus
+extern "C" {
+#if 0
+} // purely to not screw up my indenting...
+#endif
+#endif
+
+#define RQ_SCHEDULE_MAX_CALENDARS MAX_COMPOSITE_CALENDAR_SIZE
+
+/** The parameters a schedule is generated from. Two schedules with
+ * equal parameters have the same dates, which is what lets them be
+ * shared through an rq_schedule_cache.
+ */
+struct rq_schedule_params {
+    rq_date start_date;
+    rq_date end_date;
+    struct rq_term term; /**< the period between roll dates */
+    enum rq_roll_convention roll_convention;
+    enum rq_date_roll_convention date_roll_convention;
+    enum rq_date_roll_stub_position stub_position;
+    enum rq_day_count_convention day_count_convention; /**< used for the year fractions */
+    int fixing_offset; /**< business days from the accrual start date to the fixing date, usually zero or negative */
+    int payment_offset; /**< business days from the accrual end date to the payment date */
+    unsigned short num_cals;
+    rq_calendar_t cals[RQ_SCHEDULE_MAX_CALENDARS];
+};
+
+/** A schedule is immutable once generated. Period i accrues from
+ * dates[i] to dates[i+1], fixes on fixing_dates[i] and pays on
+ * payment_dates[i].
+ */
+typedef struct rq_schedule {
+    struct rq_schedule_params params;
+    unsigned int num_dates;
+    int start_stub_index; /**< as returned by rq_date_roll_generate_dates() */
+    const rq_date *dates; /**< the num_dates adjusted roll dates */
+    const rq_date *payment_dates; /**< num_dates - 1 payment dates */
+    const rq_date *fixing_dates; /**< num_dates - 1 fixing dates */
+    const double *year_fractions; /**< num_dates - 1 accrual year fractions */
+
+    /* the number of references to the schedule, changed atomically,
+       and the links used by the schedule cache to keep track of
+       recent use */
+    unsigned int ref_count;
+    struct rq_schedule *lru_prev;
+    struct rq_schedule *lru_next;
+} *rq_schedule_t;
+
+
+/** Initialize schedule parameters. The dates are set to zero, the
+ * conventions to their defaults and the calendars to none.
+ */
+RQ_EXPORT void rq_schedule_params_init(struct rq_schedule_params *params);
+
+/** Set the calendars in the schedule parameters. At most
+ * RQ_SCHEDULE_MAX_CALENDARS are used.
+ */
+RQ_EXPORT void rq_schedule_params_set_calendars(struct rq_schedule_params *params, const rq_calendar_t *cals, unsigned short num_cals);
+
+/** Compare two sets of schedule parameters, returning less than,
+ * equal to or greater than zero. Calendars compare by identity.
+ */
+RQ_EXPORT int rq_schedule_params_cmp(const struct rq_schedule_params *p1, const struct rq_schedule_params *p2);
+
+/** Test whether the rq_schedule is NULL */
+RQ_EXPORT int rq_schedule_is_null(rq_schedule_t obj);
+
+/** Generate a new schedule. The returned schedule holds one reference.
+ */
+RQ_EXPORT rq_schedule_t rq_schedule_generate(const struct rq_schedule_params *params);
+
+/** Add a reference to the schedule. */
+RQ_EXPORT rq_schedule_t rq_schedule_ref(rq_schedule_t schedule);
+
+/** Drop a reference to the schedule, freeing it when the last
+ * reference goes.
+ */
+RQ_EXPORT void rq_schedule_free(rq_schedule_t schedule);
+
+/** Get the number of roll dates in the schedule. */
+RQ_EXPORT unsigned int rq_schedule_get_num_dates(const rq_schedule_t schedule);
+
+/** Get the number of accrual periods in the schedule. */
+RQ_EXPORT unsigned int rq_schedule_get_num_periods(const rq_schedule_t schedule);
+
+/** Get the adjusted roll dates. */
+RQ_EXPORT const rq_date *rq_schedule_get_dates(const rq_schedule_t schedule);
+
+/** Get the payment date for each period. */
+RQ_EXPORT const rq_date *rq_schedule_get_payment_dates(const rq_schedule_t schedule);
+
+/** Get the fixing date for each period. */
+RQ_EXPORT const rq_date *rq_schedule_get_fixing_dates(const rq_schedule_t schedule);
+
+/** Get the accrual year fraction for each period. */
+RQ_EXPORT const double *rq_schedule_get_year_fractions(const rq_schedule_t schedule);
+
+/** Get the index of the stub period, or -1 if there isn't one. */
+RQ_EXPORT int rq_schedule_get_start_stub_index(const rq_schedule_t schedule);
+
+#ifdef __cplusplus
+#if 0
+{ // purely to not screw up my indenting...
+#endif
+};
+#endif
+
+#endif
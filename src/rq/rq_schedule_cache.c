@@ -0,0 +1,163 @@
+/*
+** rq_schedule_cache.c
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#include "rq_schedule_cache.h"
+#include <stdlib.h>
+
+static void
+schedule_release(void *p)
+{
+    rq_schedule_free((rq_schedule_t)p);
+}
+
+static int
+schedule_params_cmp(const void *p1, const void *p2)
+{
+    return rq_schedule_params_cmp(
+        (const struct rq_schedule_params *)p1,
+        (const struct rq_schedule_params *)p2
+        );
+}
+
+static void
+lru_unlink(struct rq_schedule_cache *cache, struct rq_schedule *s)
+{
+    if (s->lru_prev)
+        s->lru_prev->lru_next = s->lru_next;
+    else
+        cache->lru_head = s->lru_next;
+
+    if (s->lru_next)
+        s->lru_next->lru_prev = s->lru_prev;
+    else
+        cache->lru_tail = s->lru_prev;
+
+    s->lru_prev = s->lru_next = NULL;
+}
+
+static void
+lru_push_front(struct rq_schedule_cache *cache, struct rq_schedule *s)
+{
+    s->lru_prev = NULL;
+    s->lru_next = cache->lru_head;
+    if (cache->lru_head)
+        cache->lru_head->lru_prev = s;
+    cache->lru_head = s;
+    if (!cache->lru_tail)
+        cache->lru_tail = s;
+}
+
+RQ_EXPORT int
+rq_schedule_cache_is_null(rq_schedule_cache_t obj)
+{
+    return (obj == NULL);
+}
+
+RQ_EXPORT rq_schedule_cache_t
+rq_schedule_cache_alloc(unsigned long max_size)
+{
+    struct rq_schedule_cache *cache = 
+        (struct rq_schedule_cache *)RQ_CALLOC(1, sizeof(struct rq_schedule_cache));
+
+    cache->schedules = rq_tree_rb_alloc(schedule_release, schedule_params_cmp);
+    cache->max_size = (max_size > 0 ? max_size : 1);
+    cache->mutex = rq_mutex_alloc();
+
+    return cache;
+}
+
+RQ_EXPORT void
+rq_schedule_cache_free(rq_schedule_cache_t cache)
+{
+    rq_schedule_cache_clear(cache);
+    rq_tree_rb_free(cache->schedules);
+    rq_mutex_free(cache->mutex);
+    RQ_FREE(cache);
+}
+
+RQ_EXPORT rq_schedule_t
+rq_schedule_cache_get(rq_schedule_cache_t cache, const struct rq_schedule_params *params)
+{
+    struct rq_schedule *s;
+
+    rq_mutex_lock(cache->mutex);
+
+    s = (struct rq_schedule *)rq_tree_rb_find(cache->schedules, params);
+    if (s)
+    {
+        cache->hits++;
+        if (s != cache->lru_head)
+        {
+            lru_unlink(cache, s);
+            lru_push_front(cache, s);
+        }
+    }
+    else
+    {
+        cache->misses++;
+
+        if (rq_tree_rb_size(cache->schedules) >= cache->max_size)
+        {
+            struct rq_schedule *victim = cache->lru_tail;
+
+            lru_unlink(cache, victim);
+            /* drops the cache's reference */
+            rq_tree_rb_remove(cache->schedules, &victim->params);
+        }
+
+        s = rq_schedule_generate(params);
+        rq_tree_rb_add(cache->schedules, &s->params, s);
+        lru_push_front(cache, s);
+    }
+
+    rq_schedule_ref(s);
+
+    rq_mutex_unlock(cache->mutex);
+
+    return s;
+}
+
+RQ_EXPORT void
+rq_schedule_cache_clear(rq_schedule_cache_t cache)
+{
+    struct rq_schedule *s;
+
+    rq_mutex_lock(cache->mutex);
+
+    s = cache->lru_head;
+    while (s)
+    {
+        struct rq_schedule *next = s->lru_next;
+        s->lru_prev = s->lru_next = NULL;
+        s = next;
+    }
+    cache->lru_head = cache->lru_tail = NULL;
+
+    rq_tree_rb_clear(cache->schedules);
+
+    rq_mutex_unlock(cache->mutex);
+}
+
+RQ_EXPORT unsigned long
+rq_schedule_cache_size(const rq_schedule_cache_t cache)
+{
+    return rq_tree_rb_size(cache->schedules);
+}
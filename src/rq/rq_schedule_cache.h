@@ -0,0 +1,95 @@
+/**
+ * @file
+ *
+ * A bounded cache of generated schedules, keyed by their generation parameters.
+ */
+/*
+** rq_schedule_cache.h
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#ifndef rq_schedule_cache_h
+#define rq_schedule_cache_h
+
+#include "rq_config.h"
+#include "rq_schedule.h"
+#include "rq_tree_rb.h"
+#include "rq_mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#if 0
+} // purely to not screw up my indenting...
+#endif
+#endif
+
+/* Trades and bootstrap instruments very often share the same
+   schedule parameters, so rather than regenerating the dates for
+   each one the schedules are generated once and shared. When the
+   cache is full the least recently used schedule is dropped.
+*/
+
+#define RQ_SCHEDULE_CACHE_DEFAULT_MAX_SIZE 4096
+
+typedef struct rq_schedule_cache {
+    rq_tree_rb_t schedules;
+    unsigned long max_size;
+    struct rq_schedule *lru_head; /**< most recently used */
+    struct rq_schedule *lru_tail; /**< least recently used */
+    unsigned long hits;
+    unsigned long misses;
+    rq_mutex_t mutex; /**< lets pricing threads share the cache */
+} *rq_schedule_cache_t;
+
+
+/** Test whether the rq_schedule_cache is NULL */
+RQ_EXPORT int rq_schedule_cache_is_null(rq_schedule_cache_t obj);
+
+/** Allocate a schedule cache holding at most max_size schedules.
+ */
+RQ_EXPORT rq_schedule_cache_t rq_schedule_cache_alloc(unsigned long max_size);
+
+/** Free the schedule cache. Schedules still referenced elsewhere stay
+ * valid until they are freed.
+ */
+RQ_EXPORT void rq_schedule_cache_free(rq_schedule_cache_t cache);
+
+/** Get the schedule for a set of parameters, generating it if it
+ * isn't in the cache. The caller gets a reference to the schedule
+ * and must call rq_schedule_free() when finished with it. The cache
+ * is locked, so this may be called from many threads at once.
+ */
+RQ_EXPORT rq_schedule_t rq_schedule_cache_get(rq_schedule_cache_t cache, const struct rq_schedule_params *params);
+
+/** Remove all the schedules from the cache. This must be called if
+ * a calendar the schedules were generated with changes or is freed.
+ */
+RQ_EXPORT void rq_schedule_cache_clear(rq_schedule_cache_t cache);
+
+/** Get the number of schedules in the cache. */
+RQ_EXPORT unsigned long rq_schedule_cache_size(const rq_schedule_cache_t cache);
+
+#ifdef __cplusplus
+#if 0
+{ // purely to not screw up my indenting...
+#endif
+};
+#endif
+
+#endif
@@ -61,5 +61,5 @@ RQ_EXPORT void
 rq_settlement_information_free(struct rq_settlement_information *p)
 {
     rq_settlement_information_clear(p);
-    free(p);
+    RQ_FREE(p);
 }
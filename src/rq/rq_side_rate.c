@@ -39,23 +39,23 @@ rq_side_rate_clear(struct rq_side_rate *p)
 {
     if (p->currency)
     {
-        free((char *)p->currency);
+        RQ_FREE((char *)p->currency);
         p->currency = NULL;
     }
     if (p->side_rate_basis)
     {
-        free((char *)p->side_rate_basis);
+        RQ_FREE((char *)p->side_rate_basis);
         p->side_rate_basis = NULL;
     }
     p->rate = 0;
     if (p->spot_rate)
     {
-        free((char *)p->spot_rate);
+        RQ_FREE((char *)p->spot_rate);
         p->spot_rate = NULL;
     }
     if (p->forward_points)
     {
-        free((char *)p->forward_points);
+        RQ_FREE((char *)p->forward_points);
         p->forward_points = NULL;
     }
 }
@@ -90,5 +90,5 @@ RQ_EXPORT void
 rq_side_rate_free(struct rq_side_rate *p)
 {
     rq_side_rate_clear(p);
-    free(p);
+    RQ_FREE(p);
 }
@@ -64,5 +64,5 @@ RQ_EXPORT void
 rq_side_rates_free(struct rq_side_rates *p)
 {
     rq_side_rates_clear(p);
-    free(p);
+    RQ_FREE(p);
 }
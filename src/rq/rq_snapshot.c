@@ -0,0 +1,989 @@
+/*
+** rq_snapshot.c
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#include "rq_snapshot.h"
+#include "rq_error.h"
+#include "rq_stream_mmap.h"
+#include "rq_tree_rb.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define NUM_SECTION_TYPES (RQ_SNAPSHOT_SECTION_VOLATILITIES + 1)
+
+/* Sections are padded out to this. */
+#define SECTION_ALIGNMENT 8
+#define ALIGN(n) (((n) + SECTION_ALIGNMENT - 1) & ~(SECTION_ALIGNMENT - 1))
+
+/* The record size of each section type, 1 for byte sections. */
+static const unsigned int record_sizes[NUM_SECTION_TYPES] = {
+    0,
+    1,
+    sizeof(struct rq_snapshot_system),
+    sizeof(struct rq_snapshot_calendar),
+    sizeof(struct rq_snapshot_date_event),
+    sizeof(struct rq_snapshot_termstruct_mapping),
+    sizeof(struct rq_snapshot_market),
+    sizeof(struct rq_snapshot_rate),
+    sizeof(struct rq_snapshot_yield_curve),
+    sizeof(struct rq_snapshot_discount_factor),
+    RQ_FACTOR_CACHE_SIZE * sizeof(double),
+    sizeof(struct rq_snapshot_forward_curve),
+    sizeof(struct rq_snapshot_forward_rate),
+    sizeof(struct rq_snapshot_exchange_rate),
+    sizeof(unsigned int),
+    sizeof(struct rq_snapshot_spot_price),
+    sizeof(struct rq_snapshot_vol_surface),
+    sizeof(struct rq_snapshot_vol_curve),
+    sizeof(struct rq_snapshot_volatility)
+};
+
+/* -- writing ------------------------------------------------------ */
+
+struct snapshot_buffer {
+    char *data;
+    unsigned int len;
+    unsigned int max_len;
+    unsigned int num_records;
+};
+
+struct snapshot_writer {
+    struct snapshot_buffer sections[NUM_SECTION_TYPES];
+};
+
+/* Append len zeroed bytes to a section, counting them as
+   num_records records, and return them. */
+static void *
+append_bytes(struct snapshot_writer *w, enum rq_snapshot_section_type section_type, unsigned int len, unsigned int num_records)
+{
+    struct snapshot_buffer *b = &w->sections[section_type];
+    void *rec;
+
+    if (b->len + len > b->max_len)
+    {
+        b->max_len = (b->max_len ? b->max_len * 2 : 1024);
+        if (b->max_len < b->len + len)
+            b->max_len = b->len + len;
+        b->data = (char *)RQ_REALLOC(b->data, b->max_len);
+    }
+
+    rec = b->data + b->len;
+    memset(rec, 0, len);
+    b->len += len;
+    b->num_records += num_records;
+
+    return rec;
+}
+
+static void *
+append_record(struct snapshot_writer *w, enum rq_snapshot_section_type section_type)
+{
+    return append_bytes(w, section_type, record_sizes[section_type], 1);
+}
+
+static unsigned int
+add_string(struct snapshot_writer *w, const char *s)
+{
+    unsigned int ref;
+    unsigned int len;
+
+    if (!s)
+        return RQ_SNAPSHOT_NULL_STRING;
+
+    ref = w->sections[RQ_SNAPSHOT_SECTION_STRINGS].len;
+    len = strlen(s) + 1;
+    memcpy(append_bytes(w, RQ_SNAPSHOT_SECTION_STRINGS, len, len), s, len);
+
+    return ref;
+}
+
+static void
+write_calendars(struct snapshot_writer *w, rq_calendar_mgr_t calendar_mgr)
+{
+    rq_tree_rb_iterator_t it = rq_tree_rb_iterator_alloc();
+
+    rq_calendar_mgr_load_pending(calendar_mgr);
+    for (rq_tree_rb_begin(calendar_mgr->calendars, it); !rq_tree_rb_at_end(it); rq_tree_rb_next(it))
+    {
+        rq_calendar_t cal = (rq_calendar_t)rq_tree_rb_iterator_deref(it);
+        struct rq_snapshot_calendar *rec = (struct rq_snapshot_calendar *)
+            append_record(w, RQ_SNAPSHOT_SECTION_CALENDARS);
+        unsigned int i;
+
+        rec->id = add_string(w, rq_calendar_get_id(cal));
+        rec->calendar_type = cal->calendar_type;
+        rec->weekend_mask = cal->weekend_mask;
+        rec->first_event = w->sections[RQ_SNAPSHOT_SECTION_DATE_EVENTS].num_records;
+        rec->num_events = cal->num_date_events;
+        rec->num_composites = (cal->num_composites < 5 ? cal->num_composites : 5);
+        for (i = 0; i < rec->num_composites; i++)
+            rec->composite_ids[i] = add_string(w, rq_calendar_get_id(cal->base_calendars[i]));
+
+        for (i = 0; i < cal->num_date_events; i++)
+        {
+            struct rq_snapshot_date_event *ev = (struct rq_snapshot_date_event *)
+                append_record(w, RQ_SNAPSHOT_SECTION_DATE_EVENTS);
+            ev->date = (int)cal->date_events[i].date;
+            ev->event_mask = (int)cal->date_events[i].event_mask;
+        }
+    }
+
+    rq_tree_rb_iterator_free(it);
+}
+
+static void
+write_termstruct_mapping(void *user_data, rq_termstruct_mapping_t mapping)
+{
+    struct snapshot_writer *w = (struct snapshot_writer *)user_data;
+    struct rq_snapshot_termstruct_mapping *rec = (struct rq_snapshot_termstruct_mapping *)
+        append_record(w, RQ_SNAPSHOT_SECTION_TERMSTRUCT_MAPPINGS);
+
+    rec->asset_id = add_string(w, mapping->asset_id);
+    rec->termstruct_group_id = add_string(w, mapping->termstruct_group_id);
+    rec->curve_id = add_string(w, mapping->curve_id);
+}
+
+static void
+write_system(struct snapshot_writer *w, rq_system_t system)
+{
+    rq_calendar_mgr_t calendar_mgr = rq_system_get_calendar_mgr(system);
+    struct rq_snapshot_system *rec = (struct rq_snapshot_system *)
+        append_record(w, RQ_SNAPSHOT_SECTION_SYSTEM);
+
+    rec->horizon_start = (int)calendar_mgr->horizon_start;
+    rec->horizon_end = (int)calendar_mgr->horizon_end;
+
+    write_calendars(w, calendar_mgr);
+
+    rq_termstruct_mapping_mgr_traverse(
+        rq_system_get_termstruct_mapping_mgr(system),
+        w,
+        write_termstruct_mapping
+        );
+}
+
+static void
+write_rates(struct snapshot_writer *w, rq_rate_mgr_t rate_mgr)
+{
+    rq_rate_mgr_iterator_t it = rq_rate_mgr_iterator_alloc();
+
+    for (rq_rate_mgr_begin(rate_mgr, it); !rq_rate_mgr_at_end(it); rq_rate_mgr_next(it))
+    {
+        rq_rate_t rate = rq_rate_mgr_iterator_deref(it);
+        struct rq_snapshot_rate *rec = (struct rq_snapshot_rate *)
+            append_record(w, RQ_SNAPSHOT_SECTION_RATES);
+
+        rec->rate_class_id = add_string(w, rq_rate_get_rate_class_id(rate));
+        rec->asset_id = add_string(w, rq_rate_get_asset_id(rate));
+        rec->rate_type = rq_rate_get_rate_type(rate);
+        rec->observation_date = (int)rq_rate_get_observation_date(rate);
+        rec->value_date = (int)rq_rate_get_value_date(rate);
+        rec->value = rq_rate_get_unperturbed_value(rate);
+    }
+
+    rq_rate_mgr_iterator_free(it);
+}
+
+static void
+write_yield_curves(struct snapshot_writer *w, rq_yield_curve_mgr_t yield_curve_mgr)
+{
+    rq_yield_curve_mgr_iterator_t it = rq_yield_curve_mgr_iterator_alloc();
+
+    for (rq_yield_curve_mgr_begin(yield_curve_mgr, it); !rq_yield_curve_mgr_at_end(it); rq_yield_curve_mgr_next(it))
+    {
+        rq_yield_curve_t yc = rq_yield_curve_mgr_iterator_deref(it);
+        struct rq_snapshot_yield_curve *rec = (struct rq_snapshot_yield_curve *)
+            append_record(w, RQ_SNAPSHOT_SECTION_YIELD_CURVES);
+        unsigned int i;
+
+        rec->curve_id = add_string(w, rq_yield_curve_get_curve_id(yc));
+        rec->underlying_asset_id = add_string(w, rq_yield_curve_get_underlying_asset_id(yc));
+        rec->yield_curve_type = yc->yield_curve_type;
+        rec->interpolation_method = yc->interpolation_method;
+        rec->start_extrapolation_method = yc->curve_start_extrapolation_method;
+        rec->end_extrapolation_method = yc->curve_end_extrapolation_method;
+        rec->zero_method = yc->zero_method;
+        rec->zero_method_compound_frequency = yc->zero_method_compound_frequency;
+        rec->default_day_count_convention = yc->default_day_count_convention;
+        rec->day_count_calendar_id = add_string(w, yc->day_count_calendar ? rq_calendar_get_id(yc->day_count_calendar) : NULL);
+        rec->base_curve_id = add_string(w, yc->base_curve ? rq_yield_curve_get_curve_id(yc->base_curve) : NULL);
+        rec->spread_curve_id = add_string(w, yc->spread_curve ? rq_yield_curve_get_curve_id(yc->spread_curve) : NULL);
+        rec->from_date = (int)yc->from_date;
+        rec->additive_factor = yc->additive_factor;
+        rec->multiplicative_factor = yc->multiplicative_factor;
+
+        rec->first_factor = w->sections[RQ_SNAPSHOT_SECTION_DISCOUNT_FACTORS].num_records;
+        rec->num_factors = yc->num_factors;
+        for (i = 0; i < yc->num_factors; i++)
+        {
+            struct rq_snapshot_discount_factor *df = (struct rq_snapshot_discount_factor *)
+                append_record(w, RQ_SNAPSHOT_SECTION_DISCOUNT_FACTORS);
+            df->date = (int)yc->discount_factors[i].date;
+            df->discount_factor = yc->discount_factors[i].discount_factor;
+        }
+
+        if (yc->factor_cache_size)
+            rec->flags |= RQ_SNAPSHOT_YIELD_CURVE_CACHED;
+        if (yc->frozen)
+        {
+            rec->flags |= RQ_SNAPSHOT_YIELD_CURVE_FROZEN;
+            rec->factor_cache = w->sections[RQ_SNAPSHOT_SECTION_FACTOR_CACHES].num_records;
+            memcpy(append_record(w, RQ_SNAPSHOT_SECTION_FACTOR_CACHES), yc->factor_cache, sizeof(yc->factor_cache));
+        }
+    }
+
+    rq_yield_curve_mgr_iterator_free(it);
+}
+
+static void
+write_forward_curves(struct snapshot_writer *w, rq_forward_curve_mgr_t forward_curve_mgr)
+{
+    rq_forward_curve_mgr_iterator_t it = rq_forward_curve_mgr_iterator_alloc();
+
+    for (rq_forward_curve_mgr_begin(forward_curve_mgr, it); !rq_forward_curve_mgr_at_end(it); rq_forward_curve_mgr_next(it))
+    {
+        rq_forward_curve_t fc = rq_forward_curve_mgr_iterator_deref(it);
+        struct rq_snapshot_forward_curve *rec = (struct rq_snapshot_forward_curve *)
+            append_record(w, RQ_SNAPSHOT_SECTION_FORWARD_CURVES);
+        unsigned int i;
+
+        rec->curve_id = add_string(w, rq_forward_curve_get_curve_id(fc));
+        rec->underlying_asset_id = add_string(w, rq_forward_curve_get_underlying_asset_id(fc));
+        rec->first_rate = w->sections[RQ_SNAPSHOT_SECTION_FORWARD_RATES].num_records;
+        rec->num_rates = fc->num_forward_rates;
+
+        for (i = 0; i < fc->num_forward_rates; i++)
+        {
+            struct rq_snapshot_forward_rate *fr = (struct rq_snapshot_forward_rate *)
+                append_record(w, RQ_SNAPSHOT_SECTION_FORWARD_RATES);
+            fr->date = (int)fc->forward_rates[i].date;
+            fr->quote = fc->forward_rates[i].quote;
+            fr->rate = fc->forward_rates[i].rate;
+        }
+    }
+
+    rq_forward_curve_mgr_iterator_free(it);
+}
+
+static void
+write_exchange_rates(struct snapshot_writer *w, rq_exchange_rate_mgr_t exchange_rate_mgr)
+{
+    rq_exchange_rate_mgr_iterator_t it = rq_exchange_rate_mgr_iterator_alloc();
+    struct rq_exchange_rate_cross_thru_node *n;
+
+    for (rq_exchange_rate_mgr_begin(exchange_rate_mgr, it); !rq_exchange_rate_mgr_at_end(it); rq_exchange_rate_mgr_next(it))
+    {
+        rq_exchange_rate_t er = rq_exchange_rate_mgr_iterator_deref(it);
+        struct rq_snapshot_exchange_rate *rec = (struct rq_snapshot_exchange_rate *)
+            append_record(w, RQ_SNAPSHOT_SECTION_EXCHANGE_RATES);
+
+        strncpy(rec->ccy_code_from, rq_exchange_rate_get_ccy_code_from(er), 3);
+        strncpy(rec->ccy_code_to, rq_exchange_rate_get_ccy_code_to(er), 3);
+        rec->exchange_rate = rq_exchange_rate_get_exchange_rate(er);
+    }
+
+    rq_exchange_rate_mgr_iterator_free(it);
+
+    for (n = exchange_rate_mgr->cross_thru_node; n; n = n->next)
+    {
+        unsigned int ref = add_string(w, n->ccy_code);
+        *(unsigned int *)append_record(w, RQ_SNAPSHOT_SECTION_CROSS_THRU_CCYS) = ref;
+    }
+}
+
+static void
+write_spot_prices(struct snapshot_writer *w, rq_spot_price_mgr_t spot_price_mgr)
+{
+    rq_tree_rb_iterator_t type_it = rq_tree_rb_iterator_alloc();
+    rq_tree_rb_iterator_t price_it = rq_tree_rb_iterator_alloc();
+
+    for (rq_tree_rb_begin(spot_price_mgr->asset_types, type_it); !rq_tree_rb_at_end(type_it); rq_tree_rb_next(type_it))
+    {
+        struct rq_spot_price_mgr_node *node = (struct rq_spot_price_mgr_node *)
+            rq_tree_rb_iterator_deref(type_it);
+
+        for (rq_tree_rb_begin(node->prices, price_it); !rq_tree_rb_at_end(price_it); rq_tree_rb_next(price_it))
+        {
+            rq_spot_price_t spot_price = (rq_spot_price_t)rq_tree_rb_iterator_deref(price_it);
+            struct rq_snapshot_spot_price *rec = (struct rq_snapshot_spot_price *)
+                append_record(w, RQ_SNAPSHOT_SECTION_SPOT_PRICES);
+
+            rec->asset_type_id = add_string(w, node->asset_type_id);
+            rec->asset_id = add_string(w, rq_spot_price_get_asset_id(spot_price));
+            rec->price = rq_spot_price_get_price(spot_price);
+        }
+    }
+
+    rq_tree_rb_iterator_free(price_it);
+    rq_tree_rb_iterator_free(type_it);
+}
+
+static void
+write_vol_surfaces(struct snapshot_writer *w, rq_vol_surface_mgr_t vol_surface_mgr)
+{
+    rq_vol_surface_mgr_iterator_t it = rq_vol_surface_mgr_iterator_alloc();
+
+    for (rq_vol_surface_mgr_begin(vol_surface_mgr, it); !rq_vol_surface_mgr_at_end(it); rq_vol_surface_mgr_next(it))
+    {
+        rq_vol_surface_t vs = rq_vol_surface_mgr_iterator_deref(it);
+        struct rq_snapshot_vol_surface *rec = (struct rq_snapshot_vol_surface *)
+            append_record(w, RQ_SNAPSHOT_SECTION_VOL_SURFACES);
+        unsigned int i;
+
+        rec->surface_id = add_string(w, rq_vol_surface_get_termstruct_id(vs));
+        rec->underlying_asset_id = add_string(w, rq_vol_surface_get_underlying_asset_id(vs));
+        rec->is_strike_vol = rq_vol_surface_is_strike_vol(vs);
+        rec->first_curve = w->sections[RQ_SNAPSHOT_SECTION_VOL_CURVES].num_records;
+        rec->num_curves = rq_vol_surface_count(vs);
+
+        for (i = 0; i < rec->num_curves; i++)
+        {
+            rq_vol_curve_t vc = rq_vol_surface_element_at(vs, i);
+            struct rq_snapshot_vol_curve *crec = (struct rq_snapshot_vol_curve *)
+                append_record(w, RQ_SNAPSHOT_SECTION_VOL_CURVES);
+            unsigned int j;
+
+            crec->delta_or_strike = rq_vol_surface_delta_at(vs, i);
+            crec->first_vol = w->sections[RQ_SNAPSHOT_SECTION_VOLATILITIES].num_records;
+            crec->num_vols = rq_vol_curve_count(vc);
+
+            for (j = 0; j < crec->num_vols; j++)
+            {
+                const struct rq_volatility *v = rq_vol_curve_element_at(vc, j);
+                struct rq_snapshot_volatility *vrec = (struct rq_snapshot_volatility *)
+                    append_record(w, RQ_SNAPSHOT_SECTION_VOLATILITIES);
+
+                vrec->date = (int)v->date;
+                vrec->vol = v->vol;
+            }
+        }
+    }
+
+    rq_vol_surface_mgr_iterator_free(it);
+}
+
+static void
+write_market(struct snapshot_writer *w, rq_market_t market)
+{
+    struct rq_snapshot_market *rec = (struct rq_snapshot_market *)
+        append_record(w, RQ_SNAPSHOT_SECTION_MARKET);
+
+    rec->market_date = (int)rq_market_get_market_date(market);
+
+    write_rates(w, rq_market_get_rate_mgr(market));
+    write_yield_curves(w, rq_market_get_yield_curve_mgr(market));
+    write_forward_curves(w, rq_market_get_forward_curve_mgr(market));
+    write_vol_surfaces(w, rq_market_get_vol_surface_mgr(market));
+    write_exchange_rates(w, rq_market_get_exchange_rate_mgr(market));
+    write_spot_prices(w, rq_market_get_spot_price_mgr(market));
+}
+
+static int
+write_padding(rq_stream_t stream, unsigned int len)
+{
+    static const char zeros[SECTION_ALIGNMENT] = { 0 };
+
+    if (len == 0)
+        return 0;
+    return rq_stream_write(stream, zeros, len);
+}
+
+RQ_EXPORT rq_error_code
+rq_snapshot_write(rq_stream_t stream, const rq_system_t system, const rq_market_t market)
+{
+    struct snapshot_writer w;
+    struct rq_snapshot_header header;
+    struct rq_snapshot_section table[NUM_SECTION_TYPES];
+    unsigned int num_sections = 0;
+    unsigned int offset;
+    unsigned int i;
+    rq_error_code err = RQ_OK;
+
+    memset(&w, 0, sizeof(w));
+
+    /* string reference 0 is NULL */
+    append_bytes(&w, RQ_SNAPSHOT_SECTION_STRINGS, 1, 1);
+
+    if (system)
+        write_system(&w, system);
+    if (market)
+        write_market(&w, market);
+
+    for (i = 1; i < NUM_SECTION_TYPES; i++)
+        if (w.sections[i].len)
+            num_sections++;
+
+    offset = ALIGN(sizeof(header) + num_sections * sizeof(struct rq_snapshot_section));
+    num_sections = 0;
+    for (i = 1; i < NUM_SECTION_TYPES; i++)
+    {
+        if (w.sections[i].len)
+        {
+            table[num_sections].section_type = i;
+            table[num_sections].num_records = w.sections[i].num_records;
+            table[num_sections].offset = offset;
+            table[num_sections].length = w.sections[i].len;
+            offset += ALIGN(w.sections[i].len);
+            num_sections++;
+        }
+    }
+
+    memcpy(header.magic, RQ_SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version = RQ_SNAPSHOT_VERSION;
+    header.byte_order = RQ_SNAPSHOT_BYTE_ORDER;
+    header.num_sections = num_sections;
+    header.file_size = offset;
+
+    if (rq_stream_write(stream, (const char *)&header, sizeof(header)) < 0 ||
+        rq_stream_write(stream, (const char *)table, num_sections * sizeof(struct rq_snapshot_section)) < 0 ||
+        write_padding(stream, table[0].offset - sizeof(header) - num_sections * sizeof(struct rq_snapshot_section)) < 0)
+        err = RQ_FAILED;
+
+    for (i = 0; i < num_sections && err == RQ_OK; i++)
+    {
+        struct snapshot_buffer *b = &w.sections[table[i].section_type];
+
+        if (rq_stream_write(stream, b->data, b->len) < 0 ||
+            write_padding(stream, ALIGN(b->len) - b->len) < 0)
+            err = RQ_FAILED;
+    }
+
+    for (i = 0; i < NUM_SECTION_TYPES; i++)
+        if (w.sections[i].data)
+            RQ_FREE(w.sections[i].data);
+
+    return err;
+}
+
+/* -- reading ------------------------------------------------------ */
+
+struct snapshot_reader {
+    const char *sections[NUM_SECTION_TYPES];
+    unsigned int num_records[NUM_SECTION_TYPES];
+};
+
+static const char *
+get_string(const struct snapshot_reader *r, unsigned int ref)
+{
+    if (ref == RQ_SNAPSHOT_NULL_STRING || ref >= r->num_records[RQ_SNAPSHOT_SECTION_STRINGS])
+        return NULL;
+    return r->sections[RQ_SNAPSHOT_SECTION_STRINGS] + ref;
+}
+
+#define RECORDS(r, type, section_type) ((const struct type *)(r)->sections[section_type])
+
+/* Is [first, first + num) inside the section? */
+static short
+in_range(const struct snapshot_reader *r, enum rq_snapshot_section_type section_type, unsigned int first, unsigned int num)
+{
+    return first <= r->num_records[section_type] && num <= r->num_records[section_type] - first;
+}
+
+/* Is the reference either null or a string in the strings section? */
+static short
+optional_string(const struct snapshot_reader *r, unsigned int ref)
+{
+    return ref == RQ_SNAPSHOT_NULL_STRING || get_string(r, ref) != NULL;
+}
+
+/* Does the reference name one of the yield curves in the snapshot? */
+static short
+is_yield_curve_id(const struct snapshot_reader *r, unsigned int ref)
+{
+    const struct rq_snapshot_yield_curve *recs = RECORDS(r, rq_snapshot_yield_curve, RQ_SNAPSHOT_SECTION_YIELD_CURVES);
+    const char *curve_id = get_string(r, ref);
+    unsigned int i;
+
+    for (i = 0; curve_id && i < r->num_records[RQ_SNAPSHOT_SECTION_YIELD_CURVES]; i++)
+        if (!strcmp(get_string(r, recs[i].curve_id), curve_id))
+            return 1;
+    return 0;
+}
+
+/* Check the header, the section table, the indexes between sections
+   and the string references, so that loading can trust them. */
+static rq_error_code
+snapshot_reader_init(struct snapshot_reader *r, const char *buffer, unsigned long buffer_len)
+{
+    const struct rq_snapshot_header *header = (const struct rq_snapshot_header *)buffer;
+    const struct rq_snapshot_section *table;
+    unsigned int i;
+
+    memset(r, 0, sizeof(*r));
+
+    if (buffer_len < sizeof(*header) || memcmp(header->magic, RQ_SNAPSHOT_MAGIC, sizeof(header->magic)))
+        return RQ_ERR_SNAPSHOT_BAD_FORMAT;
+    if (header->byte_order != RQ_SNAPSHOT_BYTE_ORDER || header->version > RQ_SNAPSHOT_VERSION)
+        return RQ_ERR_SNAPSHOT_VERSION;
+    if (header->file_size > buffer_len || header->file_size < sizeof(*header) ||
+        header->num_sections > (header->file_size - sizeof(*header)) / sizeof(struct rq_snapshot_section))
+        return RQ_ERR_SNAPSHOT_BAD_FORMAT;
+
+    table = (const struct rq_snapshot_section *)(buffer + sizeof(*header));
+    for (i = 0; i < header->num_sections; i++)
+    {
+        const struct rq_snapshot_section *s = &table[i];
+
+        if (s->offset % SECTION_ALIGNMENT || s->offset > header->file_size || s->length > header->file_size - s->offset)
+            return RQ_ERR_SNAPSHOT_BAD_FORMAT;
+
+        if (s->section_type > 0 && s->section_type < NUM_SECTION_TYPES)
+        {
+            if (s->length / record_sizes[s->section_type] != s->num_records ||
+                s->length % record_sizes[s->section_type])
+                return RQ_ERR_SNAPSHOT_BAD_FORMAT;
+
+            r->sections[s->section_type] = buffer + s->offset;
+            r->num_records[s->section_type] = s->num_records;
+        }
+    }
+
+    if (!r->num_records[RQ_SNAPSHOT_SECTION_STRINGS] ||
+        r->sections[RQ_SNAPSHOT_SECTION_STRINGS][r->num_records[RQ_SNAPSHOT_SECTION_STRINGS] - 1] != '\0')
+        return RQ_ERR_SNAPSHOT_BAD_FORMAT;
+
+    for (i = 0; i < r->num_records[RQ_SNAPSHOT_SECTION_CALENDARS]; i++)
+    {
+        const struct rq_snapshot_calendar *rec = &RECORDS(r, rq_snapshot_calendar, RQ_SNAPSHOT_SECTION_CALENDARS)[i];
+        if (!in_range(r, RQ_SNAPSHOT_SECTION_DATE_EVENTS, rec->first_event, rec->num_events) ||
+            rec->num_composites > MAX_COMPOSITE_CALENDAR_SIZE ||
+            !get_string(r, rec->id))
+            return RQ_ERR_SNAPSHOT_BAD_FORMAT;
+    }
+
+    for (i = 0; i < r->num_records[RQ_SNAPSHOT_SECTION_TERMSTRUCT_MAPPINGS]; i++)
+    {
+        const struct rq_snapshot_termstruct_mapping *rec = &RECORDS(r, rq_snapshot_termstruct_mapping, RQ_SNAPSHOT_SECTION_TERMSTRUCT_MAPPINGS)[i];
+        if (!get_string(r, rec->asset_id) || !get_string(r, rec->termstruct_group_id) || !get_string(r, rec->curve_id))
+            return RQ_ERR_SNAPSHOT_BAD_FORMAT;
+    }
+
+    for (i = 0; i < r->num_records[RQ_SNAPSHOT_SECTION_RATES]; i++)
+    {
+        const struct rq_snapshot_rate *rec = &RECORDS(r, rq_snapshot_rate, RQ_SNAPSHOT_SECTION_RATES)[i];
+        if (!get_string(r, rec->rate_class_id) || !get_string(r, rec->asset_id))
+            return RQ_ERR_SNAPSHOT_BAD_FORMAT;
+    }
+
+    for (i = 0; i < r->num_records[RQ_SNAPSHOT_SECTION_YIELD_CURVES]; i++)
+    {
+        const struct rq_snapshot_yield_curve *rec = &RECORDS(r, rq_snapshot_yield_curve, RQ_SNAPSHOT_SECTION_YIELD_CURVES)[i];
+        if (!get_string(r, rec->curve_id) ||
+            !in_range(r, RQ_SNAPSHOT_SECTION_DISCOUNT_FACTORS, rec->first_factor, rec->num_factors) ||
+            ((rec->flags & RQ_SNAPSHOT_YIELD_CURVE_FROZEN) && !in_range(r, RQ_SNAPSHOT_SECTION_FACTOR_CACHES, rec->factor_cache, 1)) ||
+            !optional_string(r, rec->underlying_asset_id) ||
+            !optional_string(r, rec->day_count_calendar_id))
+            return RQ_ERR_SNAPSHOT_BAD_FORMAT;
+    }
+
+    /* the composites are linked to curves in the same snapshot, so
+       these can only be checked once every curve id is known good */
+    for (i = 0; i < r->num_records[RQ_SNAPSHOT_SECTION_YIELD_CURVES]; i++)
+    {
+        const struct rq_snapshot_yield_curve *rec = &RECORDS(r, rq_snapshot_yield_curve, RQ_SNAPSHOT_SECTION_YIELD_CURVES)[i];
+        if ((rec->base_curve_id != RQ_SNAPSHOT_NULL_STRING && !is_yield_curve_id(r, rec->base_curve_id)) ||
+            (rec->spread_curve_id != RQ_SNAPSHOT_NULL_STRING && !is_yield_curve_id(r, rec->spread_curve_id)))
+            return RQ_ERR_SNAPSHOT_BAD_FORMAT;
+    }
+
+    for (i = 0; i < r->num_records[RQ_SNAPSHOT_SECTION_FORWARD_CURVES]; i++)
+    {
+        const struct rq_snapshot_forward_curve *rec = &RECORDS(r, rq_snapshot_forward_curve, RQ_SNAPSHOT_SECTION_FORWARD_CURVES)[i];
+        if (!get_string(r, rec->curve_id) || !get_string(r, rec->underlying_asset_id) ||
+            !in_range(r, RQ_SNAPSHOT_SECTION_FORWARD_RATES, rec->first_rate, rec->num_rates))
+            return RQ_ERR_SNAPSHOT_BAD_FORMAT;
+    }
+
+    for (i = 0; i < r->num_records[RQ_SNAPSHOT_SECTION_VOL_SURFACES]; i++)
+    {
+        const struct rq_snapshot_vol_surface *rec = &RECORDS(r, rq_snapshot_vol_surface, RQ_SNAPSHOT_SECTION_VOL_SURFACES)[i];
+        if (!get_string(r, rec->surface_id) || !optional_string(r, rec->underlying_asset_id) ||
+            !in_range(r, RQ_SNAPSHOT_SECTION_VOL_CURVES, rec->first_curve, rec->num_curves))
+            return RQ_ERR_SNAPSHOT_BAD_FORMAT;
+    }
+
+    for (i = 0; i < r->num_records[RQ_SNAPSHOT_SECTION_VOL_CURVES]; i++)
+    {
+        const struct rq_snapshot_vol_curve *rec = &RECORDS(r, rq_snapshot_vol_curve, RQ_SNAPSHOT_SECTION_VOL_CURVES)[i];
+        if (!in_range(r, RQ_SNAPSHOT_SECTION_VOLATILITIES, rec->first_vol, rec->num_vols))
+            return RQ_ERR_SNAPSHOT_BAD_FORMAT;
+    }
+
+    for (i = 0; i < r->num_records[RQ_SNAPSHOT_SECTION_SPOT_PRICES]; i++)
+    {
+        const struct rq_snapshot_spot_price *rec = &RECORDS(r, rq_snapshot_spot_price, RQ_SNAPSHOT_SECTION_SPOT_PRICES)[i];
+        if (!get_string(r, rec->asset_type_id) || !get_string(r, rec->asset_id))
+            return RQ_ERR_SNAPSHOT_BAD_FORMAT;
+    }
+
+    return RQ_OK;
+}
+
+static void
+read_calendars(const struct snapshot_reader *r, rq_calendar_mgr_t calendar_mgr)
+{
+    const struct rq_snapshot_calendar *recs = RECORDS(r, rq_snapshot_calendar, RQ_SNAPSHOT_SECTION_CALENDARS);
+    const struct rq_snapshot_date_event *events = RECORDS(r, rq_snapshot_date_event, RQ_SNAPSHOT_SECTION_DATE_EVENTS);
+    unsigned int num_calendars = r->num_records[RQ_SNAPSHOT_SECTION_CALENDARS];
+    unsigned int num_added = 0;
+    unsigned int i;
+    short progress = 1;
+
+    /* base calendars first, then the composites, which may be built
+       from other composites */
+    for (i = 0; i < num_calendars; i++)
+    {
+        if (recs[i].calendar_type == RQ_CALENDAR_TYPE_BASE)
+        {
+            rq_calendar_t cal = rq_calendar_alloc(get_string(r, recs[i].id));
+            unsigned int j;
+
+            cal->weekend_mask = (unsigned char)recs[i].weekend_mask;
+            for (j = 0; j < recs[i].num_events; j++)
+                rq_calendar_add_event(cal, events[recs[i].first_event + j].date, events[recs[i].first_event + j].event_mask);
+
+            rq_calendar_mgr_add(calendar_mgr, cal);
+            num_added++;
+        }
+    }
+
+    while (num_added < num_calendars && progress)
+    {
+        progress = 0;
+
+        for (i = 0; i < num_calendars; i++)
+        {
+            const char *id = get_string(r, recs[i].id);
+            rq_calendar_t bases[MAX_COMPOSITE_CALENDAR_SIZE];
+            unsigned int j;
+
+            if (recs[i].calendar_type == RQ_CALENDAR_TYPE_BASE || rq_calendar_mgr_get(calendar_mgr, id))
+                continue;
+
+            for (j = 0; j < recs[i].num_composites; j++)
+            {
+                const char *base_id = get_string(r, recs[i].composite_ids[j]);
+                if (!base_id || !(bases[j] = rq_calendar_mgr_get(calendar_mgr, base_id)))
+                    break;
+            }
+
+            if (j == recs[i].num_composites)
+            {
+                rq_calendar_t cal = rq_calendar_alloc_joint(id, bases, (unsigned short)j, calendar_mgr->horizon_start, calendar_mgr->horizon_end);
+
+                cal->weekend_mask = (unsigned char)recs[i].weekend_mask;
+                rq_calendar_mgr_add(calendar_mgr, cal);
+                num_added++;
+                progress = 1;
+            }
+        }
+    }
+}
+
+static void
+read_system(const struct snapshot_reader *r, rq_system_t system)
+{
+    const struct rq_snapshot_termstruct_mapping *mappings =
+        RECORDS(r, rq_snapshot_termstruct_mapping, RQ_SNAPSHOT_SECTION_TERMSTRUCT_MAPPINGS);
+    rq_calendar_mgr_t calendar_mgr = rq_system_get_calendar_mgr(system);
+    rq_termstruct_mapping_mgr_t termstruct_mapping_mgr = rq_system_get_termstruct_mapping_mgr(system);
+    unsigned int i;
+
+    rq_calendar_mgr_clear(calendar_mgr);
+    if (r->num_records[RQ_SNAPSHOT_SECTION_SYSTEM])
+    {
+        const struct rq_snapshot_system *rec = RECORDS(r, rq_snapshot_system, RQ_SNAPSHOT_SECTION_SYSTEM);
+        rq_calendar_mgr_set_horizon(calendar_mgr, rec->horizon_start, rec->horizon_end);
+    }
+
+    read_calendars(r, calendar_mgr);
+
+    for (i = 0; i < r->num_records[RQ_SNAPSHOT_SECTION_TERMSTRUCT_MAPPINGS]; i++)
+        rq_termstruct_mapping_mgr_add(
+            termstruct_mapping_mgr,
+            rq_termstruct_mapping_build(
+                get_string(r, mappings[i].asset_id),
+                get_string(r, mappings[i].termstruct_group_id),
+                get_string(r, mappings[i].curve_id)
+                )
+            );
+}
+
+static void
+read_yield_curves(const struct snapshot_reader *r, rq_market_t market, rq_system_t system)
+{
+    const struct rq_snapshot_yield_curve *recs = RECORDS(r, rq_snapshot_yield_curve, RQ_SNAPSHOT_SECTION_YIELD_CURVES);
+    const struct rq_snapshot_discount_factor *dfs = RECORDS(r, rq_snapshot_discount_factor, RQ_SNAPSHOT_SECTION_DISCOUNT_FACTORS);
+    const double *factor_caches = (const double *)r->sections[RQ_SNAPSHOT_SECTION_FACTOR_CACHES];
+    rq_yield_curve_mgr_t yield_curve_mgr = rq_market_get_yield_curve_mgr(market);
+    unsigned int num_curves = r->num_records[RQ_SNAPSHOT_SECTION_YIELD_CURVES];
+    unsigned int i;
+
+    for (i = 0; i < num_curves; i++)
+    {
+        const struct rq_snapshot_yield_curve *rec = &recs[i];
+        const char *calendar_id = get_string(r, rec->day_count_calendar_id);
+        rq_yield_curve_t yc = rq_yield_curve_init(
+            get_string(r, rec->curve_id),
+            (enum rq_interpolation_method)rec->interpolation_method,
+            (enum rq_extrapolation_method)rec->start_extrapolation_method,
+            (enum rq_extrapolation_method)rec->end_extrapolation_method,
+            (enum rq_zero_method)rec->zero_method,
+            rec->zero_method_compound_frequency,
+            (enum rq_day_count_convention)rec->default_day_count_convention,
+            rec->from_date
+            );
+        unsigned int j;
+
+        if (rec->underlying_asset_id != RQ_SNAPSHOT_NULL_STRING)
+            rq_yield_curve_set_underlying_asset_id(yc, get_string(r, rec->underlying_asset_id));
+        yc->yield_curve_type = (enum rq_yield_curve_type)rec->yield_curve_type;
+        yc->additive_factor = rec->additive_factor;
+        yc->multiplicative_factor = rec->multiplicative_factor;
+
+        for (j = 0; j < rec->num_factors; j++)
+            rq_yield_curve_set_discount_factor(yc, dfs[rec->first_factor + j].date, dfs[rec->first_factor + j].discount_factor);
+
+        if (calendar_id && system)
+            rq_yield_curve_set_day_count_calendar(yc, rq_calendar_mgr_get(rq_system_get_calendar_mgr(system), calendar_id));
+
+        if (rec->flags & RQ_SNAPSHOT_YIELD_CURVE_CACHED)
+            rq_yield_curve_cache_enable(yc);
+
+        rq_yield_curve_mgr_add(yield_curve_mgr, yc);
+    }
+
+    /* now every curve is in, link up the composites and restore the
+       caches of the frozen curves */
+    for (i = 0; i < num_curves; i++)
+    {
+        const struct rq_snapshot_yield_curve *rec = &recs[i];
+        rq_yield_curve_t yc = rq_yield_curve_mgr_get(yield_curve_mgr, get_string(r, rec->curve_id));
+        const char *base_curve_id = get_string(r, rec->base_curve_id);
+        const char *spread_curve_id = get_string(r, rec->spread_curve_id);
+
+        if (base_curve_id)
+            yc->base_curve = rq_yield_curve_mgr_get(yield_curve_mgr, base_curve_id);
+        if (spread_curve_id)
+            yc->spread_curve = rq_yield_curve_mgr_get(yield_curve_mgr, spread_curve_id);
+
+        if ((rec->flags & RQ_SNAPSHOT_YIELD_CURVE_FROZEN) && yc->factor_cache_size)
+        {
+            memcpy(yc->factor_cache, factor_caches + rec->factor_cache * RQ_FACTOR_CACHE_SIZE, sizeof(yc->factor_cache));
+            yc->frozen = 1;
+        }
+    }
+}
+
+static void
+read_vol_surfaces(const struct snapshot_reader *r, rq_market_t market)
+{
+    const struct rq_snapshot_vol_surface *recs = RECORDS(r, rq_snapshot_vol_surface, RQ_SNAPSHOT_SECTION_VOL_SURFACES);
+    const struct rq_snapshot_vol_curve *curves = RECORDS(r, rq_snapshot_vol_curve, RQ_SNAPSHOT_SECTION_VOL_CURVES);
+    const struct rq_snapshot_volatility *vols = RECORDS(r, rq_snapshot_volatility, RQ_SNAPSHOT_SECTION_VOLATILITIES);
+    unsigned int i;
+
+    for (i = 0; i < r->num_records[RQ_SNAPSHOT_SECTION_VOL_SURFACES]; i++)
+    {
+        rq_vol_surface_t vs = rq_vol_surface_alloc(get_string(r, recs[i].surface_id));
+        unsigned int j;
+
+        if (recs[i].underlying_asset_id != RQ_SNAPSHOT_NULL_STRING)
+            rq_vol_surface_set_underlying_asset_id(vs, get_string(r, recs[i].underlying_asset_id));
+        rq_vol_surface_set_is_strike_vol(vs, (unsigned short)recs[i].is_strike_vol);
+
+        /* a vol surface doesn't grow past the curves it was
+           allocated with */
+        for (j = 0; j < recs[i].num_curves && j < vs->max_curves; j++)
+        {
+            const struct rq_snapshot_vol_curve *crec = &curves[recs[i].first_curve + j];
+            rq_vol_curve_t vc = rq_vol_curve_alloc();
+            unsigned int k;
+
+            for (k = 0; k < crec->num_vols; k++)
+                rq_vol_curve_add(vc, vols[crec->first_vol + k].date, vols[crec->first_vol + k].vol);
+
+            rq_vol_surface_add(vs, crec->delta_or_strike, vc);
+        }
+
+        rq_vol_surface_mgr_add(rq_market_get_vol_surface_mgr(market), vs);
+    }
+}
+
+static void
+read_market(const struct snapshot_reader *r, rq_market_t market, rq_system_t system)
+{
+    const struct rq_snapshot_rate *rates = RECORDS(r, rq_snapshot_rate, RQ_SNAPSHOT_SECTION_RATES);
+    const struct rq_snapshot_forward_curve *fcs = RECORDS(r, rq_snapshot_forward_curve, RQ_SNAPSHOT_SECTION_FORWARD_CURVES);
+    const struct rq_snapshot_forward_rate *frs = RECORDS(r, rq_snapshot_forward_rate, RQ_SNAPSHOT_SECTION_FORWARD_RATES);
+    const struct rq_snapshot_exchange_rate *ers = RECORDS(r, rq_snapshot_exchange_rate, RQ_SNAPSHOT_SECTION_EXCHANGE_RATES);
+    const unsigned int *cross_thru_ccys = (const unsigned int *)r->sections[RQ_SNAPSHOT_SECTION_CROSS_THRU_CCYS];
+    const struct rq_snapshot_spot_price *sps = RECORDS(r, rq_snapshot_spot_price, RQ_SNAPSHOT_SECTION_SPOT_PRICES);
+    rq_exchange_rate_mgr_t exchange_rate_mgr = rq_market_get_exchange_rate_mgr(market);
+    unsigned int i;
+
+    rq_market_clear(market);
+    if (r->num_records[RQ_SNAPSHOT_SECTION_MARKET])
+        rq_market_set_market_date(market, RECORDS(r, rq_snapshot_market, RQ_SNAPSHOT_SECTION_MARKET)->market_date);
+
+    for (i = 0; i < r->num_records[RQ_SNAPSHOT_SECTION_RATES]; i++)
+        rq_rate_mgr_add(
+            rq_market_get_rate_mgr(market),
+            rq_rate_build(
+                get_string(r, rates[i].rate_class_id),
+                get_string(r, rates[i].asset_id),
+                (enum rq_rate_type)rates[i].rate_type,
+                rates[i].observation_date,
+                rates[i].value_date,
+                rates[i].value
+                )
+            );
+
+    read_yield_curves(r, market, system);
+
+    for (i = 0; i < r->num_records[RQ_SNAPSHOT_SECTION_FORWARD_CURVES]; i++)
+    {
+        rq_forward_curve_t fc = rq_forward_curve_build(
+            get_string(r, fcs[i].curve_id),
+            get_string(r, fcs[i].underlying_asset_id)
+            );
+        unsigned int j;
+
+        for (j = 0; j < fcs[i].num_rates; j++)
+        {
+            const struct rq_snapshot_forward_rate *fr = &frs[fcs[i].first_rate + j];
+            rq_forward_curve_set_rate(fc, fr->date, fr->rate, fr->quote);
+        }
+
+        rq_forward_curve_mgr_add(rq_market_get_forward_curve_mgr(market), fc);
+    }
+
+    read_vol_surfaces(r, market);
+
+    for (i = 0; i < r->num_records[RQ_SNAPSHOT_SECTION_EXCHANGE_RATES]; i++)
+    {
+        char from[4];
+        char to[4];
+
+        memcpy(from, ers[i].ccy_code_from, 3);
+        from[3] = '\0';
+        memcpy(to, ers[i].ccy_code_to, 3);
+        to[3] = '\0';
+        rq_exchange_rate_mgr_add(exchange_rate_mgr, from, to, ers[i].exchange_rate);
+    }
+
+    /* rq_market_clear() leaves the cross-through currencies alone */
+    for (i = 0; i < r->num_records[RQ_SNAPSHOT_SECTION_CROSS_THRU_CCYS]; i++)
+    {
+        const char *ccy_code = get_string(r, cross_thru_ccys[i]);
+        struct rq_exchange_rate_cross_thru_node *n;
+
+        for (n = exchange_rate_mgr->cross_thru_node; n && ccy_code; n = n->next)
+            if (!strcmp(n->ccy_code, ccy_code))
+                break;
+        if (ccy_code && !n)
+            rq_exchange_rate_mgr_add_cross_thru_ccy_code(exchange_rate_mgr, ccy_code);
+    }
+
+    for (i = 0; i < r->num_records[RQ_SNAPSHOT_SECTION_SPOT_PRICES]; i++)
+        rq_spot_price_mgr_add(
+            rq_market_get_spot_price_mgr(market),
+            get_string(r, sps[i].asset_type_id),
+            get_string(r, sps[i].asset_id),
+            sps[i].price
+            );
+}
+
+RQ_EXPORT rq_error_code
+rq_snapshot_read_buffer(const char *buffer, unsigned long buffer_len, rq_system_t system, rq_market_t market)
+{
+    struct snapshot_reader r;
+    rq_error_code err;
+
+    /* the records are read in place, so they need the alignment
+       the file has */
+    if ((unsigned long)buffer % SECTION_ALIGNMENT)
+    {
+        char *copy = (char *)RQ_MALLOC(buffer_len);
+
+        memcpy(copy, buffer, buffer_len);
+        err = rq_snapshot_read_buffer(copy, buffer_len, system, market);
+        RQ_FREE(copy);
+
+        return err;
+    }
+
+    err = snapshot_reader_init(&r, buffer, buffer_len);
+    if (err != RQ_OK)
+        return err;
+
+    if (system)
+        read_system(&r, system);
+    if (market)
+        read_market(&r, market, system);
+
+    return RQ_OK;
+}
+
+RQ_EXPORT rq_error_code
+rq_snapshot_read(rq_stream_t stream, rq_system_t system, rq_market_t market)
+{
+    const char *buffer;
+    unsigned long buffer_len;
+    char *data;
+    unsigned long len = 0;
+    unsigned long max_len = 65536;
+    int num_bytes_read;
+    rq_error_code err;
+
+    if (!rq_stream_is_open(stream))
+    {
+        err = rq_stream_open(stream);
+        if (err != RQ_OK)
+            return err;
+    }
+
+    buffer = rq_stream_mmap_get_buffer(stream, &buffer_len);
+    if (buffer)
+    {
+        long offset = rq_stream_tell(stream);
+        return rq_snapshot_read_buffer(buffer + offset, buffer_len - offset, system, market);
+    }
+
+    data = (char *)RQ_MALLOC(max_len);
+    do
+    {
+        if (len == max_len)
+        {
+            max_len *= 2;
+            data = (char *)RQ_REALLOC(data, max_len);
+        }
+
+        num_bytes_read = rq_stream_read(stream, data + len, (int)(max_len - len));
+        if (num_bytes_read > 0)
+            len += num_bytes_read;
+    }
+    while (num_bytes_read > 0);
+
+    err = rq_snapshot_read_buffer(data, len, system, market);
+    RQ_FREE(data);
+
+    return err;
+}
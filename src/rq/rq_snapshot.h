@@ -0,0 +1,282 @@
+/**
+ * @file
+ *
+ * A binary snapshot format for systems and markets
+ */
+/*
+** rq_snapshot.h
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#ifndef rq_snapshot_h
+#define rq_snapshot_h
+
+/* -- includes ----------------------------------------------------- */
+#include "rq_config.h"
+#include "rq_defs.h"
+#include "rq_stream.h"
+#include "rq_system.h"
+#include "rq_market.h"
+
+#ifdef __cplusplus
+extern "C" {
+#if 0
+} // purely to not screw up my indenting...
+#endif
+#endif
+
+/*
+ * A snapshot is a header, a table of sections and then the sections
+ * themselves, each starting on an 8 byte boundary. Everything is
+ * found by offset from the start of the file, so a snapshot can be
+ * read straight out of a memory-mapped file (see rq_stream_mmap.h)
+ * wherever it is mapped, and processes mapping the same file share
+ * the one copy in the page cache.
+ *
+ * Apart from the strings section every section is an array of one
+ * of the record structures below. Strings are referred to by their
+ * offset into the strings section, with 0 meaning NULL. Records are
+ * in the byte order of the machine that wrote them, which the
+ * header records, and use 32 bit ints and IEEE doubles.
+ *
+ * Readers skip section types they don't know, and anything after
+ * the header's file_size, so more can be appended to a snapshot
+ * file. A change to an existing record bumps RQ_SNAPSHOT_VERSION.
+ */
+
+/* -- defines ------------------------------------------------------ */
+#define RQ_SNAPSHOT_MAGIC "RQSNAP\r\n"
+#define RQ_SNAPSHOT_VERSION 1
+#define RQ_SNAPSHOT_BYTE_ORDER 0x01020304
+
+/** The string reference for NULL */
+#define RQ_SNAPSHOT_NULL_STRING 0
+
+/** Set on a yield curve that has its caches enabled */
+#define RQ_SNAPSHOT_YIELD_CURVE_CACHED 0x01
+/** Set on a frozen yield curve, whose factor cache is saved */
+#define RQ_SNAPSHOT_YIELD_CURVE_FROZEN 0x02
+
+enum rq_snapshot_section_type {
+    RQ_SNAPSHOT_SECTION_STRINGS = 1, /**< NUL terminated strings */
+    RQ_SNAPSHOT_SECTION_SYSTEM, /**< one rq_snapshot_system */
+    RQ_SNAPSHOT_SECTION_CALENDARS, /**< rq_snapshot_calendar */
+    RQ_SNAPSHOT_SECTION_DATE_EVENTS, /**< rq_snapshot_date_event */
+    RQ_SNAPSHOT_SECTION_TERMSTRUCT_MAPPINGS, /**< rq_snapshot_termstruct_mapping */
+    RQ_SNAPSHOT_SECTION_MARKET, /**< one rq_snapshot_market */
+    RQ_SNAPSHOT_SECTION_RATES, /**< rq_snapshot_rate */
+    RQ_SNAPSHOT_SECTION_YIELD_CURVES, /**< rq_snapshot_yield_curve */
+    RQ_SNAPSHOT_SECTION_DISCOUNT_FACTORS, /**< rq_snapshot_discount_factor */
+    RQ_SNAPSHOT_SECTION_FACTOR_CACHES, /**< RQ_FACTOR_CACHE_SIZE doubles per frozen curve */
+    RQ_SNAPSHOT_SECTION_FORWARD_CURVES, /**< rq_snapshot_forward_curve */
+    RQ_SNAPSHOT_SECTION_FORWARD_RATES, /**< rq_snapshot_forward_rate */
+    RQ_SNAPSHOT_SECTION_EXCHANGE_RATES, /**< rq_snapshot_exchange_rate */
+    RQ_SNAPSHOT_SECTION_CROSS_THRU_CCYS, /**< string references */
+    RQ_SNAPSHOT_SECTION_SPOT_PRICES, /**< rq_snapshot_spot_price */
+    RQ_SNAPSHOT_SECTION_VOL_SURFACES, /**< rq_snapshot_vol_surface */
+    RQ_SNAPSHOT_SECTION_VOL_CURVES, /**< rq_snapshot_vol_curve */
+    RQ_SNAPSHOT_SECTION_VOLATILITIES /**< rq_snapshot_volatility */
+};
+
+/* -- structs ----------------------------------------------------- */
+struct rq_snapshot_header {
+    char magic[8]; /**< RQ_SNAPSHOT_MAGIC */
+    unsigned int version; /**< RQ_SNAPSHOT_VERSION */
+    unsigned int byte_order; /**< RQ_SNAPSHOT_BYTE_ORDER as written */
+    unsigned int num_sections; /**< The number of entries in the section table that follows */
+    unsigned int file_size; /**< The length of the whole snapshot */
+};
+
+struct rq_snapshot_section {
+    unsigned int section_type; /**< an rq_snapshot_section_type */
+    unsigned int num_records;
+    unsigned int offset; /**< from the start of the snapshot */
+    unsigned int length; /**< in bytes */
+};
+
+struct rq_snapshot_system {
+    int horizon_start; /**< The calendar manager's horizon */
+    int horizon_end;
+};
+
+struct rq_snapshot_calendar {
+    unsigned int id;
+    unsigned int calendar_type;
+    unsigned int weekend_mask;
+    unsigned int first_event; /**< index into the date events */
+    unsigned int num_events;
+    unsigned int num_composites;
+    unsigned int composite_ids[5]; /**< MAX_COMPOSITE_CALENDAR_SIZE */
+    unsigned int reserved;
+};
+
+struct rq_snapshot_date_event {
+    int date;
+    int event_mask;
+};
+
+struct rq_snapshot_termstruct_mapping {
+    unsigned int asset_id;
+    unsigned int termstruct_group_id;
+    unsigned int curve_id;
+    unsigned int reserved;
+};
+
+struct rq_snapshot_market {
+    int market_date;
+    unsigned int reserved;
+};
+
+struct rq_snapshot_rate {
+    unsigned int rate_class_id;
+    unsigned int asset_id;
+    int rate_type;
+    int observation_date;
+    int value_date;
+    unsigned int reserved;
+    double value;
+};
+
+struct rq_snapshot_yield_curve {
+    unsigned int curve_id;
+    unsigned int underlying_asset_id;
+    unsigned int yield_curve_type;
+    unsigned int interpolation_method;
+    unsigned int start_extrapolation_method;
+    unsigned int end_extrapolation_method;
+    unsigned int zero_method;
+    unsigned int zero_method_compound_frequency;
+    unsigned int default_day_count_convention;
+    unsigned int day_count_calendar_id;
+    unsigned int base_curve_id;
+    unsigned int spread_curve_id;
+    int from_date;
+    unsigned int first_factor; /**< index into the discount factors */
+    unsigned int num_factors;
+    unsigned int flags; /**< RQ_SNAPSHOT_YIELD_CURVE_ flags */
+    unsigned int factor_cache; /**< index into the factor caches if frozen */
+    unsigned int reserved;
+    double additive_factor;
+    double multiplicative_factor;
+};
+
+struct rq_snapshot_discount_factor {
+    int date;
+    unsigned int reserved;
+    double discount_factor;
+};
+
+struct rq_snapshot_forward_curve {
+    unsigned int curve_id;
+    unsigned int underlying_asset_id;
+    unsigned int first_rate; /**< index into the forward rates */
+    unsigned int num_rates;
+};
+
+struct rq_snapshot_forward_rate {
+    int date;
+    int quote;
+    double rate;
+};
+
+struct rq_snapshot_exchange_rate {
+    char ccy_code_from[4];
+    char ccy_code_to[4];
+    double exchange_rate;
+};
+
+struct rq_snapshot_spot_price {
+    unsigned int asset_type_id;
+    unsigned int asset_id;
+    double price;
+};
+
+struct rq_snapshot_vol_surface {
+    unsigned int surface_id;
+    unsigned int underlying_asset_id;
+    unsigned int is_strike_vol;
+    unsigned int first_curve; /**< index into the vol curves */
+    unsigned int num_curves;
+    unsigned int reserved;
+};
+
+struct rq_snapshot_vol_curve {
+    double delta_or_strike;
+    unsigned int first_vol; /**< index into the volatilities */
+    unsigned int num_vols;
+};
+
+struct rq_snapshot_volatility {
+    int date;
+    unsigned int reserved;
+    double vol;
+};
+
+/* -- prototypes --------------------------------------------------- */
+/**
+ * Write a snapshot of a system and a market to a stream.
+ *
+ * The snapshot holds the system's calendars and term structure
+ * mappings, and the market's date, rates, yield curves, forward
+ * curves, vol surfaces, exchange rates and spot prices. Frozen yield curves keep
+ * their discount factor caches, so a market frozen before it's
+ * written comes back frozen.
+ *
+ * @param stream the stream to write to
+ * @param system the system to write, or NULL
+ * @param market the market to write, or NULL
+ * @return RQ_OK if successful, otherwise an error code
+ */
+RQ_EXPORT rq_error_code rq_snapshot_write(rq_stream_t stream, const rq_system_t system, const rq_market_t market);
+
+/**
+ * Load a snapshot held in memory.
+ *
+ * The calendars in the system's calendar manager are replaced and
+ * the term structure mappings are added to. The market is cleared
+ * and filled from the snapshot. A composite yield curve's base and
+ * spread curves, and a curve's day count calendar, are looked up
+ * by ID once everything is loaded, so the market should be loaded
+ * with the system it was written with.
+ *
+ * @param system the system to load into, or NULL to skip the system
+ * @param market the market to load into, or NULL to skip the market
+ * @return RQ_OK if successful, RQ_ERR_SNAPSHOT_BAD_FORMAT if the
+ * buffer isn't a valid snapshot or RQ_ERR_SNAPSHOT_VERSION if it
+ * was written by a later version or on a machine of the other
+ * byte order. Nothing is loaded if the snapshot isn't valid.
+ */
+RQ_EXPORT rq_error_code rq_snapshot_read_buffer(const char *buffer, unsigned long buffer_len, rq_system_t system, rq_market_t market);
+
+/**
+ * Load a snapshot from a stream. Memory-mapped streams are read in
+ * place, anything else is read into memory first.
+ *
+ * @see rq_snapshot_read_buffer
+ */
+RQ_EXPORT rq_error_code rq_snapshot_read(rq_stream_t stream, rq_system_t system, rq_market_t market);
+
+#ifdef __cplusplus
+#if 0
+{ // purely to not screw up my indenting...
+#endif
+};
+#endif
+
+#endif
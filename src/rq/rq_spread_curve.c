@@ -29,7 +29,7 @@
 #include <string.h>
 #include <math.h>
 
-static unsigned int s_max_spreads = RQ_SPREAD_CURVE_MAX_SPREADS;
+static const unsigned int s_max_spreads = RQ_SPREAD_CURVE_MAX_SPREADS;
 
 
 static struct rq_spread_curve *
@@ -142,7 +142,7 @@ rq_spread_curve_set_spread(rq_spread_curve_t ts, rq_date for_date, double spread
     {
         unsigned int new_max_spreads = ts->max_spreads * 2;
         ts->spreads = 
-            (struct rq_spread_curve_elem *) realloc(
+            (struct rq_spread_curve_elem *) RQ_REALLOC(
             ts->spreads, 
             new_max_spreads * sizeof(struct rq_spread_curve_elem)
             );
@@ -124,15 +124,62 @@ rq_statistics_mean_max_min(double *inputs, unsigned long num_inputs, double *mea
     return 0;
 }
 
+RQ_EXPORT short
+rq_statistics_covariance_matrix(const double * const *series, unsigned int num_series, unsigned long num_inputs, rq_matrix_t out)
+{
+    double *means;
+    unsigned int i;
+    unsigned int k;
+
+    if (num_inputs < 2 || out->rows != num_series || out->cols != num_series)
+        return 1;
+
+    means = (double *)RQ_CALLOC(num_series, sizeof(double));
+
+    for (i = 0; i < num_series; i++)
+        means[i] = rq_statistics_mean((double *)series[i], num_inputs);
+
+    /* two pass: each element is a dot product of two contiguous,
+       centred series */
+    for (i = 0; i < num_series; i++)
+    {
+        const double *si = series[i];
+        double mi = means[i];
+
+        for (k = 0; k <= i; k++)
+        {
+            const double *sk = series[k];
+            double mk = means[k];
+            double s0 = 0.0;
+            double s1 = 0.0;
+            unsigned long j;
+
+            for (j = 0; j + 2 <= num_inputs; j += 2)
+            {
+                s0 += (si[j] - mi) * (sk[j] - mk);
+                s1 += (si[j+1] - mi) * (sk[j+1] - mk);
+            }
+            for (; j < num_inputs; j++)
+                s0 += (si[j] - mi) * (sk[j] - mk);
+
+            s0 = (s0 + s1) / (double)(num_inputs - 1);
+
+            RQ_MATRIX_SET(out, i, k, s0);
+            RQ_MATRIX_SET(out, k, i, s0);
+        }
+    }
+
+    RQ_FREE(means);
+
+    return 0;
+}
+
 RQ_EXPORT rq_matrix_t
 rq_statistics_get_covariance_matrix(unsigned long num_inputs, unsigned num_series, ...)
 {
     rq_matrix_t mat = rq_matrix_build(num_series, num_series);
-    int i;
-    int j;
-    double *means = (double *)calloc(num_series, sizeof(double));
-    double *factors = (double *)calloc(num_series, sizeof(double));
-    double **series = (double **)calloc(num_series, sizeof(double *));
+    const double **series = (const double **)RQ_CALLOC(num_series, sizeof(double *));
+    unsigned i;
     va_list arglist;
 
     va_start(arglist, num_series);
@@ -140,64 +187,290 @@ rq_statistics_get_covariance_matrix(unsigned long num_inputs, unsigned num_serie
     for (i = 0; i < num_series; i++)
         series[i] = va_arg(arglist, double *);
 
-    /* calculate the means */
-    for (i = 0; i < num_series; i++)
-    {
-        double *s = series[i];
+    va_end(arglist);
+
+    rq_statistics_covariance_matrix(series, num_series, num_inputs, mat);
+
+    RQ_FREE(series);
 
-        for (j = 0; j < num_inputs; j++)
-            means[i] += s[j];
+    return mat;
+}
+
+/* -- running moments --------------------------------------------- */
+
+/* The number of values processed as a block by
+   rq_statistics_moments_add_array() */
+#define RQ_STATISTICS_MOMENTS_BLOCK 256
+
+RQ_EXPORT void
+rq_statistics_moments_init(struct rq_statistics_moments *m)
+{
+    memset(m, 0, sizeof(struct rq_statistics_moments));
+}
+
+RQ_EXPORT void
+rq_statistics_moments_add(struct rq_statistics_moments *m, double x)
+{
+    double n1 = (double)m->n;
+    double n;
+    double delta;
+    double delta_n;
+    double delta_n2;
+    double term1;
+
+    if (m->n == 0 || x < m->min)
+        m->min = x;
+    if (m->n == 0 || x > m->max)
+        m->max = x;
+
+    m->n++;
+    n = (double)m->n;
+    delta = x - m->mean;
+    delta_n = delta / n;
+    delta_n2 = delta_n * delta_n;
+    term1 = delta * delta_n * n1;
+
+    m->mean += delta_n;
+    m->m4 += term1 * delta_n2 * (n * n - 3.0 * n + 3.0) + 6.0 * delta_n2 * m->m2 - 4.0 * delta_n * m->m3;
+    m->m3 += term1 * delta_n * (n - 2.0) - 3.0 * delta_n * m->m2;
+    m->m2 += term1;
+}
+
+RQ_EXPORT void
+rq_statistics_moments_merge(struct rq_statistics_moments *dst, const struct rq_statistics_moments *src)
+{
+    double na = (double)dst->n;
+    double nb = (double)src->n;
+    double n;
+    double delta;
+    double delta2;
+    double m2;
+    double m3;
+    double m4;
+
+    if (src->n == 0)
+        return;
+    if (dst->n == 0)
+    {
+        *dst = *src;
+        return;
     }
 
-    for (i = 0; i < num_series; i++)
-        means[i] /= (double)(num_inputs - 1);
+    n = na + nb;
+    delta = src->mean - dst->mean;
+    delta2 = delta * delta;
+
+    m2 = dst->m2 + src->m2 + delta2 * na * nb / n;
+    m3 = dst->m3 + src->m3 
+        + delta2 * delta * na * nb * (na - nb) / (n * n)
+        + 3.0 * delta * (na * src->m2 - nb * dst->m2) / n;
+    m4 = dst->m4 + src->m4
+        + delta2 * delta2 * na * nb * (na * na - na * nb + nb * nb) / (n * n * n)
+        + 6.0 * delta2 * (na * na * src->m2 + nb * nb * dst->m2) / (n * n)
+        + 4.0 * delta * (na * src->m3 - nb * dst->m3) / n;
+
+    dst->mean += delta * nb / n;
+    dst->m2 = m2;
+    dst->m3 = m3;
+    dst->m4 = m4;
+    dst->n += src->n;
+    if (src->min < dst->min)
+        dst->min = src->min;
+    if (src->max > dst->max)
+        dst->max = src->max;
+}
+
+RQ_EXPORT void
+rq_statistics_moments_add_array(struct rq_statistics_moments *m, const double *inputs, unsigned long num_inputs)
+{
+    unsigned long start;
 
-    for (j = 0; j < num_inputs; j++)
+    /* Calculate exact central moments for each block with two
+       (vectorizable) passes, then merge the block into the running
+       totals. */
+    for (start = 0; start < num_inputs; start += RQ_STATISTICS_MOMENTS_BLOCK)
     {
-        for (i = 0; i < num_series; i++)
+        struct rq_statistics_moments block;
+        const double *x = inputs + start;
+        unsigned long len = num_inputs - start;
+        double sum = 0.0;
+        double mn = x[0];
+        double mx = x[0];
+        double s2 = 0.0;
+        double s3 = 0.0;
+        double s4 = 0.0;
+        unsigned long i;
+
+        if (len > RQ_STATISTICS_MOMENTS_BLOCK)
+            len = RQ_STATISTICS_MOMENTS_BLOCK;
+
+        for (i = 0; i < len; i++)
         {
-            double *s = series[i];
-            factors[i] = (s[j] - means[i]);
+            sum += x[i];
+            mn = (x[i] < mn ? x[i] : mn);
+            mx = (x[i] > mx ? x[i] : mx);
         }
 
-        for (i = 0; i < num_series; i++)
+        block.n = len;
+        block.mean = sum / (double)len;
+        block.min = mn;
+        block.max = mx;
+
+        for (i = 0; i < len; i++)
         {
-            int k;
+            double d = x[i] - block.mean;
+            double d2 = d * d;
+            s2 += d2;
+            s3 += d2 * d;
+            s4 += d2 * d2;
+        }
 
-            for (k = 0; k < num_series; k++)
-            {
-                double f = factors[i] * factors[k];
+        block.m2 = s2;
+        block.m3 = s3;
+        block.m4 = s4;
 
-                rq_matrix_set(
-                    mat, 
-                    i, k, 
-                    rq_matrix_get(mat, i, k) + f
-                    );
-            }
-        }
+        rq_statistics_moments_merge(m, &block);
     }
+}
 
+RQ_EXPORT double
+rq_statistics_moments_get_variance(const struct rq_statistics_moments *m)
+{
+    return (m->n > 1 ? m->m2 / (double)(m->n - 1) : 0.0);
+}
 
-    for (i = 0; i < num_series; i++)
+RQ_EXPORT double
+rq_statistics_moments_get_std_dev(const struct rq_statistics_moments *m)
+{
+    return sqrt(rq_statistics_moments_get_variance(m));
+}
+
+RQ_EXPORT double
+rq_statistics_moments_get_std_error(const struct rq_statistics_moments *m)
+{
+    return (m->n > 0 ? rq_statistics_moments_get_std_dev(m) / sqrt((double)m->n) : 0.0);
+}
+
+RQ_EXPORT double
+rq_statistics_moments_get_skewness(const struct rq_statistics_moments *m)
+{
+    if (m->m2 <= 0.0)
+        return 0.0;
+    return sqrt((double)m->n) * m->m3 / pow(m->m2, 1.5);
+}
+
+RQ_EXPORT double
+rq_statistics_moments_get_kurtosis(const struct rq_statistics_moments *m)
+{
+    if (m->m2 <= 0.0)
+        return 0.0;
+    return (double)m->n * m->m4 / (m->m2 * m->m2) - 3.0;
+}
+
+/* -- running covariances ----------------------------------------- */
+
+RQ_EXPORT rq_statistics_comoments_t
+rq_statistics_comoments_alloc(unsigned int num_series)
+{
+    struct rq_statistics_comoments *cm = (struct rq_statistics_comoments *)
+        RQ_CALLOC(1, sizeof(struct rq_statistics_comoments));
+
+    cm->num_series = num_series;
+    cm->mean = (double *)RQ_CALLOC(num_series, sizeof(double));
+    cm->work = (double *)RQ_CALLOC(num_series, sizeof(double));
+    cm->c = (double *)RQ_CALLOC(num_series * num_series, sizeof(double));
+
+    return cm;
+}
+
+RQ_EXPORT void
+rq_statistics_comoments_free(rq_statistics_comoments_t cm)
+{
+    RQ_FREE(cm->mean);
+    RQ_FREE(cm->work);
+    RQ_FREE(cm->c);
+    RQ_FREE(cm);
+}
+
+RQ_EXPORT void
+rq_statistics_comoments_add(rq_statistics_comoments_t cm, const double *x)
+{
+    unsigned int ns = cm->num_series;
+    double * RQ_RESTRICT d = cm->work;
+    double inv_n;
+    unsigned int i;
+
+    cm->n++;
+    inv_n = 1.0 / (double)cm->n;
+
+    /* d = x - old mean; then update the mean */
+    for (i = 0; i < ns; i++)
     {
-        int k;
+        d[i] = x[i] - cm->mean[i];
+        cm->mean[i] += d[i] * inv_n;
+    }
 
-        for (k = 0; k < num_series; k++)
-        {
-            rq_matrix_set(
-                mat, 
-                i, k, 
-                rq_matrix_get(mat, i, k) / (double)(num_inputs - 1)
-                );
-        }
+    /* C += d_old * (x - new mean)' = (1 - 1/n) * d * d' */
+    for (i = 0; i < ns; i++)
+    {
+        double * RQ_RESTRICT ci = cm->c + i * ns;
+        double di = d[i] * (1.0 - inv_n);
+        unsigned int k;
+
+        for (k = 0; k < ns; k++)
+            ci[k] += di * d[k];
     }
+}
+
+RQ_EXPORT short
+rq_statistics_comoments_merge(rq_statistics_comoments_t dst, const rq_statistics_comoments_t src)
+{
+    unsigned int ns = dst->num_series;
+    double na = (double)dst->n;
+    double nb = (double)src->n;
+    double f;
+    unsigned int i;
 
+    if (src->num_series != ns)
+        return 1;
+    if (src->n == 0)
+        return 0;
 
-    free(means);
-    free(factors);
-    free(series);
+    f = na * nb / (na + nb);
 
-    va_end(arglist);
+    for (i = 0; i < ns; i++)
+        dst->work[i] = src->mean[i] - dst->mean[i];
 
-    return mat;
+    for (i = 0; i < ns; i++)
+    {
+        double *ci = dst->c + i * ns;
+        const double *si = src->c + i * ns;
+        double di = dst->work[i] * f;
+        unsigned int k;
+
+        for (k = 0; k < ns; k++)
+            ci[k] += si[k] + di * dst->work[k];
+    }
+
+    for (i = 0; i < ns; i++)
+        dst->mean[i] += dst->work[i] * nb / (na + nb);
+
+    dst->n += src->n;
+
+    return 0;
+}
+
+RQ_EXPORT short
+rq_statistics_comoments_get_covariance_matrix(const rq_statistics_comoments_t cm, rq_matrix_t out)
+{
+    unsigned long nn = cm->num_series * cm->num_series;
+    unsigned long i;
+
+    if (out->rows != cm->num_series || out->cols != cm->num_series || cm->n < 2)
+        return 1;
+
+    for (i = 0; i < nn; i++)
+        out->vals[i] = cm->c[i] / (double)(cm->n - 1);
+
+    return 0;
 }
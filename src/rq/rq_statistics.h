@@ -40,6 +40,34 @@ extern "C" {
 #endif
 #endif
 
+/** Running moments of a stream of values.
+ *
+ * The moments are updated one value (or one block of values) at a
+ * time, so the full distribution never has to be held in memory.
+ * Accumulators filled by different threads can be combined with
+ * rq_statistics_moments_merge().
+ */
+struct rq_statistics_moments {
+    unsigned long n;
+    double mean;
+    double m2; /**< sum of squared deviations from the mean */
+    double m3; /**< sum of cubed deviations from the mean */
+    double m4; /**< sum of deviations from the mean to the fourth */
+    double min;
+    double max;
+};
+
+/** Running covariances of a stream of vectors. Allocate with
+ * rq_statistics_comoments_alloc().
+ */
+typedef struct rq_statistics_comoments {
+    unsigned int num_series;
+    unsigned long n;
+    double *mean;
+    double *c; /**< num_series x num_series sums of co-deviations */
+    double *work;
+} *rq_statistics_comoments_t;
+
 RQ_EXPORT short
 rq_statistics_histogram(double *inputs, unsigned long num_inputs, double *buckets, unsigned long num_buckets, unsigned long *counts, unsigned long *underflow);
 
@@ -55,9 +83,74 @@ rq_statistics_min(double *inputs, unsigned long num_inputs);
 RQ_EXPORT short
 rq_statistics_mean_max_min(double *inputs, unsigned long num_inputs, double *mean, double *max_val, double *min_val);
 
+/** Get the sample covariance matrix of num_series series, each of
+ * num_inputs values. The series are passed as a variable number of
+ * double * arguments.
+ */
 RQ_EXPORT rq_matrix_t
 rq_statistics_get_covariance_matrix(unsigned long num_inputs, unsigned num_series, ...);
 
+/** Calculate the sample covariance matrix of an array of series,
+ * each of num_inputs values, into 'out' (num_series x num_series).
+ */
+RQ_EXPORT short
+rq_statistics_covariance_matrix(const double * const *series, unsigned int num_series, unsigned long num_inputs, rq_matrix_t out);
+
+/** Reset a moments accumulator.
+ */
+RQ_EXPORT void rq_statistics_moments_init(struct rq_statistics_moments *m);
+
+/** Add a value to a moments accumulator (Welford's update).
+ */
+RQ_EXPORT void rq_statistics_moments_add(struct rq_statistics_moments *m, double x);
+
+/** Add an array of values to a moments accumulator. This can be
+ * passed the terminal_distribution array from the monte-carlo
+ * pricers directly, and is much faster than adding the values one
+ * at a time.
+ */
+RQ_EXPORT void rq_statistics_moments_add_array(struct rq_statistics_moments *m, const double *inputs, unsigned long num_inputs);
+
+/** Merge the moments accumulated in 'src' into 'dst'.
+ */
+RQ_EXPORT void rq_statistics_moments_merge(struct rq_statistics_moments *dst, const struct rq_statistics_moments *src);
+
+/** Get the sample variance. */
+RQ_EXPORT double rq_statistics_moments_get_variance(const struct rq_statistics_moments *m);
+
+/** Get the sample standard deviation. */
+RQ_EXPORT double rq_statistics_moments_get_std_dev(const struct rq_statistics_moments *m);
+
+/** Get the standard error of the mean. */
+RQ_EXPORT double rq_statistics_moments_get_std_error(const struct rq_statistics_moments *m);
+
+/** Get the skewness. */
+RQ_EXPORT double rq_statistics_moments_get_skewness(const struct rq_statistics_moments *m);
+
+/** Get the excess kurtosis. */
+RQ_EXPORT double rq_statistics_moments_get_kurtosis(const struct rq_statistics_moments *m);
+
+/** Allocate a covariance accumulator for vectors of num_series values.
+ */
+RQ_EXPORT rq_statistics_comoments_t rq_statistics_comoments_alloc(unsigned int num_series);
+
+/** Free a covariance accumulator.
+ */
+RQ_EXPORT void rq_statistics_comoments_free(rq_statistics_comoments_t cm);
+
+/** Add a vector of num_series values to the accumulator.
+ */
+RQ_EXPORT void rq_statistics_comoments_add(rq_statistics_comoments_t cm, const double *x);
+
+/** Merge the accumulator 'src' into 'dst'. Both must have the same
+ * number of series.
+ */
+RQ_EXPORT short rq_statistics_comoments_merge(rq_statistics_comoments_t dst, const rq_statistics_comoments_t src);
+
+/** Get the sample covariance matrix into 'out' (num_series x num_series).
+ */
+RQ_EXPORT short rq_statistics_comoments_get_covariance_matrix(const rq_statistics_comoments_t cm, rq_matrix_t out);
+
 #ifdef __cplusplus
 #if 0
 { // purely to not screw up my indenting...
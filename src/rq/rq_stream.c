@@ -26,7 +26,17 @@
 #include <stdarg.h>
 #include <stdio.h>
 #include <string.h>
+#include <math.h>
 
+/* The doubles rq_stream_write_double_as_string() formats itself:
+   up to 9 decimal places, with the integer part fitting in a 32 bit
+   long and the scaled value well inside the 53 bits of a double. */
+#define MAX_FAST_DP 9
+#define MAX_FAST_WHOLE 4e9
+#define MAX_FAST_SCALED 1e15
+
+/* printf output that fits in this is formatted on the stack. */
+#define PRINTF_BUFFER_SIZE 256
 
 RQ_EXPORT rq_stream_t 
 _rq_stream_alloc(const char *stream_type, void *data, struct rq_stream_callbacks *callbacks)
@@ -44,6 +54,7 @@ _rq_stream_alloc(const char *stream_type, void *data, struct rq_stream_callbacks
     s->seek_func = callbacks->seek_func;
     s->rewind_func = callbacks->rewind_func;
     s->free_func = callbacks->free_func;
+    s->read_line_func = callbacks->read_line_func;
 
     return s;
 }
@@ -94,6 +105,9 @@ rq_stream_read_line(rq_stream_t s, char *buf, unsigned maxbuflen)
     int ret = -1;
     char *p = buf;
 
+    if (s->read_line_func)
+        return (*s->read_line_func)(s->data, buf, maxbuflen);
+
     for (i = 0; i < maxbuflen - 1; )
     {
         ret = (*s->read_func)(s->data, p, 1);
@@ -115,12 +129,50 @@ rq_stream_read_line(rq_stream_t s, char *buf, unsigned maxbuflen)
     return i;
 }
 
+RQ_EXPORT int 
+rq_stream_readv(rq_stream_t s, const struct rq_stream_iovec *iov, int iovcnt)
+{
+    int total = 0;
+    int i;
+
+    for (i = 0; i < iovcnt; i++)
+    {
+        int ret = (*s->read_func)(s->data, iov[i].buf, iov[i].len);
+
+        if (ret < 0)
+            return ret;
+        total += ret;
+        if (ret < iov[i].len)
+            break;
+    }
+
+    return total;
+}
+
 RQ_EXPORT int 
 rq_stream_write(rq_stream_t s, const char *buf, int num_bytes)
 {
     return (*s->write_func)(s->data, buf, num_bytes);
 }
 
+RQ_EXPORT int 
+rq_stream_writev(rq_stream_t s, const struct rq_stream_iovec *iov, int iovcnt)
+{
+    int total = 0;
+    int i;
+
+    for (i = 0; i < iovcnt; i++)
+    {
+        int ret = (*s->write_func)(s->data, iov[i].buf, iov[i].len);
+
+        if (ret < 0)
+            return ret;
+        total += ret;
+    }
+
+    return total;
+}
+
 RQ_EXPORT int 
 rq_stream_write_string(rq_stream_t stream, const char *buf)
 {
@@ -130,36 +182,146 @@ rq_stream_write_string(rq_stream_t stream, const char *buf)
 		return rq_stream_write(stream, "(null)", 6);
 }
 
+/* Write the digits of n backwards from end, returning the start. */
+static char *
+format_unsigned(char *end, unsigned long n)
+{
+    do
+    {
+        *--end = (char)('0' + n % 10);
+        n /= 10;
+    }
+    while (n);
+
+    return end;
+}
+
 RQ_EXPORT int 
 rq_stream_write_integer_as_string(rq_stream_t stream, int i)
 {
-    char buf[50];
-    sprintf(buf, "%d", i);
-    return rq_stream_write_string(stream, buf);
+    return rq_stream_write_long_as_string(stream, i);
+}
+
+RQ_EXPORT int 
+rq_stream_write_long_as_string(rq_stream_t stream, long l)
+{
+    char buf[24];
+    char *end = buf + sizeof(buf);
+    char *p = format_unsigned(end, (l < 0 ? 0UL - (unsigned long)l : (unsigned long)l));
+
+    if (l < 0)
+        *--p = '-';
+
+    return rq_stream_write(stream, p, (int)(end - p));
+}
+
+/* Replace the locale's decimal point, which may be more than one
+   character, in the output of "%.*f" with a '.'. It is whatever
+   comes between the integer digits and the last dp characters. */
+static void
+replace_decimal_point(char *buf, int dp)
+{
+    char *digits = (*buf == '-' ? buf + 1 : buf);
+    char *p = digits;
+    char *fraction;
+
+    while (*p >= '0' && *p <= '9')
+        p++;
+
+    /* nothing to do for no places, or for inf and nan */
+    fraction = buf + strlen(buf) - dp;
+    if (dp <= 0 || p == digits || fraction <= p)
+        return;
+
+    *p++ = '.';
+    memmove(p, fraction, dp + 1);
 }
 
 RQ_EXPORT int 
 rq_stream_write_double_as_string(rq_stream_t stream, double d, int dp)
 {
+    static const double powers_of_ten[MAX_FAST_DP + 1] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9
+    };
     char buf[150];
+
+    /* Scale up and round. The multiplication can be out by an ulp,
+       which only matters when the scaled value is that close to
+       halfway between two integers, so those go to sprintf(), as do
+       zeroes, to get the sign of -0.0 right. */
+    if (dp >= 0 && dp <= MAX_FAST_DP && d != 0.0 && fabs(d) < MAX_FAST_WHOLE)
+    {
+        double scaled = fabs(d) * powers_of_ten[dp];
+
+        if (scaled < MAX_FAST_SCALED)
+        {
+            double whole = floor(scaled);
+            double fraction = scaled - whole;
+
+            if (fabs(fraction - 0.5) > scaled * 1e-15)
+            {
+                char *end = buf + sizeof(buf);
+                unsigned long digits;
+                char *p;
+
+                if (fraction > 0.5)
+                    whole += 1.0;
+
+                /* the integer and fractional parts separately, so
+                   that a long only needs to hold 10^9 */
+                digits = (unsigned long)fmod(whole, powers_of_ten[dp]);
+                p = end;
+                if (dp > 0)
+                {
+                    char *q = format_unsigned(end, digits);
+
+                    while (end - q < dp)
+                        *--q = '0';
+                    p = q;
+                    *--p = '.';
+                }
+                p = format_unsigned(p, (unsigned long)floor(whole / powers_of_ten[dp]));
+                if (d < 0.0)
+                    *--p = '-';
+
+                return rq_stream_write(stream, p, (int)(end - p));
+            }
+        }
+    }
+
     sprintf(buf, "%.*f", dp, d);
+    replace_decimal_point(buf, dp);
     return rq_stream_write_string(stream, buf);
 }
 
 RQ_EXPORT int 
 rq_stream_printf(rq_stream_t stream, const char *format, ...)
 {
+    char buf[PRINTF_BUFFER_SIZE];
+    char *heap_buf = NULL;
+    int size = PRINTF_BUFFER_SIZE;
     va_list ap;
     int ret;
-    char *buf;
 
     va_start(ap, format);
+    ret = vsnprintf(buf, size, format, ap);
+    va_end(ap);
 
-    ret = vasprintf(&buf, format, ap);
-    rq_stream_write_string(stream, buf);
-    free(buf);
+    /* Too big for the stack. Older vsnprintf()s return -1 rather
+       than the length needed, so keep doubling until it fits. */
+    while (ret < 0 || ret >= size)
+    {
+        size = (ret >= size ? ret + 1 : size * 2);
+        heap_buf = (char *)RQ_REALLOC(heap_buf, size);
 
-    va_end(ap);
+        va_start(ap, format);
+        ret = vsnprintf(heap_buf, size, format, ap);
+        va_end(ap);
+    }
+
+    rq_stream_write(stream, (heap_buf ? heap_buf : buf), ret);
+    if (heap_buf)
+        RQ_FREE(heap_buf);
 
     return ret;
 }
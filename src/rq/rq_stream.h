@@ -43,6 +43,15 @@ extern "C" {
 #endif
 
 /* -- prototypes --------------------------------------------------- */
+
+/** One of the buffers handed to rq_stream_readv() or
+ * rq_stream_writev().
+ */
+struct rq_stream_iovec {
+    char *buf;
+    int len;
+};
+
 typedef struct rq_stream {
     const char *stream_type;
     void *data;
@@ -56,6 +65,7 @@ typedef struct rq_stream {
     rq_error_code (*seek_func)(void *, long);
     void (*rewind_func)(void *);
     void (*free_func)(void *);
+    int (*read_line_func)(void *, char *, unsigned);
 } *rq_stream_t;
 
 struct rq_stream_callbacks {
@@ -69,6 +79,7 @@ struct rq_stream_callbacks {
     rq_error_code (*seek_func)(void *, long);
     void (*rewind_func)(void *);
     void (*free_func)(void *);
+    int (*read_line_func)(void *, char *, unsigned); /**< optional, otherwise lines are read a byte at a time */
 };
 
 /** Test whether the rq_stream is NULL */
@@ -128,6 +139,14 @@ RQ_EXPORT int rq_stream_read(rq_stream_t stream, char *buf, int num_bytes);
  */
 RQ_EXPORT int rq_stream_read_line(rq_stream_t stream, char *buf, unsigned maxbuflen);
 
+/**
+ * Read into each of a number of buffers in turn, stopping early at
+ * the end of the stream.
+ *
+ * @return	the total number of bytes read or negative status if failed
+ */
+RQ_EXPORT int rq_stream_readv(rq_stream_t stream, const struct rq_stream_iovec *iov, int iovcnt);
+
 
 /** Write bytes to a stream
  *
@@ -138,12 +157,31 @@ RQ_EXPORT int rq_stream_read_line(rq_stream_t stream, char *buf, unsigned maxbuf
  */
 RQ_EXPORT int rq_stream_write(rq_stream_t stream, const char *buf, int num_bytes);
 
+/** Write each of a number of buffers in turn.
+ *
+ * @return	the total number of bytes written or negative status on error
+ */
+RQ_EXPORT int rq_stream_writev(rq_stream_t stream, const struct rq_stream_iovec *iov, int iovcnt);
+
 RQ_EXPORT int rq_stream_write_string(rq_stream_t stream, const char *buf);
 
+/** Write an integer in decimal. */
 RQ_EXPORT int rq_stream_write_integer_as_string(rq_stream_t stream, int i);
 
+/** Write a long in decimal. */
+RQ_EXPORT int rq_stream_write_long_as_string(rq_stream_t stream, long l);
+
+/** Write a double with dp decimal places, as "%.*f" would but
+ * always with a '.' whatever the locale. Most values are formatted
+ * directly; the rest (zeroes, halfway values, large values and more
+ * than 9 places) go through sprintf() and have the locale's decimal
+ * point replaced.
+ */
 RQ_EXPORT int rq_stream_write_double_as_string(rq_stream_t stream, double d, int dp);
 
+/** Write formatted output. Output that fits is formatted on the
+ * stack, so there is no allocation per call.
+ */
 RQ_EXPORT int rq_stream_printf(rq_stream_t stream, const char *format, ...);
 
 /** Rewind the stream. */
@@ -0,0 +1,310 @@
+/*
+** rq_stream_buffered.c
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#include "rq_stream_buffered.h"
+#include "rq_error.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* -- globals ------------------------------------------------------ */
+const char *rq_stream_buffered_stream_type = "stream_buffered";
+
+/* -- code --------------------------------------------------------- */
+static rq_error_code
+flush(struct rq_stream_buffered *sb)
+{
+    int len = (int)sb->buffer_len;
+
+    if (!sb->writing)
+        return RQ_OK;
+
+    sb->writing = 0;
+    sb->buffer_len = 0;
+    sb->position = 0;
+
+    if (len > 0 && rq_stream_write(sb->stream, sb->buffer, len) != len)
+        return RQ_FAILED;
+
+    return RQ_OK;
+}
+
+/* Throw away anything read ahead, moving the underlying stream back
+   to where the reader has got to. */
+static void
+drop_read_buffer(struct rq_stream_buffered *sb)
+{
+    if (!sb->writing && sb->position < sb->buffer_len)
+        rq_stream_seek(sb->stream, rq_stream_tell(sb->stream) - (long)(sb->buffer_len - sb->position));
+
+    sb->buffer_len = 0;
+    sb->position = 0;
+}
+
+/* Make sure there's something in the buffer to read, unless the
+   underlying stream is at its end. */
+static int
+fill(struct rq_stream_buffered *sb)
+{
+    int ret;
+
+    if (sb->writing && flush(sb) != RQ_OK)
+        return -1;
+    if (sb->position < sb->buffer_len)
+        return (int)(sb->buffer_len - sb->position);
+
+    ret = rq_stream_read(sb->stream, sb->buffer, (int)sb->buffer_size);
+    sb->position = 0;
+    sb->buffer_len = (ret > 0 ? (unsigned int)ret : 0);
+
+    return ret;
+}
+
+static int 
+_rq_stream_buffered_open(void *d)
+{
+    struct rq_stream_buffered *sb = (struct rq_stream_buffered *)d;
+
+    flush(sb);
+    sb->buffer_len = 0;
+    sb->position = 0;
+
+    return rq_stream_open(sb->stream);
+}
+
+static short
+_rq_stream_buffered_is_open(void *d)
+{
+    struct rq_stream_buffered *sb = (struct rq_stream_buffered *)d;
+    return rq_stream_is_open(sb->stream);
+}
+
+static short
+_rq_stream_buffered_at_end(void *d)
+{
+    struct rq_stream_buffered *sb = (struct rq_stream_buffered *)d;
+
+    if (!sb->writing && sb->position < sb->buffer_len)
+        return 0;
+
+    return rq_stream_at_end(sb->stream);
+}
+
+static void 
+_rq_stream_buffered_close(void *d)
+{
+    struct rq_stream_buffered *sb = (struct rq_stream_buffered *)d;
+
+    flush(sb);
+    sb->buffer_len = 0;
+    sb->position = 0;
+    rq_stream_close(sb->stream);
+}
+
+static int 
+_rq_stream_buffered_read(void *d, char *buffer, int num_bytes)
+{
+    struct rq_stream_buffered *sb = (struct rq_stream_buffered *)d;
+    int total = 0;
+
+    while (total < num_bytes)
+    {
+        int available = fill(sb);
+
+        if (available < 0)
+            return (total > 0 ? total : available);
+        if (available == 0)
+            break;
+
+        if (available > num_bytes - total)
+            available = num_bytes - total;
+        memcpy(buffer + total, sb->buffer + sb->position, available);
+        sb->position += available;
+        total += available;
+    }
+
+    return total;
+}
+
+static int
+_rq_stream_buffered_read_line(void *d, char *buffer, unsigned maxbuflen)
+{
+    struct rq_stream_buffered *sb = (struct rq_stream_buffered *)d;
+    unsigned int total = 0;
+
+    while (total < maxbuflen - 1)
+    {
+        int available = fill(sb);
+        const char *start;
+        const char *nl;
+        unsigned int len;
+
+        if (available < 0)
+            return (total > 0 ? (int)total : available);
+        if (available == 0)
+            break;
+
+        start = sb->buffer + sb->position;
+        len = (unsigned int)available;
+        if (len > maxbuflen - 1 - total)
+            len = maxbuflen - 1 - total;
+        nl = (const char *)memchr(start, '\n', len);
+        if (nl)
+            len = (unsigned int)(nl - start + 1);
+
+        memcpy(buffer + total, start, len);
+        sb->position += len;
+        total += len;
+
+        if (nl)
+            break;
+    }
+
+    buffer[total] = '\0';
+
+    return (int)total;
+}
+
+static int 
+_rq_stream_buffered_write(void *d, const char *buffer, int num_bytes)
+{
+    struct rq_stream_buffered *sb = (struct rq_stream_buffered *)d;
+
+    if (!sb->writing)
+    {
+        drop_read_buffer(sb);
+        sb->writing = 1;
+    }
+
+    if (sb->buffer_len + num_bytes > sb->buffer_size)
+    {
+        if (flush(sb) != RQ_OK)
+            return -1;
+        sb->writing = 1;
+    }
+
+    if ((unsigned int)num_bytes >= sb->buffer_size)
+        return rq_stream_write(sb->stream, buffer, num_bytes);
+
+    memcpy(sb->buffer + sb->buffer_len, buffer, num_bytes);
+    sb->buffer_len += num_bytes;
+
+    return num_bytes;
+}
+
+static void 
+_rq_stream_buffered_free(void *d)
+{
+    struct rq_stream_buffered *sb = (struct rq_stream_buffered *)d;
+
+    flush(sb);
+    rq_stream_free(sb->stream);
+    RQ_FREE(sb->buffer);
+    RQ_FREE(sb);
+}
+
+static long
+_rq_stream_buffered_tell(void *d)
+{
+    struct rq_stream_buffered *sb = (struct rq_stream_buffered *)d;
+    long pos = rq_stream_tell(sb->stream);
+
+    if (pos < 0)
+        return pos;
+    if (sb->writing)
+        return pos + (long)sb->buffer_len;
+
+    return pos - (long)(sb->buffer_len - sb->position);
+}
+
+static rq_error_code
+_rq_stream_buffered_seek(void *d, long offset)
+{
+    struct rq_stream_buffered *sb = (struct rq_stream_buffered *)d;
+
+    if (flush(sb) != RQ_OK)
+        return RQ_FAILED;
+    sb->buffer_len = 0;
+    sb->position = 0;
+
+    return rq_stream_seek(sb->stream, offset);
+}
+
+static void 
+_rq_stream_buffered_rewind(void *d)
+{
+    struct rq_stream_buffered *sb = (struct rq_stream_buffered *)d;
+
+    flush(sb);
+    sb->buffer_len = 0;
+    sb->position = 0;
+    rq_stream_rewind(sb->stream);
+}
+
+static struct rq_stream_callbacks stream_buffered_callbacks = {
+    _rq_stream_buffered_open,
+    _rq_stream_buffered_is_open,
+    _rq_stream_buffered_at_end,
+    _rq_stream_buffered_close,
+    _rq_stream_buffered_read,
+    _rq_stream_buffered_write,
+    _rq_stream_buffered_tell,
+    _rq_stream_buffered_seek,
+    _rq_stream_buffered_rewind,
+    _rq_stream_buffered_free,
+    _rq_stream_buffered_read_line
+};
+
+RQ_EXPORT rq_stream_t
+rq_stream_buffered_alloc(rq_stream_t stream, unsigned int buffer_size)
+{
+    struct rq_stream_buffered *sb;
+
+    if (!stream)
+        return NULL;
+
+    sb = (struct rq_stream_buffered *)RQ_CALLOC(1, sizeof(struct rq_stream_buffered));
+    sb->stream = stream;
+    sb->buffer_size = (buffer_size ? buffer_size : RQ_STREAM_BUFFERED_DEFAULT_SIZE);
+    sb->buffer = (char *)RQ_MALLOC(sb->buffer_size);
+
+    return _rq_stream_alloc(
+        rq_stream_buffered_stream_type,
+        sb,
+        &stream_buffered_callbacks
+        );
+}
+
+RQ_EXPORT rq_error_code
+rq_stream_buffered_flush(rq_stream_t stream)
+{
+    struct rq_stream_buffered *sb = 
+        (struct rq_stream_buffered *)_rq_stream_get_data(stream);
+    return flush(sb);
+}
+
+RQ_EXPORT rq_stream_t
+rq_stream_buffered_get_stream(rq_stream_t stream)
+{
+    struct rq_stream_buffered *sb = 
+        (struct rq_stream_buffered *)_rq_stream_get_data(stream);
+    return sb->stream;
+}
@@ -0,0 +1,96 @@
+/**
+ * @file
+ *
+ * A stream that buffers reads and writes to another stream.
+ */
+/*
+** rq_stream_buffered.h
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#ifndef rq_stream_buffered_h
+#define rq_stream_buffered_h
+
+/* -- includes ----------------------------------------------------- */
+#include "rq_config.h"
+#include "rq_defs.h"
+#include "rq_stream.h"
+
+#ifdef __cplusplus
+extern "C" {
+#if 0
+} // purely to not screw up my indenting...
+#endif
+#endif
+
+/* -- defines ------------------------------------------------------ */
+#define RQ_STREAM_BUFFERED_DEFAULT_SIZE 65536
+
+/* -- structs ----------------------------------------------------- */
+/**
+ * Reads from the underlying stream a buffer at a time, and collects
+ * writes into a buffer that is written out when it fills up, when
+ * the stream is flushed, sought, closed or freed, or before the
+ * stream is read from. Writes at least as big as the buffer go
+ * straight through.
+ */
+struct rq_stream_buffered {
+    rq_stream_t stream; /**< The underlying stream, owned by this one */
+    char *buffer;
+    unsigned int buffer_size;
+    unsigned int buffer_len; /**< Bytes read into or written to the buffer */
+    unsigned int position; /**< The read offset into the buffer */
+    short writing; /**< non-zero if the buffer holds unwritten data */
+};
+
+/* -- globals ------------------------------------------------------ */
+extern const char *rq_stream_buffered_stream_type;
+
+/* -- prototypes --------------------------------------------------- */
+/**
+ * Allocate a buffered stream over an open stream, which it takes
+ * over and frees when it is freed.
+ *
+ * @param stream The stream to buffer. If this is NULL, as it is
+ * when rq_stream_file_open() fails, NULL is returned.
+ * @param buffer_size The size of the buffer, or 0 for
+ * RQ_STREAM_BUFFERED_DEFAULT_SIZE
+ */
+RQ_EXPORT rq_stream_t rq_stream_buffered_alloc(rq_stream_t stream, unsigned int buffer_size);
+
+/**
+ * Write out anything in the buffer.
+ *
+ * @return RQ_OK, or RQ_FAILED if the underlying write failed
+ */
+RQ_EXPORT rq_error_code rq_stream_buffered_flush(rq_stream_t stream);
+
+/**
+ * Get the underlying stream.
+ */
+RQ_EXPORT rq_stream_t rq_stream_buffered_get_stream(rq_stream_t stream);
+
+#ifdef __cplusplus
+#if 0
+{ // purely to not screw up my indenting...
+#endif
+};
+#endif
+
+#endif
@@ -56,12 +56,12 @@ _rq_stream_file_open(void *d)
 
     if (ss->filename)
     {
-		/* TODO: Specify mode!!! */
-		const char *open_mode = "r";
-		if (ss->open_mode == RQ_STREAM_FILE_OPENMODE_WRITING)
-			open_mode = "w";
-		else if (ss->open_mode == RQ_STREAM_FILE_OPENMODE_READINGWRITINGCREATE)
-			open_mode = "w+";
+		int binary = (ss->open_mode & RQ_STREAM_FILE_OPENMODE_BINARY);
+		const char *open_mode = (binary ? "rb" : "r");
+		if ((ss->open_mode & ~RQ_STREAM_FILE_OPENMODE_BINARY) == RQ_STREAM_FILE_OPENMODE_WRITING)
+			open_mode = (binary ? "wb" : "w");
+		else if ((ss->open_mode & ~RQ_STREAM_FILE_OPENMODE_BINARY) == RQ_STREAM_FILE_OPENMODE_READINGWRITINGCREATE)
+			open_mode = (binary ? "w+b" : "w+");
 
         ss->fh = fopen(ss->filename, open_mode);
         if (!ss->fh)
@@ -118,7 +118,7 @@ _rq_stream_file_write(void *d, const char *buffer, int num_bytes)
     int ret = -1;
 
     if (ss->fh)
-        ret = fwrite(buffer, num_bytes, 1, ss->fh);
+        ret = fwrite(buffer, 1, num_bytes, ss->fh);
 
     return ret;
 }
@@ -200,11 +200,13 @@ rq_stream_file_open(const char *filename, const char *openmode)
             mode = RQ_STREAM_FILE_OPENMODE_READING;
         else if (*openmode == 'w')
         {
-            if (openmode[1] == '+')
+            if (strchr(openmode, '+'))
                 mode = RQ_STREAM_FILE_OPENMODE_READINGWRITINGCREATE;
             else
                 mode = RQ_STREAM_FILE_OPENMODE_WRITING;
         }
+        if (strchr(openmode, 'b'))
+            mode |= RQ_STREAM_FILE_OPENMODE_BINARY;
     }
 
     rq_stream_file_set_filename(stream, filename);
@@ -47,6 +47,8 @@ extern "C" {
 #define RQ_STREAM_FILE_OPENMODE_READING 1
 #define RQ_STREAM_FILE_OPENMODE_WRITING 2
 #define RQ_STREAM_FILE_OPENMODE_READINGWRITINGCREATE 3
+/** Or'd with one of the modes above to open the file in binary mode */
+#define RQ_STREAM_FILE_OPENMODE_BINARY 4
 
 /* -- structs ----------------------------------------------------- */
 struct rq_stream_file {
@@ -65,7 +67,9 @@ extern const char *rq_stream_file_stream_type;
 RQ_EXPORT rq_stream_t rq_stream_file_alloc();
 
 /**
- * Allocate and open a new file stream
+ * Allocate and open a new file stream. The open mode is "r", "w" or
+ * "w+", with a 'b' added, as in "wb", to open the file in binary
+ * mode.
  */
 RQ_EXPORT rq_stream_t rq_stream_file_open(const char *filename, const char *openmode);
 
@@ -0,0 +1,399 @@
+/*
+** rq_stream_mmap.c
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#include "rq_stream_mmap.h"
+#include "rq_error.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#ifdef WIN32
+# include <windows.h>
+#elif defined(HAVE_MMAP)
+# include <sys/types.h>
+# include <sys/stat.h>
+# include <sys/mman.h>
+# include <fcntl.h>
+# include <unistd.h>
+#endif
+
+/* -- globals ------------------------------------------------------ */
+const char *rq_stream_mmap_stream_type = "stream_mmap";
+
+/* -- prototypes --------------------------------------------------- */
+static void _rq_stream_mmap_close(void *d);
+
+/* -- code --------------------------------------------------------- */
+
+/* Empty files can't be mapped, so they all share this. */
+static const char empty_buffer[1] = { '\0' };
+
+#if !defined(WIN32) && !defined(HAVE_MMAP)
+/* Without mmap we read the whole file in one go instead. */
+static int
+read_file(struct rq_stream_mmap *ss)
+{
+    FILE *fh = fopen(ss->filename, "rb");
+    long len;
+    char *buf;
+
+    if (!fh)
+        return errno;
+
+    fseek(fh, 0, SEEK_END);
+    len = ftell(fh);
+    fseek(fh, 0, SEEK_SET);
+
+    if (len > 0)
+    {
+        buf = (char *)RQ_MALLOC(len);
+        if (fread(buf, 1, len, fh) != (size_t)len)
+        {
+            RQ_FREE(buf);
+            fclose(fh);
+            return RQ_FAILED;
+        }
+        ss->buffer = buf;
+        ss->buffer_len = len;
+    }
+    else
+    {
+        ss->buffer = empty_buffer;
+        ss->buffer_len = 0;
+    }
+    ss->is_mapped = 0;
+
+    fclose(fh);
+
+    return 0;
+}
+#endif
+
+static int 
+_rq_stream_mmap_open(void *d)
+{
+    struct rq_stream_mmap *ss = (struct rq_stream_mmap *)d;
+
+    _rq_stream_mmap_close(d);
+
+    if (!ss->filename)
+        return 0;
+
+#ifdef WIN32
+    {
+        HANDLE fh = CreateFileA(ss->filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        DWORD len;
+
+        if (fh == INVALID_HANDLE_VALUE)
+            return RQ_FAILED;
+
+        len = GetFileSize(fh, NULL);
+        if (len == 0)
+        {
+            CloseHandle(fh);
+            ss->buffer = empty_buffer;
+            ss->buffer_len = 0;
+            ss->is_mapped = 0;
+            return 0;
+        }
+
+        ss->mapping_handle = CreateFileMappingA(fh, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (!ss->mapping_handle)
+        {
+            CloseHandle(fh);
+            return RQ_FAILED;
+        }
+        ss->buffer = (const char *)MapViewOfFile(ss->mapping_handle, FILE_MAP_READ, 0, 0, 0);
+        if (!ss->buffer)
+        {
+            CloseHandle(ss->mapping_handle);
+            ss->mapping_handle = NULL;
+            CloseHandle(fh);
+            return RQ_FAILED;
+        }
+        ss->file_handle = fh;
+        ss->buffer_len = len;
+        ss->is_mapped = 1;
+    }
+#elif defined(HAVE_MMAP)
+    {
+        int fd = open(ss->filename, O_RDONLY);
+        struct stat st;
+        void *addr;
+
+        if (fd < 0)
+            return errno;
+
+        if (fstat(fd, &st) != 0)
+        {
+            int err = errno;
+            close(fd);
+            return err;
+        }
+
+        if (st.st_size == 0)
+        {
+            close(fd);
+            ss->buffer = empty_buffer;
+            ss->buffer_len = 0;
+            ss->is_mapped = 0;
+            return 0;
+        }
+
+        addr = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        /* the mapping holds its own reference to the file */
+        close(fd);
+        if (addr == MAP_FAILED)
+            return errno;
+
+#ifdef MADV_SEQUENTIAL
+        madvise(addr, st.st_size, MADV_SEQUENTIAL);
+#endif
+
+        ss->buffer = (const char *)addr;
+        ss->buffer_len = st.st_size;
+        ss->is_mapped = 1;
+    }
+#else
+    {
+        int err = read_file(ss);
+        if (err != 0)
+            return err;
+    }
+#endif
+
+    ss->position = 0;
+
+    return 0;
+}
+
+static short
+_rq_stream_mmap_is_open(void *d)
+{
+    struct rq_stream_mmap *ss = (struct rq_stream_mmap *)d;
+    if (!ss)
+        return 0;
+    return ss->buffer != NULL;
+}
+
+static short
+_rq_stream_mmap_at_end(void *d)
+{
+    struct rq_stream_mmap *ss = (struct rq_stream_mmap *)d;
+    if (!ss || !ss->buffer)
+        return 1;
+    return ss->position >= ss->buffer_len;
+}
+
+static void 
+_rq_stream_mmap_close(void *d)
+{
+    struct rq_stream_mmap *ss = (struct rq_stream_mmap *)d;
+
+    if (!ss->buffer)
+        return;
+
+    if (ss->is_mapped)
+    {
+#ifdef WIN32
+        UnmapViewOfFile(ss->buffer);
+        CloseHandle(ss->mapping_handle);
+        CloseHandle(ss->file_handle);
+        ss->mapping_handle = NULL;
+        ss->file_handle = NULL;
+#elif defined(HAVE_MMAP)
+        munmap((void *)ss->buffer, ss->buffer_len);
+#endif
+    }
+    else if (ss->buffer != empty_buffer)
+        RQ_FREE((char *)ss->buffer);
+
+    ss->buffer = NULL;
+    ss->buffer_len = 0;
+    ss->position = 0;
+    ss->is_mapped = 0;
+}
+
+static int 
+_rq_stream_mmap_read(void *d, char *buffer, int num_bytes)
+{
+    struct rq_stream_mmap *ss = (struct rq_stream_mmap *)d;
+    unsigned long left;
+
+    if (!ss->buffer)
+        return -1;
+
+    left = ss->buffer_len - ss->position;
+    if ((unsigned long)num_bytes > left)
+        num_bytes = (int)left;
+
+    memcpy(buffer, ss->buffer + ss->position, num_bytes);
+    ss->position += num_bytes;
+
+    return num_bytes;
+}
+
+static int 
+_rq_stream_mmap_write(void *d, const char *buffer, int num_bytes)
+{
+    /* read-only */
+    return -1;
+}
+
+static void 
+_rq_stream_mmap_free(void *d)
+{
+    struct rq_stream_mmap *ss = (struct rq_stream_mmap *)d;
+    _rq_stream_mmap_close(d);
+    if (ss->filename)
+        RQ_FREE((char *)ss->filename);
+    RQ_FREE(ss);
+}
+
+static long
+_rq_stream_mmap_tell(void *d)
+{
+    struct rq_stream_mmap *ss = (struct rq_stream_mmap *)d;
+    if (!ss || !ss->buffer)
+        return -1;
+    return (long)ss->position;
+}
+
+static rq_error_code
+_rq_stream_mmap_seek(void *d, long offset)
+{
+    struct rq_stream_mmap *ss = (struct rq_stream_mmap *)d;
+    if (!ss || !ss->buffer || offset < 0 || (unsigned long)offset > ss->buffer_len)
+        return RQ_FAILED;
+    ss->position = offset;
+    return RQ_OK;
+}
+
+static void 
+_rq_stream_mmap_rewind(void *d)
+{
+    struct rq_stream_mmap *ss = (struct rq_stream_mmap *)d;
+    ss->position = 0;
+}
+
+static int
+_rq_stream_mmap_read_line(void *d, char *buffer, unsigned maxbuflen)
+{
+    struct rq_stream_mmap *ss = (struct rq_stream_mmap *)d;
+    unsigned long len;
+    const char *nl;
+
+    if (!ss->buffer)
+        return -1;
+
+    len = ss->buffer_len - ss->position;
+    if (len > maxbuflen - 1)
+        len = maxbuflen - 1;
+    nl = (const char *)memchr(ss->buffer + ss->position, '\n', len);
+    if (nl)
+        len = nl - (ss->buffer + ss->position) + 1;
+
+    memcpy(buffer, ss->buffer + ss->position, len);
+    buffer[len] = '\0';
+    ss->position += len;
+
+    return (int)len;
+}
+
+static struct rq_stream_callbacks stream_mmap_callbacks = {
+    _rq_stream_mmap_open,
+    _rq_stream_mmap_is_open,
+    _rq_stream_mmap_at_end,
+    _rq_stream_mmap_close,
+    _rq_stream_mmap_read,
+    _rq_stream_mmap_write,
+    _rq_stream_mmap_tell,
+    _rq_stream_mmap_seek,
+    _rq_stream_mmap_rewind,
+    _rq_stream_mmap_free,
+    _rq_stream_mmap_read_line
+};
+
+RQ_EXPORT rq_stream_t
+rq_stream_mmap_alloc()
+{
+    struct rq_stream_mmap *ss = 
+        (struct rq_stream_mmap *)RQ_CALLOC(1, sizeof(struct rq_stream_mmap));
+    return _rq_stream_alloc(
+        rq_stream_mmap_stream_type,
+        ss,
+        &stream_mmap_callbacks
+        );
+}
+
+RQ_EXPORT rq_stream_t 
+rq_stream_mmap_open(const char *filename)
+{
+    rq_stream_t stream = rq_stream_mmap_alloc();
+
+    rq_stream_mmap_set_filename(stream, filename);
+
+    if (rq_stream_open(stream) != 0)
+    {
+        rq_stream_free(stream);
+        stream = NULL;
+    }
+
+    return stream;
+}
+
+RQ_EXPORT const char *
+rq_stream_mmap_get_filename(rq_stream_t stream)
+{
+    struct rq_stream_mmap *ss = 
+        (struct rq_stream_mmap *)_rq_stream_get_data(stream);
+    return ss->filename;
+}
+
+RQ_EXPORT void 
+rq_stream_mmap_set_filename(rq_stream_t stream, const char *filename)
+{
+    struct rq_stream_mmap *ss = 
+        (struct rq_stream_mmap *)_rq_stream_get_data(stream);
+    if (ss->filename)
+    {
+        _rq_stream_mmap_close(ss);
+        RQ_FREE((char *)ss->filename);
+    }
+
+    ss->filename = RQ_STRDUP(filename);
+}
+
+RQ_EXPORT const char *
+rq_stream_mmap_get_buffer(rq_stream_t stream, unsigned long *buffer_len)
+{
+    struct rq_stream_mmap *ss;
+
+    if (strcmp(stream->stream_type, rq_stream_mmap_stream_type))
+        return NULL;
+
+    ss = (struct rq_stream_mmap *)_rq_stream_get_data(stream);
+    if (buffer_len)
+        *buffer_len = ss->buffer_len;
+
+    return ss->buffer;
+}
@@ -0,0 +1,100 @@
+/**
+ * @file
+ *
+ * A read-only stream over a memory-mapped file
+ */
+/*
+** rq_stream_mmap.h
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#ifndef rq_stream_mmap_h
+#define rq_stream_mmap_h
+
+/* -- includes ----------------------------------------------------- */
+#include "rq_config.h"
+#include "rq_defs.h"
+#include "rq_stream.h"
+
+#ifdef __cplusplus
+extern "C" {
+#if 0
+} // purely to not screw up my indenting...
+#endif
+#endif
+
+/* -- structs ----------------------------------------------------- */
+/**
+ * A read-only stream over the whole of a file mapped into memory.
+ * Where the platform can't map files the file is read into a buffer
+ * when the stream is opened, so callers see the same thing either
+ * way.
+ */
+struct rq_stream_mmap {
+    const char *filename;
+    const char *buffer; /**< The file contents, NULL if not open */
+    unsigned long buffer_len; /**< The length of the file */
+    unsigned long position; /**< The read offset into the buffer */
+    short is_mapped; /**< non-zero if buffer is a mapping rather than allocated */
+#ifdef WIN32
+    void *file_handle;
+    void *mapping_handle;
+#endif
+};
+
+/* -- globals ------------------------------------------------------ */
+extern const char *rq_stream_mmap_stream_type;
+
+/* -- prototypes --------------------------------------------------- */
+/**
+ * Allocate a new memory-mapped file stream
+ */
+RQ_EXPORT rq_stream_t rq_stream_mmap_alloc();
+
+/**
+ * Allocate and open a new memory-mapped file stream. Returns NULL
+ * if the file can't be opened.
+ */
+RQ_EXPORT rq_stream_t rq_stream_mmap_open(const char *filename);
+
+/** Get the filename associated with this stream
+ */
+RQ_EXPORT const char *rq_stream_mmap_get_filename(rq_stream_t stream);
+
+/** Set the filename associated with this stream
+ */
+RQ_EXPORT void rq_stream_mmap_set_filename(rq_stream_t stream, const char *filename);
+
+/**
+ * Get the contents of an open memory-mapped stream. The buffer
+ * stays valid until the stream is closed and is not NUL terminated.
+ *
+ * @return the buffer, or NULL if the stream isn't an open
+ * memory-mapped stream
+ */
+RQ_EXPORT const char *rq_stream_mmap_get_buffer(rq_stream_t stream, unsigned long *buffer_len);
+
+#ifdef __cplusplus
+#if 0
+{ // purely to not screw up my indenting...
+#endif
+};
+#endif
+
+#endif
@@ -32,8 +32,8 @@ const char *rq_stream_string_stream_type = "stream_string";
 
 
 /* -- static vars -------------------------------------------------- */
-static unsigned int s_initial_buffer_size = 1024;
-static unsigned int s_initial_buffer_grow_size = 1024;
+static const unsigned int s_initial_buffer_size = 1024;
+static const unsigned int s_initial_buffer_grow_size = 1024;
 
 /* -- prototypes --------------------------------------------------- */
 static void rq_stream_string_close(void *d);
@@ -128,24 +128,26 @@ rq_stream_string_write(void *d, const char *buffer, int num_bytes)
     if (ss->is_open)
     {
         unsigned int offset = ss->ptr - ss->buffer;
-        int remaining = ss->buffer_len - offset;
-        if (remaining <= num_bytes)
+
+        if (offset + num_bytes > ss->max_buffer_size)
         {
-            /* grow the buffer */
-            int needed_to_grow = num_bytes - remaining;
-            int i = 1;
-            int amount_to_grow = ss->buffer_grow_size;
-            while (amount_to_grow < needed_to_grow)
+            /* grow the buffer, at least doubling it so that writing
+               a lot of small pieces doesn't keep copying it */
+            unsigned int amount_to_grow = ss->buffer_grow_size;
+            while (amount_to_grow < offset + num_bytes - ss->max_buffer_size)
                 amount_to_grow += ss->buffer_grow_size;
+            if (amount_to_grow < ss->max_buffer_size)
+                amount_to_grow = ss->max_buffer_size;
 
             ss->max_buffer_size += amount_to_grow;
-            ss->buffer = realloc(ss->buffer, ss->max_buffer_size);
+            ss->buffer = RQ_REALLOC(ss->buffer, ss->max_buffer_size);
             ss->ptr = ss->buffer+offset; /* reset ptr to position in buffer */
         }
 
         memcpy(ss->ptr, buffer, num_bytes);
         ss->ptr += num_bytes;
-        ss->buffer_len += num_bytes;
+        if (offset + num_bytes > ss->buffer_len)
+            ss->buffer_len = offset + num_bytes;
         ret = num_bytes;
     }
 
@@ -197,6 +199,30 @@ rq_stream_string_rewind(void *d)
         ss->ptr = ss->buffer;
 }
 
+static int
+rq_stream_string_read_line(void *d, char *buf, unsigned maxbuflen)
+{
+    struct rq_stream_string *ss = (struct rq_stream_string *)d;
+    unsigned int remaining;
+    unsigned int len;
+    const char *nl;
+
+    if (!ss->is_open)
+        return -1;
+
+    remaining = ss->buffer_len - (ss->ptr - ss->buffer);
+    len = (remaining < maxbuflen - 1 ? remaining : maxbuflen - 1);
+    nl = (const char *)memchr(ss->ptr, '\n', len);
+    if (nl)
+        len = nl - ss->ptr + 1;
+
+    memcpy(buf, ss->ptr, len);
+    buf[len] = '\0';
+    ss->ptr += len;
+
+    return len;
+}
+
 static struct rq_stream_callbacks stream_string_callbacks = {
     rq_stream_string_open,
     rq_stream_string_is_open,
@@ -207,7 +233,8 @@ static struct rq_stream_callbacks stream_string_callbacks = {
     rq_stream_string_tell,
     rq_stream_string_seek,
     rq_stream_string_rewind,
-    rq_stream_string_free
+    rq_stream_string_free,
+    rq_stream_string_read_line
 };
 
 RQ_EXPORT rq_stream_t
@@ -222,3 +249,17 @@ rq_stream_string_alloc()
         );
 }
 
+RQ_EXPORT const char *
+rq_stream_string_get_buffer(rq_stream_t stream, unsigned long *buffer_len)
+{
+    struct rq_stream_string *ss;
+
+    if (strcmp(stream->stream_type, rq_stream_string_stream_type))
+        return NULL;
+
+    ss = (struct rq_stream_string *)_rq_stream_get_data(stream);
+    if (buffer_len)
+        *buffer_len = ss->buffer_len;
+
+    return ss->buffer;
+}
@@ -59,6 +59,14 @@ extern const char *rq_stream_string_stream_type;
 /* -- prototypes --------------------------------------------------- */
 RQ_EXPORT rq_stream_t rq_stream_string_alloc();
 
+/**
+ * Get the contents of a string stream, which aren't NUL terminated.
+ * The buffer is only valid until the next write to the stream.
+ *
+ * @return the buffer, or NULL if this isn't a string stream
+ */
+RQ_EXPORT const char *rq_stream_string_get_buffer(rq_stream_t stream, unsigned long *buffer_len);
+
 #ifdef __cplusplus
 #if 0
 { // purely to not screw up my indenting...
@@ -22,12 +22,13 @@
 ** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 */
 #include "rq_street_address.h"
+#include "rq_alloc.h"
 #include <stdlib.h>
 
 RQ_EXPORT void
 rq_street_address_init(struct rq_street_address *p)
 {
-    p->street_line_list = rq_array_alloc(free);
+    p->street_line_list = rq_array_alloc(rq_free_func);
 }
 
 RQ_EXPORT void
@@ -64,7 +64,7 @@ rq_string_set_is_null(rq_string_set_t obj)
 void
 rq_string_set_add(rq_string_set_t ss, const char *s)
 {
-    rq_set_rb_add(ss->strings, strdup(s));
+    rq_set_rb_add(ss->strings, RQ_STRDUP(s));
 }
 
 int
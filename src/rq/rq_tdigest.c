@@ -0,0 +1,381 @@
+/*
+** rq_tdigest.c
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#include "rq_tdigest.h"
+#include "rq_math.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+static int
+centroid_cmp(const void *p1, const void *p2)
+{
+    const struct rq_tdigest_centroid *c1 = (const struct rq_tdigest_centroid *)p1;
+    const struct rq_tdigest_centroid *c2 = (const struct rq_tdigest_centroid *)p2;
+
+    if (c1->mean < c2->mean)
+        return -1;
+    if (c1->mean > c2->mean)
+        return 1;
+    return 0;
+}
+
+/* The k1 scale function, which maps a quantile to the "size" index
+   that limits how much weight a centroid may hold. */
+static double
+scale_k(double compression, double q)
+{
+    return compression / (2.0 * M_PI) * asin(2.0 * q - 1.0);
+}
+
+static double
+scale_k_inverse(double compression, double k)
+{
+    double x = k * 2.0 * M_PI / compression;
+    if (x >= M_PI_2)
+        return 1.0;
+    return (sin(x) + 1.0) / 2.0;
+}
+
+/* Merge the buffered values into the centroids. */
+static void
+tdigest_compress(rq_tdigest_t td)
+{
+    struct rq_tdigest_centroid *all = td->buffer;
+    unsigned int n;
+    unsigned int count = 0;
+    unsigned int i;
+    struct rq_tdigest_centroid cur;
+    double w_so_far = 0.0;
+    double w_limit;
+    double total = td->total_weight;
+
+    if (td->num_buffered == 0)
+        return;
+
+    /* the buffer has room for all the existing centroids too */
+    memcpy(all + td->num_buffered, td->centroids, td->num_centroids * sizeof(struct rq_tdigest_centroid));
+    n = td->num_buffered + td->num_centroids;
+    qsort(all, n, sizeof(struct rq_tdigest_centroid), centroid_cmp);
+
+    cur = all[0];
+    w_limit = total * scale_k_inverse(td->compression, scale_k(td->compression, 0.0) + 1.0);
+
+    for (i = 1; i < n; i++)
+    {
+        double proposed = w_so_far + cur.weight + all[i].weight;
+
+        if (proposed <= w_limit || count == td->max_centroids - 1)
+        {
+            cur.weight += all[i].weight;
+            cur.mean += (all[i].mean - cur.mean) * all[i].weight / cur.weight;
+        }
+        else
+        {
+            td->centroids[count++] = cur;
+            w_so_far += cur.weight;
+            w_limit = total * scale_k_inverse(
+                td->compression, 
+                scale_k(td->compression, w_so_far / total) + 1.0
+                );
+            cur = all[i];
+        }
+    }
+
+    td->centroids[count++] = cur;
+    td->num_centroids = count;
+    td->num_buffered = 0;
+}
+
+/* Get the j'th knot of the piecewise linear quantile function. Knot
+   0 is the minimum, knot num_centroids+1 the maximum, and the
+   others are the centroid means positioned at the middle of their
+   weight. */
+static void
+tdigest_knot(rq_tdigest_t td, unsigned int j, double *cum_weight, double *u, double *v)
+{
+    if (j == 0)
+    {
+        *u = 0.0;
+        *v = td->min;
+    }
+    else if (j > td->num_centroids)
+    {
+        *u = 1.0;
+        *v = td->max;
+    }
+    else
+    {
+        const struct rq_tdigest_centroid *c = td->centroids + (j - 1);
+        *u = (*cum_weight + c->weight / 2.0) / td->total_weight;
+        *v = c->mean;
+        *cum_weight += c->weight;
+    }
+}
+
+RQ_EXPORT int
+rq_tdigest_is_null(rq_tdigest_t obj)
+{
+    return (obj == NULL);
+}
+
+RQ_EXPORT rq_tdigest_t
+rq_tdigest_alloc(double compression)
+{
+    struct rq_tdigest *td = (struct rq_tdigest *)RQ_CALLOC(1, sizeof(struct rq_tdigest));
+
+    if (compression < 10.0)
+        compression = 10.0;
+
+    td->compression = compression;
+    td->max_centroids = (unsigned int)ceil(2.0 * compression) + 10;
+    td->max_buffered = (unsigned int)ceil(5.0 * compression);
+    td->centroids = (struct rq_tdigest_centroid *)RQ_CALLOC(td->max_centroids, sizeof(struct rq_tdigest_centroid));
+    td->buffer = (struct rq_tdigest_centroid *)RQ_CALLOC(td->max_buffered + td->max_centroids, sizeof(struct rq_tdigest_centroid));
+
+    return td;
+}
+
+RQ_EXPORT void
+rq_tdigest_free(rq_tdigest_t td)
+{
+    RQ_FREE(td->centroids);
+    RQ_FREE(td->buffer);
+    RQ_FREE(td);
+}
+
+RQ_EXPORT void
+rq_tdigest_clear(rq_tdigest_t td)
+{
+    td->num_centroids = 0;
+    td->num_buffered = 0;
+    td->total_weight = 0.0;
+    td->min = 0.0;
+    td->max = 0.0;
+}
+
+RQ_EXPORT void
+rq_tdigest_add_weighted(rq_tdigest_t td, double x, double weight)
+{
+    if (weight <= 0.0 || x != x)
+        return;
+
+    if (td->total_weight == 0.0)
+        td->min = td->max = x;
+    else if (x < td->min)
+        td->min = x;
+    else if (x > td->max)
+        td->max = x;
+
+    td->buffer[td->num_buffered].mean = x;
+    td->buffer[td->num_buffered].weight = weight;
+    td->num_buffered++;
+    td->total_weight += weight;
+
+    if (td->num_buffered == td->max_buffered)
+        tdigest_compress(td);
+}
+
+RQ_EXPORT void
+rq_tdigest_add(rq_tdigest_t td, double x)
+{
+    rq_tdigest_add_weighted(td, x, 1.0);
+}
+
+RQ_EXPORT void
+rq_tdigest_add_array(rq_tdigest_t td, const double *inputs, unsigned long num_inputs)
+{
+    unsigned long i;
+
+    for (i = 0; i < num_inputs; i++)
+        rq_tdigest_add_weighted(td, inputs[i], 1.0);
+}
+
+RQ_EXPORT void
+rq_tdigest_merge(rq_tdigest_t dst, rq_tdigest_t src)
+{
+    unsigned int i;
+    double min = src->min;
+    double max = src->max;
+
+    if (src->total_weight == 0.0)
+        return;
+
+    tdigest_compress(src);
+
+    for (i = 0; i < src->num_centroids; i++)
+        rq_tdigest_add_weighted(dst, src->centroids[i].mean, src->centroids[i].weight);
+
+    /* the extremes of the source may have been averaged into its
+       centroids */
+    if (min < dst->min)
+        dst->min = min;
+    if (max > dst->max)
+        dst->max = max;
+}
+
+RQ_EXPORT double
+rq_tdigest_get_count(rq_tdigest_t td)
+{
+    return td->total_weight;
+}
+
+RQ_EXPORT double
+rq_tdigest_quantile(rq_tdigest_t td, double q)
+{
+    double cum_weight = 0.0;
+    double u0;
+    double v0;
+    unsigned int j;
+
+    if (td->total_weight == 0.0)
+        return 0.0;
+    if (q <= 0.0)
+        return td->min;
+    if (q >= 1.0)
+        return td->max;
+
+    tdigest_compress(td);
+
+    tdigest_knot(td, 0, &cum_weight, &u0, &v0);
+
+    for (j = 1; j <= td->num_centroids + 1; j++)
+    {
+        double u1;
+        double v1;
+
+        tdigest_knot(td, j, &cum_weight, &u1, &v1);
+
+        if (q <= u1)
+        {
+            if (u1 <= u0)
+                return v1;
+            return v0 + (v1 - v0) * (q - u0) / (u1 - u0);
+        }
+
+        u0 = u1;
+        v0 = v1;
+    }
+
+    return td->max;
+}
+
+RQ_EXPORT double
+rq_tdigest_cdf(rq_tdigest_t td, double x)
+{
+    double cum_weight = 0.0;
+    double u0;
+    double v0;
+    unsigned int j;
+
+    if (td->total_weight == 0.0 || x < td->min)
+        return 0.0;
+    if (x >= td->max)
+        return 1.0;
+
+    tdigest_compress(td);
+
+    tdigest_knot(td, 0, &cum_weight, &u0, &v0);
+
+    for (j = 1; j <= td->num_centroids + 1; j++)
+    {
+        double u1;
+        double v1;
+
+        tdigest_knot(td, j, &cum_weight, &u1, &v1);
+
+        if (x < v1)
+        {
+            if (v1 <= v0)
+                return u1;
+            return u0 + (u1 - u0) * (x - v0) / (v1 - v0);
+        }
+
+        u0 = u1;
+        v0 = v1;
+    }
+
+    return 1.0;
+}
+
+RQ_EXPORT double
+rq_tdigest_tail_mean(rq_tdigest_t td, double q_lo, double q_hi)
+{
+    double cum_weight = 0.0;
+    double integral = 0.0;
+    double u0;
+    double v0;
+    unsigned int j;
+
+    if (q_lo < 0.0)
+        q_lo = 0.0;
+    if (q_hi > 1.0)
+        q_hi = 1.0;
+    if (td->total_weight == 0.0 || q_hi <= q_lo)
+        return rq_tdigest_quantile(td, q_lo);
+
+    tdigest_compress(td);
+
+    /* integrate the piecewise linear quantile function exactly */
+    tdigest_knot(td, 0, &cum_weight, &u0, &v0);
+
+    for (j = 1; j <= td->num_centroids + 1; j++)
+    {
+        double u1;
+        double v1;
+        double a;
+        double b;
+
+        tdigest_knot(td, j, &cum_weight, &u1, &v1);
+
+        a = (u0 > q_lo ? u0 : q_lo);
+        b = (u1 < q_hi ? u1 : q_hi);
+
+        if (b > a && u1 > u0)
+        {
+            double slope = (v1 - v0) / (u1 - u0);
+            double va = v0 + slope * (a - u0);
+            double vb = v0 + slope * (b - u0);
+            integral += 0.5 * (va + vb) * (b - a);
+        }
+
+        u0 = u1;
+        v0 = v1;
+    }
+
+    return integral / (q_hi - q_lo);
+}
+
+RQ_EXPORT double
+rq_tdigest_value_at_risk(rq_tdigest_t td, double alpha, short losses_positive)
+{
+    if (losses_positive)
+        return rq_tdigest_quantile(td, alpha);
+    return -rq_tdigest_quantile(td, 1.0 - alpha);
+}
+
+RQ_EXPORT double
+rq_tdigest_expected_shortfall(rq_tdigest_t td, double alpha, short losses_positive)
+{
+    if (losses_positive)
+        return rq_tdigest_tail_mean(td, alpha, 1.0);
+    return -rq_tdigest_tail_mean(td, 0.0, 1.0 - alpha);
+}
@@ -0,0 +1,140 @@
+/**
+ * @file
+ *
+ * A t-digest, for estimating quantiles and tail expectations of a stream of values in bounded memory.
+ */
+/*
+** rq_tdigest.h
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#ifndef rq_tdigest_h
+#define rq_tdigest_h
+
+#include "rq_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#if 0
+} // purely to not screw up my indenting...
+#endif
+#endif
+
+/* The t-digest (Dunning) summarizes a distribution as a sorted list
+   of weighted centroids, where the centroids are kept small in the
+   tails. This makes it accurate for the extreme quantiles that VaR
+   and expected shortfall need, in memory proportional to the
+   compression parameter rather than the number of values. Digests
+   built by separate threads can be merged.
+*/
+
+/** A weighted centroid.
+ */
+struct rq_tdigest_centroid {
+    double mean;
+    double weight;
+};
+
+typedef struct rq_tdigest {
+    double compression;
+    unsigned int max_centroids;
+    unsigned int num_centroids;
+    struct rq_tdigest_centroid *centroids; /**< sorted by mean */
+    unsigned int max_buffered;
+    unsigned int num_buffered;
+    struct rq_tdigest_centroid *buffer; /**< values not yet merged */
+    double total_weight;
+    double min;
+    double max;
+} *rq_tdigest_t;
+
+/** Test whether the rq_tdigest is NULL */
+RQ_EXPORT int rq_tdigest_is_null(rq_tdigest_t obj);
+
+/** Allocate a new t-digest. A compression of 100 to 200 gives
+ * quantile errors of a few parts in 10^4 in the body of the
+ * distribution and much better in the tails.
+ */
+RQ_EXPORT rq_tdigest_t rq_tdigest_alloc(double compression);
+
+/** Free a t-digest.
+ */
+RQ_EXPORT void rq_tdigest_free(rq_tdigest_t td);
+
+/** Remove all the values from the t-digest.
+ */
+RQ_EXPORT void rq_tdigest_clear(rq_tdigest_t td);
+
+/** Add a value to the t-digest.
+ */
+RQ_EXPORT void rq_tdigest_add(rq_tdigest_t td, double x);
+
+/** Add a value with a weight to the t-digest.
+ */
+RQ_EXPORT void rq_tdigest_add_weighted(rq_tdigest_t td, double x, double weight);
+
+/** Add an array of values (such as a monte-carlo terminal
+ * distribution) to the t-digest. The array isn't copied.
+ */
+RQ_EXPORT void rq_tdigest_add_array(rq_tdigest_t td, const double *inputs, unsigned long num_inputs);
+
+/** Merge the values summarized in 'src' into 'dst'.
+ */
+RQ_EXPORT void rq_tdigest_merge(rq_tdigest_t dst, rq_tdigest_t src);
+
+/** Get the total weight (the number of values, if they were
+ * unweighted) added to the t-digest.
+ */
+RQ_EXPORT double rq_tdigest_get_count(rq_tdigest_t td);
+
+/** Estimate the q'th quantile, 0 <= q <= 1.
+ */
+RQ_EXPORT double rq_tdigest_quantile(rq_tdigest_t td, double q);
+
+/** Estimate the fraction of values less than or equal to x.
+ */
+RQ_EXPORT double rq_tdigest_cdf(rq_tdigest_t td, double x);
+
+/** Estimate the mean of the values between the q_lo and q_hi
+ * quantiles.
+ */
+RQ_EXPORT double rq_tdigest_tail_mean(rq_tdigest_t td, double q_lo, double q_hi);
+
+/** Estimate the value at risk at confidence level alpha (eg 0.99).
+ *
+ * If 'losses_positive' is non-zero the values are losses and the
+ * VaR is the alpha quantile, otherwise they are profits and the VaR
+ * is the negated 1 - alpha quantile.
+ */
+RQ_EXPORT double rq_tdigest_value_at_risk(rq_tdigest_t td, double alpha, short losses_positive);
+
+/** Estimate the expected shortfall (the mean loss beyond the VaR)
+ * at confidence level alpha. See rq_tdigest_value_at_risk() for
+ * 'losses_positive'.
+ */
+RQ_EXPORT double rq_tdigest_expected_shortfall(rq_tdigest_t td, double alpha, short losses_positive);
+
+#ifdef __cplusplus
+#if 0
+{ // purely to not screw up my indenting...
+#endif
+};
+#endif
+
+#endif
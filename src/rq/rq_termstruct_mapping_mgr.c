@@ -127,3 +127,36 @@ rq_termstruct_mapping_mgr_find(rq_termstruct_mapping_mgr_t termstruct_mapping_mg
 
     return termstruct_mapping;
 }
+
+struct traverse_data {
+    void *user_data;
+    void (*func)(void *user_data, rq_termstruct_mapping_t termstruct_mapping);
+};
+
+static void
+traverse_mapping(void *user_data, void *node_data)
+{
+    struct traverse_data *td = (struct traverse_data *)user_data;
+    (*td->func)(td->user_data, (rq_termstruct_mapping_t)node_data);
+}
+
+static void
+traverse_node(void *user_data, void *node_data)
+{
+    struct rq_mapping_mgr_node *n = (struct rq_mapping_mgr_node *)node_data;
+    rq_tree_rb_traverse_inorder(n->asset_mappings, user_data, traverse_mapping);
+}
+
+RQ_EXPORT void
+rq_termstruct_mapping_mgr_traverse(
+    rq_termstruct_mapping_mgr_t termstruct_mapping_mgr, 
+    void *user_data, 
+    void (*func)(void *user_data, rq_termstruct_mapping_t termstruct_mapping)
+    )
+{
+    struct traverse_data td;
+
+    td.user_data = user_data;
+    td.func = func;
+    rq_tree_rb_traverse_inorder(termstruct_mapping_mgr->termstruct_mappings, &td, traverse_node);
+}
@@ -65,6 +65,11 @@ RQ_EXPORT void rq_termstruct_mapping_mgr_add(rq_termstruct_mapping_mgr_t termstr
  */
 RQ_EXPORT rq_termstruct_mapping_t rq_termstruct_mapping_mgr_find(rq_termstruct_mapping_mgr_t termstruct_mapping_mgr, const char *asset_id, const char *termstruct_group_id);
 
+/** Call func for every term structure mapping in the manager, in 
+ * order of asset id and then termstructure group id.
+ */
+RQ_EXPORT void rq_termstruct_mapping_mgr_traverse(rq_termstruct_mapping_mgr_t termstruct_mapping_mgr, void *user_data, void (*func)(void *user_data, rq_termstruct_mapping_t termstruct_mapping));
+
 
 #ifdef __cplusplus
 #if 0
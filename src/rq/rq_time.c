@@ -307,12 +307,12 @@ main(int argc, char **argv)
                         unsigned int sz = (unsigned int)atoi(bufsz);
                         char *ob = NULL;
                         if (sz > 0)
-                            ob = (char *)malloc(sz);
+                            ob = (char *)RQ_MALLOC(sz);
 
                         rq_time_to_string(ob, sz, buf, tm);
                         printf("Time: '%s'\n", ob);
                         if (ob)
-                            free(ob);
+                            RQ_FREE(ob);
                     }
                     else
                         break;
@@ -23,7 +23,9 @@
 */
 #include "rq_trade.h"
 #include "rq_array.h"
+#include "rq_object_schema_node.h"
 #include <stdlib.h>
+#include <string.h>
 
 RQ_EXPORT int
 rq_trade_is_null(rq_trade_t obj)
@@ -114,4 +116,99 @@ rq_trade_free(rq_trade_t trade)
     }
 }
 
+static void *
+rq_trade_constructor()
+{
+    return rq_trade_alloc(0, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+}
+
+static void
+rq_trade_destructor(void *p)
+{
+    rq_trade_free((rq_trade_t)p);
+}
+
+static void *
+rq_trade_cloner(void *p)
+{
+    rq_trade_t trade = (rq_trade_t)p;
+
+    return rq_trade_alloc(
+        trade->trd_id,
+        trade->trd_key,
+        trade->trd_insert_time,
+        trade->trd_usr_id,
+        trade->trd_tst_code,
+        trade->trd_tty_code,
+        trade->trd_bys_code,
+        trade->trd_cpt_key,
+        trade->trd_bok_code,
+        trade->trd_data
+        );
+}
+
+static void
+set_field(const char **field, const char *value)
+{
+    if (*field)
+        RQ_FREE((char *)*field);
+    *field = (const char *)RQ_STRDUP(value);
+}
 
+static void
+rq_trade_set_value_string(void *p, const char *property_name, const char *value)
+{
+    rq_trade_t trade = (rq_trade_t)p;
+
+    if (!strcmp(property_name, "@key"))
+        set_field(&trade->trd_key, value);
+    else if (!strcmp(property_name, "insertTime"))
+        set_field(&trade->trd_insert_time, value);
+    else if (!strcmp(property_name, "user"))
+        set_field(&trade->trd_usr_id, value);
+    else if (!strcmp(property_name, "status"))
+        set_field(&trade->trd_tst_code, value);
+    else if (!strcmp(property_name, "type"))
+        set_field(&trade->trd_tty_code, value);
+    else if (!strcmp(property_name, "buySell"))
+        set_field(&trade->trd_bys_code, value);
+    else if (!strcmp(property_name, "counterparty"))
+        set_field(&trade->trd_cpt_key, value);
+    else if (!strcmp(property_name, "book"))
+        set_field(&trade->trd_bok_code, value);
+    else if (!strcmp(property_name, "data"))
+        set_field(&trade->trd_data, value);
+}
+
+static void
+rq_trade_set_value_integer(void *p, const char *property_name, long value)
+{
+    if (!strcmp(property_name, "@id"))
+        ((rq_trade_t)p)->trd_id = (int)value;
+}
+
+void 
+rq_trade_init_object_schemas(rq_object_schema_mgr_t schema_mgr)
+{
+    static const char *string_properties[] = {
+        "@key", "insertTime", "user", "status", "type", "buySell", "counterparty", "book", "data", NULL
+    };
+    rq_object_schema_t trade_schema = rq_object_schema_alloc(
+        "Trade",
+        rq_trade_constructor,
+        rq_trade_destructor,
+        rq_trade_cloner,
+        rq_trade_set_value_string,
+        rq_trade_set_value_integer,
+        NULL,
+        NULL,
+        NULL
+        );
+    unsigned int i;
+
+    rq_object_schema_add_property(trade_schema, rq_object_schema_node_alloc("@id", "integer"));
+    for (i = 0; string_properties[i]; i++)
+        rq_object_schema_add_property(trade_schema, rq_object_schema_node_alloc(string_properties[i], "string"));
+
+    rq_object_schema_mgr_add(schema_mgr, trade_schema);
+}
@@ -37,6 +37,7 @@
 #include "rq_trade_status.h"
 #include "rq_product.h"
 #include "rq_array.h"
+#include "rq_object_schema_mgr.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -63,9 +64,21 @@ typedef struct rq_trade {
 RQ_EXPORT int rq_trade_is_null(rq_trade_t obj);
 
 /**
- * Allocate a new trade
+ * Allocate a new trade. The strings are copied.
  */
-RQ_EXPORT rq_trade_t rq_trade_alloc();
+RQ_EXPORT rq_trade_t
+rq_trade_alloc(
+    int trd_id,
+    const char *trd_key,
+    const char *trd_insert_time,
+    const char *trd_usr_id,
+    const char *trd_tst_code,
+    const char *trd_tty_code,
+    const char *trd_bys_code,
+    const char *trd_cpt_key,
+    const char *trd_bok_code,
+    const char *trd_data
+    );
 
 /**
  * Free an allocated trade
@@ -117,6 +130,16 @@ RQ_EXPORT rq_product_t rq_trade_get_product_at(rq_trade_t trade, unsigned int of
  */
 RQ_EXPORT void rq_trade_add_product(rq_trade_t trade, rq_product_t product);
 
+/** Initialize the object schema for the Trade type, which reads
+ * trades written as
+ *
+ * <trade id="1" key="T1"><type>SWAP</type><book>RATES</book>...</trade>
+ *
+ * with insertTime, user, status, type, buySell, counterparty, book
+ * and data elements.
+ */
+RQ_EXPORT void rq_trade_init_object_schemas(rq_object_schema_mgr_t schema_mgr);
+
 #ifdef __cplusplus
 #if 0
 { // purely to not screw up my indenting...
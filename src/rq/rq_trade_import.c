@@ -0,0 +1,445 @@
+/*
+** rq_trade_import.c
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#include "rq_trade_import.h"
+#include "rq_error.h"
+#include "rq_object_builder_xml.h"
+#include "rq_object_schema_mgr.h"
+#include <stdlib.h>
+#include <string.h>
+#ifdef RQ_THREADS
+#include <pthread.h>
+#endif
+
+struct rq_trade_import_consumer {
+    void (*trade_func)(void *, rq_trade_t);
+    void *trade_func_data;
+};
+
+/* Build every trade on the path, handing each to object_func. */
+static rq_error_code
+build_trades(rq_stream_t stream, const char *trade_path, void (*object_func)(void *, void *), void *object_func_data, unsigned long *num_trades)
+{
+    rq_object_schema_mgr_t schema_mgr = rq_object_schema_mgr_alloc();
+    rq_object_builder_t builder = rq_object_builder_xml_alloc();
+    rq_error_code err;
+
+    rq_trade_init_object_schemas(schema_mgr);
+    err = rq_object_builder_build_all(builder, stream, schema_mgr, trade_path, "Trade", object_func, object_func_data, num_trades);
+
+    rq_object_builder_free(builder);
+    rq_object_schema_mgr_free(schema_mgr);
+
+    return err;
+}
+
+static void
+consume_trade(void *data, void *object)
+{
+    struct rq_trade_import_consumer *consumer = (struct rq_trade_import_consumer *)data;
+
+    (*consumer->trade_func)(consumer->trade_func_data, (rq_trade_t)object);
+}
+
+#ifdef RQ_THREADS
+
+/* A bounded queue of pointers, which the producer closes when it has
+   nothing more to put. */
+struct rq_trade_import_queue {
+    void **items;
+    unsigned int size;
+    unsigned int head;
+    unsigned int count;
+    int closed;
+    pthread_mutex_t mutex;
+    pthread_cond_t not_empty;
+    pthread_cond_t not_full;
+};
+
+struct rq_trade_import_block {
+    char *buf;
+    int len;
+};
+
+struct rq_trade_import_pipeline {
+    rq_stream_t stream;
+    const char *trade_path;
+    struct rq_trade_import_consumer consumer;
+    int direct; /**< build straight into the consumer, for want of a thread */
+    unsigned long num_built;
+    rq_error_code err; /**< from parsing the blocks */
+    int read_error; /**< set by the reader before it closes the full blocks */
+
+    struct rq_trade_import_block blocks[RQ_TRADE_IMPORT_NUM_BLOCKS];
+    struct rq_trade_import_queue free_blocks; /**< for the reader to fill */
+    struct rq_trade_import_queue full_blocks; /**< in stream order, for the parser */
+    struct rq_trade_import_queue trades;
+
+    /* the parser's side of the full blocks */
+    struct rq_trade_import_block *block;
+    int block_pos;
+    long position;
+    int at_end;
+};
+
+static void
+queue_init(struct rq_trade_import_queue *q, unsigned int size)
+{
+    q->items = (void **)RQ_MALLOC(size * sizeof(void *));
+    q->size = size;
+    q->head = 0;
+    q->count = 0;
+    q->closed = 0;
+    pthread_mutex_init(&q->mutex, NULL);
+    pthread_cond_init(&q->not_empty, NULL);
+    pthread_cond_init(&q->not_full, NULL);
+}
+
+static void
+queue_destroy(struct rq_trade_import_queue *q)
+{
+    pthread_cond_destroy(&q->not_full);
+    pthread_cond_destroy(&q->not_empty);
+    pthread_mutex_destroy(&q->mutex);
+    RQ_FREE(q->items);
+}
+
+static void
+queue_put(struct rq_trade_import_queue *q, void *item)
+{
+    pthread_mutex_lock(&q->mutex);
+    while (q->count == q->size)
+        pthread_cond_wait(&q->not_full, &q->mutex);
+    q->items[(q->head + q->count++) % q->size] = item;
+    pthread_cond_signal(&q->not_empty);
+    pthread_mutex_unlock(&q->mutex);
+}
+
+/* Returns NULL once the queue is closed and empty. */
+static void *
+queue_get(struct rq_trade_import_queue *q)
+{
+    void *item = NULL;
+
+    pthread_mutex_lock(&q->mutex);
+    while (q->count == 0 && !q->closed)
+        pthread_cond_wait(&q->not_empty, &q->mutex);
+    if (q->count > 0)
+    {
+        item = q->items[q->head];
+        q->head = (q->head + 1) % q->size;
+        q->count--;
+        pthread_cond_signal(&q->not_full);
+    }
+    pthread_mutex_unlock(&q->mutex);
+
+    return item;
+}
+
+static void
+queue_close(struct rq_trade_import_queue *q)
+{
+    pthread_mutex_lock(&q->mutex);
+    q->closed = 1;
+    pthread_cond_broadcast(&q->not_empty);
+    pthread_mutex_unlock(&q->mutex);
+}
+
+static int
+queue_is_closed(struct rq_trade_import_queue *q)
+{
+    int closed;
+
+    pthread_mutex_lock(&q->mutex);
+    closed = q->closed;
+    pthread_mutex_unlock(&q->mutex);
+
+    return closed;
+}
+
+/* The first stage: read the stream into free blocks, until the stream
+   ends or the parser closes the free blocks to say it wants no
+   more. */
+static void *
+read_blocks(void *data)
+{
+    struct rq_trade_import_pipeline *pl = (struct rq_trade_import_pipeline *)data;
+    struct rq_trade_import_block *block;
+
+    while ((block = (struct rq_trade_import_block *)queue_get(&pl->free_blocks)) != NULL &&
+           !queue_is_closed(&pl->free_blocks))
+    {
+        block->len = rq_stream_read(pl->stream, block->buf, RQ_TRADE_IMPORT_BLOCK_SIZE);
+        if (block->len <= 0)
+        {
+            if (block->len < 0)
+                pl->read_error = 1;
+            queue_put(&pl->free_blocks, block);
+            break;
+        }
+        queue_put(&pl->full_blocks, block);
+    }
+    queue_close(&pl->full_blocks);
+
+    return NULL;
+}
+
+/* The parser reads the full blocks through a stream, getting what is
+   left of one block at a time. */
+static int
+block_stream_open(void *data)
+{
+    return 0;
+}
+
+static short
+block_stream_is_open(void *data)
+{
+    return 1;
+}
+
+static short
+block_stream_at_end(void *data)
+{
+    return (short)((struct rq_trade_import_pipeline *)data)->at_end;
+}
+
+static void
+block_stream_close(void *data)
+{
+}
+
+static int
+block_stream_read(void *data, char *buf, int num_bytes)
+{
+    struct rq_trade_import_pipeline *pl = (struct rq_trade_import_pipeline *)data;
+    int len;
+
+    if (!pl->block)
+    {
+        pl->block = (struct rq_trade_import_block *)queue_get(&pl->full_blocks);
+        pl->block_pos = 0;
+        if (!pl->block)
+        {
+            pl->at_end = 1;
+            return pl->read_error ? -1 : 0;
+        }
+    }
+
+    len = pl->block->len - pl->block_pos;
+    if (len > num_bytes)
+        len = num_bytes;
+    memcpy(buf, pl->block->buf + pl->block_pos, len);
+    pl->block_pos += len;
+    pl->position += len;
+
+    if (pl->block_pos == pl->block->len)
+    {
+        queue_put(&pl->free_blocks, pl->block);
+        pl->block = NULL;
+    }
+
+    return len;
+}
+
+static int
+block_stream_write(void *data, const char *buf, int num_bytes)
+{
+    return -1;
+}
+
+static long
+block_stream_tell(void *data)
+{
+    return ((struct rq_trade_import_pipeline *)data)->position;
+}
+
+static rq_error_code
+block_stream_seek(void *data, long offset)
+{
+    return RQ_FAILED;
+}
+
+static void
+block_stream_rewind(void *data)
+{
+}
+
+static void
+block_stream_free(void *data)
+{
+}
+
+static struct rq_stream_callbacks block_stream_callbacks = {
+    block_stream_open,
+    block_stream_is_open,
+    block_stream_at_end,
+    block_stream_close,
+    block_stream_read,
+    block_stream_write,
+    block_stream_tell,
+    block_stream_seek,
+    block_stream_rewind,
+    block_stream_free,
+    NULL
+};
+
+static void
+queue_trade(void *data, void *object)
+{
+    struct rq_trade_import_pipeline *pl = (struct rq_trade_import_pipeline *)data;
+
+    if (pl->direct)
+        consume_trade(&pl->consumer, object);
+    else
+        queue_put(&pl->trades, object);
+}
+
+/* The second stage: parse the blocks and build the trades. */
+static void *
+build_blocks(void *data)
+{
+    struct rq_trade_import_pipeline *pl = (struct rq_trade_import_pipeline *)data;
+    rq_stream_t stream = _rq_stream_alloc("stream_trade_import", pl, &block_stream_callbacks);
+
+    pl->err = build_trades(stream, pl->trade_path, queue_trade, pl, &pl->num_built);
+    rq_stream_free(stream);
+
+    /* Stop the reader, in case the parser finished early, and hand
+       back anything the parser stopped short of so that the reader
+       can get to the close. */
+    queue_close(&pl->free_blocks);
+    if (pl->block)
+        queue_put(&pl->free_blocks, pl->block);
+    while ((pl->block = (struct rq_trade_import_block *)queue_get(&pl->full_blocks)) != NULL)
+        queue_put(&pl->free_blocks, pl->block);
+
+    queue_close(&pl->trades);
+
+    return NULL;
+}
+
+static rq_error_code
+run_pipeline(rq_stream_t stream, const char *trade_path, struct rq_trade_import_consumer *consumer, unsigned long *num_trades)
+{
+    struct rq_trade_import_pipeline pl;
+    pthread_t reader;
+    pthread_t builder;
+    rq_error_code err;
+    rq_trade_t trade;
+    unsigned int i;
+
+    memset(&pl, 0, sizeof(pl));
+    pl.stream = stream;
+    pl.trade_path = trade_path;
+    pl.consumer = *consumer;
+
+    queue_init(&pl.free_blocks, RQ_TRADE_IMPORT_NUM_BLOCKS);
+    queue_init(&pl.full_blocks, RQ_TRADE_IMPORT_NUM_BLOCKS);
+    queue_init(&pl.trades, RQ_TRADE_IMPORT_QUEUE_SIZE);
+    for (i = 0; i < RQ_TRADE_IMPORT_NUM_BLOCKS; i++)
+    {
+        pl.blocks[i].buf = (char *)RQ_MALLOC(RQ_TRADE_IMPORT_BLOCK_SIZE);
+        queue_put(&pl.free_blocks, &pl.blocks[i]);
+    }
+
+    *num_trades = 0;
+    if (pthread_create(&reader, NULL, read_blocks, &pl) != 0)
+        err = build_trades(stream, trade_path, consume_trade, consumer, num_trades);
+    else
+    {
+        if (pthread_create(&builder, NULL, build_blocks, &pl) != 0)
+        {
+            pl.direct = 1;
+            build_blocks(&pl);
+            *num_trades = pl.num_built;
+        }
+        else
+        {
+            while ((trade = (rq_trade_t)queue_get(&pl.trades)) != NULL)
+            {
+                consume_trade(consumer, trade);
+                (*num_trades)++;
+            }
+            pthread_join(builder, NULL);
+        }
+        pthread_join(reader, NULL);
+        err = pl.err;
+    }
+
+    for (i = 0; i < RQ_TRADE_IMPORT_NUM_BLOCKS; i++)
+        RQ_FREE(pl.blocks[i].buf);
+    queue_destroy(&pl.trades);
+    queue_destroy(&pl.full_blocks);
+    queue_destroy(&pl.free_blocks);
+
+    return err;
+}
+
+#endif
+
+RQ_EXPORT rq_error_code
+rq_trade_import(
+    rq_stream_t stream,
+    const char *trade_path,
+    void (*trade_func)(void *trade_func_data, rq_trade_t trade),
+    void *trade_func_data,
+    unsigned long *num_trades
+    )
+{
+    struct rq_trade_import_consumer consumer;
+    unsigned long n;
+    rq_error_code err;
+
+    if (!rq_stream_is_open(stream) && rq_stream_open(stream) != RQ_OK)
+        return RQ_FAILED;
+
+    consumer.trade_func = trade_func;
+    consumer.trade_func_data = trade_func_data;
+
+#ifdef RQ_THREADS
+    err = run_pipeline(stream, trade_path, &consumer, &n);
+#else
+    err = build_trades(stream, trade_path, consume_trade, &consumer, &n);
+#endif
+
+    if (num_trades)
+        *num_trades = n;
+
+    return err;
+}
+
+static void
+add_to_mgr(void *data, rq_trade_t trade)
+{
+    rq_trade_mgr_add((rq_trade_mgr_t)data, trade);
+}
+
+RQ_EXPORT rq_error_code
+rq_trade_import_to_mgr(
+    rq_stream_t stream,
+    const char *trade_path,
+    rq_trade_mgr_t trade_mgr,
+    unsigned long *num_trades
+    )
+{
+    return rq_trade_import(stream, trade_path, add_to_mgr, trade_mgr, num_trades);
+}
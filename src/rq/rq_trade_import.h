@@ -0,0 +1,121 @@
+/**
+ * @file
+ *
+ * Import trades from an XML stream of any size in bounded memory.
+ */
+/*
+** rq_trade_import.h
+**
+** Copyright (C) 2008 Brett Hutley
+**
+** This file is part of the Risk Quantify Library
+**
+** Risk Quantify is free software; you can redistribute it and/or
+** modify it under the terms of the GNU Library General Public
+** License as published by the Free Software Foundation; either
+** version 2 of the License, or (at your option) any later version.
+**
+** Risk Quantify is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+** Library General Public License for more details.
+**
+** You should have received a copy of the GNU Library General Public
+** License along with Risk Quantify; if not, write to the Free
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+#ifndef rq_trade_import_h
+#define rq_trade_import_h
+
+/* -- includes ----------------------------------------------------- */
+#include "rq_config.h"
+#include "rq_defs.h"
+#include "rq_stream.h"
+#include "rq_trade.h"
+#include "rq_trade_mgr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#if 0
+} // purely to not screw up my indenting...
+#endif
+#endif
+
+/*
+ * Trades are read with the Trade object schema (see
+ * rq_trade_init_object_schemas()) from every element on the trade
+ * path, for example "trades/trade".
+ *
+ * With thread support (RQ_THREADS) the import is a pipeline of three
+ * stages. One thread reads the stream into blocks, a second parses
+ * the blocks and builds the trades, and the calling thread hands the
+ * trades to the consumer. The stages are joined by bounded queues, so
+ * however big the stream the import holds at most
+ * RQ_TRADE_IMPORT_NUM_BLOCKS blocks and RQ_TRADE_IMPORT_QUEUE_SIZE
+ * trades that the consumer hasn't taken. The stream is read on the
+ * first thread, so the consumer mustn't use it. Without thread
+ * support the stages run in turn on the calling thread, still a
+ * block at a time.
+ */
+
+/* -- defines ------------------------------------------------------ */
+
+/** The size of the blocks the stream is read in. */
+#define RQ_TRADE_IMPORT_BLOCK_SIZE 65536
+
+/** The number of blocks between reading and parsing. */
+#define RQ_TRADE_IMPORT_NUM_BLOCKS 4
+
+/** The number of trades between building and the consumer. */
+#define RQ_TRADE_IMPORT_QUEUE_SIZE 1024
+
+/* -- prototypes -------------------------------------------------- */
+
+/**
+ * Import the trades in a stream, handing each to trade_func. The
+ * consumer takes ownership of the trade, and is always called on
+ * the calling thread, in the order the trades appear in the stream.
+ * If the stream can't be read, or the document is malformed or cut
+ * short, the trades before the problem are still handed over and the
+ * rest of the stream isn't read.
+ *
+ * @param stream The stream of XML to read
+ * @param trade_path The path of the trade elements
+ * @param trade_func The consumer
+ * @param trade_func_data Passed to trade_func
+ * @param num_trades If not NULL, set to the number of trades imported
+ * @return RQ_OK, RQ_FAILED if the stream couldn't be opened,
+ * RQ_ERR_XML_PARSER_READ if it couldn't be read, or
+ * RQ_ERR_XML_PARSER_BAD_FORMAT if the document is malformed or ends
+ * early
+ */
+RQ_EXPORT rq_error_code
+rq_trade_import(
+    rq_stream_t stream,
+    const char *trade_path,
+    void (*trade_func)(void *trade_func_data, rq_trade_t trade),
+    void *trade_func_data,
+    unsigned long *num_trades
+    );
+
+/**
+ * Import the trades in a stream into a trade manager.
+ *
+ * @return As for rq_trade_import()
+ */
+RQ_EXPORT rq_error_code
+rq_trade_import_to_mgr(
+    rq_stream_t stream,
+    const char *trade_path,
+    rq_trade_mgr_t trade_mgr,
+    unsigned long *num_trades
+    );
+
+#ifdef __cplusplus
+#if 0
+{ // purely to not screw up my indenting...
+#endif
+};
+#endif
+
+#endif
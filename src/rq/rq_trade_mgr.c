@@ -1,5 +1,5 @@
 /*
-** rq_trade.c
+** rq_trade_mgr.c
 **
 ** Written by Brett Hutley - brett@hutley.net
 **
@@ -24,52 +24,153 @@
 #include "rq_trade_mgr.h"
 #include "rq_trade.h"
 #include <stdlib.h>
+#include <string.h>
 
 static int
 rq_trade_mgr_cmp(void *x, void *y)
 {
-    return ((int)x) != ((int)y);
+    return ((long)x) != ((long)y);
 }
 
 static unsigned int
 rq_trade_mgr_hash(void *x)
 {
-    return ((unsigned int)x);
+    return ((unsigned int)(long)x);
 }
 
-rq_trade_mgr_t
+static void
+rq_trade_segment_free(void *p)
+{
+    struct rq_trade_segment *segment = (struct rq_trade_segment *)p;
+    rq_array_free(segment->batches);
+    RQ_FREE(segment);
+}
+
+RQ_EXPORT rq_trade_mgr_t
 rq_trade_mgr_alloc()
 {
     rq_trade_mgr_t trade_mgr = (rq_trade_mgr_t)RQ_CALLOC(1, sizeof(struct rq_trade_mgr));
     trade_mgr->ht = rq_hashtable_init(rq_trade_mgr_cmp, rq_trade_mgr_hash);
+    trade_mgr->arena = rq_arena_alloc(0);
+    trade_mgr->segments = rq_array_alloc(rq_trade_segment_free);
     return trade_mgr;
 }
 
-void
+RQ_EXPORT void
 rq_trade_mgr_free(rq_trade_mgr_t trade_mgr)
 {
     if (trade_mgr)
     {
+        /* the trades themselves are in the arena */
         if (trade_mgr->ht)
-            rq_hashtable_free(trade_mgr->ht, rq_trade_free);
+            rq_hashtable_free(trade_mgr->ht, NULL);
+        rq_array_free(trade_mgr->segments);
+        rq_arena_free(trade_mgr->arena);
         RQ_FREE(trade_mgr);
     }
 }
 
-void
+static struct rq_trade_segment *
+find_segment(rq_trade_mgr_t trade_mgr, const char *trade_type)
+{
+    unsigned int i;
+
+    if (!trade_type)
+        trade_type = "";
+
+    for (i = 0; i < rq_array_size(trade_mgr->segments); i++)
+    {
+        struct rq_trade_segment *segment = (struct rq_trade_segment *)rq_array_get_at(trade_mgr->segments, i);
+        if (!strcmp(segment->trade_type, trade_type))
+            return segment;
+    }
+
+    return NULL;
+}
+
+RQ_EXPORT rq_trade_t
+rq_trade_mgr_add_trade(
+    rq_trade_mgr_t trade_mgr,
+    int trd_id,
+    const char *trd_key,
+    const char *trd_insert_time,
+    const char *trd_usr_id,
+    const char *trd_tst_code,
+    const char *trd_tty_code,
+    const char *trd_bys_code,
+    const char *trd_cpt_key,
+    const char *trd_bok_code,
+    const char *trd_data
+    )
+{
+    struct rq_trade_segment *segment = find_segment(trade_mgr, trd_tty_code);
+    unsigned int offset;
+    rq_trade_t batch;
+    rq_trade_t trade;
+
+    if (!segment)
+    {
+        segment = (struct rq_trade_segment *)RQ_MALLOC(sizeof(struct rq_trade_segment));
+        segment->trade_type = rq_arena_strdup(trade_mgr->arena, trd_tty_code ? trd_tty_code : "");
+        segment->num_trades = 0;
+        segment->batches = rq_array_alloc(NULL);
+        rq_array_push_back(trade_mgr->segments, segment);
+    }
+
+    offset = segment->num_trades % RQ_TRADE_MGR_BATCH_SIZE;
+    if (offset == 0)
+    {
+        batch = (rq_trade_t)rq_arena_malloc(trade_mgr->arena, RQ_TRADE_MGR_BATCH_SIZE * sizeof(struct rq_trade));
+        rq_array_push_back(segment->batches, batch);
+    }
+    else
+        batch = (rq_trade_t)rq_array_get_at(segment->batches, rq_array_size(segment->batches) - 1);
+
+    trade = &batch[offset];
+    trade->trd_id = trd_id;
+    trade->trd_key = rq_arena_strdup(trade_mgr->arena, trd_key);
+    trade->trd_insert_time = rq_arena_strdup(trade_mgr->arena, trd_insert_time);
+    trade->trd_usr_id = rq_arena_strdup(trade_mgr->arena, trd_usr_id);
+    trade->trd_tst_code = rq_arena_strdup(trade_mgr->arena, trd_tst_code);
+    trade->trd_tty_code = (trd_tty_code ? segment->trade_type : NULL);
+    trade->trd_bys_code = rq_arena_strdup(trade_mgr->arena, trd_bys_code);
+    trade->trd_cpt_key = rq_arena_strdup(trade_mgr->arena, trd_cpt_key);
+    trade->trd_bok_code = rq_arena_strdup(trade_mgr->arena, trd_bok_code);
+    trade->trd_data = rq_arena_strdup(trade_mgr->arena, trd_data);
+
+    segment->num_trades++;
+    trade_mgr->num_trades++;
+    rq_hashtable_insert(trade_mgr->ht, (void *)(long)trd_id, trade);
+
+    return trade;
+}
+
+RQ_EXPORT void
 rq_trade_mgr_add(rq_trade_mgr_t trade_mgr, rq_trade_t trade)
 {
     if (trade_mgr && trade)
     {
-        if (trade_mgr->ht)
-            rq_hashtable_insert(trade_mgr->ht, (void *)trade->trd_id, trade);
+        rq_trade_mgr_add_trade(
+            trade_mgr,
+            trade->trd_id,
+            trade->trd_key,
+            trade->trd_insert_time,
+            trade->trd_usr_id,
+            trade->trd_tst_code,
+            trade->trd_tty_code,
+            trade->trd_bys_code,
+            trade->trd_cpt_key,
+            trade->trd_bok_code,
+            trade->trd_data
+            );
+        rq_trade_free(trade);
     }
 }
 
-rq_trade_t
+RQ_EXPORT rq_trade_t
 rq_trade_mgr_get(rq_trade_mgr_t trade_mgr, long id)
 {
-    rq_trade_t *f = NULL;
+    rq_trade_t f = NULL;
 
     if (trade_mgr && id)
     {
@@ -80,7 +181,33 @@ rq_trade_mgr_get(rq_trade_mgr_t trade_mgr, long id)
     return f;
 }
 
-long
+RQ_EXPORT unsigned long
+rq_trade_mgr_size(rq_trade_mgr_t trade_mgr)
+{
+    return trade_mgr->num_trades;
+}
+
+RQ_EXPORT unsigned int
+rq_trade_mgr_get_trade_type_count(rq_trade_mgr_t trade_mgr)
+{
+    return rq_array_size(trade_mgr->segments);
+}
+
+RQ_EXPORT const char *
+rq_trade_mgr_get_trade_type_at(rq_trade_mgr_t trade_mgr, unsigned int offset)
+{
+    struct rq_trade_segment *segment = (struct rq_trade_segment *)rq_array_get_at(trade_mgr->segments, offset);
+    return segment->trade_type;
+}
+
+RQ_EXPORT unsigned long
+rq_trade_mgr_get_trade_type_size(rq_trade_mgr_t trade_mgr, const char *trade_type)
+{
+    struct rq_trade_segment *segment = find_segment(trade_mgr, trade_type);
+    return (segment ? segment->num_trades : 0);
+}
+
+RQ_EXPORT long
 rq_trade_mgr_load(rq_trade_mgr_t trade_mgr, sqlite3 *db)
 {
     sqlite3_stmt *stmt;
@@ -94,31 +221,21 @@ rq_trade_mgr_load(rq_trade_mgr_t trade_mgr, sqlite3 *db)
 
     for (row_count = 0; sqlite3_step(stmt) == SQLITE_ROW; row_count++)
     {
-        int trd_id = sqlite3_column_int(stmt, 0);
-        const char *trd_key = (const char *)sqlite3_column_text(stmt, 1);
-        const char *trd_insert_time = (const char *)sqlite3_column_text(stmt, 2);
-        const char *trd_usr_id = (const char *)sqlite3_column_text(stmt, 3);
-        const char *trd_tst_code = (const char *)sqlite3_column_text(stmt, 4);
-        const char *trd_tty_code = (const char *)sqlite3_column_text(stmt, 5);
-        const char *trd_bys_code = (const char *)sqlite3_column_text(stmt, 6);
-        const char *trd_cpt_key = (const char *)sqlite3_column_text(stmt, 7);
-        const char *trd_bok_code = (const char *)sqlite3_column_text(stmt, 8);
-        const char *trd_data = (const char *)sqlite3_column_text(stmt, 9);
-
-        rq_trade_t *trade = rq_trade_alloc(
-            trd_id,
-            trd_key,
-            trd_insert_time,
-            trd_usr_id,
-            trd_tst_code,
-            trd_tty_code,
-            trd_bys_code,
-            trd_cpt_key,
-            trd_bok_code,
-            trd_data
+        /* the column text is only valid until the next step, and is
+           copied straight into the manager. */
+        rq_trade_mgr_add_trade(
+            trade_mgr,
+            sqlite3_column_int(stmt, 0),
+            (const char *)sqlite3_column_text(stmt, 1),
+            (const char *)sqlite3_column_text(stmt, 2),
+            (const char *)sqlite3_column_text(stmt, 3),
+            (const char *)sqlite3_column_text(stmt, 4),
+            (const char *)sqlite3_column_text(stmt, 5),
+            (const char *)sqlite3_column_text(stmt, 6),
+            (const char *)sqlite3_column_text(stmt, 7),
+            (const char *)sqlite3_column_text(stmt, 8),
+            (const char *)sqlite3_column_text(stmt, 9)
             );
-        trade_mgr_add(trade);
-
     }
 
     sqlite3_finalize(stmt);
@@ -126,3 +243,46 @@ rq_trade_mgr_load(rq_trade_mgr_t trade_mgr, sqlite3 *db)
     return row_count;
 }
 
+RQ_EXPORT rq_trade_mgr_iterator_t
+rq_trade_mgr_iterator_alloc()
+{
+    return (rq_trade_mgr_iterator_t)RQ_CALLOC(1, sizeof(struct rq_trade_mgr_iterator));
+}
+
+RQ_EXPORT void
+rq_trade_mgr_iterator_free(rq_trade_mgr_iterator_t it)
+{
+    RQ_FREE(it);
+}
+
+RQ_EXPORT void
+rq_trade_mgr_begin_type(rq_trade_mgr_t trade_mgr, const char *trade_type, rq_trade_mgr_iterator_t it)
+{
+    it->segment = find_segment(trade_mgr, trade_type);
+    it->batch = 0;
+}
+
+RQ_EXPORT int
+rq_trade_mgr_at_end(rq_trade_mgr_iterator_t it)
+{
+    return !it->segment || it->batch >= rq_array_size(it->segment->batches);
+}
+
+RQ_EXPORT void
+rq_trade_mgr_next(rq_trade_mgr_iterator_t it)
+{
+    it->batch++;
+}
+
+RQ_EXPORT rq_trade_t
+rq_trade_mgr_iterator_deref(rq_trade_mgr_iterator_t it, unsigned int *num_trades)
+{
+    unsigned int num_batches = rq_array_size(it->segment->batches);
+
+    if (it->batch + 1 < num_batches || it->segment->num_trades % RQ_TRADE_MGR_BATCH_SIZE == 0)
+        *num_trades = RQ_TRADE_MGR_BATCH_SIZE;
+    else
+        *num_trades = it->segment->num_trades % RQ_TRADE_MGR_BATCH_SIZE;
+
+    return (rq_trade_t)rq_array_get_at(it->segment->batches, it->batch);
+}
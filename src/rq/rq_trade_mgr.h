@@ -32,6 +32,8 @@
 
 #include "rq_config.h"
 #include "rq_hashtable.h"
+#include "rq_arena.h"
+#include "rq_array.h"
 #include "rq_trade.h"
 #include <sqlite3.h>
 
@@ -42,12 +44,124 @@ extern "C" {
 #endif
 #endif
 
+/** The number of trades stored together in each batch. */
+#define RQ_TRADE_MGR_BATCH_SIZE 256
+
+/** The trades of one trade type, stored by value in batches of
+ * RQ_TRADE_MGR_BATCH_SIZE. Every batch but the last is full.
+ */
+struct rq_trade_segment {
+    const char *trade_type; /**< the trd_tty_code shared by the trades */
+    unsigned long num_trades;
+    rq_array_t batches; /**< struct rq_trade arrays allocated from the arena */
+};
+
+/** The trade manager packs the trades it manages into its own
+ * storage, grouped by trade type, so that the trades of a type can be
+ * walked a batch at a time. The trades and their strings live in an
+ * arena and are released together when the manager is freed.
+ */
 struct rq_trade_mgr {
-    struct rq_hashtable *ht;
+    struct rq_hashtable *ht; /**< trade ID to trade */
+    rq_arena_t arena;
+    rq_array_t segments; /**< struct rq_trade_segment, in the order the types were first seen */
+    unsigned long num_trades;
 };
 
 typedef struct rq_trade_mgr *rq_trade_mgr_t;
 
+/** Iterates over the trades of one type a batch at a time.
+ */
+typedef struct rq_trade_mgr_iterator {
+    const struct rq_trade_segment *segment;
+    unsigned int batch;
+} *rq_trade_mgr_iterator_t;
+
+/** Allocate an empty trade manager.
+ */
+RQ_EXPORT rq_trade_mgr_t rq_trade_mgr_alloc();
+
+/** Free the trade manager and all the trades it holds.
+ */
+RQ_EXPORT void rq_trade_mgr_free(rq_trade_mgr_t trade_mgr);
+
+/** Store a trade. The fields are copied into the manager.
+ *
+ * @return the stored trade, which stays valid until the manager is
+ * freed
+ */
+RQ_EXPORT rq_trade_t
+rq_trade_mgr_add_trade(
+    rq_trade_mgr_t trade_mgr,
+    int trd_id,
+    const char *trd_key,
+    const char *trd_insert_time,
+    const char *trd_usr_id,
+    const char *trd_tst_code,
+    const char *trd_tty_code,
+    const char *trd_bys_code,
+    const char *trd_cpt_key,
+    const char *trd_bok_code,
+    const char *trd_data
+    );
+
+/** Add a trade allocated with rq_trade_alloc(). The manager copies
+ * the trade into its own storage and frees it, so the trade must not
+ * be used after the call.
+ */
+RQ_EXPORT void rq_trade_mgr_add(rq_trade_mgr_t trade_mgr, rq_trade_t trade);
+
+/** Get a trade by ID, or NULL if there is no such trade.
+ */
+RQ_EXPORT rq_trade_t rq_trade_mgr_get(rq_trade_mgr_t trade_mgr, long id);
+
+/** Get the number of trades managed.
+ */
+RQ_EXPORT unsigned long rq_trade_mgr_size(rq_trade_mgr_t trade_mgr);
+
+/** Get the number of distinct trade types.
+ */
+RQ_EXPORT unsigned int rq_trade_mgr_get_trade_type_count(rq_trade_mgr_t trade_mgr);
+
+/** Get a trade type by zero-based offset.
+ */
+RQ_EXPORT const char *rq_trade_mgr_get_trade_type_at(rq_trade_mgr_t trade_mgr, unsigned int offset);
+
+/** Get the number of trades of a type.
+ */
+RQ_EXPORT unsigned long rq_trade_mgr_get_trade_type_size(rq_trade_mgr_t trade_mgr, const char *trade_type);
+
+/** Load the trades from the trade table of a database.
+ *
+ * @return the number of trades loaded, or -1 on error
+ */
+RQ_EXPORT long rq_trade_mgr_load(rq_trade_mgr_t trade_mgr, sqlite3 *db);
+
+/** Allocate a trade iterator.
+ */
+RQ_EXPORT rq_trade_mgr_iterator_t rq_trade_mgr_iterator_alloc();
+
+/** Free a trade iterator.
+ */
+RQ_EXPORT void rq_trade_mgr_iterator_free(rq_trade_mgr_iterator_t it);
+
+/** Position the iterator at the first batch of trades of a type. A
+ * NULL trade type matches the trades without one.
+ */
+RQ_EXPORT void rq_trade_mgr_begin_type(rq_trade_mgr_t trade_mgr, const char *trade_type, rq_trade_mgr_iterator_t it);
+
+/** Test whether the iterator has moved past the last batch.
+ */
+RQ_EXPORT int rq_trade_mgr_at_end(rq_trade_mgr_iterator_t it);
+
+/** Move to the next batch.
+ */
+RQ_EXPORT void rq_trade_mgr_next(rq_trade_mgr_iterator_t it);
+
+/** Get the trades in the current batch. They are contiguous, so
+ * trades[i] is valid for i less than *num_trades.
+ */
+RQ_EXPORT rq_trade_t rq_trade_mgr_iterator_deref(rq_trade_mgr_iterator_t it, unsigned int *num_trades);
 
 #ifdef __cplusplus
 #if 0
@@ -26,7 +26,7 @@
 #include <stdlib.h>
 #include <string.h>
 
-static unsigned int s_initial_max_vols = 20;
+static const unsigned int s_initial_max_vols = 20;
 
 RQ_EXPORT rq_vol_curve_t
 rq_vol_curve_alloc()
@@ -56,7 +56,7 @@ rq_vol_curve_add(rq_vol_curve_t vol_curve, rq_date date, double vol)
     if (vol_curve->num_vols == vol_curve->max_vols)
     {
         unsigned int new_max_vols = 2 * vol_curve->max_vols;
-        vol_curve->vols = (struct rq_volatility *)realloc(vol_curve->vols, new_max_vols * sizeof(struct rq_volatility));
+        vol_curve->vols = (struct rq_volatility *)RQ_REALLOC(vol_curve->vols, new_max_vols * sizeof(struct rq_volatility));
         vol_curve->max_vols = new_max_vols;
     }
 
@@ -27,7 +27,7 @@
 #include <string.h>
 #include <stdio.h>
 
-static unsigned short s_default_max_curves = 256;
+static const unsigned short s_default_max_curves = 256;
 
 
 RQ_EXPORT rq_vol_surface_t
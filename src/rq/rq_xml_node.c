@@ -31,7 +31,7 @@
 RQ_EXPORT struct rq_xml_node *
 rq_xml_node_alloc(enum rq_xml_node_type node_type)
 {
-    struct rq_xml_node *n = (struct rq_xml_node *)calloc(1, sizeof(struct rq_xml_node));
+    struct rq_xml_node *n = (struct rq_xml_node *)RQ_CALLOC(1, sizeof(struct rq_xml_node));
     n->node_type = node_type;
 
     return n;
@@ -44,7 +44,7 @@ rq_xml_node_free(struct rq_xml_node *nd)
     {
         case RQ_XML_NODE_TYPE_ELEMENT:
             if (nd->node.el.tag)
-                free((char *)nd->node.el.tag);
+                RQ_FREE((char *)nd->node.el.tag);
 
             if (nd->node.el.first_child)
                 rq_xml_node_free(nd->node.el.first_child);
@@ -56,14 +56,14 @@ rq_xml_node_free(struct rq_xml_node *nd)
 
         case RQ_XML_NODE_TYPE_ATTRIBUTE:
             if (nd->node.att.name)
-                free((char *)nd->node.att.name);
+                RQ_FREE((char *)nd->node.att.name);
             if (nd->node.att.value)
-                free((char *)nd->node.att.value);
+                RQ_FREE((char *)nd->node.att.value);
             break;
 
         case RQ_XML_NODE_TYPE_TEXT:
             if (nd->node.txt.text)
-                free((char *)nd->node.txt.text);
+                RQ_FREE((char *)nd->node.txt.text);
             break;
 
         default:
@@ -73,7 +73,7 @@ rq_xml_node_free(struct rq_xml_node *nd)
     if (nd->next)
         rq_xml_node_free(nd->next);
 
-    free(nd);
+    RQ_FREE(nd);
 }
 
 RQ_EXPORT void 
@@ -105,8 +105,8 @@ RQ_EXPORT struct rq_xml_node *
 rq_xml_node_add_attribute(struct rq_xml_node *element, const char *name, const char *value)
 {
     struct rq_xml_node *n = rq_xml_node_alloc(RQ_XML_NODE_TYPE_ATTRIBUTE);
-    n->node.att.name = strdup(name);
-    n->node.att.value = strdup(value);
+    n->node.att.name = RQ_STRDUP(name);
+    n->node.att.value = RQ_STRDUP(value);
 
     if (element->node.el.last_att)
         element->node.el.last_att->next = n;
@@ -122,7 +122,7 @@ RQ_EXPORT struct rq_xml_node *
 rq_xml_node_add_text(struct rq_xml_node *element, const char *text)
 {
     struct rq_xml_node *n = rq_xml_node_alloc(RQ_XML_NODE_TYPE_TEXT);
-    n->node.txt.text = strdup(text);
+    n->node.txt.text = RQ_STRDUP(text);
 
     if (element->node.el.last_child)
         element->node.el.last_child->next = n;
@@ -305,7 +305,13 @@ rq_xml_node_get_text(struct rq_xml_node *node, char *buf, unsigned max_buf_len)
 
     if (max_buf_len > 0)
     {
-        if (node->node_type == RQ_XML_NODE_TYPE_ELEMENT)
+        if (node->node_type == RQ_XML_NODE_TYPE_ATTRIBUTE)
+        {
+            int i;
+            for (i = 0; node->node.att.value && node->node.att.value[i] != '\0' && bytes_copied < max_buf_len; i++, bytes_copied++)
+                buf[bytes_copied] = node->node.att.value[i];
+        }
+        else if (node->node_type == RQ_XML_NODE_TYPE_ELEMENT)
         {
             struct rq_xml_node *child;
             for (child = node->node.el.first_child; child; child = child->next)
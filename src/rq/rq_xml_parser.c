@@ -23,6 +23,9 @@
 */
 #include "rq_xml_parser.h"
 #include "rq_error.h"
+#include "rq_instrument.h"
+#include "rq_stream_mmap.h"
+#include "rq_scan.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -45,6 +48,7 @@ rq_xml_parser_init(struct rq_xml_parser *parser)
     parser->token_read_state = 0;
 
     parser->state = RQ_XML_PARSER_STATE_WANT_TOPLEVEL_TOKEN;
+    parser->depth = 0;
 
     while (parser->head_token)
     {
@@ -80,6 +84,7 @@ rq_xml_parser_alloc()
     parser->token_read_state = 0;
 
     parser->state = RQ_XML_PARSER_STATE_WANT_TOPLEVEL_TOKEN;
+    parser->depth = 0;
 
     parser->head_token = NULL;
     parser->curr_token = NULL;
@@ -87,6 +92,7 @@ rq_xml_parser_alloc()
 
     parser->callback_data = NULL;
     parser->callback = NULL;
+    parser->view_callback = NULL;
 
     return parser;
 }
@@ -119,7 +125,7 @@ add_char_to_token_buffer(struct rq_xml_parser *p, char ch)
     {
         unsigned new_token_buffer_len = 
             p->token_buffer_len + RQ_XML_PARSER_TOKEN_BUFFER_GROW_SIZE;
-        p->token_buffer = (char *)realloc(
+        p->token_buffer = (char *)RQ_REALLOC(
             p->token_buffer, 
             new_token_buffer_len
             );
@@ -134,7 +140,7 @@ static void
 add_token(struct rq_xml_parser *p, enum rq_xml_parser_token_type token_type)
 {
     struct rq_xml_parser_token *t = (struct rq_xml_parser_token *)
-        calloc(1, sizeof(struct rq_xml_parser_token));
+        RQ_CALLOC(1, sizeof(struct rq_xml_parser_token));
 
     t->token_type = token_type;
     t->token = RQ_STRDUP(p->token_buffer);
@@ -194,9 +200,408 @@ change_state(struct rq_xml_parser *p, enum rq_xml_parser_states state)
     p->state = state;
 }
 
+/* Is ch a letter, as the stream parser allows names to start with? */
+#define IS_NAME_START(ch) (((ch) >= 'A' && (ch) <= 'Z') || ((ch) >= 'a' && (ch) <= 'z'))
+#define IS_SPACE(ch) ((ch) == ' ' || (ch) == '\t' || (ch) == '\r' || (ch) == '\n')
+
+/* Hand an event to whichever callback is set. The string callback
+   gets copies of the views, NUL terminated, in the token buffer.
+*/
+static void
+emit_view_event(
+    struct rq_xml_parser *p, 
+    enum rq_xml_parser_parse_event_type event_type,
+    const struct rq_xml_parser_view *v1,
+    const struct rq_xml_parser_view *v2,
+    const struct rq_xml_parser_view *v3)
+{
+    if (event_type == RQ_XML_PARSER_PARSE_EVENT_TYPE_ENTERING_ELEMENT)
+        p->depth++;
+    else if (event_type == RQ_XML_PARSER_PARSE_EVENT_TYPE_LEAVING_ELEMENT)
+        p->depth--;
+
+    if (p->view_callback)
+        (*p->view_callback)(p->callback_data, event_type, v1, v2, v3);
+    else if (p->callback)
+    {
+        const struct rq_xml_parser_view *views[3];
+        const char *strs[3];
+        unsigned len = 0;
+        int i;
+
+        views[0] = v1;
+        views[1] = v2;
+        views[2] = v3;
+
+        for (i = 0; i < 3; i++)
+            if (views[i])
+                len += views[i]->len + 1;
+
+        if (len > p->token_buffer_len)
+        {
+            p->token_buffer = (char *)RQ_REALLOC(p->token_buffer, len);
+            p->token_buffer_len = len;
+        }
+
+        len = 0;
+        for (i = 0; i < 3; i++)
+        {
+            if (views[i])
+            {
+                strs[i] = p->token_buffer + len;
+                memcpy(p->token_buffer + len, views[i]->str, views[i]->len);
+                len += views[i]->len;
+                p->token_buffer[len++] = '\0';
+            }
+            else
+                strs[i] = NULL;
+        }
+
+        (*p->callback)(p->callback_data, event_type, strs[0], strs[1], strs[2]);
+    }
+}
+
+/* Parse [buffer, end) carrying on from the parser's current state. */
+static void
+parse_views(struct rq_xml_parser *p, const char *buffer, const char *end)
+{
+    const char *s = buffer;
+    const char *token_start = buffer;
+    struct rq_xml_parser_view element = { NULL, 0 };
+    struct rq_xml_parser_view attribute = { NULL, 0 };
+    struct rq_xml_parser_view value;
+    char quote = '"';
+    char ch;
+
+    /* The same states as the stream parser, but the runs between
+       delimiters are skipped over and reported as views rather than
+       copied a character at a time. Only the most recent element is
+       needed, as values and attributes always belong to the element
+       just entered.
+    */
+    while (s < end && p->state != RQ_XML_PARSER_STATE_PARSE_ERROR)
+    {
+        switch (p->state)
+        {
+            case RQ_XML_PARSER_STATE_WANT_TOPLEVEL_TOKEN:
+                s = rq_scan_for(s, end, '<', '<');
+                if (s < end)
+                {
+                    change_state(p, RQ_XML_PARSER_STATE_GOT_LESSTHAN);
+                    s++;
+                }
+                break;
+
+            case RQ_XML_PARSER_STATE_GOT_LESSTHAN:
+                ch = *s;
+                if (ch == '!')
+                    change_state(p, RQ_XML_PARSER_STATE_GOT_COMMENT1);
+                else if (ch == '?')
+                    change_state(p, RQ_XML_PARSER_STATE_GOT_DOCQM);
+                else if (IS_NAME_START(ch))
+                {
+                    token_start = s;
+                    change_state(p, RQ_XML_PARSER_STATE_IN_ELEMENT_NAME);
+                }
+                else if (ch == '/')
+                {
+                    token_start = s + 1;
+                    change_state(p, RQ_XML_PARSER_STATE_IN_CLOSING_ELEMENT_NAME);
+                }
+                s++;
+                break;
+
+            case RQ_XML_PARSER_STATE_GOT_DOCQM:
+                /* skip the declaration or processing instruction */
+                s = rq_scan_for(s, end, '>', '>');
+                if (s < end)
+                {
+                    change_state(p, RQ_XML_PARSER_STATE_WANT_TOPLEVEL_TOKEN);
+                    s++;
+                }
+                break;
+
+            case RQ_XML_PARSER_STATE_GOT_COMMENT1:
+                if (*s++ == '-')
+                    change_state(p, RQ_XML_PARSER_STATE_GOT_COMMENT2);
+                else
+                    change_state(p, RQ_XML_PARSER_STATE_PARSE_ERROR);
+                break;
+
+            case RQ_XML_PARSER_STATE_GOT_COMMENT2:
+                if (*s++ == '-')
+                    change_state(p, RQ_XML_PARSER_STATE_READING_COMMENT);
+                else
+                    change_state(p, RQ_XML_PARSER_STATE_PARSE_ERROR);
+                break;
+
+            case RQ_XML_PARSER_STATE_READING_COMMENT:
+                s = rq_scan_for(s, end, '-', '-');
+                if (s < end)
+                {
+                    change_state(p, RQ_XML_PARSER_STATE_COMMENT_END_DASH1);
+                    s++;
+                }
+                break;
+
+            case RQ_XML_PARSER_STATE_COMMENT_END_DASH1:
+                if (*s++ == '-')
+                    change_state(p, RQ_XML_PARSER_STATE_COMMENT_END_DASH2);
+                else
+                    change_state(p, RQ_XML_PARSER_STATE_READING_COMMENT);
+                break;
+
+            case RQ_XML_PARSER_STATE_COMMENT_END_DASH2:
+                if (*s++ == '>')
+                    change_state(p, RQ_XML_PARSER_STATE_WANT_TOPLEVEL_TOKEN);
+                else
+                    change_state(p, RQ_XML_PARSER_STATE_READING_COMMENT);
+                break;
+
+            case RQ_XML_PARSER_STATE_IN_ELEMENT_NAME:
+                ch = *s;
+                if (IS_SPACE(ch) || ch == '>' || ch == '/')
+                {
+                    element.str = token_start;
+                    element.len = (unsigned)(s - token_start);
+                    emit_view_event(p, RQ_XML_PARSER_PARSE_EVENT_TYPE_ENTERING_ELEMENT, &element, NULL, NULL);
+
+                    if (ch == '>')
+                    {
+                        token_start = s + 1;
+                        change_state(p, RQ_XML_PARSER_STATE_IN_ELEMENT_VALUE);
+                    }
+                    else if (ch == '/')
+                        change_state(p, RQ_XML_PARSER_STATE_START_SHORTCUT_CLOSE);
+                    else
+                        change_state(p, RQ_XML_PARSER_STATE_IN_ELEMENT);
+                }
+                s++;
+                break;
+
+            case RQ_XML_PARSER_STATE_IN_ELEMENT:
+                ch = *s;
+                if (IS_NAME_START(ch))
+                {
+                    token_start = s;
+                    change_state(p, RQ_XML_PARSER_STATE_IN_ATTRIBUTE_NAME);
+                }
+                else if (ch == '>')
+                {
+                    token_start = s + 1;
+                    change_state(p, RQ_XML_PARSER_STATE_IN_ELEMENT_VALUE);
+                }
+                else if (ch == '/')
+                    change_state(p, RQ_XML_PARSER_STATE_START_SHORTCUT_CLOSE);
+                s++;
+                break;
+
+            case RQ_XML_PARSER_STATE_IN_ATTRIBUTE_NAME:
+                ch = *s;
+                if (IS_SPACE(ch) || ch == '=')
+                {
+                    attribute.str = token_start;
+                    attribute.len = (unsigned)(s - token_start);
+                    if (ch == '=')
+                        change_state(p, RQ_XML_PARSER_STATE_BEFORE_ATTRIBUTE_VALUE);
+                    else
+                        change_state(p, RQ_XML_PARSER_STATE_AFTER_ATTRIBUTE_NAME);
+                }
+                s++;
+                break;
+
+            case RQ_XML_PARSER_STATE_AFTER_ATTRIBUTE_NAME:
+                if (*s++ == '=')
+                    change_state(p, RQ_XML_PARSER_STATE_BEFORE_ATTRIBUTE_VALUE);
+                break;
+
+            case RQ_XML_PARSER_STATE_BEFORE_ATTRIBUTE_VALUE:
+                ch = *s++;
+                if (ch == '\'' || ch == '"')
+                {
+                    quote = ch;
+                    token_start = s;
+                    change_state(p, RQ_XML_PARSER_STATE_IN_ATTRIBUTE_VALUE);
+                }
+                break;
+
+            case RQ_XML_PARSER_STATE_IN_ATTRIBUTE_VALUE:
+                s = rq_scan_for(s, end, quote, quote);
+                if (s < end)
+                {
+                    value.str = token_start;
+                    value.len = (unsigned)(s - token_start);
+                    emit_view_event(p, RQ_XML_PARSER_PARSE_EVENT_TYPE_GOT_ATTRIBUTE_VALUE, &element, &attribute, &value);
+                    change_state(p, RQ_XML_PARSER_STATE_IN_ELEMENT);
+                    s++;
+                }
+                break;
+
+            case RQ_XML_PARSER_STATE_IN_CLOSING_ELEMENT_NAME:
+                s = rq_scan_for(s, end, '>', '>');
+                if (s < end)
+                {
+                    const char *name_end = s;
+
+                    while (token_start < name_end && IS_SPACE(*token_start))
+                        token_start++;
+                    while (name_end > token_start && IS_SPACE(name_end[-1]))
+                        name_end--;
+
+                    value.str = token_start;
+                    value.len = (unsigned)(name_end - token_start);
+                    emit_view_event(p, RQ_XML_PARSER_PARSE_EVENT_TYPE_LEAVING_ELEMENT, &value, NULL, NULL);
+                    change_state(p, RQ_XML_PARSER_STATE_WANT_TOPLEVEL_TOKEN);
+                    s++;
+                }
+                break;
+
+            case RQ_XML_PARSER_STATE_IN_ELEMENT_VALUE:
+                s = rq_scan_for(s, end, '<', '<');
+                if (s < end)
+                {
+                    value.str = token_start;
+                    value.len = (unsigned)(s - token_start);
+                    emit_view_event(p, RQ_XML_PARSER_PARSE_EVENT_TYPE_GOT_ELEMENT_VALUE, &element, &value, NULL);
+                    change_state(p, RQ_XML_PARSER_STATE_GOT_LESSTHAN);
+                    s++;
+                }
+                break;
+
+            case RQ_XML_PARSER_STATE_START_SHORTCUT_CLOSE:
+                if (*s == '>')
+                {
+                    emit_view_event(p, RQ_XML_PARSER_PARSE_EVENT_TYPE_LEAVING_ELEMENT, &element, NULL, NULL);
+                    change_state(p, RQ_XML_PARSER_STATE_WANT_TOPLEVEL_TOKEN);
+                }
+                else
+                {
+                    p->state = p->prev_state;
+                    token_start = s + 1;
+                }
+                s++;
+                break;
+
+            default:
+                assert(0);
+        }
+    }
+}
+
+/* A document parsed as views is finished when it's between tags with
+   every element it entered left. */
+static int
+views_result(const struct rq_xml_parser *p)
+{
+    if (p->state != RQ_XML_PARSER_STATE_WANT_TOPLEVEL_TOKEN || p->depth != 0)
+        return RQ_ERR_XML_PARSER_BAD_FORMAT;
+    return RQ_OK;
+}
+
+RQ_EXPORT int
+rq_xml_parser_parse_buffer(rq_xml_parser_t p, const char *buffer, unsigned long buffer_len)
+{
+    double begin = rq_instrument_timer_begin();
+
+    change_state(p, RQ_XML_PARSER_STATE_WANT_TOPLEVEL_TOKEN);
+    p->depth = 0;
+    parse_views(p, buffer, buffer + buffer_len);
+
+    rq_instrument_timer_end(RQ_INSTRUMENT_TIMER_XML_LOAD, begin);
+
+    return views_result(p);
+}
+
+static const char *
+find_last_lessthan(const char *buffer, unsigned len)
+{
+    const char *s = buffer + len;
+
+    while (s > buffer)
+        if (*--s == '<')
+            return s;
+
+    return NULL;
+}
+
+/* Parse a stream that can't be mapped a chunk at a time, for view
+   callbacks. Each chunk is parsed up to and including its last '<'.
+   Everything before that is whole tags, text and comments, and the
+   parser is left at the start of a tag, so no view has to reach back
+   into the previous chunk. The buffer only grows for a run without a
+   '<' longer than a chunk.
+*/
+static int
+parse_stream_in_chunks(struct rq_xml_parser *p, rq_stream_t stream)
+{
+    double begin = rq_instrument_timer_begin();
+    unsigned len = 0;
+    int err = RQ_OK;
+
+    if (p->parse_buffer_len < RQ_XML_PARSER_CHUNK_SIZE)
+    {
+        p->parse_buffer_len = RQ_XML_PARSER_CHUNK_SIZE;
+        p->parse_buffer = (char *)RQ_REALLOC(p->parse_buffer, p->parse_buffer_len);
+    }
+
+    change_state(p, RQ_XML_PARSER_STATE_WANT_TOPLEVEL_TOKEN);
+    p->depth = 0;
+
+    while (p->state != RQ_XML_PARSER_STATE_PARSE_ERROR)
+    {
+        const char *cut;
+        int num_bytes_read;
+
+        if (len == p->parse_buffer_len)
+        {
+            p->parse_buffer_len *= 2;
+            p->parse_buffer = (char *)RQ_REALLOC(p->parse_buffer, p->parse_buffer_len);
+        }
+
+        num_bytes_read = rq_stream_read(stream, p->parse_buffer + len, p->parse_buffer_len - len);
+        if (num_bytes_read < 0)
+        {
+            err = RQ_ERR_XML_PARSER_READ;
+            break;
+        }
+        if (num_bytes_read == 0)
+        {
+            parse_views(p, p->parse_buffer, p->parse_buffer + len);
+            break;
+        }
+        len += num_bytes_read;
+
+        cut = find_last_lessthan(p->parse_buffer, len);
+        if (cut)
+        {
+            unsigned parsed = (unsigned)(cut + 1 - p->parse_buffer);
+
+            parse_views(p, p->parse_buffer, cut + 1);
+
+            /* A '<' inside an attribute value isn't allowed, and
+               would leave views pointing into this chunk. */
+            if (p->state != RQ_XML_PARSER_STATE_GOT_LESSTHAN &&
+                p->state != RQ_XML_PARSER_STATE_READING_COMMENT &&
+                p->state != RQ_XML_PARSER_STATE_GOT_DOCQM)
+                change_state(p, RQ_XML_PARSER_STATE_PARSE_ERROR);
+
+            len -= parsed;
+            memmove(p->parse_buffer, p->parse_buffer + parsed, len);
+        }
+    }
+
+    rq_instrument_timer_end(RQ_INSTRUMENT_TIMER_XML_LOAD, begin);
+
+    return err != RQ_OK ? err : views_result(p);
+}
+
 RQ_EXPORT int
 rq_xml_parser_parse(rq_xml_parser_t p, rq_stream_t stream)
 {
+    double begin;
+    const char *buffer;
+    unsigned long buffer_len;
+
     if (!rq_stream_is_open(stream))
     {
         int err = rq_stream_open(stream);
@@ -204,6 +609,21 @@ rq_xml_parser_parse(rq_xml_parser_t p, rq_stream_t stream)
             return err;
     }
 
+    buffer = rq_stream_mmap_get_buffer(stream, &buffer_len);
+    if (buffer)
+    {
+        long offset = rq_stream_tell(stream);
+
+        rq_stream_seek(stream, (long)buffer_len);
+
+        return rq_xml_parser_parse_buffer(p, buffer + offset, buffer_len - offset);
+    }
+
+    if (p->view_callback)
+        return parse_stream_in_chunks(p, stream);
+
+    begin = rq_instrument_timer_begin();
+
     p->prev_state = RQ_XML_PARSER_STATE_WANT_TOPLEVEL_TOKEN;
 
     while (p->state != RQ_XML_PARSER_STATE_PARSE_ERROR)
@@ -223,7 +643,7 @@ rq_xml_parser_parse(rq_xml_parser_t p, rq_stream_t stream)
                 unsigned new_buffer_size = 
                     p->parse_buffer_len + 
                     RQ_XML_PARSER_PARSE_BUFFER_GROW_SIZE;
-                p->parse_buffer = (char *)realloc(p->parse_buffer, new_buffer_size);
+                p->parse_buffer = (char *)RQ_REALLOC(p->parse_buffer, new_buffer_size);
                 p->parse_buffer_len = new_buffer_size;
             }
 
@@ -260,9 +680,8 @@ rq_xml_parser_parse(rq_xml_parser_t p, rq_stream_t stream)
                     case RQ_XML_PARSER_STATE_GOT_LESSTHAN:
                         if (ch == '!')
                             change_state(p, RQ_XML_PARSER_STATE_GOT_COMMENT1);
-                        /* else if (ch == '?')
-                              p->state = RQ_XML_PARSER_STATE_GOT_DOCQM;
-                        */
+                        else if (ch == '?')
+                            change_state(p, RQ_XML_PARSER_STATE_GOT_DOCQM);
                         else if ((ch >= 'A' && ch <= 'Z') || 
                                  (ch >= 'a' && ch <= 'z'))
                         {
@@ -284,6 +703,11 @@ rq_xml_parser_parse(rq_xml_parser_t p, rq_stream_t stream)
                             change_state(p, RQ_XML_PARSER_STATE_PARSE_ERROR);
                         break;
 
+                    case RQ_XML_PARSER_STATE_GOT_DOCQM:
+                        if (ch == '>')
+                            change_state(p, RQ_XML_PARSER_STATE_WANT_TOPLEVEL_TOKEN);
+                        break;
+
                     case RQ_XML_PARSER_STATE_GOT_COMMENT2:
                         if (ch == '-')
                             change_state(p, RQ_XML_PARSER_STATE_READING_COMMENT);
@@ -513,7 +937,7 @@ rq_xml_parser_parse(rq_xml_parser_t p, rq_stream_t stream)
                     if (p->parse_position > 0)
                     {
                         int bytes_left_in_buffer = p->parse_max_position - p->parse_position;
-                        memcpy(p->parse_buffer, p->parse_buffer + p->parse_position, bytes_left_in_buffer);
+                        memmove(p->parse_buffer, p->parse_buffer + p->parse_position, bytes_left_in_buffer);
                         p->parse_position = 0;
                         p->parse_max_position = bytes_left_in_buffer;
                     }
@@ -548,7 +972,8 @@ rq_xml_parser_parse(rq_xml_parser_t p, rq_stream_t stream)
                     }
                     else
                     {
-                        (*p->callback)(p->callback_data, RQ_XML_PARSER_PARSE_EVENT_TYPE_LEAVING_ELEMENT, p->token_buffer, NULL, NULL);
+                        if (p->callback)
+                            (*p->callback)(p->callback_data, RQ_XML_PARSER_PARSE_EVENT_TYPE_LEAVING_ELEMENT, p->token_buffer, NULL, NULL);
                     }
 
                     p->token_read_state = 0;
@@ -558,6 +983,8 @@ rq_xml_parser_parse(rq_xml_parser_t p, rq_stream_t stream)
         }
     }
 
+    rq_instrument_timer_end(RQ_INSTRUMENT_TIMER_XML_LOAD, begin);
+
     return RQ_OK;
 }
 
@@ -575,3 +1002,12 @@ rq_xml_parser_set_callback(
 {
     p->callback = callback;
 }
+
+RQ_EXPORT void 
+rq_xml_parser_set_view_callback(
+    rq_xml_parser_t p, 
+    void (*view_callback)(void *, enum rq_xml_parser_parse_event_type, const struct rq_xml_parser_view *, const struct rq_xml_parser_view *, const struct rq_xml_parser_view *)
+    )
+{
+    p->view_callback = view_callback;
+}
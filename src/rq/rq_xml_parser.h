@@ -50,6 +50,8 @@ enum rq_xml_parser_parse_event_type {
 #define RQ_XML_PARSER_PARSE_BUFFER_GROW_SIZE 1024
 #define RQ_XML_PARSER_TOKEN_BUFFER_INITIAL_SIZE 1024
 #define RQ_XML_PARSER_TOKEN_BUFFER_GROW_SIZE 256
+/** How much of a stream is read at a time when parsing with a view callback. */
+#define RQ_XML_PARSER_CHUNK_SIZE 65536
 
 enum rq_xml_parser_states {
     RQ_XML_PARSER_STATE_WANT_TOPLEVEL_TOKEN,
@@ -99,6 +101,15 @@ enum rq_xml_parser_event_type {
     RQ_XML_PARSER_EVENT_TYPE_ELEMENT_FINISHED
 };
 
+/**
+ * A string inside the document being parsed. It is not NUL
+ * terminated and is only valid for the length of the parse.
+ */
+struct rq_xml_parser_view {
+    const char *str;
+    unsigned len;
+};
+
 /** the handle to the xml parser */
 typedef struct rq_xml_parser {
     char *parse_buffer; /**< The buffer to read the stream into */
@@ -116,6 +127,7 @@ typedef struct rq_xml_parser {
 
     int state;
     int prev_state;
+    int depth; /**< The elements entered and not yet left, when parsing views */
 
     struct rq_xml_parser_token *head_token;
     struct rq_xml_parser_token *curr_token;
@@ -125,6 +137,7 @@ typedef struct rq_xml_parser {
 
     void *callback_data;
     void (*callback)(void *, enum rq_xml_parser_parse_event_type, const char *, const char *, const char *);
+    void (*view_callback)(void *, enum rq_xml_parser_parse_event_type, const struct rq_xml_parser_view *, const struct rq_xml_parser_view *, const struct rq_xml_parser_view *);
 } *rq_xml_parser_t;
 
 /** Test whether the rq_asset is NULL */
@@ -147,10 +160,33 @@ RQ_EXPORT void rq_xml_parser_init(struct rq_xml_parser *parser);
 /**
  * Perform the parse
  *
+ * When a view callback is set, or the stream is memory-mapped, a
+ * stream that can't be read returns RQ_ERR_XML_PARSER_READ and a
+ * malformed or unfinished document RQ_ERR_XML_PARSER_BAD_FORMAT,
+ * after the events for what could be parsed have been handed out.
+ *
  * @return RQ_OK if success. Otherwise an error code
  */
 RQ_EXPORT int rq_xml_parser_parse(rq_xml_parser_t parser, rq_stream_t stream);
 
+/**
+ * Parse a whole document held in memory, without copying it.
+ *
+ * The callback set with rq_xml_parser_set_view_callback() is handed
+ * views into the buffer, and nothing is allocated per token. If only
+ * the string callback is set the views are copied into the parser's
+ * token buffer and NUL terminated first. Names are reported as
+ * written, where the stream parser drops any characters other than
+ * letters, digits, '_' and '-'; otherwise the events are the same.
+ *
+ * rq_xml_parser_parse() uses this for memory-mapped streams (see
+ * rq_stream_mmap.h).
+ *
+ * @return RQ_OK if success, or RQ_ERR_XML_PARSER_BAD_FORMAT if the
+ * document is malformed or ends before its elements are closed
+ */
+RQ_EXPORT int rq_xml_parser_parse_buffer(rq_xml_parser_t parser, const char *buffer, unsigned long buffer_len);
+
 /**
  * Sets the callback data that will be handed to the callback.
  */
@@ -168,6 +204,20 @@ rq_xml_parser_set_callback(
     void (*callback)(void *, enum rq_xml_parser_parse_event_type, const char *, const char *, const char *)
     );
 
+/**
+ * Sets a callback handler taking views into the document rather
+ * than NUL terminated strings. The events and the order of the
+ * parameters are the same as for rq_xml_parser_set_callback(). If
+ * a view callback is set the stream is parsed as a single buffer,
+ * read all at once unless the stream is memory-mapped, and the
+ * string callback isn't called.
+ */
+RQ_EXPORT void 
+rq_xml_parser_set_view_callback(
+    rq_xml_parser_t parser, 
+    void (*view_callback)(void *, enum rq_xml_parser_parse_event_type, const struct rq_xml_parser_view *, const struct rq_xml_parser_view *, const struct rq_xml_parser_view *)
+    );
+
 #ifdef __cplusplus
 #if 0
 { // purely to not screw up my indenting...
@@ -30,7 +30,7 @@
 #include <string.h>
 #include <math.h>
 
-static unsigned int s_max_factors = RQ_YIELD_CURVE_MAX_FACTORS;
+static const unsigned int s_max_factors = RQ_YIELD_CURVE_MAX_FACTORS;
 
 /*
  * Allocate yield curve to contain in_max_factors number of discount factors, or s_max_factors of them, if in_max_factors number is 0
@@ -75,6 +75,44 @@ rq_yield_curve_alloc(const unsigned int in_max_factors)
 RQ_EXPORT void rq_yield_curve_cache_enable(rq_yield_curve_t ts)
 {
     ts->factor_cache_size = RQ_FACTOR_CACHE_SIZE;
+    if (!ts->forward_rate_cache)
+        ts->forward_rate_cache = rq_forward_rate_cache_alloc();
+}
+
+RQ_EXPORT void rq_yield_curve_cache_invalidate(rq_yield_curve_t ts)
+{
+    ts->frozen = 0;
+    if (ts->factor_cache_size)
+        memset(ts->factor_cache, 0, RQ_FACTOR_CACHE_SIZE * sizeof(double));
+    if (ts->forward_rate_cache)
+        rq_forward_rate_cache_clear(ts->forward_rate_cache);
+}
+
+RQ_EXPORT void rq_yield_curve_freeze(rq_yield_curve_t ts)
+{
+    unsigned long days;
+
+    /* looking up each day fills its slot in the cache */
+    for (days = 1; days < ts->factor_cache_size; days++)
+        rq_yield_curve_get_discount_factor(ts, ts->from_date + days);
+
+    ts->frozen = (ts->factor_cache_size > 0);
+}
+
+RQ_EXPORT double
+rq_yield_curve_get_year_fraction(
+    const rq_yield_curve_t yc,
+    enum rq_day_count_convention day_count_convention,
+    rq_date start_date,
+    rq_date end_date
+    )
+{
+    return rq_day_count_get_year_fraction_calendar(
+        day_count_convention,
+        start_date,
+        end_date,
+        yc->day_count_calendar
+        );
 }
 
 RQ_EXPORT rq_yield_curve_t 
@@ -124,6 +162,8 @@ rq_yield_curve_free(rq_yield_curve_t ts)
 {
     rq_termstruct_clear(&ts->termstruct);
     RQ_FREE(ts->discount_factors);
+    if (ts->forward_rate_cache)
+        rq_forward_rate_cache_free(ts->forward_rate_cache);
     RQ_FREE(ts);
 }
 
@@ -226,6 +266,7 @@ rq_curve_interpolation_get_discount_factor(
 	enum rq_zero_method zero_method,
 	unsigned int zero_method_compound_frequency,
 	enum rq_day_count_convention curveDayCountConvention,
+	const rq_calendar_t curveDayCountCalendar,
 	rq_date curveBaseDate,
 	const struct rq_yield_curve_elem* pointStart,  /* TODO This should be generic like a rq_curve_point and then extracted */
 	const struct rq_yield_curve_elem* pointEnd,   /* TODO This should be generic like a rq_curve_point and then extracted */
@@ -242,14 +283,14 @@ rq_curve_interpolation_get_discount_factor(
                 pointStart->discount_factor,
 				zero_method,
 				zero_method_compound_frequency,
-                rq_day_count_get_year_fraction(curveDayCountConvention, curveBaseDate, pointStart->date)
+                rq_day_count_get_year_fraction_calendar(curveDayCountConvention, curveBaseDate, pointStart->date, curveDayCountCalendar)
                 );
             days2 = pointEnd->date - curveBaseDate; 
             zero2 = rq_rate_discount_to_zero(
                 pointEnd->discount_factor,
 				zero_method,
 				zero_method_compound_frequency,
-                rq_day_count_get_year_fraction(curveDayCountConvention, curveBaseDate, pointEnd->date)
+                rq_day_count_get_year_fraction_calendar(curveDayCountConvention, curveBaseDate, pointEnd->date, curveDayCountCalendar)
                 );
 			if (days1 == 0)
 			{
@@ -266,7 +307,7 @@ rq_curve_interpolation_get_discount_factor(
                 zero,
 				zero_method,
 				zero_method_compound_frequency,
-                rq_day_count_get_year_fraction(curveDayCountConvention, curveBaseDate, forDate)
+                rq_day_count_get_year_fraction_calendar(curveDayCountConvention, curveBaseDate, forDate, curveDayCountCalendar)
                 ); 
         }
 	        break;
@@ -304,13 +345,13 @@ rq_curve_interpolation_get_discount_factor(
                 pointStart->discount_factor,
 				zero_method,
 				zero_method_compound_frequency,
-                rq_day_count_get_year_fraction(curveDayCountConvention, curveBaseDate, pointStart->date));
+                rq_day_count_get_year_fraction_calendar(curveDayCountConvention, curveBaseDate, pointStart->date, curveDayCountCalendar));
             double days2 = pointEnd->date - curveBaseDate; 
             double zero2 = rq_rate_discount_to_zero(
                 pointEnd->discount_factor,
 				zero_method,
 				zero_method_compound_frequency,
-                rq_day_count_get_year_fraction(curveDayCountConvention, curveBaseDate, pointEnd->date));
+                rq_day_count_get_year_fraction_calendar(curveDayCountConvention, curveBaseDate, pointEnd->date, curveDayCountCalendar));
             double zero = rq_interpolate_log_linear(
                 (double)(forDate - curveBaseDate),
                 days1,
@@ -321,7 +362,7 @@ rq_curve_interpolation_get_discount_factor(
                 zero,
 				zero_method,
 				zero_method_compound_frequency,
-                rq_day_count_get_year_fraction(curveDayCountConvention, curveBaseDate, forDate)); 
+                rq_day_count_get_year_fraction_calendar(curveDayCountConvention, curveBaseDate, forDate, curveDayCountCalendar)); 
         }
 	        break;
 
@@ -392,13 +433,13 @@ rq_yield_curve_get_discount_factor(const rq_yield_curve_t ts, rq_date for_date)
                                 el->discount_factor,
 								ts->zero_method,
 								ts->zero_method_compound_frequency,
-                                rq_day_count_get_year_fraction(ts->default_day_count_convention, ts->from_date, el->date)
+                                rq_yield_curve_get_year_fraction(ts, ts->default_day_count_convention, ts->from_date, el->date)
                                 );
                             df = rq_rate_zero_to_discount(
                                 zero,
 								ts->zero_method,
 								ts->zero_method_compound_frequency,
-                                rq_day_count_get_year_fraction(ts->default_day_count_convention, ts->from_date, for_date)
+                                rq_yield_curve_get_year_fraction(ts, ts->default_day_count_convention, ts->from_date, for_date)
                                 ); 
                         }
                         break;
@@ -411,7 +452,7 @@ rq_yield_curve_get_discount_factor(const rq_yield_curve_t ts, rq_date for_date)
                                 el->discount_factor,
 								ts->zero_method,
 								ts->zero_method_compound_frequency,
-                                rq_day_count_get_year_fraction(ts->default_day_count_convention, ts->from_date, el->date)
+                                rq_yield_curve_get_year_fraction(ts, ts->default_day_count_convention, ts->from_date, el->date)
                                 );
                             if (ts->num_factors > 1)
                             {
@@ -420,7 +461,7 @@ rq_yield_curve_get_discount_factor(const rq_yield_curve_t ts, rq_date for_date)
                                     el->discount_factor,
 									ts->zero_method,
 									ts->zero_method_compound_frequency,
-                                    rq_day_count_get_year_fraction(ts->default_day_count_convention, ts->from_date, el->date)
+                                    rq_yield_curve_get_year_fraction(ts, ts->default_day_count_convention, ts->from_date, el->date)
                                     );
                                 zero = rq_interpolate_linear(
                                     (double)(for_date - ts->from_date),
@@ -434,7 +475,7 @@ rq_yield_curve_get_discount_factor(const rq_yield_curve_t ts, rq_date for_date)
                                 zero,
 								ts->zero_method,
 								ts->zero_method_compound_frequency,
-                                rq_day_count_get_year_fraction(ts->default_day_count_convention, ts->from_date, for_date)
+                                rq_yield_curve_get_year_fraction(ts, ts->default_day_count_convention, ts->from_date, for_date)
                                 );
                         }
                         break;
@@ -446,7 +487,7 @@ rq_yield_curve_get_discount_factor(const rq_yield_curve_t ts, rq_date for_date)
                                 el->discount_factor,
 								ts->zero_method,
 								ts->zero_method_compound_frequency,
-                                rq_day_count_get_year_fraction(ts->default_day_count_convention, ts->from_date, el->date)
+                                rq_yield_curve_get_year_fraction(ts, ts->default_day_count_convention, ts->from_date, el->date)
                                 );
 
                             /* interolate a zero rate assuming there is a zero
@@ -463,7 +504,7 @@ rq_yield_curve_get_discount_factor(const rq_yield_curve_t ts, rq_date for_date)
                                 zero,
 								ts->zero_method,
 								ts->zero_method_compound_frequency,
-                                rq_day_count_get_year_fraction(ts->default_day_count_convention, ts->from_date, for_date)
+                                rq_yield_curve_get_year_fraction(ts, ts->default_day_count_convention, ts->from_date, for_date)
                                 );
                         }
                         break;
@@ -490,7 +531,7 @@ rq_yield_curve_get_discount_factor(const rq_yield_curve_t ts, rq_date for_date)
 					else
 					{
 						df = rq_curve_interpolation_get_discount_factor(ts->interpolation_method, ts->zero_method, ts->zero_method_compound_frequency,
-							ts->default_day_count_convention, ts->from_date, pel, el, for_date);
+							ts->default_day_count_convention, ts->day_count_calendar, ts->from_date, pel, el, for_date);
 					}
 				}
             }
@@ -524,7 +565,7 @@ rq_yield_curve_get_discount_factor(const rq_yield_curve_t ts, rq_date for_date)
                             ts->discount_factors[ts->num_factors-1].discount_factor,
 							ts->zero_method,
 							ts->zero_method_compound_frequency,
-                            rq_day_count_get_year_fraction(ts->default_day_count_convention, ts->from_date, ts->discount_factors[ts->num_factors-1].date)
+                            rq_yield_curve_get_year_fraction(ts, ts->default_day_count_convention, ts->from_date, ts->discount_factors[ts->num_factors-1].date)
                             );
                         if (ts->num_factors > 1)
                         {
@@ -534,7 +575,7 @@ rq_yield_curve_get_discount_factor(const rq_yield_curve_t ts, rq_date for_date)
                                 ts->discount_factors[ts->num_factors-2].discount_factor,
 								ts->zero_method,
 								ts->zero_method_compound_frequency,
-                                rq_day_count_get_year_fraction(ts->default_day_count_convention, ts->from_date, ts->discount_factors[ts->num_factors-2].date)
+                                rq_yield_curve_get_year_fraction(ts, ts->default_day_count_convention, ts->from_date, ts->discount_factors[ts->num_factors-2].date)
                                 );
                             zero = rq_interpolate_linear(
                                 (double)(for_date - ts->from_date),
@@ -549,7 +590,7 @@ rq_yield_curve_get_discount_factor(const rq_yield_curve_t ts, rq_date for_date)
                             zero,
 							ts->zero_method,
 							ts->zero_method_compound_frequency,
-                            rq_day_count_get_year_fraction(ts->default_day_count_convention, ts->from_date, for_date)
+                            rq_yield_curve_get_year_fraction(ts, ts->default_day_count_convention, ts->from_date, for_date)
                             ); 
                     }
                     break;
@@ -561,7 +602,7 @@ rq_yield_curve_get_discount_factor(const rq_yield_curve_t ts, rq_date for_date)
                             ts->discount_factors[ts->num_factors-1].discount_factor,
 							ts->zero_method,
 							ts->zero_method_compound_frequency,
-                            rq_day_count_get_year_fraction(ts->default_day_count_convention, ts->from_date, ts->discount_factors[ts->num_factors-1].date)
+                            rq_yield_curve_get_year_fraction(ts, ts->default_day_count_convention, ts->from_date, ts->discount_factors[ts->num_factors-1].date)
                             );
                         /* double zero = ((1.0 / ts->discount_factors[i-1].discount_factor) - 1.0) * (365.0 / (double)(ts->discount_factors[i-1].date - ts->from_date)); */
                         /* df = 1.0 / (1.0 + zero * (((double)(for_date - ts->from_date)) / 365.0)); */
@@ -569,7 +610,7 @@ rq_yield_curve_get_discount_factor(const rq_yield_curve_t ts, rq_date for_date)
                             zero,
 							ts->zero_method,
 							ts->zero_method_compound_frequency,
-                            rq_day_count_get_year_fraction(ts->default_day_count_convention, ts->from_date, for_date)
+                            rq_yield_curve_get_year_fraction(ts, ts->default_day_count_convention, ts->from_date, for_date)
                             ); 
                     }
                     break;
@@ -586,7 +627,8 @@ rq_yield_curve_get_discount_factor(const rq_yield_curve_t ts, rq_date for_date)
 			/* only apply if non zero additive factor, or non zero & non 1 multiplicative factor - TA */
 			if (apply_additive_factor || apply_multiplicative_factor)
 			{
-                double day_frac = rq_day_count_get_year_fraction(
+                double day_frac = rq_yield_curve_get_year_fraction(
+					ts,
 					ts->default_day_count_convention, 
 					ts->from_date, 
 					for_date
@@ -629,7 +671,8 @@ rq_yield_curve_get_discount_factor(const rq_yield_curve_t ts, rq_date for_date)
 				ts->base_curve,
 		        for_date
 		        );
-		    double day_count_frac_base = rq_day_count_get_year_fraction(
+		    double day_count_frac_base = rq_yield_curve_get_year_fraction(
+				ts,
 				ts->default_day_count_convention,
 		        ts->base_curve->from_date,
 				for_date
@@ -645,7 +688,8 @@ rq_yield_curve_get_discount_factor(const rq_yield_curve_t ts, rq_date for_date)
 				ts->spread_curve,
 		        for_date
 		        );
-		    double day_count_frac_spread = rq_day_count_get_year_fraction(
+		    double day_count_frac_spread = rq_yield_curve_get_year_fraction(
+				ts,
 				ts->default_day_count_convention,
 		        ts->spread_curve->from_date,
 				for_date
@@ -702,7 +746,8 @@ rq_yield_curve_get_discount_factor(const rq_yield_curve_t ts, rq_date for_date)
 				ts->base_curve,
 		        for_date
 		        );
-		    double day_count_frac_base = rq_day_count_get_year_fraction(
+		    double day_count_frac_base = rq_yield_curve_get_year_fraction(
+				ts,
 				ts->default_day_count_convention,
 		        ts->base_curve->from_date,
 				for_date
@@ -725,7 +770,8 @@ rq_yield_curve_get_discount_factor(const rq_yield_curve_t ts, rq_date for_date)
         if (ts->multiplicative_factor && (ts->multiplicative_factor != 1.0))
             zero *= ts->multiplicative_factor;
 
-        day_frac = rq_day_count_get_year_fraction(
+        day_frac = rq_yield_curve_get_year_fraction(
+            ts,
             ts->default_day_count_convention,
             ts->from_date,
             for_date
@@ -739,7 +785,9 @@ rq_yield_curve_get_discount_factor(const rq_yield_curve_t ts, rq_date for_date)
             );
 	}
 
-    if (days < ts->factor_cache_size && !(apply_additive_factor || apply_multiplicative_factor))
+    /* a frozen curve is shared between threads, and its cache is
+       already full */
+    if (!ts->frozen && days < ts->factor_cache_size && !(apply_additive_factor || apply_multiplicative_factor))
         ts->factor_cache[days] = df;
 
     return df;
@@ -766,12 +814,14 @@ rq_yield_curve_get_forward_discount_factor(const rq_yield_curve_t yield_curve, r
 RQ_EXPORT void 
 rq_yield_curve_set_discount_factor(rq_yield_curve_t ts, rq_date for_date, double discount_factor)
 {
+    rq_yield_curve_cache_invalidate(ts);
+
     /* grow the array if necessary */
     if (ts->num_factors == ts->max_factors)
     {
         unsigned int new_max_factors = ts->max_factors * 2;
         ts->discount_factors = 
-            (struct rq_yield_curve_elem *) realloc(
+            (struct rq_yield_curve_elem *) RQ_REALLOC(
             ts->discount_factors, 
             new_max_factors * sizeof(struct rq_yield_curve_elem)
             );
@@ -865,6 +915,7 @@ rq_yield_curve_clone(const rq_yield_curve_t ts)
 	ts_clone->zero_method_compound_frequency = ts->zero_method_compound_frequency;
 
     ts_clone->default_day_count_convention = ts->default_day_count_convention;
+    ts_clone->day_count_calendar = ts->day_count_calendar;
     
     return ts_clone;
 }
@@ -896,7 +947,8 @@ rq_yield_curve_get_simple_rate(
         yield_curve,
         date
         );
-    double day_count_frac = rq_day_count_get_year_fraction(
+    double day_count_frac = rq_yield_curve_get_year_fraction(
+        yield_curve,
         day_count_convention,
         yield_curve->from_date,
         date
@@ -1013,12 +1065,12 @@ rq_yield_curve_get_par_rate_day_count(
                 dates[i]
                 );
 
-            year_count_frac = rq_day_count_get_year_fraction(day_counts[i], dates[i-1], dates[i]);
+            year_count_frac = rq_yield_curve_get_year_fraction(yield_curve, day_counts[i], dates[i-1], dates[i]);
             sum_df += df * year_count_frac;
         }
 
         if (num_dates > 1)
-            year_count_frac = rq_day_count_get_year_fraction(day_counts[num_dates-1], dates[num_dates-2], last_date);
+            year_count_frac = rq_yield_curve_get_year_fraction(yield_curve, day_counts[num_dates-1], dates[num_dates-2], last_date);
 
         sum_df += last_df * year_count_frac;
 
@@ -1083,7 +1135,7 @@ rq_yield_curve_get_accrual_day_count(
                 from_date,
                 dates[i]
                 );
-			year_count_frac = rq_day_count_get_year_fraction(day_count, dates[i-1], dates[i]);
+			year_count_frac = rq_yield_curve_get_year_fraction(yield_curve, day_count, dates[i-1], dates[i]);
             sum_df += df * year_count_frac;
         }
 
@@ -1212,13 +1264,13 @@ double r = 0.0;
                     from_date,
                     dates[i]
                     );
-				year_count_frac = rq_day_count_get_year_fraction(day_count, dates[i-1], dates[i]);
+				year_count_frac = rq_yield_curve_get_year_fraction(yield_curve, day_count, dates[i-1], dates[i]);
                 sum_df += df * year_count_frac;
             }
         }
 
 		if (num_dates > 1)
-            year_count_frac = rq_day_count_get_year_fraction(day_count, dates[num_dates-2], dates[num_dates-1]);
+            year_count_frac = rq_yield_curve_get_year_fraction(yield_curve, day_count, dates[num_dates-2], dates[num_dates-1]);
 
         sum_df += last_df * year_count_frac;
 
@@ -1242,22 +1294,40 @@ rq_yield_curve_get_forward_simple_rate(
       df = 1.0 / (1.0 + effective_rate)^num_compounding_periods_per_year
      
      */
-    double fwd_df = rq_yield_curve_get_forward_discount_factor(
+    double fwd_df;
+    double day_count_frac;
+    double rate;
+    /* a composite curve moves with its base and spread curves, so
+       only plain discount factor curves are memoised. */
+    int memo = (yield_curve->forward_rate_cache &&
+                yield_curve->yield_curve_type == RQ_YIELD_CURVE_TYPE_DISCOUNTFACTOR &&
+                yield_curve->additive_factor == 0.0 &&
+                (yield_curve->multiplicative_factor == 0.0 || yield_curve->multiplicative_factor == 1.0));
+
+    if (memo && rq_forward_rate_cache_find(yield_curve->forward_rate_cache, start_date, end_date, day_count_convention, &rate))
+        return rate;
+
+    fwd_df = rq_yield_curve_get_forward_discount_factor(
         yield_curve,
         start_date,
         end_date
         );
-    double day_count_frac = rq_day_count_get_year_fraction(
+    day_count_frac = rq_yield_curve_get_year_fraction(
+        yield_curve,
         day_count_convention,
         start_date,
         end_date
         );
-    double rate = rq_rate_discount_to_zero(
+    rate = rq_rate_discount_to_zero(
         fwd_df,
 		RQ_ZERO_SIMPLE,
 		0,
         day_count_frac
         );
+
+    if (memo)
+        rq_forward_rate_cache_add(yield_curve->forward_rate_cache, start_date, end_date, day_count_convention, rate);
+
     return rate;
 }
 
@@ -1280,7 +1350,8 @@ rq_yield_curve_get_continuous_rate(
         start_date,
         end_date
         );
-    double day_count_frac = rq_day_count_get_year_fraction(
+    double day_count_frac = rq_yield_curve_get_year_fraction(
+        yield_curve,
         day_count_convention,
         start_date,
         end_date
@@ -1346,6 +1417,8 @@ rq_yield_curve_remove_element_range(
 {
 	unsigned int count = to_offset - from_offset + 1;
 	unsigned int remaining = ts->num_factors - to_offset - 1;
+
+    rq_yield_curve_cache_invalidate(ts);
 	if (remaining > 0)
 	{
 		memmove(&ts->discount_factors[from_offset], &ts->discount_factors[to_offset + 1], remaining * sizeof(struct rq_yield_curve_elem));
@@ -1385,6 +1458,7 @@ rq_yield_curve_set_yield_curve_type(
     enum rq_yield_curve_type yield_curve_type
     )
 {
+    rq_yield_curve_cache_invalidate(ts);
     ts->yield_curve_type = yield_curve_type;
 }
 
@@ -1430,6 +1504,7 @@ rq_yield_curve_set_additive_factor(
     double additive_factor
     )
 {
+    rq_yield_curve_cache_invalidate(ts);
     ts->additive_factor = additive_factor;
 }
 
@@ -1447,6 +1522,7 @@ rq_yield_curve_set_multiplicative_factor(
     double multiplicative_factor
     )
 {
+    rq_yield_curve_cache_invalidate(ts);
     ts->multiplicative_factor = multiplicative_factor;
 }
 
@@ -1457,6 +1533,7 @@ rq_yield_curve_set_composite(
     rq_yield_curve_t spread_curve
     )
 {
+    rq_yield_curve_cache_invalidate(yc);
     yc->yield_curve_type = RQ_YIELD_CURVE_TYPE_COMPOSITE;
     yc->base_curve = base_curve;
     yc->spread_curve = spread_curve;
@@ -1476,3 +1553,19 @@ rq_yield_curve_get_default_day_count_convention(rq_yield_curve_t yc)
 {
     return yc->default_day_count_convention;
 }
+
+RQ_EXPORT void 
+rq_yield_curve_set_day_count_calendar(
+    rq_yield_curve_t yc,
+    rq_calendar_t calendar
+    )
+{
+    rq_yield_curve_cache_invalidate(yc);
+    yc->day_count_calendar = calendar;
+}
+
+RQ_EXPORT rq_calendar_t
+rq_yield_curve_get_day_count_calendar(rq_yield_curve_t yc)
+{
+    return yc->day_count_calendar;
+}
@@ -37,6 +37,8 @@
 #include "rq_rate.h"
 #include "rq_enum.h"
 #include "rq_termstruct.h"
+#include "rq_forward_rate_cache.h"
+#include "rq_calendar.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -61,6 +63,7 @@ typedef struct rq_yield_curve {
     unsigned int max_factors; /**< max number of factors before this structure needs to grow */
     unsigned long factor_cache_size;
     double factor_cache[RQ_FACTOR_CACHE_SIZE]; /**< cache of discout factors for the first x days */
+    rq_forward_rate_cache_t forward_rate_cache; /**< memo of forward simple rates, NULL until the cache is enabled */
     struct rq_yield_curve_elem *discount_factors; /**< the actual discount factors */
     enum rq_interpolation_method interpolation_method; /**< the interpolation method used to get a rate between points */
 
@@ -74,6 +77,8 @@ typedef struct rq_yield_curve {
 	enum rq_zero_method zero_method; /**< definition of zero rate */
 	unsigned int zero_method_compound_frequency; /**< compound frequency (#times in a year) */
     enum rq_day_count_convention default_day_count_convention;
+    rq_calendar_t day_count_calendar; /**< counts the business days for BUS/252, not owned by the curve */
+    short frozen; /**< set by rq_yield_curve_freeze() until the curve next changes */
 	const char *debug_filename; // If set then internal calculations will be logged here, set from Valuation Analysis.
 } *rq_yield_curve_t;
 
@@ -91,6 +96,20 @@ struct rq_yield_curve_elem {
 /* Enable use of the cache. This should be called after bootstrapping. */
 RQ_EXPORT void rq_yield_curve_cache_enable(rq_yield_curve_t);
 
+/** Drop the cached discount factors and forward rates. This is done
+ * by the functions that change the curve, and must be called by
+ * anything that changes the discount factors directly.
+ */
+RQ_EXPORT void rq_yield_curve_cache_invalidate(rq_yield_curve_t ts);
+
+/** Fill the cached discount factors, so that reading the curve no
+ * longer writes to it and the curve can be shared between pricing
+ * threads. The forward rate cache is locked, and so is safe to
+ * fill lazily. This is undone by anything that invalidates the
+ * cache, and does nothing if the cache isn't enabled.
+ */
+RQ_EXPORT void rq_yield_curve_freeze(rq_yield_curve_t ts);
+
 /** Test whether the rq_yield_curve is NULL */
 RQ_EXPORT int rq_yield_curve_is_null(rq_yield_curve_t obj);
 
@@ -461,12 +480,39 @@ RQ_EXPORT void rq_yield_curve_set_default_day_count_convention(
 RQ_EXPORT enum rq_day_count_convention 
 rq_yield_curve_get_default_day_count_convention(rq_yield_curve_t yc);
 
+/** Set the calendar used for the business day conventions (BUS/252)
+ * when calculating year fractions along the curve. The calendar
+ * isn't owned by the curve and must outlive it.
+ */
+RQ_EXPORT void rq_yield_curve_set_day_count_calendar(
+    rq_yield_curve_t yc,
+    rq_calendar_t calendar
+    );
+
+/** Get the calendar used for the business day conventions, or NULL
+ * if weekdays are counted.
+ */
+RQ_EXPORT rq_calendar_t
+rq_yield_curve_get_day_count_calendar(rq_yield_curve_t yc);
+
+/** Calculate a year fraction the way the curve does, using the
+ * curve's day count calendar for the business day conventions.
+ */
+RQ_EXPORT double
+rq_yield_curve_get_year_fraction(
+    const rq_yield_curve_t yc,
+    enum rq_day_count_convention day_count_convention,
+    rq_date start_date,
+    rq_date end_date
+    );
+
 double 
 rq_curve_interpolation_get_discount_factor(
 	enum rq_interpolation_method method,
 	enum rq_zero_method zero_method,
 	unsigned int zero_method_compound_frequency,
 	enum rq_day_count_convention curveDayCountConvention,
+	const rq_calendar_t curveDayCountCalendar,
 	rq_date curveBaseDate,
 	const struct rq_yield_curve_elem* pointStart,  /* TODO This should be generic like a rq_curve_point and then extracted */
 	const struct rq_yield_curve_elem* pointEnd,   /* TODO This should be generic like a rq_curve_point and then extracted */
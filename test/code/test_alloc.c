@@ -0,0 +1,101 @@
+#include <rq.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(RQ_CUSTOM_ALLOCATOR) && defined(RQ_THREADS)
+#include <pthread.h>
+
+/* frees a small block on a thread that then exits */
+static void *
+thread_main(void *block)
+{
+    *(void **)block = RQ_MALLOC(240);
+    RQ_FREE(*(void **)block);
+    return NULL;
+}
+#endif
+
+int
+main(int argc, char **argv)
+{
+    rq_arena_t arena = rq_arena_alloc(0);
+    rq_array_t strings = rq_array_alloc(rq_free_func);
+    char *p;
+    char *q;
+    int i;
+    int ret = 0;
+
+    /* growing a block across size classes keeps its contents */
+    p = (char *)RQ_MALLOC(10);
+    strcpy(p, "123456789");
+    for (i = 1; i <= 8; i++)
+    {
+        p = (char *)RQ_REALLOC(p, i * 100);
+        if (strcmp(p, "123456789"))
+            { ret = -1; printf("fail line %d\n", __LINE__); }
+    }
+    RQ_FREE(p);
+
+    /* containers free their elements through rq_free_func */
+    for (i = 0; i < 100; i++)
+        rq_array_push_back(strings, RQ_STRDUP("string"));
+    rq_array_free(strings);
+
+#ifdef RQ_CUSTOM_ALLOCATOR
+    /* a freed small block is reused for the next request of its size class */
+    p = (char *)RQ_MALLOC(40);
+    RQ_FREE(p);
+    q = (char *)RQ_MALLOC(48);
+    if (p != q)
+        { ret = -1; printf("fail line %d\n", __LINE__); }
+    RQ_FREE(q);
+
+    /* while an arena is pushed allocations come from it and frees do nothing */
+    rq_alloc_push_arena(arena);
+    for (i = 0; i < 1000; i++)
+    {
+        p = (char *)RQ_CALLOC(1, 24);
+        if (p[0] != 0)
+            { ret = -1; printf("fail line %d\n", __LINE__); }
+        RQ_FREE(p);
+    }
+    p = (char *)RQ_STRDUP("arena");
+    p = (char *)RQ_REALLOC(p, 1000);
+    if (strcmp(p, "arena"))
+        { ret = -1; printf("fail line %d\n", __LINE__); }
+    rq_alloc_pop_arena();
+
+    if (arena->bytes_allocated < 1000 * 24)
+        { ret = -1; printf("fail line %d\n", __LINE__); }
+
+    /* and after popping it they don't */
+    q = (char *)RQ_MALLOC(24);
+    RQ_FREE(q);
+
+    /* a count and size whose product doesn't fit in a size_t */
+    if (RQ_CALLOC((size_t)-1 / 8 + 2, 8) != NULL)
+        { ret = -1; printf("fail line %d\n", __LINE__); }
+
+#ifdef RQ_THREADS
+    /* the blocks a thread freed are handed out again after it exits,
+       in a size class this thread hasn't used yet */
+    {
+        pthread_t thread;
+        void *block = NULL;
+
+        pthread_create(&thread, NULL, thread_main, &block);
+        pthread_join(thread, NULL);
+        p = (char *)RQ_MALLOC(240);
+        if (!block || p != block)
+            { ret = -1; printf("fail line %d\n", __LINE__); }
+        RQ_FREE(p);
+    }
+#endif
+#endif
+
+    rq_arena_free(arena);
+
+    if (ret == 0)
+        printf("Allocator test successful\n");
+
+    return ret;
+}
@@ -0,0 +1,72 @@
+#include <rq.h>
+#include <stdlib.h>
+#include <math.h>
+
+int
+main(int argc, char **argv)
+{
+    double S = 100.0;
+    double r_dom = 0.08;
+    double r_for = 0.01;
+    double sigma = 0.25;
+    double tau = 1.0;
+    double strikes[5] = { 80.0, 90.0, 100.0, 110.0, 120.0 };
+    double batch[5];
+    double *work = (double *)malloc(sizeof(double) * RQ_PRICING_BINOMIAL_WORK_SIZE(400));
+    int ret = 0;
+    int i;
+
+    for (i = 0; i < 5; i++)
+    {
+        double X = strikes[i];
+        double value_bs = rq_pricing_blackscholes(1, S, X, r_dom, r_for, sigma, tau, tau);
+        double value_lr = rq_pricing_binomial_lattice(
+            1, 0, RQ_BINOMIAL_TREE_LEISEN_REIMER, 
+            S, X, r_dom, r_for, sigma, tau, tau, 101, work
+            );
+        double value_bbsr = rq_pricing_binomial_extrapolated(
+            1, 0, RQ_BINOMIAL_TREE_CRR, 
+            S, X, r_dom, r_for, sigma, tau, tau, 200, work
+            );
+        double value_tian = rq_pricing_binomial_extrapolated(
+            1, 0, RQ_BINOMIAL_TREE_TIAN, 
+            S, X, r_dom, r_for, sigma, tau, tau, 200, NULL
+            );
+        double put_euro = rq_pricing_binomial_extrapolated(
+            0, 0, RQ_BINOMIAL_TREE_LEISEN_REIMER, 
+            S, X, r_dom, r_for, sigma, tau, tau, 101, work
+            );
+        double put_amer = rq_pricing_binomial_extrapolated(
+            0, RQ_BINOMIAL_FLAG_AMERICAN, RQ_BINOMIAL_TREE_LEISEN_REIMER, 
+            S, X, r_dom, r_for, sigma, tau, tau, 101, work
+            );
+
+        printf("X = %.2f BS = %.8f LR = %.8f BBSR = %.8f Tian = %.8f Put = %.8f American Put = %.8f\n",
+               X, value_bs, value_lr, value_bbsr, value_tian, put_euro, put_amer);
+
+        if (fabs(value_bs - value_lr) > 0.001 ||
+            fabs(value_bs - value_bbsr) > 0.001 ||
+            fabs(value_bs - value_tian) > 0.001 ||
+            put_amer < put_euro)
+            ret = -1;
+    }
+
+    rq_pricing_binomial_strikes(
+        0, RQ_BINOMIAL_FLAG_AMERICAN | RQ_BINOMIAL_FLAG_SMOOTH, RQ_BINOMIAL_TREE_CRR,
+        S, strikes, 5, r_dom, r_for, sigma, tau, tau, 400, batch, work
+        );
+
+    for (i = 0; i < 5; i++)
+    {
+        double single = rq_pricing_binomial_lattice(
+            0, RQ_BINOMIAL_FLAG_AMERICAN | RQ_BINOMIAL_FLAG_SMOOTH, RQ_BINOMIAL_TREE_CRR,
+            S, strikes[i], r_dom, r_for, sigma, tau, tau, 400, NULL
+            );
+        if (fabs(single - batch[i]) > 1e-12)
+            ret = -1;
+    }
+
+    free(work);
+
+    return ret;
+}
@@ -0,0 +1,129 @@
+#include <rq.h>
+#include <stdlib.h>
+
+static long
+joint_count(rq_calendar_t cal1, rq_calendar_t cal2, rq_date from, rq_date to)
+{
+    long count = 0;
+    rq_date d;
+
+    for (d = from; d <= to; d++)
+        if (rq_calendar_is_good_date(cal1, d) && rq_calendar_is_good_date(cal2, d))
+            count++;
+
+    return count;
+}
+
+int
+main(int argc, char **argv)
+{
+    rq_date start = rq_date_from_dmy(1, 1, 2000);
+    rq_date end = rq_date_from_dmy(31, 12, 2040);
+    rq_calendar_t cal1 = rq_calendar_alloc("SYD");
+    rq_calendar_t cal2 = rq_calendar_alloc("LON");
+    rq_calendar_t plain1;
+    rq_calendar_t plain2;
+    rq_calendar_t cals[2];
+    rq_calendar_t joint;
+    rq_date d;
+    int ret = 0;
+
+    srand(99);
+    for (d = start - 400; d <= end + 400; d++)
+    {
+        if (rand() % 20 == 0)
+            rq_calendar_add_event(cal1, d, RQ_DATE_EVENT_GEN_HOLIDAY);
+        if (rand() % 25 == 0)
+            rq_calendar_add_event(cal2, d, RQ_DATE_EVENT_GEN_HOLIDAY);
+    }
+
+    plain1 = rq_calendar_clone(cal1);
+    plain2 = rq_calendar_clone(cal2);
+
+    /* an odd horizon so the bitmap doesn't end on a word boundary */
+    rq_calendar_compile(cal1, start + 3, end - 5);
+    rq_calendar_compile(cal2, start + 3, end - 5);
+    if (!rq_calendar_is_compiled(cal1) || rq_calendar_is_compiled(plain1))
+        ret = -1;
+
+    cals[0] = cal1;
+    cals[1] = cal2;
+    joint = rq_calendar_alloc_joint("SYD+LON", cals, 2, start + 3, end - 5);
+
+    /* the compiled calendars agree with the uncompiled ones, inside
+       and outside the horizon */
+    for (d = start - 300; d <= end + 300; d++)
+    {
+        short good1 = rq_calendar_is_good_date(plain1, d);
+        short good2 = rq_calendar_is_good_date(plain2, d);
+
+        if (rq_calendar_is_good_date(cal1, d) != good1 ||
+            rq_calendar_is_good_date(joint, d) != (good1 && good2))
+        {
+            printf("is_good_date mismatch at %ld\n", d);
+            ret = -1;
+            break;
+        }
+
+        if (rq_calendar_next_good_date(cal1, d) != rq_calendar_next_good_date(plain1, d) ||
+            rq_calendar_prev_good_date(cal1, d) != rq_calendar_prev_good_date(plain1, d))
+        {
+            printf("next/prev good date mismatch at %ld\n", d);
+            ret = -1;
+            break;
+        }
+    }
+
+    for (d = start - 200; d <= end + 200; d += 37)
+    {
+        rq_date to = d + (rand() % 12000);
+
+        if (rq_calendar_businessday_count(cal1, d, to) != rq_calendar_businessday_count(plain1, d, to) ||
+            rq_calendar_businessday_count(joint, d, to) != joint_count(plain1, plain2, d, to))
+        {
+            printf("businessday_count mismatch from %ld to %ld\n", d, to);
+            ret = -1;
+            break;
+        }
+    }
+
+    /* adding an event discards the compiled form */
+    rq_calendar_add_event(cal1, start + 10, RQ_DATE_EVENT_GEN_HOLIDAY);
+    if (rq_calendar_is_compiled(cal1) || rq_calendar_is_good_date(cal1, start + 10))
+        ret = -1;
+
+    /* a holiday's mask survives being written and read back */
+    {
+        rq_stream_t stream = rq_stream_string_alloc();
+        rq_calendar_t read = rq_calendar_alloc("SYD");
+
+        rq_stream_open(stream);
+        rq_calendar_write_to_stream(plain1, stream);
+        rq_stream_rewind(stream);
+        if (rq_calendar_read_from_stream(read, stream) != RQ_OK)
+        {
+            printf("couldn't read the calendar back\n");
+            ret = -1;
+        }
+        for (d = start; d <= end && ret == 0; d++)
+            if (rq_calendar_get_event_mask(read, d) != rq_calendar_get_event_mask(plain1, d))
+            {
+                printf("the calendar read back has a different event at %ld\n", d);
+                ret = -1;
+            }
+
+        rq_calendar_free(read);
+        rq_stream_free(stream);
+    }
+
+    rq_calendar_free(joint);
+    rq_calendar_free(cal1);
+    rq_calendar_free(cal2);
+    rq_calendar_free(plain1);
+    rq_calendar_free(plain2);
+
+    if (ret == 0)
+        printf("Compiled calendar test successful\n");
+
+    return ret;
+}
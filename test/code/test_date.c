@@ -0,0 +1,92 @@
+#include <rq.h>
+#include <stdlib.h>
+
+int
+main(int argc, char **argv)
+{
+    static const enum rq_day_count_convention conventions[] = {
+        RQ_DAY_COUNT_ACTUAL_360,
+        RQ_DAY_COUNT_ACTUAL_365,
+        RQ_DAY_COUNT_ACTUAL_365_FIXED,
+        RQ_DAY_COUNT_ACTUAL_365_25,
+        RQ_DAY_COUNT_30_360,
+        RQ_DAY_COUNT_E30_360,
+        RQ_DAY_COUNT_ACTUAL_ACTUAL_ISDA,
+        RQ_DAY_COUNT_ACTUAL_ACTUAL_AFB
+    };
+    unsigned num_conventions = sizeof(conventions) / sizeof(conventions[0]);
+    rq_date start_dates[5000];
+    rq_date end_dates[5000];
+    double year_fractions[5000];
+    rq_date d;
+    unsigned i, j;
+    int ret = 0;
+
+    /* known dates */
+    if (rq_date_from_dmy(1, 1, 2000) != 2451545 ||
+        rq_date_from_dmy(31, 12, 2099) != RQ_DATE_END_OF_DAYS ||
+        rq_date_from_dmy(1, 3, 1900) - rq_date_from_dmy(28, 2, 1900) != 1 ||
+        rq_date_from_dmy(1, 3, 2100) - rq_date_from_dmy(28, 2, 2100) != 1 ||
+        rq_date_from_dmy(1, 3, 2000) - rq_date_from_dmy(28, 2, 2000) != 2 ||
+        rq_date_get_day_of_week(rq_date_from_dmy(19, 10, 2026)) != RQ_DAY_OF_WEEK_MONDAY)
+    {
+        printf("known dates failed\n");
+        ret = -1;
+    }
+
+    /* every day from 1600 to 2400 round trips and steps correctly */
+    for (d = rq_date_from_dmy(1, 1, 1600); d < rq_date_from_dmy(1, 1, 2400); d++)
+    {
+        short day, month, year;
+        short next_day, next_month, next_year;
+
+        rq_date_to_dmy(d, &day, &month, &year);
+        rq_date_to_dmy(d + 1, &next_day, &next_month, &next_year);
+
+        if (rq_date_from_dmy(day, month, year) != d ||
+            (next_day == 1 ?
+             (day != rq_date_get_days_in_month(month, year) ||
+              next_month != (month % 12) + 1 ||
+              next_year != year + (month == 12)) :
+             (next_day != day + 1 || next_month != month || next_year != year)))
+        {
+            printf("round trip failed at %ld\n", d);
+            ret = -1;
+            break;
+        }
+    }
+
+    if (rq_date_month_diff(rq_date_from_dmy(16, 6, 2000), rq_date_from_dmy(2, 3, 2001)) != 9 ||
+        rq_date_month_diff(rq_date_from_dmy(2, 3, 2001), rq_date_from_dmy(16, 6, 2000)) != -9)
+        ret = -1;
+
+    /* the batch year fractions match the scalar ones */
+    srand(7);
+    for (i = 0; i < 5000; i++)
+    {
+        start_dates[i] = rq_date_from_dmy(1, 1, 1990) + rand() % 15000;
+        end_dates[i] = start_dates[i] + rand() % 4000;
+        /* plenty of month ends */
+        if (i % 3 == 0)
+            start_dates[i] = rq_date_from_dmy(31, (short)(1 + 2 * (i % 4)), (short)(1990 + i % 30));
+        if (i % 5 == 0)
+            end_dates[i] = rq_date_from_dmy(31, (short)(1 + 2 * (i % 4)), (short)(2021 + i % 20));
+    }
+
+    for (j = 0; j < num_conventions; j++)
+    {
+        rq_day_count_get_year_fractions(conventions[j], start_dates, end_dates, year_fractions, 5000);
+        for (i = 0; i < 5000; i++)
+            if (year_fractions[i] != rq_day_count_get_year_fraction(conventions[j], start_dates[i], end_dates[i]))
+            {
+                printf("year fraction mismatch for convention %d at %u\n", conventions[j], i);
+                ret = -1;
+                break;
+            }
+    }
+
+    if (ret == 0)
+        printf("Date test successful\n");
+
+    return ret;
+}
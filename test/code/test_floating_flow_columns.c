@@ -0,0 +1,181 @@
+#include <rq.h>
+#include <stdlib.h>
+#include <math.h>
+
+static rq_yield_curve_t
+make_curve(rq_date from_date, double rate)
+{
+    rq_yield_curve_t yc = rq_yield_curve_init(
+        "AUD.BBSW", RQ_INTERPOLATION_INVALID, RQ_EXTRAPOLATION_INVALID,
+        RQ_EXTRAPOLATION_INVALID, RQ_ZERO_INVALID, 0, RQ_DAY_COUNT_ACTUAL_365,
+        from_date);
+    int i;
+
+    for (i = 1; i <= 40; i++)
+        rq_yield_curve_set_discount_factor(yc, from_date + i * 91, exp(-(rate + 0.0005 * i) * i * 91 / 365.0));
+    return yc;
+}
+
+/* value the flows one at a time, the way the columns are meant to */
+static double
+value_flows(rq_floating_flow_list_t ffl, rq_rateset_t rs, rq_yield_curve_t disc)
+{
+    double pv = 0.0;
+    unsigned long i;
+
+    for (i = 0; i < rq_floating_flow_list_size(ffl); i++)
+    {
+        rq_floating_flow_t ff = rq_floating_flow_list_get_at(ffl, i);
+        rq_floating_flow_set_floating_rate_from_curve_and_historic(ff, rs, 0.0, 0);
+        rq_floating_flow_set_payment(ff, rs);
+        pv += (ff->pay_receive == RQ_PAY_RECEIVE_PAY ? -1.0 : 1.0) *
+            ff->payment_amount * rq_yield_curve_get_discount_factor(disc, ff->payment_date);
+    }
+    return pv;
+}
+
+static int
+compare(rq_floating_flow_list_t ffl1, rq_floating_flow_list_t ffl2, double pv1, double pv2)
+{
+    unsigned long i;
+
+    for (i = 0; i < rq_floating_flow_list_size(ffl1); i++)
+    {
+        rq_floating_flow_t ff1 = rq_floating_flow_list_get_at(ffl1, i);
+        rq_floating_flow_t ff2 = rq_floating_flow_list_get_at(ffl2, i);
+        if (ff1->rate != ff2->rate ||
+            ff1->payment_amount != ff2->payment_amount ||
+            ff1->flow_status != ff2->flow_status)
+        {
+            printf("flow %lu differs: %.17g %.17g\n", i, ff1->rate, ff2->rate);
+            return -1;
+        }
+    }
+    if (fabs(pv1 - pv2) > 1e-9 * fabs(pv2))
+    {
+        printf("present value differs: %.17g %.17g\n", pv1, pv2);
+        return -1;
+    }
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    rq_date from_date = rq_date_from_dmy(1, 6, 2010);
+    rq_yield_curve_t yc1 = make_curve(from_date, 0.05);
+    rq_yield_curve_t yc2 = make_curve(from_date, 0.06);
+    rq_yield_curve_t disc = make_curve(from_date, 0.045);
+    struct rq_schedule_params params;
+    rq_schedule_t schedule;
+    rq_floating_flow_list_t ffl;
+    rq_floating_flow_list_t ffl2;
+    rq_floating_flow_columns_t cols = rq_floating_flow_columns_alloc();
+    struct rq_rateset rs;
+    rq_calendar_t cals[2];
+    double pv;
+    unsigned long i;
+    short year;
+    int ret = 0;
+
+    cals[0] = rq_calendar_alloc("SYD");
+    cals[1] = rq_calendar_alloc("BRL");
+    for (year = 2010; year <= 2020; year++)
+    {
+        rq_calendar_add_event(cals[0], rq_date_from_dmy(26, 1, year), RQ_DATE_EVENT_GEN_HOLIDAY);
+        rq_calendar_add_event(cals[1], rq_date_from_dmy(21, 4, year), RQ_DATE_EVENT_GEN_HOLIDAY);
+        rq_calendar_add_event(cals[1], rq_date_from_dmy(7, 9, year), RQ_DATE_EVENT_GEN_HOLIDAY);
+    }
+
+    rq_schedule_params_init(&params);
+    params.start_date = rq_date_from_dmy(15, 3, 2010);
+    params.end_date = rq_date_from_dmy(15, 3, 2018);
+    rq_term_fill(&params.term, 0, 0, 3, 0);
+    params.fixing_offset = -2;
+    params.day_count_convention = RQ_DAY_COUNT_ACTUAL_360;
+    schedule = rq_schedule_generate(&params);
+
+    ffl = rq_floating_flow_list_alloc();
+    rq_floating_flow_list_add_floating_leg(ffl, schedule, RQ_PAY_RECEIVE_PAY, "AUD.BBSW", "AUD", 1e6, 0.001);
+    rq_floating_flow_list_add_fixed_leg(ffl, schedule, RQ_PAY_RECEIVE_RECEIVE, "AUD", 1e6, 0.0525);
+    /* one period fixes on the curve date, and one period has a
+       multiplier */
+    rq_floating_flow_list_get_at(ffl, 5)->floating_rate->fixing_date = from_date;
+    rq_floating_flow_list_get_at(ffl, 9)->floating_rate->rate_multiplier = 1.5;
+    ffl2 = rq_floating_flow_list_clone(ffl);
+
+    rq_rateset_init(&rs);
+    rs.yc1 = yc1;
+    rs.current_date = from_date;
+
+    rq_floating_flow_columns_build(cols, ffl);
+    if (cols->num_flows != 2 * rq_schedule_get_num_periods(schedule))
+        ret = -1;
+
+    /* the current period fixed before the curve date and is set by
+       the per-flow functions */
+    rq_floating_flow_columns_evaluate(cols, &rs, disc);
+    if (!(cols->kinds[0] & RQ_FLOATING_FLOW_COLUMN_SINGLE) ||
+        !(cols->kinds[1] & RQ_FLOATING_FLOW_COLUMN_PROJECTED))
+        ret = -1;
+    pv = value_flows(ffl2, &rs, disc);
+    if (ret == 0)
+        ret = compare(ffl, ffl2, rq_floating_flow_columns_get_present_value(cols), pv);
+
+    /* a second scenario reuses the gathered queries, but the period
+       that fixed on the curve date keeps its rate */
+    rs.yc1 = yc2;
+    rq_floating_flow_columns_evaluate(cols, &rs, disc);
+    if (cols->kinds[5] != RQ_FLOATING_FLOW_COLUMN_KNOWN)
+        ret = -1;
+    pv = value_flows(ffl2, &rs, disc);
+    if (ret == 0)
+        ret = compare(ffl, ffl2, rq_floating_flow_columns_get_present_value(cols), pv);
+
+    /* a business day count projects in the curve's calendar, and
+       changing the calendar regathers the queries */
+    for (i = 0; i < rq_floating_flow_list_size(ffl); i++)
+    {
+        rq_floating_flow_list_get_at(ffl, i)->day_count_convention = RQ_DAY_COUNT_BUS_252;
+        rq_floating_flow_list_get_at(ffl2, i)->day_count_convention = RQ_DAY_COUNT_BUS_252;
+    }
+    rq_floating_flow_columns_build(cols, ffl);
+    for (i = 0; i < 2; i++)
+    {
+        rq_yield_curve_set_day_count_calendar(yc2, cals[i]);
+        rq_floating_flow_columns_evaluate(cols, &rs, disc);
+        pv = value_flows(ffl2, &rs, disc);
+        if (ret == 0)
+            ret = compare(ffl, ffl2, rq_floating_flow_columns_get_present_value(cols), pv);
+    }
+
+    /* a rate period with no length projects a zero rate rather than
+       dividing by a zero year fraction */
+    {
+        rq_floating_flow_rate_t ffr = rq_floating_flow_list_get_at(ffl, 12)->floating_rate;
+        ffr->rate_end_date = ffr->rate_start_date;
+    }
+    rq_floating_flow_columns_build(cols, ffl);
+    rq_floating_flow_columns_evaluate(cols, &rs, disc);
+    pv = rq_floating_flow_columns_get_present_value(cols);
+    if (cols->rates[12] != 0.0 || pv != pv)
+    {
+        printf("empty rate period gave %g\n", cols->rates[12]);
+        ret = -1;
+    }
+
+    rq_floating_flow_columns_free(cols);
+    rq_floating_flow_list_free(ffl);
+    rq_floating_flow_list_free(ffl2);
+    rq_schedule_free(schedule);
+    rq_yield_curve_free(yc1);
+    rq_yield_curve_free(yc2);
+    rq_yield_curve_free(disc);
+    rq_calendar_free(cals[0]);
+    rq_calendar_free(cals[1]);
+
+    if (ret == 0)
+        printf("Floating flow columns test successful\n");
+
+    return ret;
+}
@@ -0,0 +1,61 @@
+#include <rq.h>
+#include <stdlib.h>
+#include <math.h>
+
+int
+main(int argc, char **argv)
+{
+    rq_date from_date = rq_date_from_dmy(1, 6, 2010);
+    rq_yield_curve_t yc = rq_yield_curve_init(
+        "AUD.BBSW", RQ_INTERPOLATION_INVALID, RQ_EXTRAPOLATION_INVALID,
+        RQ_EXTRAPOLATION_INVALID, RQ_ZERO_INVALID, 0, RQ_DAY_COUNT_ACTUAL_365,
+        from_date);
+    rq_yield_curve_t plain;
+    rq_forward_rate_cache_t c;
+    double r1;
+    double r2;
+    int i;
+    int ret = 0;
+
+    for (i = 1; i <= 40; i++)
+        rq_yield_curve_set_discount_factor(yc, from_date + i * 91, exp(-(0.05 + 0.0005 * i) * i * 91 / 365.0));
+    plain = rq_yield_curve_clone(yc);
+    rq_yield_curve_cache_enable(yc);
+    c = yc->forward_rate_cache;
+
+    /* memoised rates are the rates the curve projects */
+    for (i = 0; i < 2000; i++)
+    {
+        rq_date start = from_date + (i % 1000) * 3;
+        r1 = rq_yield_curve_get_forward_simple_rate(yc, start, start + 91, RQ_DAY_COUNT_ACTUAL_360);
+        r2 = rq_yield_curve_get_forward_simple_rate(plain, start, start + 91, RQ_DAY_COUNT_ACTUAL_360);
+        if (r1 != r2)
+            ret = -1;
+    }
+    if (rq_forward_rate_cache_size(c) != 1000 || c->hits != 1000 || c->misses != 1000)
+        ret = -1;
+
+    /* the day count is part of the key */
+    r1 = rq_yield_curve_get_forward_simple_rate(yc, from_date, from_date + 91, RQ_DAY_COUNT_ACTUAL_365);
+    r2 = rq_yield_curve_get_forward_simple_rate(plain, from_date, from_date + 91, RQ_DAY_COUNT_ACTUAL_365);
+    if (r1 != r2 || rq_forward_rate_cache_size(c) != 1001)
+        ret = -1;
+
+    /* changing the curve drops the memo */
+    rq_yield_curve_set_discount_factor(yc, from_date + 30, 0.99);
+    rq_yield_curve_set_discount_factor(plain, from_date + 30, 0.99);
+    if (rq_forward_rate_cache_size(c) != 0)
+        ret = -1;
+    r1 = rq_yield_curve_get_forward_simple_rate(yc, from_date, from_date + 91, RQ_DAY_COUNT_ACTUAL_365);
+    r2 = rq_yield_curve_get_forward_simple_rate(plain, from_date, from_date + 91, RQ_DAY_COUNT_ACTUAL_365);
+    if (r1 != r2)
+        ret = -1;
+
+    rq_yield_curve_free(yc);
+    rq_yield_curve_free(plain);
+
+    if (ret == 0)
+        printf("Forward rate cache test successful\n");
+
+    return ret;
+}
@@ -0,0 +1,86 @@
+#include <rq.h>
+#include <stdlib.h>
+#include <string.h>
+
+static double
+calc_terminal(void *user_defined, double log_S, double prev_value)
+{
+    return exp(log_S);
+}
+
+int
+main(int argc, char **argv)
+{
+    struct rq_instrument_alloc_stats as;
+    struct rq_instrument_timer_stats ts;
+    struct rq_instrument_call_site call_sites[4];
+    double terminal_distribution[100];
+    rq_stream_t stream;
+    char json[8192];
+    int len;
+    int i;
+    int ret = 0;
+
+    /* nothing is recorded until the instrumentation is switched on */
+    rq_instrument_record_alloc("rq_bootstrap_yield_curve.c", 10, 100);
+    rq_instrument_get_alloc_stats(RQ_INSTRUMENT_SUBSYSTEM_BOOTSTRAP, &as);
+    if (as.allocs != 0)
+        { ret = -1; printf("fail line %d\n", __LINE__); }
+
+    rq_instrument_set_enabled(1);
+    rq_instrument_set_sample_rate(2);
+    rq_instrument_reset();
+
+    if (rq_instrument_get_subsystem_for_file("src/rq/rq_bootstrap_adapter_yield_curve.c") != RQ_INSTRUMENT_SUBSYSTEM_BOOTSTRAP ||
+        rq_instrument_get_subsystem_for_file("rq_pricing_monte_carlo.c") != RQ_INSTRUMENT_SUBSYSTEM_MONTE_CARLO ||
+        rq_instrument_get_subsystem_for_file("C:\\rq\\rq_xml_parser.c") != RQ_INSTRUMENT_SUBSYSTEM_XML ||
+        rq_instrument_get_subsystem_for_file("rq_yield_curve.c") != RQ_INSTRUMENT_SUBSYSTEM_TERMSTRUCT ||
+        rq_instrument_get_subsystem_for_file("rq_calendar.c") != RQ_INSTRUMENT_SUBSYSTEM_OTHER)
+        { ret = -1; printf("fail line %d\n", __LINE__); }
+
+    /* allocations are charged to subsystems and every second one to its call site */
+    for (i = 0; i < 10; i++)
+        rq_instrument_record_alloc("rq_bootstrap_yield_curve.c", 10, 100);
+    for (i = 0; i < 4; i++)
+        rq_instrument_record_alloc("rq_trade_mgr.c", 20, 1000);
+    rq_instrument_record_realloc(RQ_INSTRUMENT_SUBSYSTEM_BOOTSTRAP, 100, 300);
+    rq_instrument_record_free(RQ_INSTRUMENT_SUBSYSTEM_BOOTSTRAP, 300);
+
+    rq_instrument_get_alloc_stats(RQ_INSTRUMENT_SUBSYSTEM_BOOTSTRAP, &as);
+    if (as.allocs != 10 || as.reallocs != 1 || as.frees != 1 ||
+        as.bytes_allocated != 1200 || as.bytes_in_flight != 900 || as.peak_bytes_in_flight != 1200)
+        { ret = -1; printf("fail line %d\n", __LINE__); }
+
+    if (rq_instrument_get_call_sites(call_sites, 4) != 2 ||
+        strcmp(call_sites[0].file, "rq_trade_mgr.c") || call_sites[0].line != 20 ||
+        call_sites[0].samples != 2 || call_sites[0].bytes != 2000 ||
+        call_sites[0].subsystem != RQ_INSTRUMENT_SUBSYSTEM_TRADE ||
+        call_sites[1].samples != 5)
+        { ret = -1; printf("fail line %d\n", __LINE__); }
+
+    /* the Monte Carlo engine is timed */
+    rq_pricing_monte_carlo(100.0, 0.05, 0.03, 0.2, 1.0, 100, terminal_distribution, 10, NULL, NULL, NULL, NULL, calc_terminal, NULL, NULL);
+    rq_instrument_get_timer_stats(RQ_INSTRUMENT_TIMER_MONTE_CARLO, &ts);
+    if (ts.calls != 1 || ts.total_seconds < 0.0 || ts.max_seconds != ts.total_seconds)
+        { ret = -1; printf("fail line %d\n", __LINE__); }
+
+    stream = rq_stream_string_alloc();
+    rq_stream_open(stream);
+    rq_instrument_write_json(stream);
+    rq_stream_rewind(stream);
+    len = rq_stream_read(stream, json, sizeof(json) - 1);
+    json[len > 0 ? len : 0] = '\0';
+    rq_stream_free(stream);
+
+    if (!strstr(json, "\"bootstrap\": { \"allocs\": 10, \"reallocs\": 1, \"frees\": 1, \"bytes_allocated\": 1200, \"bytes_in_flight\": 900, \"peak_bytes_in_flight\": 1200 }") ||
+        !strstr(json, "\"monte_carlo\": { \"calls\": 1,") ||
+        !strstr(json, "{ \"file\": \"rq_trade_mgr.c\", \"line\": 20, \"subsystem\": \"trade\", \"samples\": 2, \"bytes\": 2000 }"))
+        { ret = -1; printf("fail line %d\n%s", __LINE__, json); }
+
+    rq_instrument_set_enabled(0);
+
+    if (ret == 0)
+        printf("Instrumentation test successful\n");
+
+    return ret;
+}
@@ -0,0 +1,242 @@
+#include <rq.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/* Compiles forms into programs and checks what they return against
+   the tree walking interpreter and the values expected, then checks
+   that a program sees a global set after it was compiled and that
+   forms that can't be compiled, including an if whose test might be
+   a number and arithmetic that might be integer or double, are
+   reported. */
+
+static const char *script =
+    "(setq strike 100.0)\n"
+    "(setq barrier 130)\n"
+    "(setq counter 0)\n"
+    "(setq start 2010-01-31)\n"
+    "(defun call-payoff (s k) (max 0.0 (- s k)))\n"
+    "(defun knocked-out (s) (> s barrier))\n"
+    "(defun fact (n) (if (< n 2) 1 (* n (fact (- n 1)))))\n";
+
+static rq_object_t
+parse(rq_interpreter_t interp, const char *text)
+{
+    rq_stream_t stream = rq_stream_string_alloc();
+    rq_object_t forms;
+
+    rq_stream_open(stream);
+    rq_stream_write_string(stream, text);
+    rq_stream_rewind(stream);
+    forms = rq_interpreter_parse(interp, stream);
+    rq_stream_free(stream);
+
+    return forms;
+}
+
+static double
+object_value(rq_object_t obj)
+{
+    switch (rq_object_get_object_type(obj))
+    {
+        case RQ_OBJECT_TYPE_TRUE:
+            return 1.0;
+
+        case RQ_OBJECT_TYPE_INTEGER:
+            return obj->value.i;
+
+        case RQ_OBJECT_TYPE_DOUBLE:
+            return obj->value.d;
+
+        case RQ_OBJECT_TYPE_DATE:
+            return obj->value.date;
+
+        default:
+            break;
+    }
+
+    return 0.0;
+}
+
+/* compile and run the form, and evaluate it with the parameters set as symbols */
+static int
+check(rq_interpreter_t interp, const char *text, const char **param_ids, const double *params, unsigned num_params, double expected)
+{
+    rq_object_t form = rq_object_get_cons_car(parse(interp, text));
+    rq_interpreter_program_t program = rq_interpreter_program_compile(interp, form, param_ids, num_params);
+    double compiled;
+    double evaluated;
+    unsigned i;
+
+    if (!program)
+    {
+        printf("%s: didn't compile\n", text);
+        return -1;
+    }
+    compiled = rq_interpreter_program_eval(program, params);
+    rq_interpreter_program_free(program);
+
+    for (i = 0; i < num_params; i++)
+        rq_interpreter_symbol_set(interp, param_ids[i], rq_object_alloc_double(rq_interpreter_get_object_mgr(interp), params[i]));
+    evaluated = object_value(rq_interpreter_eval(interp, form));
+
+    if (fabs(compiled - expected) > 1e-12 || fabs(evaluated - expected) > 1e-12)
+    {
+        printf("%s: compiled %f, evaluated %f, expected %f\n", text, compiled, evaluated, expected);
+        return -1;
+    }
+
+    return 0;
+}
+
+static double
+expected_payoff(double spot, double strike)
+{
+    double intrinsic = (spot > strike ? spot - strike : 0.0);
+
+    if (spot > 130)
+        return 0.0;
+    return (intrinsic > 10 ? intrinsic * 2 : intrinsic);
+}
+
+int
+main(int argc, char **argv)
+{
+    rq_interpreter_t interp = rq_interpreter_alloc();
+    rq_object_mgr_t object_mgr = rq_interpreter_get_object_mgr(interp);
+    const char *payoff = 
+        "(if (knocked-out spot) 0.0"
+        " (let ((intrinsic (call-payoff spot strike)) (scale 2))"
+        "  (if (> intrinsic 10) (* intrinsic scale) intrinsic)))";
+    const char *spot_id[] = { "spot" };
+    const char *date_ids[] = { "d", "months" };
+    rq_date start = rq_date_from_dmy(31, 1, 2010);
+    rq_interpreter_program_t program;
+    rq_object_t forms;
+    double params[2];
+    double spot;
+    int ret = 0;
+    int i;
+
+    rq_interpreter_builtin_core_register(interp);
+    rq_interpreter_builtin_math_register(interp);
+    rq_interpreter_builtin_date_register(interp);
+    rq_interpreter_builtin_string_register(interp);
+
+    for (forms = parse(interp, script); !rq_object_is_nil(forms); forms = rq_object_get_cons_cdr(forms))
+        rq_interpreter_eval(interp, rq_object_get_cons_car(forms));
+
+    /* a payoff using functions, globals and local variables */
+    for (spot = 50.0; spot <= 160.0 && ret == 0; spot += 0.5)
+        ret = check(interp, payoff, spot_id, &spot, 1, expected_payoff(spot, 100.0));
+
+    /* a global set after the program was compiled */
+    program = rq_interpreter_program_compile(interp, rq_object_get_cons_car(parse(interp, payoff)), spot_id, 1);
+    spot = 115.0;
+    if (!program || rq_interpreter_program_eval(program, &spot) != expected_payoff(spot, 100.0))
+        ret = -1;
+    rq_interpreter_symbol_set(interp, "strike", rq_object_alloc_double(object_mgr, 108.0));
+    if (!program || rq_interpreter_program_eval(program, &spot) != expected_payoff(spot, 108.0))
+    {
+        printf("the program didn't see the new strike\n");
+        ret = -1;
+    }
+    if (program)
+        rq_interpreter_program_free(program);
+
+    /* and one the program sets */
+    program = rq_interpreter_program_compile(interp, rq_object_get_cons_car(parse(interp, "(setq counter (+ counter 1))")), NULL, 0);
+    for (i = 0; program && i < 3; i++)
+        rq_interpreter_program_eval(program, NULL);
+    if (!program || object_value(rq_interpreter_symbol_find(interp, "counter")) != 3.0 ||
+        rq_object_get_object_type(rq_interpreter_symbol_find(interp, "counter")) != RQ_OBJECT_TYPE_INTEGER)
+    {
+        printf("the program didn't set the counter\n");
+        ret = -1;
+    }
+    if (program)
+        rq_interpreter_program_free(program);
+
+    /* arithmetic */
+    if (check(interp, "(- 10 1 2 3)", NULL, NULL, 0, 4.0) ||
+        check(interp, "(/ 1.0 4 2)", NULL, NULL, 0, 0.125) ||
+        check(interp, "(* 2 3 4)", NULL, NULL, 0, 24.0) ||
+        check(interp, "(*)", NULL, NULL, 0, 1.0) ||
+        check(interp, "(+ (pow 2 10) (sqrt 16) (log (exp 2)) (abs -3) (min 4 -1 2))", NULL, NULL, 0, 1032.0) ||
+        check(interp, "(if (<= 2 1) 1)", NULL, NULL, 0, 0.0) ||
+        check(interp, "(progn (= 2 2))", NULL, NULL, 0, 1.0) ||
+        check(interp, "(if (progn (setq counter 0) (if (< counter 1) t)) 1 2)", NULL, NULL, 0, 1.0) ||
+        check(interp, "(if (let ((x 2)) (knocked-out x)) 1 2)", NULL, NULL, 0, 2.0) ||
+        check(interp, "(let ((c (< 1 2))) (if c 1 2))", NULL, NULL, 0, 1.0))
+        ret = -1;
+
+    /* integers stay integers until they meet a double, as in the interpreter */
+    if (check(interp, "(/ 7 2)", NULL, NULL, 0, 3.0) ||
+        check(interp, "(/ 7 2.0)", NULL, NULL, 0, 3.5) ||
+        check(interp, "(+ 1 (/ 1 3))", NULL, NULL, 0, 1.0) ||
+        check(interp, "(+ (/ 7 2) 0.5 (/ 7 2))", NULL, NULL, 0, 6.5) ||
+        check(interp, "(- 2147483647 -1)", NULL, NULL, 0, -2147483648.0) ||
+        check(interp, "(let ((x 7)) (setq x (/ x 2)) (* x 1.5))", NULL, NULL, 0, 4.5) ||
+        check(interp, "(/ spot 2)", spot_id, &spot, 1, spot / 2))
+        ret = -1;
+
+    /* a variable set by a later operand is read before it's set */
+    if (check(interp, "(let ((x 1)) (+ x (setq x 5) x))", NULL, NULL, 0, 11.0) ||
+        check(interp, "(let ((x 1) (y 2)) (let ((x y) (y x)) (- x y)))", NULL, NULL, 0, 1.0))
+        ret = -1;
+
+    /* dates */
+    params[0] = start;
+    for (i = 0; i <= 24 && ret == 0; i++)
+    {
+        params[1] = i;
+        ret = check(interp, "(date-diff (add-months d months) start)", date_ids, params, 2, 
+                    rq_date_add_months(start, (short)i, 0) - start);
+    }
+    params[0] = rq_date_from_dmy(28, 2, 2010);
+    if (check(interp, "(+ (* 10000 (year d)) (* 100 (month d)) (day d))", date_ids, params, 1, 20100228.0) ||
+        check(interp, "(date-diff (add-days d 3) d)", date_ids, params, 1, 3.0))
+        ret = -1;
+
+    /* functions that double the code at each level, more than a program can jump over */
+    for (i = 1; i <= 16; i++)
+    {
+        char defun[128];
+        if (i == 1)
+            strcpy(defun, "(defun f1 (x) (+ x 1))");
+        else
+            sprintf(defun, "(defun f%d (x) (+ (f%d x) (f%d (- x 1))))", i, i - 1, i - 1);
+        rq_interpreter_eval(interp, rq_object_get_cons_car(parse(interp, defun)));
+    }
+    if (!(program = rq_interpreter_program_compile(interp, rq_object_get_cons_car(parse(interp, "(f10 spot)")), spot_id, 1)))
+        ret = -1;
+    else
+        rq_interpreter_program_free(program);
+
+    /* forms that can't be compiled */
+    if (rq_interpreter_program_compile(interp, rq_object_get_cons_car(parse(interp, "(+ undefined 1)")), NULL, 0) ||
+        rq_interpreter_program_compile(interp, rq_object_get_cons_car(parse(interp, "(fact spot)")), spot_id, 1) ||
+        rq_interpreter_program_compile(interp, rq_object_get_cons_car(parse(interp, "(+ \"text\" 1)")), NULL, 0) ||
+        rq_interpreter_program_compile(interp, rq_object_get_cons_car(parse(interp, "(string-equal \"a\" \"b\")")), NULL, 0) ||
+        rq_interpreter_program_compile(interp, rq_object_get_cons_car(parse(interp, "(pow 2)")), NULL, 0) ||
+        rq_interpreter_program_compile(interp, rq_object_get_cons_car(parse(interp, "(f16 spot)")), spot_id, 1) ||
+        rq_interpreter_program_compile(interp, rq_object_get_cons_car(parse(interp, "(if 0 1 2)")), NULL, 0) ||
+        rq_interpreter_program_compile(interp, rq_object_get_cons_car(parse(interp, "(if spot 1 2)")), spot_id, 1) ||
+        rq_interpreter_program_compile(interp, rq_object_get_cons_car(parse(interp, "(if (call-payoff spot strike) 1 2)")), spot_id, 1) ||
+        rq_interpreter_program_compile(interp, rq_object_get_cons_car(parse(interp, "(+ 1 (< 1 2))")), NULL, 0) ||
+        rq_interpreter_program_compile(interp, rq_object_get_cons_car(parse(interp, "(+ 1 (if (< spot 1) 1 2.0))")), spot_id, 1) ||
+        rq_interpreter_program_compile(interp, rq_object_get_cons_car(parse(interp, "(setq strike 108)")), NULL, 0) ||
+        rq_interpreter_program_compile(interp, rq_object_get_cons_car(parse(interp, "(setq counter 1.5)")), NULL, 0))
+    {
+        printf("a form that can't be compiled was compiled\n");
+        ret = -1;
+    }
+
+    rq_interpreter_free(interp);
+
+    if (ret == 0)
+        printf("Interpreter program test successful\n");
+
+    return ret;
+}
@@ -0,0 +1,200 @@
+#include <rq.h>
+#include <rq_data_store_fs.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+
+/* Saves markets for a few dates to a file system data store,
+   appends intraday rate updates and loads them back. */
+
+#define STORE_DIR "test_market_store.dir"
+
+static const char *store_subdirs[] = {
+    "calendars",
+    "assets",
+    "bootstrapconfigs",
+    "markets",
+    NULL
+};
+
+static rq_market_t
+build_market(rq_date market_date, double level)
+{
+    rq_market_t market = rq_market_alloc(market_date);
+    rq_yield_curve_t yc;
+    rq_vol_surface_t vs;
+    unsigned int i;
+
+    rq_rate_mgr_add(rq_market_get_rate_mgr(market),
+                    rq_rate_build("AUD.BBSW.3M", "AUD", RQ_RATE_TYPE_SIMPLE, market_date, market_date + 91, level));
+    rq_rate_mgr_add(rq_market_get_rate_mgr(market),
+                    rq_rate_build("AUD.SWAP.5Y", "AUD", RQ_RATE_TYPE_PAR, market_date, market_date + 1826, level + 0.005));
+
+    yc = rq_yield_curve_init("AUD.BBSW", RQ_INTERPOLATION_LINEAR_ZERO, RQ_EXTRAPOLATION_LINEAR_ZERO,
+                             RQ_EXTRAPOLATION_LINEAR_ZERO, RQ_ZERO_CONTINUOUS_COMPOUNDING, 1,
+                             RQ_DAY_COUNT_ACTUAL_365, market_date);
+    for (i = 1; i <= 20; i++)
+        rq_yield_curve_set_discount_factor(yc, market_date + i * 91, exp(-level * i * 91 / 365.0));
+    rq_yield_curve_mgr_add(rq_market_get_yield_curve_mgr(market), yc);
+
+    vs = rq_vol_surface_alloc("BHP.VOL");
+    rq_vol_surface_set_underlying_asset_id(vs, "BHP");
+    for (i = 1; i <= 4; i++)
+    {
+        rq_vol_surface_set_volatility(vs, 0.25, market_date + i * 91, 0.30 + 0.01 * i);
+        rq_vol_surface_set_volatility(vs, 0.50, market_date + i * 91, 0.25 + 0.01 * i);
+    }
+    rq_vol_surface_mgr_add(rq_market_get_vol_surface_mgr(market), vs);
+
+    return market;
+}
+
+static void
+remove_store(void)
+{
+    char path[256];
+    int i;
+
+    for (i = 0; store_subdirs[i]; i++)
+    {
+        sprintf(path, "%s/%s", STORE_DIR, store_subdirs[i]);
+        rmdir(path);
+    }
+    sprintf(path, "%s/rq.xml", STORE_DIR);
+    remove(path);
+    rmdir(STORE_DIR);
+}
+
+int
+main(int argc, char **argv)
+{
+    rq_date d1 = rq_date_from_dmy(2, 3, 2009);
+    rq_date d0 = rq_date_from_dmy(27, 2, 2009);
+    rq_date d2 = rq_date_from_dmy(3, 3, 2009);
+    rq_data_store_t store = rq_data_store_fs_alloc();
+    rq_market_t market;
+    rq_rate_t updates[2];
+    rq_yield_curve_t yc;
+    rq_vol_surface_t vs;
+    double vol = 0;
+    char path[256];
+    FILE *fh;
+    int ret = 0;
+
+    if (rq_data_store_create(store, STORE_DIR) != RQ_OK)
+    {
+        printf("can't create the data store\n");
+        return -1;
+    }
+
+    /* saved out of date order, to exercise the index insert */
+    market = build_market(d1, 0.0325);
+    if (rq_data_store_market_save(store, market) != RQ_OK)
+        ret = -1;
+    rq_market_free(market);
+    market = build_market(d0, 0.0300);
+    if (rq_data_store_market_save(store, market) != RQ_OK)
+        ret = -1;
+    rq_market_free(market);
+
+    /* intraday: the 3M rate moves and a new rate comes in */
+    updates[0] = rq_rate_build("AUD.BBSW.3M", "AUD", RQ_RATE_TYPE_SIMPLE, d1, d1 + 91, 0.0330);
+    updates[1] = rq_rate_build("AUD.BBSW.6M", "AUD", RQ_RATE_TYPE_SIMPLE, d1, d1 + 182, 0.0340);
+    if (rq_data_store_market_save_rates(store, d1, updates, 2) != RQ_OK)
+        ret = -1;
+    rq_rate_set_value(updates[0], 0.0335);
+    if (rq_data_store_market_save_rates(store, d1, updates, 1) != RQ_OK)
+        ret = -1;
+
+    /* rates for a date without a market */
+    if (rq_data_store_market_save_rates(store, d2, updates + 1, 1) != RQ_OK)
+        ret = -1;
+    rq_rate_free(updates[0]);
+    rq_rate_free(updates[1]);
+
+    /* an update cut short by a crash is ignored */
+    sprintf(path, "%s/markets/20090302.rqs", STORE_DIR);
+    if ((fh = fopen(path, "ab")) != NULL)
+    {
+        unsigned int marker = RQ_DATA_STORE_FS_RATE_UPDATE_MARKER;
+        fwrite(&marker, sizeof(marker), 1, fh);
+        fclose(fh);
+    }
+
+    rq_data_store_close(store);
+    rq_data_store_open(store, STORE_DIR);
+
+    market = rq_market_alloc(d1);
+    if (rq_data_store_market_load(store, market) != RQ_OK)
+        ret = -1;
+    yc = rq_yield_curve_mgr_get(rq_market_get_yield_curve_mgr(market), "AUD.BBSW");
+    vs = rq_vol_surface_mgr_get(rq_market_get_vol_surface_mgr(market), "BHP.VOL");
+    if (rq_market_get_market_date(market) != d1 ||
+        rq_rate_get_value(rq_rate_mgr_find(rq_market_get_rate_mgr(market), "AUD.BBSW.3M")) != 0.0335 ||
+        rq_rate_get_value(rq_rate_mgr_find(rq_market_get_rate_mgr(market), "AUD.BBSW.6M")) != 0.0340 ||
+        strcmp(rq_rate_get_asset_id(rq_rate_mgr_find(rq_market_get_rate_mgr(market), "AUD.BBSW.6M")), "AUD") ||
+        rq_rate_get_value(rq_rate_mgr_find(rq_market_get_rate_mgr(market), "AUD.SWAP.5Y")) != 0.0325 + 0.005 ||
+        !yc || rq_yield_curve_get_discount_factor(yc, d1 + 91) != exp(-0.0325 * 91 / 365.0) ||
+        !vs || rq_vol_surface_count(vs) != 2 ||
+        rq_vol_surface_get_volatility(vs, 0.50, d1 + 182, &vol) || vol != 0.25 + 0.01 * 2)
+    {
+        printf("market for %ld differs\n", d1);
+        ret = -1;
+    }
+    rq_market_free(market);
+
+    market = rq_market_alloc(d2);
+    if (rq_data_store_market_load(store, market) != RQ_OK ||
+        rq_rate_get_value(rq_rate_mgr_find(rq_market_get_rate_mgr(market), "AUD.BBSW.6M")) != 0.0340 ||
+        rq_yield_curve_mgr_get(rq_market_get_yield_curve_mgr(market), "AUD.BBSW"))
+    {
+        printf("market for %ld differs\n", d2);
+        ret = -1;
+    }
+    rq_market_free(market);
+
+    market = rq_market_alloc(d2 + 1);
+    if (rq_data_store_market_load(store, market) != RQ_ENOENT)
+        ret = -1;
+    rq_market_free(market);
+
+    if (rq_data_store_fs_find_market_date(store, d0 - 1) != 0 ||
+        rq_data_store_fs_find_market_date(store, d0) != d0 ||
+        rq_data_store_fs_find_market_date(store, d0 + 1) != d0 ||
+        rq_data_store_fs_find_market_date(store, d1) != d1 ||
+        rq_data_store_fs_find_market_date(store, d2 + 30) != d2)
+    {
+        printf("market date lookup failed\n");
+        ret = -1;
+    }
+
+    /* saving a market again replaces the updates */
+    market = build_market(d1, 0.0325);
+    rq_data_store_market_save(store, market);
+    rq_market_clear(market);
+    rq_data_store_market_load(store, market);
+    if (rq_rate_get_value(rq_rate_mgr_find(rq_market_get_rate_mgr(market), "AUD.BBSW.3M")) != 0.0325 ||
+        rq_rate_mgr_find(rq_market_get_rate_mgr(market), "AUD.BBSW.6M"))
+        ret = -1;
+    rq_market_free(market);
+
+    rq_data_store_close(store);
+    rq_data_store_free(store);
+
+    sprintf(path, "%s/markets/20090227.rqs", STORE_DIR);
+    remove(path);
+    sprintf(path, "%s/markets/20090302.rqs", STORE_DIR);
+    remove(path);
+    sprintf(path, "%s/markets/20090303.rqs", STORE_DIR);
+    remove(path);
+    sprintf(path, "%s/markets/index", STORE_DIR);
+    remove(path);
+    remove_store();
+
+    if (ret == 0)
+        printf("Market store test successful\n");
+
+    return ret;
+}
@@ -0,0 +1,169 @@
+#include <rq.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+static double
+max_abs_diff(const double *a, const double *b, unsigned long n)
+{
+    double m = 0.0;
+    unsigned long i;
+
+    for (i = 0; i < n; i++)
+        if (fabs(a[i] - b[i]) > m)
+            m = fabs(a[i] - b[i]);
+
+    return m;
+}
+
+int
+main(int argc, char **argv)
+{
+    unsigned long n = (argc == 1 ? 150 : atol(argv[1]));
+    rq_matrix_t a = rq_matrix_build(n, n);
+    rq_matrix_t b = rq_matrix_build(n, n);
+    rq_matrix_t c = rq_matrix_build(n, n);
+    rq_matrix_t l = rq_matrix_build(n, n);
+    rq_matrix_t lt = rq_matrix_build(n, n);
+    rq_matrix_t v = rq_matrix_build(n, n);
+    double *naive = (double *)malloc(sizeof(double) * n * n);
+    double *x = (double *)malloc(sizeof(double) * n);
+    double *y = (double *)malloc(sizeof(double) * n);
+    double *d = (double *)malloc(sizeof(double) * n);
+    double err;
+    unsigned long i;
+    unsigned long j;
+    unsigned long k;
+    int ret = 0;
+
+    srand(42);
+    for (i = 0; i < n * n; i++)
+    {
+        a->vals[i] = (double)rand() / RAND_MAX - 0.5;
+        b->vals[i] = (double)rand() / RAND_MAX - 0.5;
+    }
+
+    /* GEMM against the naive triple loop */
+    rq_matrix_multiply(a, b, c);
+    for (i = 0; i < n; i++)
+        for (j = 0; j < n; j++)
+        {
+            double s = 0.0;
+            for (k = 0; k < n; k++)
+                s += rq_matrix_get(a, i, k) * rq_matrix_get(b, k, j);
+            naive[i * n + j] = s;
+        }
+    err = max_abs_diff(c->vals, naive, n * n);
+    printf("gemm error = %g\n", err);
+    if (err > 1e-10)
+        ret = -1;
+
+    /* build a positive definite matrix c = a * a' + n * I */
+    rq_matrix_transpose(a, b);
+    rq_matrix_multiply(a, b, c);
+    for (i = 0; i < n; i++)
+        RQ_MATRIX_SET(c, i, i, RQ_MATRIX_GET(c, i, i) + n);
+
+    if (rq_matrix_cholesky(c, l) != 0)
+    {
+        printf("cholesky failed\n");
+        return -1;
+    }
+    rq_matrix_transpose(l, lt);
+    rq_matrix_multiply(l, lt, b);
+    err = max_abs_diff(b->vals, c->vals, n * n);
+    printf("cholesky error = %g\n", err);
+    if (err > 1e-9)
+        ret = -1;
+
+    /* solve c * x = y using the cholesky factor */
+    for (i = 0; i < n; i++)
+        x[i] = 1.0 + i;
+    rq_matrix_multiply_vector(c, x, y);
+    rq_matrix_solve_lower(l, y);
+    rq_linalg_trsv_lower_trans(n, l->vals, n, y);
+    err = max_abs_diff(x, y, n);
+    printf("solve error = %g\n", err);
+    if (err > 1e-9)
+        ret = -1;
+
+    /* eigen-decomposition: c * v = v * diag(d) */
+    memcpy(v->vals, c->vals, sizeof(double) * n * n);
+    if (rq_matrix_eigen_symmetric(v, d) != 0)
+    {
+        printf("eigen decomposition failed\n");
+        return -1;
+    }
+    rq_matrix_multiply(c, v, b);
+    err = 0.0;
+    for (j = 0; j < n; j++)
+    {
+        if (j > 0 && d[j] < d[j-1])
+            ret = -1;
+        for (i = 0; i < n; i++)
+        {
+            double e = fabs(RQ_MATRIX_GET(b, i, j) - d[j] * RQ_MATRIX_GET(v, i, j));
+            if (e > err)
+                err = e;
+        }
+    }
+    printf("eigen error = %g\n", err);
+    if (err > 1e-8)
+        ret = -1;
+
+    /* an empty tridiagonal matrix has nothing to decompose */
+    if (rq_linalg_tridiagonal_ql(0, NULL, 0, NULL, NULL) != 0)
+        ret = -1;
+
+    /* perfectly correlated assets give a zero pivot */
+    {
+        rq_matrix_t singular = rq_matrix_build_with_values(2, 2, 1.0, 1.0, 1.0, 1.0);
+        rq_matrix_t chol = rq_matrix_build(2, 2);
+
+        if (rq_matrix_cholesky(singular, chol) == 0)
+        {
+            printf("cholesky of a singular matrix succeeded\n");
+            ret = -1;
+        }
+        rq_matrix_nearest_correlation(singular, singular, 1e-12, 500);
+        if (rq_matrix_cholesky(singular, chol) != 0 || !(RQ_MATRIX_GET(chol, 1, 1) > 0.0))
+            ret = -1;
+
+        rq_matrix_free(singular);
+        rq_matrix_free(chol);
+    }
+
+    /* Higham's example of a matrix of inconsistent correlations */
+    {
+        rq_matrix_t bad = rq_matrix_build_with_values(3, 3, 1.0, 1.0, 0.0, 1.0, 1.0, 1.0, 0.0, 1.0, 1.0);
+        rq_matrix_t fixed = rq_matrix_build(3, 3);
+        rq_matrix_t chol = rq_matrix_build(3, 3);
+
+        if (rq_matrix_cholesky(bad, chol) == 0)
+            ret = -1;
+        rq_matrix_nearest_correlation(bad, fixed, 1e-12, 500);
+        rq_matrix_print(fixed);
+        if (rq_matrix_cholesky(fixed, chol) != 0 ||
+            fabs(RQ_MATRIX_GET(fixed, 0, 1) - 0.7607) > 1e-4 ||
+            fabs(RQ_MATRIX_GET(fixed, 0, 2) - 0.1573) > 1e-4 ||
+            RQ_MATRIX_GET(fixed, 1, 1) != 1.0)
+            ret = -1;
+
+        rq_matrix_free(bad);
+        rq_matrix_free(fixed);
+        rq_matrix_free(chol);
+    }
+
+    rq_matrix_free(a);
+    rq_matrix_free(b);
+    rq_matrix_free(c);
+    rq_matrix_free(l);
+    rq_matrix_free(lt);
+    rq_matrix_free(v);
+    free(naive);
+    free(x);
+    free(y);
+    free(d);
+
+    return ret;
+}
@@ -0,0 +1,100 @@
+#include <rq.h>
+#include <stdlib.h>
+#include <math.h>
+
+static double
+ref_cumul_norm(double x)
+{
+    return 0.5 * erfc(-x / sqrt(2.0));
+}
+
+/* P(X < a, Y < b) by integrating phi(x) * N((b - rho x) / sqrt(1 - rho^2))
+   over x with Simpson's rule. */
+static double
+ref_cumul_bivar_norm(double a, double b, double rho)
+{
+    double lo = -12.0;
+    double hi = (a < 12.0 ? a : 12.0);
+    double s = sqrt(1.0 - rho * rho);
+    int n = 100000;
+    double h;
+    double sum = 0.0;
+    int i;
+
+    if (hi <= lo)
+        return 0.0;
+
+    h = (hi - lo) / n;
+    for (i = 0; i <= n; i++)
+    {
+        double x = lo + i * h;
+        double f = rq_pricing_norm_density(x) * ref_cumul_norm((b - rho * x) / s);
+        sum += f * (i == 0 || i == n ? 1.0 : (i % 2 ? 4.0 : 2.0));
+    }
+
+    return sum * h / 3.0;
+}
+
+int
+main(int argc, char **argv)
+{
+    static const double pts[] = { -3.0, -1.5, -0.4, 0.0, 0.3, 1.2, 2.5 };
+    static const double rhos[] = { -0.99, -0.8, -0.5, -0.1, 0.0, 0.2, 0.6, 0.9, 0.95, 0.999 };
+    unsigned num_pts = sizeof(pts) / sizeof(pts[0]);
+    unsigned num_rhos = sizeof(rhos) / sizeof(rhos[0]);
+    double z[1001];
+    double out[1001];
+    double max_rel = 0.0;
+    double max_abs = 0.0;
+    unsigned i, j, k;
+    int ret = 0;
+
+    /* univariate: relative error vs erfc out into the tails. Beyond
+       -20 or so the rounding of -x / sqrt(2) in the reference itself
+       starts to dominate. */
+    for (i = 0; i < 1001; i++)
+        z[i] = -20.0 + i * (28.0 / 1000.0);
+
+    rq_pricing_cumul_norm_dist_array(z, out, 1001);
+    for (i = 0; i < 1001; i++)
+    {
+        double ref = ref_cumul_norm(z[i]);
+        double rel = fabs(out[i] - ref) / ref;
+
+        if (out[i] != rq_pricing_cumul_norm_dist(z[i]))
+            ret = -1;
+        if (rel > max_rel)
+            max_rel = rel;
+    }
+    printf("univariate max relative error = %g\n", max_rel);
+    if (max_rel > 1e-13)
+        ret = -1;
+
+    /* bivariate: absolute error vs numerical integration */
+    for (i = 0; i < num_pts; i++)
+        for (j = 0; j < num_pts; j++)
+            for (k = 0; k < num_rhos; k++)
+            {
+                double a = pts[i];
+                double b = pts[j];
+                double rho = rhos[k];
+                double p = rq_pricing_cumul_bivar_norm_dist(a, b, rho);
+                double err = fabs(p - ref_cumul_bivar_norm(a, b, rho));
+
+                if (err > max_abs)
+                    max_abs = err;
+                if (p != rq_pricing_cumul_bivar_norm_dist2(a, b, rho))
+                    ret = -1;
+            }
+    printf("bivariate max absolute error = %g\n", max_abs);
+    if (max_abs > 1e-13)
+        ret = -1;
+
+    /* the limiting correlations */
+    if (fabs(rq_pricing_cumul_bivar_norm_dist(0.5, 1.0, 1.0) - ref_cumul_norm(0.5)) > 1e-15 ||
+        fabs(rq_pricing_cumul_bivar_norm_dist(0.5, 1.0, -1.0) - (ref_cumul_norm(0.5) - ref_cumul_norm(-1.0))) > 1e-15 ||
+        fabs(rq_pricing_cumul_bivar_norm_dist(0.0, 0.0, 0.0) - 0.25) > 1e-15)
+        ret = -1;
+
+    return ret;
+}
@@ -0,0 +1,137 @@
+#include <rq.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Builds calendars from XML through the object schemas, one at a
+   time and then every calendar in a document in one pass. */
+
+static const char *calendars_xml = 
+    "<?xml version=\"1.0\"?>\n"
+    "<calendars>\n"
+    "  <calendar id=\"SYD\">\n"
+    "    <dateEvent type=\"HOLIDAY\">2012-01-26</dateEvent>\n"
+    "    <dateEvent type=\"HOLIDAY\">2012-04-06</dateEvent>\n"
+    "    <dateEvent type=\"WORKDAY\">2012-04-07</dateEvent>\n"
+    "    <note><dateEvent type=\"HOLIDAY\">2012-05-01</dateEvent></note>\n"
+    "  </calendar>\n"
+    "  <other><calendar id=\"NOT\"/></other>\n"
+    "  <calendar id=\"LON\" region=\"UK\">\n"
+    "    <dateEvent type=\"HOLIDAY\">2012-12-25</dateEvent>\n"
+    "  </calendar>\n"
+    "  <calendar id=\"NYC\">\n"
+    "    <dateEvent type=\"HOLIDAY\">2012-07-04</dateEvent>\n"
+    "    <dateEvent type=\"HOLIDAY\">4/9/2012</dateEvent>\n"
+    "  </calendar>\n"
+    "</calendars>\n";
+
+struct built_calendars {
+    rq_calendar_t calendars[8];
+    unsigned num_calendars;
+};
+
+static void
+got_calendar(void *data, void *object)
+{
+    struct built_calendars *bc = (struct built_calendars *)data;
+
+    if (bc->num_calendars < 8)
+        bc->calendars[bc->num_calendars++] = (rq_calendar_t)object;
+    else
+        rq_calendar_free((rq_calendar_t)object);
+}
+
+static rq_stream_t
+open_xml(const char *xml)
+{
+    rq_stream_t stream = rq_stream_string_alloc();
+
+    rq_stream_open(stream);
+    rq_stream_write_string(stream, xml);
+    rq_stream_rewind(stream);
+
+    return stream;
+}
+
+static int
+check_calendar(rq_calendar_t cal, const char *id, unsigned int size, rq_date holiday)
+{
+    if (!cal || strcmp(rq_calendar_get_id(cal), id) || 
+        rq_calendar_size(cal) != size || !rq_calendar_is_holiday(cal, holiday))
+    {
+        printf("calendar %s wasn't built properly\n", id);
+        return -1;
+    }
+
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    rq_object_schema_mgr_t schema_mgr = rq_object_schema_mgr_alloc();
+    rq_object_builder_t builder = rq_object_builder_xml_alloc();
+    struct built_calendars bc;
+    rq_calendar_t cal;
+    rq_stream_t stream;
+    unsigned long num_built;
+    unsigned i;
+    int ret = 0;
+
+    rq_object_schema_mgr_init_object_schemas(schema_mgr);
+
+    /* the first calendar on the path; events that aren't direct
+       children and WORKDAY events aren't holidays */
+    stream = open_xml(calendars_xml);
+    cal = (rq_calendar_t)rq_object_builder_build(builder, stream, schema_mgr, "/calendars/calendar", "Calendar");
+    if (check_calendar(cal, "SYD", 3, rq_date_from_dmy(6, 4, 2012)) ||
+        rq_calendar_is_holiday(cal, rq_date_from_dmy(7, 4, 2012)) ||
+        rq_calendar_is_holiday(cal, rq_date_from_dmy(1, 5, 2012)))
+        ret = -1;
+    if (cal)
+        rq_calendar_free(cal);
+    rq_stream_free(stream);
+
+    /* every calendar on the path */
+    memset(&bc, 0, sizeof(bc));
+    stream = open_xml(calendars_xml);
+    if (rq_object_builder_build_all(builder, stream, schema_mgr, "calendars/calendar", "Calendar", got_calendar, &bc, &num_built) != RQ_OK ||
+        num_built != 3 || bc.num_calendars != 3 ||
+        check_calendar(bc.calendars[0], "SYD", 3, rq_date_from_dmy(26, 1, 2012)) ||
+        check_calendar(bc.calendars[1], "LON", 1, rq_date_from_dmy(25, 12, 2012)) ||
+        check_calendar(bc.calendars[2], "NYC", 2, rq_date_from_dmy(4, 7, 2012)))
+    {
+        printf("building all the calendars failed\n");
+        ret = -1;
+    }
+    for (i = 0; i < bc.num_calendars; i++)
+        rq_calendar_free(bc.calendars[i]);
+    rq_stream_free(stream);
+
+    /* a document that stops part way through a calendar */
+    stream = open_xml("<calendars><calendar id=\"X\"><dateEvent type=\"HOLIDAY\">2012-01-01</dateEvent>");
+    memset(&bc, 0, sizeof(bc));
+    if (rq_object_builder_build_all(builder, stream, schema_mgr, "calendars/calendar", "Calendar", got_calendar, &bc, &num_built) != RQ_ERR_XML_PARSER_BAD_FORMAT ||
+        num_built != 0)
+    {
+        printf("an unfinished calendar was built\n");
+        ret = -1;
+    }
+    rq_stream_free(stream);
+
+    /* nothing is built for an unknown type */
+    stream = open_xml(calendars_xml);
+    if (rq_object_builder_build(builder, stream, schema_mgr, "calendars/calendar", "Holiday") != NULL)
+    {
+        printf("built an object without a schema\n");
+        ret = -1;
+    }
+    rq_stream_free(stream);
+
+    rq_object_builder_free(builder);
+    rq_object_schema_mgr_free(schema_mgr);
+
+    if (ret == 0)
+        printf("Object builder test successful\n");
+
+    return ret;
+}
@@ -0,0 +1,275 @@
+#include <rq.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Loads rates.txt with the bulk rate loader and checks it against
+   loading it a line at a time, then loads a generated file covering
+   several days into per-date markets. */
+
+#define RATES_FILE "test_rate_loader.txt"
+#define NUM_DAYS 5
+#define RATES_PER_DAY 2000
+
+/* The way rate files have been loaded so far, returning -1 if the
+   file can't be opened. */
+static int
+load_rates_slowly(const char *filename, rq_rate_mgr_t rate_mgr)
+{
+    rq_stream_t stream = rq_stream_file_open(filename, "r");
+    char line[1024];
+    int num_rates = 0;
+
+    if (!stream)
+        return -1;
+
+    while (rq_stream_read_line(stream, line, sizeof(line)) > 0)
+    {
+        char *flds[6];
+        char *p = line;
+        int i;
+
+        if (line[0] == '#')
+            continue;
+        line[strcspn(line, "\r\n")] = '\0';
+
+        for (i = 0; i < 6 && p; i++)
+        {
+            flds[i] = p;
+            p = strchr(p, '|');
+            if (p)
+                *p++ = '\0';
+        }
+        if (i < 6)
+            continue;
+
+        rq_rate_mgr_add(rate_mgr,
+                        rq_rate_build(flds[1], flds[1], rq_rate_type_from_string(flds[2]),
+                                      rq_date_parse(flds[3], RQ_DATE_FORMAT_YMD),
+                                      rq_date_parse(flds[4], RQ_DATE_FORMAT_YMD),
+                                      atof(flds[5])));
+        num_rates++;
+    }
+
+    rq_stream_free(stream);
+
+    return num_rates;
+}
+
+static int
+same_rates(rq_rate_mgr_t expected, rq_rate_mgr_t actual)
+{
+    rq_rate_mgr_iterator_t it = rq_rate_mgr_iterator_alloc();
+    int same = 1;
+
+    for (rq_rate_mgr_begin(expected, it); !rq_rate_mgr_at_end(it); rq_rate_mgr_next(it))
+    {
+        rq_rate_t e = rq_rate_mgr_iterator_deref(it);
+        rq_rate_t a = rq_rate_mgr_find(actual, rq_rate_get_rate_class_id(e));
+
+        if (!a ||
+            strcmp(rq_rate_get_asset_id(a), rq_rate_get_asset_id(e)) ||
+            rq_rate_get_rate_type(a) != rq_rate_get_rate_type(e) ||
+            rq_rate_get_observation_date(a) != rq_rate_get_observation_date(e) ||
+            rq_rate_get_value_date(a) != rq_rate_get_value_date(e) ||
+            rq_rate_get_value(a) != rq_rate_get_value(e))
+        {
+            printf("rate %s differs\n", rq_rate_get_rate_class_id(e));
+            same = 0;
+        }
+    }
+
+    rq_rate_mgr_iterator_free(it);
+
+    return same;
+}
+
+static unsigned int
+count_rates(rq_rate_mgr_t rate_mgr)
+{
+    rq_rate_mgr_iterator_t it = rq_rate_mgr_iterator_alloc();
+    unsigned int n = 0;
+
+    for (rq_rate_mgr_begin(rate_mgr, it); !rq_rate_mgr_at_end(it); rq_rate_mgr_next(it))
+        n++;
+    rq_rate_mgr_iterator_free(it);
+
+    return n;
+}
+
+static double
+rate_value(unsigned int day, unsigned int i)
+{
+    return 0.03 + day * 0.001 + i * 1e-6;
+}
+
+/* Several days of rates, more than one read block's worth, with
+   CRLF line ends, comments, blank lines and no line feed at the
+   end. */
+static int
+write_rates_file(rq_date from_date)
+{
+    FILE *fh = fopen(RATES_FILE, "wb");
+    unsigned int day, i;
+
+    if (!fh)
+        return -1;
+
+    for (day = 0; day < NUM_DAYS; day++)
+    {
+        char obs[16];
+
+        rq_date_to_string(obs, "yyyy-mm-dd", from_date + day);
+        fprintf(fh, "# day %u\r\n\r\n", day);
+        for (i = 0; i < RATES_PER_DAY; i++)
+            fprintf(fh, "IntRate|AUD.RATE.%u|%s|%s|%s|%.8f%s",
+                    i, (i % 2 ? "PAR" : "SIMPLE"), obs, "2012-01-03", rate_value(day, i),
+                    (day == NUM_DAYS - 1 && i == RATES_PER_DAY - 1 ? "" : "\r\n"));
+    }
+
+    fclose(fh);
+
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    rq_rate_mgr_t expected = rq_rate_mgr_alloc();
+    rq_rate_mgr_t rate_mgr = rq_rate_mgr_alloc();
+    rq_market_mgr_t market_mgr = rq_market_mgr_alloc();
+    rq_date from_date = rq_date_from_dmy(2, 1, 2012);
+    rq_stream_t stream;
+    unsigned long num_rates;
+    unsigned int day, i;
+    int num_expected;
+    int ret = 0;
+
+    num_expected = load_rates_slowly("rates.txt", expected);
+    if (num_expected < 0)
+    {
+        printf("can't open rates.txt\n");
+        rq_market_mgr_free(market_mgr);
+        rq_rate_mgr_free(rate_mgr);
+        rq_rate_mgr_free(expected);
+        return -1;
+    }
+
+    /* read in blocks */
+    stream = rq_stream_file_open("rates.txt", "r");
+    if (!stream || rq_rate_loader_load(stream, rate_mgr, &num_rates) != RQ_OK ||
+        num_rates != (unsigned long)num_expected || num_expected != 30 ||
+        !same_rates(expected, rate_mgr) || count_rates(rate_mgr) != count_rates(expected))
+    {
+        printf("loading rates.txt from a file stream failed\n");
+        ret = -1;
+    }
+    if (stream)
+        rq_stream_free(stream);
+
+    /* parsed in place */
+    rq_rate_mgr_clear(rate_mgr);
+    stream = rq_stream_mmap_open("rates.txt");
+    if (!stream || rq_rate_loader_load(stream, rate_mgr, &num_rates) != RQ_OK ||
+        num_rates != (unsigned long)num_expected || !same_rates(expected, rate_mgr))
+    {
+        printf("loading rates.txt from a mapped stream failed\n");
+        ret = -1;
+    }
+    if (stream)
+        rq_stream_free(stream);
+
+    if (write_rates_file(from_date) != 0)
+    {
+        printf("can't write %s\n", RATES_FILE);
+        return -1;
+    }
+
+    stream = rq_stream_file_open(RATES_FILE, "r");
+    if (!stream || rq_rate_loader_load_markets(stream, market_mgr, &num_rates) != RQ_OK ||
+        num_rates != NUM_DAYS * RATES_PER_DAY)
+    {
+        printf("loading %s into markets failed\n", RATES_FILE);
+        ret = -1;
+    }
+    if (stream)
+        rq_stream_free(stream);
+
+    for (day = 0; day < NUM_DAYS; day++)
+    {
+        rq_market_t market = rq_market_mgr_get(market_mgr, from_date + day);
+        rq_rate_mgr_t mgr;
+
+        if (!market || count_rates(rq_market_get_rate_mgr(market)) != RATES_PER_DAY)
+        {
+            printf("day %u: wrong market\n", day);
+            ret = -1;
+            continue;
+        }
+
+        mgr = rq_market_get_rate_mgr(market);
+        for (i = 0; i < RATES_PER_DAY; i++)
+        {
+            char id[32];
+            rq_rate_t rate;
+            char value[32];
+
+            sprintf(id, "AUD.RATE.%u", i);
+            sprintf(value, "%.8f", rate_value(day, i));
+            rate = rq_rate_mgr_find(mgr, id);
+            if (!rate ||
+                rq_rate_get_observation_date(rate) != from_date + day ||
+                rq_rate_get_value_date(rate) != rq_date_from_dmy(3, 1, 2012) ||
+                rq_rate_get_rate_type(rate) != (i % 2 ? RQ_RATE_TYPE_PAR : RQ_RATE_TYPE_SIMPLE) ||
+                rq_rate_get_value(rate) != atof(value))
+            {
+                printf("day %u: rate %s is wrong\n", day, id);
+                ret = -1;
+            }
+        }
+    }
+
+    /* into one manager the last day's rates win */
+    rq_rate_mgr_clear(rate_mgr);
+    stream = rq_stream_mmap_open(RATES_FILE);
+    if (!stream || rq_rate_loader_load(stream, rate_mgr, &num_rates) != RQ_OK ||
+        count_rates(rate_mgr) != RATES_PER_DAY ||
+        rq_rate_get_observation_date(rq_rate_mgr_find(rate_mgr, "AUD.RATE.7")) != from_date + NUM_DAYS - 1)
+    {
+        printf("loading %s into one rate manager failed\n", RATES_FILE);
+        ret = -1;
+    }
+    if (stream)
+        rq_stream_free(stream);
+
+    /* a bad line stops the load */
+    stream = rq_stream_file_open(RATES_FILE, "w");
+    if (stream)
+    {
+        rq_stream_write_string(stream,
+                               "IntRate|A|SIMPLE|2012-01-02|2012-01-03|0.01\n"
+                               "IntRate|B|SIMPLE|2012-02-30|2012-03-01|0.01\n"
+                               "IntRate|C|SIMPLE|2012-01-02|2012-01-03|0.01\n");
+        rq_stream_free(stream);
+    }
+    rq_rate_mgr_clear(rate_mgr);
+    stream = rq_stream_file_open(RATES_FILE, "r");
+    if (!stream || rq_rate_loader_load(stream, rate_mgr, &num_rates) != RQ_ERR_RATE_LOADER_BAD_LINE ||
+        num_rates != 1 || !rq_rate_mgr_find(rate_mgr, "A") || rq_rate_mgr_find(rate_mgr, "C"))
+    {
+        printf("a bad line wasn't reported\n");
+        ret = -1;
+    }
+    if (stream)
+        rq_stream_free(stream);
+    remove(RATES_FILE);
+
+    rq_market_mgr_free(market_mgr);
+    rq_rate_mgr_free(rate_mgr);
+    rq_rate_mgr_free(expected);
+
+    if (ret == 0)
+        printf("Rate loader test successful\n");
+
+    return ret;
+}
@@ -0,0 +1,199 @@
+#include <rq.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Streams pricing results for a grid of trades and scenarios into a
+   results file a batch at a time, maps the file and adds the
+   columns back up. */
+
+#define RESULTS_FILE "test_results_columns.bin"
+#define NUM_TRADES 500
+#define NUM_SCENARIOS 10
+#define NUM_EXPOSURE_DATES 12
+#define BATCH_ROWS 1000
+
+/* value, delta and the exposure profile */
+#define ROWS_PER_RESULT (2 + NUM_EXPOSURE_DATES)
+
+struct totals {
+    unsigned long num_rows;
+    unsigned long num_batches;
+    double values[RQ_RESULTS_MEASURE_FIXED_EXPOSURE + 1];
+    double last_date_exposure;
+    int in_order;
+    unsigned long last_key;
+};
+
+static rq_date
+exposure_date(unsigned int i)
+{
+    return rq_date_from_dmy(1, 1, 2010) + i * 30;
+}
+
+static void
+set_result(struct rq_pricing_result *pr, unsigned int trade, unsigned int scenario)
+{
+    unsigned int i;
+
+    pr->valid = 1;
+    pr->results_returned = RQ_PRICING_RESULTS_VALUE | RQ_PRICING_RESULTS_EXPOSURE_PROFILE;
+    pr->value = trade * 100.0 + scenario;
+    pr->delta = 0.5;
+    for (i = 0; i < NUM_EXPOSURE_DATES; i++)
+    {
+        pr->exposure_profile.dates[i] = exposure_date(i);
+        pr->exposure_profile.exposures[i] = (double)(trade + i);
+    }
+}
+
+static void
+add_up(void *data, const struct rq_results_batch *batch)
+{
+    struct totals *t = (struct totals *)data;
+    unsigned int i;
+
+    t->num_batches++;
+    for (i = 0; i < batch->num_rows; i++)
+    {
+        unsigned long key = (unsigned long)batch->trade_indexes[i] * NUM_SCENARIOS + batch->scenarios[i];
+
+        if (key < t->last_key)
+            t->in_order = 0;
+        t->last_key = key;
+
+        if (batch->measures[i] <= RQ_RESULTS_MEASURE_FIXED_EXPOSURE)
+            t->values[batch->measures[i]] += batch->values[i];
+        if (batch->measures[i] == RQ_RESULTS_MEASURE_EXPOSURE && 
+            batch->dates[i] == exposure_date(NUM_EXPOSURE_DATES - 1))
+            t->last_date_exposure += batch->values[i];
+    }
+    t->num_rows += batch->num_rows;
+}
+
+static int
+check_totals(const struct totals *t, const char *name)
+{
+    double value = 0.0;
+    double exposure = 0.0;
+    double last_date_exposure = 0.0;
+    unsigned int trade, i;
+
+    for (trade = 0; trade < NUM_TRADES; trade++)
+    {
+        value += NUM_SCENARIOS * trade * 100.0 + NUM_SCENARIOS * (NUM_SCENARIOS - 1) / 2;
+        for (i = 0; i < NUM_EXPOSURE_DATES; i++)
+            exposure += NUM_SCENARIOS * (double)(trade + i);
+        last_date_exposure += NUM_SCENARIOS * (double)(trade + NUM_EXPOSURE_DATES - 1);
+    }
+
+    if (t->num_rows != NUM_TRADES * NUM_SCENARIOS * ROWS_PER_RESULT || !t->in_order ||
+        t->values[RQ_RESULTS_MEASURE_VALUE] != value ||
+        t->values[RQ_RESULTS_MEASURE_DELTA] != NUM_TRADES * NUM_SCENARIOS * 0.5 ||
+        t->values[RQ_RESULTS_MEASURE_EXPOSURE] != exposure ||
+        t->values[RQ_RESULTS_MEASURE_FACE_VALUE] != 0.0 ||
+        t->values[RQ_RESULTS_MEASURE_GAMMA] != 0.0 ||
+        t->last_date_exposure != last_date_exposure)
+    {
+        printf("%s: the totals of %lu rows in %lu batches are wrong\n", name, t->num_rows, t->num_batches);
+        return -1;
+    }
+
+    return 0;
+}
+
+/* Append every result, returning the number of rows appended. */
+static unsigned long
+append_results(rq_results_columns_t cols, struct rq_pricing_result *pr)
+{
+    unsigned long num_rows = 0;
+    unsigned int trade, scenario;
+
+    for (trade = 0; trade < NUM_TRADES; trade++)
+        for (scenario = 0; scenario < NUM_SCENARIOS; scenario++)
+        {
+            set_result(pr, trade, scenario);
+            num_rows += rq_results_columns_append_pricing_result(cols, trade, scenario, exposure_date(0), pr);
+        }
+
+    return num_rows;
+}
+
+int
+main(int argc, char **argv)
+{
+    struct rq_pricing_result *pr = rq_pricing_result_alloc();
+    rq_results_columns_t cols;
+    rq_stream_t stream;
+    struct totals t;
+    const char *buffer;
+    unsigned long len;
+    unsigned long num_rows;
+    int ret = 0;
+
+    rq_pricing_result_exposure_alloc(pr, NUM_EXPOSURE_DATES, 0);
+
+    /* written a batch at a time */
+    stream = rq_stream_file_open(RESULTS_FILE, "wb");
+    cols = rq_results_columns_alloc(stream, BATCH_ROWS);
+    num_rows = append_results(cols, pr);
+    if (num_rows != NUM_TRADES * NUM_SCENARIOS * ROWS_PER_RESULT || cols->max_rows != BATCH_ROWS)
+    {
+        printf("appended %lu rows\n", num_rows);
+        ret = -1;
+    }
+
+    /* an invalid result adds nothing */
+    pr->valid = 0;
+    if (rq_results_columns_append_pricing_result(cols, 0, 0, exposure_date(0), pr) != 0)
+        ret = -1;
+
+    if (rq_results_columns_free(cols) != RQ_OK)
+        ret = -1;
+    rq_stream_free(stream);
+
+    /* read in place */
+    memset(&t, 0, sizeof(t));
+    t.in_order = 1;
+    stream = rq_stream_mmap_open(RESULTS_FILE);
+    if (rq_results_columns_read(stream, add_up, &t) != RQ_OK || check_totals(&t, "mapped file") ||
+        t.num_batches != (NUM_TRADES * NUM_SCENARIOS * ROWS_PER_RESULT + BATCH_ROWS - 1) / BATCH_ROWS)
+        ret = -1;
+
+    /* a file cut short, or that isn't a results file */
+    buffer = rq_stream_mmap_get_buffer(stream, &len);
+    memset(&t, 0, sizeof(t));
+    if (rq_results_columns_read_buffer(buffer, len - 8, add_up, &t) != RQ_ERR_RESULTS_COLUMNS_BAD_FORMAT ||
+        t.num_batches == 0 ||
+        rq_results_columns_read_buffer(buffer + 8, len - 8, add_up, &t) != RQ_ERR_RESULTS_COLUMNS_BAD_FORMAT)
+    {
+        printf("a bad results file wasn't reported\n");
+        ret = -1;
+    }
+    rq_stream_free(stream);
+
+    /* held in memory, then written out whole */
+    cols = rq_results_columns_alloc(NULL, 16);
+    pr->valid = 1;
+    append_results(cols, pr);
+    stream = rq_stream_file_open(RESULTS_FILE, "wb");
+    if (rq_results_columns_write(cols, stream) != RQ_OK)
+        ret = -1;
+    rq_stream_free(stream);
+    rq_results_columns_free(cols);
+
+    memset(&t, 0, sizeof(t));
+    t.in_order = 1;
+    stream = rq_stream_file_open(RESULTS_FILE, "rb");
+    if (rq_results_columns_read(stream, add_up, &t) != RQ_OK || check_totals(&t, "file stream") || t.num_batches != 1)
+        ret = -1;
+    rq_stream_free(stream);
+
+    remove(RESULTS_FILE);
+    rq_pricing_result_free(pr);
+
+    if (ret == 0)
+        printf("Results columns test successful\n");
+
+    return ret;
+}
@@ -0,0 +1,104 @@
+#include <rq.h>
+#include <stdlib.h>
+
+int
+main(int argc, char **argv)
+{
+    rq_calendar_mgr_t calmgr = rq_calendar_mgr_alloc();
+    rq_calendar_t cal = rq_calendar_alloc("SYD");
+    rq_schedule_cache_t cache = rq_schedule_cache_alloc(4);
+    struct rq_schedule_params params;
+    rq_schedule_t s1;
+    rq_schedule_t s2;
+    rq_schedule_t s3;
+    rq_floating_flow_list_t ffl;
+    rq_date dates[200];
+    rq_date start = rq_date_from_dmy(15, 3, 2010);
+    int num_dates;
+    unsigned int i;
+    int ret = 0;
+
+    rq_calendar_add_event(cal, rq_date_from_dmy(15, 6, 2010), RQ_DATE_EVENT_GEN_HOLIDAY);
+    rq_calendar_add_event(cal, rq_date_from_dmy(15, 9, 2011), RQ_DATE_EVENT_GEN_HOLIDAY);
+    rq_calendar_mgr_add(calmgr, cal);
+
+    rq_schedule_params_init(&params);
+    params.start_date = start;
+    params.end_date = rq_date_from_dmy(15, 3, 2040);
+    rq_term_fill(&params.term, 0, 0, 3, 0);
+    params.fixing_offset = -2;
+    params.day_count_convention = RQ_DAY_COUNT_ACTUAL_360;
+    rq_schedule_params_set_calendars(&params, &cal, 1);
+
+    /* the schedule matches the dates generated directly */
+    num_dates = rq_date_roll_generate_dates(
+        dates, 200, params.start_date, params.end_date, &params.term,
+        params.roll_convention, params.date_roll_convention, &cal, 1,
+        params.stub_position, 0, NULL);
+
+    s1 = rq_schedule_cache_get(cache, &params);
+    if (rq_schedule_get_num_dates(s1) != (unsigned int)num_dates || num_dates != 121)
+        ret = -1;
+    for (i = 0; ret == 0 && i < rq_schedule_get_num_dates(s1); i++)
+        if (rq_schedule_get_dates(s1)[i] != dates[i])
+            ret = -1;
+    for (i = 0; ret == 0 && i < rq_schedule_get_num_periods(s1); i++)
+    {
+        rq_date fixing = rq_schedule_get_fixing_dates(s1)[i];
+
+        if (rq_schedule_get_payment_dates(s1)[i] != dates[i+1] ||
+            fixing >= dates[i] || 
+            !rq_calendar_is_good_date(cal, fixing) ||
+            rq_calendar_businessday_count(cal, fixing, dates[i] - 1) != 2 ||
+            rq_schedule_get_year_fractions(s1)[i] != (dates[i+1] - dates[i]) / 360.0)
+            ret = -1;
+    }
+    if (ret)
+        printf("schedule doesn't match the generated dates\n");
+
+    /* the same parameters share the schedule */
+    s2 = rq_schedule_cache_get(cache, &params);
+    if (s1 != s2 || cache->hits != 1 || cache->misses != 1)
+        ret = -1;
+    rq_schedule_free(s2);
+
+    /* push it out of the cache while it is still held */
+    for (i = 1; i <= 4; i++)
+    {
+        struct rq_schedule_params p = params;
+        p.end_date += i;
+        rq_schedule_free(rq_schedule_cache_get(cache, &p));
+    }
+    if (rq_schedule_cache_size(cache) != 4)
+        ret = -1;
+    s3 = rq_schedule_cache_get(cache, &params);
+    if (cache->misses != 6 || rq_schedule_get_dates(s1)[120] != rq_schedule_get_dates(s3)[120])
+        ret = -1;
+
+    /* build a leg from the schedule */
+    ffl = rq_floating_flow_list_alloc();
+    rq_floating_flow_list_add_floating_leg(ffl, s3, RQ_PAY_RECEIVE_PAY, "AUD.BBSW", "AUD", 1e6, 0.001);
+    if (rq_floating_flow_list_size(ffl) != 120 ||
+        rq_floating_flow_list_get_at(ffl, 7)->floating_rate->fixing_date != rq_schedule_get_fixing_dates(s3)[7])
+        ret = -1;
+    rq_floating_flow_list_free(ffl);
+
+    rq_schedule_free(s1);
+    rq_schedule_free(s3);
+    rq_schedule_cache_free(cache);
+
+    /* the calendar manager's cache is cleared with the calendars */
+    s1 = rq_schedule_cache_get(rq_calendar_mgr_get_schedule_cache(calmgr), &params);
+    rq_schedule_free(s1);
+    if (rq_schedule_cache_size(rq_calendar_mgr_get_schedule_cache(calmgr)) != 1)
+        ret = -1;
+    rq_calendar_mgr_clear(calmgr);
+    if (rq_schedule_cache_size(rq_calendar_mgr_get_schedule_cache(calmgr)) != 0)
+        ret = -1;
+    rq_calendar_mgr_free(calmgr);
+
+    if (ret == 0)
+        printf("Schedule test successful\n");
+
+    return ret;
+}
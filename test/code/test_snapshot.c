@@ -0,0 +1,229 @@
+#include <rq.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/* Writes a system and a market to a snapshot, loads it back through
+   a memory-mapped stream and checks the copies price the same. */
+
+#define SNAPSHOT_FILE "test_snapshot.rqs"
+
+static rq_calendar_t
+build_calendar(const char *id, short month, short day)
+{
+    rq_calendar_t cal = rq_calendar_alloc(id);
+    short year;
+
+    for (year = 2008; year <= 2020; year++)
+    {
+        rq_calendar_add_event(cal, rq_date_from_dmy(1, 1, year), RQ_DATE_EVENT_GEN_HOLIDAY);
+        rq_calendar_add_event(cal, rq_date_from_dmy(day, month, year), RQ_DATE_EVENT_GEN_HOLIDAY);
+    }
+
+    return cal;
+}
+
+static void
+build(rq_system_t system, rq_market_t market, rq_date from_date)
+{
+    rq_calendar_mgr_t calendar_mgr = rq_system_get_calendar_mgr(system);
+    rq_calendar_t cals[2];
+    rq_yield_curve_t yc;
+    rq_yield_curve_t spread;
+    rq_yield_curve_t composite;
+    rq_forward_curve_t fc;
+    unsigned int i;
+
+    rq_calendar_mgr_set_horizon(calendar_mgr, from_date, from_date + 3650);
+    cals[0] = build_calendar("SYD", 1, 26);
+    cals[1] = build_calendar("NYC", 7, 4);
+    rq_calendar_mgr_add(calendar_mgr, cals[0]);
+    rq_calendar_mgr_add(calendar_mgr, cals[1]);
+    rq_calendar_mgr_add(calendar_mgr, rq_calendar_alloc_joint("SYD+NYC", cals, 2, from_date, from_date + 3650));
+
+    rq_termstruct_mapping_mgr_add(
+        rq_system_get_termstruct_mapping_mgr(system),
+        rq_termstruct_mapping_build("AUD", "discount", "AUD.BBSW")
+        );
+
+    rq_rate_mgr_add(rq_market_get_rate_mgr(market),
+                    rq_rate_build("AUD.BBSW.3M", "AUD", RQ_RATE_TYPE_SIMPLE, from_date, from_date + 91, 0.0675));
+
+    yc = rq_yield_curve_init("AUD.BBSW", RQ_INTERPOLATION_LINEAR_ZERO, RQ_EXTRAPOLATION_LINEAR_ZERO,
+                             RQ_EXTRAPOLATION_LINEAR_ZERO, RQ_ZERO_CONTINUOUS_COMPOUNDING, 1,
+                             RQ_DAY_COUNT_BUS_252, from_date);
+    rq_yield_curve_set_underlying_asset_id(yc, "AUD");
+    rq_yield_curve_set_day_count_calendar(yc, cals[0]);
+    for (i = 1; i <= 40; i++)
+        rq_yield_curve_set_discount_factor(yc, from_date + i * 91, exp(-(0.06 + 0.0005 * i) * i * 91 / 365.0));
+    rq_yield_curve_cache_enable(yc);
+    rq_yield_curve_mgr_add(rq_market_get_yield_curve_mgr(market), yc);
+
+    spread = rq_yield_curve_init("AUD.SPREAD", RQ_INTERPOLATION_LINEAR_ZERO, RQ_EXTRAPOLATION_LINEAR_ZERO,
+                                 RQ_EXTRAPOLATION_LINEAR_ZERO, RQ_ZERO_CONTINUOUS_COMPOUNDING, 1,
+                                 RQ_DAY_COUNT_ACTUAL_365, from_date);
+    rq_yield_curve_set_discount_factor(spread, from_date + 3650, 0.98);
+    rq_yield_curve_mgr_add(rq_market_get_yield_curve_mgr(market), spread);
+
+    composite = rq_yield_curve_init("AUD.CORP", RQ_INTERPOLATION_LINEAR_ZERO, RQ_EXTRAPOLATION_LINEAR_ZERO,
+                                    RQ_EXTRAPOLATION_LINEAR_ZERO, RQ_ZERO_CONTINUOUS_COMPOUNDING, 1,
+                                    RQ_DAY_COUNT_ACTUAL_365, from_date);
+    rq_yield_curve_set_composite(composite, yc, spread);
+    rq_yield_curve_mgr_add(rq_market_get_yield_curve_mgr(market), composite);
+
+    fc = rq_forward_curve_build("AUDUSD", "AUD/USD");
+    for (i = 1; i <= 12; i++)
+        rq_forward_curve_set_rate(fc, from_date + i * 30, 0.70 + 0.001 * i, 0);
+    rq_forward_curve_mgr_add(rq_market_get_forward_curve_mgr(market), fc);
+
+    rq_exchange_rate_mgr_add(rq_market_get_exchange_rate_mgr(market), "AUD", "USD", 0.7012);
+    rq_exchange_rate_mgr_add_cross_thru_ccy_code(rq_market_get_exchange_rate_mgr(market), "USD");
+    rq_spot_price_mgr_add(rq_market_get_spot_price_mgr(market), "equity", "BHP", 31.25);
+
+    rq_market_freeze(market);
+}
+
+/* Does the loaded system and market give the same answers as the
+   one that was written? */
+static int
+compare(rq_system_t s1, rq_market_t m1, rq_system_t s2, rq_market_t m2, rq_date from_date)
+{
+    rq_calendar_t c1 = rq_calendar_mgr_get(rq_system_get_calendar_mgr(s1), "SYD+NYC");
+    rq_calendar_t c2 = rq_calendar_mgr_get(rq_system_get_calendar_mgr(s2), "SYD+NYC");
+    rq_yield_curve_t y1 = rq_yield_curve_mgr_get(rq_market_get_yield_curve_mgr(m1), "AUD.BBSW");
+    rq_yield_curve_t y2 = rq_yield_curve_mgr_get(rq_market_get_yield_curve_mgr(m2), "AUD.BBSW");
+    rq_yield_curve_t corp1 = rq_yield_curve_mgr_get(rq_market_get_yield_curve_mgr(m1), "AUD.CORP");
+    rq_yield_curve_t corp2 = rq_yield_curve_mgr_get(rq_market_get_yield_curve_mgr(m2), "AUD.CORP");
+    rq_termstruct_mapping_t mapping = rq_termstruct_mapping_mgr_find(rq_system_get_termstruct_mapping_mgr(s2), "AUD", "discount");
+    double fwd1;
+    double fwd2;
+    rq_date d;
+
+    if (!c2 || !y2 || !corp2 || !y2->frozen || rq_yield_curve_get_base_curve(corp2) != y2 ||
+        !mapping || strcmp(mapping->curve_id, "AUD.BBSW") ||
+        rq_market_get_market_date(m2) != rq_market_get_market_date(m1))
+        return -1;
+
+    for (d = from_date; d < from_date + 3000; d += 7)
+    {
+        if (rq_calendar_is_good_date(c1, d) != rq_calendar_is_good_date(c2, d) ||
+            rq_yield_curve_get_discount_factor(y1, d) != rq_yield_curve_get_discount_factor(y2, d) ||
+            rq_yield_curve_get_discount_factor(corp1, d) != rq_yield_curve_get_discount_factor(corp2, d) ||
+            rq_yield_curve_get_year_fraction(y1, RQ_DAY_COUNT_BUS_252, from_date, d) != rq_yield_curve_get_year_fraction(y2, RQ_DAY_COUNT_BUS_252, from_date, d))
+            return -1;
+    }
+
+    rq_forward_curve_get_rate(rq_forward_curve_mgr_get(rq_market_get_forward_curve_mgr(m1), "AUDUSD"), from_date + 100, &fwd1);
+    if (!rq_forward_curve_mgr_get(rq_market_get_forward_curve_mgr(m2), "AUDUSD"))
+        return -1;
+    rq_forward_curve_get_rate(rq_forward_curve_mgr_get(rq_market_get_forward_curve_mgr(m2), "AUDUSD"), from_date + 100, &fwd2);
+    if (fwd1 != fwd2)
+        return -1;
+
+    if (rq_rate_get_value(rq_rate_mgr_find(rq_market_get_rate_mgr(m2), "AUD.BBSW.3M")) != 0.0675 ||
+        rq_exchange_rate_mgr_get(rq_market_get_exchange_rate_mgr(m2), "AUD", "USD") != 0.7012 ||
+        !rq_market_get_exchange_rate_mgr(m2)->cross_thru_node ||
+        rq_spot_price_mgr_get_price(rq_market_get_spot_price_mgr(m2), "equity", "BHP") != 31.25)
+        return -1;
+
+    return 0;
+}
+
+/* The first record of a section in a snapshot buffer. */
+static void *
+find_section(char *buffer, unsigned int section_type)
+{
+    const struct rq_snapshot_header *header = (const struct rq_snapshot_header *)buffer;
+    const struct rq_snapshot_section *table = (const struct rq_snapshot_section *)(buffer + sizeof(*header));
+    unsigned int i;
+
+    for (i = 0; i < header->num_sections; i++)
+        if (table[i].section_type == section_type)
+            return buffer + table[i].offset;
+    return NULL;
+}
+
+int
+main(int argc, char **argv)
+{
+    rq_date from_date = rq_date_from_dmy(2, 1, 2009);
+    rq_system_t system = rq_system_alloc();
+    rq_market_t market = rq_market_alloc(from_date);
+    rq_system_t loaded_system = rq_system_alloc();
+    rq_market_t loaded_market = rq_market_alloc(0);
+    rq_stream_t stream;
+    const char *buffer;
+    unsigned long buffer_len;
+    char *copy;
+    int ret = 0;
+
+    build(system, market, from_date);
+
+    stream = rq_stream_file_open(SNAPSHOT_FILE, "w");
+    if (rq_snapshot_write(stream, system, market) != RQ_OK)
+        ret = -1;
+    rq_stream_free(stream);
+
+    /* attach through a mapping */
+    stream = rq_stream_mmap_open(SNAPSHOT_FILE);
+    if (rq_snapshot_read(stream, loaded_system, loaded_market) != RQ_OK ||
+        compare(system, market, loaded_system, loaded_market, from_date) != 0)
+    {
+        printf("memory-mapped snapshot differs\n");
+        ret = -1;
+    }
+
+    /* a snapshot that's been tampered with is refused */
+    buffer = rq_stream_mmap_get_buffer(stream, &buffer_len);
+    copy = (char *)malloc(buffer_len);
+    memcpy(copy, buffer, buffer_len);
+    if (rq_snapshot_read_buffer(copy, buffer_len - 8, NULL, NULL) != RQ_ERR_SNAPSHOT_BAD_FORMAT)
+        ret = -1;
+    ((struct rq_snapshot_header *)copy)->version = RQ_SNAPSHOT_VERSION + 1;
+    if (rq_snapshot_read_buffer(copy, buffer_len, NULL, NULL) != RQ_ERR_SNAPSHOT_VERSION)
+        ret = -1;
+    memcpy(copy, buffer, buffer_len);
+    ((struct rq_snapshot_section *)(copy + sizeof(struct rq_snapshot_header)))[1].length += 8;
+    if (rq_snapshot_read_buffer(copy, buffer_len, NULL, NULL) != RQ_ERR_SNAPSHOT_BAD_FORMAT)
+        ret = -1;
+
+    /* as is one whose string references don't lead anywhere */
+    memcpy(copy, buffer, buffer_len);
+    ((struct rq_snapshot_rate *)find_section(copy, RQ_SNAPSHOT_SECTION_RATES))->rate_class_id = RQ_SNAPSHOT_NULL_STRING;
+    if (rq_snapshot_read_buffer(copy, buffer_len, loaded_system, loaded_market) != RQ_ERR_SNAPSHOT_BAD_FORMAT)
+        ret = -1;
+    memcpy(copy, buffer, buffer_len);
+    ((struct rq_snapshot_termstruct_mapping *)find_section(copy, RQ_SNAPSHOT_SECTION_TERMSTRUCT_MAPPINGS))->asset_id = RQ_SNAPSHOT_NULL_STRING;
+    if (rq_snapshot_read_buffer(copy, buffer_len, loaded_system, loaded_market) != RQ_ERR_SNAPSHOT_BAD_FORMAT)
+        ret = -1;
+    memcpy(copy, buffer, buffer_len);
+    ((struct rq_snapshot_yield_curve *)find_section(copy, RQ_SNAPSHOT_SECTION_YIELD_CURVES))->base_curve_id =
+        ((struct rq_snapshot_rate *)find_section(copy, RQ_SNAPSHOT_SECTION_RATES))->rate_class_id;
+    if (rq_snapshot_read_buffer(copy, buffer_len, loaded_system, loaded_market) != RQ_ERR_SNAPSHOT_BAD_FORMAT)
+        ret = -1;
+    free(copy);
+    rq_stream_free(stream);
+
+    /* and through an ordinary stream, over the top of what's there */
+    stream = rq_stream_file_open(SNAPSHOT_FILE, "r");
+    if (rq_snapshot_read(stream, loaded_system, loaded_market) != RQ_OK ||
+        compare(system, market, loaded_system, loaded_market, from_date) != 0)
+    {
+        printf("snapshot read from a file stream differs\n");
+        ret = -1;
+    }
+    rq_stream_free(stream);
+
+    remove(SNAPSHOT_FILE);
+
+    rq_market_free(loaded_market);
+    rq_system_free(loaded_system);
+    rq_market_free(market);
+    rq_system_free(system);
+
+    if (ret == 0)
+        printf("Snapshot test successful\n");
+
+    return ret;
+}
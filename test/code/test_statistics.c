@@ -0,0 +1,80 @@
+#include <rq.h>
+#include <stdlib.h>
+#include <math.h>
+
+static double
+rand_normal()
+{
+    double u1 = (rand() + 1.0) / (RAND_MAX + 2.0);
+    double u2 = (rand() + 1.0) / (RAND_MAX + 2.0);
+    return sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+int
+main(int argc, char **argv)
+{
+    unsigned long num_values = (argc == 1 ? 1000000 : atol(argv[1]));
+    unsigned long half = num_values / 2;
+    double *values = (double *)malloc(sizeof(double) * num_values);
+    struct rq_statistics_moments all;
+    struct rq_statistics_moments part1;
+    struct rq_statistics_moments part2;
+    rq_tdigest_t td1 = rq_tdigest_alloc(200);
+    rq_tdigest_t td2 = rq_tdigest_alloc(200);
+    double var;
+    double es;
+    unsigned long i;
+    int ret = 0;
+
+    srand(1234);
+    for (i = 0; i < num_values; i++)
+        values[i] = rand_normal();
+
+    /* one pass over everything vs two merged halves */
+    rq_statistics_moments_init(&all);
+    for (i = 0; i < num_values; i++)
+        rq_statistics_moments_add(&all, values[i]);
+
+    rq_statistics_moments_init(&part1);
+    rq_statistics_moments_init(&part2);
+    rq_statistics_moments_add_array(&part1, values, half);
+    rq_statistics_moments_add_array(&part2, values + half, num_values - half);
+    rq_statistics_moments_merge(&part1, &part2);
+
+    printf("mean = %.6f var = %.6f skew = %.6f kurt = %.6f\n",
+           all.mean,
+           rq_statistics_moments_get_variance(&all),
+           rq_statistics_moments_get_skewness(&all),
+           rq_statistics_moments_get_kurtosis(&all));
+
+    if (part1.n != all.n ||
+        fabs(part1.mean - all.mean) > 1e-12 ||
+        fabs(rq_statistics_moments_get_variance(&part1) - rq_statistics_moments_get_variance(&all)) > 1e-10 ||
+        fabs(rq_statistics_moments_get_skewness(&part1) - rq_statistics_moments_get_skewness(&all)) > 1e-8 ||
+        fabs(rq_statistics_moments_get_kurtosis(&part1) - rq_statistics_moments_get_kurtosis(&all)) > 1e-8 ||
+        fabs(rq_statistics_moments_get_variance(&all) - 1.0) > 0.01)
+        ret = -1;
+
+    /* quantiles of a standard normal from two merged digests */
+    rq_tdigest_add_array(td1, values, half);
+    rq_tdigest_add_array(td2, values + half, num_values - half);
+    rq_tdigest_merge(td1, td2);
+
+    var = rq_tdigest_value_at_risk(td1, 0.99, 1);
+    es = rq_tdigest_expected_shortfall(td1, 0.99, 1);
+    printf("median = %.6f VaR(99%%) = %.6f ES(99%%) = %.6f\n", 
+           rq_tdigest_quantile(td1, 0.5), var, es);
+
+    if (rq_tdigest_get_count(td1) != (double)num_values ||
+        fabs(rq_tdigest_quantile(td1, 0.5)) > 0.01 ||
+        fabs(var - 2.3263) > 0.02 ||
+        fabs(es - 2.6652) > 0.02 ||
+        fabs(rq_tdigest_cdf(td1, -2.3263) - 0.01) > 0.001)
+        ret = -1;
+
+    rq_tdigest_free(td1);
+    rq_tdigest_free(td2);
+    free(values);
+
+    return ret;
+}
@@ -0,0 +1,135 @@
+#include <rq.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Writes the same output through a buffered file stream, with a
+   buffer smaller than some of the writes, and a string stream, and
+   reads it back through the buffered stream. */
+
+#define TEST_FILE "test_stream_buffered.txt"
+#define BUFFER_SIZE 16
+
+static void
+write_output(rq_stream_t stream)
+{
+    char long_line[600];
+    struct rq_stream_iovec iov[3];
+    int i;
+
+    memset(long_line, 'x', sizeof(long_line) - 1);
+    long_line[sizeof(long_line) - 1] = '\0';
+
+    for (i = -50; i < 50; i++)
+    {
+        rq_stream_write_string(stream, "<value>");
+        rq_stream_write_integer_as_string(stream, i * 12345);
+        rq_stream_write_string(stream, " ");
+        rq_stream_write_double_as_string(stream, i * 0.0125, 4);
+        rq_stream_write_string(stream, "</value>\n");
+    }
+
+    /* more than printf formats on the stack */
+    rq_stream_printf(stream, "%s|%d\n", long_line, 42);
+
+    iov[0].buf = "first ";
+    iov[0].len = 6;
+    iov[1].buf = long_line;
+    iov[1].len = 20;
+    iov[2].buf = " last\n";
+    iov[2].len = 6;
+    rq_stream_writev(stream, iov, 3);
+}
+
+int
+main(int argc, char **argv)
+{
+    rq_stream_t expected = rq_stream_string_alloc();
+    rq_stream_t stream;
+    const char *expected_buf;
+    unsigned long expected_len;
+    unsigned long len;
+    char line[1024];
+    char *read_buf;
+    long pos = 0;
+    int ret = 0;
+    int n;
+
+    rq_stream_open(expected);
+    write_output(expected);
+    expected_buf = rq_stream_string_get_buffer(expected, &expected_len);
+
+    /* a file stream reports the bytes it wrote */
+    stream = rq_stream_file_open(TEST_FILE, "w");
+    if (rq_stream_write_string(stream, "abc") != 3)
+        ret = -1;
+    rq_stream_free(stream);
+
+    stream = rq_stream_buffered_alloc(rq_stream_file_open(TEST_FILE, "w+"), BUFFER_SIZE);
+    write_output(stream);
+    if (rq_stream_tell(stream) != (long)expected_len)
+    {
+        printf("tell after writing is %ld, not %lu\n", rq_stream_tell(stream), expected_len);
+        ret = -1;
+    }
+
+    /* reading a line at a time straight after writing */
+    rq_stream_rewind(stream);
+    while ((n = rq_stream_read_line(stream, line, sizeof(line))) > 0)
+    {
+        if ((unsigned long)(pos + n) > expected_len || memcmp(line, expected_buf + pos, n) ||
+            (line[n - 1] != '\n' && n != sizeof(line) - 1))
+        {
+            printf("line at %ld differs\n", pos);
+            ret = -1;
+            break;
+        }
+        pos += n;
+        if (rq_stream_tell(stream) != pos)
+        {
+            printf("tell while reading is %ld, not %ld\n", rq_stream_tell(stream), pos);
+            ret = -1;
+        }
+    }
+    if ((unsigned long)pos != expected_len)
+    {
+        printf("read %ld bytes, not %lu\n", pos, expected_len);
+        ret = -1;
+    }
+
+    /* overwrite part of the file after reading some of it */
+    rq_stream_seek(stream, 0);
+    rq_stream_read(stream, line, 3);
+    rq_stream_write_string(stream, "VAL");
+    rq_stream_close(stream);
+    rq_stream_free(stream);
+
+    stream = rq_stream_buffered_alloc(rq_stream_file_open(TEST_FILE, "r"), BUFFER_SIZE);
+    read_buf = (char *)malloc(expected_len + 1);
+    if (rq_stream_read(stream, read_buf, (int)expected_len + 1) != (int)expected_len ||
+        memcmp(read_buf, "<vaVAL>", 7) || memcmp(read_buf + 7, expected_buf + 7, expected_len - 7) ||
+        !rq_stream_at_end(stream))
+    {
+        printf("reading the file back in one go failed\n");
+        ret = -1;
+    }
+    free(read_buf);
+    rq_stream_free(stream);
+    remove(TEST_FILE);
+
+    /* the string stream grows and can be overwritten in place */
+    rq_stream_seek(expected, 1);
+    rq_stream_write_string(expected, "V");
+    expected_buf = rq_stream_string_get_buffer(expected, &len);
+    if (len != expected_len || strncmp(expected_buf, "<Value>", 7))
+    {
+        printf("overwriting the string stream failed\n");
+        ret = -1;
+    }
+    rq_stream_free(expected);
+
+    if (ret == 0)
+        printf("Buffered stream test successful\n");
+
+    return ret;
+}
@@ -0,0 +1,297 @@
+#include <rq.h>
+#include <rq_data_store_fs.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#ifdef RQ_THREADS
+#include <pthread.h>
+#endif
+
+/* Saves a system's calendars to a file system data store and loads
+   them back eagerly, lazily and in parallel. */
+
+#define STORE_DIR "test_system_load.dir"
+#define NUM_CALENDARS 30
+
+static const char *store_subdirs[] = {
+    "calendars",
+    "assets",
+    "bootstrapconfigs",
+    "markets",
+    NULL
+};
+
+static rq_calendar_t
+build_calendar(const char *id, short month, short day)
+{
+    rq_calendar_t cal = rq_calendar_alloc(id);
+    short year;
+
+    for (year = 2005; year <= 2015; year++)
+    {
+        rq_calendar_add_event(cal, rq_date_from_dmy(1, 1, year), RQ_DATE_EVENT_GEN_HOLIDAY);
+        rq_calendar_add_event(cal, rq_date_from_dmy(day, month, year), RQ_DATE_EVENT_GEN_HOLIDAY);
+    }
+
+    return cal;
+}
+
+static rq_system_t
+load_system(enum rq_data_store_fs_load_mode load_mode)
+{
+    rq_data_store_t store = rq_data_store_fs_alloc();
+    rq_system_t system = rq_system_alloc();
+
+    rq_data_store_fs_set_load_mode(store, load_mode, 4);
+    rq_data_store_open(store, STORE_DIR);
+    rq_data_store_system_load(store, system);
+    rq_data_store_close(store);
+    rq_data_store_free(store);
+
+    return system;
+}
+
+/* Do the two systems' calendars agree on every day from 2005 to
+   2015? */
+static int
+compare_calendars(rq_system_t s1, rq_system_t s2)
+{
+    rq_date start = rq_date_from_dmy(1, 1, 2005);
+    rq_date end = rq_date_from_dmy(31, 12, 2015);
+    char id[16];
+    unsigned int i;
+
+    for (i = 0; i < NUM_CALENDARS; i++)
+    {
+        rq_calendar_t c1;
+        rq_calendar_t c2;
+        rq_date d;
+
+        sprintf(id, "CAL%02u", i);
+        c1 = rq_calendar_mgr_get(rq_system_get_calendar_mgr(s1), id);
+        c2 = rq_calendar_mgr_get(rq_system_get_calendar_mgr(s2), id);
+        if (!c1 || !c2)
+            return -1;
+
+        for (d = start; d <= end; d++)
+            if (rq_calendar_is_good_date(c1, d) != rq_calendar_is_good_date(c2, d))
+                return -1;
+    }
+
+    return 0;
+}
+
+/* How many calendars can be iterated over. */
+static unsigned int
+count_calendars(rq_calendar_mgr_t calmgr)
+{
+    rq_iterator_t iter;
+    unsigned int num = 0;
+
+    for (iter = rq_calendar_mgr_get_iterator(calmgr); !rq_iterator_at_end(iter); rq_iterator_incr(iter))
+        num++;
+    rq_iterator_free(iter);
+
+    return num;
+}
+
+#ifdef RQ_THREADS
+/* looks every calendar up, failing if one isn't found */
+static void *
+lookup_thread(void *calmgr)
+{
+    char id[16];
+    unsigned int n;
+    unsigned int i;
+
+    for (n = 0; n < 100; n++)
+    {
+        for (i = 0; i < NUM_CALENDARS; i++)
+        {
+            sprintf(id, "CAL%02u", (i * 7 + n) % NUM_CALENDARS);
+            if (!rq_calendar_mgr_get((rq_calendar_mgr_t)calmgr, id))
+                return calmgr;
+        }
+    }
+    return NULL;
+}
+#endif
+
+static void
+remove_store(void)
+{
+    char path[256];
+    char id[16];
+    int i;
+
+    for (i = 0; i < NUM_CALENDARS; i++)
+    {
+        sprintf(id, "CAL%02u", i);
+        sprintf(path, "%s/calendars/%s.xml", STORE_DIR, id);
+        remove(path);
+    }
+    for (i = 0; store_subdirs[i]; i++)
+    {
+        sprintf(path, "%s/%s", STORE_DIR, store_subdirs[i]);
+        rmdir(path);
+    }
+    sprintf(path, "%s/rq.xml", STORE_DIR);
+    remove(path);
+    rmdir(STORE_DIR);
+}
+
+int
+main(int argc, char **argv)
+{
+    rq_system_t system = rq_system_alloc();
+    rq_system_t loaded;
+    rq_data_store_t store = rq_data_store_fs_alloc();
+    rq_calendar_mgr_t calmgr;
+    char id[16];
+    unsigned int i;
+    int ret = 0;
+
+    for (i = 0; i < NUM_CALENDARS; i++)
+    {
+        sprintf(id, "CAL%02u", i);
+        rq_calendar_mgr_add(rq_system_get_calendar_mgr(system),
+                            build_calendar(id, (short)(i % 12 + 1), (short)(i % 28 + 1)));
+    }
+
+    if (rq_data_store_create(store, STORE_DIR) != RQ_OK ||
+        rq_data_store_system_save(store, system) != RQ_OK)
+    {
+        printf("can't save the system\n");
+        return -1;
+    }
+    rq_data_store_close(store);
+    rq_data_store_free(store);
+
+    loaded = load_system(RQ_DATA_STORE_FS_LOAD_EAGER);
+    if (rq_tree_rb_size(rq_system_get_calendar_mgr(loaded)->calendars) != NUM_CALENDARS ||
+        compare_calendars(system, loaded) != 0)
+    {
+        printf("eager load differs\n");
+        ret = -1;
+    }
+    rq_system_free(loaded);
+
+    loaded = load_system(RQ_DATA_STORE_FS_LOAD_PARALLEL);
+    if (rq_tree_rb_size(rq_system_get_calendar_mgr(loaded)->calendars) != NUM_CALENDARS ||
+        compare_calendars(system, loaded) != 0)
+    {
+        printf("parallel load differs\n");
+        ret = -1;
+    }
+    rq_system_free(loaded);
+
+    /* nothing's read until it's asked for */
+    loaded = load_system(RQ_DATA_STORE_FS_LOAD_LAZY);
+    calmgr = rq_system_get_calendar_mgr(loaded);
+    if (rq_tree_rb_size(calmgr->calendars) != 0 ||
+        !rq_calendar_mgr_get(calmgr, "CAL07") ||
+        rq_calendar_mgr_get(calmgr, "CAL07") != rq_calendar_mgr_get(calmgr, "CAL07") ||
+        rq_calendar_mgr_get(calmgr, "NOSUCH") ||
+        rq_tree_rb_size(calmgr->calendars) != 1)
+    {
+        printf("lazy load read the wrong calendars\n");
+        ret = -1;
+    }
+    if (compare_calendars(system, loaded) != 0)
+    {
+        printf("lazy load differs\n");
+        ret = -1;
+    }
+
+    /* an ID the loader doesn't have is only asked for once */
+    rq_calendar_mgr_get(calmgr, "NOSUCH");
+    if (rq_tree_rb_size(calmgr->failed_ids) != 1)
+    {
+        printf("lazy load retried a missing calendar\n");
+        ret = -1;
+    }
+
+    /* saving a lazily loaded system keeps the calendars it hasn't
+       used */
+    rq_calendar_mgr_clear(calmgr);
+    rq_system_free(loaded);
+    loaded = load_system(RQ_DATA_STORE_FS_LOAD_LAZY);
+    rq_calendar_mgr_get(rq_system_get_calendar_mgr(loaded), "CAL03");
+    store = rq_data_store_fs_alloc();
+    rq_data_store_open(store, STORE_DIR);
+    rq_data_store_system_save(store, loaded);
+    rq_data_store_close(store);
+    rq_data_store_free(store);
+    rq_system_free(loaded);
+
+    loaded = load_system(RQ_DATA_STORE_FS_LOAD_EAGER);
+    if (compare_calendars(system, loaded) != 0)
+    {
+        printf("saving a lazily loaded system lost calendars\n");
+        ret = -1;
+    }
+    rq_system_free(loaded);
+
+    /* iterating over a lazily loaded system sees the calendars that
+       haven't been asked for, and so does a snapshot of it */
+    loaded = load_system(RQ_DATA_STORE_FS_LOAD_LAZY);
+    if (count_calendars(rq_system_get_calendar_mgr(loaded)) != NUM_CALENDARS)
+    {
+        printf("iterating over a lazily loaded system missed calendars\n");
+        ret = -1;
+    }
+    rq_system_free(loaded);
+
+    loaded = load_system(RQ_DATA_STORE_FS_LOAD_LAZY);
+    {
+        rq_stream_t stream = rq_stream_string_alloc();
+        rq_system_t copy = rq_system_alloc();
+
+        rq_stream_open(stream);
+        rq_snapshot_write(stream, loaded, NULL);
+        rq_stream_rewind(stream);
+        if (rq_snapshot_read(stream, copy, NULL) != RQ_OK ||
+            rq_tree_rb_size(rq_system_get_calendar_mgr(copy)->calendars) != NUM_CALENDARS)
+        {
+            printf("a snapshot of a lazily loaded system missed calendars\n");
+            ret = -1;
+        }
+
+        rq_stream_free(stream);
+        rq_system_free(copy);
+    }
+    rq_system_free(loaded);
+
+#ifdef RQ_THREADS
+    /* threads sharing a lazily loaded system all find its calendars */
+    loaded = load_system(RQ_DATA_STORE_FS_LOAD_LAZY);
+    {
+        pthread_t threads[4];
+        void *result;
+
+        for (i = 0; i < 4; i++)
+            pthread_create(&threads[i], NULL, lookup_thread, rq_system_get_calendar_mgr(loaded));
+        for (i = 0; i < 4; i++)
+        {
+            pthread_join(threads[i], &result);
+            if (result)
+            {
+                printf("a thread couldn't find a calendar\n");
+                ret = -1;
+            }
+        }
+    }
+    if (compare_calendars(system, loaded) != 0)
+        ret = -1;
+    rq_system_free(loaded);
+#endif
+
+    remove_store();
+    rq_system_free(system);
+
+    if (ret == 0)
+        printf("System load test successful\n");
+
+    return ret;
+}
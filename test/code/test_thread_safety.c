@@ -0,0 +1,271 @@
+#include <rq.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#if defined(WIN32)
+#include <windows.h>
+#elif defined(RQ_THREADS)
+#include <pthread.h>
+#endif
+
+/* Many pricing threads reading one frozen market and system, each
+   checking its results against those worked out before the threads
+   started. Build it with -fsanitize=thread to check for races. */
+
+#define NUM_THREADS 8
+#define NUM_ITERATIONS 4000
+#define NUM_DATES 512
+#define NUM_SCHEDULES 8
+#define NUM_ASSETS 4
+
+struct shared {
+    rq_date from_date;
+    rq_yield_curve_t yc;
+    rq_asset_correlation_mgr_t correlation_mgr;
+    rq_schedule_cache_t schedule_cache;
+    struct rq_schedule_params params[NUM_SCHEDULES];
+    unsigned int num_schedule_dates[NUM_SCHEDULES];
+    rq_date dates[NUM_DATES];
+    double dfs[NUM_DATES];
+    double forward_rates[NUM_DATES];
+    double year_fractions[NUM_DATES];
+};
+
+struct worker {
+    struct shared *sh;
+    unsigned long seed;
+    int failures;
+};
+
+static const char *asset_ids[NUM_ASSETS] = { "BHP", "RIO", "NAB", "WBC" };
+
+static void
+run_worker(struct worker *w)
+{
+    struct shared *sh = w->sh;
+    unsigned int i;
+
+    for (i = 0; i < NUM_ITERATIONS; i++)
+    {
+        unsigned int k;
+        rq_date d;
+
+        w->seed = w->seed * 1103515245UL + 12345UL;
+        k = (unsigned int)(w->seed >> 8) % NUM_DATES;
+        d = sh->dates[k];
+
+        if (rq_yield_curve_get_discount_factor(sh->yc, d) != sh->dfs[k])
+            w->failures++;
+        if (rq_yield_curve_get_forward_simple_rate(sh->yc, d, d + 91, RQ_DAY_COUNT_BUS_252) != sh->forward_rates[k])
+            w->failures++;
+        if (rq_yield_curve_get_year_fraction(sh->yc, RQ_DAY_COUNT_BUS_252, sh->from_date, d) != sh->year_fractions[k])
+            w->failures++;
+
+        if (i % 8 == 0)
+        {
+            /* more schedules than the cache holds, so that threads
+               evict schedules other threads are using */
+            unsigned int s = k % NUM_SCHEDULES;
+            rq_schedule_t schedule = rq_schedule_cache_get(sh->schedule_cache, &sh->params[s]);
+
+            if (rq_schedule_get_num_dates(schedule) != sh->num_schedule_dates[s])
+                w->failures++;
+            rq_schedule_free(schedule);
+        }
+
+        if (i % 64 == 0)
+        {
+            rq_asset_correlation_matrix_t m =
+                rq_asset_correlation_mgr_get_matrix(sh->correlation_mgr, asset_ids, 2 + k % 3);
+
+            /* only WBC is missing correlations, with BHP and RIO */
+            if (!m || m->num_assets != 2 + k % 3 || m->num_missing != (m->num_assets == NUM_ASSETS ? 2 : 0))
+                w->failures++;
+        }
+
+        if (rq_random_poisson(2.0 + k % 20) < 0.0)
+            w->failures++;
+    }
+}
+
+#if defined(WIN32)
+static DWORD WINAPI
+worker_main(LPVOID p)
+{
+    run_worker((struct worker *)p);
+    return 0;
+}
+#elif defined(RQ_THREADS)
+static void *
+worker_main(void *p)
+{
+    run_worker((struct worker *)p);
+    return NULL;
+}
+#endif
+
+static rq_calendar_t
+build_calendar(const char *id)
+{
+    rq_calendar_t cal = rq_calendar_alloc(id);
+    short year;
+
+    for (year = 2010; year <= 2030; year++)
+    {
+        rq_calendar_add_event(cal, rq_date_from_dmy(1, 1, year), RQ_DATE_EVENT_GEN_HOLIDAY);
+        rq_calendar_add_event(cal, rq_date_from_dmy(21, 4, year), RQ_DATE_EVENT_GEN_HOLIDAY);
+        rq_calendar_add_event(cal, rq_date_from_dmy(7, 9, year), RQ_DATE_EVENT_GEN_HOLIDAY);
+        rq_calendar_add_event(cal, rq_date_from_dmy(25, 12, year), RQ_DATE_EVENT_GEN_HOLIDAY);
+    }
+
+    return cal;
+}
+
+int
+main(int argc, char **argv)
+{
+    struct shared sh;
+    struct worker workers[NUM_THREADS];
+    rq_system_t system = rq_system_alloc();
+    rq_market_t market;
+    rq_calendar_t cal;
+    rq_yield_curve_t plain;
+    rq_exchange_rate_mgr_t exchange_rate_mgr;
+    unsigned long num_rates;
+    double exchange_rate;
+    unsigned int i;
+    int ret = 0;
+
+    sh.from_date = rq_date_from_dmy(4, 1, 2010);
+    market = rq_market_alloc(sh.from_date);
+
+    cal = build_calendar("BRL");
+    rq_calendar_mgr_add(rq_system_get_calendar_mgr(system), cal);
+
+    /* a BUS/252 curve counting business days in the system's
+       calendar */
+    sh.yc = rq_yield_curve_init(
+        "BRL.CDI", RQ_INTERPOLATION_LINEAR_ZERO, RQ_EXTRAPOLATION_LINEAR_ZERO,
+        RQ_EXTRAPOLATION_LINEAR_ZERO, RQ_ZERO_CONTINUOUS_COMPOUNDING, 1,
+        RQ_DAY_COUNT_BUS_252, sh.from_date);
+    rq_yield_curve_set_day_count_calendar(sh.yc, cal);
+    for (i = 1; i <= 40; i++)
+        rq_yield_curve_set_discount_factor(sh.yc, sh.from_date + i * 91, exp(-(0.09 + 0.001 * i) * i * 91 / 365.0));
+    plain = rq_yield_curve_clone(sh.yc);
+    rq_yield_curve_cache_enable(sh.yc);
+    rq_yield_curve_mgr_add(rq_market_get_yield_curve_mgr(market), sh.yc);
+
+    /* the year fractions use the calendar, not just weekdays */
+    if (rq_yield_curve_get_year_fraction(sh.yc, RQ_DAY_COUNT_BUS_252, sh.from_date, rq_date_from_dmy(4, 1, 2011)) !=
+        rq_calendar_businessday_count(cal, sh.from_date + 1, rq_date_from_dmy(4, 1, 2011)) / 252.0 ||
+        rq_yield_curve_get_year_fraction(sh.yc, RQ_DAY_COUNT_BUS_252, sh.from_date, rq_date_from_dmy(4, 1, 2011)) ==
+        rq_day_count_get_year_fraction(RQ_DAY_COUNT_BUS_252, sh.from_date, rq_date_from_dmy(4, 1, 2011)))
+        ret = -1;
+
+    /* unless the calendar is set for the process, before the threads
+       start */
+    rq_day_count_set_bus_252_calendar(cal);
+    if (rq_yield_curve_get_year_fraction(sh.yc, RQ_DAY_COUNT_BUS_252, sh.from_date, rq_date_from_dmy(4, 1, 2011)) !=
+        rq_day_count_get_year_fraction(RQ_DAY_COUNT_BUS_252, sh.from_date, rq_date_from_dmy(4, 1, 2011)))
+        ret = -1;
+    rq_day_count_set_bus_252_calendar(NULL);
+
+    sh.correlation_mgr = rq_market_get_asset_correlation_mgr(market);
+    rq_asset_correlation_mgr_add(sh.correlation_mgr, "BHP", "RIO", 0.9);
+    rq_asset_correlation_mgr_add(sh.correlation_mgr, "BHP", "NAB", 0.9);
+    rq_asset_correlation_mgr_add(sh.correlation_mgr, "RIO", "NAB", -0.9);
+    rq_asset_correlation_mgr_add(sh.correlation_mgr, "NAB", "WBC", 0.7);
+
+    sh.schedule_cache = rq_schedule_cache_alloc(NUM_SCHEDULES / 2);
+    for (i = 0; i < NUM_SCHEDULES; i++)
+    {
+        rq_schedule_t schedule;
+
+        rq_schedule_params_init(&sh.params[i]);
+        sh.params[i].start_date = sh.from_date + i;
+        sh.params[i].end_date = rq_date_from_dmy(4, 1, 2020);
+        rq_term_fill(&sh.params[i].term, 0, 0, 3, 0);
+        rq_schedule_params_set_calendars(&sh.params[i], &cal, 1);
+
+        schedule = rq_schedule_generate(&sh.params[i]);
+        sh.num_schedule_dates[i] = rq_schedule_get_num_dates(schedule);
+        rq_schedule_free(schedule);
+    }
+
+    /* the results the threads should see, from a curve without any
+       caches */
+    srand(42);
+    for (i = 0; i < NUM_DATES; i++)
+    {
+        sh.dates[i] = sh.from_date + 1 + rand() % (365 * 8);
+        sh.dfs[i] = rq_yield_curve_get_discount_factor(plain, sh.dates[i]);
+        sh.forward_rates[i] = rq_yield_curve_get_forward_simple_rate(plain, sh.dates[i], sh.dates[i] + 91, RQ_DAY_COUNT_BUS_252);
+        sh.year_fractions[i] = rq_yield_curve_get_year_fraction(plain, RQ_DAY_COUNT_BUS_252, sh.from_date, sh.dates[i]);
+    }
+
+    rq_market_freeze(market);
+    if (!sh.yc->frozen)
+        ret = -1;
+
+    /* implying a rate from a frozen market doesn't cache it */
+    exchange_rate_mgr = rq_market_get_exchange_rate_mgr(market);
+    num_rates = rq_tree_rb_size(exchange_rate_mgr->tree);
+    if (rq_exchange_rate_mgr_get_or_imply(exchange_rate_mgr, rq_market_get_forward_curve_mgr(market), NULL,
+                                          "BRL", "BRL", sh.from_date, &exchange_rate, 1) != 0 ||
+        exchange_rate != 1.0 || rq_tree_rb_size(exchange_rate_mgr->tree) != num_rates)
+        ret = -1;
+
+    for (i = 0; i < NUM_THREADS; i++)
+    {
+        workers[i].sh = &sh;
+        workers[i].seed = i + 1;
+        workers[i].failures = 0;
+    }
+
+#if defined(WIN32)
+    {
+        HANDLE threads[NUM_THREADS];
+
+        for (i = 0; i < NUM_THREADS; i++)
+            threads[i] = CreateThread(NULL, 0, worker_main, &workers[i], 0, NULL);
+        WaitForMultipleObjects(NUM_THREADS, threads, TRUE, INFINITE);
+        for (i = 0; i < NUM_THREADS; i++)
+            CloseHandle(threads[i]);
+    }
+#elif defined(RQ_THREADS)
+    {
+        pthread_t threads[NUM_THREADS];
+
+        for (i = 0; i < NUM_THREADS; i++)
+            pthread_create(&threads[i], NULL, worker_main, &workers[i]);
+        for (i = 0; i < NUM_THREADS; i++)
+            pthread_join(threads[i], NULL);
+    }
+#else
+    /* without locking the caches can only be used from one thread */
+    for (i = 0; i < NUM_THREADS; i++)
+        run_worker(&workers[i]);
+#endif
+
+    for (i = 0; i < NUM_THREADS; i++)
+        if (workers[i].failures)
+        {
+            printf("thread %u: %d wrong results\n", i, workers[i].failures);
+            ret = -1;
+        }
+
+    /* changing the curve thaws it */
+    rq_yield_curve_set_discount_factor(sh.yc, sh.from_date + 30, 0.99);
+    if (sh.yc->frozen)
+        ret = -1;
+
+    rq_schedule_cache_free(sh.schedule_cache);
+    rq_yield_curve_free(plain);
+    rq_market_free(market);
+    rq_system_free(system);
+
+    if (ret == 0)
+        printf("Thread safety test successful\n");
+
+    return ret;
+}
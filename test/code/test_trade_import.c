@@ -0,0 +1,173 @@
+#include <rq.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Imports a trade file many read blocks long, checking every trade
+   arrives in order and that the first arrive long before the file
+   has all been read. */
+
+#define TRADE_FILE "test_trade_import.xml"
+#define NUM_TRADES 20000
+
+struct consumer {
+    rq_stream_t stream; /**< a file stream, which is safe to tell from another thread */
+    unsigned long num_trades;
+    long first_trade_position;
+    int in_order;
+};
+
+/* Returns the size of the file written. Any junk goes before the
+   first trade. */
+static long
+write_trade_file(const char *junk)
+{
+    FILE *fh = fopen(TRADE_FILE, "w");
+    unsigned int i;
+    long size;
+
+    if (!fh)
+        return -1;
+
+    fputs("<?xml version=\"1.0\"?>\n<trades>\n", fh);
+    if (junk)
+        fputs(junk, fh);
+    for (i = 1; i <= NUM_TRADES; i++)
+        fprintf(fh, "  <trade id=\"%u\" key=\"T%u\">\n"
+                "    <type>%s</type>\n"
+                "    <buySell>%s</buySell>\n"
+                "    <counterparty>CPTY%u</counterparty>\n"
+                "    <book>RATES</book>\n"
+                "    <data>notional=%u;rate=0.0425</data>\n"
+                "  </trade>\n",
+                i, i, (i % 3 ? "SWAP" : "FRA"), (i % 2 ? "B" : "S"), i % 50, i * 1000);
+    fputs("</trades>\n", fh);
+    size = ftell(fh);
+
+    fclose(fh);
+
+    return size;
+}
+
+static void
+check_trade(void *data, rq_trade_t trade)
+{
+    struct consumer *c = (struct consumer *)data;
+
+    if (c->num_trades == 0 && c->stream)
+        c->first_trade_position = rq_stream_tell(c->stream);
+    c->num_trades++;
+    if (trade->trd_id != (int)c->num_trades)
+        c->in_order = 0;
+
+    rq_trade_free(trade);
+}
+
+static unsigned long
+consume(rq_stream_t stream, struct consumer *c, int tell)
+{
+    unsigned long num_trades = 0;
+
+    memset(c, 0, sizeof(struct consumer));
+    c->stream = (tell ? stream : NULL);
+    c->in_order = 1;
+    if (rq_trade_import(stream, "trades/trade", check_trade, c, &num_trades) != RQ_OK)
+        return 0;
+
+    return num_trades;
+}
+
+int
+main(int argc, char **argv)
+{
+    rq_trade_mgr_t trade_mgr = rq_trade_mgr_alloc();
+    rq_stream_t stream;
+    struct consumer c;
+    unsigned long num_trades;
+    rq_trade_t trade;
+    long file_size = write_trade_file(NULL);
+    int ret = 0;
+
+    if (file_size <= 0)
+    {
+        printf("can't write %s\n", TRADE_FILE);
+        return -1;
+    }
+
+    /* the first trades are consumed before most of the file is read */
+    stream = rq_stream_file_open(TRADE_FILE, "r");
+    num_trades = consume(stream, &c, 1);
+    if (num_trades != NUM_TRADES || c.num_trades != NUM_TRADES || !c.in_order ||
+        c.first_trade_position > file_size / 2)
+    {
+        printf("file stream: imported %lu trades, consumed %lu, the first at %ld of %ld bytes\n", 
+               num_trades, c.num_trades, c.first_trade_position, file_size);
+        ret = -1;
+    }
+    rq_stream_free(stream);
+
+    stream = rq_stream_mmap_open(TRADE_FILE);
+    num_trades = consume(stream, &c, 0);
+    if (num_trades != NUM_TRADES || c.num_trades != NUM_TRADES || !c.in_order)
+    {
+        printf("mapped stream: imported %lu trades, consumed %lu\n", num_trades, c.num_trades);
+        ret = -1;
+    }
+    rq_stream_free(stream);
+
+    stream = rq_stream_file_open(TRADE_FILE, "r");
+    if (rq_trade_import_to_mgr(stream, "trades/trade", trade_mgr, &num_trades) != RQ_OK ||
+        num_trades != NUM_TRADES || rq_trade_mgr_size(trade_mgr) != NUM_TRADES ||
+        rq_trade_mgr_get_trade_type_size(trade_mgr, "FRA") != NUM_TRADES / 3)
+    {
+        printf("importing into the trade manager failed\n");
+        ret = -1;
+    }
+    rq_stream_free(stream);
+
+    trade = rq_trade_mgr_get(trade_mgr, 4321);
+    if (!trade || strcmp(trade->trd_key, "T4321") || strcmp(trade->trd_tty_code, "SWAP") ||
+        strcmp(trade->trd_bys_code, "B") || strcmp(trade->trd_cpt_key, "CPTY21") ||
+        strcmp(trade->trd_bok_code, "RATES") || strcmp(trade->trd_data, "notional=4321000;rate=0.0425") ||
+        trade->trd_usr_id != NULL)
+    {
+        printf("trade 4321 wasn't imported properly\n");
+        ret = -1;
+    }
+
+    /* a file that stops part way through */
+    stream = rq_stream_file_open(TRADE_FILE, "w");
+    rq_stream_write_string(stream, "<trades><trade id=\"1\"><type>SWAP</type></trade><trade id=\"2\"><type>");
+    rq_stream_free(stream);
+    stream = rq_stream_file_open(TRADE_FILE, "r");
+    memset(&c, 0, sizeof(c));
+    if (rq_trade_import(stream, "trades/trade", check_trade, &c, &num_trades) != RQ_ERR_XML_PARSER_BAD_FORMAT ||
+        num_trades != 1 || c.num_trades != 1)
+    {
+        printf("importing a truncated file gave %lu trades\n", num_trades);
+        ret = -1;
+    }
+    rq_stream_free(stream);
+
+    /* a file that's malformed before the first trade, which isn't
+       read past the blocks already queued */
+    file_size = write_trade_file("  <!x>\n");
+    stream = rq_stream_file_open(TRADE_FILE, "r");
+    memset(&c, 0, sizeof(c));
+    if (rq_trade_import(stream, "trades/trade", check_trade, &c, &num_trades) != RQ_ERR_XML_PARSER_BAD_FORMAT ||
+        num_trades != 0 || rq_stream_tell(stream) > (RQ_TRADE_IMPORT_NUM_BLOCKS + 2) * RQ_TRADE_IMPORT_BLOCK_SIZE)
+    {
+        printf("importing a malformed file gave %lu trades, reading %ld of %ld bytes\n",
+               num_trades, rq_stream_tell(stream), file_size);
+        ret = -1;
+    }
+    rq_stream_free(stream);
+    remove(TRADE_FILE);
+
+    rq_trade_mgr_free(trade_mgr);
+
+    if (ret == 0)
+        printf("Trade import test successful\n");
+
+    return ret;
+}
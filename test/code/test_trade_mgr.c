@@ -0,0 +1,79 @@
+#include <rq.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *trade_types[] = { "SWAP", "FRA", "FXFWD" };
+
+int
+main(int argc, char **argv)
+{
+    rq_trade_mgr_t trade_mgr = rq_trade_mgr_alloc();
+    rq_trade_mgr_iterator_t it = rq_trade_mgr_iterator_alloc();
+    sqlite3 *db;
+    char sql[256];
+    unsigned long num_swaps = 0;
+    unsigned int num_batches = 0;
+    int i;
+    int ret = 0;
+
+    /* a book of 1000 trades of three types, loaded from a database */
+    sqlite3_open(":memory:", &db);
+    sqlite3_exec(db, "CREATE TABLE trade (trd_id INTEGER, trd_key TEXT, trd_insert_time TEXT, trd_usr_id TEXT, trd_tst_code TEXT, trd_tty_code TEXT, trd_bys_code TEXT, trd_cpt_key TEXT, trd_bok_code TEXT, trd_data TEXT)", NULL, NULL, NULL);
+    sqlite3_exec(db, "BEGIN", NULL, NULL, NULL);
+    for (i = 1; i <= 1000; i++)
+    {
+        sprintf(sql, "INSERT INTO trade VALUES (%d, 'T%d', '2009-01-01', 'brett', 'LIVE', '%s', 'B', 'CPTY', 'BOOK', NULL)",
+                i, i, trade_types[i % 3]);
+        sqlite3_exec(db, sql, NULL, NULL, NULL);
+    }
+    sqlite3_exec(db, "COMMIT", NULL, NULL, NULL);
+
+    if (rq_trade_mgr_load(trade_mgr, db) != 1000 || rq_trade_mgr_size(trade_mgr) != 1000)
+        ret = -1;
+    sqlite3_close(db);
+
+    /* a trade added by hand */
+    rq_trade_mgr_add(trade_mgr, rq_trade_alloc(1001, "T1001", NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL));
+
+    if (rq_trade_mgr_get_trade_type_count(trade_mgr) != 4 ||
+        strcmp(rq_trade_mgr_get_trade_type_at(trade_mgr, 0), "FRA") ||
+        rq_trade_mgr_get_trade_type_size(trade_mgr, "FRA") != 334 ||
+        rq_trade_mgr_get_trade_type_size(trade_mgr, NULL) != 1)
+        ret = -1;
+
+    if (strcmp(rq_trade_mgr_get(trade_mgr, 500)->trd_key, "T500") ||
+        strcmp(rq_trade_mgr_get(trade_mgr, 500)->trd_tty_code, "FXFWD") ||
+        rq_trade_mgr_get(trade_mgr, 1001)->trd_data != NULL ||
+        rq_trade_mgr_get(trade_mgr, 2000) != NULL)
+        ret = -1;
+
+    /* walk the swaps a batch at a time */
+    for (rq_trade_mgr_begin_type(trade_mgr, "SWAP", it); !rq_trade_mgr_at_end(it); rq_trade_mgr_next(it))
+    {
+        unsigned int num_trades;
+        rq_trade_t trades = rq_trade_mgr_iterator_deref(it, &num_trades);
+        unsigned int j;
+
+        for (j = 0; j < num_trades; j++)
+        {
+            if (strcmp(trades[j].trd_tty_code, "SWAP") || trades[j].trd_id % 3 != 0)
+                ret = -1;
+            num_swaps++;
+        }
+        num_batches++;
+    }
+    if (num_swaps != 333 || num_batches != (333 + RQ_TRADE_MGR_BATCH_SIZE - 1) / RQ_TRADE_MGR_BATCH_SIZE)
+        ret = -1;
+
+    rq_trade_mgr_begin_type(trade_mgr, "BOND", it);
+    if (!rq_trade_mgr_at_end(it))
+        ret = -1;
+
+    rq_trade_mgr_iterator_free(it);
+    rq_trade_mgr_free(trade_mgr);
+
+    if (ret == 0)
+        printf("Trade manager test successful\n");
+
+    return ret;
+}
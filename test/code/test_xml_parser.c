@@ -0,0 +1,216 @@
+#include <rq.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Parses the same document through the stream parser, a
+   memory-mapped stream and the view callback, and checks each
+   produces the same events. */
+
+#define XML_FILE "test_xml_parser.xml"
+
+static const char *document =
+    "<?xml version=\"1.0\"?>\n"
+    "<!-- a comment with - dashes -- in it -->\n"
+    "<system name=\"test\">\n"
+    "  <calendar id='SYD' weekends=\"sat sun\">\n"
+    "    <holiday date=\"2009-01-26\"/>\n"
+    "    <holiday date=\"2009-04-25\" name=\"Anzac Day, a rather long attribute value\" />\n"
+    "  </calendar>\n"
+    "  <rate id=\"AUD.RATE.1\"><value>0.03512345678901234567890</value><term>3M</term></rate>\n"
+    "  <empty></empty>\n"
+    "</system >\n";
+
+static void
+log_event(char *log, enum rq_xml_parser_parse_event_type event_type, const char *p1, const char *p2, const char *p3)
+{
+    char *end = log + strlen(log);
+
+    sprintf(end, "%d[%s][%s][%s]\n", (int)event_type, p1, p2 ? p2 : "-", p3 ? p3 : "-");
+}
+
+static void
+string_cb(void *data, enum rq_xml_parser_parse_event_type event_type, const char *p1, const char *p2, const char *p3)
+{
+    log_event((char *)data, event_type, p1, p2, p3);
+}
+
+static void
+view_cb(void *data, enum rq_xml_parser_parse_event_type event_type, const struct rq_xml_parser_view *v1, const struct rq_xml_parser_view *v2, const struct rq_xml_parser_view *v3)
+{
+    char s[3][256];
+    const struct rq_xml_parser_view *views[3];
+    int i;
+
+    views[0] = v1;
+    views[1] = v2;
+    views[2] = v3;
+    for (i = 0; i < 3; i++)
+        if (views[i])
+            sprintf(s[i], "%.*s", (int)views[i]->len, views[i]->str);
+
+    log_event((char *)data, event_type, s[0], v2 ? s[1] : NULL, v3 ? s[2] : NULL);
+}
+
+/* Events over a document too big to log, folded into a checksum. */
+struct event_sum {
+    unsigned long num_events;
+    unsigned long hash;
+};
+
+static void
+sum_view(struct event_sum *sum, const struct rq_xml_parser_view *v)
+{
+    unsigned i;
+
+    for (i = 0; v && i < v->len; i++)
+        sum->hash = (sum->hash ^ (unsigned char)v->str[i]) * 16777619UL;
+    sum->hash = (sum->hash ^ 0xFF) * 16777619UL;
+}
+
+static void
+sum_cb(void *data, enum rq_xml_parser_parse_event_type event_type, const struct rq_xml_parser_view *v1, const struct rq_xml_parser_view *v2, const struct rq_xml_parser_view *v3)
+{
+    struct event_sum *sum = (struct event_sum *)data;
+
+    sum->num_events++;
+    sum->hash = (sum->hash ^ (unsigned long)event_type) * 16777619UL;
+    sum_view(sum, v1);
+    sum_view(sum, v2);
+    sum_view(sum, v3);
+}
+
+static void
+parse_sum(rq_stream_t stream, struct event_sum *sum)
+{
+    rq_xml_parser_t parser = rq_xml_parser_alloc();
+
+    sum->num_events = 0;
+    sum->hash = 2166136261UL;
+    rq_xml_parser_set_callback_data(parser, sum);
+    rq_xml_parser_set_view_callback(parser, sum_cb);
+    rq_xml_parser_parse(parser, stream);
+    rq_xml_parser_free(parser);
+}
+
+static void
+parse(rq_stream_t stream, char *log, short use_views)
+{
+    rq_xml_parser_t parser = rq_xml_parser_alloc();
+
+    log[0] = '\0';
+    rq_xml_parser_set_callback_data(parser, log);
+    if (use_views)
+        rq_xml_parser_set_view_callback(parser, view_cb);
+    else
+        rq_xml_parser_set_callback(parser, string_cb);
+
+    rq_xml_parser_parse(parser, stream);
+    rq_xml_parser_free(parser);
+}
+
+int
+main(int argc, char **argv)
+{
+    static char file_log[8192];
+    static char mmap_log[8192];
+    static char view_log[8192];
+    static char file_view_log[8192];
+    FILE *fh = fopen(XML_FILE, "w");
+    rq_stream_t stream;
+    unsigned long len;
+    int ret = 0;
+
+    fputs(document, fh);
+    fclose(fh);
+
+    stream = rq_stream_file_open(XML_FILE, "r");
+    parse(stream, file_log, 0);
+    rq_stream_free(stream);
+
+    stream = rq_stream_mmap_open(XML_FILE);
+    if (!rq_stream_mmap_get_buffer(stream, &len) || len != strlen(document))
+        ret = -1;
+    parse(stream, mmap_log, 0);
+    if (!rq_stream_at_end(stream))
+        ret = -1;
+    rq_stream_rewind(stream);
+    parse(stream, view_log, 1);
+    rq_stream_free(stream);
+
+    /* a view callback on a stream that isn't mapped */
+    stream = rq_stream_file_open(XML_FILE, "r");
+    parse(stream, file_view_log, 1);
+    rq_stream_free(stream);
+
+    remove(XML_FILE);
+
+    if (!strstr(file_log, "[holiday][name][Anzac Day, a rather long attribute value]") ||
+        !strstr(file_log, "[value][0.03512345678901234567890]") ||
+        !strstr(file_log, "[system][-][-]"))
+    {
+        printf("unexpected stream parser events:\n%s", file_log);
+        ret = -1;
+    }
+
+    if (strcmp(file_log, mmap_log))
+    {
+        printf("memory-mapped events differ:\n%s", mmap_log);
+        ret = -1;
+    }
+    if (strcmp(file_log, view_log))
+    {
+        printf("view events differ:\n%s", view_log);
+        ret = -1;
+    }
+    if (strcmp(file_log, file_view_log))
+    {
+        printf("file stream view events differ:\n%s", file_view_log);
+        ret = -1;
+    }
+
+    if (rq_stream_mmap_open("no_such_file.xml") != NULL)
+        ret = -1;
+
+    /* A file stream is parsed a chunk at a time, so tags, values
+       and comments fall across chunk boundaries, and one value is
+       longer than a chunk. */
+    {
+        struct event_sum file_sum;
+        struct event_sum mmap_sum;
+        int i;
+
+        fh = fopen(XML_FILE, "w");
+        fputs("<?xml version=\"1.0\"?>\n<documents>\n", fh);
+        for (i = 0; i < 2000; i++)
+            fputs(strchr(document, '\n') + 1, fh);
+        fputs("<long>", fh);
+        for (i = 0; i < RQ_XML_PARSER_CHUNK_SIZE / 8; i++)
+            fputs("0123456789", fh);
+        fputs("</long>\n</documents>\n", fh);
+        fclose(fh);
+
+        stream = rq_stream_file_open(XML_FILE, "r");
+        parse_sum(stream, &file_sum);
+        rq_stream_free(stream);
+
+        stream = rq_stream_mmap_open(XML_FILE);
+        parse_sum(stream, &mmap_sum);
+        rq_stream_free(stream);
+
+        remove(XML_FILE);
+
+        if (file_sum.num_events != mmap_sum.num_events || file_sum.hash != mmap_sum.hash ||
+            mmap_sum.num_events < 2000 * 20)
+        {
+            printf("chunked parse gave %lu events, the mapped parse %lu\n", 
+                   file_sum.num_events, mmap_sum.num_events);
+            ret = -1;
+        }
+    }
+
+    if (ret == 0)
+        printf("XML parser test successful\n");
+
+    return ret;
+}